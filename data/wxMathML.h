@@ -18,1619 +18,1701 @@
 /* Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA         */
 unsigned char wxMathML_lisp_gz[] = {
   0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcc, 0x3c,
-  0x6b, 0x93, 0xdb, 0x36, 0x92, 0x9f, 0xed, 0x5f, 0x81, 0xd2, 0x8c, 0x23,
-  0x72, 0x2c, 0xce, 0x2b, 0xa9, 0xbb, 0xec, 0xd8, 0x71, 0x6a, 0x36, 0x93,
-  0x87, 0xb3, 0xe3, 0xc4, 0x65, 0x3b, 0x9b, 0x6c, 0x9d, 0xf7, 0x1c, 0x8a,
-  0x84, 0x24, 0xae, 0xf9, 0x32, 0x08, 0x8e, 0xa4, 0xa4, 0x3c, 0x3f, 0xeb,
-  0xfe, 0xc0, 0xfd, 0xb1, 0xeb, 0x07, 0x00, 0x82, 0x14, 0x67, 0xe2, 0x47,
-  0xb6, 0xea, 0x5c, 0xd9, 0x95, 0x04, 0x76, 0x37, 0x1a, 0xfd, 0x42, 0x77,
-  0x03, 0x9c, 0x60, 0x51, 0xa9, 0x22, 0xd6, 0x42, 0x8b, 0xc9, 0xc3, 0xa6,
-  0xad, 0x6b, 0x25, 0x9b, 0xe6, 0xc7, 0x56, 0xd7, 0xad, 0x7e, 0x34, 0x09,
-  0xef, 0x3e, 0x78, 0x20, 0xd6, 0x9b, 0x27, 0xf1, 0x26, 0x2b, 0x62, 0xb1,
-  0x29, 0x72, 0x61, 0x80, 0x83, 0x79, 0xdc, 0xc8, 0x54, 0x54, 0xa5, 0xb8,
-  0x88, 0xaf, 0xb2, 0x54, 0x5c, 0xa8, 0x6d, 0x93, 0xc6, 0xb9, 0x14, 0x4f,
-  0x62, 0xbd, 0x7a, 0x72, 0x29, 0x6a, 0x95, 0x95, 0x3a, 0x2b, 0x97, 0x44,
-  0xe0, 0xbc, 0x4c, 0x95, 0xfc, 0x97, 0xf8, 0x7b, 0x95, 0x56, 0x75, 0x76,
-  0x25, 0x93, 0x99, 0x10, 0xa7, 0xc7, 0xc7, 0x9f, 0x45, 0xa7, 0xc7, 0x27,
-  0x9f, 0xe1, 0xf3, 0x6f, 0xdb, 0x52, 0x4b, 0x25, 0xfe, 0xf6, 0xbf, 0xff,
-  0x53, 0x66, 0xcb, 0xa6, 0x88, 0xcb, 0x72, 0x26, 0xf0, 0x19, 0x00, 0x9c,
-  0x1e, 0x23, 0xc0, 0xb3, 0x6a, 0x2e, 0x95, 0x16, 0x17, 0x55, 0x9a, 0x49,
-  0x05, 0xd8, 0x02, 0x09, 0x9c, 0xfc, 0xc5, 0x3d, 0x17, 0xcf, 0x9f, 0x5e,
-  0xfc, 0x12, 0x5d, 0x66, 0x89, 0x2c, 0x1b, 0x19, 0x3d, 0x4e, 0x25, 0xcc,
-  0xbd, 0x00, 0xd0, 0x33, 0xf1, 0xed, 0xd3, 0xcb, 0xe8, 0xf4, 0xf0, 0xf8,
-  0xfe, 0x5d, 0x04, 0x7b, 0xb1, 0xca, 0x1a, 0xb1, 0xc8, 0x80, 0xcb, 0xac,
-  0x29, 0xa7, 0x5a, 0xa4, 0x99, 0x92, 0x89, 0xce, 0xb7, 0x22, 0xaf, 0xe2,
-  0x14, 0x56, 0x33, 0xdf, 0x8a, 0x82, 0x57, 0x0a, 0xeb, 0x6a, 0x74, 0xac,
-  0x74, 0x5b, 0x8b, 0x6a, 0xe1, 0x04, 0x70, 0x88, 0x44, 0x1e, 0x97, 0x8d,
-  0x96, 0x71, 0x2a, 0x96, 0xb2, 0x94, 0x2a, 0xd6, 0xf2, 0xd5, 0x7a, 0x03,
-  0x02, 0x59, 0x15, 0xf9, 0x61, 0xb3, 0x9a, 0x89, 0xf5, 0x4a, 0x96, 0x42,
-  0xb5, 0x25, 0x10, 0x2a, 0xdb, 0x38, 0xcf, 0xb7, 0x33, 0x07, 0xd8, 0x88,
-  0x18, 0xf1, 0x97, 0xbf, 0x65, 0xf5, 0x14, 0x26, 0xbb, 0x92, 0xaa, 0xc9,
-  0x60, 0x1e, 0xbd, 0x02, 0x71, 0x02, 0x5f, 0x59, 0x99, 0xe4, 0x2d, 0x72,
-  0x91, 0xe1, 0x98, 0xec, 0xa4, 0x3e, 0xcf, 0xca, 0x58, 0x6d, 0x45, 0x5c,
-  0xa6, 0x02, 0xf1, 0x1b, 0x58, 0x9c, 0xd0, 0x95, 0xe5, 0xb4, 0x6d, 0x40,
-  0xca, 0x22, 0x16, 0x67, 0x79, 0xd6, 0xd4, 0xd1, 0x9b, 0x36, 0x93, 0x5a,
-  0x24, 0x55, 0x01, 0xd3, 0xa7, 0xc8, 0x2e, 0x49, 0x2f, 0xd6, 0x30, 0x11,
-  0x28, 0xe7, 0x8c, 0x25, 0x10, 0x83, 0x8e, 0xab, 0x38, 0x59, 0x89, 0x42,
-  0xc6, 0x65, 0xc3, 0x0c, 0xb8, 0xd9, 0xd2, 0x4a, 0x92, 0x6c, 0x4a, 0x09,
-  0xac, 0xe8, 0x0a, 0xf1, 0x5f, 0x97, 0xd5, 0x1a, 0x17, 0xa6, 0x98, 0x29,
-  0x5a, 0x2b, 0xce, 0x26, 0xd6, 0x71, 0x23, 0x8a, 0xea, 0x8a, 0x25, 0x87,
-  0x3c, 0x9f, 0xab, 0x64, 0x75, 0x99, 0x95, 0xed, 0x66, 0x26, 0xbe, 0x05,
-  0x36, 0xab, 0x6a, 0x86, 0xf8, 0x4f, 0xe2, 0xa4, 0xae, 0x94, 0x6e, 0x66,
-  0x22, 0xd9, 0x2e, 0xd7, 0x19, 0x28, 0x77, 0x91, 0x95, 0xaf, 0x67, 0x62,
-  0x55, 0x15, 0x72, 0xae, 0xe4, 0x7a, 0x86, 0x1c, 0x45, 0x59, 0x19, 0xa5,
-  0xc5, 0x72, 0x26, 0x7e, 0x9a, 0x83, 0x35, 0xb4, 0xa2, 0x52, 0xa2, 0xc9,
-  0x8a, 0x2c, 0x8f, 0x15, 0x92, 0xa8, 0xe3, 0xe4, 0x75, 0xbc, 0x94, 0xea,
-  0xd0, 0xe8, 0xd1, 0xda, 0x59, 0x64, 0xed, 0x0c, 0x20, 0xc0, 0x40, 0x82,
-  0xf5, 0x2a, 0xc3, 0x75, 0xc5, 0xaf, 0x41, 0xda, 0xa0, 0xbb, 0xa2, 0x6a,
-  0x34, 0x2a, 0x50, 0x5b, 0xc5, 0xb3, 0x3d, 0x03, 0xdb, 0x89, 0x92, 0xa0,
-  0x12, 0x62, 0x7c, 0x60, 0xc0, 0xc1, 0xc5, 0x93, 0x8b, 0x70, 0x26, 0x2e,
-  0x64, 0x22, 0x0b, 0xb0, 0x3a, 0xb4, 0xd4, 0xd3, 0xa3, 0xef, 0x51, 0x9b,
-  0xa0, 0x04, 0xf8, 0xf1, 0x29, 0x92, 0x48, 0xf2, 0xaa, 0x91, 0x60, 0x38,
-  0xce, 0x0b, 0x70, 0xf5, 0x95, 0xca, 0x96, 0xa0, 0xab, 0x5c, 0xbc, 0x90,
-  0xbf, 0x80, 0x0e, 0x4a, 0xab, 0xe1, 0xa4, 0x4a, 0x25, 0x6a, 0xb5, 0x88,
-  0x13, 0x2d, 0x37, 0x24, 0x3a, 0x92, 0x0b, 0xb8, 0x92, 0x60, 0x86, 0x11,
-  0x7b, 0x51, 0xe5, 0x79, 0xb5, 0xc6, 0xa5, 0x00, 0x6f, 0x69, 0xa6, 0x49,
-  0x4f, 0xf9, 0xf6, 0x8c, 0xec, 0x5b, 0x04, 0x49, 0x08, 0x74, 0xea, 0x2d,
-  0x4c, 0xb1, 0xd2, 0xe2, 0xe4, 0x2f, 0x9f, 0xff, 0xe7, 0x4c, 0x3c, 0x03,
-  0xd4, 0x58, 0xa5, 0xe2, 0xfb, 0x43, 0xf1, 0x0d, 0x2c, 0x06, 0x54, 0xce,
-  0xb0, 0xe0, 0x41, 0x79, 0x0e, 0xd0, 0x0a, 0xad, 0x1b, 0x18, 0x68, 0xc8,
-  0x76, 0xe2, 0x14, 0x88, 0xe2, 0xaf, 0x33, 0xf6, 0xc7, 0xad, 0xf8, 0x56,
-  0x55, 0xbf, 0x65, 0xe4, 0x6a, 0xc7, 0x27, 0x8c, 0x69, 0x61, 0x60, 0x0d,
-  0x1e, 0xf8, 0xf7, 0x6d, 0x1a, 0xaf, 0xc4, 0x93, 0x2c, 0x5f, 0xaa, 0xb8,
-  0x10, 0xc1, 0xf7, 0x4f, 0x40, 0x3c, 0xcf, 0x65, 0xad, 0x9d, 0x7c, 0x76,
-  0xb1, 0xbd, 0xc9, 0xcf, 0xc4, 0x5f, 0x41, 0x35, 0x20, 0x86, 0x9f, 0xb3,
-  0x1c, 0x96, 0x2e, 0x82, 0xbf, 0x5e, 0xfe, 0x0c, 0x04, 0x7e, 0x4c, 0x74,
-  0xe5, 0xd0, 0xc9, 0x4a, 0xa4, 0x5e, 0x55, 0x29, 0x2d, 0xf7, 0xa9, 0xaa,
-  0xd2, 0x36, 0x41, 0x51, 0xac, 0x29, 0xe4, 0xa8, 0xaa, 0x00, 0x0b, 0x37,
-  0x06, 0x9a, 0x61, 0xac, 0xc0, 0x39, 0xe4, 0x86, 0x42, 0x15, 0x4a, 0x18,
-  0xc8, 0xa6, 0x55, 0x29, 0x41, 0x9b, 0x88, 0x1e, 0x0b, 0x25, 0x51, 0xf6,
-  0x00, 0x43, 0xba, 0x97, 0x68, 0x1c, 0xe4, 0x26, 0x60, 0xf7, 0x09, 0xa0,
-  0x1c, 0x0a, 0xf1, 0x4d, 0x5b, 0xa6, 0x71, 0x01, 0x36, 0xca, 0x3e, 0x4a,
-  0x9e, 0xa9, 0x55, 0xdc, 0x47, 0xf3, 0x66, 0xd0, 0x4a, 0x62, 0xd4, 0x40,
-  0x0a, 0xc0, 0x5a, 0x67, 0xf1, 0xf0, 0x1b, 0xa5, 0x42, 0xfa, 0x5c, 0x67,
-  0x7a, 0xc5, 0xce, 0x05, 0x56, 0x09, 0x0a, 0x11, 0x4d, 0x3b, 0x6f, 0x74,
-  0xa6, 0xdb, 0x4e, 0x09, 0x20, 0x94, 0x6a, 0x59, 0x92, 0x94, 0xcc, 0x24,
-  0x88, 0x98, 0x95, 0x8b, 0x6c, 0x23, 0x8e, 0x80, 0x98, 0x34, 0x5f, 0xc0,
-  0x6e, 0xf9, 0x1b, 0x84, 0x96, 0x64, 0x85, 0x5f, 0x95, 0xcc, 0x63, 0xa6,
-  0x83, 0xb1, 0x69, 0x5b, 0xcc, 0xab, 0x1c, 0xd6, 0xf1, 0xf7, 0x58, 0x65,
-  0x55, 0xdb, 0x90, 0x49, 0xae, 0xe2, 0x72, 0x89, 0x41, 0x06, 0xdc, 0xb4,
-  0x80, 0x70, 0x86, 0x31, 0x82, 0xec, 0xbe, 0xa9, 0xd8, 0xc5, 0x4d, 0x64,
-  0x5e, 0x83, 0x1a, 0x44, 0x9e, 0xbd, 0x96, 0xc4, 0x3f, 0xac, 0xaf, 0xcd,
-  0x75, 0x83, 0x7e, 0x15, 0x78, 0xfb, 0xc0, 0x7a, 0x03, 0x82, 0x8f, 0x28,
-  0x04, 0x1e, 0xe1, 0x2e, 0x70, 0x37, 0xc0, 0x85, 0x96, 0x77, 0x85, 0xb0,
-  0x61, 0x14, 0xfe, 0x2b, 0x25, 0x0a, 0x13, 0xdd, 0x82, 0xc2, 0x11, 0x50,
-  0xa4, 0xd8, 0x8a, 0xeb, 0xe4, 0xc8, 0x5a, 0xc1, 0xa3, 0x12, 0xa4, 0x6c,
-  0x62, 0x0c, 0xb8, 0x84, 0x8e, 0xc1, 0x0f, 0x9a, 0x5a, 0x26, 0x19, 0x1a,
-  0x09, 0x58, 0x2f, 0xba, 0x84, 0x6a, 0x98, 0xee, 0xba, 0x52, 0xaf, 0x05,
-  0xe8, 0x05, 0xac, 0x02, 0xfc, 0x20, 0xad, 0xd6, 0xc0, 0x96, 0x10, 0x7b,
-  0xf7, 0x9b, 0x79, 0x92, 0x8b, 0xa0, 0x91, 0x7a, 0x21, 0x9a, 0x79, 0x94,
-  0x15, 0x75, 0x7e, 0x76, 0x76, 0x90, 0xca, 0x45, 0x0c, 0x9c, 0x47, 0x72,
-  0xc3, 0xe6, 0x10, 0x31, 0xf7, 0x07, 0xe2, 0xec, 0xa7, 0x17, 0xdf, 0x44,
-  0x9f, 0x03, 0xcb, 0xe0, 0x34, 0x10, 0x53, 0x4c, 0xe4, 0x10, 0x67, 0x1c,
-  0x2f, 0x79, 0x3c, 0x95, 0x09, 0x04, 0x16, 0x19, 0xe9, 0xaa, 0xbe, 0x8b,
-  0xce, 0x65, 0x39, 0xca, 0xab, 0x5a, 0x80, 0xf6, 0xc4, 0x3e, 0x04, 0x63,
-  0x60, 0x2e, 0xa4, 0x87, 0x07, 0x68, 0x06, 0x82, 0x25, 0x92, 0xcf, 0x6b,
-  0xf3, 0x4d, 0xcd, 0xeb, 0x90, 0x88, 0x01, 0xe3, 0x3f, 0x35, 0x20, 0xc8,
-  0x0a, 0x39, 0x4f, 0xd1, 0xd4, 0xc0, 0xaa, 0x56, 0xb2, 0xc1, 0x88, 0x03,
-  0x0e, 0x0e, 0x3c, 0x29, 0xd8, 0x97, 0x1a, 0x34, 0x18, 0xc3, 0x33, 0x72,
-  0x00, 0xab, 0x79, 0x23, 0xf6, 0xf3, 0x62, 0x83, 0xf3, 0x88, 0xbd, 0x97,
-  0x41, 0xd8, 0x8d, 0x2a, 0x7f, 0x94, 0x67, 0x38, 0x17, 0x0b, 0xb9, 0x16,
-  0x57, 0xa0, 0xed, 0x78, 0x9e, 0x03, 0xb1, 0xf5, 0x0a, 0xe2, 0x0f, 0xfc,
-  0xce, 0x5b, 0x29, 0x92, 0xb8, 0x14, 0x73, 0x89, 0xd2, 0x5d, 0x64, 0xcb,
-  0x16, 0x62, 0x07, 0x3b, 0x8c, 0x8d, 0xe8, 0xbc, 0xde, 0x05, 0xe0, 0x8a,
-  0x83, 0xf5, 0x26, 0xaa, 0xf3, 0x4a, 0x47, 0x65, 0x5b, 0x1c, 0x88, 0x63,
-  0x31, 0xc1, 0x40, 0xda, 0x48, 0x85, 0x4b, 0x87, 0x21, 0x74, 0x47, 0x63,
-  0xf9, 0x49, 0xab, 0x70, 0x19, 0x02, 0xa1, 0x27, 0xa1, 0x47, 0x62, 0x7f,
-  0xbd, 0x41, 0x25, 0xa3, 0x56, 0xc5, 0x64, 0xc2, 0x14, 0xdc, 0xc0, 0x00,
-  0xd9, 0xed, 0x29, 0xa8, 0xd8, 0x66, 0x25, 0xe5, 0x0e, 0x29, 0x30, 0x93,
-  0x1e, 0xa5, 0xce, 0x6c, 0x6e, 0xa7, 0x03, 0xf6, 0x2b, 0x71, 0xc7, 0x1c,
-  0xd2, 0x8b, 0x4b, 0x00, 0x83, 0x2d, 0x39, 0x6e, 0x41, 0xb3, 0x79, 0x0c,
-  0xd6, 0x97, 0xe5, 0x62, 0x72, 0x0e, 0xbf, 0x60, 0x38, 0x4b, 0xd0, 0xd7,
-  0x05, 0x8e, 0xcf, 0xc1, 0x28, 0xc0, 0x7c, 0xd7, 0x82, 0x11, 0xd0, 0xad,
-  0xbe, 0xec, 0xd1, 0x5a, 0x6f, 0x40, 0xa7, 0xea, 0x2b, 0x10, 0xe9, 0x45,
-  0xa6, 0x1c, 0x7b, 0x79, 0x95, 0x10, 0x70, 0xc7, 0x51, 0x5e, 0x55, 0xaf,
-  0xad, 0x9e, 0x71, 0x60, 0xda, 0x18, 0x3d, 0x90, 0x50, 0x76, 0x58, 0x5c,
-  0x6f, 0xbe, 0x93, 0x79, 0x7d, 0x3b, 0xc9, 0x46, 0xc6, 0xb0, 0x8b, 0x4a,
-  0xa6, 0xba, 0x02, 0xf0, 0x9b, 0x48, 0x31, 0xfc, 0x25, 0xec, 0x26, 0x97,
-  0x96, 0xc8, 0x3b, 0x52, 0xa5, 0xcd, 0x7b, 0x94, 0x2a, 0xc8, 0x10, 0x55,
-  0xfe, 0xaa, 0xc9, 0x7e, 0x93, 0x62, 0x1a, 0x04, 0x05, 0x80, 0x6a, 0xdc,
-  0x88, 0xeb, 0x50, 0x7c, 0x7e, 0x7c, 0x2c, 0xfe, 0xe3, 0xf8, 0x38, 0x34,
-  0x66, 0x83, 0x10, 0xa0, 0x70, 0x94, 0x22, 0xa2, 0x34, 0x43, 0x3a, 0x2c,
-  0x10, 0x97, 0xe5, 0x30, 0x96, 0xe3, 0xc7, 0x8c, 0x3b, 0xa4, 0x9a, 0xdc,
-  0x6e, 0x88, 0x05, 0x9b, 0x74, 0x1a, 0x55, 0x65, 0xbe, 0x8d, 0x62, 0x08,
-  0xc3, 0xcb, 0x52, 0xf0, 0xc7, 0x60, 0xa6, 0x75, 0x96, 0x2e, 0xa5, 0x6e,
-  0x76, 0xa6, 0xfa, 0x99, 0xc7, 0x5d, 0xa6, 0xe5, 0x26, 0x07, 0xd7, 0xa4,
-  0xb4, 0xe9, 0x70, 0xc8, 0x33, 0x06, 0xec, 0x44, 0x65, 0x35, 0x20, 0xa1,
-  0x97, 0x0a, 0x31, 0x79, 0xc6, 0x01, 0x1b, 0xd6, 0x0a, 0x9b, 0x3a, 0x04,
-  0xc4, 0x6d, 0xce, 0x61, 0x9d, 0xa1, 0x46, 0x65, 0xd7, 0x36, 0xb2, 0xb9,
-  0x5a, 0xb2, 0xe9, 0x7d, 0x45, 0x69, 0x86, 0x68, 0xc0, 0xf4, 0xd0, 0x71,
-  0x59, 0x52, 0x5f, 0x8e, 0xa2, 0xd5, 0xe5, 0x32, 0x89, 0x33, 0x55, 0x31,
-  0x22, 0x86, 0x94, 0x65, 0xd9, 0xe2, 0x13, 0xb0, 0x29, 0xf7, 0x0c, 0x62,
-  0x5d, 0x41, 0x29, 0x06, 0xaa, 0xd1, 0x89, 0xbe, 0x23, 0x58, 0xf8, 0x14,
-  0xab, 0x3c, 0x7d, 0x65, 0x68, 0x20, 0x51, 0x88, 0x25, 0x1c, 0x4c, 0xbe,
-  0x06, 0x76, 0x6a, 0x88, 0xd3, 0x39, 0x87, 0x60, 0x13, 0x9d, 0x29, 0xe1,
-  0x93, 0xf8, 0x08, 0x77, 0x4a, 0x08, 0xd3, 0xbf, 0x3c, 0xb9, 0x34, 0x54,
-  0xdb, 0xd2, 0x04, 0x3d, 0xd8, 0x88, 0x40, 0x06, 0x0a, 0x01, 0x82, 0x0d,
-  0x45, 0x47, 0x88, 0xb1, 0x0b, 0x88, 0x5b, 0x34, 0x56, 0x0b, 0x18, 0xbb,
-  0x13, 0xe4, 0x12, 0xa2, 0x70, 0x10, 0xe8, 0xa2, 0x8e, 0x36, 0xf6, 0x51,
-  0xe4, 0xb6, 0x42, 0x70, 0xf6, 0x4f, 0xe2, 0xa2, 0x7e, 0x30, 0x81, 0xf0,
-  0xf6, 0x09, 0x20, 0x00, 0x86, 0xe0, 0x7f, 0xb7, 0x61, 0xe4, 0x9a, 0x10,
-  0x1e, 0x0a, 0x82, 0x79, 0x47, 0xa4, 0x25, 0x23, 0x3d, 0x7a, 0x2f, 0xa4,
-  0xbd, 0x93, 0x4f, 0x09, 0xeb, 0x99, 0xd4, 0xad, 0x2a, 0x3f, 0x08, 0x15,
-  0x32, 0x60, 0xb9, 0xa0, 0xf4, 0xf9, 0x03, 0x90, 0x7f, 0x90, 0xeb, 0x1c,
-  0xf0, 0x2d, 0x2e, 0x21, 0xf3, 0xf7, 0xbb, 0x4c, 0x64, 0xe3, 0xb6, 0x9d,
-  0x73, 0x4c, 0x18, 0x29, 0x52, 0x82, 0xc9, 0x29, 0xdc, 0x84, 0x31, 0xf1,
-  0x6f, 0x4b, 0x08, 0x74, 0x40, 0x72, 0x8d, 0x4a, 0x85, 0xb1, 0x14, 0x9c,
-  0x1d, 0x43, 0xa1, 0x29, 0x2b, 0x60, 0x4f, 0xd7, 0x6d, 0x33, 0x8f, 0x29,
-  0xf5, 0xcc, 0x1b, 0xcd, 0xa4, 0x7a, 0x31, 0x9f, 0x53, 0x1a, 0xf4, 0x12,
-  0x28, 0x64, 0x4a, 0xe0, 0xb4, 0x33, 0x03, 0xf4, 0x11, 0x47, 0x20, 0xf8,
-  0x04, 0xb2, 0x07, 0x6d, 0x28, 0x32, 0x7b, 0x7b, 0xf7, 0x13, 0x0a, 0x2e,
-  0x01, 0x64, 0xf8, 0x59, 0xb3, 0x8a, 0x2a, 0xaa, 0x23, 0x8d, 0xa5, 0xf8,
-  0x75, 0xa6, 0x25, 0xf2, 0xe8, 0x3a, 0x7e, 0x78, 0xe4, 0xfd, 0xba, 0x37,
-  0x81, 0x24, 0x7e, 0x60, 0x6b, 0x77, 0xef, 0xe0, 0x3f, 0x96, 0x20, 0xe5,
-  0xc4, 0x62, 0xba, 0xdf, 0x40, 0x98, 0x85, 0x65, 0xda, 0xc9, 0xc3, 0x3f,
-  0x9e, 0x1e, 0xcd, 0xff, 0x01, 0x2c, 0xf5, 0x67, 0xc8, 0xd2, 0x60, 0x9c,
-  0x73, 0x23, 0x53, 0x29, 0x09, 0x59, 0x26, 0x15, 0x15, 0xa1, 0x68, 0xda,
-  0x28, 0x41, 0x4c, 0xd9, 0xbb, 0xfc, 0x44, 0x14, 0x94, 0x76, 0x27, 0x31,
-  0x08, 0x9a, 0x88, 0x98, 0x40, 0x02, 0xe2, 0x6d, 0x34, 0xe6, 0x0c, 0xb2,
-  0xa9, 0xab, 0x32, 0x45, 0x64, 0x8c, 0x33, 0x7e, 0xf2, 0x12, 0x20, 0x79,
-  0xe6, 0x0a, 0xc6, 0x3f, 0x3d, 0x0d, 0x4d, 0x26, 0x83, 0x46, 0x20, 0xe3,
-  0x62, 0x98, 0xbf, 0x88, 0x83, 0xa6, 0x4a, 0x5e, 0x4b, 0x1d, 0xc1, 0xfa,
-  0x4a, 0xce, 0xa0, 0x0f, 0x42, 0x76, 0x53, 0xa9, 0xcf, 0x5a, 0xbd, 0xc0,
-  0xd4, 0xe6, 0x36, 0xba, 0x49, 0x0b, 0x1c, 0x15, 0x5d, 0x7e, 0x84, 0x61,
-  0x3e, 0xc2, 0xe5, 0x21, 0x77, 0x07, 0x43, 0x4a, 0xbc, 0x98, 0x76, 0xb1,
-  0xc8, 0x31, 0x81, 0x28, 0x6a, 0x00, 0x56, 0x51, 0x59, 0x61, 0xb1, 0xba,
-  0xcc, 0xab, 0x39, 0x6e, 0x98, 0x5e, 0x0a, 0x46, 0x69, 0x53, 0x06, 0x25,
-  0x00, 0xa4, 0x61, 0xc0, 0xf7, 0x59, 0x41, 0x88, 0xc8, 0xaa, 0xa9, 0x15,
-  0x84, 0x79, 0xd0, 0x23, 0x15, 0xba, 0xe0, 0x14, 0x27, 0x18, 0xde, 0xaa,
-  0x68, 0x1d, 0xab, 0x92, 0x62, 0x08, 0xae, 0xd9, 0x6a, 0x8e, 0xa6, 0xf8,
-  0x35, 0x80, 0x2c, 0x36, 0x45, 0x4c, 0xa8, 0x7a, 0x53, 0x50, 0x7c, 0x10,
-  0x50, 0xcc, 0x75, 0x28, 0x7b, 0x53, 0x33, 0xa9, 0x19, 0x00, 0xff, 0xb8,
-  0xe3, 0xf8, 0xe9, 0x4d, 0xbb, 0x0b, 0xea, 0x1c, 0x71, 0xe6, 0xcf, 0xcb,
-  0x32, 0xfc, 0x15, 0xc3, 0x16, 0x44, 0x2d, 0x2b, 0x3e, 0xdb, 0x08, 0x89,
-  0x60, 0xd3, 0x4c, 0x5e, 0x47, 0x90, 0x55, 0x49, 0xb4, 0x29, 0xd2, 0x87,
-  0xd0, 0x61, 0xd8, 0xa3, 0x11, 0x05, 0x58, 0xad, 0x22, 0xff, 0x44, 0x2c,
-  0x04, 0x6a, 0x94, 0x2e, 0x1b, 0x20, 0x9b, 0x73, 0xa2, 0x03, 0xd1, 0x8e,
-  0x66, 0xb7, 0xb9, 0xc8, 0xee, 0x4c, 0xc1, 0x95, 0x71, 0x11, 0x13, 0x3b,
-  0xd3, 0x13, 0x11, 0x40, 0x0d, 0xc0, 0x75, 0xc2, 0xde, 0xcb, 0x43, 0x71,
-  0x65, 0x98, 0x0f, 0xb6, 0x12, 0x1d, 0x0f, 0x23, 0x87, 0x7c, 0x23, 0xae,
-  0x20, 0x87, 0x4b, 0x4f, 0xec, 0xa3, 0xf4, 0x74, 0x88, 0x24, 0xce, 0x28,
-  0x83, 0x17, 0xc1, 0xc9, 0x7d, 0x82, 0x33, 0x80, 0x05, 0xe4, 0xe1, 0x2b,
-  0x8f, 0x88, 0x79, 0x2c, 0xd2, 0x53, 0x0b, 0x41, 0x7e, 0x3d, 0x00, 0x80,
-  0x87, 0xa1, 0x8d, 0x41, 0x01, 0xa5, 0x05, 0xd3, 0x5e, 0x7a, 0x10, 0x60,
-  0x91, 0x25, 0x23, 0x2c, 0xcf, 0xa0, 0x50, 0x17, 0xc8, 0xe8, 0xce, 0x20,
-  0xcd, 0x1c, 0xa2, 0xbb, 0xe8, 0xb0, 0x13, 0x0b, 0xed, 0x59, 0x2c, 0x91,
-  0x57, 0x90, 0xba, 0x02, 0x2c, 0x98, 0x36, 0x6d, 0x58, 0x37, 0x3f, 0x7f,
-  0x65, 0x45, 0x67, 0xe1, 0x8c, 0x53, 0x51, 0x61, 0x14, 0x71, 0x62, 0x3c,
-  0x1d, 0x22, 0x41, 0xea, 0x62, 0x73, 0x80, 0x89, 0xaf, 0x14, 0x88, 0x6a,
-  0xf3, 0x36, 0x83, 0xdd, 0x12, 0x0a, 0xb1, 0x4a, 0x04, 0x9d, 0x2e, 0x40,
-  0x15, 0x46, 0xe0, 0xd9, 0x06, 0x44, 0x96, 0xe4, 0x11, 0x46, 0xda, 0xb3,
-  0x03, 0xa3, 0x3e, 0x42, 0x8a, 0x74, 0x56, 0xc8, 0x03, 0x96, 0x9c, 0x15,
-  0xed, 0x22, 0x5b, 0xbc, 0x13, 0x78, 0x0a, 0x71, 0x19, 0x9c, 0xa0, 0x55,
-  0xef, 0x04, 0x0d, 0x61, 0x0b, 0x58, 0x81, 0xb8, 0xa5, 0xd2, 0x77, 0x61,
-  0x25, 0x2b, 0x71, 0x67, 0x01, 0xc1, 0xa0, 0x7f, 0xbe, 0x03, 0x02, 0x03,
-  0x36, 0xc8, 0xbd, 0x02, 0xad, 0xde, 0x8a, 0xe0, 0x0c, 0xa1, 0x8b, 0xe9,
-  0xc3, 0xd4, 0xee, 0x4c, 0x5c, 0xc7, 0x18, 0xce, 0x87, 0x49, 0xdd, 0x08,
-  0x2a, 0xf7, 0xb0, 0x76, 0x12, 0x36, 0x8f, 0x42, 0x3f, 0xc5, 0x1b, 0x21,
-  0x31, 0x3e, 0xf7, 0x01, 0x16, 0x02, 0x98, 0x90, 0x5b, 0x4f, 0x3b, 0xb8,
-  0x19, 0x95, 0xd6, 0x27, 0x52, 0xd8, 0x3a, 0x01, 0xfb, 0xb3, 0xd9, 0xf4,
-  0x38, 0x8d, 0xae, 0x4f, 0xbd, 0x0f, 0xc1, 0x1f, 0x67, 0xbd, 0x0f, 0x98,
-  0xc4, 0x06, 0x15, 0x32, 0x14, 0xd6, 0x3f, 0xaa, 0x95, 0x94, 0x65, 0x74,
-  0x60, 0x24, 0x3b, 0x32, 0xf7, 0x77, 0xd8, 0xa0, 0xd2, 0xdb, 0x5a, 0xee,
-  0x72, 0x0c, 0x15, 0x9e, 0x1e, 0x63, 0xf7, 0xf9, 0xb6, 0xd1, 0xb2, 0x70,
-  0x48, 0xfc, 0x1f, 0xed, 0x9b, 0x4d, 0xb5, 0xd0, 0x6b, 0x2a, 0x6b, 0xe1,
-  0x59, 0xe8, 0xfd, 0xb6, 0x62, 0x03, 0xa3, 0x88, 0x93, 0x15, 0x64, 0x17,
-  0x0c, 0x31, 0x42, 0x1c, 0xab, 0x09, 0x81, 0x15, 0xb6, 0xa4, 0xde, 0x08,
-  0x85, 0x12, 0x9f, 0xbd, 0x80, 0xba, 0x8c, 0x7d, 0x80, 0xf7, 0x22, 0x36,
-  0x50, 0xd0, 0x28, 0x3d, 0xcb, 0xee, 0x08, 0xc9, 0xeb, 0x7b, 0xd7, 0xf7,
-  0xac, 0xa1, 0x41, 0x5e, 0x9c, 0xa5, 0x32, 0xb6, 0x55, 0x67, 0x57, 0x3b,
-  0x42, 0xb6, 0x83, 0x1b, 0x7c, 0xd6, 0x9c, 0x5d, 0xdf, 0xc3, 0x32, 0xce,
-  0x95, 0xc6, 0xcc, 0x02, 0x00, 0xda, 0xe9, 0x7b, 0x65, 0xde, 0x98, 0x7a,
-  0xb0, 0xfc, 0xea, 0xc1, 0x9b, 0xfa, 0xcd, 0xf0, 0x36, 0xe9, 0xc2, 0x48,
-  0xe1, 0x02, 0xc9, 0xf2, 0x95, 0x92, 0xd8, 0xef, 0x74, 0x81, 0x64, 0xc4,
-  0x47, 0xb0, 0x0b, 0x2b, 0x20, 0xcb, 0xaa, 0x57, 0x58, 0x95, 0x0a, 0x0a,
-  0x50, 0x02, 0xc3, 0x1e, 0xe6, 0xf5, 0x0c, 0x33, 0x33, 0xbd, 0x41, 0x6c,
-  0xc8, 0xd2, 0x02, 0xb1, 0xcb, 0x2c, 0xa9, 0x8e, 0x6d, 0x6c, 0x32, 0x87,
-  0x75, 0xec, 0x92, 0x3a, 0x0f, 0x87, 0xc0, 0xde, 0xce, 0x74, 0x8f, 0x17,
-  0x02, 0x24, 0xd1, 0x25, 0x37, 0x30, 0x67, 0x47, 0x04, 0xa6, 0x85, 0x4d,
-  0x0a, 0x8a, 0x92, 0x62, 0x26, 0x32, 0x6d, 0x7a, 0x5b, 0x73, 0xa8, 0x52,
-  0xb6, 0x5d, 0xaf, 0x0d, 0x16, 0x83, 0x0d, 0x19, 0xd1, 0x80, 0x35, 0x83,
-  0x73, 0xcc, 0xa9, 0xf6, 0x29, 0x32, 0x8d, 0x9d, 0x53, 0x8d, 0x0d, 0xe1,
-  0xd1, 0x69, 0xaf, 0xef, 0x71, 0x83, 0xd6, 0x91, 0x00, 0xa7, 0x8a, 0xb1,
-  0x53, 0x4a, 0xcb, 0xbe, 0x8a, 0x33, 0xae, 0x85, 0x62, 0x3d, 0x86, 0x8c,
-  0x3f, 0x57, 0x5a, 0xd7, 0xcd, 0xd9, 0xd1, 0x51, 0x03, 0x3e, 0x94, 0x48,
-  0x78, 0xb6, 0x94, 0x87, 0xa5, 0xd4, 0x47, 0xf5, 0x11, 0x47, 0x92, 0x23,
-  0x20, 0xda, 0x8c, 0x21, 0x3f, 0x27, 0xee, 0x68, 0x4e, 0xd6, 0x01, 0xb5,
-  0x5d, 0xba, 0xce, 0x2a, 0xca, 0x6c, 0x6a, 0x6a, 0xb2, 0x17, 0x19, 0xe6,
-  0x59, 0x53, 0x28, 0x86, 0xcb, 0xd7, 0xc2, 0xf6, 0xe1, 0xeb, 0x78, 0x39,
-  0xbe, 0xa6, 0x17, 0x95, 0xa1, 0xd8, 0x13, 0xce, 0x8c, 0xe4, 0x5b, 0x40,
-  0xce, 0x20, 0x56, 0x10, 0xdf, 0xe0, 0xd9, 0xf3, 0x8e, 0x65, 0x11, 0x27,
-  0x24, 0xf7, 0x43, 0x34, 0xda, 0x5d, 0x8a, 0xe7, 0x56, 0xfc, 0x56, 0x99,
-  0x9d, 0x39, 0x50, 0x3a, 0x4f, 0x7d, 0xce, 0x45, 0x9c, 0xc8, 0x81, 0x6a,
-  0xba, 0x73, 0x81, 0x76, 0x39, 0xce, 0x6a, 0xef, 0xf0, 0xe0, 0x23, 0xc4,
-  0xbf, 0x84, 0x4c, 0xb9, 0x9d, 0x1f, 0x42, 0x56, 0x75, 0x64, 0xe9, 0x45,
-  0xa9, 0xbc, 0x92, 0x79, 0x55, 0x83, 0x87, 0x1e, 0xd9, 0xb8, 0x7e, 0x94,
-  0x35, 0x4d, 0x2b, 0x3f, 0x5c, 0x1f, 0x50, 0xf1, 0x08, 0x22, 0x31, 0xae,
-  0x8b, 0x31, 0xba, 0x4f, 0x73, 0x89, 0xeb, 0xa1, 0xdc, 0x0c, 0xac, 0x12,
-  0x1e, 0x38, 0xcb, 0x04, 0xb2, 0x60, 0xcf, 0x64, 0xf8, 0x8a, 0x26, 0xc6,
-  0x6e, 0x7f, 0x9c, 0x63, 0xde, 0xb5, 0x35, 0x4c, 0xc8, 0xf4, 0x76, 0xb2,
-  0xe6, 0x24, 0x66, 0xd0, 0x95, 0xc7, 0xdc, 0x40, 0x15, 0xa6, 0xad, 0x82,
-  0x9d, 0x5e, 0x37, 0x03, 0x53, 0x3d, 0x1b, 0xa3, 0x18, 0x7d, 0xcc, 0xbf,
-  0x8e, 0x60, 0x2f, 0x41, 0xf9, 0xf3, 0x27, 0xe9, 0x65, 0x62, 0x07, 0xf0,
-  0x7f, 0x91, 0x8e, 0xa1, 0x56, 0x98, 0x06, 0x93, 0x87, 0x45, 0xf6, 0x68,
-  0x02, 0xf5, 0xda, 0x11, 0x7e, 0xf6, 0x12, 0x59, 0x2e, 0xd2, 0x96, 0x98,
-  0x23, 0x6d, 0x44, 0xed, 0xf7, 0x02, 0x28, 0x05, 0xc3, 0x5e, 0x80, 0x08,
-  0xf0, 0x31, 0x3e, 0xed, 0x4a, 0xd6, 0x34, 0xae, 0xb5, 0xed, 0x50, 0x5e,
-  0x3c, 0x7e, 0xf2, 0xf5, 0x0f, 0xcf, 0x1f, 0xff, 0xf8, 0x43, 0x74, 0xfe,
-  0xec, 0xd9, 0xf9, 0x3f, 0xa8, 0x71, 0xdc, 0x8d, 0x3d, 0xfe, 0xe1, 0xe2,
-  0xf1, 0x57, 0x5f, 0x3f, 0x47, 0xef, 0xb0, 0x3d, 0x2c, 0x95, 0x1c, 0x71,
-  0x35, 0x4b, 0x67, 0x28, 0x87, 0x43, 0x66, 0x62, 0xa5, 0x30, 0x9f, 0xda,
-  0x88, 0x5c, 0x28, 0xf1, 0x49, 0xdc, 0x6e, 0xe8, 0x78, 0x26, 0x62, 0x86,
-  0x3c, 0x0e, 0x21, 0xa7, 0x0d, 0x92, 0x18, 0x96, 0x0a, 0x2c, 0x4e, 0x8b,
-  0x37, 0x54, 0x52, 0xba, 0xe0, 0x4f, 0x2d, 0x58, 0x0f, 0x0f, 0x41, 0x53,
-  0x02, 0x85, 0xc2, 0x3d, 0xa1, 0x6f, 0xb7, 0xc2, 0x12, 0xd9, 0xb0, 0x4b,
-  0x21, 0x2d, 0x6c, 0x60, 0xea, 0x70, 0xc8, 0x85, 0x53, 0xea, 0x07, 0x07,
-  0x4d, 0xbc, 0x90, 0x51, 0x81, 0x22, 0xf2, 0x49, 0x4c, 0x07, 0x70, 0x6e,
-  0x36, 0xec, 0x66, 0x1b, 0x4c, 0xc3, 0x86, 0xe3, 0x03, 0x17, 0x85, 0xc2,
-  0x0b, 0x1e, 0xe1, 0x94, 0xe5, 0x12, 0x53, 0x90, 0x01, 0x15, 0x71, 0x0c,
-  0xea, 0x80, 0xb2, 0x48, 0x04, 0x5f, 0xdc, 0x0c, 0x63, 0x1f, 0xb8, 0xa9,
-  0xbb, 0xc9, 0x51, 0x79, 0x8f, 0x97, 0x25, 0x3a, 0xda, 0xc5, 0xe3, 0xe7,
-  0x4f, 0x2f, 0xcf, 0xff, 0xd1, 0x29, 0x68, 0x01, 0xfb, 0x07, 0x6c, 0xc6,
-  0x65, 0x55, 0xca, 0xa2, 0xd6, 0x7c, 0x52, 0x89, 0x53, 0x51, 0xbb, 0x01,
-  0xdb, 0xbb, 0xd4, 0x2b, 0x04, 0x37, 0x34, 0x18, 0x87, 0x8e, 0x28, 0x4b,
-  0x70, 0x28, 0x19, 0x4c, 0xe9, 0xbb, 0x4a, 0x03, 0x2d, 0x0c, 0x4a, 0xb1,
-  0xc8, 0xeb, 0xcd, 0xf1, 0x4f, 0x0c, 0x42, 0x76, 0x00, 0x72, 0xa5, 0x1e,
-  0x00, 0xff, 0xee, 0x20, 0xba, 0x75, 0xa0, 0xb0, 0x06, 0x13, 0xba, 0x67,
-  0x42, 0xb8, 0x63, 0x0e, 0x6f, 0x88, 0x78, 0x1c, 0x70, 0x10, 0x40, 0xb9,
-  0x89, 0xbd, 0x01, 0xc7, 0xb3, 0xfd, 0x1c, 0xae, 0x65, 0xba, 0x8f, 0x65,
-  0xa4, 0x45, 0x0c, 0x7b, 0x94, 0xf9, 0xdf, 0xce, 0x62, 0xde, 0x97, 0xb6,
-  0x43, 0x1d, 0xa5, 0x3e, 0x90, 0xcc, 0xfb, 0x10, 0x07, 0xd4, 0xdb, 0x39,
-  0x1f, 0x4a, 0xf9, 0xfd, 0xa9, 0x77, 0xbc, 0xf7, 0x27, 0x08, 0x3c, 0x8f,
-  0x8e, 0x30, 0xda, 0x46, 0x96, 0x02, 0x36, 0x8a, 0xa5, 0xd2, 0xd8, 0xff,
-  0xef, 0xf9, 0x37, 0x39, 0xfd, 0xc7, 0xdb, 0x89, 0xcf, 0x46, 0x8f, 0x89,
-  0xb2, 0x1a, 0x67, 0x01, 0xa6, 0x0d, 0xc3, 0x70, 0x24, 0x34, 0xde, 0xce,
-  0x7b, 0xf0, 0x6f, 0x60, 0x9e, 0x63, 0xde, 0xc2, 0x6b, 0x25, 0xb8, 0xe0,
-  0xd3, 0x48, 0x28, 0xc4, 0x63, 0xc8, 0x8e, 0x6d, 0x59, 0xbb, 0x31, 0xf1,
-  0x67, 0x7f, 0x27, 0xfe, 0xec, 0x1b, 0x6e, 0x61, 0xaf, 0x49, 0xe5, 0xe6,
-  0x95, 0xc3, 0x84, 0x35, 0x72, 0xa4, 0x41, 0x22, 0x65, 0x9b, 0xe7, 0x14,
-  0xe1, 0xbb, 0xce, 0x2f, 0x07, 0xc8, 0x4a, 0x42, 0xfa, 0x03, 0x75, 0x86,
-  0xe9, 0x12, 0x63, 0x84, 0xe5, 0xaf, 0x7e, 0x30, 0xe9, 0xd8, 0x89, 0xf0,
-  0x7c, 0xd7, 0xc5, 0x2f, 0x8f, 0x4b, 0x46, 0xfa, 0xc2, 0x1b, 0x82, 0x5c,
-  0x3b, 0xc4, 0x03, 0x8e, 0x80, 0x3b, 0x7f, 0xb2, 0xc4, 0x24, 0xce, 0x10,
-  0x17, 0x66, 0xa3, 0xa2, 0x3e, 0x4c, 0x87, 0x31, 0x9b, 0x84, 0xdd, 0xde,
-  0xd5, 0xcd, 0x5e, 0xa8, 0x6a, 0x1d, 0x99, 0x4e, 0x3a, 0x56, 0xc8, 0xd4,
-  0xc4, 0xb8, 0x81, 0xec, 0x11, 0x02, 0x3f, 0x9a, 0x74, 0x2b, 0x23, 0x60,
-  0xd7, 0xa6, 0x1d, 0x5f, 0x5e, 0x5f, 0x93, 0x6e, 0x8d, 0xc3, 0x18, 0x62,
-  0x8e, 0x14, 0x91, 0xe0, 0xf0, 0x11, 0x0d, 0xc2, 0xa2, 0x68, 0xf2, 0x50,
-  0x0c, 0x38, 0xee, 0x89, 0x2f, 0x74, 0xd0, 0x18, 0x80, 0x8f, 0xfa, 0x4b,
-  0x1d, 0x1a, 0xd1, 0x80, 0x17, 0xdf, 0x75, 0x77, 0xb8, 0xf1, 0x1f, 0xfe,
-  0x69, 0xfc, 0xf4, 0x6d, 0xb8, 0x63, 0x67, 0x18, 0xa6, 0x7c, 0x6e, 0x86,
-  0xcf, 0xfe, 0x64, 0x66, 0xc6, 0xa4, 0xb3, 0x1b, 0xd9, 0x76, 0x19, 0xfa,
-  0x77, 0xc8, 0xa7, 0x28, 0xda, 0x5c, 0x67, 0x3e, 0x3b, 0xfc, 0xef, 0xee,
-  0x1d, 0xec, 0x7c, 0x63, 0x81, 0x98, 0x5b, 0x7b, 0x35, 0xf9, 0x1f, 0x9d,
-  0x16, 0x3d, 0xec, 0xe1, 0x41, 0xba, 0xab, 0xbf, 0xaa, 0xea, 0xed, 0x17,
-  0x2f, 0x27, 0xd7, 0xbf, 0x43, 0xe1, 0xfa, 0xf6, 0xe5, 0x04, 0x2d, 0xb8,
-  0xf3, 0x49, 0x6c, 0xf8, 0xdc, 0xb9, 0xc3, 0x4b, 0xea, 0x39, 0x3f, 0x12,
-  0xc3, 0xff, 0x4d, 0x0b, 0x3a, 0xc6, 0xb6, 0x9f, 0x04, 0x3e, 0xa6, 0xba,
-  0x51, 0x09, 0x12, 0xed, 0x1d, 0x9f, 0xba, 0x6b, 0x5b, 0xf8, 0xc2, 0x77,
-  0x5a, 0xdc, 0xc0, 0x18, 0x13, 0x04, 0xe1, 0x81, 0xbc, 0x83, 0xbb, 0x11,
-  0x4f, 0xbb, 0x8e, 0x36, 0x66, 0xf1, 0xef, 0xc1, 0xd1, 0x51, 0x4f, 0x92,
-  0x1f, 0xc2, 0x93, 0xf2, 0xf4, 0xb9, 0xa3, 0x4e, 0xf3, 0x68, 0x7c, 0xaf,
-  0x18, 0xdf, 0x62, 0xfc, 0x7c, 0x76, 0xd1, 0xcf, 0x62, 0x6d, 0xf2, 0xda,
-  0xe5, 0x9d, 0x60, 0x27, 0x94, 0xae, 0x2c, 0x5c, 0xda, 0x6a, 0xdb, 0x53,
-  0x2e, 0x7b, 0xb5, 0x03, 0xb9, 0xb1, 0x69, 0x84, 0x1d, 0xd8, 0x16, 0x28,
-  0x86, 0xae, 0x61, 0x3c, 0x7a, 0x58, 0xa3, 0x79, 0xba, 0xd1, 0x23, 0xfc,
-  0x79, 0xb7, 0x93, 0xda, 0xc0, 0x4a, 0xfa, 0x79, 0xf1, 0xc2, 0x71, 0xc5,
-  0x33, 0x8e, 0xce, 0x47, 0x25, 0x86, 0x99, 0xcb, 0x38, 0x8f, 0x9b, 0xc0,
-  0xcd, 0x6a, 0xbd, 0x0a, 0x6f, 0x67, 0x4c, 0xb1, 0xcf, 0x42, 0xc7, 0x22,
-  0x2e, 0xc9, 0xa6, 0xd9, 0x70, 0x4f, 0x42, 0xdd, 0xf6, 0x1c, 0xd5, 0xac,
-  0x78, 0xe8, 0x9e, 0xbe, 0x4e, 0x7b, 0x73, 0xc0, 0x07, 0xf3, 0x42, 0xfb,
-  0x06, 0x6c, 0x1b, 0x33, 0xb3, 0x79, 0x08, 0xdb, 0xf0, 0x31, 0x93, 0xd0,
-  0xa6, 0xef, 0x3a, 0x3f, 0x74, 0xac, 0x81, 0xf7, 0x5f, 0xb0, 0x6c, 0x12,
-  0xc1, 0x15, 0x54, 0xf0, 0xf0, 0x85, 0x11, 0x7e, 0xfd, 0x35, 0x60, 0x8e,
-  0xf0, 0x11, 0x37, 0xca, 0x67, 0x33, 0x84, 0x98, 0xcd, 0x10, 0x66, 0xd0,
-  0x85, 0x36, 0x70, 0x7d, 0x12, 0x41, 0x47, 0xda, 0x1d, 0x7b, 0x01, 0x40,
-  0xe8, 0xfd, 0x24, 0x52, 0x3e, 0xad, 0xdd, 0x13, 0xc6, 0xa0, 0x94, 0x6b,
-  0x63, 0xe5, 0x55, 0x9e, 0xd2, 0xfd, 0x92, 0x0d, 0x1b, 0x15, 0x5d, 0x31,
-  0x02, 0x4f, 0xf6, 0xc5, 0x69, 0xc7, 0xbc, 0x13, 0x05, 0x87, 0x15, 0x7a,
-  0x46, 0x48, 0x79, 0x80, 0x23, 0x20, 0x36, 0xd6, 0x02, 0x46, 0x36, 0x53,
-  0x56, 0xab, 0x3d, 0x54, 0xd8, 0x88, 0x63, 0x6f, 0x62, 0x7a, 0xe4, 0x18,
-  0xb4, 0x90, 0x3b, 0x6b, 0xd8, 0x59, 0xc2, 0x5d, 0x77, 0x30, 0xe8, 0x11,
-  0xc6, 0xd3, 0x0a, 0x47, 0xda, 0xe4, 0x66, 0x78, 0xcc, 0xf5, 0x0d, 0xb5,
-  0xb5, 0xd7, 0x92, 0x5b, 0x35, 0x54, 0xdc, 0x1b, 0x53, 0x6a, 0x4c, 0xab,
-  0x0d, 0xaf, 0x4e, 0xe1, 0x25, 0x11, 0x99, 0x76, 0x57, 0x43, 0xe7, 0x5b,
-  0xf6, 0x51, 0xaa, 0x6a, 0x32, 0xdd, 0x10, 0xa9, 0x14, 0xa2, 0x16, 0x18,
-  0x70, 0x5c, 0xea, 0xa6, 0xa7, 0x3f, 0x73, 0xaf, 0xe8, 0x95, 0x8b, 0x49,
-  0xe8, 0xbd, 0x9f, 0x54, 0xb5, 0xb9, 0x15, 0x17, 0xc0, 0x37, 0x61, 0x53,
-  0xdd, 0xa0, 0x2d, 0x73, 0xd9, 0x98, 0xbd, 0x83, 0x8e, 0xce, 0x7d, 0xef,
-  0xd9, 0x8c, 0x9e, 0xb1, 0x74, 0x95, 0x65, 0x5a, 0xb1, 0x85, 0x37, 0x3b,
-  0x45, 0xe9, 0x7e, 0xdd, 0x02, 0xb8, 0xc0, 0xa9, 0xa6, 0x6c, 0x52, 0x1d,
-  0x3b, 0x06, 0xaa, 0xc2, 0x7c, 0xfe, 0x76, 0xc6, 0x41, 0x04, 0xff, 0xbf,
-  0x58, 0x97, 0xe9, 0x38, 0xf3, 0x0e, 0xa0, 0xee, 0xae, 0x24, 0x58, 0xf6,
-  0xba, 0x56, 0x84, 0x9d, 0x41, 0xd1, 0xa9, 0x7e, 0x44, 0xed, 0x07, 0x0f,
-  0xd3, 0xd9, 0xb4, 0x39, 0x7f, 0xa3, 0x4b, 0x49, 0xd6, 0xa2, 0xc0, 0xff,
-  0xb6, 0x73, 0x3c, 0xc3, 0xba, 0x82, 0x88, 0x6c, 0x8e, 0xa4, 0xa3, 0x04,
-  0x1b, 0x45, 0xf6, 0xb8, 0x89, 0xc0, 0x31, 0x03, 0x76, 0x67, 0x71, 0xe4,
-  0x3a, 0x7c, 0xe7, 0x46, 0x4c, 0x5e, 0x4d, 0xe8, 0x16, 0x9c, 0x38, 0xc3,
-  0x69, 0x23, 0x0c, 0x7c, 0xda, 0xc0, 0xed, 0x45, 0x4b, 0x3c, 0x57, 0x3d,
-  0xc0, 0xee, 0x94, 0xc6, 0xae, 0xdc, 0x01, 0xba, 0x4e, 0xbd, 0x8d, 0xdc,
-  0x00, 0x17, 0xc3, 0x96, 0x7f, 0x03, 0xcf, 0x67, 0x5d, 0x0e, 0x86, 0x99,
-  0xf1, 0x88, 0x84, 0xe2, 0x8c, 0xb9, 0x75, 0xeb, 0xa6, 0x6b, 0xc9, 0xc0,
-  0x54, 0x77, 0x3d, 0x03, 0x16, 0xe7, 0x56, 0xc8, 0xcb, 0xbd, 0x8f, 0x00,
-  0xc2, 0x1d, 0x13, 0x5a, 0xa7, 0x8a, 0xae, 0xbc, 0x13, 0x47, 0x82, 0x3c,
-  0x16, 0xe4, 0x59, 0x3b, 0x50, 0x94, 0x45, 0x30, 0x5f, 0x24, 0x61, 0x77,
-  0x55, 0x64, 0x34, 0xb5, 0xde, 0x9f, 0x08, 0x83, 0xb7, 0x33, 0xe3, 0x07,
-  0xd0, 0xd9, 0xa1, 0x91, 0x95, 0x60, 0x62, 0x19, 0x75, 0x2c, 0x22, 0xa9,
-  0x54, 0xa5, 0x1a, 0x0e, 0xfb, 0x83, 0x13, 0x49, 0x46, 0xe5, 0x03, 0x30,
-  0x12, 0xd2, 0xb0, 0x91, 0x62, 0x79, 0x14, 0xc7, 0xdd, 0xc6, 0x54, 0x11,
-  0x1e, 0xd2, 0x20, 0x9a, 0xb8, 0x15, 0xf7, 0x2f, 0x0f, 0x4d, 0xf7, 0x21,
-  0x8a, 0xf0, 0x3e, 0xe3, 0xf5, 0x5b, 0x70, 0x2e, 0x90, 0xef, 0xc8, 0x30,
-  0xcf, 0x60, 0x1f, 0xed, 0x73, 0xdb, 0x6c, 0xcc, 0x05, 0x3c, 0x00, 0x27,
-  0xa8, 0x11, 0x2f, 0x37, 0xb2, 0xf0, 0x73, 0x44, 0xb7, 0xa9, 0x8f, 0x65,
-  0x87, 0xbc, 0x33, 0xe2, 0x55, 0x0c, 0xde, 0x07, 0x07, 0x3f, 0xdd, 0xb6,
-  0x68, 0x24, 0xe0, 0xa5, 0x92, 0x76, 0x04, 0x6b, 0x36, 0xcb, 0x95, 0x33,
-  0x85, 0x29, 0x31, 0xb6, 0xae, 0x14, 0x33, 0x3e, 0x48, 0x59, 0x33, 0x9e,
-  0x01, 0xeb, 0x36, 0x67, 0x08, 0x96, 0x1c, 0xec, 0x2d, 0x9e, 0x84, 0xf1,
-  0xd6, 0xbb, 0x5d, 0x2d, 0x64, 0x48, 0x49, 0xac, 0xf0, 0xa6, 0x65, 0x0e,
-  0xf6, 0x81, 0x4c, 0xfc, 0x26, 0x15, 0xd8, 0x6d, 0xdf, 0xa5, 0x9b, 0x91,
-  0xf9, 0x4a, 0x9e, 0xaf, 0xe4, 0xf9, 0x42, 0x31, 0xd2, 0xd1, 0x18, 0x0a,
-  0x6d, 0x87, 0xcb, 0x30, 0xb4, 0x3b, 0x4a, 0x3f, 0x83, 0x2b, 0xdb, 0xc2,
-  0xbe, 0x18, 0x01, 0x79, 0x7e, 0xe1, 0x9f, 0x20, 0x2b, 0x41, 0xe7, 0xa9,
-  0x74, 0x3f, 0x5d, 0x6e, 0x6a, 0xc8, 0xf9, 0xcb, 0xce, 0x2f, 0xe9, 0x68,
-  0x36, 0x08, 0x8c, 0x35, 0xd6, 0x82, 0x91, 0xef, 0x8c, 0x31, 0x02, 0xec,
-  0xff, 0x7e, 0x9d, 0x5c, 0xbf, 0x35, 0x4b, 0x08, 0x24, 0x5e, 0xf2, 0x4a,
-  0xc1, 0x62, 0x09, 0xc7, 0xa9, 0x5c, 0x5b, 0x6c, 0x9b, 0x16, 0x0d, 0xe0,
-  0x7a, 0x8f, 0x2d, 0x3f, 0xa0, 0x51, 0xbe, 0xcc, 0x3d, 0x95, 0x80, 0x72,
-  0xa6, 0xf1, 0xf8, 0x7f, 0xcf, 0x78, 0x58, 0x24, 0xdf, 0xb4, 0x71, 0xde,
-  0x21, 0x1a, 0x96, 0x69, 0xe7, 0xef, 0xd6, 0x73, 0x67, 0xc7, 0xe0, 0x76,
-  0x59, 0x76, 0xfa, 0x45, 0x26, 0xef, 0x74, 0x5c, 0x38, 0xf9, 0x18, 0x0f,
-  0x2d, 0xf9, 0xfa, 0xb6, 0xe4, 0xfd, 0xc1, 0x63, 0x2d, 0xb0, 0x0f, 0x54,
-  0xc8, 0x77, 0x82, 0xee, 0xdc, 0xc0, 0x6b, 0xcf, 0x90, 0x02, 0xcc, 0x14,
-  0xbe, 0x30, 0x09, 0xb1, 0xe3, 0x18, 0x12, 0xf8, 0xfb, 0x6c, 0x95, 0x03,
-  0x49, 0x24, 0xa9, 0x0f, 0xd6, 0xa5, 0xbb, 0xbb, 0x70, 0x3e, 0xd8, 0x88,
-  0x04, 0x6c, 0x9a, 0x69, 0xf2, 0xce, 0x81, 0x38, 0x1e, 0xae, 0x1e, 0x1d,
-  0x3c, 0x3c, 0x5a, 0xc1, 0x30, 0x54, 0x2b, 0xf4, 0xf0, 0xe4, 0x98, 0x1f,
-  0x0c, 0xe0, 0x8e, 0x18, 0xc0, 0x64, 0xc1, 0x96, 0xe8, 0x88, 0x4d, 0x8d,
-  0x5b, 0x26, 0x05, 0xcf, 0x1a, 0xf6, 0xdc, 0x9c, 0xc2, 0xf8, 0xb6, 0xe0,
-  0xa4, 0xaf, 0xc6, 0x48, 0x6e, 0xcc, 0xb4, 0x52, 0xdd, 0x56, 0x09, 0x9f,
-  0x58, 0x44, 0xf8, 0xfb, 0xe4, 0x0e, 0x19, 0x17, 0x07, 0x77, 0x2f, 0x05,
-  0xfa, 0xfa, 0xbf, 0x8e, 0x27, 0x44, 0xae, 0x9f, 0xa8, 0xd7, 0xbc, 0xd9,
-  0xbc, 0xdb, 0x9e, 0xca, 0xe8, 0xbb, 0xd8, 0xc6, 0x06, 0x07, 0xa1, 0x9a,
-  0xd7, 0xc4, 0x81, 0xda, 0xc4, 0x29, 0x36, 0x9d, 0x40, 0xe6, 0xda, 0xa0,
-  0x1e, 0x43, 0xb9, 0x16, 0xec, 0xbd, 0xdc, 0xc7, 0xdb, 0x87, 0xa1, 0xb3,
-  0x1e, 0xf9, 0xc6, 0x53, 0xb4, 0xdb, 0xec, 0x18, 0xe3, 0xc4, 0xb7, 0x81,
-  0x3f, 0x9e, 0x92, 0x2c, 0x70, 0x30, 0xe3, 0xde, 0xcb, 0x7b, 0x3d, 0xfa,
-  0x60, 0x94, 0xfb, 0x25, 0x9e, 0xda, 0x42, 0xb5, 0x67, 0x10, 0xc7, 0xf7,
-  0xb6, 0xe9, 0x84, 0xed, 0x7c, 0x8c, 0xa3, 0x3b, 0xbb, 0x7c, 0x7a, 0x8c,
-  0xee, 0xe3, 0x09, 0x89, 0xa1, 0x6f, 0xa7, 0x1d, 0x9d, 0xe2, 0xcb, 0x89,
-  0x59, 0x84, 0x87, 0xac, 0xed, 0xd0, 0x88, 0xe8, 0x77, 0x74, 0x6e, 0xb1,
-  0x6f, 0x9c, 0x02, 0x1c, 0xcf, 0x3b, 0x55, 0x0a, 0x9d, 0x0e, 0xd1, 0x1d,
-  0xbb, 0xe1, 0xb1, 0x0e, 0x2a, 0x04, 0xac, 0x5e, 0xf9, 0xeb, 0xdd, 0x83,
-  0x74, 0x25, 0xa4, 0x09, 0x7b, 0xae, 0xba, 0xe7, 0xd8, 0x84, 0x6a, 0xe7,
-  0x23, 0xa8, 0x41, 0x78, 0xde, 0x98, 0xde, 0x07, 0x2b, 0x72, 0xf7, 0xac,
-  0xca, 0xdb, 0xb2, 0xfe, 0x08, 0xd2, 0x04, 0xa3, 0x38, 0xcf, 0xe2, 0xc6,
-  0x6a, 0x64, 0xc4, 0xe5, 0x46, 0xa1, 0x0d, 0x69, 0xff, 0xde, 0x2c, 0x29,
-  0x14, 0x05, 0x6d, 0x2e, 0x89, 0xee, 0x08, 0x7a, 0x63, 0x27, 0x71, 0xc7,
-  0x3d, 0x73, 0xb4, 0xa1, 0x1a, 0x6f, 0x43, 0x12, 0x44, 0x4a, 0x77, 0xcf,
-  0xfc, 0x1f, 0xae, 0xd2, 0xed, 0x51, 0xf6, 0x9d, 0x14, 0x92, 0x80, 0xf8,
-  0xe5, 0x64, 0xe2, 0x5d, 0x37, 0xc5, 0x19, 0xc6, 0x7b, 0xa1, 0x8d, 0x7e,
-  0x64, 0x00, 0xb1, 0x62, 0xc6, 0x5f, 0x4e, 0x44, 0xd8, 0xbf, 0xe8, 0x96,
-  0x31, 0xdc, 0x41, 0xf7, 0x7e, 0xa7, 0xab, 0x20, 0x7c, 0x3e, 0xf7, 0x5f,
-  0x94, 0x75, 0xfc, 0xf7, 0xec, 0xfa, 0xed, 0x3f, 0xdf, 0xf2, 0xc6, 0xca,
-  0x55, 0x1c, 0x13, 0x89, 0xd2, 0xac, 0x90, 0x65, 0x43, 0x45, 0x99, 0x6b,
-  0x54, 0x05, 0xb6, 0x50, 0xbb, 0x79, 0x0a, 0xbb, 0x49, 0x1b, 0x5a, 0xa3,
-  0x57, 0x48, 0x4d, 0x4d, 0xd9, 0x45, 0x31, 0xf6, 0xbc, 0x9b, 0x43, 0x51,
-  0x2f, 0x9a, 0x9d, 0x4f, 0x88, 0x21, 0x5f, 0x77, 0x32, 0x2e, 0x6e, 0x5b,
-  0xf4, 0x73, 0x82, 0x80, 0x05, 0x9f, 0xff, 0x93, 0x98, 0x7b, 0x6b, 0xb9,
-  0xb3, 0x57, 0x3f, 0xf9, 0xd2, 0x0b, 0xdd, 0x9f, 0xf1, 0x16, 0x6b, 0x83,
-  0x16, 0x0e, 0x47, 0xd5, 0x82, 0x7a, 0xe8, 0xc1, 0xb7, 0xcf, 0xce, 0x9f,
-  0x7e, 0x27, 0x2e, 0x1e, 0xd3, 0x67, 0xf8, 0x07, 0x42, 0xe8, 0xac, 0x1c,
-  0x69, 0xd4, 0x68, 0x7e, 0x30, 0x65, 0x9b, 0x40, 0x4c, 0x07, 0x8a, 0xf3,
-  0x7f, 0x41, 0x65, 0x6b, 0x28, 0xf0, 0x61, 0x00, 0xea, 0x74, 0x34, 0x82,
-  0x37, 0x13, 0xc7, 0xd7, 0xce, 0xee, 0x0e, 0xfa, 0xe7, 0xbb, 0xbb, 0x8f,
-  0x46, 0xae, 0xec, 0x8a, 0x8e, 0x64, 0x27, 0xb1, 0x55, 0xdc, 0xac, 0x22,
-  0xae, 0x58, 0x6e, 0x13, 0xdb, 0x77, 0x00, 0xf6, 0x02, 0xa1, 0xde, 0xba,
-  0x63, 0x67, 0xe7, 0x87, 0xfd, 0x34, 0x3b, 0xe8, 0x97, 0x70, 0x0c, 0xa7,
-  0xc7, 0xbc, 0x70, 0x13, 0xba, 0x0c, 0x49, 0xb9, 0xc3, 0xe8, 0x35, 0xde,
-  0x79, 0xc5, 0x7b, 0x2d, 0x35, 0x76, 0x0b, 0xdc, 0xcb, 0x52, 0x4d, 0x56,
-  0x82, 0xc4, 0x14, 0x5e, 0x94, 0x51, 0x78, 0x13, 0xa1, 0xc4, 0x11, 0xa8,
-  0x2d, 0x67, 0x62, 0x8e, 0xb7, 0x8a, 0xcc, 0xeb, 0x9f, 0x6b, 0x7e, 0xcb,
-  0x8a, 0x29, 0x21, 0x4a, 0x6c, 0x5f, 0xdf, 0xc2, 0xce, 0x1d, 0x36, 0x7b,
-  0x87, 0xe1, 0xcc, 0x1a, 0xb1, 0x09, 0x69, 0x7e, 0x6c, 0xa5, 0x28, 0x66,
-  0x94, 0xd1, 0x3f, 0x7f, 0x5f, 0x94, 0x05, 0x1f, 0xc0, 0xd3, 0x97, 0x2e,
-  0xcd, 0xe3, 0x9e, 0x84, 0x3b, 0xc6, 0xee, 0x77, 0xd4, 0x16, 0x65, 0xd7,
-  0x47, 0x1b, 0x6b, 0xe7, 0x12, 0x11, 0xd5, 0x11, 0x41, 0x67, 0x83, 0x6a,
-  0x9d, 0xce, 0x3e, 0x43, 0x57, 0x95, 0x13, 0xaa, 0x25, 0x8c, 0x64, 0x8f,
-  0x88, 0x2e, 0x27, 0x5f, 0xe2, 0xa6, 0xf6, 0x5f, 0xc7, 0x89, 0x1a, 0x09,
-  0xe9, 0xf0, 0x9d, 0x2d, 0xb1, 0x2f, 0x04, 0x5e, 0xf9, 0xe5, 0x89, 0xc9,
-  0xf8, 0xe8, 0x56, 0x81, 0x3b, 0xa1, 0x77, 0x38, 0x91, 0x96, 0x45, 0x9d,
-  0xc7, 0x5a, 0xda, 0x82, 0xed, 0xf2, 0x74, 0xf7, 0x2c, 0xbc, 0x2f, 0x6b,
-  0xd7, 0x58, 0xa7, 0x35, 0xd2, 0x4e, 0xe4, 0x3a, 0xa0, 0xe0, 0xf8, 0x35,
-  0x0e, 0xec, 0x4d, 0x83, 0x3c, 0x2e, 0xe6, 0x69, 0x0c, 0xbb, 0xf6, 0x89,
-  0x90, 0xa7, 0xa1, 0xeb, 0xaf, 0x9a, 0x9f, 0xf0, 0xf1, 0x2b, 0xba, 0x25,
-  0xe5, 0x96, 0x62, 0x06, 0x3f, 0x67, 0x12, 0x6f, 0xc3, 0x0a, 0x60, 0xf8,
-  0xf2, 0xb4, 0xeb, 0xf6, 0xf2, 0x51, 0xe0, 0xce, 0x9a, 0xed, 0x2b, 0x7c,
-  0x18, 0xda, 0xc6, 0x74, 0xef, 0xef, 0x65, 0xfe, 0x66, 0x66, 0x24, 0x96,
-  0x35, 0xb0, 0xf7, 0x44, 0xba, 0x8a, 0xfc, 0xed, 0x74, 0x28, 0x22, 0x02,
-  0x0a, 0xad, 0x91, 0x2b, 0x47, 0xf2, 0x8f, 0x48, 0x8d, 0x48, 0xdb, 0x91,
-  0x32, 0xdc, 0x28, 0x22, 0xb9, 0x19, 0x6d, 0xac, 0xa2, 0x85, 0x28, 0xf4,
-  0xdb, 0x8a, 0x5a, 0xa5, 0x15, 0x99, 0x5d, 0xdf, 0x0a, 0x36, 0x23, 0x12,
-  0xa1, 0xf7, 0x99, 0x87, 0x06, 0x80, 0x4d, 0x89, 0xaa, 0xf6, 0x5b, 0xd9,
-  0x24, 0x22, 0x48, 0x58, 0xed, 0xb6, 0x6e, 0x02, 0x23, 0x76, 0x81, 0x83,
-  0x02, 0x2f, 0xa2, 0x36, 0x40, 0x8f, 0x3e, 0x7b, 0x99, 0xdc, 0x20, 0xd1,
-  0xc2, 0x2b, 0xd0, 0x5e, 0xa2, 0x45, 0xcc, 0x1e, 0x30, 0xb3, 0x34, 0x34,
-  0xb1, 0x99, 0xb8, 0x09, 0x34, 0x50, 0x6e, 0x9a, 0x96, 0x2d, 0xce, 0x5d,
-  0xd5, 0xbd, 0xf4, 0x0f, 0xdb, 0x41, 0x28, 0x2f, 0xe4, 0xc1, 0xed, 0x54,
-  0xa1, 0xf7, 0x9d, 0xd6, 0xe6, 0xb3, 0x70, 0x93, 0xe8, 0x3b, 0x2a, 0x3d,
-  0xd5, 0x89, 0x60, 0xdb, 0xb5, 0xc5, 0xe8, 0xb7, 0xdc, 0xe8, 0x08, 0x3b,
-  0xdf, 0xf0, 0x3f, 0x6f, 0x44, 0xf1, 0x9b, 0x8a, 0xe1, 0xb0, 0x92, 0xa4,
-  0xb2, 0x6c, 0xeb, 0x4c, 0x7c, 0x10, 0x79, 0xcc, 0x71, 0xb5, 0x78, 0x60,
-  0x82, 0x1d, 0x5f, 0xeb, 0xc3, 0xbb, 0x1a, 0x2b, 0x52, 0x98, 0x09, 0x2e,
-  0x4c, 0x85, 0xd8, 0xd8, 0x86, 0x1f, 0x4a, 0x6b, 0x26, 0x74, 0x55, 0xd9,
-  0xa2, 0x14, 0xbb, 0x7e, 0x48, 0x97, 0x4e, 0xbf, 0x80, 0x75, 0xbb, 0x28,
-  0x5a, 0x13, 0xc3, 0x28, 0xfa, 0xe9, 0xb5, 0x95, 0xed, 0xfc, 0xc2, 0xae,
-  0xb7, 0xaa, 0x9d, 0x55, 0xee, 0xb0, 0xe8, 0x95, 0x93, 0x65, 0x6e, 0xdb,
-  0xf4, 0x65, 0xee, 0x05, 0x4a, 0x04, 0xa4, 0x54, 0x32, 0xb7, 0xa2, 0x03,
-  0xfb, 0xcd, 0x2d, 0xbd, 0x77, 0xc0, 0x64, 0x5f, 0x42, 0x65, 0x75, 0x24,
-  0xc8, 0x82, 0xb6, 0x96, 0x0f, 0xfa, 0x95, 0x9b, 0x96, 0xdd, 0x48, 0x28,
-  0xb0, 0xc9, 0xac, 0x45, 0x27, 0xdd, 0xc1, 0xf6, 0xb1, 0xc1, 0x9b, 0x79,
-  0x83, 0x17, 0x8e, 0x61, 0xe3, 0xa7, 0x1b, 0x80, 0x60, 0xd6, 0x0f, 0x00,
-  0xc9, 0x00, 0x10, 0x0b, 0xf0, 0x88, 0xad, 0xa8, 0xc1, 0x17, 0x50, 0x32,
-  0xdd, 0x58, 0x3a, 0xb9, 0x5c, 0xe8, 0x99, 0x50, 0x66, 0x54, 0xd0, 0xbb,
-  0xe2, 0x87, 0x34, 0x1b, 0xbd, 0x7b, 0x8c, 0x9f, 0x8a, 0x3b, 0xdf, 0x76,
-  0x8f, 0x6a, 0xec, 0xbb, 0xeb, 0x88, 0x6a, 0xc9, 0x10, 0x30, 0xbd, 0xf0,
-  0x82, 0xd9, 0x87, 0xbd, 0x9e, 0x88, 0x6f, 0x40, 0xcf, 0xe8, 0x19, 0xbd,
-  0x41, 0x9c, 0x4a, 0x3e, 0xdf, 0x94, 0x78, 0xff, 0x87, 0x36, 0x80, 0x86,
-  0x2e, 0x42, 0x5a, 0x22, 0x73, 0xbc, 0x47, 0xd7, 0x48, 0xbc, 0x6d, 0xe7,
-  0x05, 0x3b, 0x08, 0x23, 0xa5, 0x97, 0x89, 0xfb, 0x96, 0x4b, 0xd9, 0xbe,
-  0xcb, 0xd8, 0x39, 0xf9, 0x37, 0x36, 0x46, 0xc1, 0x9e, 0x6f, 0x2f, 0x71,
-  0xc7, 0xd9, 0x04, 0x72, 0xeb, 0x22, 0x83, 0x7d, 0xac, 0xd7, 0x75, 0xee,
-  0xab, 0x9c, 0x29, 0x61, 0xc1, 0xfb, 0xf0, 0x0b, 0x17, 0xd1, 0xe6, 0x5e,
-  0xd4, 0xb1, 0x83, 0x6a, 0xce, 0x1e, 0xe7, 0x75, 0x15, 0x1f, 0xf9, 0x08,
-  0x48, 0xcd, 0x87, 0xed, 0x6e, 0x7e, 0xf9, 0x3c, 0x45, 0xbc, 0x43, 0x7a,
-  0xcb, 0xc0, 0x64, 0xc1, 0xbd, 0xfe, 0x2c, 0xe9, 0x2d, 0x54, 0x49, 0x7f,
-  0x7a, 0x42, 0xd2, 0xcb, 0x45, 0xf8, 0x37, 0x02, 0xc0, 0xc2, 0x62, 0xf4,
-  0x23, 0xfe, 0x93, 0x11, 0x98, 0x14, 0x37, 0x02, 0x50, 0x5a, 0xa8, 0x1c,
-  0x54, 0xbe, 0xe5, 0x15, 0xd8, 0x9e, 0x88, 0xb9, 0xf2, 0x96, 0xa4, 0x1c,
-  0xbd, 0xbd, 0x28, 0xd8, 0xbb, 0xbd, 0x32, 0xe0, 0x00, 0xc3, 0x21, 0xa5,
-  0x3c, 0x78, 0xdb, 0x98, 0xf3, 0xc1, 0xa8, 0x52, 0x19, 0xe4, 0xa2, 0xc0,
-  0x09, 0xa3, 0x65, 0x8b, 0x6c, 0x4b, 0x79, 0x33, 0xce, 0xe6, 0xdd, 0xf5,
-  0x73, 0xfb, 0x04, 0x8d, 0xc1, 0x2c, 0x18, 0x0f, 0xf0, 0x4d, 0xc2, 0x60,
-  0xf4, 0x71, 0x4f, 0x81, 0xa6, 0x34, 0x1e, 0xa3, 0x36, 0x1e, 0x4b, 0xe9,
-  0xbd, 0xf8, 0x9e, 0x3c, 0xf9, 0x4d, 0xf9, 0x8f, 0xa3, 0x4a, 0xfb, 0x71,
-  0x8f, 0x6a, 0x6f, 0x87, 0xfe, 0x38, 0xe2, 0x26, 0xfc, 0x77, 0xb4, 0x69,
-  0xaf, 0xfb, 0x38, 0x9a, 0xe6, 0xaf, 0x01, 0xf4, 0x0d, 0xcb, 0xfc, 0x85,
-  0x80, 0x1e, 0xe5, 0x51, 0x92, 0xbb, 0xd9, 0x93, 0x4f, 0xa7, 0x4b, 0xc8,
-  0x7c, 0x4a, 0xfa, 0xa6, 0x68, 0x3f, 0xb2, 0x99, 0xb3, 0x89, 0xf7, 0x76,
-  0x73, 0xf6, 0xc7, 0xcd, 0xf0, 0x9c, 0x97, 0xba, 0x60, 0xe6, 0x44, 0x99,
-  0x7c, 0x95, 0x4e, 0x94, 0xdd, 0x15, 0x1b, 0x15, 0x8e, 0xa4, 0x94, 0x26,
-  0xbf, 0x86, 0x25, 0xb5, 0x10, 0xbd, 0x38, 0xfe, 0xcd, 0xec, 0x85, 0x0a,
-  0xfe, 0x33, 0x0c, 0xe6, 0x8f, 0x21, 0x88, 0x60, 0x26, 0x0e, 0xc4, 0xe1,
-  0xe1, 0x61, 0x28, 0x28, 0x4a, 0x69, 0xec, 0xe6, 0x6b, 0x7c, 0xd1, 0x9b,
-  0x43, 0x1c, 0x53, 0x92, 0xfc, 0x96, 0x5e, 0x86, 0xaf, 0x50, 0x04, 0xf2,
-  0x70, 0xf9, 0x7f, 0xed, 0x7d, 0x7b, 0x9f, 0x1b, 0xb7, 0x91, 0xe0, 0xdf,
-  0xa3, 0x4f, 0x81, 0xa3, 0xc8, 0x0c, 0x29, 0x0f, 0x47, 0x9a, 0x51, 0xb2,
-  0xbb, 0x19, 0xc9, 0x5a, 0x3b, 0x89, 0x93, 0xf5, 0xad, 0x9d, 0xe8, 0x62,
-  0xe7, 0xb2, 0xb7, 0x49, 0x4c, 0x37, 0xc9, 0xe6, 0xb0, 0xa3, 0x26, 0x9b,
-  0xee, 0x6e, 0xce, 0xc3, 0xab, 0xe8, 0xb3, 0x5f, 0x3d, 0x50, 0x78, 0x35,
-  0xfa, 0x31, 0xb2, 0xe2, 0xdf, 0xdd, 0xfe, 0xe2, 0xcd, 0x6a, 0x9a, 0xdd,
-  0x85, 0x42, 0x01, 0x28, 0x14, 0x0a, 0x85, 0x42, 0xd5, 0xb9, 0x1a, 0xfd,
-  0x65, 0x84, 0xc1, 0x46, 0x40, 0x20, 0xc2, 0xba, 0x05, 0x34, 0xcd, 0x46,
-  0x61, 0x0b, 0x59, 0xe5, 0x61, 0xd1, 0x4d, 0xf6, 0x31, 0xd1, 0x2d, 0x8c,
-  0x1b, 0x54, 0x29, 0xab, 0xb0, 0xac, 0x72, 0x22, 0xb2, 0xcc, 0x22, 0x65,
-  0x15, 0x9a, 0xce, 0x85, 0x06, 0x70, 0x51, 0x35, 0x8d, 0x8e, 0xe0, 0xd2,
-  0xb4, 0x5e, 0x0d, 0x44, 0xe2, 0x2c, 0x57, 0x11, 0xfd, 0xff, 0xc4, 0xf1,
-  0x07, 0x38, 0x31, 0x4b, 0x16, 0x1f, 0x94, 0xfe, 0x16, 0xc3, 0xbd, 0xe8,
-  0x63, 0xd2, 0x8e, 0x23, 0xd2, 0x9b, 0x0c, 0xb7, 0x3c, 0xe4, 0xa7, 0x70,
-  0x4f, 0x03, 0x53, 0x35, 0x79, 0x83, 0x77, 0x44, 0x11, 0xe6, 0x30, 0x5e,
-  0xb5, 0x8e, 0xef, 0x81, 0x51, 0xba, 0xac, 0x30, 0x45, 0x55, 0x56, 0x58,
-  0x99, 0x05, 0x78, 0x58, 0x05, 0x4b, 0x04, 0xb7, 0x06, 0x8a, 0x85, 0x81,
-  0xa2, 0x15, 0xa5, 0xdb, 0x25, 0x50, 0x7c, 0x5d, 0xd9, 0x11, 0x33, 0xce,
-  0x6b, 0x6c, 0xe7, 0x25, 0x89, 0x0f, 0x4f, 0xf2, 0x78, 0xbb, 0x4f, 0xf0,
-  0xb4, 0xa8, 0xe1, 0xc8, 0x2b, 0x9a, 0x7a, 0x40, 0x3c, 0x7b, 0xcb, 0xe4,
-  0xae, 0xda, 0xda, 0x68, 0xe5, 0x87, 0x69, 0xa6, 0xcc, 0xf7, 0xae, 0xae,
-  0xb4, 0x3b, 0x89, 0x48, 0x1d, 0x38, 0xbd, 0x02, 0x42, 0x1b, 0x6a, 0x79,
-  0xe1, 0xd4, 0xd0, 0xd8, 0x62, 0xe6, 0xfd, 0x44, 0x9a, 0x60, 0x25, 0x9d,
-  0xbb, 0x1c, 0xbd, 0x83, 0x89, 0x74, 0x83, 0xac, 0x4f, 0xf8, 0x9d, 0xc2,
-  0x2e, 0x89, 0x12, 0xbe, 0xe1, 0x9b, 0x2b, 0x8c, 0x5c, 0x74, 0x17, 0xa3,
-  0x13, 0xe1, 0x76, 0xbc, 0x38, 0x04, 0x1b, 0x1f, 0xda, 0xda, 0x44, 0xbb,
-  0xda, 0xd4, 0xb2, 0x36, 0x28, 0xea, 0x32, 0xc9, 0x72, 0xf2, 0x2b, 0x38,
-  0xfc, 0xf0, 0xcd, 0x4e, 0x63, 0xcf, 0xdb, 0xd0, 0xfd, 0x73, 0xc0, 0xda,
-  0xb0, 0xc2, 0x5b, 0x23, 0x2b, 0x1f, 0x46, 0x76, 0xdb, 0xd6, 0xe9, 0xe4,
-  0x6e, 0xa4, 0x72, 0xbe, 0x48, 0x29, 0x7a, 0x54, 0x9b, 0x5f, 0x24, 0x9b,
-  0x5c, 0x5b, 0xdd, 0xf8, 0xa9, 0x87, 0xee, 0x9c, 0xd3, 0x00, 0xd7, 0x16,
-  0xaa, 0x4f, 0x04, 0xf4, 0x2b, 0xc0, 0xab, 0x5f, 0x90, 0x05, 0x52, 0xbf,
-  0xd5, 0x9b, 0x18, 0xd9, 0x29, 0x74, 0x6f, 0x3a, 0xfd, 0x32, 0x34, 0xea,
-  0xba, 0x44, 0xd3, 0x62, 0x13, 0x10, 0x8a, 0x76, 0xd9, 0x76, 0x4a, 0xf5,
-  0x41, 0x63, 0x03, 0x8d, 0x60, 0xa1, 0x18, 0x13, 0xcb, 0xec, 0x7a, 0x93,
-  0x17, 0x14, 0xf1, 0x0a, 0xc9, 0xf3, 0x7f, 0xea, 0xf5, 0x46, 0x57, 0xc9,
-  0x61, 0xbd, 0x2c, 0x88, 0x99, 0x19, 0xda, 0x5b, 0x42, 0xce, 0x97, 0xf5,
-  0x46, 0x68, 0xba, 0x39, 0x78, 0xaa, 0xad, 0xc7, 0x04, 0x21, 0x92, 0x80,
-  0x71, 0x68, 0x7d, 0x24, 0xeb, 0x8a, 0x8b, 0x85, 0xad, 0x2e, 0xbb, 0xbd,
-  0x78, 0x20, 0xb9, 0xed, 0x20, 0x6b, 0x0d, 0x6e, 0x67, 0xd1, 0x30, 0xb4,
-  0xcc, 0x8b, 0xd5, 0x1b, 0x6d, 0x23, 0x52, 0x4e, 0x5f, 0x38, 0xf0, 0x63,
-  0x58, 0xe5, 0x53, 0x84, 0xaf, 0x5f, 0xe1, 0xd3, 0xcb, 0xa7, 0x68, 0xb7,
-  0x6b, 0x83, 0xdd, 0x24, 0x79, 0x95, 0x12, 0x2c, 0x3d, 0x31, 0xb0, 0x03,
-  0xdb, 0x20, 0xa4, 0x21, 0x01, 0x74, 0x77, 0x36, 0xe1, 0xa6, 0x9e, 0x26,
-  0xe0, 0xab, 0x00, 0x33, 0x65, 0x39, 0xce, 0x2b, 0x4a, 0xec, 0xd1, 0x5f,
-  0x03, 0x73, 0x91, 0xa9, 0xa0, 0x7e, 0xf5, 0x27, 0xa2, 0x7c, 0x86, 0x0d,
-  0xf9, 0x0b, 0x3e, 0xf6, 0x55, 0x34, 0x46, 0x45, 0xa3, 0xb7, 0x1e, 0x82,
-  0x72, 0xab, 0xf9, 0x2f, 0x5b, 0xcd, 0xdf, 0x86, 0x54, 0xb3, 0x4b, 0x96,
-  0xd5, 0x80, 0xe6, 0x20, 0x94, 0xad, 0x26, 0xa1, 0x1a, 0x9e, 0x26, 0xfd,
-  0x8d, 0x00, 0x41, 0xf0, 0xd7, 0xe3, 0x35, 0xc5, 0x80, 0xe8, 0x6d, 0x8a,
-  0x85, 0xb5, 0x35, 0xad, 0xfe, 0xca, 0x55, 0xc1, 0xdf, 0xbe, 0xba, 0x26,
-  0x0f, 0xa8, 0x6b, 0xf2, 0x03, 0xeb, 0x02, 0x2d, 0xef, 0x4e, 0x6a, 0x31,
-  0x8f, 0x01, 0x03, 0x24, 0x71, 0x98, 0x06, 0x9a, 0x8b, 0x67, 0xe7, 0x4e,
-  0x1c, 0xa7, 0x8e, 0xcf, 0x39, 0x7e, 0x0e, 0xeb, 0xe8, 0xc1, 0xd0, 0x80,
-  0x70, 0x91, 0xd8, 0xc5, 0x12, 0x61, 0xa2, 0x0b, 0x65, 0xab, 0x86, 0x64,
-  0xb5, 0xe8, 0x6d, 0x4e, 0x6a, 0x74, 0xdc, 0x57, 0xd7, 0x5d, 0x07, 0x49,
-  0x82, 0x00, 0xb4, 0xed, 0xdc, 0xb2, 0xb1, 0x6a, 0x35, 0x44, 0x8b, 0xf6,
-  0x2a, 0xd5, 0x74, 0xba, 0xbf, 0x22, 0xcd, 0x10, 0x17, 0xd4, 0x07, 0xb7,
-  0xc4, 0xb5, 0x52, 0x8b, 0x1f, 0x26, 0xc8, 0x04, 0xd5, 0x70, 0xf4, 0x74,
-  0xad, 0xd5, 0x66, 0x49, 0xb6, 0x6b, 0xb2, 0xb7, 0x97, 0xd8, 0xb0, 0xa3,
-  0x41, 0xf7, 0x32, 0x5d, 0x3a, 0xcb, 0x34, 0x4f, 0x83, 0xef, 0xd3, 0x3a,
-  0x81, 0x32, 0xd7, 0xaf, 0xf0, 0xe1, 0xe5, 0xd3, 0xeb, 0x56, 0x31, 0x3a,
-  0xe9, 0x86, 0xa4, 0xe5, 0x83, 0x77, 0x1a, 0xbf, 0x29, 0xd3, 0xf4, 0x4d,
-  0x18, 0xe3, 0xcc, 0xab, 0x74, 0x92, 0xe4, 0x87, 0x2d, 0x23, 0xe3, 0xc7,
-  0xae, 0x8a, 0xc7, 0x16, 0xb8, 0x1f, 0x76, 0xb2, 0x14, 0x2a, 0xe9, 0xa9,
-  0x13, 0xd6, 0x80, 0xf6, 0x42, 0x4e, 0xae, 0x93, 0xdd, 0x4e, 0xa3, 0xa5,
-  0xc7, 0xce, 0x8e, 0xb2, 0xc0, 0xbd, 0xb0, 0xe3, 0xc9, 0x3a, 0xcd, 0x85,
-  0x60, 0x7a, 0xec, 0x84, 0xb6, 0xc0, 0xfd, 0xb0, 0x93, 0xf4, 0x50, 0x65,
-  0x39, 0x86, 0xc6, 0x42, 0xdc, 0xfa, 0x47, 0x67, 0x09, 0xb7, 0xc0, 0x10,
-  0x78, 0xcb, 0x11, 0x93, 0x3e, 0xe6, 0x01, 0x6a, 0x04, 0xb4, 0x0f, 0x52,
-  0x00, 0x7b, 0x31, 0x82, 0xfa, 0x2a, 0x38, 0xe9, 0xb1, 0x13, 0xda, 0x02,
-  0xf7, 0xc3, 0x4e, 0xb2, 0x42, 0x10, 0xe3, 0x53, 0x27, 0xac, 0x01, 0xed,
-  0x85, 0x9c, 0xbc, 0x81, 0x59, 0xa8, 0xd1, 0xd2, 0x63, 0x27, 0xb4, 0x05,
-  0xee, 0x87, 0x9d, 0xe8, 0x43, 0x1c, 0x42, 0xcd, 0xcf, 0x9d, 0xf0, 0x0e,
-  0xf8, 0x00, 0xe8, 0xc9, 0xee, 0xc8, 0x98, 0x77, 0xc7, 0x4e, 0x38, 0x0d,
-  0xd6, 0x03, 0x35, 0xd9, 0x6b, 0x6c, 0xfb, 0x6e, 0x38, 0x0d, 0xd6, 0x03,
-  0x35, 0xb9, 0xcb, 0x18, 0xdb, 0x5d, 0xd6, 0x09, 0xa7, 0xc1, 0x7a, 0xa0,
-  0x26, 0xc5, 0x2e, 0x5b, 0x95, 0x32, 0x63, 0xf4, 0x8f, 0xce, 0x12, 0x6e,
-  0x81, 0x21, 0xf0, 0x93, 0x03, 0x12, 0x52, 0xbd, 0x82, 0xbf, 0x2f, 0x9f,
-  0x56, 0xed, 0x70, 0x07, 0xa6, 0xf7, 0xd0, 0x43, 0x6f, 0xb9, 0x2d, 0x98,
-  0x56, 0x78, 0xe8, 0x84, 0x14, 0xc0, 0x3e, 0xb8, 0x49, 0x95, 0x5d, 0x8b,
-  0x9c, 0xa3, 0xc7, 0x4e, 0x68, 0x0b, 0xdc, 0x0f, 0x3b, 0xa9, 0x13, 0x3d,
-  0xf0, 0xf0, 0xd0, 0x3d, 0x53, 0x35, 0x60, 0x1f, 0xdc, 0xe4, 0xe8, 0xca,
-  0xb7, 0xe3, 0x00, 0x79, 0xe5, 0x16, 0x18, 0x02, 0x3f, 0x39, 0x6c, 0x35,
-  0x7b, 0xc1, 0x43, 0x27, 0xa4, 0x00, 0xf6, 0xc1, 0x4d, 0x56, 0x82, 0x71,
-  0xd5, 0x03, 0x29, 0x80, 0x7d, 0x70, 0x13, 0x68, 0x87, 0xa6, 0xb1, 0xea,
-  0xa1, 0x51, 0x03, 0xf6, 0xc1, 0x01, 0xe3, 0xa7, 0xd7, 0x89, 0xcc, 0x01,
-  0x78, 0xec, 0x99, 0x01, 0x02, 0xdc, 0x0b, 0xfb, 0x76, 0x3c, 0xf9, 0x14,
-  0xd7, 0xef, 0xb7, 0x8c, 0xfb, 0xd3, 0xbe, 0xb5, 0xfc, 0xed, 0xd8, 0x01,
-  0x1f, 0x00, 0x3d, 0xf9, 0x05, 0x08, 0x76, 0x8d, 0xfc, 0x17, 0x3d, 0x32,
-  0xfe, 0xed, 0xd8, 0x02, 0xf7, 0xc3, 0x4e, 0x7e, 0x83, 0xeb, 0xb8, 0x46,
-  0xfd, 0x9b, 0xbe, 0x35, 0xfd, 0xed, 0xd8, 0x01, 0x1f, 0x00, 0x3d, 0xf9,
-  0x15, 0xae, 0xe5, 0x1a, 0xfb, 0xaf, 0xfa, 0xd6, 0xf5, 0xb7, 0x63, 0x07,
-  0x7c, 0x00, 0xf4, 0xe4, 0x33, 0xe6, 0x74, 0x8d, 0xff, 0xb3, 0x7e, 0xbe,
-  0x7f, 0x3b, 0xf6, 0x8a, 0x0c, 0x2a, 0x31, 0xf9, 0x4f, 0xdb, 0xf7, 0xff,
-  0xd9, 0xdb, 0x9f, 0x16, 0xb8, 0x1f, 0x76, 0xf2, 0x99, 0x41, 0xfc, 0x59,
-  0x1f, 0xac, 0x01, 0xed, 0x85, 0xc4, 0x38, 0x2d, 0x06, 0xef, 0xd7, 0x7d,
-  0x1a, 0xc1, 0xdb, 0xb1, 0x03, 0x3e, 0x00, 0x7a, 0xf2, 0x79, 0x61, 0x90,
-  0x7f, 0xde, 0xa3, 0x17, 0xbc, 0x1d, 0x5b, 0xe0, 0x7e, 0xd8, 0xc9, 0xbf,
-  0xa3, 0x36, 0xa0, 0x51, 0xff, 0x7b, 0x9f, 0x66, 0xf0, 0x76, 0xec, 0x80,
-  0x0f, 0x80, 0x9e, 0x7c, 0x41, 0xea, 0x80, 0x46, 0xff, 0x45, 0xaf, 0x6e,
-  0xf0, 0x76, 0xec, 0x16, 0x18, 0x02, 0x3f, 0xf9, 0xf2, 0xa8, 0xb1, 0x7f,
-  0xd9, 0x29, 0xdd, 0xdf, 0x8e, 0x05, 0xb0, 0x0f, 0x6e, 0xf2, 0x5b, 0xc1,
-  0xf8, 0xdb, 0x1e, 0x48, 0x01, 0xec, 0x83, 0x9b, 0xfc, 0x47, 0xa6, 0x31,
-  0xfe, 0x47, 0xa7, 0xa4, 0x7c, 0x3b, 0x16, 0xc0, 0x3e, 0xb8, 0xc9, 0xef,
-  0x58, 0x37, 0xd0, 0x68, 0x7f, 0xd7, 0xaf, 0x29, 0xbc, 0x1d, 0x7b, 0x45,
-  0x06, 0x95, 0x98, 0xfc, 0x7e, 0x5b, 0xe8, 0x1a, 0x7e, 0xdf, 0xbd, 0xce,
-  0xbf, 0x1d, 0x1b, 0xd0, 0x5e, 0xc8, 0xc9, 0x57, 0xb8, 0xb6, 0x6b, 0xbc,
-  0x5f, 0xf5, 0xad, 0xf3, 0x6f, 0xc7, 0x0e, 0xf8, 0x00, 0xe8, 0xc9, 0xd7,
-  0x89, 0x0c, 0xdf, 0xd7, 0xdd, 0xeb, 0x3d, 0xcc, 0x41, 0x01, 0xed, 0x85,
-  0x9c, 0xfc, 0xc1, 0x93, 0x79, 0x7f, 0x18, 0x22, 0xc1, 0xbc, 0x22, 0x83,
-  0x4a, 0x4c, 0x5e, 0x6f, 0x85, 0x51, 0x5e, 0x77, 0xaf, 0xd2, 0x6f, 0xc7,
-  0x06, 0xb4, 0x17, 0x72, 0xf2, 0x4b, 0x83, 0xf5, 0x97, 0x7d, 0xb0, 0x06,
-  0xb4, 0x17, 0x72, 0xf2, 0xba, 0x32, 0xb4, 0x76, 0xaf, 0xff, 0x40, 0xab,
-  0x80, 0xf6, 0x42, 0x02, 0x27, 0xc3, 0x9a, 0x6f, 0xb8, 0xba, 0x77, 0xfd,
-  0x77, 0xc0, 0x07, 0x40, 0x4f, 0x5e, 0x1b, 0x92, 0xfb, 0x28, 0x16, 0x82,
-  0x9b, 0x70, 0xc1, 0xc6, 0x8e, 0xb5, 0xef, 0x6e, 0xe5, 0x7b, 0x92, 0x32,
-  0x54, 0xda, 0x09, 0x95, 0xed, 0x37, 0x04, 0x06, 0x7f, 0x3b, 0xe1, 0x76,
-  0x0c, 0xb8, 0x2b, 0x5e, 0xcd, 0xc9, 0x26, 0xd3, 0x52, 0xc4, 0xb3, 0x42,
-  0xf1, 0x1d, 0x04, 0x35, 0xe2, 0xbf, 0xed, 0x70, 0xdf, 0x1d, 0x0b, 0x63,
-  0x7e, 0xd4, 0x07, 0x8e, 0x11, 0xd3, 0x20, 0x43, 0x4d, 0x89, 0x86, 0x53,
-  0x6d, 0x17, 0x72, 0x0c, 0x8d, 0x4d, 0x50, 0x17, 0xb2, 0xa5, 0x59, 0x1a,
-  0xf2, 0xf2, 0xd9, 0x85, 0x67, 0x0b, 0xf4, 0x40, 0xc8, 0x14, 0xc6, 0x1f,
-  0xf9, 0xa8, 0x32, 0x42, 0x1b, 0xc1, 0x30, 0x69, 0x57, 0xdd, 0xa4, 0x11,
-  0xa4, 0x0b, 0xd8, 0x46, 0x19, 0x01, 0x5e, 0xfc, 0x4b, 0xbb, 0x91, 0x92,
-  0x00, 0x2e, 0x9f, 0x75, 0x12, 0x3e, 0x80, 0x6e, 0x21, 0xbb, 0x9f, 0x6e,
-  0xe5, 0x01, 0x76, 0xd0, 0xed, 0x92, 0x9d, 0x47, 0xc8, 0xee, 0xa4, 0x7a,
-  0x8d, 0x61, 0x5a, 0xd3, 0x3e, 0xc2, 0x35, 0x94, 0xa6, 0xfd, 0xe3, 0x6e,
-  0xda, 0x35, 0xb0, 0x07, 0xdb, 0x46, 0xbe, 0x86, 0xed, 0x6a, 0x81, 0x06,
-  0xe9, 0x69, 0x04, 0x5f, 0x2a, 0xef, 0x6f, 0x06, 0xc3, 0xc9, 0x20, 0xf4,
-  0xb7, 0x84, 0xe1, 0x7d, 0xf0, 0x8e, 0xc6, 0x30, 0x78, 0x4f, 0x73, 0x18,
-  0xa8, 0xab, 0x41, 0x49, 0x59, 0xa2, 0x4f, 0x41, 0x77, 0x6b, 0x18, 0x88,
-  0x9b, 0x32, 0x7f, 0xd5, 0xdd, 0x12, 0x86, 0xf5, 0x40, 0xdb, 0x5a, 0xc1,
-  0xa0, 0x97, 0x3f, 0x6b, 0x6b, 0x40, 0xf0, 0xbd, 0x49, 0xfc, 0x26, 0xc1,
-  0xb0, 0x92, 0xe8, 0xb1, 0xa5, 0x65, 0x8c, 0x3e, 0x8a, 0x8f, 0x34, 0xc1,
-  0x82, 0x72, 0x33, 0xfe, 0x47, 0x77, 0x2b, 0x2c, 0xb8, 0x0b, 0xdd, 0xd6,
-  0x10, 0x0b, 0x7d, 0xf1, 0x4f, 0x1d, 0xe7, 0x13, 0xe9, 0xdd, 0xc1, 0x9c,
-  0x61, 0xd9, 0xe7, 0x59, 0x13, 0xe6, 0xe2, 0xa7, 0xed, 0xa3, 0xca, 0x00,
-  0xcf, 0x7f, 0xde, 0x3a, 0xa4, 0x93, 0xea, 0xb8, 0x53, 0x3f, 0x6f, 0x15,
-  0x2f, 0x93, 0x03, 0xe5, 0x49, 0xa9, 0xd5, 0xcf, 0x7f, 0x16, 0xa2, 0xa0,
-  0x7c, 0x27, 0xe8, 0x18, 0x48, 0x3e, 0x87, 0xf3, 0x64, 0x7f, 0x9d, 0xa7,
-  0xf3, 0x65, 0x99, 0x60, 0x34, 0x46, 0x9d, 0x4a, 0x61, 0xbf, 0xc2, 0xfa,
-  0xcf, 0x55, 0xf2, 0xcd, 0xcb, 0xfa, 0x15, 0x9e, 0xd1, 0x6f, 0x61, 0x84,
-  0x92, 0x6f, 0xbe, 0xd9, 0x73, 0xbe, 0x85, 0xf3, 0xe6, 0x21, 0x04, 0xd1,
-  0xeb, 0x1d, 0x41, 0xb8, 0x5e, 0x85, 0x72, 0x00, 0xe1, 0x3b, 0x7d, 0x61,
-  0x99, 0x79, 0x45, 0xb1, 0x47, 0x7d, 0x37, 0xaa, 0xd0, 0xb9, 0x2e, 0x69,
-  0x2d, 0xdd, 0x70, 0xae, 0xd3, 0xd7, 0x2f, 0x3b, 0xaa, 0x88, 0xb9, 0x4d,
-  0x38, 0xb8, 0x62, 0x5e, 0xd1, 0x18, 0xd5, 0xc2, 0x8f, 0x59, 0xc7, 0x1d,
-  0xa4, 0x29, 0xda, 0x40, 0xa1, 0x84, 0x7d, 0x56, 0x5c, 0x3a, 0xef, 0x00,
-  0xc4, 0x7a, 0x5b, 0x1a, 0x4f, 0x14, 0xeb, 0x2a, 0xaf, 0xc3, 0xbe, 0x53,
-  0x98, 0x27, 0x4a, 0x9f, 0xf4, 0xc8, 0x7a, 0x4d, 0xc7, 0xa2, 0x8b, 0x40,
-  0x1d, 0x33, 0xc7, 0xfd, 0xc8, 0x84, 0x18, 0xc1, 0xf7, 0xe8, 0x50, 0xc4,
-  0x34, 0x38, 0x6f, 0x3a, 0x23, 0x8c, 0x64, 0x69, 0x5b, 0x74, 0x91, 0x93,
-  0x98, 0xbf, 0x52, 0x10, 0x53, 0x84, 0x6b, 0x60, 0x7a, 0xe3, 0xd5, 0x40,
-  0x23, 0xf6, 0x2b, 0x27, 0x3e, 0x84, 0x53, 0x31, 0x1e, 0xec, 0x7f, 0xfc,
-  0xe7, 0x11, 0x1e, 0x83, 0x9b, 0xbb, 0xcf, 0x5c, 0xf3, 0x49, 0x00, 0x69,
-  0x83, 0x92, 0xb8, 0x2e, 0xdd, 0xc3, 0xe2, 0x92, 0x48, 0x3f, 0xf9, 0xae,
-  0x2f, 0x7a, 0xbe, 0x59, 0xbf, 0x12, 0x6c, 0x49, 0x2c, 0x40, 0x49, 0x4b,
-  0x0c, 0x14, 0x2f, 0x2c, 0x89, 0x3b, 0x94, 0x5f, 0xb3, 0xfb, 0x30, 0x5f,
-  0x4e, 0x75, 0x47, 0x53, 0xee, 0x01, 0xe3, 0xa8, 0xee, 0x76, 0x18, 0x91,
-  0xb8, 0x3a, 0x28, 0x64, 0x0e, 0x6e, 0x92, 0x04, 0xff, 0xa7, 0xec, 0x41,
-  0xe8, 0xeb, 0x4b, 0xf1, 0x80, 0x28, 0x05, 0x01, 0xa7, 0xd1, 0xd2, 0xbe,
-  0xbd, 0xc7, 0xbd, 0x49, 0xf7, 0x43, 0xe5, 0xfc, 0xb3, 0x3d, 0x44, 0xe7,
-  0x1c, 0x4f, 0x02, 0x75, 0x73, 0x4d, 0xa3, 0xb9, 0x50, 0x56, 0x29, 0x1b,
-  0x66, 0x05, 0x7a, 0x36, 0xea, 0xef, 0x87, 0x01, 0xdf, 0xcd, 0xed, 0x36,
-  0x73, 0x29, 0x9a, 0xb1, 0x4f, 0x5f, 0xd2, 0x83, 0xba, 0x78, 0x66, 0xfd,
-  0xbd, 0x99, 0x06, 0x7a, 0x6d, 0x2f, 0xdc, 0x9a, 0xca, 0x3a, 0x6a, 0xf1,
-  0xcb, 0xc6, 0xe2, 0xc3, 0x3c, 0x80, 0x64, 0xa5, 0x9c, 0x31, 0x77, 0x0f,
-  0x19, 0xdb, 0xa6, 0xba, 0x96, 0x08, 0xe1, 0x5c, 0xef, 0x9a, 0xe9, 0x3e,
-  0x4f, 0x75, 0x1d, 0xad, 0x3a, 0x9c, 0x4f, 0x9d, 0x44, 0xa3, 0x52, 0x61,
-  0x32, 0xb4, 0x56, 0xae, 0x3f, 0xb1, 0x50, 0x11, 0x8e, 0x6f, 0xb8, 0xb8,
-  0xe9, 0x7b, 0x54, 0x01, 0x4b, 0x35, 0x1c, 0xbc, 0x3d, 0x91, 0xf3, 0xe1,
-  0x58, 0x4d, 0xbc, 0x62, 0x6c, 0xa0, 0x82, 0x5e, 0x76, 0xa3, 0x86, 0xe9,
-  0xd1, 0x23, 0x6a, 0xe5, 0x6f, 0x1b, 0xc3, 0x31, 0xb7, 0xc5, 0x58, 0xad,
-  0x31, 0x23, 0x43, 0xa6, 0x73, 0xeb, 0xea, 0x60, 0xbb, 0x30, 0xf2, 0x50,
-  0x17, 0xeb, 0xf5, 0xa0, 0xec, 0x63, 0x3e, 0x5e, 0xd1, 0x99, 0x91, 0x62,
-  0x8a, 0x41, 0x0c, 0xec, 0xe2, 0xf9, 0xcf, 0x5a, 0x75, 0x03, 0x03, 0xf2,
-  0xd3, 0x76, 0x85, 0x0f, 0x45, 0x21, 0xdf, 0xcf, 0xb9, 0x13, 0x1f, 0xe8,
-  0x88, 0x1a, 0x22, 0x50, 0xa4, 0xfd, 0x9c, 0xbb, 0xda, 0x4f, 0x43, 0x55,
-  0x6a, 0x07, 0x6d, 0x2a, 0x4a, 0x02, 0x7b, 0x71, 0xd1, 0xae, 0xe0, 0x18,
-  0x98, 0x67, 0xed, 0x3a, 0xce, 0x6e, 0x48, 0x1b, 0x84, 0x2c, 0xb9, 0x44,
-  0xd4, 0x42, 0xbf, 0x43, 0xfd, 0x93, 0x6e, 0xea, 0x35, 0x5d, 0x97, 0xed,
-  0xb4, 0x37, 0x20, 0x1a, 0x94, 0xeb, 0x6b, 0x51, 0xdd, 0xa4, 0x0b, 0x50,
-  0x1f, 0xed, 0x16, 0xae, 0x97, 0x78, 0x01, 0xed, 0xa0, 0x3e, 0x02, 0x12,
-  0x51, 0x2e, 0xbf, 0x2b, 0x85, 0x55, 0xed, 0x63, 0x24, 0xb4, 0x01, 0x7e,
-  0x1b, 0xe6, 0x5c, 0x4c, 0x42, 0xe3, 0x3b, 0x76, 0x38, 0x71, 0x66, 0x0a,
-  0x89, 0x92, 0xef, 0xd8, 0x2d, 0x26, 0xee, 0x7d, 0xee, 0x6f, 0xf6, 0x33,
-  0xce, 0x47, 0x46, 0x73, 0xc8, 0xff, 0xdd, 0x34, 0x0c, 0xd0, 0x37, 0xde,
-  0x07, 0x3c, 0xed, 0x37, 0x38, 0x10, 0xb4, 0x0b, 0xdc, 0x65, 0x73, 0x20,
-  0xe0, 0x8b, 0xcb, 0x4b, 0xb7, 0x93, 0x41, 0xbc, 0xae, 0x41, 0x72, 0x16,
-  0x2a, 0x59, 0x4a, 0x7a, 0x9b, 0xb6, 0x72, 0xcf, 0x63, 0x3d, 0xef, 0x78,
-  0xf4, 0x18, 0xe2, 0xdd, 0xae, 0xfd, 0xf0, 0xde, 0xd3, 0x81, 0x63, 0xd3,
-  0x06, 0xf6, 0x00, 0x76, 0xf9, 0xe9, 0xf2, 0x6d, 0xb2, 0x78, 0xfc, 0xf8,
-  0x6e, 0x0d, 0x59, 0x1a, 0x8e, 0xb4, 0x08, 0x54, 0xaa, 0x6a, 0x34, 0x8b,
-  0x8e, 0x79, 0xb7, 0x6f, 0xd4, 0x98, 0xf2, 0xf9, 0x19, 0x1f, 0x33, 0xfa,
-  0x31, 0xa7, 0x5b, 0x37, 0x2d, 0x3c, 0xea, 0x82, 0x34, 0xfa, 0x13, 0x63,
-  0x02, 0xdc, 0xab, 0xc7, 0xa7, 0x63, 0xb9, 0xd6, 0x24, 0x0a, 0xfc, 0xd4,
-  0x2d, 0xac, 0x9c, 0x62, 0x66, 0x6f, 0xd1, 0xb8, 0x99, 0xd1, 0x52, 0xb3,
-  0x38, 0xad, 0xbe, 0x78, 0xa1, 0x91, 0x71, 0xca, 0x3a, 0x4a, 0x00, 0x09,
-  0x5b, 0x1d, 0x7e, 0x39, 0xd3, 0x99, 0xde, 0x66, 0x2a, 0x51, 0xcb, 0x19,
-  0x5d, 0xa2, 0xf0, 0x76, 0x51, 0x91, 0x7b, 0x0c, 0xa6, 0x87, 0xbe, 0x65,
-  0x57, 0x2e, 0xf2, 0x43, 0x65, 0x6c, 0xec, 0x88, 0xfa, 0xf2, 0xf0, 0xf4,
-  0x95, 0xbd, 0x32, 0xac, 0xb7, 0x56, 0xb4, 0xce, 0xfa, 0x1c, 0x84, 0x4b,
-  0xb0, 0xbc, 0x49, 0xe4, 0x32, 0xef, 0xd0, 0x2a, 0x8c, 0x93, 0xa7, 0xf5,
-  0xf0, 0x3c, 0x34, 0x6a, 0xad, 0x03, 0x74, 0xd4, 0x2a, 0xe7, 0x52, 0xe7,
-  0x26, 0x43, 0xfe, 0xc8, 0xf6, 0x9b, 0x14, 0x38, 0x60, 0x95, 0x9a, 0xdb,
-  0x65, 0x4d, 0x95, 0xbf, 0x5e, 0x2a, 0x03, 0x66, 0x75, 0x29, 0x27, 0x66,
-  0xa1, 0xc1, 0x26, 0x97, 0xbc, 0xda, 0x70, 0xf9, 0xf7, 0xde, 0x01, 0xaf,
-  0x2e, 0x60, 0xb0, 0x2a, 0x60, 0x55, 0xca, 0x9d, 0xf9, 0xf1, 0x3b, 0x4c,
-  0x53, 0x95, 0xcb, 0xb3, 0x84, 0x38, 0x30, 0x3c, 0xc4, 0xf5, 0x09, 0xb4,
-  0xa9, 0x50, 0x11, 0x9e, 0x91, 0x1a, 0x91, 0x07, 0xaf, 0xb7, 0xa7, 0xb0,
-  0xa5, 0x04, 0x6f, 0x6b, 0x29, 0x2f, 0xa6, 0x88, 0x09, 0xca, 0xeb, 0xe7,
-  0xad, 0x8c, 0xf5, 0x92, 0xce, 0x86, 0xf9, 0x9a, 0x14, 0xba, 0x96, 0x9e,
-  0xaa, 0x63, 0x25, 0x1d, 0xcd, 0x93, 0xef, 0x67, 0xef, 0xdd, 0xfb, 0xd9,
-  0xf7, 0x36, 0xa2, 0x45, 0x8c, 0x39, 0xef, 0x67, 0x4e, 0x33, 0xad, 0x56,
-  0x5f, 0x63, 0x70, 0xc9, 0x7a, 0x8d, 0xa1, 0x76, 0x0e, 0xc9, 0x2a, 0x45,
-  0xb6, 0xa4, 0x9f, 0x4f, 0xf1, 0xcb, 0xc8, 0x2d, 0x43, 0x34, 0x99, 0xf2,
-  0xe1, 0x5e, 0xed, 0x7e, 0x26, 0x51, 0x87, 0x9a, 0xb8, 0x47, 0xcd, 0x6f,
-  0x5e, 0x25, 0xe6, 0xab, 0xbc, 0xe7, 0x42, 0x4e, 0x70, 0x05, 0x33, 0xbb,
-  0xf0, 0x17, 0x72, 0xfc, 0x53, 0xea, 0x0d, 0x6b, 0x33, 0x00, 0xf5, 0x59,
-  0x6e, 0x07, 0xa2, 0xf1, 0x05, 0xef, 0x2c, 0x95, 0xc5, 0x1a, 0xcd, 0x23,
-  0xc5, 0x8d, 0xce, 0x17, 0x81, 0x11, 0xcd, 0x4a, 0xd4, 0xae, 0xcf, 0xe8,
-  0x22, 0xae, 0xc2, 0xfc, 0x70, 0x2f, 0x3f, 0xd6, 0x5b, 0x7c, 0x78, 0xd8,
-  0x66, 0xd7, 0x5b, 0xc6, 0xc4, 0x22, 0x14, 0xca, 0x62, 0xfe, 0x40, 0xb5,
-  0x43, 0x2f, 0xf6, 0x4d, 0x9e, 0xde, 0x65, 0x18, 0x72, 0xee, 0xfc, 0x1c,
-  0x23, 0x1d, 0x34, 0xcd, 0x3d, 0x7a, 0xd1, 0x95, 0x27, 0xdf, 0xe0, 0x93,
-  0x5b, 0x88, 0xbc, 0x05, 0x44, 0x6c, 0x42, 0x5d, 0x78, 0xc6, 0x7d, 0x15,
-  0x8d, 0xfb, 0x2b, 0x1a, 0xb7, 0x56, 0xc4, 0x6d, 0x4f, 0x93, 0x2a, 0xcb,
-  0xef, 0xf1, 0x5a, 0x71, 0x4a, 0x29, 0x5b, 0xeb, 0x02, 0x53, 0xbe, 0x15,
-  0xfb, 0x33, 0xbe, 0x71, 0x5b, 0xa5, 0xab, 0xfa, 0x4c, 0x15, 0x18, 0xfe,
-  0xa1, 0x38, 0x34, 0xef, 0x34, 0x61, 0xa5, 0x91, 0xe0, 0x05, 0x50, 0xef,
-  0xe8, 0x65, 0xc5, 0x79, 0x79, 0x80, 0xe1, 0x11, 0xca, 0xdb, 0x66, 0x51,
-  0xcd, 0xd7, 0x45, 0x5d, 0x27, 0x78, 0x35, 0x16, 0x93, 0x15, 0x53, 0xde,
-  0x1a, 0x4c, 0xe3, 0x0a, 0x0b, 0xf6, 0x0d, 0x5f, 0xfa, 0xa8, 0x2e, 0x1a,
-  0x8b, 0x64, 0x18, 0x92, 0xb7, 0xc4, 0x9b, 0x37, 0x14, 0x10, 0x8d, 0x32,
-  0xd7, 0x51, 0x31, 0x1e, 0x5f, 0x78, 0x39, 0xe2, 0xa7, 0x8f, 0x71, 0xe0,
-  0xd3, 0x32, 0xcf, 0x76, 0x59, 0x3d, 0x72, 0xaf, 0xc8, 0x62, 0x18, 0x03,
-  0x4c, 0xc0, 0xcb, 0x71, 0x48, 0xed, 0x0a, 0xaa, 0x1f, 0x1d, 0x0e, 0x6c,
-  0x8b, 0x04, 0x1c, 0xd9, 0x6b, 0x7c, 0x3b, 0x3d, 0x83, 0xc6, 0x9f, 0x7d,
-  0x42, 0x75, 0x9b, 0x39, 0x1d, 0x6e, 0xd1, 0xf6, 0x4f, 0x5f, 0xf9, 0xeb,
-  0xb3, 0x81, 0x3c, 0xfb, 0x04, 0x9a, 0x6d, 0x17, 0xe7, 0x6a, 0x27, 0x5c,
-  0xdf, 0xd4, 0xf7, 0xda, 0x7a, 0xde, 0x28, 0x27, 0xde, 0xe6, 0x19, 0x99,
-  0xd6, 0x91, 0x37, 0xde, 0x37, 0xe4, 0x33, 0xdd, 0x54, 0x1c, 0x36, 0x87,
-  0x28, 0x77, 0x14, 0x91, 0x91, 0x9c, 0x51, 0x9c, 0xfd, 0x68, 0x83, 0xc4,
-  0x77, 0x44, 0xf5, 0x38, 0x59, 0x45, 0xe7, 0x6c, 0xf0, 0x30, 0xf1, 0xc2,
-  0x57, 0x1c, 0x72, 0x8c, 0x39, 0x61, 0xa8, 0x2d, 0x59, 0x5d, 0x73, 0xe2,
-  0x7b, 0x0c, 0x1e, 0x63, 0xe5, 0x0c, 0x72, 0xa8, 0x6a, 0xc1, 0x7b, 0xae,
-  0xca, 0x4a, 0xf4, 0x51, 0xcb, 0x60, 0xf7, 0x8f, 0x36, 0xcb, 0x0a, 0x92,
-  0x66, 0xa5, 0xbd, 0x57, 0x90, 0x45, 0xf5, 0xec, 0x71, 0x07, 0x58, 0xc8,
-  0x3c, 0x59, 0xa8, 0xd0, 0x32, 0xf7, 0x0c, 0x18, 0x4d, 0xd3, 0x2f, 0x2f,
-  0x5e, 0xe8, 0xfa, 0x30, 0xc3, 0x75, 0x0a, 0xed, 0xad, 0xd4, 0x53, 0xf5,
-  0x13, 0xc5, 0xe3, 0x7b, 0x93, 0x44, 0x34, 0xd3, 0x28, 0x63, 0xa0, 0x32,
-  0x66, 0x72, 0x39, 0x4b, 0x57, 0xeb, 0xc5, 0xcc, 0x86, 0x85, 0x84, 0xd2,
-  0xcf, 0xcd, 0x8d, 0x2a, 0x4f, 0x15, 0x82, 0x19, 0x0c, 0x0d, 0x03, 0xf6,
-  0xa4, 0x45, 0xda, 0xf2, 0x27, 0xad, 0x24, 0xd8, 0xbf, 0x3a, 0xae, 0x85,
-  0x37, 0x01, 0xab, 0x57, 0x6b, 0x3a, 0x6e, 0xd5, 0x40, 0x37, 0x1c, 0x00,
-  0xc9, 0x35, 0x70, 0xb9, 0x3a, 0x13, 0x32, 0x0f, 0x52, 0x49, 0x09, 0x26,
-  0x76, 0x94, 0x79, 0x48, 0x93, 0xf5, 0x33, 0x73, 0xc9, 0x8b, 0xba, 0x0f,
-  0x57, 0x18, 0x69, 0x35, 0xa6, 0x3e, 0x7b, 0xde, 0xd9, 0x81, 0xcc, 0x06,
-  0x80, 0xf7, 0x02, 0x56, 0x48, 0xba, 0x83, 0x0b, 0x2b, 0xd0, 0x33, 0xbd,
-  0xdc, 0x6f, 0x33, 0x0f, 0xd3, 0x4f, 0x3b, 0x31, 0x39, 0xf7, 0xf2, 0x83,
-  0xbe, 0xf1, 0x7a, 0x03, 0xf9, 0x0d, 0x48, 0x34, 0xb1, 0x3f, 0x42, 0xa6,
-  0x64, 0x88, 0x6d, 0xd6, 0x03, 0xa0, 0xbb, 0xb4, 0x21, 0xd5, 0xbc, 0x4e,
-  0x55, 0xdc, 0xad, 0xb1, 0x2e, 0x9d, 0x35, 0xf8, 0x9b, 0xa6, 0xbd, 0xac,
-  0x28, 0xf6, 0x39, 0x3c, 0x02, 0x47, 0x9b, 0x7a, 0xcf, 0xb1, 0x19, 0xc1,
-  0x0c, 0x3b, 0x35, 0x23, 0xd0, 0x8e, 0xb3, 0xbc, 0xe0, 0x7b, 0x74, 0x77,
-  0xc8, 0xc4, 0xda, 0x5d, 0x85, 0xa2, 0x3b, 0x70, 0x78, 0xb1, 0x8f, 0x43,
-  0x26, 0xd3, 0x3a, 0x9a, 0x27, 0x18, 0xa6, 0x42, 0x62, 0x07, 0x27, 0xe5,
-  0x35, 0xae, 0xb1, 0x54, 0xb2, 0x65, 0xea, 0xe9, 0x24, 0x85, 0x1d, 0xa2,
-  0x94, 0x4a, 0x9b, 0xb0, 0x3e, 0x24, 0x87, 0x8f, 0x4b, 0x24, 0x4b, 0x5b,
-  0x15, 0x61, 0xbf, 0x4b, 0xa9, 0x5b, 0xd7, 0x69, 0xb9, 0x4f, 0x13, 0xe0,
-  0x9f, 0x51, 0x5c, 0xb2, 0x52, 0x1b, 0x45, 0xb0, 0x72, 0x2e, 0x45, 0x13,
-  0xc5, 0xf4, 0x4c, 0x72, 0x31, 0x0e, 0x93, 0x8e, 0x3a, 0x48, 0x18, 0xe5,
-  0x7a, 0x94, 0xa8, 0x42, 0xd3, 0xf1, 0x21, 0x3f, 0x56, 0xd1, 0x69, 0x9b,
-  0xef, 0x78, 0x07, 0x03, 0x74, 0xe9, 0xed, 0x8b, 0x3f, 0x6d, 0xb9, 0x39,
-  0x64, 0xe0, 0xff, 0x88, 0xac, 0x99, 0x11, 0x66, 0x0c, 0xa4, 0x67, 0xbe,
-  0xf3, 0xe7, 0xec, 0x98, 0xac, 0x9a, 0x3f, 0xac, 0x76, 0xe3, 0xa2, 0xf1,
-  0xe0, 0xda, 0x49, 0x65, 0xba, 0xcd, 0xaa, 0xf4, 0x07, 0x11, 0x30, 0xbc,
-  0xda, 0xc6, 0xa4, 0x32, 0xb7, 0x3a, 0x13, 0x67, 0xb1, 0x40, 0x85, 0x0f,
-  0xef, 0xf9, 0xab, 0xa4, 0x9e, 0xae, 0xb3, 0xcd, 0x66, 0xba, 0x99, 0xc2,
-  0xf0, 0x9e, 0xdd, 0x7d, 0x9c, 0xcc, 0x42, 0xde, 0x0e, 0xaf, 0x67, 0xf6,
-  0xae, 0x10, 0x7e, 0x5c, 0x11, 0x0a, 0xa9, 0xdc, 0xb7, 0x02, 0x74, 0x2c,
-  0xb2, 0x68, 0xa2, 0x48, 0x6a, 0xa3, 0x6d, 0x28, 0x94, 0x3a, 0x0c, 0x13,
-  0x5a, 0xbc, 0xf1, 0x23, 0x54, 0xe6, 0xda, 0x34, 0x92, 0xda, 0x5d, 0x48,
-  0x5f, 0xbc, 0x58, 0x66, 0xfb, 0x62, 0x47, 0x61, 0x46, 0x8a, 0x74, 0xb3,
-  0xc9, 0x56, 0x68, 0xd0, 0xa9, 0xfc, 0xee, 0x32, 0x20, 0xdc, 0xfa, 0xd5,
-  0xb6, 0x40, 0x6d, 0x54, 0xe4, 0x50, 0xd8, 0x39, 0xfa, 0xb3, 0xdb, 0x41,
-  0xa0, 0xf9, 0x7d, 0x92, 0x3f, 0x92, 0x05, 0xff, 0x00, 0xab, 0x05, 0xac,
-  0x8f, 0xb0, 0x2e, 0xed, 0x0b, 0x5a, 0x94, 0xd0, 0xca, 0x82, 0x29, 0xdd,
-  0x52, 0xfb, 0x8a, 0x07, 0x55, 0x34, 0x81, 0xa1, 0x0b, 0xaf, 0xa9, 0xc2,
-  0xe7, 0x8d, 0x08, 0x9a, 0x87, 0xe1, 0xd1, 0x86, 0x20, 0x3a, 0x79, 0x34,
-  0xd8, 0x1a, 0x97, 0xc3, 0x4a, 0xc3, 0x56, 0x65, 0x12, 0x53, 0x42, 0xf0,
-  0x6d, 0x87, 0xc1, 0x93, 0x3f, 0x5f, 0x44, 0x4e, 0xca, 0x4d, 0xd7, 0x02,
-  0x88, 0x7f, 0xeb, 0xde, 0xb1, 0xc1, 0xdd, 0x45, 0x8c, 0x50, 0x3b, 0x94,
-  0x31, 0x62, 0xe5, 0xb1, 0xcf, 0xb3, 0x26, 0xcc, 0xc5, 0xb3, 0x76, 0x69,
-  0x1f, 0x02, 0xc4, 0x8d, 0x81, 0x04, 0x15, 0x3b, 0x59, 0x97, 0x53, 0x72,
-  0xd8, 0xda, 0xe3, 0xb1, 0xd5, 0xaa, 0x11, 0x81, 0xc6, 0x89, 0x77, 0x51,
-  0x9a, 0x33, 0x0d, 0x2b, 0xdc, 0xd0, 0x8e, 0x7f, 0x2e, 0x96, 0xfc, 0xd2,
-  0x46, 0x89, 0x0d, 0x76, 0xf5, 0xae, 0xcd, 0xc9, 0x0f, 0x0d, 0xe5, 0x65,
-  0x56, 0x8f, 0x1a, 0xc5, 0xbc, 0xc8, 0x55, 0x6e, 0x9c, 0x04, 0x0a, 0xb0,
-  0x81, 0x0d, 0x2b, 0x75, 0x4c, 0x29, 0xd2, 0x77, 0xfa, 0xa3, 0x3c, 0x70,
-  0x29, 0xbd, 0x5c, 0xdc, 0x05, 0xe4, 0x61, 0xcf, 0x71, 0xf8, 0x0f, 0x95,
-  0xcf, 0xf0, 0x87, 0xbe, 0xe0, 0x8e, 0xd0, 0x0d, 0x13, 0xda, 0x89, 0x0a,
-  0x8f, 0xcf, 0xc4, 0x02, 0x63, 0xa8, 0x80, 0xea, 0xb9, 0x4f, 0x19, 0x91,
-  0x3d, 0xd1, 0x53, 0x8e, 0xfd, 0xc1, 0x9e, 0x7c, 0xf9, 0x41, 0xb0, 0x6c,
-  0x28, 0x10, 0x2e, 0xed, 0x96, 0xf8, 0xc8, 0x1e, 0x1f, 0x9f, 0x9c, 0x38,
-  0x43, 0xc4, 0xcd, 0xce, 0xa5, 0x84, 0xdf, 0x49, 0x0c, 0xaa, 0x65, 0xd5,
-  0x3e, 0x97, 0x60, 0xce, 0x3f, 0xa0, 0x11, 0xed, 0x6d, 0x78, 0x68, 0x13,
-  0x6c, 0x3c, 0x14, 0x4b, 0x5f, 0xd8, 0x1a, 0x2d, 0x0f, 0x72, 0x3a, 0xfc,
-  0xa3, 0x51, 0x74, 0x2c, 0x57, 0x36, 0xb5, 0x5f, 0x63, 0x51, 0xd1, 0x07,
-  0x86, 0xcc, 0x5f, 0xed, 0xee, 0x85, 0x0c, 0x35, 0xf5, 0x5a, 0xd3, 0xa2,
-  0x85, 0x31, 0xa8, 0x0b, 0xd9, 0x66, 0xea, 0x67, 0xc8, 0x8b, 0x67, 0x31,
-  0xe1, 0xd1, 0x02, 0xd1, 0xf0, 0x07, 0x1a, 0xbf, 0xeb, 0x51, 0x20, 0x01,
-  0x80, 0xb5, 0xc7, 0x77, 0x9d, 0xca, 0x23, 0x80, 0xb9, 0x50, 0x2d, 0x24,
-  0x03, 0x94, 0x73, 0x2e, 0x18, 0x8a, 0x1c, 0xfa, 0x1a, 0x3d, 0x7c, 0xe0,
-  0xd6, 0x64, 0xfb, 0x1e, 0x5a, 0x11, 0x42, 0x07, 0xc5, 0xcc, 0xf6, 0x12,
-  0x13, 0xb3, 0xa5, 0x9b, 0x33, 0x54, 0x26, 0x3c, 0xc8, 0xb6, 0x6e, 0x06,
-  0xc8, 0x0e, 0xa5, 0xd8, 0xfb, 0xda, 0xa4, 0x99, 0x77, 0xea, 0x3d, 0x64,
-  0xeb, 0x90, 0x4f, 0x34, 0xe6, 0x1f, 0x77, 0x73, 0x07, 0x83, 0xba, 0x90,
-  0x6d, 0x64, 0x33, 0x64, 0x07, 0xe5, 0x21, 0x40, 0xe4, 0x98, 0xb6, 0xa8,
-  0x07, 0xd1, 0x6f, 0xe0, 0x98, 0x53, 0x1e, 0x77, 0x6f, 0x33, 0x0c, 0x74,
-  0x07, 0x6d, 0x11, 0x98, 0x26, 0x79, 0xd7, 0x94, 0xa9, 0xb7, 0x3c, 0xf4,
-  0x91, 0x67, 0xe0, 0x98, 0xbc, 0x9f, 0x5c, 0xd7, 0x2f, 0xba, 0x29, 0x34,
-  0x05, 0x02, 0xf8, 0xb6, 0xae, 0x36, 0xf0, 0x1d, 0x2d, 0x8a, 0xc0, 0x44,
-  0x5a, 0x94, 0x7e, 0xd7, 0xdf, 0x1a, 0x84, 0xb1, 0x2d, 0xe9, 0xf1, 0xe9,
-  0x24, 0xe8, 0x10, 0xb8, 0xb5, 0x1d, 0x08, 0xdc, 0xd5, 0x06, 0xff, 0x7b,
-  0x93, 0x7e, 0xcc, 0xab, 0xd2, 0xdb, 0x00, 0x06, 0xd2, 0x2d, 0xc8, 0xfb,
-  0xc6, 0x82, 0xa1, 0x03, 0xe0, 0xb6, 0x06, 0x30, 0x70, 0x47, 0x0b, 0x42,
-  0x80, 0x58, 0x13, 0xfa, 0x87, 0x20, 0x77, 0x86, 0x20, 0xef, 0x1d, 0x82,
-  0xdc, 0x0e, 0x41, 0xde, 0x3b, 0x04, 0x79, 0xcf, 0x10, 0xe4, 0x7d, 0x43,
-  0x80, 0x86, 0xfd, 0xbe, 0xd5, 0x88, 0x42, 0x25, 0x92, 0xf4, 0x73, 0xb2,
-  0x7d, 0xe0, 0x4b, 0x50, 0xc2, 0xe1, 0x4f, 0x8f, 0xe4, 0x44, 0x40, 0x16,
-  0x9d, 0x16, 0xb6, 0xad, 0x39, 0x08, 0xfb, 0xcf, 0x5d, 0x9e, 0xbf, 0x7b,
-  0x89, 0x28, 0xd8, 0xe6, 0x40, 0x81, 0x10, 0x23, 0x7b, 0x34, 0x83, 0xb5,
-  0xc1, 0x2b, 0xd9, 0x22, 0xea, 0xd7, 0x6d, 0x6e, 0x15, 0x5c, 0xd8, 0x2b,
-  0xd3, 0xee, 0x08, 0x0c, 0xb0, 0xff, 0xd4, 0xde, 0xf1, 0xfe, 0xe7, 0x66,
-  0x4b, 0x8a, 0xb2, 0xa7, 0x21, 0x45, 0x19, 0xb6, 0xa3, 0x28, 0x07, 0x36,
-  0x83, 0x8a, 0xba, 0x25, 0x5a, 0x1b, 0x01, 0x90, 0x3f, 0x6b, 0x6f, 0x83,
-  0xf7, 0x95, 0x9b, 0xe0, 0x7d, 0x27, 0xdd, 0x5a, 0x2b, 0xf6, 0xf6, 0x79,
-  0xd6, 0x84, 0xb9, 0x6c, 0x77, 0xff, 0x09, 0xbe, 0x37, 0x9d, 0x37, 0xd6,
-  0x69, 0x99, 0xdd, 0x24, 0x75, 0x76, 0x23, 0x46, 0xd9, 0xf0, 0xc5, 0xac,
-  0x0d, 0xbc, 0x63, 0x17, 0xe5, 0x81, 0x5d, 0xb4, 0xfb, 0xec, 0x8c, 0x71,
-  0x8b, 0x3f, 0xa4, 0x5e, 0x06, 0xec, 0xa8, 0x51, 0x03, 0xc4, 0xeb, 0x72,
-  0x02, 0x5a, 0x9b, 0x3a, 0x1a, 0xa7, 0xfb, 0x14, 0xb0, 0x9c, 0x01, 0x96,
-  0xcb, 0x32, 0xbd, 0x91, 0x5d, 0x82, 0x9c, 0xfa, 0x1b, 0x7f, 0xb3, 0x69,
-  0xb1, 0x5e, 0x57, 0x36, 0xa8, 0xc9, 0x33, 0xbb, 0xa1, 0x10, 0x50, 0x76,
-  0x63, 0xf6, 0xc1, 0x38, 0xe1, 0x43, 0xc3, 0xb7, 0x74, 0x3d, 0xe7, 0xda,
-  0x28, 0x4c, 0x9b, 0xef, 0x34, 0x60, 0x40, 0x9a, 0xde, 0x17, 0x6b, 0xe3,
-  0x1a, 0xa3, 0x7c, 0x97, 0x89, 0x75, 0x9b, 0x73, 0x8c, 0x97, 0x41, 0xcc,
-  0x69, 0x25, 0x14, 0xb7, 0x7d, 0x90, 0x00, 0x81, 0x07, 0x4a, 0xa9, 0x7c,
-  0xd2, 0x36, 0x98, 0xcf, 0xfd, 0x11, 0x68, 0x85, 0xbb, 0xf4, 0x07, 0xc2,
-  0x6c, 0x5c, 0xbc, 0xba, 0x6d, 0x1e, 0x61, 0xa9, 0x76, 0x10, 0xa3, 0xb5,
-  0x40, 0x05, 0x63, 0x7f, 0x12, 0xa9, 0xd0, 0x04, 0x4e, 0x0c, 0xf9, 0x42,
-  0x8f, 0x82, 0x4d, 0x4f, 0x09, 0xdb, 0x97, 0xc5, 0x4d, 0x52, 0x56, 0x2a,
-  0x5f, 0xc0, 0xac, 0xd6, 0xc9, 0x7a, 0xe1, 0xc5, 0x42, 0x73, 0xa6, 0xb5,
-  0x37, 0xa1, 0x19, 0xc9, 0xb1, 0x0f, 0xe5, 0x05, 0xba, 0x4d, 0x6d, 0xb3,
-  0x3c, 0x55, 0x1a, 0xc3, 0x5a, 0xe2, 0x2a, 0x13, 0x3d, 0x1a, 0x87, 0x1b,
-  0x56, 0x8f, 0x9f, 0x19, 0xba, 0xdf, 0x88, 0xce, 0x35, 0xa0, 0xe7, 0x7d,
-  0xc6, 0x69, 0x94, 0x2e, 0xd0, 0x5c, 0xab, 0x51, 0x20, 0xad, 0x33, 0xaa,
-  0xd1, 0xf4, 0x38, 0x11, 0x48, 0xfb, 0x79, 0xa9, 0xda, 0x4d, 0xc0, 0xa5,
-  0x37, 0x6f, 0x4c, 0x29, 0x6d, 0xab, 0x34, 0x1d, 0x84, 0x41, 0x37, 0x5e,
-  0xbf, 0x27, 0xe4, 0xb6, 0xa5, 0x92, 0xde, 0x47, 0xa3, 0x6b, 0xeb, 0x53,
-  0x1b, 0x01, 0x8e, 0x72, 0x1c, 0x9f, 0x4c, 0xc9, 0xae, 0xe7, 0x05, 0x06,
-  0x42, 0x5a, 0xa6, 0x5c, 0x13, 0x4d, 0x1a, 0x65, 0x20, 0x9e, 0xb9, 0xdf,
-  0x5c, 0x5b, 0x03, 0x37, 0xf4, 0x74, 0xea, 0xe4, 0x7b, 0x99, 0xd6, 0x4a,
-  0x28, 0x3c, 0xa1, 0x03, 0x1e, 0x41, 0x67, 0xb0, 0x71, 0xc2, 0x37, 0x0c,
-  0x82, 0x3b, 0xfc, 0x14, 0x29, 0x34, 0xfc, 0xd9, 0x1c, 0x98, 0x6a, 0x0d,
-  0xcb, 0xf4, 0x85, 0x73, 0xe0, 0x88, 0xe1, 0x37, 0x1d, 0x2b, 0xdf, 0x68,
-  0xe6, 0x1a, 0x04, 0x05, 0x66, 0xda, 0xca, 0x71, 0x44, 0xb1, 0xb4, 0x2b,
-  0x92, 0xe4, 0x32, 0xda, 0xc9, 0xa6, 0x77, 0x5f, 0xbc, 0x50, 0xda, 0x49,
-  0x05, 0xed, 0xeb, 0xe2, 0x7a, 0xe0, 0xcc, 0x0f, 0xfc, 0x8a, 0x09, 0x13,
-  0xb2, 0x9a, 0x9d, 0x8a, 0xa4, 0x54, 0x55, 0x94, 0x14, 0x3a, 0x9a, 0x7c,
-  0x8c, 0x12, 0x65, 0x4c, 0x59, 0xec, 0xf8, 0x87, 0xc8, 0x18, 0xc9, 0x7c,
-  0x0d, 0x12, 0xf2, 0xdc, 0x1f, 0xc9, 0x31, 0x9a, 0xe6, 0x55, 0x4d, 0xbd,
-  0x8a, 0xe7, 0x06, 0xe6, 0x52, 0x83, 0xd8, 0xf9, 0x8d, 0x89, 0x67, 0x99,
-  0xf2, 0xa1, 0xc3, 0x86, 0xfc, 0x71, 0xea, 0x0c, 0xc3, 0xc1, 0x62, 0xa9,
-  0x26, 0x2f, 0x50, 0x68, 0x6c, 0x1d, 0x38, 0x9b, 0x6a, 0xae, 0xd8, 0x22,
-  0x0c, 0x02, 0xfb, 0x42, 0xdd, 0xab, 0xcb, 0x90, 0x59, 0x5c, 0x5e, 0x31,
-  0xe6, 0xe3, 0xe9, 0x85, 0x07, 0xf8, 0x21, 0x38, 0xc7, 0xe2, 0xbe, 0xe3,
-  0x90, 0xed, 0xd3, 0x35, 0x5a, 0x2a, 0x4e, 0x1b, 0x19, 0x43, 0x47, 0xeb,
-  0x91, 0x1a, 0x55, 0x2c, 0xa0, 0x31, 0xb9, 0x0d, 0x70, 0x0a, 0x1d, 0x12,
-  0xa3, 0x67, 0xb8, 0x3a, 0xa3, 0x42, 0xf0, 0x93, 0x8c, 0x1a, 0xea, 0xec,
-  0x13, 0x5d, 0xb1, 0x7a, 0xa1, 0xd6, 0xdf, 0xec, 0x15, 0x81, 0x53, 0x3a,
-  0x0a, 0xc4, 0x9f, 0xee, 0x8b, 0x9d, 0x32, 0x81, 0xb2, 0x39, 0x76, 0xbe,
-  0x3d, 0x21, 0x0f, 0x1d, 0x6e, 0xa6, 0x4b, 0x95, 0x8a, 0x77, 0xcc, 0xb7,
-  0x53, 0xae, 0xe8, 0x6c, 0x4a, 0xde, 0xeb, 0xd9, 0xe6, 0x3e, 0x71, 0x89,
-  0x58, 0xaa, 0xb3, 0x74, 0x26, 0xc9, 0x0a, 0x8d, 0x89, 0xc7, 0x32, 0xa0,
-  0x65, 0x7b, 0x4a, 0x88, 0x2a, 0x35, 0x03, 0x02, 0x61, 0x8f, 0x99, 0x87,
-  0x9a, 0x5b, 0x89, 0xf8, 0xa0, 0x81, 0x48, 0x35, 0x00, 0x9f, 0x01, 0x43,
-  0x44, 0x1d, 0xdd, 0x78, 0x30, 0x9a, 0x96, 0xfb, 0x12, 0x3d, 0x9b, 0x42,
-  0xdf, 0x79, 0x7a, 0x19, 0xcc, 0x55, 0xc9, 0xb4, 0x91, 0x6d, 0x42, 0x85,
-  0xcd, 0x31, 0x12, 0xb1, 0x8b, 0xbc, 0xa3, 0xde, 0x61, 0x84, 0xe1, 0x06,
-  0x7c, 0x4f, 0x56, 0x5c, 0xaa, 0x5d, 0x4f, 0xfc, 0x80, 0x12, 0x23, 0x36,
-  0xc4, 0x07, 0xc9, 0xad, 0x30, 0x86, 0xd8, 0xae, 0x10, 0xd4, 0x5a, 0x0c,
-  0x74, 0xeb, 0xb8, 0x63, 0x52, 0x58, 0x4d, 0xbb, 0x74, 0x4c, 0x5f, 0xd9,
-  0xa3, 0x65, 0x84, 0x9c, 0x01, 0x3b, 0x9b, 0x85, 0x44, 0x89, 0x4f, 0x9c,
-  0x98, 0x17, 0xd9, 0x51, 0x2f, 0x52, 0x62, 0x9a, 0x7e, 0xa7, 0x57, 0x17,
-  0x7e, 0xc5, 0x19, 0xd2, 0x4c, 0xc6, 0x4d, 0xf6, 0xc1, 0x90, 0x9e, 0x65,
-  0x90, 0x53, 0x0e, 0x27, 0x39, 0x33, 0xb6, 0x5b, 0xf3, 0xc9, 0x37, 0x40,
-  0x86, 0xe3, 0x42, 0x20, 0xd2, 0x17, 0x6e, 0x9f, 0xc9, 0x68, 0xa5, 0x14,
-  0x9a, 0x32, 0xe8, 0x7f, 0x53, 0x22, 0x2e, 0x7b, 0x1d, 0x93, 0x31, 0xfa,
-  0x7a, 0xc5, 0xaa, 0xf6, 0x6a, 0x6e, 0xab, 0x37, 0xc2, 0x29, 0x52, 0x22,
-  0xde, 0x86, 0x93, 0x61, 0xec, 0xd3, 0x84, 0x8d, 0x8c, 0x3c, 0x57, 0xd4,
-  0xd1, 0x38, 0x6e, 0x96, 0x61, 0x08, 0xa7, 0xbb, 0x1d, 0xcf, 0x56, 0x68,
-  0x51, 0xd9, 0x34, 0x77, 0xae, 0xe5, 0xd6, 0xa9, 0x79, 0x9a, 0x85, 0xdf,
-  0x9f, 0xb7, 0x6f, 0x40, 0xbc, 0xaf, 0x0d, 0x6b, 0xe5, 0xba, 0x30, 0x16,
-  0x3e, 0xe7, 0x39, 0x02, 0xf3, 0xbc, 0xe7, 0x0c, 0x7a, 0xe9, 0x24, 0x7b,
-  0xd5, 0x92, 0x98, 0xbf, 0xb8, 0xe1, 0x60, 0x89, 0x3a, 0x6d, 0xdb, 0x9f,
-  0x62, 0x91, 0x68, 0x48, 0x59, 0x8e, 0xde, 0xdf, 0x8f, 0xac, 0x6c, 0x43,
-  0xc6, 0xeb, 0x12, 0xba, 0x71, 0xc1, 0x20, 0x9c, 0xd6, 0xb0, 0xdc, 0x65,
-  0x75, 0xca, 0xf9, 0x13, 0x9a, 0x92, 0x0a, 0x0f, 0x08, 0x1a, 0xfe, 0xea,
-  0x73, 0x27, 0x5e, 0x2e, 0x42, 0xe8, 0x23, 0x8a, 0x91, 0xc7, 0x5b, 0x11,
-  0x54, 0x59, 0x2c, 0xec, 0x7a, 0x80, 0x0c, 0x73, 0x19, 0x0d, 0x40, 0xc7,
-  0x84, 0x69, 0x3c, 0x3a, 0x91, 0xb6, 0xee, 0x0b, 0x7b, 0x34, 0xaf, 0x3d,
-  0x57, 0x4d, 0x3a, 0xea, 0x11, 0x28, 0x00, 0xe8, 0x2a, 0xba, 0xdf, 0x8d,
-  0x66, 0xce, 0x11, 0xbe, 0xf1, 0xdf, 0xd5, 0x08, 0xd8, 0xce, 0x77, 0xa1,
-  0xcc, 0x69, 0x3b, 0xaf, 0x13, 0x7c, 0x2c, 0x22, 0xef, 0x54, 0x04, 0x3b,
-  0xa8, 0xa2, 0x16, 0xbd, 0x29, 0xdc, 0x86, 0xdd, 0x3f, 0xba, 0xd7, 0xe8,
-  0xcd, 0xcb, 0x47, 0xd6, 0x33, 0xd3, 0xa9, 0xa2, 0xaa, 0xd3, 0x83, 0xa9,
-  0xc2, 0x45, 0x21, 0xc5, 0xcd, 0xd9, 0x7e, 0xac, 0xf4, 0x3e, 0xbd, 0xab,
-  0x2d, 0x81, 0x02, 0x1b, 0x12, 0x58, 0x65, 0x77, 0x1d, 0x38, 0xea, 0x6d,
-  0x79, 0x74, 0xfa, 0x50, 0xc3, 0x86, 0x38, 0x58, 0x70, 0x56, 0xa0, 0x1e,
-  0xef, 0x1b, 0x4d, 0xa4, 0x9b, 0x9a, 0x64, 0xf0, 0x21, 0xe7, 0x36, 0x17,
-  0xaa, 0xa5, 0x4e, 0x5a, 0x10, 0x6c, 0xa5, 0x24, 0xa8, 0xbc, 0x62, 0x8c,
-  0xb9, 0x6e, 0x96, 0x64, 0x31, 0xef, 0x8e, 0xb9, 0x57, 0x48, 0x45, 0x2a,
-  0x5b, 0x17, 0x16, 0x3c, 0xc5, 0x49, 0xb1, 0x8d, 0xcf, 0x43, 0xe1, 0x67,
-  0x9f, 0x07, 0x87, 0x71, 0x1c, 0x91, 0x6b, 0x81, 0xb2, 0x7d, 0x84, 0x6d,
-  0xfe, 0x31, 0x26, 0x43, 0xc6, 0xa4, 0x21, 0x65, 0x24, 0x33, 0xc6, 0xfe,
-  0xf0, 0xdf, 0x3a, 0xa8, 0x7b, 0x67, 0xde, 0x2a, 0x5a, 0x98, 0x6a, 0xcc,
-  0x42, 0xa4, 0x43, 0x98, 0x37, 0xfb, 0xa6, 0xb9, 0x90, 0xb9, 0xf0, 0x18,
-  0xee, 0x98, 0x03, 0x44, 0x53, 0x9c, 0x68, 0xc7, 0x08, 0xe8, 0x2d, 0x7d,
-  0x58, 0x64, 0x10, 0x6e, 0x86, 0x04, 0xac, 0x80, 0x32, 0x86, 0x0e, 0xbd,
-  0xd0, 0x9e, 0x68, 0x44, 0xd0, 0xab, 0x87, 0x27, 0xcc, 0x9a, 0x8d, 0xc1,
-  0xcd, 0x29, 0xc3, 0x78, 0xcb, 0x05, 0xaa, 0xb5, 0x49, 0x95, 0x16, 0xe4,
-  0x27, 0xe3, 0x9c, 0xba, 0x89, 0x24, 0x8f, 0x10, 0x75, 0x0a, 0xbb, 0x15,
-  0x15, 0x13, 0xff, 0x66, 0x43, 0xbe, 0xcc, 0x5f, 0x4d, 0xdf, 0x7d, 0x3a,
-  0x7b, 0xf7, 0xa9, 0x7a, 0xf9, 0x14, 0x7f, 0xf0, 0xf5, 0x05, 0x2f, 0x46,
-  0xfb, 0xc0, 0x64, 0xb0, 0x66, 0x2b, 0xa8, 0x35, 0x2d, 0xaf, 0x85, 0xde,
-  0x75, 0x55, 0xcd, 0xf7, 0x91, 0x34, 0x1a, 0x8d, 0x50, 0xce, 0x79, 0xea,
-  0x77, 0x46, 0xec, 0x30, 0x20, 0x59, 0xa6, 0x79, 0x14, 0x2a, 0xec, 0x50,
-  0x5a, 0x5f, 0xf1, 0xf2, 0x55, 0x3c, 0xc8, 0xbb, 0x3e, 0xbf, 0x86, 0xff,
-  0xe3, 0xb9, 0x68, 0x13, 0xba, 0x31, 0x2f, 0x5e, 0x65, 0xfb, 0x0c, 0xf6,
-  0xb1, 0xb9, 0x24, 0x86, 0x54, 0x8f, 0xff, 0x7c, 0x3e, 0x43, 0xde, 0x6c,
-  0x38, 0x80, 0x98, 0x8a, 0x82, 0x7a, 0x1b, 0x74, 0xed, 0xee, 0x31, 0xd7,
-  0x4f, 0x9e, 0x18, 0xc1, 0xfa, 0xf8, 0xa3, 0x15, 0x66, 0x86, 0xa5, 0x0b,
-  0x20, 0x59, 0xb5, 0x9d, 0x43, 0xa9, 0xc3, 0xb1, 0xf6, 0x76, 0x4d, 0x4f,
-  0xc8, 0x8d, 0x67, 0xbe, 0xca, 0xca, 0x15, 0x26, 0xa4, 0x67, 0xa9, 0x06,
-  0x5f, 0x7d, 0x8e, 0x8a, 0xa6, 0x23, 0xe0, 0x09, 0x4a, 0xd9, 0x37, 0x4a,
-  0x8e, 0x83, 0xef, 0xec, 0x52, 0x70, 0x77, 0x09, 0x7b, 0x4b, 0xc4, 0xbe,
-  0xd2, 0xa6, 0x22, 0xe6, 0xb6, 0x3b, 0xde, 0xe9, 0x24, 0xf5, 0x96, 0x94,
-  0x5d, 0xb2, 0x54, 0xc8, 0x8f, 0xf8, 0x9e, 0xa7, 0xab, 0x15, 0xdc, 0x7c,
-  0x90, 0x4f, 0x1b, 0xf5, 0x24, 0xc9, 0xeb, 0x39, 0x77, 0xc0, 0xfd, 0xe5,
-  0xfa, 0x09, 0x60, 0xd1, 0xdd, 0xe1, 0xd9, 0x2e, 0x01, 0x74, 0xa1, 0x81,
-  0x40, 0xc0, 0x1e, 0x1c, 0x4d, 0xf0, 0x91, 0xde, 0x0c, 0x81, 0x38, 0xaf,
-  0x31, 0xcd, 0xea, 0xbe, 0xd8, 0xa7, 0xfe, 0x76, 0x6e, 0x6c, 0xb0, 0x6b,
-  0xbe, 0x0b, 0x4a, 0x24, 0xd5, 0x2a, 0xcb, 0x5a, 0x8b, 0xd4, 0xee, 0x97,
-  0x26, 0xb9, 0x51, 0x8c, 0xc6, 0x5a, 0xf8, 0x70, 0x7c, 0xb6, 0xf9, 0x82,
-  0xd5, 0x04, 0x09, 0x10, 0x43, 0x8f, 0x1a, 0xfd, 0x61, 0xff, 0x66, 0x5f,
-  0xdc, 0xee, 0x95, 0xf4, 0x08, 0x7a, 0xc2, 0x8f, 0xfc, 0x1a, 0x89, 0x8e,
-  0x23, 0xc3, 0xc9, 0x88, 0xd4, 0x12, 0xdc, 0xe3, 0x91, 0x8e, 0xf0, 0xa1,
-  0x6f, 0x49, 0x2d, 0xd0, 0x81, 0x38, 0xaf, 0xd9, 0xae, 0x88, 0x52, 0xb9,
-  0xaa, 0x93, 0x1a, 0x6f, 0x7a, 0xaf, 0xde, 0x24, 0xd7, 0x9c, 0x93, 0x27,
-  0x96, 0xd2, 0x45, 0x6e, 0x62, 0x35, 0xf7, 0xf4, 0xbe, 0x28, 0xd0, 0x9e,
-  0xd7, 0xf9, 0x91, 0xef, 0x30, 0x39, 0xee, 0x38, 0xe8, 0x7e, 0xe3, 0xdf,
-  0x6a, 0x40, 0x16, 0xf4, 0x0d, 0xab, 0x38, 0xb1, 0xab, 0x47, 0x66, 0xcf,
-  0xbb, 0x3c, 0x66, 0xf9, 0x7a, 0x8e, 0xd7, 0x04, 0x52, 0x96, 0x26, 0x51,
-  0x4f, 0xfc, 0x52, 0xa5, 0xd6, 0x27, 0x3f, 0x75, 0x18, 0x1c, 0xdd, 0x7f,
-  0x78, 0x6d, 0xc9, 0x78, 0x22, 0x00, 0x05, 0x6c, 0xb2, 0xa1, 0x5e, 0xdb,
-  0x19, 0x49, 0xb0, 0x43, 0xc4, 0x5e, 0x9a, 0xb2, 0x33, 0xa7, 0x6e, 0x5c,
-  0xbb, 0x33, 0xc5, 0x6d, 0x9a, 0xcd, 0x66, 0x5e, 0x05, 0x82, 0x88, 0x0c,
-  0x38, 0xdf, 0x06, 0x38, 0x38, 0x15, 0xf5, 0xae, 0x0d, 0xfc, 0x74, 0x2a,
-  0x77, 0x17, 0xc9, 0xc4, 0x66, 0x3a, 0xd9, 0x2f, 0xc2, 0x33, 0x72, 0xd7,
-  0x92, 0x84, 0x28, 0x38, 0x6b, 0x69, 0x8c, 0x72, 0x38, 0x7e, 0x2d, 0x72,
-  0x32, 0xd1, 0x84, 0x44, 0x83, 0x9d, 0x80, 0x00, 0x19, 0x7f, 0xe2, 0x7a,
-  0x72, 0xc1, 0xbc, 0x13, 0x1f, 0x53, 0x0a, 0x90, 0xd0, 0xf8, 0xba, 0x92,
-  0xaf, 0x5f, 0xda, 0x8b, 0x20, 0x1f, 0x2b, 0x40, 0xf4, 0x6c, 0x46, 0x0f,
-  0x2b, 0x36, 0xfa, 0xc2, 0xae, 0x5a, 0xba, 0x80, 0x8d, 0x16, 0xd6, 0xda,
-  0x34, 0x1d, 0x5f, 0xa7, 0x7b, 0xfe, 0xf4, 0x48, 0x5b, 0xbb, 0xb4, 0x09,
-  0x6c, 0xa6, 0xcc, 0xd5, 0xc8, 0x4c, 0xfd, 0x15, 0x7e, 0xed, 0x24, 0xe1,
-  0xd9, 0x29, 0x94, 0xa9, 0x17, 0x22, 0xaa, 0xcf, 0xee, 0xe8, 0xbb, 0xb6,
-  0x7d, 0x41, 0xdd, 0x40, 0x15, 0x3d, 0xd7, 0xae, 0x08, 0x34, 0x8b, 0x3b,
-  0xb6, 0xfe, 0xcb, 0xd8, 0x3d, 0xfd, 0x71, 0xe2, 0x5d, 0x30, 0xf5, 0x7e,
-  0x79, 0x33, 0xac, 0x80, 0x9d, 0x4a, 0x71, 0x28, 0xf2, 0x7b, 0x9b, 0xa2,
-  0x29, 0x3e, 0x9b, 0x0e, 0xc5, 0x6a, 0xbb, 0x4d, 0x76, 0x68, 0x4e, 0x8b,
-  0x4d, 0xa7, 0x60, 0x2e, 0xbd, 0x71, 0xc3, 0x36, 0x04, 0x86, 0xea, 0xdc,
-  0x98, 0x17, 0x22, 0x57, 0x18, 0xb5, 0x05, 0xdb, 0x1e, 0x37, 0xf3, 0x9a,
-  0x80, 0xc6, 0x6c, 0x0c, 0x5e, 0x30, 0xdd, 0xd9, 0x2c, 0xd6, 0xd6, 0x4c,
-  0xc1, 0xdc, 0xb6, 0x6f, 0x77, 0xd8, 0x0c, 0x5c, 0xc5, 0x9e, 0xda, 0xf8,
-  0x14, 0x01, 0x8e, 0x37, 0xc3, 0x71, 0x84, 0x56, 0x70, 0x01, 0x68, 0x8e,
-  0x85, 0xd3, 0x75, 0x8d, 0xbe, 0x6c, 0x61, 0x6d, 0x3b, 0x2c, 0x31, 0xe6,
-  0x06, 0x38, 0xa3, 0xcb, 0xb8, 0x59, 0x4e, 0x51, 0xd8, 0xea, 0x0f, 0x68,
-  0x74, 0x30, 0x60, 0xa7, 0x01, 0x52, 0x92, 0xe6, 0x52, 0x48, 0xcc, 0x3b,
-  0x0f, 0x1f, 0xab, 0xcd, 0x3e, 0x36, 0x4e, 0x6d, 0x83, 0x44, 0x5e, 0x97,
-  0x20, 0x94, 0x2e, 0x95, 0x21, 0xd3, 0xdb, 0xc4, 0x78, 0xa8, 0x31, 0x66,
-  0x0e, 0x9a, 0xb4, 0x30, 0x35, 0xb4, 0xe3, 0xe4, 0xcd, 0xdb, 0x03, 0x5b,
-  0x9e, 0x27, 0x60, 0x2b, 0x1b, 0x0d, 0xc4, 0x11, 0x32, 0x01, 0x91, 0x49,
-  0xff, 0x5c, 0x38, 0x70, 0xda, 0x0c, 0xd9, 0xcb, 0x1f, 0xb7, 0x98, 0x30,
-  0x2e, 0xd6, 0x52, 0x3f, 0x99, 0x6e, 0x2c, 0x64, 0x87, 0x53, 0xf6, 0xb9,
-  0x5b, 0xb3, 0x93, 0xd6, 0x62, 0xa6, 0x01, 0x9d, 0x2d, 0x08, 0xdd, 0xa6,
-  0xc7, 0x2b, 0x35, 0x7e, 0x75, 0x08, 0xa6, 0x53, 0x13, 0x9b, 0x8b, 0xaf,
-  0xd9, 0x4c, 0x16, 0x06, 0xb6, 0xe4, 0x35, 0xe9, 0xb4, 0x86, 0x4f, 0xd3,
-  0xd2, 0xd1, 0xd9, 0x30, 0xea, 0x9e, 0x5a, 0xf2, 0x82, 0xe0, 0x26, 0xc3,
-  0xb9, 0x40, 0x87, 0xdb, 0xb1, 0xc3, 0x1a, 0x3b, 0x6e, 0x0a, 0xa7, 0xe2,
-  0xa1, 0x31, 0x8f, 0xe7, 0xb2, 0x55, 0x1d, 0xd2, 0xfc, 0x9f, 0xba, 0xcd,
-  0x0f, 0x5a, 0xdd, 0x94, 0x1b, 0x7c, 0x29, 0xbc, 0x39, 0xd9, 0x0b, 0x19,
-  0x0c, 0x98, 0x63, 0xf3, 0x43, 0x92, 0x95, 0x8f, 0xd8, 0xf6, 0x3e, 0x1d,
-  0xe7, 0xc9, 0xf5, 0x31, 0x2d, 0xcb, 0x54, 0x8d, 0xbe, 0x18, 0xa9, 0x67,
-  0xa6, 0x02, 0x3e, 0xe7, 0x61, 0xfc, 0x93, 0x01, 0x30, 0xe3, 0x3c, 0x85,
-  0xd5, 0x65, 0x5d, 0xa6, 0x8b, 0x83, 0x1a, 0xbd, 0x6e, 0xc7, 0x34, 0x04,
-  0xca, 0xe2, 0xfa, 0x4e, 0x8d, 0xfe, 0x57, 0x3f, 0xae, 0x2e, 0xa8, 0x31,
-  0xe8, 0xe9, 0xcb, 0xfb, 0x6a, 0x9b, 0xde, 0x2c, 0xa0, 0x8f, 0xbe, 0x6e,
-  0x45, 0x36, 0x0c, 0xcc, 0xc1, 0x76, 0x04, 0x2d, 0x72, 0x00, 0xb6, 0x2e,
-  0xb0, 0xf1, 0x16, 0x93, 0xcb, 0x62, 0x14, 0xce, 0x7f, 0x6b, 0xc5, 0xd4,
-  0x0f, 0x32, 0xae, 0x0e, 0x00, 0x94, 0xc1, 0x72, 0xbd, 0x58, 0xa6, 0x55,
-  0x95, 0xe6, 0x8b, 0xbf, 0xaa, 0xd1, 0xff, 0x6c, 0x45, 0xf8, 0x20, 0xe8,
-  0x26, 0xee, 0x7b, 0x35, 0xfa, 0x3f, 0xc3, 0x71, 0x77, 0x41, 0xc3, 0xb6,
-  0xa1, 0x2a, 0x56, 0x8b, 0x06, 0x47, 0x00, 0x0c, 0xc3, 0x5e, 0x3a, 0x98,
-  0x1f, 0x00, 0x1b, 0xe2, 0x15, 0xee, 0x18, 0x82, 0xb7, 0x0b, 0x76, 0xfc,
-  0xd7, 0x64, 0x55, 0x2c, 0x33, 0xa7, 0x6e, 0x3c, 0x2a, 0x82, 0x49, 0xf5,
-  0xdc, 0xc1, 0x37, 0x00, 0x06, 0xb5, 0xb0, 0x45, 0x30, 0xa3, 0xb0, 0xbe,
-  0xda, 0xa7, 0x6c, 0x10, 0x94, 0x33, 0x3e, 0xdb, 0xa4, 0xdc, 0x15, 0xfb,
-  0x6c, 0xa5, 0x7b, 0xdc, 0xb6, 0x40, 0x3d, 0x8f, 0x8e, 0xd0, 0x20, 0xf8,
-  0x31, 0xe8, 0xbb, 0x65, 0x62, 0x0a, 0xa9, 0xd1, 0x2f, 0x5b, 0xa8, 0x1d,
-  0x08, 0xe7, 0xd1, 0xbb, 0x7f, 0x93, 0xe6, 0x17, 0x9a, 0xb1, 0x71, 0x57,
-  0x86, 0xe0, 0x2d, 0xec, 0xd4, 0x0f, 0xdc, 0xc0, 0x7c, 0x19, 0x02, 0x5f,
-  0x76, 0x60, 0x8e, 0x01, 0x8b, 0xb1, 0x8c, 0x76, 0x99, 0x92, 0xf8, 0xb7,
-  0x54, 0x56, 0x84, 0xda, 0x04, 0xc0, 0xa1, 0x06, 0x33, 0xb4, 0x64, 0xa8,
-  0xf3, 0xb0, 0xa2, 0xe3, 0xc0, 0xcd, 0x38, 0x59, 0x29, 0x25, 0x2c, 0xfd,
-  0x1a, 0x13, 0x90, 0x6b, 0xab, 0x9f, 0xec, 0x5b, 0xab, 0xe3, 0xe1, 0x40,
-  0x7e, 0x08, 0x7b, 0xd0, 0xc5, 0xe6, 0x6a, 0x05, 0xca, 0xce, 0xd3, 0x43,
-  0x52, 0xe1, 0x4d, 0x61, 0x4c, 0x5f, 0x4d, 0x5e, 0x94, 0x45, 0xf9, 0x86,
-  0x70, 0x68, 0x25, 0x6e, 0x87, 0x76, 0xb3, 0xf1, 0x01, 0x8f, 0xe8, 0x17,
-  0xc7, 0x2a, 0xad, 0x16, 0x87, 0x32, 0xdb, 0xa5, 0x0b, 0xd0, 0x4f, 0x16,
-  0xd6, 0xeb, 0xa1, 0x62, 0x83, 0x48, 0xb3, 0x04, 0x03, 0xf3, 0xf5, 0xc8,
-  0xe7, 0x31, 0x00, 0x42, 0x89, 0x8b, 0xd5, 0x7a, 0x61, 0x5c, 0x34, 0xaa,
-  0xa1, 0xd8, 0xe9, 0x1f, 0x74, 0xb7, 0xd1, 0xf1, 0x3a, 0x68, 0xd1, 0x3a,
-  0x95, 0xad, 0xc9, 0xe9, 0xdb, 0xf1, 0xdd, 0x5b, 0xfc, 0xf7, 0x9e, 0xfe,
-  0xfd, 0xfe, 0xed, 0xcc, 0xb1, 0x82, 0x50, 0x37, 0x9f, 0x4e, 0x0e, 0x54,
-  0x0b, 0x5e, 0x62, 0xf1, 0x87, 0x46, 0xde, 0xcf, 0x82, 0x02, 0xe3, 0xfe,
-  0x02, 0x8d, 0xad, 0x86, 0x94, 0x88, 0x46, 0xe2, 0x44, 0x6f, 0xb8, 0xde,
-  0xce, 0x45, 0x3b, 0xc7, 0x73, 0xe7, 0x0e, 0xb4, 0x31, 0x61, 0xeb, 0xdd,
-  0xa1, 0xb6, 0x33, 0xd3, 0x05, 0x53, 0x6b, 0x4d, 0xa7, 0x64, 0xa4, 0x9a,
-  0x83, 0x75, 0x75, 0x2f, 0x61, 0xe3, 0x17, 0x19, 0x1a, 0x31, 0x13, 0xea,
-  0x74, 0x9b, 0xda, 0x12, 0x47, 0xbd, 0xb9, 0x6f, 0x1a, 0xe0, 0x46, 0xa7,
-  0x4e, 0x38, 0x92, 0x3a, 0x2c, 0xca, 0xca, 0xc5, 0x74, 0x04, 0x25, 0x47,
-  0xb3, 0x91, 0xa3, 0x8f, 0x1a, 0x85, 0xb1, 0x99, 0xb9, 0xcd, 0x89, 0x80,
-  0x22, 0xe6, 0x36, 0x18, 0x55, 0x34, 0xcb, 0x3f, 0x31, 0xda, 0x0a, 0x3b,
-  0x80, 0x8e, 0xc4, 0x4b, 0xd7, 0x24, 0x25, 0xef, 0xbc, 0x7f, 0xc8, 0x38,
-  0x0f, 0x16, 0x79, 0x10, 0x38, 0x52, 0x6b, 0x3c, 0xd8, 0x5b, 0x8d, 0xa1,
-  0xe8, 0x63, 0x4a, 0x54, 0xea, 0x5e, 0x52, 0x6b, 0x72, 0x74, 0x46, 0xfc,
-  0xc8, 0x71, 0xad, 0x89, 0xf4, 0xb0, 0x1d, 0x31, 0x3d, 0x60, 0x4e, 0xc0,
-  0x82, 0xe9, 0x8d, 0x51, 0xee, 0x1e, 0x9f, 0x7a, 0x36, 0x60, 0x9c, 0xde,
-  0x51, 0x5e, 0x97, 0xa3, 0x0f, 0x9b, 0x8b, 0x5d, 0x86, 0xf8, 0x95, 0xe1,
-  0x93, 0xfd, 0xcc, 0x3c, 0xde, 0x98, 0xce, 0x98, 0xc2, 0x36, 0xad, 0x44,
-  0xcf, 0xda, 0xdf, 0xc2, 0x5c, 0x4f, 0xf7, 0xc5, 0xf1, 0x7a, 0xab, 0xf4,
-  0xc0, 0x56, 0x18, 0x7d, 0x30, 0x3a, 0xb1, 0xea, 0xc2, 0x5a, 0xbe, 0x38,
-  0xa2, 0x66, 0x09, 0xeb, 0x35, 0xec, 0xae, 0x1d, 0x65, 0x18, 0x74, 0x46,
-  0x76, 0x65, 0x42, 0x43, 0x8f, 0xa1, 0xc0, 0xf1, 0x2c, 0x10, 0x06, 0xd1,
-  0xc3, 0xef, 0x71, 0x99, 0xd6, 0x63, 0xf5, 0x21, 0x3e, 0x15, 0x69, 0xb0,
-  0x9d, 0xd8, 0x80, 0x66, 0xfd, 0x3c, 0xa5, 0xb7, 0x4b, 0x0d, 0xde, 0xea,
-  0x61, 0x98, 0x38, 0x9b, 0x18, 0x97, 0xb2, 0x43, 0xfb, 0x6e, 0x99, 0xf9,
-  0xe8, 0x44, 0x85, 0x61, 0x95, 0x86, 0xd0, 0x35, 0x8c, 0xaa, 0x18, 0x4d,
-  0xd3, 0x91, 0x87, 0x22, 0x92, 0x05, 0xd0, 0xd9, 0xf0, 0x58, 0x1c, 0xb3,
-  0x16, 0xfa, 0x3d, 0x4b, 0xca, 0xeb, 0xbc, 0xa8, 0x6b, 0xdc, 0xf5, 0xea,
-  0x25, 0xc3, 0x33, 0xa3, 0xe8, 0x98, 0x75, 0xda, 0x1d, 0x8b, 0x2b, 0x37,
-  0x4f, 0x4d, 0x09, 0x88, 0x9f, 0x86, 0x19, 0x2d, 0x09, 0xd2, 0xb7, 0x58,
-  0x52, 0x5d, 0x8e, 0xc9, 0xd2, 0xec, 0xe9, 0x61, 0xef, 0x85, 0xdf, 0x08,
-  0x28, 0x38, 0x4d, 0xf0, 0x77, 0xcf, 0xef, 0x12, 0xf5, 0x2e, 0xa1, 0x7d,
-  0x33, 0xfc, 0x19, 0x29, 0xac, 0x83, 0x90, 0x52, 0xfd, 0xf0, 0x4b, 0x9f,
-  0x94, 0xf5, 0x21, 0xf1, 0x31, 0x78, 0x85, 0xdd, 0x53, 0x42, 0x3a, 0x66,
-  0xca, 0x76, 0xc9, 0x75, 0x3a, 0x5f, 0x15, 0x47, 0x0c, 0x9d, 0xf3, 0x44,
-  0x3d, 0x13, 0x9f, 0x88, 0x4f, 0xa1, 0x3b, 0xb3, 0x9a, 0x4e, 0x4b, 0x08,
-  0x01, 0xba, 0x97, 0x26, 0xea, 0xfc, 0x7a, 0x7f, 0x3c, 0x40, 0x7f, 0xab,
-  0x4d, 0x46, 0xa1, 0x2f, 0x4c, 0xe7, 0xe1, 0xcb, 0xb9, 0xfe, 0x88, 0xdf,
-  0xb8, 0xc7, 0xc4, 0x91, 0x78, 0xbf, 0xda, 0xe0, 0x81, 0xd6, 0x9c, 0xa0,
-  0xf6, 0xc7, 0xdd, 0x13, 0xfd, 0xc1, 0xa5, 0x7b, 0x97, 0xdc, 0x15, 0xc7,
-  0x7a, 0xf1, 0x6e, 0x0d, 0xff, 0x93, 0x6a, 0x46, 0xb4, 0x96, 0x1d, 0xb2,
-  0xf5, 0x2c, 0x28, 0xde, 0x43, 0xe5, 0x3a, 0xa9, 0x93, 0x38, 0x89, 0xf8,
-  0xe5, 0x03, 0xd0, 0x87, 0x68, 0xba, 0x89, 0xf3, 0xab, 0xb5, 0x55, 0xfe,
-  0xc4, 0x84, 0x55, 0x98, 0x56, 0xc7, 0xcd, 0xc6, 0x78, 0x3c, 0x6b, 0x22,
-  0xfc, 0xe1, 0xd0, 0x9f, 0x08, 0x45, 0x9d, 0xee, 0x0e, 0x84, 0x87, 0xf8,
-  0x09, 0xcb, 0x86, 0xa7, 0x75, 0xf0, 0x9e, 0x85, 0xd2, 0x98, 0x6b, 0xa5,
-  0xc5, 0xe1, 0xe6, 0x3a, 0x20, 0x1d, 0xde, 0x8c, 0x82, 0x57, 0x87, 0xfd,
-  0xb5, 0xf6, 0x5c, 0xb2, 0x2d, 0x0a, 0x09, 0x31, 0x4e, 0x86, 0x6d, 0x7d,
-  0xe2, 0x76, 0x47, 0x50, 0xd8, 0x7a, 0xda, 0x60, 0x94, 0xe3, 0x51, 0x05,
-  0x5b, 0x76, 0x00, 0xdf, 0x26, 0x24, 0xae, 0x97, 0x12, 0x51, 0x96, 0x02,
-  0x39, 0x8d, 0xd6, 0x09, 0x6c, 0x2e, 0xe1, 0x2b, 0x7c, 0xac, 0x8a, 0x62,
-  0x8f, 0x7f, 0xb1, 0x2d, 0xd3, 0x19, 0x9e, 0x3c, 0x94, 0x35, 0x1b, 0x49,
-  0x65, 0xaa, 0xd3, 0xe9, 0x30, 0x46, 0x2d, 0xa0, 0x6b, 0xea, 0x00, 0x71,
-  0x9f, 0x93, 0x87, 0x6a, 0xb2, 0x37, 0xb5, 0xe0, 0x02, 0x02, 0xf2, 0xbe,
-  0x1a, 0x9d, 0x3b, 0x47, 0x46, 0xba, 0x7f, 0x60, 0x6d, 0x48, 0x76, 0x74,
-  0x84, 0xea, 0xcd, 0xf6, 0x4d, 0xb9, 0xab, 0xad, 0xab, 0x80, 0x84, 0x66,
-  0xd0, 0x65, 0x8a, 0x7c, 0xbd, 0x90, 0x49, 0x30, 0xc2, 0x6c, 0x06, 0x35,
-  0x6e, 0x63, 0x71, 0x3c, 0xa1, 0x17, 0xd5, 0x21, 0x5b, 0x55, 0xd9, 0xf7,
-  0xa9, 0x7a, 0xb7, 0x86, 0xff, 0x01, 0x99, 0xf0, 0xfd, 0xfb, 0xb4, 0x2c,
-  0x92, 0xbb, 0xac, 0x7a, 0x21, 0xc6, 0x0b, 0x89, 0xa2, 0x07, 0x08, 0xfc,
-  0x81, 0x9a, 0x59, 0xc2, 0xf6, 0xd7, 0x2b, 0x50, 0x92, 0x8b, 0x59, 0xb3,
-  0x0a, 0x7a, 0xaf, 0xa8, 0x71, 0x6a, 0x99, 0xac, 0xde, 0x5c, 0x53, 0xa8,
-  0x36, 0xf5, 0x67, 0xf4, 0x40, 0xa8, 0x31, 0xee, 0x5c, 0xba, 0x87, 0xe6,
-  0xaf, 0xa0, 0x37, 0x37, 0xc5, 0x1e, 0x2f, 0x0c, 0x61, 0x9c, 0x9a, 0xfc,
-  0xec, 0xe2, 0x19, 0x7c, 0xc2, 0x37, 0x15, 0x6c, 0x0d, 0x52, 0x75, 0x71,
-  0xfe, 0x4c, 0x69, 0x42, 0xcf, 0xde, 0x87, 0x50, 0xef, 0xa5, 0xa1, 0x36,
-  0x42, 0xee, 0x80, 0x5a, 0xc2, 0x7e, 0x44, 0x96, 0xed, 0x28, 0xe5, 0xc8,
-  0x55, 0x87, 0x15, 0xcd, 0x98, 0xd1, 0x58, 0x6d, 0xb2, 0xb2, 0xb2, 0xf4,
-  0x21, 0x32, 0x6b, 0x52, 0x1a, 0x6b, 0xb7, 0x13, 0xef, 0x6b, 0x70, 0x1d,
-  0x22, 0xdb, 0xd7, 0x0b, 0x8a, 0xc3, 0x86, 0xbe, 0xf5, 0xca, 0x4e, 0x59,
-  0x0c, 0x71, 0xa3, 0xbd, 0xc6, 0x09, 0x97, 0xb8, 0x4d, 0x9a, 0x9b, 0x20,
-  0x79, 0x61, 0x88, 0x1b, 0x6b, 0xed, 0xc5, 0xe0, 0xba, 0x52, 0x4c, 0x56,
-  0x52, 0x5e, 0x1f, 0x49, 0x4d, 0x80, 0x1d, 0x0f, 0x76, 0x23, 0x30, 0xab,
-  0x2e, 0x7f, 0x3e, 0x0a, 0x11, 0x9b, 0x80, 0x9d, 0x5b, 0x34, 0xa1, 0x99,
-  0x6a, 0xe0, 0x57, 0x57, 0x3d, 0xba, 0x85, 0x43, 0x2a, 0xd2, 0xa6, 0x45,
-  0x5d, 0x85, 0x77, 0x4c, 0x08, 0x8d, 0x75, 0x9a, 0xc3, 0x0e, 0x23, 0x85,
-  0x6d, 0xbb, 0x38, 0x21, 0x3b, 0x47, 0x58, 0xec, 0xaf, 0x7a, 0xc5, 0x37,
-  0x11, 0xae, 0xe8, 0xc8, 0x10, 0x4a, 0x5c, 0xc1, 0xb4, 0x06, 0x5c, 0x57,
-  0x4b, 0xd8, 0xd4, 0xd5, 0xea, 0x6a, 0x05, 0x0a, 0x63, 0xba, 0x02, 0xa2,
-  0x9c, 0x3e, 0xa7, 0x95, 0x08, 0xfe, 0x26, 0xb0, 0xd9, 0x9e, 0x6f, 0xca,
-  0x84, 0x5c, 0x9e, 0xd3, 0x27, 0xe8, 0xb1, 0x6d, 0x01, 0x60, 0xc0, 0x92,
-  0x3d, 0x48, 0x96, 0x1a, 0x76, 0x1d, 0x02, 0x12, 0x2b, 0x35, 0xb3, 0x03,
-  0x59, 0xc1, 0x2c, 0x61, 0x9f, 0x99, 0x29, 0x89, 0xa4, 0xca, 0xb9, 0xdd,
-  0x83, 0x6e, 0xae, 0xb1, 0x3a, 0x63, 0xd5, 0xe0, 0x9a, 0x3b, 0xce, 0x51,
-  0xb1, 0xc4, 0xe3, 0x40, 0xbd, 0x77, 0xf3, 0x9d, 0xbc, 0x1b, 0xa1, 0x0c,
-  0xb2, 0x3b, 0xe3, 0x20, 0x10, 0x1e, 0xb5, 0xbf, 0xc0, 0xb3, 0x76, 0x4d,
-  0x90, 0x2d, 0x38, 0x22, 0x6a, 0x47, 0x16, 0x91, 0x50, 0xe9, 0x50, 0x94,
-  0x1c, 0x31, 0x50, 0x17, 0x28, 0xb7, 0xa7, 0xb2, 0x13, 0x1a, 0x95, 0xc7,
-  0xfd, 0x1e, 0xa3, 0x3a, 0x9a, 0xc0, 0x93, 0xeb, 0x14, 0xa3, 0x50, 0xde,
-  0xa7, 0xd5, 0x9f, 0x47, 0x14, 0xb7, 0xcb, 0x81, 0xd0, 0x01, 0xa7, 0x3c,
-  0x10, 0x3e, 0xe2, 0xf4, 0x48, 0x9c, 0x8c, 0x1c, 0xf6, 0xe2, 0x66, 0x0b,
-  0x4d, 0x5d, 0x6d, 0x6f, 0xb4, 0xfc, 0x51, 0x6c, 0xcd, 0x68, 0xeb, 0x00,
-  0xbf, 0xf9, 0x43, 0x1a, 0xef, 0xa1, 0xdd, 0x94, 0x78, 0x16, 0x92, 0x60,
-  0xe0, 0xcd, 0xae, 0x0e, 0x69, 0x1b, 0x5e, 0x15, 0xa1, 0x34, 0x86, 0x32,
-  0xd6, 0x83, 0x71, 0x9c, 0xce, 0xa1, 0x6c, 0xa3, 0x73, 0x03, 0x15, 0x41,
-  0x17, 0x86, 0x49, 0xb6, 0x4a, 0xc5, 0x43, 0x41, 0x76, 0xcc, 0xf4, 0x8a,
-  0xb7, 0x57, 0xfc, 0x55, 0x4e, 0x8f, 0x78, 0x27, 0xed, 0xbf, 0x9b, 0x6b,
-  0xa1, 0xb5, 0x4b, 0x6f, 0x12, 0xd1, 0xd3, 0x35, 0x84, 0x06, 0xc1, 0x0d,
-  0x91, 0xe8, 0xad, 0x7e, 0x59, 0xc7, 0xfb, 0xdc, 0xfb, 0x40, 0x2d, 0xda,
-  0xe3, 0xc4, 0xe7, 0xdf, 0x3c, 0x6c, 0xde, 0x41, 0x3c, 0x0b, 0x11, 0x23,
-  0x9d, 0x34, 0x19, 0x33, 0xb9, 0x70, 0x65, 0xc8, 0x6a, 0x15, 0x19, 0xe1,
-  0xdd, 0x25, 0x29, 0xe1, 0xca, 0x0a, 0x53, 0x9b, 0x58, 0xfc, 0x13, 0x6a,
-  0xa3, 0xdc, 0x39, 0xa2, 0x1e, 0x92, 0x9a, 0x67, 0x34, 0x61, 0x6f, 0xef,
-  0xd0, 0x59, 0xe1, 0x58, 0x2d, 0x71, 0x7f, 0xea, 0x8e, 0xc1, 0xeb, 0x32,
-  0x3d, 0x24, 0x34, 0x35, 0x7f, 0x8d, 0x8d, 0x53, 0x8f, 0x51, 0x7b, 0xd1,
-  0xed, 0x9c, 0x69, 0xb2, 0x37, 0xf2, 0x42, 0x4d, 0x3f, 0x02, 0xa2, 0xdc,
-  0xaf, 0xac, 0x25, 0x58, 0xe5, 0x21, 0x54, 0x27, 0x9c, 0x83, 0x92, 0xea,
-  0xbe, 0x02, 0xbd, 0x6d, 0x6e, 0x61, 0x41, 0x45, 0x62, 0x4d, 0x91, 0xd7,
-  0x14, 0x11, 0x11, 0xa7, 0x63, 0xad, 0x53, 0x58, 0x9d, 0xe4, 0xd2, 0x41,
-  0x63, 0xd5, 0xc7, 0x40, 0x9f, 0x74, 0x60, 0x78, 0x64, 0x41, 0x23, 0x83,
-  0x01, 0xa2, 0x3b, 0x44, 0x75, 0x56, 0x1f, 0x81, 0xa9, 0xa8, 0x9b, 0x12,
-  0xda, 0x09, 0xcb, 0xce, 0x8f, 0xc7, 0x4b, 0xa2, 0xc1, 0x86, 0x34, 0xda,
-  0x88, 0xb3, 0x56, 0xf0, 0x37, 0x60, 0x4c, 0x30, 0x45, 0xda, 0x2a, 0x9b,
-  0xe6, 0x79, 0x9c, 0x9e, 0xbc, 0x80, 0xdd, 0xcc, 0xc8, 0x7e, 0x0d, 0x90,
-  0x88, 0x9f, 0x87, 0x0c, 0x67, 0x79, 0x2d, 0xee, 0xf6, 0x46, 0x00, 0x24,
-  0x72, 0x6a, 0x77, 0xc0, 0x4f, 0xb3, 0xe0, 0x6e, 0xc2, 0x2c, 0xd2, 0x6d,
-  0xda, 0x33, 0xa0, 0x97, 0x2a, 0x73, 0xd8, 0x06, 0xff, 0x59, 0x40, 0x3d,
-  0x6f, 0x5a, 0x3b, 0x51, 0x4f, 0x1c, 0xbe, 0xc7, 0x22, 0x9b, 0x7b, 0x63,
-  0x57, 0x19, 0x23, 0x25, 0x97, 0x6b, 0xbc, 0x6a, 0xa3, 0x31, 0x51, 0xa7,
-  0x63, 0x84, 0x23, 0x63, 0x33, 0xe1, 0xf7, 0xe6, 0x5a, 0x01, 0x0f, 0x9d,
-  0x37, 0x23, 0x08, 0xcb, 0x42, 0x93, 0x2c, 0xed, 0x6b, 0x05, 0x96, 0xf6,
-  0xa3, 0xf6, 0xa4, 0xce, 0xcc, 0x0e, 0x40, 0xda, 0x16, 0xec, 0x04, 0x4e,
-  0xc7, 0xf0, 0xaf, 0x0b, 0x81, 0xbd, 0x1c, 0xaa, 0x71, 0x68, 0x3a, 0xf4,
-  0x1e, 0xdd, 0x2b, 0x41, 0x2d, 0xd5, 0x9b, 0x2e, 0x3c, 0x33, 0x03, 0xd1,
-  0x57, 0x04, 0x37, 0x0e, 0xb4, 0x9d, 0x39, 0xb3, 0xcc, 0xec, 0xf0, 0x94,
-  0x88, 0x19, 0x92, 0x19, 0x86, 0xff, 0x65, 0xcd, 0x08, 0x64, 0x0f, 0xbf,
-  0xc6, 0x89, 0x6b, 0x16, 0x7c, 0x03, 0x49, 0x80, 0xc0, 0xaf, 0xc6, 0x4a,
-  0x8c, 0x91, 0x9a, 0xa1, 0xd1, 0x59, 0xbd, 0x5d, 0x10, 0x78, 0xe9, 0xcb,
-  0x5d, 0x2b, 0x8e, 0x45, 0x0c, 0x06, 0x05, 0xe3, 0xe2, 0xba, 0xb5, 0x18,
-  0x3b, 0x73, 0x66, 0xfb, 0x75, 0x71, 0x5b, 0xcd, 0x7f, 0xf7, 0xd5, 0x13,
-  0x3b, 0xf1, 0x9e, 0xe0, 0x82, 0x06, 0xed, 0xdb, 0xcc, 0xe1, 0xf3, 0xf3,
-  0xcb, 0x27, 0x3a, 0x78, 0xb3, 0xb7, 0x38, 0xa0, 0xbc, 0xc0, 0xd6, 0xd3,
-  0x29, 0x29, 0x0a, 0x8d, 0xc6, 0x22, 0x01, 0x4a, 0xe2, 0xa1, 0xb6, 0x5d,
-  0xe4, 0x5f, 0x3b, 0x45, 0xc1, 0x8a, 0x85, 0x30, 0x68, 0x2c, 0x2d, 0x24,
-  0xe6, 0xea, 0xa9, 0x99, 0x5e, 0xe4, 0xe6, 0x4c, 0xf7, 0x93, 0x0b, 0x4e,
-  0x49, 0xa4, 0x47, 0xcd, 0x84, 0x5b, 0xc5, 0xd7, 0xea, 0x94, 0x1d, 0xa9,
-  0xc2, 0xcf, 0x6b, 0xf9, 0x3c, 0xc6, 0xfa, 0x17, 0x22, 0x92, 0x24, 0xdd,
-  0x8f, 0x11, 0x5b, 0x3c, 0x6f, 0x0a, 0x93, 0xf3, 0xc8, 0x08, 0x16, 0xa2,
-  0x9d, 0x07, 0x19, 0xe9, 0xc4, 0x9f, 0xee, 0xe8, 0x8a, 0x6b, 0x98, 0x48,
-  0x79, 0xfa, 0xae, 0x5c, 0x86, 0xf1, 0xbb, 0x0a, 0xf6, 0x5f, 0x73, 0x54,
-  0xe8, 0xb9, 0xa7, 0xe2, 0xae, 0x80, 0x78, 0x4c, 0x85, 0xf6, 0xf1, 0x75,
-  0x99, 0xdc, 0xc2, 0x1f, 0x44, 0x8c, 0x69, 0x7f, 0x70, 0x81, 0xe3, 0x5a,
-  0xc9, 0xbb, 0xcb, 0xf5, 0x1b, 0x1b, 0x03, 0xda, 0xc5, 0x6d, 0xb6, 0xae,
-  0xb7, 0x30, 0xc5, 0x62, 0x9b, 0x8b, 0x19, 0xdd, 0x84, 0x6b, 0x14, 0xd9,
-  0x92, 0x73, 0x36, 0x96, 0x69, 0xdb, 0x73, 0x30, 0x55, 0x75, 0x6b, 0xc5,
-  0xeb, 0x0c, 0x56, 0x1d, 0x24, 0xaf, 0x52, 0x67, 0x61, 0xe1, 0xa8, 0x0e,
-  0x31, 0xa7, 0x56, 0x31, 0x8f, 0x54, 0x3c, 0xe6, 0xf3, 0x6d, 0x9a, 0xac,
-  0x83, 0x7d, 0x45, 0x4b, 0x17, 0x80, 0xb6, 0x57, 0x24, 0x6b, 0xd8, 0x30,
-  0xc3, 0x7b, 0xb3, 0x45, 0xd8, 0x81, 0x82, 0x9c, 0x1d, 0x80, 0x05, 0x69,
-  0x30, 0xe6, 0x4b, 0x8c, 0x3c, 0xae, 0xd5, 0x12, 0xc3, 0x99, 0x33, 0x5e,
-  0xd9, 0x02, 0x4e, 0x35, 0x4a, 0x4b, 0xa5, 0x25, 0x88, 0x28, 0x35, 0x89,
-  0xa3, 0xa2, 0xb8, 0x1a, 0x0a, 0x5a, 0x20, 0x7a, 0x94, 0x18, 0x04, 0xf1,
-  0xa6, 0x53, 0x2d, 0xe5, 0xec, 0x6d, 0x29, 0xa3, 0xbf, 0x90, 0x81, 0xc4,
-  0xd1, 0x5f, 0xf0, 0xb7, 0xab, 0xbf, 0xe8, 0xbb, 0x69, 0xad, 0xfa, 0x8b,
-  0x30, 0xfb, 0x07, 0x55, 0x63, 0x4e, 0x8c, 0x17, 0xb6, 0xe9, 0x2e, 0x7b,
-  0xe3, 0x12, 0x8d, 0x1b, 0x9f, 0xf3, 0x97, 0x05, 0x4b, 0xbc, 0x0a, 0x37,
-  0xc0, 0x67, 0x8a, 0x86, 0x0a, 0x4d, 0xda, 0x3c, 0xd0, 0xe8, 0x3c, 0x07,
-  0x04, 0x17, 0xea, 0x1a, 0xf0, 0x1c, 0x2b, 0xd4, 0x21, 0xb4, 0x60, 0x75,
-  0x70, 0xb1, 0x78, 0xc8, 0x76, 0xf6, 0x36, 0xdc, 0x40, 0xdd, 0xe9, 0xc4,
-  0x09, 0xe3, 0x85, 0xc5, 0xb9, 0xcd, 0x7e, 0x04, 0x33, 0xea, 0x05, 0xcb,
-  0x60, 0x8f, 0x9c, 0x65, 0xc7, 0x2e, 0x77, 0xc6, 0x03, 0x84, 0x97, 0xef,
-  0xbe, 0xf5, 0x55, 0x5f, 0x10, 0x75, 0x97, 0x30, 0x76, 0x18, 0xf1, 0xaa,
-  0xa6, 0x06, 0x09, 0x99, 0xd3, 0x31, 0x2f, 0xbf, 0xcc, 0xcc, 0x1a, 0x4e,
-  0x1b, 0x48, 0xa5, 0x94, 0xef, 0x69, 0x69, 0x71, 0x85, 0xb3, 0xcd, 0x98,
-  0x20, 0xc6, 0x7a, 0x36, 0xad, 0x17, 0xd0, 0xbd, 0x1d, 0x05, 0xec, 0x30,
-  0x9d, 0xd9, 0xa9, 0x60, 0xe0, 0xa7, 0xa1, 0x44, 0x32, 0x5f, 0xb8, 0x05,
-  0xba, 0x01, 0xd6, 0x77, 0x97, 0x7d, 0xa8, 0x5f, 0xc2, 0x57, 0x77, 0x7f,
-  0xf1, 0xea, 0x5d, 0x72, 0x7e, 0x8d, 0xf7, 0x15, 0xe1, 0xfd, 0x2b, 0x71,
-  0xad, 0x56, 0x41, 0x7d, 0x6d, 0xbc, 0x83, 0xd2, 0x9d, 0xf8, 0xa7, 0xc2,
-  0x1c, 0x7c, 0x21, 0xff, 0x80, 0xdc, 0xf8, 0x92, 0xc6, 0xc2, 0xb2, 0xba,
-  0x0e, 0xbb, 0x60, 0xc7, 0xf9, 0x01, 0x2c, 0xf3, 0x03, 0x54, 0xee, 0x13,
-  0x1d, 0x06, 0xae, 0x5d, 0xed, 0x76, 0xe5, 0x47, 0xab, 0x3e, 0x2c, 0xb7,
-  0x07, 0xd8, 0x96, 0x19, 0x9a, 0xa3, 0xe3, 0x66, 0x6a, 0x03, 0xef, 0xdb,
-  0x86, 0x23, 0x06, 0x63, 0x03, 0xa9, 0x65, 0x4d, 0xeb, 0x0c, 0xf8, 0x80,
-  0x13, 0x40, 0xdf, 0xfc, 0x6c, 0x4c, 0x4a, 0x47, 0x3b, 0x72, 0x3a, 0xda,
-  0xd7, 0xfe, 0x5c, 0xed, 0x4e, 0x6c, 0xc1, 0xc0, 0x4c, 0x6c, 0x01, 0x86,
-  0x07, 0x6b, 0xf7, 0x35, 0x45, 0xac, 0x1a, 0xe1, 0xbe, 0x35, 0x5b, 0x75,
-  0x15, 0xa1, 0x42, 0xe6, 0x9c, 0x2b, 0x22, 0x02, 0x95, 0xfb, 0x29, 0xee,
-  0x03, 0xc6, 0xdc, 0xea, 0x05, 0x1a, 0xb2, 0xd7, 0x59, 0xa9, 0xc2, 0x61,
-  0xb0, 0x93, 0xe3, 0xef, 0x50, 0x99, 0x37, 0x8c, 0x8d, 0x9a, 0xa4, 0xa2,
-  0x98, 0x2c, 0x51, 0xa1, 0x34, 0x69, 0x97, 0x27, 0x1d, 0x12, 0xe5, 0x2c,
-  0x32, 0x16, 0x9e, 0x36, 0x2e, 0x11, 0x25, 0x87, 0x6a, 0xe3, 0x6d, 0x35,
-  0x8a, 0x7a, 0xed, 0x88, 0xa6, 0xb6, 0x8e, 0x8e, 0x15, 0xc7, 0x7e, 0x72,
-  0xcb, 0x46, 0xfb, 0x6d, 0x80, 0x28, 0xf4, 0x25, 0x61, 0x97, 0x2c, 0x14,
-  0xa3, 0x92, 0x30, 0xfa, 0xcc, 0x15, 0x3e, 0x9e, 0x76, 0xcf, 0x32, 0xa2,
-  0xa9, 0xe1, 0x4b, 0x89, 0xd1, 0xc8, 0x51, 0x8a, 0x42, 0x6d, 0x7d, 0xe1,
-  0x28, 0x46, 0xa1, 0xca, 0xce, 0x4a, 0x13, 0xab, 0x34, 0xa7, 0xa0, 0x1b,
-  0x95, 0x97, 0xeb, 0x08, 0x26, 0xbb, 0x61, 0xf8, 0xe0, 0xb8, 0x2e, 0xd7,
-  0x1f, 0x12, 0xdb, 0xf3, 0xc1, 0xd8, 0x9e, 0xc7, 0xb0, 0x79, 0x3d, 0xf6,
-  0x9e, 0xb8, 0xec, 0x21, 0x0b, 0x36, 0xed, 0x27, 0x65, 0x2a, 0x03, 0xec,
-  0x9e, 0xb3, 0xf4, 0x59, 0x50, 0x3e, 0x80, 0xf5, 0xa4, 0xcb, 0x72, 0x12,
-  0x98, 0xaf, 0xfa, 0xcd, 0x21, 0x1d, 0xa6, 0x10, 0xe5, 0xe8, 0x89, 0xef,
-  0x6d, 0x0d, 0x09, 0x17, 0x5c, 0x6b, 0x10, 0xf9, 0x01, 0xc6, 0x90, 0x07,
-  0xd3, 0x15, 0xd8, 0x38, 0x1c, 0xbf, 0xf4, 0xd0, 0xc8, 0xf1, 0x09, 0x52,
-  0xc7, 0x7a, 0xfd, 0x50, 0x0b, 0x46, 0x9f, 0xf5, 0xa2, 0x53, 0x44, 0x3e,
-  0xc8, 0x58, 0xf1, 0x40, 0x43, 0xc5, 0x83, 0x8c, 0x14, 0xba, 0x4b, 0xd8,
-  0x34, 0xce, 0x01, 0x51, 0xbc, 0x78, 0x2f, 0x67, 0xcd, 0x33, 0x00, 0x53,
-  0x5c, 0x8d, 0x40, 0x8d, 0x33, 0xa9, 0x5f, 0x1d, 0xbb, 0x84, 0x9d, 0x32,
-  0xcf, 0xff, 0x31, 0x65, 0xfe, 0x7f, 0x98, 0x32, 0xa2, 0x35, 0x3c, 0x68,
-  0xe6, 0x3c, 0xff, 0xc7, 0xcc, 0xf9, 0x80, 0x33, 0xc7, 0x9b, 0x3a, 0xb2,
-  0x90, 0x36, 0xa6, 0x8e, 0x19, 0x00, 0x86, 0x71, 0xef, 0xd4, 0xcb, 0xcd,
-  0x3a, 0x5a, 0x58, 0xad, 0xae, 0xdd, 0xc0, 0x1b, 0x9d, 0x92, 0x83, 0xf0,
-  0x3e, 0x8f, 0xe0, 0xa5, 0xd3, 0x4c, 0xed, 0xa6, 0xb6, 0xb8, 0x2e, 0x93,
-  0xc3, 0x36, 0x5b, 0x55, 0x68, 0xc8, 0xb0, 0xf5, 0xca, 0x6c, 0x3d, 0x2e,
-  0x19, 0x61, 0x5e, 0xd5, 0xd6, 0x9a, 0x15, 0x58, 0x1f, 0x68, 0xd6, 0x1a,
-  0x03, 0x44, 0x8e, 0xfb, 0xba, 0x9c, 0xee, 0x72, 0xf3, 0x2c, 0x75, 0x26,
-  0x41, 0x4e, 0x17, 0xea, 0xf0, 0x16, 0x02, 0x39, 0xbd, 0xe5, 0x33, 0x9e,
-  0xf4, 0x27, 0x62, 0xa0, 0xc8, 0xa3, 0x8d, 0x8f, 0x34, 0xfd, 0x7d, 0xec,
-  0x48, 0xce, 0xde, 0x8d, 0x14, 0xc5, 0x05, 0xe9, 0x1b, 0xda, 0xa9, 0xdd,
-  0xb5, 0x20, 0x1a, 0x75, 0x3c, 0xec, 0x04, 0x1b, 0x46, 0xc0, 0x0b, 0xf2,
-  0xa3, 0xa1, 0x57, 0x36, 0x4e, 0x8e, 0x9c, 0x5d, 0x3d, 0x60, 0x07, 0x48,
-  0x62, 0x64, 0xc8, 0x06, 0x50, 0x79, 0x22, 0x12, 0x3a, 0x3c, 0x6c, 0x50,
-  0x74, 0x4b, 0xaa, 0x0b, 0x36, 0x2c, 0x57, 0xf0, 0xb2, 0x94, 0x63, 0x69,
-  0x91, 0x3a, 0x14, 0xce, 0xa8, 0xb1, 0x15, 0x71, 0x76, 0x21, 0x78, 0xbb,
-  0xc5, 0x19, 0x7f, 0x9e, 0x87, 0x46, 0xa4, 0x34, 0xad, 0x88, 0xc3, 0x77,
-  0x21, 0x0f, 0x3c, 0x0f, 0x78, 0xcf, 0xcd, 0xc7, 0xfb, 0xec, 0x3b, 0x1e,
-  0xb2, 0xe5, 0x10, 0xc7, 0x1d, 0xda, 0x53, 0xf5, 0x98, 0x7c, 0x19, 0xf5,
-  0x7b, 0x99, 0x7c, 0xed, 0xf9, 0xc6, 0x7b, 0x58, 0x7e, 0x99, 0xb8, 0xba,
-  0xb5, 0xfe, 0x4e, 0xcb, 0xaf, 0xe7, 0x5a, 0xd8, 0x90, 0x24, 0xe2, 0x8c,
-  0xc8, 0x51, 0x3b, 0x1f, 0x28, 0x6e, 0x23, 0xc6, 0x84, 0x93, 0x87, 0x19,
-  0x12, 0x4e, 0x1c, 0xfb, 0x3c, 0xcb, 0x6c, 0xe3, 0x3c, 0x76, 0x26, 0x56,
-  0x4f, 0x3b, 0x5f, 0x64, 0x6c, 0xdd, 0x05, 0x96, 0x8d, 0x5f, 0x98, 0x72,
-  0x44, 0x8c, 0x04, 0x55, 0x71, 0x2c, 0x29, 0x65, 0x27, 0x6d, 0xef, 0xed,
-  0x7b, 0x64, 0x13, 0xfb, 0xb6, 0xd7, 0xc6, 0xd0, 0x6f, 0x16, 0x88, 0x11,
-  0x42, 0x56, 0xb8, 0x1f, 0x9f, 0x12, 0xeb, 0x73, 0xe7, 0x2b, 0x25, 0x28,
-  0x1e, 0xf8, 0xfc, 0x95, 0x0d, 0x66, 0xf8, 0xfb, 0x7d, 0x87, 0x56, 0x39,
-  0x6c, 0x14, 0x8c, 0x2f, 0x0f, 0x6e, 0xc4, 0x44, 0xd4, 0x18, 0x5e, 0xcb,
-  0x8e, 0x25, 0x59, 0x53, 0xc2, 0xfd, 0x24, 0xce, 0xba, 0x85, 0x51, 0xd0,
-  0x7e, 0xe0, 0x12, 0x02, 0xd3, 0xad, 0xb9, 0x74, 0x3a, 0x91, 0x16, 0x0c,
-  0xb7, 0x47, 0xcd, 0xf4, 0xc1, 0x39, 0x6c, 0xb0, 0x66, 0x60, 0x71, 0xa0,
-  0x84, 0xa2, 0x44, 0x78, 0xab, 0x20, 0x5d, 0x34, 0x5f, 0x65, 0x20, 0x13,
-  0xd1, 0xed, 0xef, 0x1f, 0xca, 0xf9, 0x7f, 0x1f, 0xe5, 0xdc, 0x2c, 0xb3,
-  0xfe, 0x10, 0x87, 0xb1, 0x19, 0x8c, 0xc2, 0x7e, 0x32, 0x54, 0x61, 0x0f,
-  0x01, 0x1f, 0xa6, 0xb0, 0x47, 0xe6, 0x65, 0xaf, 0x41, 0xf0, 0x61, 0x7a,
-  0x7b, 0x1b, 0xf8, 0x8f, 0xaf, 0xb7, 0xc3, 0x3c, 0xad, 0x41, 0xa8, 0xfe,
-  0xc0, 0xb9, 0xc5, 0x23, 0xc1, 0xf3, 0xa8, 0x52, 0xde, 0xaf, 0x7f, 0x4c,
-  0xbe, 0xff, 0x67, 0x8d, 0x49, 0xde, 0xd8, 0x7b, 0x1b, 0x63, 0x25, 0xba,
-  0xd5, 0x8f, 0x3a, 0x89, 0xe2, 0xd5, 0x76, 0x7b, 0xe4, 0xb4, 0x52, 0xd9,
-  0xe5, 0x14, 0xd3, 0x5a, 0x28, 0x3e, 0xff, 0xfe, 0x7e, 0x26, 0x27, 0x3c,
-  0x17, 0x5c, 0x90, 0x29, 0x9d, 0xf9, 0x5b, 0xcf, 0xba, 0x87, 0x56, 0xa4,
-  0x2b, 0x71, 0x75, 0x37, 0xb1, 0xc6, 0x9b, 0x7b, 0x3a, 0x3a, 0xac, 0xf4,
-  0x2f, 0x92, 0xb2, 0x2e, 0xf6, 0xea, 0x8f, 0x59, 0x0e, 0xed, 0x3f, 0xad,
-  0x30, 0xd2, 0xda, 0xe1, 0x58, 0x9b, 0x30, 0x28, 0xe7, 0x8f, 0x82, 0x30,
-  0x28, 0x63, 0xaa, 0x10, 0x41, 0xa6, 0xc0, 0xe8, 0x8e, 0x37, 0x76, 0x7d,
-  0xa7, 0x30, 0x92, 0xa7, 0x84, 0x18, 0x0d, 0x26, 0xdf, 0x41, 0x79, 0xb1,
-  0x9e, 0x36, 0x2a, 0x25, 0x84, 0xd9, 0x3e, 0x9d, 0x73, 0x54, 0x32, 0x65,
-  0x7b, 0x56, 0x6e, 0xa4, 0x8d, 0x79, 0x46, 0x68, 0x1f, 0x34, 0x3d, 0x45,
-  0x51, 0x6b, 0xc0, 0xf3, 0xbe, 0x4a, 0xfc, 0x93, 0x4c, 0x05, 0x21, 0x1c,
-  0x8f, 0xa7, 0x01, 0x23, 0xa7, 0x9a, 0x28, 0x8c, 0xee, 0x43, 0xef, 0x02,
-  0xdd, 0xb8, 0xc2, 0x90, 0x89, 0x09, 0x23, 0xb0, 0x94, 0x71, 0x93, 0x8c,
-  0x1f, 0x38, 0xc6, 0x44, 0xd5, 0x3e, 0x3b, 0xd6, 0xe9, 0x7c, 0x79, 0x98,
-  0x05, 0x62, 0x03, 0xfb, 0xe5, 0xe2, 0x5f, 0x9e, 0x89, 0xde, 0x14, 0x20,
-  0x29, 0x23, 0x48, 0xca, 0x26, 0x92, 0xd2, 0x47, 0xe2, 0xc6, 0x4d, 0xac,
-  0x25, 0xb4, 0x1c, 0xca, 0x12, 0xe9, 0x0e, 0xba, 0xf6, 0xf6, 0x4c, 0xb9,
-  0x3e, 0xcd, 0x53, 0x18, 0x36, 0xba, 0xc1, 0x94, 0xda, 0xaf, 0xfa, 0x1e,
-  0xaa, 0xe4, 0xc6, 0x70, 0xfe, 0x93, 0xfb, 0x17, 0x26, 0xca, 0xca, 0x35,
-  0x6c, 0x81, 0xee, 0x9d, 0xf0, 0x46, 0x1e, 0x30, 0x82, 0x2d, 0x8b, 0xf5,
-  0x7d, 0xec, 0x23, 0x30, 0xae, 0x09, 0xa4, 0x12, 0xfb, 0xec, 0x54, 0x89,
-  0x61, 0xef, 0x3a, 0x41, 0x0c, 0x59, 0xf3, 0x3b, 0x37, 0x7c, 0xd0, 0x59,
-  0xe5, 0xde, 0xf1, 0xea, 0x28, 0xed, 0x76, 0x11, 0xe0, 0xe8, 0x2f, 0x81,
-  0xff, 0x01, 0xa0, 0x56, 0x61, 0xcc, 0x35, 0x48, 0xea, 0xb5, 0x2b, 0x1b,
-  0x40, 0xfd, 0x1d, 0x46, 0x23, 0x5f, 0xd3, 0x09, 0x7f, 0x99, 0xd6, 0xc7,
-  0x72, 0xaf, 0x12, 0xc5, 0xf5, 0x9c, 0xbf, 0x9b, 0x8c, 0xcc, 0xe1, 0xa8,
-  0xe1, 0xab, 0xd3, 0x33, 0x3b, 0x40, 0xb3, 0x5e, 0xca, 0xcb, 0x08, 0x84,
-  0xbe, 0x5e, 0xac, 0x83, 0xfa, 0x19, 0x42, 0x64, 0xbc, 0xf0, 0x92, 0x77,
-  0x91, 0xc2, 0xee, 0x08, 0x7a, 0x5f, 0x8e, 0xbd, 0x75, 0x5a, 0xc4, 0x33,
-  0x19, 0x2c, 0x18, 0x7d, 0x29, 0xd7, 0x8a, 0x1f, 0x37, 0x04, 0xa9, 0xb9,
-  0xb5, 0x6c, 0xb0, 0x9b, 0x79, 0x85, 0xa1, 0xd4, 0x30, 0x70, 0x94, 0x04,
-  0x59, 0xd4, 0xac, 0x68, 0x59, 0xed, 0xd4, 0x0f, 0xc2, 0x28, 0xa8, 0xec,
-  0x9d, 0x1e, 0xbc, 0x5f, 0x6c, 0xae, 0x7e, 0x52, 0x60, 0xec, 0x47, 0x4e,
-  0x57, 0x6b, 0xc7, 0xfa, 0xcf, 0x77, 0x88, 0x2e, 0x2d, 0xd5, 0xa5, 0x7b,
-  0x97, 0xa2, 0x2e, 0xd4, 0xb7, 0x22, 0x90, 0x4e, 0xc9, 0xe0, 0xd6, 0x88,
-  0x81, 0x79, 0xae, 0x2f, 0x4c, 0xb2, 0xe9, 0xa1, 0x59, 0x8b, 0x33, 0x27,
-  0xb4, 0x71, 0xcf, 0x5c, 0x2c, 0xa5, 0xc1, 0x91, 0x10, 0x38, 0xf8, 0x78,
-  0x6a, 0x82, 0x43, 0x32, 0xca, 0xda, 0x43, 0xc1, 0x94, 0xf6, 0xe3, 0x91,
-  0xd0, 0x2f, 0x01, 0xc6, 0xb0, 0x43, 0x39, 0x21, 0x51, 0x5b, 0x77, 0xea,
-  0x74, 0x45, 0x5e, 0x67, 0x5a, 0xa0, 0xca, 0x41, 0x1c, 0x7e, 0x43, 0x69,
-  0xe4, 0xc4, 0x74, 0x0e, 0x3f, 0x97, 0xf6, 0xb3, 0x8d, 0xd2, 0x6c, 0x88,
-  0xa2, 0x24, 0x4f, 0x6d, 0x34, 0x71, 0x06, 0xa8, 0x16, 0x92, 0xfe, 0x7e,
-  0x34, 0x1d, 0x8a, 0xaa, 0xee, 0xea, 0x29, 0xfe, 0xfc, 0x21, 0xe8, 0xe2,
-  0x8a, 0x6b, 0x2b, 0x05, 0x0c, 0x57, 0x0a, 0x47, 0x56, 0x3e, 0x4b, 0x9e,
-  0xeb, 0xeb, 0x05, 0x2f, 0xdc, 0xff, 0x78, 0x01, 0xfe, 0xf4, 0x58, 0x17,
-  0x73, 0xdc, 0x55, 0xe3, 0xe5, 0x30, 0x13, 0x74, 0xec, 0x85, 0x44, 0x50,
-  0x70, 0x63, 0x07, 0xe4, 0xcb, 0x0d, 0xac, 0x78, 0xa7, 0xe8, 0xa0, 0x8a,
-  0x05, 0x60, 0x75, 0xa7, 0x37, 0xa3, 0x46, 0x90, 0x81, 0x7c, 0xb5, 0xf3,
-  0xc0, 0x08, 0x2f, 0xc2, 0xc5, 0x08, 0xf8, 0xaa, 0x4e, 0x6a, 0x60, 0x51,
-  0xdc, 0xb1, 0x47, 0xea, 0x37, 0x86, 0x71, 0x34, 0x17, 0xac, 0x8a, 0xdd,
-  0x81, 0x2e, 0xb6, 0x59, 0xab, 0xf8, 0x2e, 0x59, 0x81, 0xb6, 0xb6, 0xa2,
-  0x34, 0x6d, 0xf3, 0xca, 0xa0, 0x9a, 0xdf, 0x96, 0x28, 0xea, 0x4b, 0xce,
-  0xe2, 0x71, 0x7b, 0x07, 0xff, 0xb2, 0x60, 0xf9, 0x56, 0xeb, 0x0f, 0x67,
-  0xf4, 0xae, 0xb9, 0xb3, 0x50, 0x8e, 0x41, 0xc1, 0xab, 0x92, 0xb2, 0x16,
-  0x90, 0x55, 0x96, 0x52, 0x2e, 0xac, 0x60, 0x79, 0x46, 0x67, 0xdf, 0x43,
-  0xba, 0xc2, 0x64, 0xbb, 0x3e, 0x30, 0x0d, 0x50, 0xc4, 0x6c, 0x7b, 0x46,
-  0x55, 0x46, 0x4c, 0x10, 0x26, 0x92, 0xbb, 0xb3, 0xf7, 0x34, 0x67, 0x17,
-  0x65, 0x6a, 0xcf, 0x09, 0xda, 0x1b, 0x3a, 0xde, 0xc2, 0x8b, 0xe2, 0xba,
-  0x4c, 0x76, 0xa8, 0x1b, 0x99, 0x1f, 0xb3, 0x9e, 0x52, 0x15, 0x2c, 0x02,
-  0x98, 0xe0, 0x2e, 0xe7, 0xab, 0x7b, 0xce, 0xcf, 0xbe, 0x92, 0xcb, 0xa4,
-  0xac, 0xa4, 0x98, 0x3c, 0xf7, 0x95, 0x39, 0x64, 0xe9, 0x6a, 0x0b, 0x9a,
-  0x1e, 0xa9, 0xde, 0xfa, 0xb9, 0xb7, 0x9e, 0xe2, 0xce, 0x54, 0xc3, 0x8f,
-  0x7e, 0x8c, 0x27, 0xce, 0xa6, 0x62, 0x9b, 0x8f, 0xe2, 0xcf, 0x6d, 0x16,
-  0xfd, 0x16, 0x02, 0xe9, 0x87, 0xd4, 0xcc, 0x5f, 0x34, 0xce, 0x46, 0x0c,
-  0x13, 0xc2, 0xeb, 0x30, 0xf1, 0x3a, 0xe5, 0x40, 0x0a, 0xd9, 0x8d, 0xf5,
-  0xc6, 0xf6, 0x49, 0xd8, 0xa5, 0xc9, 0x9e, 0x70, 0xee, 0xd2, 0x75, 0xa6,
-  0x1f, 0x81, 0x79, 0x99, 0xa0, 0x7a, 0x4d, 0x7f, 0x31, 0x93, 0xee, 0xc2,
-  0x00, 0x9a, 0x5f, 0xd5, 0x42, 0x72, 0x9e, 0xac, 0x52, 0xfb, 0x65, 0x8f,
-  0xbb, 0x8b, 0x3c, 0xab, 0xef, 0x19, 0x05, 0x5a, 0x23, 0x30, 0x1e, 0xc3,
-  0x3e, 0x4d, 0xca, 0x45, 0x99, 0x5e, 0xeb, 0x20, 0x06, 0xfc, 0xf1, 0xb8,
-  0xac, 0x12, 0xfc, 0xde, 0xdf, 0x10, 0x0a, 0xd6, 0x29, 0x4d, 0xf0, 0xa6,
-  0x6d, 0xf5, 0xdd, 0x11, 0xb8, 0xba, 0x5a, 0x40, 0xdd, 0xe4, 0xce, 0x11,
-  0x4c, 0x76, 0xfd, 0x79, 0xd4, 0x2c, 0x59, 0x17, 0x0b, 0x8c, 0xea, 0xb2,
-  0xa8, 0x8a, 0xfc, 0x26, 0xf5, 0x0a, 0x79, 0x5f, 0x1a, 0x12, 0x60, 0xc0,
-  0x7f, 0xce, 0x5e, 0xe1, 0xf7, 0x29, 0xab, 0xea, 0x8a, 0x8c, 0x80, 0x55,
-  0x81, 0x77, 0x7a, 0x6b, 0x4c, 0x54, 0x43, 0xb1, 0x6d, 0x75, 0x88, 0x69,
-  0x9d, 0x12, 0xc6, 0x8f, 0x9f, 0xa8, 0x60, 0x27, 0xb8, 0xe6, 0x7b, 0xe0,
-  0xe4, 0x5d, 0x8f, 0x1d, 0xe5, 0x6c, 0x2b, 0xde, 0x83, 0x26, 0xb9, 0x4b,
-  0xc8, 0x5a, 0x0f, 0x88, 0x50, 0x8a, 0x81, 0x20, 0xe6, 0x89, 0x9e, 0xdb,
-  0x7e, 0xc9, 0x68, 0x70, 0x78, 0x64, 0x77, 0x37, 0xe0, 0xec, 0x01, 0x74,
-  0xf5, 0xd4, 0xf0, 0xc5, 0x71, 0x0f, 0x7d, 0x30, 0xc5, 0x7f, 0x23, 0x37,
-  0xd4, 0x5f, 0xe2, 0x7b, 0xba, 0xfb, 0x4f, 0x0f, 0x23, 0x83, 0x5f, 0xd3,
-  0x4c, 0xc5, 0xfc, 0x03, 0x3e, 0xc6, 0x6a, 0x34, 0xb9, 0xa9, 0x11, 0x9e,
-  0x0d, 0x55, 0x3c, 0x68, 0x3e, 0xdd, 0x0c, 0x40, 0x68, 0xbd, 0x42, 0xb5,
-  0x05, 0x1d, 0x66, 0x4f, 0xc9, 0x30, 0x1e, 0xdc, 0x51, 0xce, 0x3f, 0x24,
-  0xb6, 0x0c, 0xee, 0x94, 0x8e, 0xb3, 0x06, 0xc1, 0xc6, 0xb2, 0x65, 0x2e,
-  0x23, 0x1c, 0xf1, 0x2a, 0x02, 0x05, 0xcd, 0x11, 0x97, 0x53, 0xad, 0xdd,
-  0x8e, 0xfe, 0x14, 0xb6, 0xf7, 0x51, 0x68, 0x04, 0xe0, 0x6a, 0xd8, 0xc8,
-  0x71, 0x9c, 0xcd, 0xcc, 0x13, 0x3d, 0xe8, 0x97, 0xc0, 0xc7, 0x7f, 0x91,
-  0x54, 0x20, 0x94, 0x52, 0x3a, 0x6c, 0xb6, 0x06, 0x63, 0x10, 0xb2, 0x1f,
-  0x73, 0x2f, 0xc4, 0x2e, 0x25, 0x8f, 0x5e, 0x4a, 0xcf, 0x72, 0x2c, 0x44,
-  0xf9, 0xf1, 0x12, 0x8d, 0xfe, 0x39, 0xcc, 0x3a, 0x78, 0x3d, 0x7d, 0xf7,
-  0x5f, 0x98, 0x75, 0xf2, 0x5d, 0x82, 0xe9, 0x3f, 0xdf, 0x7d, 0x73, 0xa6,
-  0xde, 0xfd, 0x6d, 0xf6, 0xf2, 0xa9, 0x01, 0x18, 0xd9, 0x60, 0x92, 0xe6,
-  0x41, 0x96, 0x10, 0xbd, 0xaa, 0xaf, 0xd7, 0x34, 0x1d, 0x6e, 0xf0, 0xa2,
-  0x37, 0x5a, 0x1b, 0xd0, 0xb0, 0x5d, 0x17, 0xf4, 0xee, 0x16, 0x55, 0x53,
-  0xa5, 0xb7, 0x38, 0xe6, 0xaa, 0xc0, 0x3c, 0x59, 0xaf, 0xe7, 0x02, 0xae,
-  0x87, 0xf7, 0x26, 0xc9, 0x7d, 0x8e, 0x42, 0x77, 0x64, 0x81, 0x21, 0xea,
-  0xed, 0x8f, 0x49, 0x83, 0xb3, 0xb0, 0x34, 0xf5, 0x80, 0xa6, 0x07, 0x37,
-  0x48, 0xab, 0x63, 0x89, 0x79, 0x9d, 0x60, 0x81, 0xe3, 0xa9, 0xbc, 0x36,
-  0x14, 0x56, 0x03, 0xc8, 0x03, 0x0c, 0x73, 0x0b, 0x3f, 0x6d, 0xd2, 0x46,
-  0x65, 0x17, 0x06, 0x64, 0x01, 0x85, 0x90, 0x32, 0xb9, 0xb3, 0x20, 0x76,
-  0xfe, 0x78, 0x6b, 0x29, 0x58, 0x8d, 0x84, 0xe8, 0x6d, 0xa0, 0x7e, 0xda,
-  0x86, 0xbb, 0x39, 0x1f, 0x09, 0x47, 0xa4, 0xf7, 0x78, 0xf4, 0xe9, 0xab,
-  0xee, 0x3c, 0x7c, 0x6a, 0xeb, 0x37, 0x67, 0x42, 0x42, 0x55, 0x66, 0x3a,
-  0x2e, 0x84, 0x0b, 0x44, 0x77, 0x61, 0xe5, 0xca, 0x9b, 0xa0, 0x91, 0x79,
-  0x17, 0x72, 0x22, 0xf5, 0x16, 0xdb, 0x1b, 0xa8, 0xf2, 0xea, 0x15, 0x85,
-  0x0c, 0xfd, 0x66, 0xfc, 0xee, 0x6f, 0xd0, 0x54, 0xef, 0xc3, 0xc8, 0xe9,
-  0xb9, 0x50, 0x36, 0xe8, 0xca, 0x0d, 0xf6, 0x88, 0x6e, 0x23, 0x20, 0x6c,
-  0xe1, 0xa5, 0xf0, 0x1c, 0xa6, 0x38, 0x09, 0xf0, 0x75, 0xca, 0x47, 0xd1,
-  0x30, 0xa4, 0xc8, 0x22, 0xba, 0xda, 0x88, 0xb4, 0x76, 0xf9, 0xe1, 0x35,
-  0xd1, 0xe1, 0x7c, 0x4f, 0xa5, 0x9c, 0x66, 0x8b, 0xce, 0x98, 0xe8, 0xad,
-  0x9d, 0xa0, 0x59, 0x05, 0xa8, 0xfc, 0xb5, 0xd0, 0xc8, 0x21, 0x84, 0xd0,
-  0x34, 0x5a, 0x1e, 0x61, 0xdc, 0x43, 0x04, 0xa6, 0xdb, 0xf4, 0x25, 0x65,
-  0xe3, 0x8f, 0xd0, 0xda, 0x67, 0x1c, 0x4f, 0x7d, 0xac, 0xe1, 0xc6, 0x66,
-  0xa5, 0xc2, 0xd3, 0x3f, 0x50, 0x66, 0x4d, 0x06, 0x25, 0x97, 0x63, 0x3d,
-  0xc6, 0xf2, 0xcb, 0xeb, 0xdb, 0x50, 0x63, 0xa2, 0xce, 0xee, 0xe1, 0xd1,
-  0xed, 0x7f, 0x9d, 0x26, 0x7c, 0xf1, 0xe4, 0xf7, 0xc5, 0x12, 0x96, 0x19,
-  0xf5, 0xab, 0x62, 0x9d, 0xa5, 0xe5, 0x95, 0x7c, 0xff, 0xdf, 0x66, 0x2a,
-  0xc9, 0x64, 0x44, 0xa7, 0x51, 0xb5, 0x83, 0x5f, 0x6a, 0x5d, 0x60, 0xda,
-  0x1b, 0xac, 0x03, 0xea, 0xcf, 0xf6, 0xa6, 0x1a, 0x50, 0x49, 0xe0, 0x1b,
-  0x4e, 0xd4, 0x7b, 0x7a, 0xbd, 0xbb, 0xd7, 0xf6, 0x74, 0x41, 0xba, 0x3c,
-  0xd6, 0xfc, 0xd5, 0x96, 0x7d, 0x62, 0x26, 0x9a, 0xc4, 0x44, 0x62, 0x64,
-  0x4f, 0xcc, 0xb4, 0xdc, 0x26, 0xd5, 0xd6, 0x2e, 0x04, 0x6f, 0xa0, 0x34,
-  0x4d, 0x1e, 0x7b, 0xdd, 0x40, 0xf4, 0xed, 0xec, 0x1a, 0x08, 0x48, 0x79,
-  0x8a, 0x84, 0x77, 0xe2, 0x31, 0x46, 0x7d, 0x78, 0xc3, 0x00, 0x97, 0x5a,
-  0x40, 0x87, 0xe9, 0x37, 0xd5, 0xe3, 0x3f, 0x8f, 0xe5, 0xf8, 0xd4, 0x1d,
-  0x3f, 0x5c, 0x8c, 0xdd, 0xee, 0x45, 0xf0, 0x99, 0xc1, 0xde, 0x4a, 0xbb,
-  0x36, 0xc5, 0x61, 0xb6, 0xb7, 0xef, 0x71, 0x0d, 0xad, 0xd4, 0x81, 0x3c,
-  0x52, 0xb6, 0x9a, 0x8d, 0x39, 0xe0, 0x3a, 0x7f, 0xc9, 0xd0, 0x0a, 0xe3,
-  0x9a, 0x32, 0x35, 0xcd, 0x4b, 0xdc, 0x2c, 0x60, 0xdc, 0x75, 0x02, 0xa6,
-  0x75, 0x5c, 0x4f, 0xe4, 0x93, 0xe9, 0xbe, 0x98, 0xdf, 0x26, 0x25, 0x5e,
-  0x30, 0xe7, 0x17, 0x2d, 0x3c, 0x47, 0xdf, 0x4e, 0x1a, 0x9c, 0xc2, 0x2a,
-  0x01, 0x33, 0x8a, 0x8b, 0xdc, 0xf2, 0x87, 0x2f, 0xdb, 0x62, 0x93, 0xa0,
-  0x27, 0x1e, 0xff, 0x43, 0x95, 0xa6, 0x3e, 0x9d, 0x4a, 0xff, 0xbf, 0xfa,
-  0x65, 0xb1, 0xdb, 0x01, 0xb1, 0xab, 0x44, 0x27, 0x04, 0xac, 0x6f, 0xd3,
-  0xd4, 0xde, 0x49, 0x51, 0x9c, 0x7b, 0x58, 0x7e, 0x2c, 0x31, 0x41, 0x82,
-  0x5d, 0x12, 0xf0, 0xe3, 0x3a, 0x2b, 0xd3, 0x55, 0x5d, 0x94, 0x59, 0x5a,
-  0x71, 0x1c, 0x40, 0x1f, 0x69, 0x4a, 0x8b, 0x0c, 0x1e, 0x31, 0xd0, 0x36,
-  0x19, 0x54, 0x45, 0x6f, 0x05, 0x32, 0x77, 0x5f, 0xdc, 0xb5, 0x87, 0xc5,
-  0xa9, 0x59, 0x4b, 0x31, 0xf5, 0x5f, 0xd7, 0xba, 0x38, 0x79, 0x89, 0x32,
-  0x83, 0x44, 0x3c, 0x3d, 0x44, 0x24, 0x7c, 0x29, 0xa3, 0xc0, 0x0c, 0x3d,
-  0xa7, 0x7d, 0xbc, 0x44, 0xad, 0x0f, 0x4e, 0xb4, 0x4d, 0x1a, 0x02, 0x2d,
-  0x13, 0xea, 0x34, 0x77, 0xd6, 0x91, 0x2f, 0x9d, 0x75, 0x24, 0x54, 0x3b,
-  0xa7, 0x74, 0x9e, 0x4d, 0xb5, 0x45, 0x87, 0xdd, 0x90, 0x1c, 0x26, 0x8f,
-  0x9a, 0x7f, 0x77, 0x4c, 0xcb, 0xfb, 0xa1, 0x2d, 0xae, 0xb0, 0xc9, 0x9d,
-  0xcd, 0x6f, 0xea, 0xc3, 0xad, 0xea, 0x2f, 0x53, 0xfb, 0x1e, 0x9d, 0xf3,
-  0xa0, 0x8e, 0xd1, 0x27, 0xfd, 0x68, 0xe8, 0x2e, 0xf7, 0xa6, 0x87, 0x62,
-  0x8b, 0xa4, 0xab, 0xe2, 0xd8, 0x1f, 0x55, 0x63, 0xe9, 0x6f, 0xb0, 0xc9,
-  0x83, 0x57, 0x22, 0x8b, 0x7b, 0x64, 0xb6, 0x11, 0x21, 0xeb, 0x9d, 0x8a,
-  0x87, 0x08, 0x6c, 0x68, 0x4a, 0xe0, 0xf4, 0x7e, 0x40, 0xed, 0x4a, 0xd2,
-  0x0e, 0xf8, 0x44, 0xdf, 0x3b, 0xca, 0xf6, 0x1b, 0x58, 0x1e, 0x4c, 0x78,
-  0xa9, 0x0e, 0xc8, 0x6d, 0xbd, 0xcb, 0x19, 0x92, 0x94, 0xe9, 0x17, 0xdd,
-  0xd0, 0x75, 0x71, 0xe8, 0x46, 0x6b, 0x4e, 0xb9, 0x60, 0x25, 0xc7, 0x84,
-  0xdd, 0xfd, 0x04, 0xac, 0xd3, 0xdd, 0x40, 0x52, 0x2b, 0x58, 0x11, 0xd2,
-  0x1e, 0x50, 0x73, 0xe1, 0x5a, 0xbb, 0x99, 0x0c, 0x82, 0xdd, 0x16, 0x55,
-  0xfd, 0xa4, 0x43, 0x08, 0xf0, 0x1c, 0x78, 0x92, 0x4b, 0x2c, 0xeb, 0x27,
-  0x7a, 0x32, 0x34, 0xd4, 0x3f, 0x77, 0x16, 0xf2, 0x0c, 0x7f, 0xfc, 0x51,
-  0xb5, 0x5c, 0x01, 0x73, 0xa6, 0xfb, 0xea, 0x08, 0xdc, 0x5f, 0xa6, 0xb0,
-  0x0f, 0x59, 0xe6, 0xf7, 0x4c, 0x0c, 0x2d, 0x45, 0x32, 0x89, 0x08, 0x3b,
-  0x59, 0x05, 0xd0, 0xe6, 0x47, 0x02, 0x73, 0x8e, 0xa9, 0x3d, 0x44, 0x56,
-  0x3c, 0x9e, 0x33, 0xa6, 0x0e, 0xb8, 0x41, 0x0d, 0x90, 0x8e, 0xf9, 0xb1,
-  0xda, 0x20, 0xfe, 0x3e, 0x03, 0x9a, 0x61, 0x41, 0x5b, 0x27, 0x6e, 0x65,
-  0xb7, 0x00, 0x3f, 0xe2, 0x92, 0x16, 0xd7, 0x75, 0x41, 0x33, 0x28, 0x6e,
-  0x2b, 0xbb, 0x80, 0xc1, 0x8a, 0x83, 0x91, 0xac, 0x98, 0x5b, 0x4f, 0x2b,
-  0xd9, 0x1f, 0x99, 0x45, 0xec, 0x9e, 0x77, 0x45, 0x09, 0xc7, 0x2f, 0xc4,
-  0xd5, 0x8a, 0xb6, 0x48, 0x45, 0xf9, 0x06, 0x14, 0x8d, 0xb4, 0x3e, 0xf7,
-  0xe4, 0xcf, 0x6a, 0x8d, 0x49, 0x07, 0x64, 0xaa, 0x6f, 0x61, 0x2a, 0xe5,
-  0x69, 0x49, 0x52, 0x55, 0xe4, 0x1a, 0xfb, 0xff, 0x29, 0xd1, 0x9b, 0x58,
-  0x94, 0xa2, 0xa3, 0x99, 0xec, 0xb9, 0x0f, 0x49, 0xbd, 0xc5, 0x31, 0x3e,
-  0x20, 0x05, 0x33, 0xfa, 0x07, 0xc7, 0xc0, 0x1e, 0x4f, 0xcb, 0x99, 0x95,
-  0xf9, 0x72, 0xc2, 0x61, 0x30, 0xa5, 0xa0, 0xba, 0xb2, 0xa4, 0x1b, 0x6c,
-  0x73, 0xfb, 0x4e, 0xca, 0x61, 0x49, 0xc1, 0x7a, 0x85, 0x93, 0xc9, 0x81,
-  0xa6, 0x9f, 0xb6, 0x02, 0x03, 0xb6, 0x4e, 0x6f, 0x32, 0xcc, 0x1f, 0x63,
-  0xd1, 0xf2, 0x8b, 0x75, 0x26, 0x41, 0x4c, 0x0c, 0x9d, 0x78, 0x2c, 0xcc,
-  0xa6, 0xf1, 0xd5, 0x9a, 0xfa, 0xe4, 0x0a, 0xa1, 0xd4, 0xee, 0x08, 0x98,
-  0x97, 0xa9, 0x39, 0x13, 0xc3, 0x40, 0x70, 0x82, 0x8d, 0x6d, 0xe4, 0x84,
-  0xe6, 0xf1, 0x47, 0x0a, 0x47, 0x2a, 0xbd, 0x2e, 0x0b, 0x0c, 0xa1, 0xb2,
-  0xca, 0xaf, 0x56, 0x5b, 0x72, 0xc7, 0xd3, 0x34, 0x19, 0x36, 0x4a, 0xef,
-  0xea, 0xab, 0xd5, 0xda, 0x7d, 0xbf, 0x3b, 0x8a, 0x65, 0x0c, 0xbf, 0x49,
-  0x24, 0x29, 0xd3, 0xfe, 0x99, 0x0b, 0x8b, 0xbc, 0xba, 0x67, 0x44, 0x2b,
-  0xa8, 0x03, 0x8a, 0xcd, 0xf5, 0xf8, 0x47, 0x3a, 0xec, 0xf1, 0x47, 0xd7,
-  0x38, 0x07, 0xaa, 0xec, 0xaa, 0x41, 0x0c, 0xa2, 0x20, 0x96, 0x80, 0x41,
-  0x27, 0x5a, 0xf1, 0xfe, 0x6d, 0x14, 0x45, 0x7e, 0x5c, 0x65, 0xe8, 0xe2,
-  0x01, 0x50, 0x58, 0x00, 0x17, 0xdd, 0x18, 0x18, 0x4f, 0xb7, 0x6a, 0x89,
-  0x67, 0x16, 0xd9, 0x5d, 0xa3, 0x3e, 0xfd, 0x99, 0xb2, 0x11, 0x49, 0x0b,
-  0x9d, 0x31, 0xa1, 0x17, 0xd5, 0x13, 0x42, 0x80, 0x9d, 0xb0, 0xa7, 0x78,
-  0xb3, 0x96, 0x43, 0x7c, 0x05, 0xfd, 0xd3, 0x77, 0x9f, 0x8e, 0x9c, 0xba,
-  0xae, 0xd3, 0x7a, 0x75, 0x8b, 0x86, 0xc3, 0xa7, 0x23, 0x33, 0x18, 0x2b,
-  0xac, 0x0e, 0x7b, 0x08, 0xbe, 0x38, 0x64, 0xa4, 0x91, 0xfe, 0x10, 0xd6,
-  0x56, 0xa8, 0xf4, 0xfd, 0x6e, 0xb3, 0xc9, 0xd0, 0x3a, 0x9f, 0xdf, 0x2b,
-  0xec, 0x3b, 0x1d, 0x1e, 0xb0, 0xa2, 0x42, 0xb6, 0xcc, 0x19, 0x4c, 0xb1,
-  0xe2, 0x5c, 0xfd, 0x82, 0xf7, 0x2d, 0x4a, 0x0b, 0x14, 0x1f, 0x53, 0xb5,
-  0xcd, 0x60, 0x37, 0xa3, 0xf7, 0x47, 0xeb, 0x74, 0x99, 0x25, 0x7b, 0xd2,
-  0x35, 0x8f, 0xcb, 0xe3, 0xbe, 0x3e, 0xa2, 0x0d, 0x09, 0x73, 0xdb, 0x55,
-  0x14, 0x52, 0xe3, 0xd7, 0xe9, 0x52, 0x5d, 0x3e, 0xbb, 0xf8, 0x67, 0x4c,
-  0xc4, 0x9b, 0x56, 0xb0, 0x8b, 0x3a, 0x77, 0x86, 0xef, 0x2e, 0xec, 0xcb,
-  0xeb, 0x41, 0x5d, 0x49, 0xf0, 0x64, 0x3a, 0xf3, 0x54, 0xa2, 0x81, 0x25,
-  0xb9, 0xaa, 0x39, 0x1e, 0xf5, 0x0b, 0x57, 0x33, 0xff, 0x22, 0xb7, 0x3a,
-  0x5c, 0x88, 0xb4, 0x58, 0x5e, 0x62, 0x5e, 0xa1, 0xb1, 0xc6, 0x01, 0x80,
-  0xde, 0x9e, 0x59, 0xf9, 0xea, 0x1e, 0xd2, 0x8e, 0x3e, 0x07, 0xcd, 0xe1,
-  0x8a, 0x64, 0x5a, 0xbd, 0xdd, 0xe5, 0xe7, 0xab, 0xc3, 0xe1, 0x4a, 0xfd,
-  0x12, 0x99, 0x10, 0x67, 0x98, 0xc8, 0x2b, 0xce, 0xeb, 0x0d, 0x4d, 0x3f,
-  0xd2, 0xc4, 0x4b, 0xb4, 0xcc, 0x03, 0xf1, 0x47, 0x46, 0x6c, 0x95, 0x61,
-  0x57, 0x29, 0x23, 0xdd, 0xb5, 0xb9, 0xb6, 0xc6, 0x20, 0xe0, 0x48, 0xd3,
-  0x39, 0x49, 0x70, 0xec, 0x01, 0xda, 0x8f, 0xf3, 0xec, 0x95, 0x6e, 0x6c,
-  0x2e, 0xd5, 0x6e, 0x02, 0x7a, 0x16, 0x04, 0xd3, 0xd5, 0xcc, 0xc8, 0x3d,
-  0xbb, 0x4a, 0xfc, 0x91, 0xb7, 0x58, 0x40, 0x2f, 0x8c, 0xa8, 0x27, 0x89,
-  0x1d, 0x9a, 0xf5, 0xfc, 0xc0, 0x9d, 0xed, 0x2a, 0xd9, 0xe3, 0xd1, 0x3a,
-  0x4f, 0x31, 0x34, 0x3d, 0xeb, 0xe6, 0x70, 0x32, 0x75, 0xaf, 0x41, 0x57,
-  0xef, 0x26, 0xef, 0x7e, 0x62, 0x56, 0x1e, 0x5d, 0xb3, 0xde, 0x45, 0x3f,
-  0x53, 0xab, 0xc8, 0x81, 0x9c, 0xbf, 0x74, 0xd0, 0x32, 0x49, 0x0e, 0x46,
-  0xca, 0x5f, 0xf3, 0xdc, 0x4c, 0x70, 0x28, 0x7a, 0x31, 0x0c, 0x22, 0xb0,
-  0x82, 0xd8, 0x68, 0x07, 0x07, 0xa2, 0xd8, 0x9b, 0x10, 0x14, 0x23, 0xed,
-  0x07, 0xa4, 0xb1, 0xd6, 0x88, 0x95, 0xbd, 0xdb, 0xa7, 0xb9, 0x12, 0xbc,
-  0xb8, 0x61, 0xc5, 0xf0, 0xdb, 0xcf, 0x74, 0xe0, 0x7c, 0x7d, 0xcb, 0x9c,
-  0xc0, 0x90, 0x35, 0xdc, 0x52, 0x64, 0x98, 0xc2, 0x97, 0x73, 0x28, 0x70,
-  0x11, 0x5a, 0xad, 0xc7, 0x4e, 0xd3, 0xa6, 0x38, 0x10, 0x6c, 0xc8, 0xa2,
-  0x30, 0x2e, 0xae, 0x6b, 0x0a, 0xec, 0x69, 0xc9, 0x38, 0x0b, 0x20, 0xd6,
-  0xd9, 0x50, 0x8b, 0x75, 0x8b, 0xe2, 0x8a, 0x03, 0x18, 0xc8, 0x51, 0x7c,
-  0xb5, 0x2d, 0x8e, 0x39, 0x3b, 0x40, 0xa0, 0xa0, 0x87, 0x79, 0x0a, 0x28,
-  0x6c, 0x68, 0x43, 0xce, 0x9e, 0x05, 0x75, 0x4e, 0xc7, 0x64, 0x85, 0x46,
-  0xdc, 0x81, 0xef, 0x31, 0x06, 0x33, 0x20, 0x3f, 0x34, 0xf6, 0xfb, 0xa1,
-  0x5d, 0xb4, 0x05, 0xf3, 0x70, 0xc4, 0xae, 0xdd, 0xc8, 0x55, 0xe8, 0xd0,
-  0xbc, 0x6d, 0x72, 0xb3, 0xf8, 0x63, 0xe3, 0x5e, 0x1a, 0x70, 0xea, 0x9a,
-  0x79, 0x04, 0x3b, 0x01, 0x71, 0xfc, 0xd2, 0x1c, 0x1a, 0xc7, 0xb5, 0xfd,
-  0x95, 0xc5, 0xed, 0x5c, 0x87, 0x93, 0x37, 0x97, 0x68, 0xe0, 0x9d, 0x8e,
-  0x84, 0xad, 0xe1, 0xd9, 0xca, 0x9e, 0x37, 0x00, 0xe1, 0xdd, 0x71, 0xb7,
-  0x6f, 0xc2, 0xee, 0xac, 0x77, 0x1e, 0x70, 0xb9, 0x69, 0xdb, 0xa9, 0xdc,
-  0x19, 0x72, 0xe9, 0xa6, 0x02, 0x7b, 0xe3, 0xe2, 0xe0, 0x7c, 0x62, 0x54,
-  0x75, 0x89, 0xa9, 0x01, 0xf5, 0xc1, 0x69, 0xc3, 0x47, 0xd2, 0x90, 0x52,
-  0x97, 0xc9, 0xbe, 0x82, 0x35, 0x41, 0x87, 0xf7, 0x81, 0xfd, 0x5d, 0x59,
-  0x00, 0xff, 0xa7, 0x1b, 0xb5, 0x53, 0xfb, 0xb0, 0x54, 0xfa, 0x9d, 0xb2,
-  0xed, 0x3e, 0x1d, 0xa3, 0x96, 0x6e, 0xbc, 0x29, 0x9d, 0x0e, 0x79, 0x8f,
-  0xa9, 0x91, 0xcd, 0x1a, 0x24, 0x42, 0x65, 0xb6, 0xef, 0x82, 0xca, 0x9c,
-  0x4e, 0x1d, 0x5c, 0xd9, 0xae, 0xa3, 0x32, 0x43, 0x7c, 0xa4, 0x35, 0x62,
-  0x01, 0x74, 0x5e, 0xb9, 0xf2, 0x00, 0xa7, 0x9e, 0xb9, 0xd4, 0x65, 0x60,
-  0xb4, 0x8e, 0x33, 0xa8, 0x6b, 0xdc, 0x19, 0x8d, 0xa3, 0x68, 0x91, 0xa8,
-  0x7d, 0x83, 0x52, 0xd3, 0xf2, 0x48, 0x57, 0x08, 0xa5, 0xce, 0x2b, 0x9f,
-  0xd2, 0x9d, 0xa5, 0xd4, 0xc0, 0x78, 0x94, 0xf6, 0xf4, 0x6b, 0x48, 0xa9,
-  0x45, 0xa2, 0x76, 0xcd, 0x01, 0x4c, 0xbc, 0x4e, 0xb3, 0xb0, 0x31, 0xca,
-  0xa9, 0xb6, 0xd1, 0xc8, 0x23, 0x6b, 0x88, 0x1c, 0x90, 0x39, 0xf2, 0xc8,
-  0x1c, 0x37, 0x19, 0x41, 0x50, 0xce, 0x9c, 0xb1, 0xeb, 0xe8, 0x89, 0xd2,
-  0x9c, 0x28, 0x9d, 0x34, 0x84, 0x43, 0x93, 0x04, 0xe3, 0x37, 0xa0, 0x93,
-  0xcb, 0x79, 0x12, 0xab, 0x77, 0x6e, 0x39, 0x78, 0xec, 0x47, 0x3d, 0x6b,
-  0x3b, 0xf9, 0xd1, 0x6d, 0xbe, 0x9b, 0x8a, 0x90, 0x4f, 0xc2, 0xac, 0x0d,
-  0xdc, 0x4b, 0xf6, 0xeb, 0xd4, 0xe1, 0x30, 0x66, 0x20, 0x45, 0x34, 0x7e,
-  0x14, 0x17, 0xba, 0x02, 0x80, 0xe5, 0x61, 0xc1, 0x97, 0xbd, 0xfc, 0xe7,
-  0x0d, 0x4c, 0x48, 0x18, 0xbd, 0x77, 0x99, 0xaa, 0xbb, 0x66, 0x80, 0x8c,
-  0xd6, 0xec, 0xdd, 0x2a, 0x11, 0xcb, 0x7f, 0xd0, 0x11, 0x5c, 0xc6, 0x93,
-  0x83, 0x5c, 0x5a, 0x5f, 0x2a, 0xe1, 0x95, 0x51, 0x7c, 0x7d, 0x4e, 0xdd,
-  0xc5, 0x11, 0xd6, 0x8a, 0xf4, 0x86, 0x4e, 0x5f, 0x59, 0x25, 0xf8, 0x02,
-  0xcf, 0xbd, 0x71, 0xb5, 0xd3, 0xb6, 0x68, 0x7b, 0xca, 0x8d, 0x11, 0x39,
-  0x69, 0xa5, 0x5c, 0x91, 0x9d, 0xfa, 0x1c, 0x1e, 0x68, 0x41, 0xef, 0x39,
-  0x0f, 0x7a, 0x8f, 0xd3, 0x20, 0xf2, 0x22, 0x74, 0x17, 0xb8, 0xf7, 0x3a,
-  0xe0, 0xd0, 0xad, 0xf6, 0x8d, 0xdc, 0xa2, 0xd4, 0x94, 0x78, 0xce, 0x3f,
-  0xa7, 0x84, 0xb3, 0x40, 0xe1, 0xde, 0x09, 0x60, 0xd7, 0x38, 0x08, 0xd0,
-  0x5f, 0xf5, 0xe7, 0x5a, 0xce, 0x3f, 0x9b, 0x1b, 0x6f, 0x74, 0x19, 0xa8,
-  0xd4, 0x32, 0xab, 0x81, 0xea, 0x8a, 0x85, 0x2f, 0x7a, 0x28, 0x57, 0x18,
-  0x4a, 0x3c, 0xe1, 0x90, 0xc0, 0xe8, 0xf4, 0x7c, 0xae, 0x8b, 0x7f, 0x5d,
-  0xac, 0x41, 0xa5, 0xfd, 0x7d, 0x7a, 0xc8, 0x93, 0x55, 0xca, 0x5a, 0xa8,
-  0xc1, 0xb7, 0xbc, 0x57, 0x46, 0xdf, 0xdf, 0x26, 0xf9, 0x06, 0x9a, 0x70,
-  0x4f, 0xd7, 0x05, 0x76, 0xd9, 0xf7, 0xa0, 0xb6, 0x7e, 0xf1, 0xf9, 0x57,
-  0xaf, 0x81, 0xb5, 0xd6, 0xa9, 0x1f, 0x5b, 0xdc, 0xc6, 0x82, 0x2d, 0x76,
-  0x8b, 0x6c, 0x77, 0xcd, 0xb5, 0xeb, 0x33, 0x3c, 0x2d, 0x7f, 0xa8, 0x89,
-  0xee, 0x1e, 0xdd, 0x0b, 0x03, 0x55, 0x6f, 0xd1, 0x04, 0x49, 0xa4, 0x2a,
-  0x9b, 0xbc, 0xb5, 0x37, 0x24, 0xae, 0x87, 0xa5, 0x19, 0xb4, 0xd6, 0xb9,
-  0x5b, 0xe0, 0x80, 0x71, 0x94, 0xdb, 0x75, 0x7b, 0x6c, 0xdc, 0x46, 0x91,
-  0x57, 0x96, 0xa4, 0x50, 0xf3, 0xa1, 0x8c, 0xd2, 0x1c, 0x85, 0x92, 0x05,
-  0x21, 0xe9, 0x55, 0x26, 0xcf, 0x74, 0x13, 0xfe, 0xd2, 0x55, 0x89, 0xdc,
-  0xa3, 0x9a, 0x17, 0x23, 0x75, 0x77, 0xd9, 0x50, 0x98, 0x74, 0x1a, 0x92,
-  0x26, 0xa8, 0x3d, 0xc6, 0x71, 0x7b, 0x38, 0x30, 0x13, 0x51, 0x87, 0x92,
-  0x71, 0x97, 0x7b, 0xd8, 0xb4, 0x83, 0x3a, 0xe6, 0x91, 0x95, 0x9e, 0x74,
-  0x45, 0xb1, 0x4a, 0x93, 0x72, 0xb5, 0x45, 0xbf, 0x5b, 0x63, 0x36, 0xcd,
-  0x6a, 0xb1, 0xd7, 0xea, 0xdb, 0x69, 0xc1, 0x37, 0xc3, 0x93, 0xbf, 0x46,
-  0xae, 0xfb, 0x2c, 0xcf, 0x92, 0x0a, 0xf6, 0x1b, 0xc0, 0x20, 0xcc, 0x99,
-  0xb0, 0x45, 0x2e, 0x93, 0x95, 0x76, 0x5f, 0xa1, 0x0d, 0x72, 0xb1, 0x51,
-  0xc5, 0xb1, 0x34, 0x0c, 0x77, 0x8a, 0x99, 0x75, 0xb1, 0xe7, 0xeb, 0x94,
-  0xac, 0xe0, 0x9a, 0xa7, 0x40, 0x7d, 0xc5, 0x8e, 0x9c, 0x23, 0x43, 0x59,
-  0xb7, 0xdb, 0xa9, 0x9d, 0x2d, 0xe1, 0x5e, 0x91, 0xd3, 0xcf, 0x0b, 0xe4,
-  0x9c, 0x7b, 0x7b, 0x6e, 0x93, 0xa1, 0x28, 0x67, 0x2a, 0x79, 0xfa, 0xba,
-  0x57, 0x93, 0x6e, 0x5a, 0xb4, 0x42, 0xce, 0xbd, 0x8b, 0x1e, 0x22, 0xd4,
-  0xbf, 0x94, 0xd0, 0x63, 0x0e, 0x4a, 0x39, 0xda, 0x82, 0x6e, 0xb4, 0xfb,
-  0x44, 0x8a, 0x86, 0x47, 0xb6, 0xf4, 0xdb, 0x58, 0x4a, 0xda, 0xf7, 0x5e,
-  0xca, 0xc1, 0x4f, 0x3e, 0x93, 0xbf, 0x51, 0x57, 0xc9, 0xfe, 0x1e, 0x7f,
-  0xab, 0x5a, 0x2f, 0x85, 0x27, 0xc2, 0x41, 0x4e, 0x54, 0x32, 0xfd, 0x16,
-  0x96, 0x37, 0x3c, 0xe5, 0xb4, 0x7e, 0x21, 0x37, 0xe8, 0x17, 0x42, 0xf4,
-  0x5e, 0x5d, 0xb1, 0x7f, 0xc8, 0xcc, 0x01, 0x77, 0xcd, 0x10, 0x7f, 0x62,
-  0x79, 0x87, 0x8e, 0x16, 0x7f, 0x71, 0xcf, 0xbb, 0x23, 0x0d, 0x41, 0x8e,
-  0xe3, 0x24, 0x2e, 0x86, 0xbd, 0xb4, 0x98, 0xdd, 0x71, 0xb4, 0xdd, 0xc2,
-  0x44, 0xdc, 0x85, 0x5a, 0xd1, 0x3f, 0x8a, 0x9a, 0x62, 0x09, 0xa1, 0xf8,
-  0xaf, 0xf6, 0xa2, 0x70, 0x17, 0x28, 0xc9, 0x4b, 0xe7, 0x34, 0x52, 0xec,
-  0x74, 0x84, 0x43, 0xb6, 0x1a, 0x78, 0xd2, 0x7b, 0xba, 0xa3, 0x1d, 0x0f,
-  0x90, 0x08, 0xdb, 0x55, 0x50, 0x03, 0x56, 0xd0, 0x11, 0x09, 0x1e, 0x3b,
-  0xd2, 0x01, 0x99, 0x44, 0x79, 0xd3, 0xa7, 0x5e, 0xda, 0x8c, 0xe8, 0x94,
-  0x37, 0xa3, 0x49, 0x07, 0xc1, 0x19, 0x3d, 0xc2, 0x56, 0x17, 0x0f, 0x46,
-  0xee, 0xcf, 0xd0, 0xd3, 0x0a, 0x1a, 0x08, 0x6c, 0x98, 0xac, 0xd1, 0xed,
-  0x0a, 0x9d, 0x4d, 0xa8, 0xa7, 0x33, 0x0e, 0xb7, 0x25, 0x48, 0x98, 0x9b,
-  0xf7, 0x28, 0xfa, 0x98, 0x99, 0xc5, 0x98, 0x49, 0x59, 0x5a, 0xaa, 0x1a,
-  0xd4, 0x2e, 0x32, 0xb9, 0xb1, 0x0d, 0xb3, 0xca, 0xea, 0x63, 0xc2, 0xe7,
-  0xa1, 0xd2, 0x13, 0x8d, 0xf1, 0xe3, 0xae, 0x52, 0xa7, 0x3a, 0x6b, 0xaf,
-  0xd9, 0x5c, 0xe9, 0xfe, 0xd6, 0x7c, 0x89, 0x5a, 0x10, 0x75, 0xcb, 0xce,
-  0x84, 0x33, 0x36, 0x76, 0xc0, 0x06, 0x4a, 0x5d, 0x26, 0xca, 0x18, 0x52,
-  0xc8, 0x65, 0x8c, 0xa9, 0x65, 0x8c, 0xd9, 0x00, 0xc6, 0x10, 0xf4, 0x33,
-  0xe7, 0x10, 0x5f, 0x52, 0x4c, 0xa9, 0x91, 0x58, 0x27, 0x46, 0xe1, 0x8e,
-  0xd8, 0x4c, 0xca, 0x0a, 0xe6, 0x6c, 0x52, 0x1f, 0x71, 0x85, 0x73, 0xe6,
-  0x15, 0x2d, 0x85, 0x64, 0xb1, 0x67, 0x06, 0xe1, 0xe9, 0xe2, 0xec, 0xcb,
-  0x37, 0xfa, 0x24, 0x59, 0xdf, 0x13, 0x9e, 0xc6, 0x65, 0x83, 0xb3, 0x90,
-  0xe2, 0x78, 0x7d, 0xf6, 0xc5, 0x57, 0x9f, 0x5d, 0xa9, 0xd7, 0x05, 0x4c,
-  0xfe, 0x25, 0xb0, 0x4c, 0xa2, 0xb4, 0x4d, 0x5a, 0xe0, 0xff, 0x55, 0xa4,
-  0x65, 0xe7, 0xfc, 0xb7, 0x37, 0xdd, 0xcc, 0x09, 0xee, 0x6f, 0x89, 0xdd,
-  0xa0, 0x07, 0x6f, 0x53, 0x58, 0x20, 0x6f, 0xd8, 0x5f, 0x2f, 0xb5, 0x9a,
-  0x0b, 0xad, 0xbc, 0xf8, 0x11, 0x59, 0xac, 0x4c, 0x6f, 0x4b, 0x4c, 0xf8,
-  0xa8, 0xd9, 0xc2, 0xe0, 0xc5, 0x32, 0x84, 0x4d, 0x4f, 0x90, 0xa7, 0x55,
-  0xb9, 0x7a, 0xba, 0xc3, 0xb7, 0xe7, 0x39, 0xe5, 0x8e, 0xb3, 0x49, 0x9d,
-  0x1c, 0xc7, 0x61, 0xb2, 0xca, 0x99, 0xf3, 0x1a, 0xed, 0xba, 0xb1, 0x01,
-  0xc1, 0x49, 0xa8, 0xb0, 0x34, 0x1b, 0x9f, 0x74, 0x53, 0x75, 0xc6, 0x72,
-  0xf6, 0x25, 0x4c, 0x5d, 0x77, 0x13, 0x4b, 0x09, 0x39, 0x60, 0xd2, 0x71,
-  0x7e, 0xa5, 0x6e, 0xb7, 0xd9, 0x6a, 0x4b, 0xa8, 0x0c, 0x9d, 0x91, 0x0a,
-  0xd3, 0x3b, 0xe8, 0xad, 0xea, 0xdc, 0xf4, 0xc7, 0x1f, 0x01, 0x73, 0x0e,
-  0x55, 0xe0, 0x09, 0x1b, 0x68, 0x75, 0xc1, 0xe9, 0xb5, 0x2b, 0xf6, 0xf1,
-  0x59, 0x68, 0x42, 0xc4, 0x16, 0x62, 0x03, 0x4b, 0x04, 0x21, 0x83, 0xe1,
-  0x86, 0x1e, 0xbc, 0x05, 0xb5, 0x45, 0xf7, 0x2a, 0xaa, 0x23, 0x7b, 0xce,
-  0x77, 0xa2, 0x8b, 0x9e, 0xbb, 0xf9, 0xef, 0x38, 0xd2, 0xb0, 0xac, 0x48,
-  0x7b, 0xd0, 0x36, 0xd2, 0x35, 0xf9, 0x7b, 0x57, 0x4f, 0xd4, 0x33, 0x35,
-  0xfa, 0x37, 0x18, 0xab, 0x1d, 0xc8, 0x58, 0xf6, 0xa9, 0xd4, 0x27, 0x70,
-  0xd0, 0x67, 0xc0, 0x81, 0x0c, 0x7b, 0x66, 0x7d, 0xb6, 0xfe, 0xd5, 0xf5,
-  0xf4, 0x0e, 0xef, 0x7b, 0x9c, 0x22, 0x82, 0x45, 0x51, 0x66, 0xd7, 0x18,
-  0x54, 0x62, 0x21, 0x35, 0xce, 0x22, 0x90, 0xb4, 0x4c, 0x9a, 0xd5, 0x35,
-  0xaa, 0x03, 0xf2, 0x4a, 0x3a, 0xb5, 0x77, 0xdf, 0x1f, 0x19, 0x51, 0x17,
-  0x74, 0xa2, 0x30, 0x1a, 0x15, 0xe0, 0xfc, 0x3e, 0xe7, 0x8f, 0xac, 0x6a,
-  0xf4, 0xb2, 0xb5, 0xf1, 0x14, 0xba, 0xde, 0x89, 0x88, 0xd0, 0x7a, 0x14,
-  0xdb, 0xf6, 0x51, 0x8e, 0xc8, 0x6e, 0xef, 0x08, 0xa5, 0x8d, 0x73, 0x3b,
-  0xf0, 0x9c, 0x8c, 0xf0, 0xb6, 0x5f, 0xd0, 0x6b, 0x56, 0x1c, 0x9e, 0x3e,
-  0x8b, 0x52, 0x2c, 0x99, 0x8a, 0x62, 0xcd, 0x9c, 0x99, 0x8e, 0x33, 0x9b,
-  0x07, 0x9d, 0x02, 0x49, 0x91, 0xc9, 0x0b, 0x43, 0x8f, 0xcc, 0xa1, 0x13,
-  0xea, 0x74, 0x55, 0x53, 0x1a, 0x8b, 0xe8, 0x28, 0x36, 0x02, 0x49, 0xdb,
-  0x8e, 0x43, 0x5d, 0x1b, 0x27, 0x98, 0x99, 0x5c, 0x52, 0xc5, 0x95, 0xfa,
-  0x1a, 0xcf, 0xe3, 0xcd, 0x40, 0x89, 0x30, 0xe0, 0xa3, 0x37, 0x60, 0xdc,
-  0xb0, 0x00, 0x23, 0x23, 0xff, 0x0e, 0x3a, 0x2a, 0xb3, 0x93, 0x31, 0xe1,
-  0xdb, 0xac, 0xec, 0xdf, 0x05, 0x78, 0x70, 0x32, 0xf2, 0xdc, 0x38, 0x0f,
-  0xc6, 0x10, 0xf6, 0x07, 0xad, 0x5d, 0xa1, 0x9c, 0xdb, 0x69, 0x3d, 0x6c,
-  0xa1, 0xdb, 0xd8, 0xe1, 0x66, 0x26, 0xeb, 0x7f, 0xa8, 0x4c, 0x1e, 0x0f,
-  0xa4, 0x4e, 0xfd, 0x8e, 0x0e, 0x16, 0x45, 0x9b, 0xc4, 0x7b, 0x8e, 0xec,
-  0x1c, 0x44, 0xae, 0x41, 0xfb, 0xf4, 0x56, 0x5d, 0xe7, 0xc5, 0x92, 0x7d,
-  0x33, 0xb4, 0xb3, 0x80, 0xee, 0xe8, 0x1d, 0x85, 0x08, 0xc1, 0x85, 0x1a,
-  0x97, 0x6f, 0xc7, 0x21, 0xe5, 0x54, 0x7b, 0x32, 0xfb, 0x2e, 0x71, 0x6a,
-  0x93, 0xd2, 0x72, 0x41, 0x7b, 0x8d, 0x2e, 0x72, 0x1f, 0xc5, 0xad, 0xe4,
-  0x3e, 0xfd, 0x9a, 0xdc, 0xf0, 0x74, 0x74, 0xf6, 0xe8, 0xff, 0x02, 0x18,
-  0x4c, 0xae, 0xe8, 0x4e, 0x30, 0x01, 0x00
+  0x6b, 0x93, 0xdb, 0x36, 0x92, 0x9f, 0xed, 0x5f, 0x81, 0xd2, 0x4c, 0x22,
+  0x72, 0x2c, 0xce, 0x2b, 0xa9, 0xbb, 0xec, 0xd8, 0x99, 0xd4, 0x6c, 0x26,
+  0x0f, 0x67, 0xc7, 0x89, 0xcb, 0x76, 0x36, 0xd9, 0x3a, 0xef, 0x39, 0x10,
+  0x09, 0x49, 0x5c, 0xf3, 0x65, 0x12, 0x1c, 0x49, 0x49, 0x79, 0x7e, 0xd6,
+  0xfd, 0x81, 0xfb, 0x63, 0xd7, 0x0f, 0x00, 0x04, 0x29, 0xce, 0xc4, 0x76,
+  0xb2, 0x55, 0xe7, 0x4a, 0x2c, 0x09, 0x44, 0x37, 0x1a, 0xfd, 0xee, 0x06,
+  0xe8, 0x60, 0x51, 0xd6, 0xb9, 0xd4, 0x42, 0x8b, 0xc9, 0xa3, 0xa6, 0xad,
+  0xaa, 0x5a, 0x35, 0xcd, 0x0f, 0xad, 0xae, 0x5a, 0x7d, 0x3e, 0x09, 0xef,
+  0x3f, 0x7c, 0x28, 0xd6, 0x9b, 0x27, 0x72, 0x93, 0xe6, 0x52, 0x6c, 0xf2,
+  0x4c, 0x98, 0xc9, 0xc1, 0x5c, 0x36, 0x2a, 0x11, 0x65, 0x21, 0x2e, 0xe5,
+  0x75, 0x9a, 0x88, 0xcb, 0x7a, 0xdb, 0x24, 0x32, 0x53, 0xe2, 0x89, 0xd4,
+  0xab, 0x27, 0x57, 0xa2, 0xaa, 0xd3, 0x42, 0xa7, 0xc5, 0x92, 0x10, 0x5c,
+  0x14, 0x49, 0xad, 0xfe, 0x25, 0xfe, 0x5e, 0x26, 0x65, 0x95, 0x5e, 0xab,
+  0x78, 0x26, 0xc4, 0xe9, 0xf1, 0xf1, 0xa7, 0xd1, 0xe9, 0xf1, 0xc9, 0xa7,
+  0xf8, 0xfc, 0x9b, 0xb6, 0xd0, 0xaa, 0x16, 0x7f, 0xfb, 0xdf, 0xff, 0x29,
+  0xd2, 0x65, 0x93, 0xcb, 0xa2, 0x98, 0x09, 0x7c, 0x06, 0x13, 0x4e, 0x8f,
+  0x71, 0xc2, 0xb3, 0x72, 0xae, 0x6a, 0x2d, 0x2e, 0xcb, 0x24, 0x55, 0x35,
+  0x40, 0x0b, 0x44, 0x70, 0xf2, 0x17, 0xf7, 0x5c, 0x3c, 0x7f, 0x7a, 0xf9,
+  0x73, 0x74, 0x95, 0xc6, 0xaa, 0x68, 0x54, 0xf4, 0x38, 0x51, 0xb0, 0xf6,
+  0x02, 0xa6, 0x9e, 0x89, 0x6f, 0x9e, 0x5e, 0x45, 0xa7, 0x87, 0xc7, 0x0f,
+  0xee, 0xe3, 0xb4, 0x17, 0xab, 0xb4, 0x11, 0x8b, 0x14, 0xa8, 0x4c, 0x9b,
+  0x62, 0xaa, 0x45, 0x92, 0xd6, 0x2a, 0xd6, 0xd9, 0x56, 0x64, 0xa5, 0x4c,
+  0x60, 0x37, 0xf3, 0xad, 0xc8, 0x79, 0xa7, 0xb0, 0xaf, 0x46, 0xcb, 0x5a,
+  0xb7, 0x95, 0x28, 0x17, 0x8e, 0x01, 0x87, 0x88, 0xe4, 0x71, 0xd1, 0x68,
+  0x25, 0x13, 0xb1, 0x54, 0x85, 0xaa, 0xa5, 0x56, 0xaf, 0xd6, 0x1b, 0x60,
+  0xc8, 0x2a, 0xcf, 0x0e, 0x9b, 0xd5, 0x4c, 0xac, 0x57, 0xaa, 0x10, 0x75,
+  0x5b, 0x00, 0xa2, 0xa2, 0x95, 0x59, 0xb6, 0x9d, 0xb9, 0x89, 0x8d, 0x90,
+  0x08, 0xbf, 0xfc, 0x35, 0xad, 0xa6, 0xb0, 0xd8, 0xb5, 0xaa, 0x9b, 0x14,
+  0xd6, 0xd1, 0x2b, 0x60, 0x27, 0xd0, 0x95, 0x16, 0x71, 0xd6, 0x22, 0x15,
+  0x29, 0x8e, 0xa9, 0x8e, 0xeb, 0xf3, 0xb4, 0x90, 0xf5, 0x56, 0xc8, 0x22,
+  0x11, 0x08, 0xdf, 0xc0, 0xe6, 0x84, 0x2e, 0x2d, 0xa5, 0x6d, 0x03, 0x5c,
+  0x16, 0x52, 0x9c, 0x65, 0x69, 0x53, 0x45, 0x6f, 0xda, 0x54, 0x69, 0x11,
+  0x97, 0x39, 0x2c, 0x9f, 0x20, 0xb9, 0xc4, 0x3d, 0xa9, 0x61, 0x21, 0x10,
+  0xce, 0x19, 0x73, 0x40, 0x82, 0x8c, 0x4b, 0x19, 0xaf, 0x44, 0xae, 0x64,
+  0xd1, 0x30, 0x01, 0x6e, 0xb5, 0xa4, 0x54, 0xc4, 0x9b, 0x42, 0x01, 0x29,
+  0xba, 0x44, 0xf8, 0xd7, 0x45, 0xb9, 0xc6, 0x8d, 0xd5, 0x4c, 0x14, 0xed,
+  0x15, 0x57, 0x13, 0x6b, 0xd9, 0x88, 0xbc, 0xbc, 0x66, 0xce, 0x21, 0xcd,
+  0x17, 0x75, 0xbc, 0xba, 0x4a, 0x8b, 0x76, 0x33, 0x13, 0xdf, 0x00, 0x99,
+  0x65, 0x39, 0x43, 0xf8, 0x27, 0x32, 0xae, 0xca, 0x5a, 0x37, 0x33, 0x11,
+  0x6f, 0x97, 0xeb, 0x14, 0x84, 0xbb, 0x48, 0x8b, 0xd7, 0x33, 0xb1, 0x2a,
+  0x73, 0x35, 0xaf, 0xd5, 0x7a, 0x86, 0x14, 0x45, 0x69, 0x11, 0x25, 0xf9,
+  0x72, 0x26, 0x7e, 0x9c, 0x83, 0x36, 0xb4, 0xa2, 0xac, 0x45, 0x93, 0xe6,
+  0x69, 0x26, 0x6b, 0x44, 0x51, 0xc9, 0xf8, 0xb5, 0x5c, 0xaa, 0xfa, 0xd0,
+  0xc8, 0xd1, 0xea, 0x59, 0x64, 0xf5, 0x0c, 0x66, 0x80, 0x82, 0x04, 0xeb,
+  0x55, 0x8a, 0xfb, 0x92, 0xaf, 0x81, 0xdb, 0x20, 0xbb, 0xbc, 0x6c, 0x34,
+  0x0a, 0x50, 0x5b, 0xc1, 0xb3, 0x3e, 0x03, 0xd9, 0x71, 0xad, 0x40, 0x24,
+  0x44, 0xf8, 0x40, 0x81, 0x83, 0xcb, 0x27, 0x97, 0xe1, 0x4c, 0x5c, 0xaa,
+  0x58, 0xe5, 0xa0, 0x75, 0xa8, 0xa9, 0xa7, 0x47, 0xdf, 0xa1, 0x34, 0x41,
+  0x08, 0xf0, 0xe3, 0x13, 0x44, 0x11, 0x67, 0x65, 0xa3, 0x40, 0x71, 0x9c,
+  0x15, 0xe0, 0xee, 0xcb, 0x3a, 0x5d, 0x82, 0xac, 0x32, 0xf1, 0x42, 0xfd,
+  0x0c, 0x32, 0x28, 0xac, 0x84, 0xe3, 0x32, 0x51, 0x28, 0xd5, 0x5c, 0xc6,
+  0x5a, 0x6d, 0x88, 0x75, 0xc4, 0x17, 0x30, 0x25, 0xc1, 0x04, 0x23, 0xf4,
+  0xa2, 0xcc, 0xb2, 0x72, 0x8d, 0x5b, 0x01, 0xda, 0x92, 0x54, 0x93, 0x9c,
+  0xb2, 0xed, 0x19, 0xe9, 0xb7, 0x08, 0xe2, 0x10, 0xf0, 0x54, 0x5b, 0x58,
+  0x62, 0xa5, 0xc5, 0xc9, 0x5f, 0x3e, 0xfb, 0xcf, 0x99, 0x78, 0x06, 0xa0,
+  0xb2, 0x4e, 0xc4, 0x77, 0x87, 0xe2, 0x6b, 0xd8, 0x0c, 0x88, 0x9c, 0xe7,
+  0x82, 0x05, 0x65, 0x19, 0xcc, 0xae, 0x51, 0xbb, 0x81, 0x80, 0x86, 0x74,
+  0x47, 0x26, 0x80, 0x14, 0x7f, 0x9d, 0xb1, 0x3d, 0x6e, 0xc5, 0x37, 0x75,
+  0xf9, 0x6b, 0x4a, 0xa6, 0x76, 0x7c, 0xc2, 0x90, 0x76, 0x0e, 0xec, 0xc1,
+  0x9b, 0xfe, 0x5d, 0x9b, 0xc8, 0x95, 0x78, 0x92, 0x66, 0xcb, 0x5a, 0xe6,
+  0x22, 0xf8, 0xee, 0x09, 0xb0, 0xe7, 0xb9, 0xaa, 0xb4, 0xe3, 0xcf, 0x2e,
+  0xb4, 0xb7, 0xf8, 0x99, 0xf8, 0x2b, 0x88, 0x06, 0xd8, 0xf0, 0x53, 0x9a,
+  0xc1, 0xd6, 0x45, 0xf0, 0xd7, 0xab, 0x9f, 0x00, 0xc1, 0x0f, 0xb1, 0x2e,
+  0x1d, 0x38, 0x69, 0x89, 0xd2, 0xab, 0x32, 0xa1, 0xed, 0x3e, 0xad, 0xcb,
+  0xa4, 0x8d, 0x91, 0x15, 0x6b, 0x72, 0x39, 0x75, 0x99, 0x83, 0x86, 0x1b,
+  0x05, 0x4d, 0xd1, 0x57, 0xe0, 0x1a, 0x6a, 0x43, 0xae, 0x0a, 0x39, 0x0c,
+  0x68, 0x93, 0xb2, 0x50, 0x20, 0x4d, 0x04, 0x97, 0xa2, 0x56, 0xc8, 0x7b,
+  0x98, 0x43, 0xb2, 0x57, 0xa8, 0x1c, 0x64, 0x26, 0xa0, 0xf7, 0x31, 0x80,
+  0x1c, 0x0a, 0xf1, 0x75, 0x5b, 0x24, 0x32, 0x07, 0x1d, 0x65, 0x1b, 0x25,
+  0xcb, 0xd4, 0xb5, 0xec, 0x83, 0x79, 0x2b, 0xe8, 0x5a, 0xa1, 0xd7, 0x40,
+  0x0c, 0x40, 0x5a, 0xa7, 0xf1, 0xf0, 0x1b, 0xb9, 0x42, 0xf2, 0x5c, 0xa7,
+  0x7a, 0xc5, 0xc6, 0x05, 0x5a, 0x09, 0x02, 0x11, 0x4d, 0x3b, 0x6f, 0x74,
+  0xaa, 0xdb, 0x4e, 0x08, 0xc0, 0x94, 0x72, 0x59, 0x10, 0x97, 0xcc, 0x22,
+  0x08, 0x98, 0x16, 0x8b, 0x74, 0x23, 0x8e, 0x00, 0x99, 0x32, 0x5f, 0x40,
+  0x6f, 0xf9, 0x1b, 0xb8, 0x96, 0x78, 0x85, 0x5f, 0x6b, 0x95, 0x49, 0xc6,
+  0x83, 0xbe, 0x69, 0x9b, 0xcf, 0xcb, 0x0c, 0xf6, 0xf1, 0x77, 0x59, 0xa7,
+  0x65, 0xdb, 0x90, 0x4a, 0xae, 0x64, 0xb1, 0x44, 0x27, 0x03, 0x66, 0x9a,
+  0x83, 0x3b, 0x43, 0x1f, 0x41, 0x7a, 0xdf, 0x94, 0x6c, 0xe2, 0xc6, 0x33,
+  0xaf, 0x41, 0x0c, 0x22, 0x4b, 0x5f, 0x2b, 0xa2, 0x1f, 0xf6, 0xd7, 0x66,
+  0xba, 0x41, 0xbb, 0x0a, 0xbc, 0x38, 0xb0, 0xde, 0x00, 0xe3, 0x23, 0x72,
+  0x81, 0x47, 0x18, 0x05, 0xee, 0x07, 0xb8, 0xd1, 0xe2, 0xbe, 0x10, 0xd6,
+  0x8d, 0xc2, 0x7f, 0x85, 0x42, 0x66, 0xa2, 0x59, 0x90, 0x3b, 0x02, 0x8c,
+  0xe4, 0x5b, 0x71, 0x9f, 0xec, 0x59, 0x4b, 0x78, 0x54, 0x00, 0x97, 0x8d,
+  0x8f, 0x01, 0x93, 0xd0, 0x12, 0xec, 0xa0, 0xa9, 0x54, 0x9c, 0xa2, 0x92,
+  0x80, 0xf6, 0xa2, 0x49, 0xd4, 0x0d, 0xe3, 0x5d, 0x97, 0xf5, 0x6b, 0x01,
+  0x72, 0x01, 0xad, 0x00, 0x3b, 0x48, 0xca, 0x35, 0x90, 0x25, 0xc4, 0xde,
+  0x83, 0x66, 0x1e, 0x67, 0x22, 0x68, 0x94, 0x5e, 0x88, 0x66, 0x1e, 0xa5,
+  0x79, 0x95, 0x9d, 0x9d, 0x1d, 0x24, 0x6a, 0x21, 0x81, 0xf2, 0x48, 0x6d,
+  0x58, 0x1d, 0x22, 0xa6, 0xfe, 0x40, 0x9c, 0xfd, 0xf8, 0xe2, 0xeb, 0xe8,
+  0x33, 0x20, 0x19, 0x8c, 0x06, 0x7c, 0x8a, 0xf1, 0x1c, 0xe2, 0x8c, 0xfd,
+  0x25, 0x8f, 0x27, 0x2a, 0x06, 0xc7, 0xa2, 0x22, 0x5d, 0x56, 0xf7, 0xd1,
+  0xb8, 0x2c, 0x45, 0x59, 0x59, 0x09, 0x90, 0x9e, 0xd8, 0x07, 0x67, 0x0c,
+  0xc4, 0x85, 0xf4, 0xf0, 0x00, 0xd5, 0x40, 0x30, 0x47, 0xb2, 0x79, 0x65,
+  0xbe, 0xd5, 0xf3, 0x2a, 0x24, 0x64, 0x40, 0xf8, 0x8f, 0x0d, 0x30, 0xb2,
+  0x44, 0xca, 0x13, 0x54, 0x35, 0xd0, 0xaa, 0x95, 0x6a, 0xd0, 0xe3, 0x80,
+  0x81, 0x03, 0x4d, 0x35, 0xc4, 0xa5, 0x06, 0x15, 0xc6, 0xd0, 0x8c, 0x14,
+  0xc0, 0x6e, 0xde, 0x88, 0xfd, 0x2c, 0xdf, 0xe0, 0x3a, 0x62, 0xef, 0x65,
+  0x10, 0x76, 0xa3, 0xb5, 0x3f, 0xca, 0x2b, 0x5c, 0x88, 0x85, 0x5a, 0x8b,
+  0x6b, 0x90, 0xb6, 0x9c, 0x67, 0x80, 0x6c, 0xbd, 0x02, 0xff, 0x03, 0xbf,
+  0xb3, 0x56, 0x89, 0x58, 0x16, 0x62, 0xae, 0x90, 0xbb, 0x8b, 0x74, 0xd9,
+  0x82, 0xef, 0x60, 0x83, 0xb1, 0x1e, 0x9d, 0xf7, 0xbb, 0x00, 0x58, 0x71,
+  0xb0, 0xde, 0x44, 0x55, 0x56, 0xea, 0xa8, 0x68, 0xf3, 0x03, 0x71, 0x2c,
+  0x26, 0xe8, 0x48, 0x1b, 0x55, 0xe3, 0xd6, 0x61, 0x08, 0xcd, 0xd1, 0x68,
+  0x7e, 0xdc, 0xd6, 0xb8, 0x0d, 0x81, 0xb3, 0x27, 0xa1, 0x87, 0x62, 0x7f,
+  0xbd, 0x41, 0x21, 0xa3, 0x54, 0xc5, 0x64, 0xc2, 0x18, 0xdc, 0xc0, 0x00,
+  0xd8, 0xc5, 0x14, 0x14, 0x6c, 0xb3, 0x52, 0x6a, 0x07, 0x15, 0xa8, 0x49,
+  0x0f, 0x53, 0xa7, 0x36, 0x77, 0xe3, 0x01, 0xfd, 0x55, 0x18, 0x31, 0x87,
+  0xf8, 0x64, 0x01, 0xd3, 0x20, 0x24, 0xcb, 0x16, 0x24, 0x9b, 0x49, 0xd0,
+  0xbe, 0x34, 0x13, 0x93, 0x0b, 0xf8, 0x05, 0xc3, 0x69, 0x8c, 0xb6, 0x2e,
+  0x70, 0x7c, 0x0e, 0x4a, 0x01, 0xea, 0xbb, 0x16, 0x0c, 0x80, 0x66, 0xf5,
+  0x45, 0x0f, 0xd7, 0x7a, 0x03, 0x32, 0xad, 0xbf, 0x04, 0x96, 0x5e, 0xa6,
+  0xb5, 0x23, 0x2f, 0x2b, 0x63, 0x9a, 0xdc, 0x51, 0x94, 0x95, 0xe5, 0x6b,
+  0x2b, 0x67, 0x1c, 0x98, 0x36, 0x46, 0x0e, 0xc4, 0x94, 0x1d, 0x12, 0xd7,
+  0x9b, 0x6f, 0x55, 0x56, 0xdd, 0x8d, 0xb2, 0x51, 0x12, 0xa2, 0xa8, 0x62,
+  0xac, 0x2b, 0x98, 0x7e, 0x1b, 0x2a, 0x9e, 0x7f, 0x05, 0xd1, 0xe4, 0xca,
+  0x22, 0x79, 0x47, 0xac, 0x14, 0xbc, 0x47, 0xb1, 0x02, 0x0f, 0x51, 0xe4,
+  0xaf, 0x9a, 0xf4, 0x57, 0x25, 0xa6, 0x41, 0x90, 0xc3, 0x54, 0x8d, 0x81,
+  0xb8, 0x0a, 0xc5, 0x67, 0xc7, 0xc7, 0xe2, 0x3f, 0x8e, 0x8f, 0x43, 0xa3,
+  0x36, 0x38, 0x03, 0x04, 0x8e, 0x5c, 0x44, 0x90, 0x66, 0x88, 0x87, 0x19,
+  0xe2, 0xb2, 0x1c, 0x86, 0x72, 0xf4, 0x98, 0x71, 0x07, 0x54, 0x91, 0xd9,
+  0x0d, 0xa1, 0x20, 0x48, 0x27, 0x51, 0x59, 0x64, 0xdb, 0x48, 0x82, 0x1b,
+  0x5e, 0x16, 0x82, 0x3f, 0x06, 0x2b, 0xad, 0xd3, 0x64, 0xa9, 0x74, 0xb3,
+  0xb3, 0xd4, 0x4f, 0x3c, 0xee, 0x32, 0x2d, 0xb7, 0x38, 0x98, 0x26, 0xa5,
+  0x4d, 0x87, 0x43, 0x9a, 0xd1, 0x61, 0xc7, 0x75, 0x5a, 0x01, 0x10, 0x5a,
+  0xa9, 0x10, 0x93, 0x67, 0xec, 0xb0, 0x61, 0xaf, 0x10, 0xd4, 0xc1, 0x21,
+  0x6e, 0x33, 0x76, 0xeb, 0x3c, 0x6b, 0x94, 0x77, 0x6d, 0xa3, 0x9a, 0xeb,
+  0x25, 0xab, 0xde, 0x97, 0x94, 0x66, 0x88, 0x06, 0x54, 0x0f, 0x0d, 0x97,
+  0x39, 0xf5, 0xc5, 0x28, 0x58, 0x55, 0x2c, 0x63, 0x99, 0xd6, 0x25, 0x03,
+  0xa2, 0x4b, 0x59, 0x16, 0x2d, 0x3e, 0x01, 0x9d, 0x72, 0xcf, 0xc0, 0xd7,
+  0xe5, 0x94, 0x62, 0xa0, 0x18, 0x1d, 0xeb, 0xfb, 0x08, 0xd1, 0xca, 0xc1,
+  0x03, 0x40, 0x98, 0x2c, 0x92, 0x08, 0x0c, 0x08, 0xfc, 0x69, 0x03, 0x03,
+  0xe8, 0x87, 0x0f, 0x10, 0x39, 0x6f, 0xec, 0x4a, 0x01, 0x97, 0x31, 0x53,
+  0x2d, 0x30, 0x30, 0x9a, 0xa5, 0x08, 0x2d, 0x25, 0x23, 0x34, 0x1d, 0xe5,
+  0xdb, 0x59, 0x08, 0x07, 0x14, 0x7c, 0xc6, 0xb8, 0xbf, 0x80, 0x24, 0x40,
+  0xa3, 0x5b, 0xb3, 0x03, 0xd6, 0xcd, 0x83, 0x3f, 0x4a, 0x4a, 0x08, 0x3b,
+  0x87, 0x3b, 0x64, 0x41, 0x62, 0x0a, 0xfe, 0x58, 0x47, 0xd6, 0x29, 0x7a,
+  0xf4, 0x3c, 0x07, 0x04, 0x9d, 0xb3, 0x24, 0x44, 0x28, 0x78, 0x17, 0x34,
+  0xc0, 0x6c, 0xe1, 0x6f, 0xf6, 0x52, 0x10, 0xe4, 0x30, 0x0c, 0x2a, 0xf1,
+  0x48, 0xcf, 0x8b, 0x73, 0xa1, 0xe5, 0xf2, 0x36, 0x5a, 0x28, 0x9a, 0x40,
+  0x18, 0x03, 0xdc, 0xa9, 0xee, 0xe8, 0xc9, 0x7d, 0xc6, 0x97, 0x59, 0xf2,
+  0xca, 0xee, 0x1f, 0xc8, 0x01, 0x97, 0xcb, 0x3e, 0xf7, 0x2b, 0x90, 0x5a,
+  0x05, 0xe1, 0x2c, 0xe3, 0x48, 0x65, 0x30, 0x52, 0x5e, 0xac, 0xf0, 0x11,
+  0xf2, 0x0d, 0x48, 0xfa, 0xf9, 0xc9, 0x95, 0xc1, 0xda, 0x16, 0x26, 0x36,
+  0x40, 0xbc, 0x06, 0x55, 0xa9, 0x71, 0x42, 0xb0, 0xa1, 0x20, 0x02, 0xa1,
+  0x68, 0x01, 0xee, 0x9d, 0xc6, 0x2a, 0x01, 0x63, 0xf7, 0x82, 0x4c, 0x41,
+  0xb0, 0x0a, 0x02, 0x9d, 0x57, 0xd1, 0xc6, 0x3e, 0x8a, 0x5c, 0xc6, 0x00,
+  0x3e, 0xf1, 0x63, 0x99, 0x57, 0x0f, 0x27, 0x10, 0x05, 0x3e, 0x06, 0x00,
+  0x80, 0x10, 0xfc, 0xe7, 0x2e, 0x88, 0x4c, 0x13, 0xc0, 0x23, 0x41, 0x73,
+  0xde, 0x11, 0x68, 0xc9, 0x40, 0xe7, 0xef, 0x05, 0xb4, 0x77, 0xf2, 0x09,
+  0x41, 0x3d, 0x53, 0xba, 0xad, 0x8b, 0x0f, 0x02, 0x85, 0x42, 0x41, 0x2d,
+  0xa8, 0xca, 0xf8, 0x00, 0xe0, 0xef, 0xd5, 0x3a, 0x03, 0x78, 0x0b, 0x4b,
+  0xc0, 0xfc, 0xfd, 0x3e, 0x23, 0xd9, 0xb8, 0xe8, 0x7c, 0x81, 0x79, 0x35,
+  0x69, 0x2e, 0x58, 0x66, 0x8d, 0x5a, 0x8c, 0xf5, 0x51, 0x5b, 0x40, 0x3c,
+  0x00, 0x94, 0x6b, 0x14, 0x2a, 0x8c, 0x25, 0xe0, 0x13, 0x31, 0x62, 0x98,
+  0xea, 0x0b, 0x74, 0x46, 0xb7, 0xcd, 0x5c, 0x52, 0x86, 0x9e, 0x35, 0x9a,
+  0x51, 0xf5, 0x42, 0x23, 0x67, 0x7e, 0xe8, 0x4c, 0x8c, 0x15, 0x75, 0x6a,
+  0x80, 0xae, 0xc4, 0x21, 0x08, 0x3e, 0x86, 0x24, 0x4b, 0x1b, 0x8c, 0x4c,
+  0xde, 0xde, 0x83, 0x98, 0x7c, 0x70, 0x00, 0x85, 0x50, 0xda, 0xac, 0xa2,
+  0x92, 0xca, 0x6d, 0xa3, 0x29, 0x7e, 0x39, 0x6e, 0x91, 0x9c, 0xdf, 0xc8,
+  0x47, 0x47, 0xde, 0xaf, 0x8f, 0x26, 0x50, 0xeb, 0x0c, 0x74, 0xed, 0xfe,
+  0x3d, 0xfc, 0xc3, 0x1c, 0xa4, 0xd2, 0x41, 0x4c, 0xf7, 0x1b, 0x30, 0x1f,
+  0xd8, 0xa6, 0x5d, 0x3c, 0xfc, 0xfd, 0xe5, 0x51, 0xfd, 0x1f, 0xc2, 0x56,
+  0x7f, 0x82, 0x64, 0x16, 0xc6, 0x39, 0x85, 0x34, 0x05, 0xa5, 0x50, 0x45,
+  0x5c, 0x52, 0xad, 0x8e, 0xaa, 0x8d, 0x1c, 0xc4, 0xca, 0xa6, 0x4b, 0xe3,
+  0x44, 0x4e, 0xd5, 0x49, 0x2c, 0x81, 0xd1, 0x84, 0xc4, 0xf8, 0x5b, 0x60,
+  0x6f, 0xa3, 0x31, 0xb5, 0x52, 0x4d, 0x55, 0x16, 0x09, 0x02, 0xa3, 0x3b,
+  0xf6, 0x73, 0xbc, 0x00, 0xd1, 0x33, 0x55, 0x30, 0xfe, 0xc9, 0x69, 0x68,
+  0x12, 0x3e, 0x54, 0x02, 0x25, 0xf3, 0x61, 0x9a, 0x27, 0x0e, 0x9a, 0x32,
+  0x7e, 0xad, 0x34, 0x78, 0x94, 0xa2, 0xe0, 0x42, 0xe3, 0x20, 0x64, 0x33,
+  0x55, 0xfa, 0xac, 0xd5, 0x0b, 0xcc, 0x00, 0xef, 0xc2, 0x1b, 0xb7, 0x40,
+  0x51, 0xde, 0xa5, 0x91, 0x18, 0x0d, 0x23, 0xdc, 0x1e, 0x52, 0x77, 0x30,
+  0xc4, 0xc4, 0x9b, 0x69, 0x17, 0x8b, 0x0c, 0xf3, 0xac, 0xbc, 0x82, 0xc9,
+  0x75, 0x54, 0x94, 0x58, 0xd3, 0x2f, 0xb3, 0x72, 0x8e, 0x79, 0x85, 0x97,
+  0xa9, 0x52, 0x76, 0x99, 0x42, 0xa5, 0x04, 0xd9, 0x2a, 0xd0, 0x7d, 0x96,
+  0x13, 0x20, 0x92, 0x6a, 0x4a, 0x2a, 0x61, 0x1e, 0xf4, 0x50, 0x85, 0xce,
+  0x39, 0xc9, 0x18, 0xa3, 0x40, 0x19, 0xad, 0x65, 0x4d, 0xce, 0x99, 0x34,
+  0xc2, 0x4a, 0x8e, 0x96, 0xf8, 0x25, 0x80, 0x64, 0x3f, 0x41, 0xc8, 0x39,
+  0x30, 0x11, 0x04, 0x1f, 0x04, 0x14, 0x9a, 0x1c, 0xc8, 0xde, 0xd4, 0x2c,
+  0x6a, 0x06, 0xc0, 0x3e, 0xee, 0x39, 0x7a, 0x7a, 0xcb, 0xee, 0x4e, 0x75,
+  0x86, 0x38, 0xf3, 0xd7, 0x65, 0x1e, 0xfe, 0x82, 0x6e, 0x0b, 0xbc, 0x96,
+  0x65, 0x9f, 0xed, 0x17, 0x45, 0x90, 0x5b, 0xc4, 0xaf, 0x21, 0xda, 0x00,
+  0xfd, 0x29, 0xd7, 0x37, 0x07, 0x42, 0x87, 0x61, 0x0f, 0x47, 0x14, 0x60,
+  0x51, 0x8f, 0xf4, 0x13, 0xb2, 0x10, 0xb0, 0x51, 0x55, 0x61, 0x26, 0xd9,
+  0xd4, 0x1c, 0x0d, 0x88, 0x02, 0xbf, 0xcd, 0x06, 0x22, 0x1b, 0xc0, 0x83,
+  0x6b, 0x63, 0x22, 0xc6, 0x77, 0x26, 0x27, 0x22, 0x80, 0x52, 0x89, 0xcb,
+  0xa9, 0xbd, 0x97, 0x87, 0xe2, 0xda, 0x10, 0x1f, 0x6c, 0x15, 0x1a, 0x1e,
+  0x7a, 0x0e, 0xf5, 0x46, 0x5c, 0x43, 0xaa, 0x9b, 0x9c, 0xd8, 0x47, 0xc9,
+  0xe9, 0x10, 0x48, 0x9c, 0x51, 0xa1, 0x23, 0x82, 0x93, 0x07, 0x34, 0xcf,
+  0x4c, 0xcc, 0x21, 0x92, 0xac, 0x3c, 0x24, 0xe6, 0xb1, 0x48, 0x4e, 0xed,
+  0x0c, 0xb2, 0xeb, 0xc1, 0x04, 0x78, 0x18, 0x5a, 0x1f, 0x14, 0x50, 0xf6,
+  0x34, 0xed, 0x65, 0x51, 0x01, 0xd6, 0xa2, 0x2a, 0xc2, 0x2a, 0x76, 0x09,
+  0xde, 0x08, 0x09, 0xdd, 0x19, 0xa4, 0x95, 0x43, 0x34, 0x17, 0x1d, 0x76,
+  0x6c, 0xa1, 0x98, 0xc5, 0x1c, 0x79, 0x65, 0xc3, 0x1c, 0x07, 0xac, 0xdb,
+  0x9f, 0xbf, 0xb2, 0xac, 0xb3, 0xf3, 0x8c, 0x51, 0x51, 0xfd, 0x18, 0x71,
+  0xfd, 0x30, 0x1d, 0x02, 0x41, 0x86, 0x67, 0x53, 0xa5, 0x89, 0x2f, 0x14,
+  0xf0, 0x6a, 0xf3, 0x36, 0x85, 0x68, 0x09, 0xf5, 0x6a, 0x29, 0x82, 0x4e,
+  0x16, 0x20, 0x0a, 0xc3, 0xf0, 0x74, 0x03, 0x2c, 0x8b, 0xb3, 0x08, 0x3d,
+  0xed, 0xd9, 0x81, 0x11, 0x1f, 0x01, 0x45, 0x3a, 0xcd, 0xd5, 0x01, 0x73,
+  0xce, 0xb2, 0x76, 0x91, 0x2e, 0xde, 0x69, 0x7a, 0x02, 0x7e, 0x19, 0x8c,
+  0xa0, 0xad, 0xdf, 0x69, 0x36, 0xb8, 0x2d, 0x20, 0x05, 0xfc, 0x56, 0x9d,
+  0xbc, 0x0b, 0x29, 0x69, 0x81, 0x91, 0x05, 0x18, 0x83, 0xf6, 0xf9, 0x0e,
+  0x00, 0x3c, 0xb1, 0x41, 0xea, 0x21, 0xb3, 0xb8, 0x1b, 0xc0, 0x29, 0x42,
+  0xe7, 0xd3, 0x87, 0x19, 0xf0, 0x99, 0xb8, 0x91, 0xe8, 0xce, 0x87, 0xb9,
+  0xef, 0x08, 0x28, 0xb7, 0xfa, 0x76, 0xf2, 0x5a, 0x0f, 0x43, 0x3f, 0x13,
+  0x1e, 0x41, 0x31, 0xbe, 0xf6, 0x01, 0xd6, 0x4b, 0x58, 0xb7, 0x58, 0x4b,
+  0x3b, 0xb8, 0x1d, 0x94, 0xf6, 0x27, 0x12, 0x08, 0x9d, 0x00, 0xfd, 0xe9,
+  0x6c, 0x7a, 0x9c, 0x44, 0x37, 0xa7, 0xde, 0x87, 0xe0, 0x8f, 0xb3, 0xde,
+  0x07, 0x2c, 0x62, 0x9d, 0x0a, 0x29, 0x0a, 0xcb, 0x1f, 0xc5, 0x4a, 0xc2,
+  0x32, 0x32, 0x30, 0x9c, 0x1d, 0x59, 0xfb, 0x5b, 0xec, 0xe3, 0xe9, 0x6d,
+  0xa5, 0x76, 0x29, 0x86, 0x42, 0x58, 0x8f, 0x91, 0xfb, 0x7c, 0xdb, 0x68,
+  0x95, 0x3b, 0x20, 0xfe, 0x8f, 0xe2, 0x66, 0x53, 0x2e, 0xf4, 0x9a, 0xaa,
+  0x7f, 0x78, 0x16, 0x7a, 0xbf, 0x2d, 0xdb, 0x40, 0x29, 0x64, 0xbc, 0x82,
+  0xec, 0x82, 0x67, 0x8c, 0x20, 0xc7, 0xa2, 0x4b, 0x60, 0x23, 0x42, 0x51,
+  0x0b, 0x89, 0x5c, 0x89, 0x4f, 0x5e, 0x40, 0xcd, 0xd8, 0xfe, 0x84, 0xf7,
+  0x42, 0x36, 0x10, 0xd0, 0x28, 0x3e, 0x4b, 0xee, 0x08, 0xca, 0x9b, 0x8f,
+  0x6e, 0x3e, 0xb2, 0x8a, 0x06, 0xe5, 0x43, 0x9a, 0x28, 0x69, 0x8b, 0xf3,
+  0xae, 0xc4, 0x86, 0x6c, 0x07, 0x03, 0x7c, 0xda, 0x9c, 0xdd, 0x7c, 0x84,
+  0xd5, 0xae, 0xeb, 0x20, 0x30, 0x09, 0x30, 0xd1, 0x2e, 0xdf, 0xab, 0x86,
+  0xc7, 0xc4, 0x83, 0x55, 0x6a, 0x6f, 0xbe, 0x29, 0x73, 0x0d, 0x6d, 0x93,
+  0xce, 0x8d, 0xe4, 0xce, 0x91, 0x2c, 0x5f, 0xd5, 0x0a, 0xdb, 0xc2, 0xce,
+  0x91, 0x8c, 0xd8, 0x08, 0x36, 0xab, 0x05, 0x64, 0x59, 0xd5, 0x0a, 0x8b,
+  0x77, 0x4e, 0xee, 0x05, 0xba, 0x3d, 0xac, 0x53, 0x78, 0xce, 0xcc, 0xb4,
+  0x50, 0xb1, 0x6f, 0x4d, 0x1b, 0xc4, 0x66, 0xbc, 0xa2, 0x72, 0xbf, 0xb1,
+  0xc9, 0x1c, 0x96, 0xfb, 0x4b, 0x6a, 0xd0, 0x1c, 0x02, 0x79, 0x3b, 0xcb,
+  0x3d, 0x5e, 0x08, 0xe0, 0x44, 0x97, 0xdc, 0xc0, 0x9a, 0x1d, 0x12, 0x58,
+  0x16, 0x82, 0x14, 0xd4, 0x6e, 0xf9, 0x0c, 0x4a, 0x08, 0xd3, 0x02, 0x9c,
+  0x43, 0x31, 0xb7, 0xed, 0x5a, 0x92, 0xb0, 0x19, 0xac, 0x34, 0x44, 0x03,
+  0xda, 0x0c, 0xc6, 0x31, 0xa7, 0x12, 0x31, 0x4f, 0x35, 0x36, 0x98, 0x35,
+  0xf6, 0xcd, 0x47, 0x97, 0xbd, 0xf9, 0x88, 0xfb, 0xd8, 0x0e, 0x05, 0x18,
+  0x95, 0xc4, 0x86, 0x32, 0x6d, 0xfb, 0x5a, 0xa6, 0x5c, 0x32, 0x4a, 0x3d,
+  0x06, 0x8c, 0x3f, 0x57, 0x5a, 0x57, 0xcd, 0xd9, 0xd1, 0x51, 0x03, 0x36,
+  0x14, 0x2b, 0x78, 0xb6, 0x54, 0x87, 0x85, 0xd2, 0x47, 0xd5, 0x11, 0x7b,
+  0x92, 0x23, 0x40, 0xda, 0x8c, 0x01, 0x3f, 0x27, 0xea, 0x68, 0x4d, 0x96,
+  0x01, 0x75, 0xa7, 0xba, 0x06, 0x34, 0xf2, 0x6c, 0x6a, 0x4a, 0xd7, 0x17,
+  0x29, 0xe6, 0x59, 0x53, 0x01, 0xd9, 0xf6, 0x6b, 0x61, 0x8f, 0x2b, 0x2a,
+  0xb9, 0x1c, 0xdf, 0xd3, 0x8b, 0xd2, 0x60, 0xec, 0x31, 0x67, 0x46, 0xfc,
+  0xcd, 0x21, 0x67, 0x10, 0x2b, 0xac, 0x3a, 0xa5, 0x78, 0xde, 0x91, 0x2c,
+  0x64, 0x4c, 0x7c, 0x3f, 0x44, 0xa5, 0xdd, 0xc5, 0x78, 0x61, 0xd9, 0x6f,
+  0x85, 0xd9, 0xa9, 0x03, 0xa5, 0xf3, 0xd4, 0x0e, 0x5e, 0xc8, 0x58, 0x0d,
+  0x44, 0xd3, 0x1d, 0x9f, 0xb4, 0xcb, 0x71, 0x52, 0x7b, 0x67, 0x2c, 0x7f,
+  0x80, 0xfd, 0x4b, 0xc8, 0x94, 0xdb, 0xf9, 0x21, 0x64, 0x55, 0x47, 0x16,
+  0x5f, 0x94, 0xa8, 0x6b, 0x95, 0x95, 0x15, 0x58, 0xe8, 0x91, 0xf5, 0xeb,
+  0x47, 0x69, 0xd3, 0xb4, 0xea, 0xc3, 0xe5, 0x01, 0x15, 0x8f, 0x20, 0x14,
+  0xe3, 0xb2, 0x18, 0xc3, 0xfb, 0x34, 0x53, 0xb8, 0x1f, 0xca, 0xcd, 0x40,
+  0x2b, 0xe1, 0x81, 0xd3, 0x4c, 0x40, 0x0b, 0xfa, 0x4c, 0x8a, 0x5f, 0xd3,
+  0xc2, 0x78, 0x28, 0x22, 0x33, 0xcc, 0xbb, 0xb6, 0x86, 0x08, 0x95, 0xdc,
+  0x8d, 0xd6, 0x1c, 0x58, 0x0d, 0x0e, 0x2f, 0x30, 0x37, 0xa8, 0x73, 0xd3,
+  0x7d, 0xc2, 0x86, 0xb8, 0x5b, 0x81, 0xb1, 0x9e, 0x8d, 0x61, 0x8c, 0xfe,
+  0xc8, 0x9f, 0x0e, 0x61, 0x2f, 0x41, 0xf9, 0xf3, 0x17, 0xe9, 0x65, 0x62,
+  0x07, 0xf0, 0x57, 0xa4, 0x25, 0xd4, 0x0a, 0xd3, 0x60, 0xf2, 0x28, 0x4f,
+  0xcf, 0x27, 0x50, 0xaf, 0x1d, 0xe1, 0x67, 0x2f, 0x91, 0xe5, 0x22, 0x6d,
+  0x89, 0x39, 0xd2, 0x46, 0x54, 0x7e, 0x2f, 0x80, 0x52, 0x30, 0xec, 0x05,
+  0x88, 0x00, 0x1f, 0xe3, 0xd3, 0xae, 0x64, 0x4d, 0x64, 0xa5, 0x6d, 0x23,
+  0xf7, 0xf2, 0xf1, 0x93, 0xaf, 0xbe, 0x7f, 0xfe, 0xf8, 0x87, 0xef, 0xa3,
+  0x8b, 0x67, 0xcf, 0x2e, 0xfe, 0x41, 0xfd, 0xf5, 0x6e, 0xec, 0xf1, 0xf7,
+  0x97, 0x8f, 0xbf, 0xfc, 0xea, 0x39, 0x5a, 0x87, 0x6d, 0xf5, 0xd5, 0xf1,
+  0x11, 0x57, 0xb3, 0x74, 0xd4, 0x74, 0x38, 0x24, 0x46, 0xd6, 0x35, 0xe6,
+  0x53, 0x1b, 0x91, 0x89, 0x5a, 0x7c, 0x2c, 0xdb, 0x0d, 0x9d, 0x62, 0x45,
+  0x4c, 0x90, 0x47, 0x21, 0xe4, 0xb4, 0x41, 0x2c, 0x61, 0xab, 0x40, 0xe2,
+  0x34, 0x7f, 0x43, 0x25, 0xa5, 0x73, 0xfe, 0xd4, 0xa9, 0xf6, 0xe0, 0x70,
+  0x6a, 0x42, 0x53, 0xa1, 0x70, 0x8f, 0xe9, 0xdb, 0x9d, 0x73, 0x09, 0x6d,
+  0xd8, 0xa5, 0x90, 0x76, 0x6e, 0x60, 0xea, 0x70, 0xc8, 0x85, 0x13, 0xea,
+  0x04, 0x05, 0x8d, 0x5c, 0xa8, 0x28, 0x47, 0x16, 0xf9, 0x28, 0xa6, 0x83,
+  0x79, 0x6e, 0x35, 0x6c, 0xfa, 0x1b, 0x48, 0x43, 0x86, 0xa3, 0x03, 0x37,
+  0x85, 0xcc, 0x0b, 0xce, 0x71, 0xc9, 0x62, 0x89, 0x29, 0xc8, 0x00, 0x8b,
+  0x38, 0x06, 0x71, 0x40, 0x59, 0x24, 0x82, 0xcf, 0x6f, 0x9f, 0x63, 0x1f,
+  0xb8, 0xa5, 0xbb, 0xc5, 0x51, 0x78, 0x8f, 0x97, 0x05, 0x1a, 0xda, 0xe5,
+  0xe3, 0xe7, 0x4f, 0xaf, 0x2e, 0xfe, 0xd1, 0x09, 0x68, 0x01, 0xf1, 0x03,
+  0x82, 0x71, 0x51, 0x16, 0x2a, 0xaf, 0x34, 0x1f, 0xe8, 0xe2, 0x52, 0xd4,
+  0x6e, 0xc0, 0x2e, 0x38, 0xb5, 0x54, 0xc1, 0x0c, 0x0d, 0xc4, 0xa1, 0x43,
+  0xca, 0x1c, 0x1c, 0x72, 0x06, 0x53, 0xfa, 0xae, 0xd2, 0x40, 0x0d, 0x83,
+  0x52, 0x2c, 0xf2, 0x5a, 0x98, 0xfc, 0x13, 0x9d, 0x90, 0x1d, 0x80, 0x5c,
+  0xa9, 0x37, 0x81, 0x7f, 0x77, 0x33, 0xba, 0x7d, 0x20, 0xb3, 0x06, 0x0b,
+  0xba, 0x67, 0x42, 0xb8, 0xd3, 0x20, 0x6f, 0x88, 0x68, 0x1c, 0x50, 0x10,
+  0x40, 0xb9, 0x89, 0xbd, 0x01, 0x47, 0xb3, 0xfd, 0x1c, 0xee, 0x65, 0xba,
+  0x8f, 0x65, 0xa4, 0x05, 0x0c, 0x7b, 0x98, 0xf9, 0xcf, 0xce, 0x66, 0xde,
+  0x17, 0xb7, 0x03, 0x1d, 0xc5, 0x3e, 0xe0, 0xcc, 0xfb, 0x20, 0x07, 0xd0,
+  0xbb, 0x29, 0x1f, 0x72, 0xf9, 0xfd, 0xb1, 0x77, 0xb4, 0xf7, 0x17, 0x08,
+  0x3c, 0x8b, 0x8e, 0xd0, 0xdb, 0x46, 0x16, 0x03, 0xf6, 0xd3, 0x55, 0xad,
+  0xf1, 0x98, 0xa4, 0x67, 0xdf, 0x64, 0xf4, 0x7f, 0x5c, 0x4f, 0x7c, 0x32,
+  0x7a, 0x44, 0x14, 0xe5, 0x38, 0x09, 0xb0, 0x6c, 0x18, 0x86, 0x23, 0xae,
+  0xf1, 0x6e, 0xda, 0x83, 0x7f, 0x03, 0xf1, 0xec, 0xf3, 0x16, 0x5e, 0x2b,
+  0xc1, 0x39, 0x9f, 0x46, 0x41, 0x21, 0x2e, 0x21, 0x3b, 0xb6, 0x65, 0xed,
+  0xc6, 0xf8, 0x9f, 0xfd, 0x1d, 0xff, 0xb3, 0x6f, 0xa8, 0x85, 0x58, 0x93,
+  0xa8, 0xcd, 0x2b, 0x07, 0x09, 0x7b, 0x64, 0x4f, 0x83, 0x48, 0x8a, 0x36,
+  0xcb, 0xc8, 0xc3, 0x77, 0x9d, 0x5f, 0x76, 0x90, 0xa5, 0x82, 0xf4, 0x07,
+  0xea, 0x0c, 0xd3, 0x25, 0x46, 0x0f, 0xcb, 0x5f, 0x7d, 0x67, 0xd2, 0x91,
+  0x13, 0xe1, 0x31, 0xb8, 0xf3, 0x5f, 0x1e, 0x95, 0x0c, 0xf4, 0xb9, 0x37,
+  0x04, 0xb9, 0x76, 0x88, 0xe7, 0x40, 0x01, 0x77, 0xfe, 0x54, 0x81, 0x49,
+  0x9c, 0x41, 0x2e, 0x4c, 0xa0, 0xa2, 0x3e, 0x4c, 0x07, 0x31, 0x9b, 0x84,
+  0x5d, 0xec, 0xea, 0x56, 0xcf, 0xeb, 0x72, 0x1d, 0x99, 0x03, 0x07, 0xac,
+  0x90, 0xa9, 0x89, 0x71, 0x0b, 0xda, 0x23, 0x9c, 0x7c, 0x3e, 0xe9, 0x76,
+  0x46, 0x93, 0x5d, 0x9b, 0x76, 0x7c, 0x7b, 0x7d, 0x49, 0xba, 0x3d, 0x0e,
+  0x7d, 0x88, 0x39, 0x79, 0x45, 0x84, 0xc3, 0x47, 0x34, 0x08, 0x9b, 0xa2,
+  0xc5, 0x43, 0x31, 0xa0, 0xb8, 0xc7, 0xbe, 0xd0, 0xcd, 0x46, 0x07, 0x7c,
+  0xd4, 0xdf, 0xea, 0x50, 0x89, 0x06, 0xb4, 0xf8, 0xa6, 0xbb, 0x43, 0x8d,
+  0xff, 0xf0, 0x4f, 0xa3, 0xa7, 0xaf, 0xc3, 0x1d, 0x39, 0x43, 0x37, 0xe5,
+  0x53, 0x33, 0x7c, 0xf6, 0x27, 0x13, 0x33, 0xc6, 0x9d, 0x5d, 0xcf, 0xb6,
+  0x4b, 0xd0, 0xbf, 0x83, 0x3f, 0x79, 0xde, 0x66, 0x3a, 0xf5, 0xc9, 0xe1,
+  0x3f, 0xf7, 0xef, 0x61, 0xe7, 0x1b, 0x0b, 0xc4, 0xcc, 0xea, 0xab, 0xc9,
+  0xff, 0xe8, 0x50, 0xed, 0x51, 0x0f, 0x0e, 0xd2, 0x5d, 0xfd, 0x65, 0x59,
+  0x6d, 0x3f, 0x7f, 0x39, 0xb9, 0xf9, 0x0d, 0x0a, 0xd7, 0xb7, 0x2f, 0x27,
+  0xa8, 0xc1, 0x9d, 0x4d, 0x62, 0xc3, 0xe7, 0xde, 0x3d, 0xde, 0x52, 0xcf,
+  0xf8, 0x11, 0x19, 0xfe, 0x3f, 0xcd, 0xe9, 0xb4, 0xdf, 0x7e, 0xd2, 0xf4,
+  0x31, 0xd1, 0x8d, 0x72, 0x90, 0x70, 0xef, 0xd8, 0xd4, 0x7d, 0xdb, 0xc2,
+  0x17, 0xbe, 0xd1, 0x62, 0x00, 0x63, 0x48, 0x60, 0x84, 0x37, 0xe5, 0x1d,
+  0xcc, 0x8d, 0x68, 0xda, 0x35, 0xb4, 0x31, 0x8d, 0x7f, 0x0f, 0x8a, 0x8e,
+  0x7a, 0x9c, 0xfc, 0x10, 0x9a, 0x6a, 0x4f, 0x9e, 0x3b, 0xe2, 0x34, 0x8f,
+  0xc6, 0x63, 0xc5, 0x78, 0x88, 0xf1, 0xf3, 0xd9, 0x45, 0x3f, 0x8b, 0xb5,
+  0xc9, 0x6b, 0x97, 0x77, 0x82, 0x9e, 0x50, 0xba, 0xb2, 0x70, 0x69, 0xab,
+  0x6d, 0x4f, 0xb9, 0xec, 0xd5, 0x0e, 0x64, 0x46, 0xa7, 0x71, 0xee, 0x40,
+  0xb7, 0x40, 0x30, 0x74, 0xbe, 0x78, 0xfe, 0xa8, 0x42, 0xf5, 0x74, 0xa3,
+  0x47, 0xf8, 0xf3, 0x7e, 0xc7, 0xb5, 0x81, 0x96, 0xf4, 0xf3, 0xe2, 0x85,
+  0xa3, 0x8a, 0x57, 0x1c, 0x5d, 0x8f, 0x4a, 0x0c, 0xb3, 0x96, 0x31, 0x1e,
+  0xb7, 0x80, 0x5b, 0xd5, 0x5a, 0x15, 0x5e, 0x62, 0x99, 0x62, 0x9f, 0x85,
+  0x8e, 0x45, 0x5c, 0x92, 0x4d, 0xab, 0x61, 0x4c, 0x42, 0xd9, 0xf6, 0x0c,
+  0xd5, 0xec, 0x78, 0x68, 0x9e, 0xbe, 0x4c, 0x7b, 0x6b, 0xc0, 0x07, 0xd3,
+  0x42, 0x71, 0x03, 0xc2, 0xc6, 0xcc, 0x04, 0x0f, 0x61, 0x1b, 0x3e, 0x66,
+  0x11, 0x0a, 0xfa, 0xae, 0xf3, 0x43, 0xc7, 0x1a, 0x78, 0x4d, 0x08, 0xcb,
+  0x26, 0x11, 0x5c, 0x43, 0x05, 0x0f, 0x5f, 0x18, 0xe0, 0x97, 0x5f, 0x02,
+  0xa6, 0x08, 0x1f, 0x71, 0xa3, 0x7c, 0x36, 0xc3, 0x19, 0xb3, 0x19, 0xce,
+  0x19, 0x74, 0xa1, 0xcd, 0xbc, 0x3e, 0x8a, 0xa0, 0x43, 0xed, 0x8e, 0xbd,
+  0x60, 0x42, 0xe8, 0xfd, 0x24, 0x54, 0x3e, 0xae, 0xdd, 0x13, 0xc6, 0xa0,
+  0x50, 0x6b, 0xa3, 0xe5, 0x65, 0x96, 0xd0, 0x35, 0x9c, 0x0d, 0x2b, 0x15,
+  0xdd, 0xc4, 0x02, 0x4b, 0xf6, 0xd9, 0x69, 0xc7, 0xbc, 0x13, 0x05, 0x07,
+  0x15, 0x7a, 0x4a, 0x48, 0x79, 0x80, 0x43, 0x20, 0x36, 0x56, 0x03, 0x46,
+  0x82, 0x29, 0x8b, 0xd5, 0x1e, 0x2a, 0x6c, 0xc4, 0xb1, 0xb7, 0x30, 0x3d,
+  0x72, 0x04, 0xda, 0x99, 0x3b, 0x7b, 0xd8, 0xd9, 0xc2, 0x7d, 0x77, 0x30,
+  0xe8, 0x21, 0xc6, 0xd3, 0x0a, 0x87, 0xda, 0xe4, 0x66, 0x78, 0xcc, 0xf5,
+  0x35, 0xb5, 0xb5, 0xd7, 0x8a, 0x5b, 0x35, 0x54, 0xdc, 0x1b, 0x55, 0x6a,
+  0x4c, 0xab, 0x0d, 0x6f, 0x98, 0xe1, 0x5d, 0x1a, 0x95, 0x74, 0x37, 0x68,
+  0xe7, 0x5b, 0xb6, 0x51, 0xc1, 0x47, 0xed, 0x0d, 0xa1, 0x4a, 0xc0, 0x6b,
+  0x81, 0x02, 0xcb, 0x42, 0x37, 0x3d, 0xf9, 0x99, 0xeb, 0x57, 0xaf, 0x9c,
+  0x4f, 0x42, 0xeb, 0xfd, 0xb8, 0xac, 0xcc, 0xe5, 0xc1, 0x00, 0xbe, 0x09,
+  0x9b, 0xea, 0x06, 0x6d, 0x91, 0xa9, 0xc6, 0xc4, 0x0e, 0x3a, 0x3a, 0xf7,
+  0xad, 0x67, 0x33, 0x7a, 0xc6, 0xd2, 0x55, 0x96, 0x49, 0xc9, 0x1a, 0xde,
+  0xec, 0x14, 0xa5, 0xfb, 0x55, 0x0b, 0xd3, 0x05, 0x2e, 0x35, 0x65, 0x95,
+  0xea, 0xc8, 0x31, 0xb3, 0x4a, 0xcc, 0xe7, 0xef, 0x26, 0x1c, 0x58, 0xf0,
+  0xff, 0x8b, 0x74, 0x95, 0x8c, 0x13, 0xef, 0x26, 0x54, 0xdd, 0x95, 0x04,
+  0x4b, 0x5e, 0xd7, 0x8a, 0xb0, 0x2b, 0xd4, 0x74, 0xaa, 0x1f, 0x51, 0xfb,
+  0xc1, 0x83, 0x74, 0x3a, 0x6d, 0xce, 0xdf, 0xe8, 0xee, 0x96, 0xd5, 0x28,
+  0xb0, 0xbf, 0xed, 0x1c, 0xcf, 0xb0, 0xae, 0xc1, 0x23, 0x9b, 0x23, 0xe9,
+  0x28, 0xc6, 0x46, 0x91, 0x3d, 0x6e, 0xa2, 0xe9, 0x98, 0x01, 0xbb, 0xb3,
+  0x38, 0x32, 0x1d, 0xbe, 0x9a, 0x24, 0x26, 0xaf, 0x26, 0x74, 0x59, 0x50,
+  0x9c, 0xe1, 0xb2, 0x11, 0x3a, 0x3e, 0x6d, 0xe6, 0xed, 0x45, 0x4b, 0x3c,
+  0x57, 0x3d, 0xc0, 0xee, 0x94, 0xc6, 0xae, 0xdc, 0x01, 0x9a, 0x4e, 0xb5,
+  0x8d, 0xdc, 0x00, 0x17, 0xc3, 0x96, 0x7e, 0x33, 0x9f, 0xcf, 0xba, 0xdc,
+  0x1c, 0x26, 0xc6, 0x43, 0x12, 0x8a, 0x33, 0xa6, 0xd6, 0xed, 0x9b, 0x6e,
+  0x6f, 0x03, 0x51, 0xdd, 0xf5, 0x0c, 0xd8, 0x9c, 0xdb, 0x21, 0x6f, 0xf7,
+  0x01, 0x4e, 0x10, 0xee, 0x98, 0xd0, 0x1a, 0x55, 0x74, 0xed, 0x9d, 0x38,
+  0xd2, 0xcc, 0x63, 0x41, 0x96, 0xb5, 0x33, 0x8b, 0xb2, 0x08, 0xa6, 0x8b,
+  0x38, 0xec, 0xae, 0x8a, 0x8c, 0xa6, 0xd6, 0xfb, 0x13, 0x61, 0xe0, 0x76,
+  0x56, 0xfc, 0x00, 0x3c, 0x3b, 0x38, 0xd2, 0x02, 0x54, 0x2c, 0xa5, 0x8e,
+  0x45, 0xa4, 0xea, 0xba, 0xac, 0x1b, 0x76, 0xfb, 0x83, 0x13, 0x49, 0x06,
+  0xe5, 0x03, 0x30, 0x62, 0xd2, 0xb0, 0x91, 0x62, 0x69, 0x14, 0xc7, 0x5d,
+  0x60, 0x2a, 0x09, 0x0e, 0x71, 0x10, 0x4e, 0x0c, 0xc5, 0xfd, 0x3b, 0x56,
+  0xd3, 0x7d, 0xf0, 0x22, 0x1c, 0x67, 0xbc, 0x7e, 0x0b, 0xae, 0x05, 0xfc,
+  0x1d, 0x19, 0xe6, 0x15, 0xec, 0xa3, 0x7d, 0x6e, 0x9b, 0x8d, 0x99, 0x80,
+  0x37, 0xc1, 0x31, 0x6a, 0xc4, 0xca, 0x0d, 0x2f, 0xfc, 0x1c, 0xd1, 0x05,
+  0xf5, 0xb1, 0xec, 0x90, 0x23, 0x23, 0x5e, 0xc5, 0xe0, 0x38, 0x38, 0xf8,
+  0xe9, 0xc2, 0xa2, 0xe1, 0x80, 0x97, 0x4a, 0xda, 0x11, 0xac, 0xd9, 0x2c,
+  0x55, 0x4e, 0x15, 0xa6, 0x44, 0xd8, 0xba, 0xac, 0x99, 0xf0, 0x41, 0xca,
+  0x9a, 0xf2, 0x0a, 0x58, 0xb7, 0x39, 0x45, 0xb0, 0xe8, 0x20, 0xb6, 0x78,
+  0x1c, 0xc6, 0x97, 0x03, 0xec, 0x6e, 0x21, 0x43, 0x8a, 0x65, 0x8d, 0x17,
+  0x52, 0x33, 0xd0, 0x0f, 0x24, 0xe2, 0x57, 0x55, 0x83, 0xde, 0xf6, 0x4d,
+  0xba, 0x19, 0x59, 0xaf, 0xe0, 0xf5, 0x0a, 0x5e, 0x2f, 0x14, 0x23, 0x1d,
+  0x8d, 0x21, 0xd3, 0x76, 0xa8, 0x0c, 0x43, 0x1b, 0x51, 0xfa, 0x19, 0x5c,
+  0xd1, 0xe6, 0xf6, 0xfd, 0x11, 0xc8, 0xf3, 0x73, 0xff, 0x04, 0xb9, 0x16,
+  0x74, 0x9e, 0x4a, 0xd7, 0xf8, 0xd5, 0xa6, 0x82, 0x9c, 0xbf, 0xe8, 0xec,
+  0x92, 0x8e, 0x66, 0x83, 0xc0, 0x68, 0x63, 0x25, 0x18, 0xf8, 0xde, 0x18,
+  0x21, 0x40, 0xfe, 0x6f, 0x37, 0xf1, 0xcd, 0x5b, 0xb3, 0x85, 0x40, 0xe1,
+  0x25, 0xaf, 0x04, 0x34, 0x96, 0x60, 0x9c, 0xc8, 0xb5, 0x85, 0xb6, 0x69,
+  0xd1, 0x60, 0x5e, 0xef, 0xb1, 0xa5, 0x07, 0x24, 0xca, 0x77, 0xde, 0xa7,
+  0x0a, 0x40, 0xce, 0x34, 0x1e, 0xff, 0xef, 0x19, 0x0b, 0x8b, 0xd4, 0x9b,
+  0x56, 0x66, 0x1d, 0xa0, 0x21, 0x99, 0x22, 0x7f, 0xb7, 0x9f, 0x7b, 0x3b,
+  0x0a, 0xb7, 0x4b, 0xb2, 0x93, 0x2f, 0x12, 0x79, 0xaf, 0xa3, 0xc2, 0xf1,
+  0xc7, 0x58, 0x68, 0xc1, 0xb7, 0xdc, 0x15, 0xc7, 0x07, 0x8f, 0xb4, 0xc0,
+  0x3e, 0xa8, 0x43, 0xbe, 0x13, 0x74, 0xef, 0x16, 0x5a, 0x7b, 0x8a, 0x14,
+  0x60, 0xa6, 0xf0, 0xb9, 0x49, 0x88, 0x1d, 0xc5, 0x90, 0xc0, 0x3f, 0x60,
+  0xad, 0x1c, 0x70, 0x22, 0x4e, 0xfc, 0x69, 0x5d, 0xba, 0xbb, 0x3b, 0xcf,
+  0x9f, 0x36, 0xc2, 0x01, 0x9b, 0x66, 0x9a, 0xbc, 0x73, 0xc0, 0x8e, 0x47,
+  0xab, 0xf3, 0x83, 0x47, 0x47, 0x2b, 0x18, 0x86, 0x6a, 0x85, 0x1e, 0x9e,
+  0x1c, 0xf3, 0x83, 0xc1, 0xbc, 0x23, 0x9e, 0x60, 0xb2, 0x60, 0x8b, 0x74,
+  0x44, 0xa7, 0xc6, 0x35, 0x93, 0x9c, 0x67, 0x05, 0x31, 0x37, 0x23, 0x37,
+  0xbe, 0xcd, 0x39, 0xe9, 0xab, 0xd0, 0x93, 0x1b, 0x35, 0x2d, 0xeb, 0x2e,
+  0x54, 0xc2, 0x27, 0x16, 0x11, 0x7e, 0x9c, 0xdc, 0x41, 0xe3, 0xfc, 0xe0,
+  0xee, 0xa5, 0x40, 0x5f, 0xfe, 0x37, 0x72, 0x42, 0xe8, 0xfa, 0x89, 0x7a,
+  0xc5, 0xc1, 0xe6, 0xdd, 0x62, 0x2a, 0x83, 0xef, 0x42, 0x1b, 0x1d, 0x1c,
+  0xb8, 0x6a, 0xde, 0x13, 0x3b, 0x6a, 0xe3, 0xa7, 0x58, 0x75, 0x02, 0x95,
+  0x69, 0x03, 0x7a, 0x0c, 0xe5, 0x5a, 0xb0, 0xf7, 0x72, 0x1f, 0x6f, 0x1f,
+  0x86, 0x4e, 0x7b, 0xd4, 0x1b, 0x4f, 0xd0, 0x2e, 0xd8, 0x31, 0xc4, 0x89,
+  0xaf, 0x03, 0xbf, 0xbf, 0x24, 0x69, 0xe0, 0x60, 0xc5, 0xbd, 0x97, 0x1f,
+  0xf5, 0xf0, 0x83, 0x52, 0xee, 0x17, 0x78, 0x6a, 0x0b, 0xd5, 0x9e, 0x01,
+  0x1c, 0x8f, 0x6d, 0xd3, 0x09, 0xeb, 0xf9, 0x18, 0x45, 0xf7, 0x76, 0xe9,
+  0xf4, 0x08, 0xdd, 0xc7, 0x13, 0x12, 0x83, 0xdf, 0x2e, 0x3b, 0xba, 0xc4,
+  0x17, 0x13, 0xb3, 0x09, 0x0f, 0x58, 0xdb, 0xa1, 0x11, 0xd6, 0xef, 0xc8,
+  0xdc, 0x42, 0xdf, 0xba, 0x04, 0x18, 0x9e, 0x77, 0xaa, 0x14, 0x3a, 0x19,
+  0xa2, 0x39, 0x76, 0xc3, 0x63, 0x1d, 0x54, 0x70, 0x58, 0xbd, 0xf2, 0xd7,
+  0xbb, 0x07, 0xe9, 0x4a, 0x48, 0xe3, 0xf6, 0x5c, 0x75, 0xcf, 0xbe, 0x09,
+  0xc5, 0xce, 0x47, 0x50, 0x03, 0xf7, 0xbc, 0x31, 0xbd, 0x0f, 0x16, 0xe4,
+  0xee, 0x59, 0x95, 0x17, 0xb2, 0x7e, 0x6f, 0xa6, 0x71, 0x46, 0x32, 0x4b,
+  0x65, 0x63, 0x25, 0x32, 0x62, 0x72, 0xa3, 0xb3, 0x0d, 0x6a, 0xff, 0xde,
+  0x2c, 0x09, 0x14, 0x19, 0x6d, 0x2e, 0x89, 0xee, 0x30, 0x7a, 0x63, 0x17,
+  0x71, 0xc7, 0x3d, 0x73, 0xd4, 0xa1, 0x0a, 0x6f, 0x43, 0xd2, 0x8c, 0x84,
+  0xee, 0x9e, 0xf9, 0x3f, 0x5c, 0xa5, 0xdb, 0xc3, 0xec, 0x1b, 0x29, 0x24,
+  0x01, 0xf2, 0xe5, 0x64, 0xe2, 0x5d, 0x37, 0xc5, 0x15, 0xc6, 0x7b, 0xa1,
+  0x8d, 0x3e, 0x37, 0x13, 0xb1, 0x62, 0xc6, 0x5f, 0x8e, 0x45, 0xd8, 0xbf,
+  0xe8, 0xb6, 0x31, 0x8c, 0xa0, 0x7b, 0xbf, 0xd1, 0x55, 0x10, 0x3e, 0x9f,
+  0xfb, 0x2f, 0xca, 0x3a, 0xfe, 0x7b, 0x76, 0xf3, 0xf6, 0x9f, 0x6f, 0x39,
+  0xb0, 0x72, 0x15, 0xc7, 0x48, 0xa2, 0x24, 0xcd, 0x55, 0xd1, 0x50, 0x51,
+  0xe6, 0x1a, 0x55, 0x81, 0x2d, 0xd4, 0x6e, 0x5f, 0xc2, 0x06, 0x69, 0x83,
+  0x6b, 0xf4, 0x0a, 0xa9, 0xa9, 0x29, 0x3b, 0x2f, 0xc6, 0x96, 0x77, 0xbb,
+  0x2b, 0xea, 0x79, 0xb3, 0x8b, 0x09, 0x11, 0xe4, 0xcb, 0x4e, 0xc9, 0xfc,
+  0xae, 0x4d, 0x3f, 0xa7, 0x19, 0xb0, 0xe1, 0x8b, 0x7f, 0x12, 0x71, 0x6f,
+  0x2d, 0x75, 0xf6, 0xea, 0x27, 0x5f, 0x7a, 0xa1, 0xfb, 0x33, 0xde, 0x66,
+  0xad, 0xd3, 0xc2, 0xe1, 0xa8, 0x5c, 0x50, 0x0f, 0x3d, 0xf8, 0xe6, 0xd9,
+  0xc5, 0xd3, 0x6f, 0xc5, 0xe5, 0x63, 0xfa, 0x0c, 0x7f, 0x87, 0x09, 0x9d,
+  0x96, 0x23, 0x8e, 0x0a, 0xd5, 0x0f, 0x96, 0x6c, 0x63, 0xf0, 0xe9, 0x80,
+  0x71, 0xfe, 0x2f, 0xa8, 0x6c, 0x0d, 0x06, 0x3e, 0x0c, 0x40, 0x99, 0x8e,
+  0x7a, 0xf0, 0x66, 0xe2, 0xe8, 0xda, 0x89, 0xee, 0x20, 0x7f, 0xbe, 0xbb,
+  0x7b, 0x3e, 0x72, 0x65, 0x57, 0x74, 0x28, 0x3b, 0x8e, 0xad, 0x64, 0xb3,
+  0x8a, 0xb8, 0x62, 0xb9, 0x8b, 0x6d, 0xdf, 0xc2, 0xb4, 0x17, 0x38, 0xeb,
+  0xad, 0x3b, 0x76, 0x76, 0x76, 0xd8, 0x4f, 0xb3, 0x83, 0x7e, 0x09, 0xc7,
+  0xf3, 0xf4, 0x98, 0x15, 0x6e, 0x42, 0x97, 0x21, 0xd5, 0xee, 0x30, 0x7a,
+  0x8d, 0x77, 0x5e, 0xf1, 0x5e, 0x4b, 0x85, 0xdd, 0x02, 0xf7, 0x4e, 0x59,
+  0x93, 0x16, 0xc0, 0xb1, 0x1a, 0x2f, 0xca, 0xe0, 0x3b, 0x03, 0xb2, 0xc0,
+  0x11, 0xa8, 0x2d, 0x67, 0x62, 0x8e, 0xb7, 0x8a, 0xcc, 0x5b, 0xb2, 0x6b,
+  0x7e, 0x19, 0x8d, 0x31, 0x21, 0x88, 0xb4, 0x6f, 0xb9, 0x61, 0xe7, 0x0e,
+  0x9b, 0xbd, 0x43, 0x77, 0x66, 0x95, 0xd8, 0xb8, 0x34, 0xdf, 0xb7, 0x92,
+  0x17, 0x33, 0xc2, 0xe8, 0x9f, 0xbf, 0x2f, 0x8a, 0x9c, 0x0f, 0xe0, 0xe9,
+  0x4b, 0x97, 0xe6, 0x71, 0x4f, 0xc2, 0x1d, 0x63, 0xf7, 0x3b, 0x6a, 0x8b,
+  0xa2, 0xeb, 0xa3, 0x8d, 0xb5, 0x73, 0x09, 0x49, 0xdd, 0x21, 0x41, 0x63,
+  0x83, 0x6a, 0x9d, 0xce, 0x3e, 0x43, 0x57, 0x95, 0x13, 0xa8, 0x45, 0x8c,
+  0x68, 0x8f, 0x08, 0x2f, 0x27, 0x5f, 0xe2, 0xb6, 0xf6, 0x5f, 0x47, 0x49,
+  0x3d, 0xe2, 0xd2, 0xe1, 0x3b, 0x6b, 0x62, 0x9f, 0x09, 0xbc, 0xf3, 0xab,
+  0x13, 0x93, 0xf1, 0xd1, 0xad, 0x02, 0x77, 0x42, 0xef, 0x60, 0x22, 0xad,
+  0xf2, 0x2a, 0x93, 0x5a, 0xd9, 0x82, 0xed, 0xea, 0x74, 0xf7, 0x2c, 0xbc,
+  0xcf, 0x6b, 0xd7, 0x58, 0xa7, 0x3d, 0x52, 0x24, 0x72, 0x1d, 0x50, 0x30,
+  0xfc, 0x0a, 0x07, 0xf6, 0xa6, 0x41, 0x26, 0xf3, 0x79, 0x22, 0x21, 0x6a,
+  0x9f, 0x08, 0x75, 0x1a, 0xba, 0xfe, 0xaa, 0xf9, 0x09, 0x1f, 0xbf, 0xa0,
+  0x59, 0x52, 0x6e, 0x29, 0x66, 0xf0, 0x73, 0xa6, 0xf0, 0x36, 0xac, 0x00,
+  0x82, 0xaf, 0x4e, 0xbb, 0x6e, 0x2f, 0x1f, 0x05, 0xee, 0xec, 0xd9, 0xbe,
+  0xe9, 0x88, 0xae, 0x6d, 0x4c, 0xf6, 0x7e, 0x2c, 0xf3, 0x83, 0x99, 0xe1,
+  0x58, 0xda, 0x40, 0xec, 0x89, 0x74, 0x19, 0xf9, 0xe1, 0x74, 0xc8, 0x22,
+  0x9a, 0x14, 0x5a, 0x25, 0xaf, 0x1d, 0xca, 0xdf, 0x43, 0x35, 0xc2, 0x6d,
+  0x87, 0xca, 0x50, 0x53, 0x13, 0xca, 0xcd, 0x68, 0x63, 0x15, 0x35, 0xa4,
+  0x46, 0xbb, 0x2d, 0xa9, 0x55, 0x5a, 0x92, 0xda, 0xf5, 0xb5, 0x60, 0x33,
+  0xc2, 0x11, 0x7a, 0xed, 0x7b, 0xa8, 0x00, 0xd8, 0x94, 0x28, 0x2b, 0xbf,
+  0x95, 0x4d, 0x2c, 0x82, 0x84, 0xd5, 0x86, 0x75, 0xe3, 0x18, 0xb1, 0x0b,
+  0x1c, 0xe4, 0x78, 0x11, 0xb5, 0x01, 0x7c, 0xf4, 0xd9, 0xcb, 0xe4, 0x06,
+  0x89, 0x16, 0x5e, 0x81, 0xf6, 0x12, 0x2d, 0x22, 0xf6, 0x80, 0x89, 0xa5,
+  0xa1, 0x89, 0xcd, 0xc4, 0x8d, 0xa3, 0x81, 0x72, 0xd3, 0xb4, 0x6c, 0x71,
+  0xed, 0xb2, 0xea, 0xa5, 0x7f, 0xd8, 0x0e, 0x42, 0x7e, 0x21, 0x0d, 0x2e,
+  0x52, 0x85, 0xde, 0x77, 0xda, 0x9b, 0x4f, 0xc2, 0x6d, 0xac, 0xef, 0xb0,
+  0xf4, 0x44, 0x27, 0x82, 0x6d, 0xd7, 0x16, 0xa3, 0xdf, 0x6a, 0xa3, 0x23,
+  0xec, 0x7c, 0xc3, 0xff, 0xde, 0x48, 0xcd, 0x2f, 0x74, 0x86, 0xc3, 0x4a,
+  0x92, 0xca, 0xb2, 0xad, 0x53, 0xf1, 0x81, 0xe7, 0x31, 0xc7, 0xd5, 0xe2,
+  0xa1, 0x71, 0x76, 0x7c, 0xad, 0x0f, 0xef, 0x6a, 0xac, 0x48, 0x60, 0xc6,
+  0xb9, 0x30, 0x16, 0x22, 0x63, 0x1b, 0x7e, 0x28, 0xae, 0x99, 0xd0, 0x65,
+  0x69, 0x8b, 0x52, 0xec, 0xfa, 0x21, 0x5e, 0x3a, 0xfd, 0x02, 0xd2, 0xed,
+  0xa6, 0x68, 0x4f, 0x3c, 0xa7, 0xa6, 0x9f, 0x5e, 0x5b, 0xd9, 0xae, 0x2f,
+  0xec, 0x7e, 0xcb, 0xca, 0x69, 0xe5, 0x0e, 0x89, 0x5e, 0x39, 0x59, 0x64,
+  0xb6, 0x4d, 0x5f, 0x64, 0x9e, 0xa3, 0xc4, 0x89, 0x94, 0x4a, 0x66, 0x96,
+  0x75, 0xa0, 0xbf, 0x99, 0xc5, 0xf7, 0x0e, 0x90, 0x6c, 0x4b, 0x28, 0xac,
+  0x0e, 0x05, 0x69, 0xd0, 0xd6, 0xd2, 0x41, 0xbf, 0x32, 0xd3, 0xb2, 0x1b,
+  0x71, 0x05, 0x36, 0x99, 0xb5, 0xe0, 0x24, 0x3b, 0x08, 0x1f, 0x1b, 0xbc,
+  0x99, 0x37, 0x78, 0x2f, 0x1b, 0x02, 0x3f, 0xdd, 0x00, 0x04, 0xb5, 0x7e,
+  0x08, 0x40, 0x66, 0x02, 0x91, 0x00, 0x8f, 0x58, 0x8b, 0xe8, 0xcd, 0xb5,
+  0x54, 0x37, 0x16, 0x4f, 0xa6, 0x16, 0x7a, 0x26, 0x6a, 0x33, 0x2a, 0xe8,
+  0x95, 0xfa, 0x43, 0x5a, 0x8d, 0x5e, 0xd1, 0xc6, 0xcf, 0x9a, 0x3b, 0xdf,
+  0x36, 0x46, 0x35, 0xf6, 0x15, 0x7f, 0x04, 0xb5, 0x68, 0x68, 0x32, 0xbd,
+  0xf0, 0x82, 0xd9, 0x87, 0xbd, 0x9e, 0x88, 0x2f, 0x8a, 0xcf, 0xe8, 0x19,
+  0xbd, 0x68, 0x9d, 0x28, 0x3e, 0xdf, 0x54, 0x78, 0xff, 0x87, 0x02, 0x40,
+  0x43, 0x17, 0x21, 0x2d, 0x92, 0x39, 0xde, 0xa3, 0x6b, 0x14, 0xde, 0xb6,
+  0xf3, 0x9c, 0x1d, 0xb8, 0x91, 0xc2, 0xcb, 0xc4, 0x7d, 0xcd, 0xa5, 0x6c,
+  0xdf, 0x65, 0xec, 0x9c, 0xfc, 0x1b, 0x1d, 0x23, 0x67, 0xcf, 0xb7, 0x97,
+  0xb8, 0xe3, 0x6c, 0x1c, 0xb9, 0x35, 0x91, 0x41, 0x1c, 0xeb, 0x75, 0x9d,
+  0xfb, 0x22, 0x67, 0x4c, 0x58, 0xf0, 0x3e, 0xfa, 0xdc, 0x79, 0xb4, 0xb9,
+  0xe7, 0x75, 0xec, 0x60, 0x3d, 0x67, 0x8b, 0xf3, 0xba, 0x8a, 0xe7, 0x3e,
+  0x00, 0x62, 0xf3, 0xe7, 0x76, 0x37, 0xbf, 0x7c, 0x9a, 0x22, 0x8e, 0x90,
+  0xde, 0x36, 0x30, 0x59, 0x70, 0x6f, 0x89, 0x2b, 0x7a, 0x59, 0x57, 0xd1,
+  0xbf, 0xd0, 0xa1, 0xe8, 0xe5, 0x22, 0xfc, 0xa7, 0x14, 0x40, 0xc3, 0x24,
+  0xda, 0x11, 0xff, 0xcb, 0x1a, 0x98, 0x14, 0x37, 0x02, 0x40, 0x5a, 0xa8,
+  0x1c, 0xea, 0x6c, 0xcb, 0x3b, 0xb0, 0x3d, 0x11, 0x73, 0xe5, 0x2d, 0x4e,
+  0xd8, 0x7b, 0x7b, 0x5e, 0xb0, 0x77, 0x7b, 0x65, 0x40, 0x01, 0xba, 0x43,
+  0x4a, 0x79, 0xf0, 0xb6, 0x31, 0xe7, 0x83, 0x51, 0x59, 0xa7, 0x90, 0x8b,
+  0x02, 0x25, 0x0c, 0x96, 0x2e, 0xd2, 0x2d, 0xe5, 0xcd, 0xb8, 0x9a, 0x77,
+  0xd7, 0xcf, 0xc5, 0x09, 0x1a, 0x83, 0x55, 0xd0, 0x1f, 0xe0, 0x9b, 0x84,
+  0xc1, 0xe8, 0xe3, 0x9e, 0x00, 0x4d, 0x69, 0x3c, 0x86, 0x6d, 0xdc, 0x97,
+  0xd2, 0x3f, 0x1f, 0xd0, 0xe3, 0x27, 0xff, 0x83, 0x02, 0x7f, 0x0c, 0x2b,
+  0xc5, 0xe3, 0x1e, 0xd6, 0xff, 0x6b, 0xef, 0x6b, 0xdb, 0x1b, 0x37, 0x8e,
+  0x04, 0x3f, 0x6b, 0x7e, 0x45, 0x1f, 0x4d, 0x46, 0xe4, 0x58, 0xd4, 0x8c,
+  0x66, 0x92, 0x7d, 0xd1, 0x8c, 0x67, 0xe3, 0x38, 0x4e, 0x36, 0xb7, 0x4e,
+  0xe2, 0x4b, 0xbc, 0xb7, 0x7b, 0x9b, 0xc4, 0x0a, 0x44, 0x42, 0x22, 0x32,
+  0x20, 0x41, 0x03, 0xe0, 0x8c, 0x94, 0x9d, 0xe8, 0xb7, 0x5f, 0xbd, 0xf6,
+  0x1b, 0x1a, 0x00, 0x65, 0x7b, 0xf3, 0xdc, 0xed, 0x13, 0x3f, 0xc9, 0x08,
+  0x04, 0xaa, 0xab, 0xab, 0xbb, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0x82,
+  0x15, 0xfa, 0xbb, 0x21, 0x17, 0xf1, 0xef, 0x70, 0xd3, 0x5a, 0xf7, 0xdd,
+  0x70, 0x4a, 0xd0, 0x84, 0x90, 0xb1, 0x24, 0x90, 0x42, 0x80, 0x39, 0x89,
+  0xb2, 0xab, 0x3d, 0xf9, 0x78, 0x9c, 0x42, 0xe6, 0x63, 0x6a, 0xfb, 0xa4,
+  0x7d, 0x62, 0x31, 0x67, 0x16, 0x0f, 0x56, 0x73, 0x9e, 0x8f, 0x77, 0xf1,
+  0x39, 0x2f, 0x59, 0xc1, 0xe4, 0x44, 0x99, 0xe6, 0x2a, 0x9d, 0x28, 0x5b,
+  0x17, 0x9b, 0x7a, 0x91, 0x50, 0x29, 0x45, 0xbf, 0x86, 0x26, 0x1d, 0x40,
+  0x7a, 0xb1, 0xfc, 0x3b, 0x53, 0x87, 0x0a, 0x8e, 0x56, 0x21, 0x31, 0x23,
+  0xcc, 0xfc, 0xcc, 0x3c, 0x35, 0xe7, 0xe7, 0xe7, 0x0b, 0x43, 0x52, 0xaa,
+  0x45, 0x6b, 0x7e, 0x8b, 0xf7, 0xe1, 0x59, 0xc4, 0x31, 0xa6, 0x9c, 0x6f,
+  0xe9, 0x15, 0x78, 0x85, 0x62, 0x9e, 0x9f, 0xdf, 0x9e, 0x9b, 0xc9, 0x1f,
+  0x26, 0x18, 0x93, 0x05, 0x04, 0x22, 0xac, 0x5b, 0x40, 0xd3, 0x62, 0x12,
+  0xb7, 0x90, 0x55, 0x1e, 0x16, 0xdd, 0x64, 0x1f, 0x53, 0xdd, 0xc2, 0xba,
+  0x41, 0xd5, 0xba, 0x0a, 0xeb, 0x2a, 0xa7, 0x22, 0xcb, 0x2e, 0x52, 0x4e,
+  0xa1, 0x19, 0x5c, 0x68, 0x00, 0x17, 0x55, 0xd3, 0xe9, 0x08, 0x2e, 0x4d,
+  0xeb, 0xd5, 0x91, 0x48, 0xbc, 0xe5, 0x2a, 0xa1, 0xff, 0x9f, 0x78, 0xfe,
+  0x00, 0x27, 0x76, 0xc9, 0xe2, 0x83, 0xd2, 0x5f, 0x61, 0x54, 0x1c, 0x39,
+  0x26, 0x1d, 0x38, 0x22, 0x7d, 0x57, 0xe0, 0x96, 0x87, 0xfc, 0x14, 0xee,
+  0x69, 0x60, 0x9a, 0x2e, 0x6f, 0xf0, 0x8e, 0x28, 0xc1, 0x1c, 0xd6, 0xab,
+  0xd6, 0xf3, 0x3d, 0xb0, 0x4a, 0x97, 0x13, 0xa6, 0xa8, 0xca, 0x2a, 0x2b,
+  0xb3, 0x00, 0x8f, 0xab, 0x60, 0x89, 0xe0, 0xd7, 0x40, 0x21, 0x43, 0x50,
+  0xb4, 0xa2, 0x74, 0x7b, 0x01, 0x14, 0xdf, 0x36, 0x6e, 0xc4, 0xac, 0xf3,
+  0x1a, 0xdb, 0x79, 0x49, 0xe2, 0xc3, 0x93, 0x3e, 0xbe, 0xdf, 0x65, 0x78,
+  0x5a, 0xd4, 0x71, 0xe4, 0x55, 0x4d, 0x3d, 0x22, 0x9e, 0xbd, 0x65, 0x4a,
+  0x5f, 0x6d, 0xed, 0xb4, 0xf2, 0xfb, 0x69, 0xa6, 0xce, 0xf7, 0xa1, 0xae,
+  0x74, 0x3b, 0x89, 0x44, 0x1d, 0x38, 0xbd, 0x22, 0x42, 0x3b, 0x6a, 0x79,
+  0xe5, 0xd5, 0xd0, 0xd9, 0x62, 0x96, 0xe3, 0x44, 0xda, 0x98, 0x2e, 0x83,
+  0xbb, 0x1c, 0xd9, 0xc1, 0x24, 0xba, 0x41, 0xd7, 0x27, 0xfc, 0x4e, 0xd1,
+  0xa9, 0x54, 0x09, 0xbf, 0xe1, 0x9b, 0x2b, 0x8c, 0x5c, 0x75, 0x17, 0xab,
+  0x13, 0xe1, 0x76, 0xbc, 0xda, 0x47, 0x1b, 0x1f, 0xda, 0xda, 0x24, 0xbb,
+  0xda, 0xd6, 0xb2, 0xb6, 0x28, 0xda, 0x3a, 0x2b, 0x4a, 0xf2, 0x2b, 0xd8,
+  0x7f, 0xf7, 0xcd, 0x4e, 0x67, 0xcf, 0xdb, 0xd1, 0xfd, 0x4b, 0xc0, 0xda,
+  0xb1, 0xc2, 0x3b, 0x23, 0x2b, 0x1f, 0x46, 0x0e, 0xdb, 0xd6, 0xe9, 0xe4,
+  0x6e, 0x62, 0x4a, 0xbe, 0x48, 0xa9, 0x7a, 0x54, 0x9f, 0x5f, 0x24, 0x9b,
+  0x5c, 0x7b, 0xdd, 0xf8, 0xa9, 0x87, 0xee, 0xbc, 0xd3, 0x00, 0xdf, 0x16,
+  0x2a, 0x27, 0x02, 0xf2, 0x0a, 0xf0, 0xca, 0x0b, 0xb2, 0x40, 0xca, 0x5b,
+  0xd9, 0xc4, 0xe8, 0x4e, 0x61, 0x78, 0xd3, 0x19, 0x96, 0xa1, 0x51, 0x97,
+  0x12, 0x5d, 0x8b, 0x4d, 0x44, 0x28, 0xda, 0x65, 0xfb, 0x29, 0x95, 0x83,
+  0xc6, 0x0e, 0x1a, 0xc5, 0x42, 0xa1, 0x38, 0xae, 0x8b, 0xdb, 0x9b, 0xb2,
+  0xa2, 0xc0, 0x60, 0x48, 0x5e, 0xf8, 0x53, 0xd6, 0x1b, 0xa9, 0x92, 0xa3,
+  0x9f, 0x39, 0x10, 0x3b, 0x33, 0xc4, 0x5b, 0x42, 0xcf, 0x97, 0x65, 0x23,
+  0x34, 0xbf, 0xd9, 0x07, 0xaa, 0x6d, 0xc0, 0x04, 0x31, 0x92, 0x88, 0x71,
+  0x68, 0x7d, 0x24, 0xeb, 0x8a, 0x8f, 0x85, 0xad, 0x2e, 0xdb, 0x9d, 0x7a,
+  0x20, 0xf9, 0xed, 0x20, 0x6b, 0x0d, 0x6e, 0x67, 0xd1, 0x30, 0x74, 0x5d,
+  0x56, 0xab, 0xb7, 0x62, 0x23, 0x32, 0x5e, 0x5f, 0x78, 0xf0, 0x53, 0x58,
+  0xe5, 0x73, 0x84, 0x6f, 0xdf, 0xe0, 0xd3, 0xeb, 0x67, 0x68, 0xb7, 0xeb,
+  0x83, 0xbd, 0xc9, 0xca, 0x26, 0x27, 0x58, 0x7a, 0x62, 0x60, 0x0f, 0xb6,
+  0x43, 0x48, 0x47, 0x02, 0x48, 0x77, 0x76, 0xe1, 0xe6, 0x81, 0x26, 0x10,
+  0xaa, 0x00, 0x0b, 0xe3, 0x38, 0x2e, 0x28, 0x4a, 0xec, 0x31, 0x5e, 0x03,
+  0x73, 0x91, 0xad, 0xa0, 0x7d, 0xf3, 0x3b, 0xa2, 0x7c, 0x81, 0x0d, 0xf9,
+  0x03, 0x3e, 0x8e, 0x55, 0x34, 0x45, 0x45, 0x63, 0xb4, 0x1e, 0x82, 0xf2,
+  0xab, 0xf9, 0x4f, 0x57, 0xcd, 0x5f, 0x8e, 0xa9, 0x66, 0x9b, 0x5d, 0x37,
+  0x47, 0x34, 0x07, 0xa1, 0x5c, 0x35, 0x19, 0xd5, 0xf0, 0x2c, 0x1b, 0x6f,
+  0x04, 0x08, 0x82, 0x3f, 0x1d, 0x6e, 0x29, 0x06, 0xc4, 0x68, 0x53, 0x1c,
+  0xac, 0xab, 0x69, 0xf5, 0x27, 0xae, 0x0a, 0xfe, 0x8e, 0xd5, 0x35, 0x7b,
+  0x44, 0x5d, 0xb3, 0xef, 0x58, 0x17, 0x68, 0x79, 0x77, 0x5a, 0x8b, 0x7d,
+  0x8c, 0x18, 0x20, 0x4b, 0xc3, 0x74, 0xd0, 0x5c, 0x3c, 0x3f, 0xf7, 0xc2,
+  0x5d, 0x0d, 0x7c, 0x2e, 0xf1, 0x73, 0x5c, 0xc7, 0x08, 0x86, 0x0e, 0x84,
+  0x8f, 0xc4, 0x2d, 0x96, 0x08, 0x93, 0x5c, 0x28, 0x7b, 0x35, 0x24, 0xa7,
+  0x45, 0x6f, 0x4a, 0x52, 0xa3, 0xd3, 0xbe, 0xba, 0xfe, 0x3a, 0x48, 0x12,
+  0x04, 0xa0, 0x5d, 0xe7, 0xd6, 0x9d, 0x55, 0xab, 0x23, 0x5a, 0xc4, 0xab,
+  0x54, 0xe8, 0xf4, 0x7f, 0x25, 0x9a, 0xa1, 0x2e, 0xa8, 0x8f, 0x6e, 0x89,
+  0x6f, 0xa5, 0x56, 0x3f, 0x4c, 0x90, 0x09, 0xa6, 0xe3, 0xe8, 0xe9, 0x5b,
+  0xab, 0xed, 0x92, 0xec, 0xd6, 0xe4, 0x60, 0x2f, 0x71, 0xc3, 0x8e, 0x06,
+  0xc3, 0xcb, 0x74, 0xed, 0x2d, 0xd3, 0x3c, 0x0d, 0xfe, 0x9c, 0xb7, 0x19,
+  0x94, 0xb9, 0x7d, 0x83, 0x0f, 0xaf, 0x9f, 0xdd, 0xf6, 0x8a, 0xd1, 0xd9,
+  0x30, 0x24, 0x2d, 0x1f, 0xbc, 0xd3, 0xf8, 0x79, 0x9d, 0xe7, 0x6f, 0xe3,
+  0x50, 0x70, 0x41, 0xa5, 0xb3, 0xac, 0xdc, 0x6f, 0x18, 0x19, 0x3f, 0x0e,
+  0x55, 0x3c, 0x75, 0xc0, 0xe3, 0xb0, 0xb3, 0x6b, 0xa5, 0x92, 0x9e, 0x06,
+  0x61, 0x2d, 0xe8, 0x28, 0xe4, 0xec, 0x36, 0xdb, 0x6e, 0x05, 0x2d, 0x3d,
+  0x0e, 0x76, 0x94, 0x03, 0x1e, 0x85, 0x9d, 0xce, 0xd6, 0x79, 0xa9, 0x04,
+  0xd3, 0xe3, 0x20, 0xb4, 0x03, 0x1e, 0x87, 0x9d, 0xe5, 0xfb, 0xa6, 0x28,
+  0x31, 0x82, 0x18, 0xe2, 0x96, 0x1f, 0x83, 0x25, 0xfc, 0x02, 0xc7, 0xc0,
+  0x3b, 0x8e, 0x98, 0x8d, 0x31, 0x0f, 0x50, 0xa3, 0xa0, 0x63, 0x90, 0x0a,
+  0x38, 0x8a, 0x11, 0xd4, 0x57, 0xc5, 0x49, 0x8f, 0x83, 0xd0, 0x0e, 0x78,
+  0x1c, 0x76, 0x56, 0x54, 0x8a, 0x18, 0x9f, 0x06, 0x61, 0x2d, 0xe8, 0x28,
+  0xe4, 0xec, 0x2d, 0xcc, 0x42, 0x41, 0x4b, 0x8f, 0x83, 0xd0, 0x0e, 0x78,
+  0x1c, 0x76, 0x26, 0x87, 0x38, 0x84, 0x9a, 0x9f, 0x07, 0xe1, 0x3d, 0xf0,
+  0x23, 0xa0, 0x67, 0xdb, 0x03, 0x63, 0xde, 0x1e, 0x06, 0xe1, 0x04, 0x6c,
+  0x04, 0x6a, 0xb6, 0x13, 0x6c, 0xbb, 0x61, 0x38, 0x01, 0x1b, 0x81, 0x9a,
+  0xdd, 0x15, 0x8c, 0xed, 0xae, 0x18, 0x84, 0x13, 0xb0, 0x11, 0xa8, 0x59,
+  0xb5, 0x2d, 0x56, 0xb5, 0xce, 0x18, 0xf9, 0x31, 0x58, 0xc2, 0x2f, 0x70,
+  0x0c, 0xfc, 0x6c, 0x8f, 0x84, 0x34, 0x6f, 0xe0, 0xef, 0xeb, 0x67, 0x4d,
+  0x3f, 0xdc, 0x9e, 0xe9, 0xdd, 0x8f, 0xd0, 0x5b, 0x6f, 0x2a, 0xa6, 0x15,
+  0x1e, 0x06, 0x21, 0x15, 0x70, 0x0c, 0x6e, 0xd6, 0x14, 0xb7, 0x2a, 0xe7,
+  0xe8, 0x71, 0x10, 0xda, 0x01, 0x8f, 0xc3, 0xce, 0xda, 0x4c, 0x06, 0x1e,
+  0x1e, 0x86, 0x67, 0xaa, 0x00, 0x8e, 0xc1, 0xcd, 0x0e, 0xbe, 0x7c, 0x3b,
+  0x1c, 0x21, 0xaf, 0xfc, 0x02, 0xc7, 0xc0, 0xcf, 0xf6, 0x1b, 0x61, 0x2f,
+  0x78, 0x18, 0x84, 0x54, 0xc0, 0x31, 0xb8, 0xd9, 0x4a, 0x31, 0xae, 0x46,
+  0x20, 0x15, 0x70, 0x0c, 0x6e, 0x06, 0xed, 0x10, 0x1a, 0x9b, 0x11, 0x1a,
+  0x05, 0x70, 0x0c, 0x0e, 0x18, 0x3f, 0xbf, 0xcd, 0x74, 0x0e, 0xc0, 0xe3,
+  0xc8, 0x0c, 0x50, 0xe0, 0x51, 0xd8, 0x0f, 0xd3, 0xd9, 0xa7, 0xb8, 0x7e,
+  0x7f, 0x60, 0xdc, 0x9f, 0x8e, 0xad, 0xe5, 0x1f, 0xa6, 0x1e, 0xf8, 0x11,
+  0xd0, 0xb3, 0x9f, 0x80, 0x60, 0x17, 0xe4, 0x3f, 0x19, 0x91, 0xf1, 0x1f,
+  0xa6, 0x0e, 0x78, 0x1c, 0x76, 0xf6, 0x73, 0x5c, 0xc7, 0x05, 0xf5, 0xcf,
+  0xc7, 0xd6, 0xf4, 0x0f, 0x53, 0x0f, 0xfc, 0x08, 0xe8, 0xd9, 0x4f, 0x71,
+  0x2d, 0x17, 0xec, 0x3f, 0x1d, 0x5b, 0xd7, 0x3f, 0x4c, 0x3d, 0xf0, 0x23,
+  0xa0, 0x67, 0x9f, 0x33, 0xa7, 0x0b, 0xfe, 0xcf, 0xc7, 0xf9, 0xfe, 0xc3,
+  0x34, 0x28, 0x72, 0x54, 0x89, 0xd9, 0x7f, 0xb8, 0xbe, 0xff, 0x8f, 0xd1,
+  0xfe, 0x74, 0xc0, 0xe3, 0xb0, 0xb3, 0xcf, 0x2d, 0xe2, 0xcf, 0xc7, 0x60,
+  0x2d, 0xe8, 0x28, 0x24, 0xc6, 0x69, 0xb1, 0x78, 0xbf, 0x1a, 0xd3, 0x08,
+  0x3e, 0x4c, 0x3d, 0xf0, 0x23, 0xa0, 0x67, 0xbf, 0xa8, 0x2c, 0xf2, 0x5f,
+  0x8c, 0xe8, 0x05, 0x1f, 0xa6, 0x0e, 0x78, 0x1c, 0x76, 0xf6, 0x2f, 0xa8,
+  0x0d, 0x08, 0xea, 0x7f, 0x19, 0xd3, 0x0c, 0x3e, 0x4c, 0x3d, 0xf0, 0x23,
+  0xa0, 0x67, 0x5f, 0x90, 0x3a, 0x20, 0xe8, 0xbf, 0x18, 0xd5, 0x0d, 0x3e,
+  0x4c, 0xfd, 0x02, 0xc7, 0xc0, 0xcf, 0x7e, 0x79, 0x10, 0xec, 0xbf, 0x1c,
+  0x94, 0xee, 0x1f, 0xa6, 0x0a, 0x38, 0x06, 0x37, 0xfb, 0x95, 0x62, 0xfc,
+  0xd5, 0x08, 0xa4, 0x02, 0x8e, 0xc1, 0xcd, 0xfe, 0xbd, 0x10, 0x8c, 0xff,
+  0x3e, 0x28, 0x29, 0x3f, 0x4c, 0x15, 0x70, 0x0c, 0x6e, 0xf6, 0x6b, 0xd6,
+  0x0d, 0x04, 0xed, 0xaf, 0xc7, 0x35, 0x85, 0x0f, 0xd3, 0xa0, 0xc8, 0x51,
+  0x25, 0x66, 0xbf, 0xd9, 0x54, 0x52, 0xc3, 0x6f, 0x86, 0xd7, 0xf9, 0x0f,
+  0x53, 0x0b, 0x3a, 0x0a, 0x39, 0xfb, 0x2d, 0xae, 0xed, 0x82, 0xf7, 0xb7,
+  0x63, 0xeb, 0xfc, 0x87, 0xa9, 0x07, 0x7e, 0x04, 0xf4, 0xec, 0xab, 0x4c,
+  0x87, 0xef, 0xab, 0xe1, 0xf5, 0x1e, 0xe6, 0xa0, 0x82, 0x8e, 0x42, 0xce,
+  0xfe, 0x35, 0x90, 0x79, 0xff, 0x7a, 0x8c, 0x04, 0x0b, 0x8a, 0x1c, 0x55,
+  0x62, 0xf6, 0xe5, 0x46, 0x19, 0xe5, 0xcb, 0xe1, 0x55, 0xfa, 0xc3, 0xd4,
+  0x82, 0x8e, 0x42, 0xce, 0x3e, 0xb3, 0x58, 0x3f, 0x1b, 0x83, 0xb5, 0xa0,
+  0xa3, 0x90, 0xb3, 0x2f, 0x1b, 0x4b, 0xeb, 0xf0, 0xfa, 0x0f, 0xb4, 0x2a,
+  0xe8, 0x28, 0x24, 0x70, 0x32, 0xac, 0xf9, 0x96, 0xab, 0x47, 0xd7, 0x7f,
+  0x0f, 0xfc, 0x08, 0xe8, 0xd9, 0x97, 0x96, 0xe4, 0x31, 0x8a, 0x95, 0xe0,
+  0x2e, 0x5c, 0xb4, 0xb1, 0x63, 0xed, 0x7b, 0x58, 0xf9, 0x9e, 0xe5, 0x0c,
+  0x95, 0x0f, 0x42, 0x15, 0xbb, 0x1b, 0x02, 0x83, 0xbf, 0x83, 0x70, 0x5b,
+  0x06, 0xdc, 0x56, 0x6f, 0x96, 0x64, 0x93, 0xe9, 0x29, 0x12, 0x58, 0xa1,
+  0xf8, 0x0e, 0x82, 0x99, 0xf0, 0xdf, 0x7e, 0xb8, 0x6f, 0x0e, 0x95, 0x35,
+  0x3f, 0xca, 0x81, 0x63, 0xc2, 0x34, 0xc8, 0x50, 0x73, 0xa2, 0xe1, 0x54,
+  0xec, 0x42, 0x9e, 0xa1, 0xb1, 0x0b, 0xea, 0x43, 0xf6, 0x34, 0x4b, 0x20,
+  0x5f, 0x3c, 0xbf, 0x08, 0x6c, 0x81, 0x01, 0x08, 0x99, 0xc2, 0xf8, 0x23,
+  0x1f, 0x55, 0x26, 0x68, 0x23, 0x18, 0x26, 0xed, 0x72, 0x98, 0x34, 0x82,
+  0xf4, 0x01, 0xfb, 0x28, 0x23, 0xc0, 0x8b, 0x7f, 0xe8, 0x37, 0x52, 0x12,
+  0xc0, 0x8b, 0xe7, 0x83, 0x84, 0x1f, 0x41, 0xb7, 0x92, 0x3d, 0x4e, 0xb7,
+  0x09, 0x00, 0x07, 0xe8, 0xf6, 0xc9, 0x2e, 0x13, 0x64, 0x0f, 0x52, 0xbd,
+  0xc6, 0x30, 0xad, 0xf9, 0x18, 0xe1, 0x02, 0x25, 0xb4, 0x7f, 0x32, 0x4c,
+  0xbb, 0x00, 0x07, 0xb0, 0x7d, 0xe4, 0x0b, 0xec, 0x50, 0x0b, 0x04, 0x64,
+  0xa4, 0x11, 0x7c, 0xa9, 0x7c, 0xbc, 0x19, 0x0c, 0xa7, 0x83, 0x30, 0xde,
+  0x12, 0x86, 0x0f, 0xc1, 0x07, 0x1a, 0xc3, 0xe0, 0x23, 0xcd, 0x61, 0xa0,
+  0xa1, 0x06, 0x65, 0x75, 0x8d, 0x3e, 0x05, 0xc3, 0xad, 0x61, 0x20, 0x6e,
+  0xca, 0xf2, 0xcd, 0x70, 0x4b, 0x18, 0x36, 0x00, 0xed, 0x6b, 0x05, 0x83,
+  0xbe, 0xf8, 0x51, 0x5f, 0x03, 0xa2, 0xef, 0x5d, 0xe2, 0x6f, 0x32, 0x0c,
+  0x2b, 0x89, 0x1e, 0x5b, 0x22, 0x63, 0xe4, 0x28, 0x3e, 0xd1, 0x04, 0x07,
+  0xca, 0xcd, 0xf8, 0x1f, 0xc3, 0xad, 0x70, 0xe0, 0x3e, 0x74, 0x5f, 0x43,
+  0x1c, 0xf4, 0xc5, 0xdf, 0x0d, 0x9c, 0x4f, 0xe4, 0x77, 0x7b, 0x7b, 0x86,
+  0xe5, 0x9e, 0x17, 0x5d, 0x98, 0x8b, 0x1f, 0xf6, 0x8f, 0x2a, 0x03, 0xbc,
+  0xfc, 0xc7, 0xde, 0x21, 0x9d, 0x35, 0x87, 0xad, 0xf9, 0xc7, 0x5e, 0xf1,
+  0x32, 0xdb, 0x53, 0x3a, 0x99, 0xd6, 0xfc, 0xe3, 0x8f, 0x62, 0x14, 0x94,
+  0x16, 0x06, 0x1d, 0x03, 0xc9, 0xe7, 0x70, 0x99, 0xed, 0x6e, 0xcb, 0x7c,
+  0x79, 0x5d, 0x67, 0x18, 0x8d, 0x51, 0x32, 0x4e, 0xec, 0x56, 0x58, 0xff,
+  0xb9, 0xc9, 0xbe, 0x7e, 0xdd, 0xbe, 0xc1, 0x33, 0xfa, 0x0d, 0x8c, 0x50,
+  0xf6, 0xf5, 0xd7, 0x3b, 0x4e, 0x4b, 0x71, 0xde, 0x3d, 0x84, 0x20, 0x7a,
+  0x83, 0x23, 0x08, 0xdf, 0xab, 0x50, 0x0f, 0x20, 0x42, 0xa7, 0x2f, 0x2c,
+  0xb3, 0x6c, 0x28, 0xf6, 0x68, 0xe8, 0x46, 0x15, 0x3b, 0xd7, 0x65, 0xbd,
+  0xa5, 0x3b, 0xce, 0x75, 0x72, 0xfd, 0x72, 0xa0, 0x8a, 0x94, 0xdb, 0x84,
+  0x87, 0x2b, 0xe5, 0x15, 0x8d, 0x51, 0x2d, 0xc2, 0x98, 0x75, 0xdc, 0x41,
+  0x42, 0xd1, 0x0d, 0x14, 0xca, 0xd8, 0x67, 0xc5, 0xa7, 0xf3, 0x0e, 0x40,
+  0x9c, 0xb7, 0xa5, 0xf5, 0x44, 0x71, 0xae, 0xf2, 0x12, 0xf6, 0x9d, 0xc2,
+  0x3c, 0x51, 0x96, 0xa9, 0x27, 0xce, 0x6b, 0x3a, 0x15, 0x5d, 0x04, 0xea,
+  0x58, 0x78, 0xee, 0x47, 0x36, 0xc4, 0x08, 0xbe, 0x47, 0x87, 0x22, 0xa6,
+  0xc1, 0x7b, 0x33, 0x18, 0x61, 0xa4, 0xc8, 0xfb, 0xa2, 0x8b, 0x9c, 0xa4,
+  0xfc, 0x95, 0xa2, 0x98, 0x22, 0x5c, 0x03, 0xd3, 0x9b, 0xae, 0x06, 0x1a,
+  0xb1, 0x5b, 0x79, 0xf1, 0x21, 0xbc, 0x8a, 0xf1, 0x60, 0xff, 0x93, 0xdf,
+  0x4f, 0xf0, 0x18, 0xdc, 0xde, 0x7d, 0xe6, 0x9a, 0x4f, 0x22, 0x48, 0x17,
+  0x94, 0xc4, 0x77, 0xe9, 0x3e, 0x2e, 0x2e, 0x89, 0xf6, 0x53, 0xe8, 0xfa,
+  0x22, 0xf3, 0xcd, 0xf9, 0x95, 0x60, 0x4b, 0x52, 0x01, 0x4a, 0x7a, 0x62,
+  0xa0, 0x04, 0x61, 0x49, 0xfc, 0xa1, 0xfc, 0x8a, 0xdd, 0x87, 0xf9, 0x72,
+  0xaa, 0x3f, 0x9a, 0x7a, 0x0f, 0x18, 0x47, 0x75, 0xbb, 0xc5, 0x88, 0xc4,
+  0xcd, 0xde, 0x20, 0x73, 0x70, 0x93, 0x34, 0xf8, 0x3f, 0x25, 0x59, 0x42,
+  0x5f, 0x5f, 0x8a, 0x07, 0x44, 0x29, 0x08, 0x38, 0xdb, 0x98, 0xf8, 0xf6,
+  0x1e, 0x76, 0x36, 0x2b, 0x12, 0x95, 0x0b, 0xcf, 0xf6, 0x10, 0x9d, 0x77,
+  0x3c, 0x09, 0xd4, 0x2d, 0x85, 0x46, 0x7b, 0xa1, 0xac, 0x31, 0x2e, 0xcc,
+  0x0a, 0xf4, 0x6c, 0xd2, 0xdf, 0x0f, 0x03, 0xbe, 0xdb, 0xdb, 0x6d, 0xf6,
+  0x52, 0x34, 0x63, 0x9f, 0xbf, 0xa6, 0x07, 0x73, 0xf1, 0xdc, 0xf9, 0x7b,
+  0x33, 0x0d, 0xf4, 0xda, 0x5d, 0xb8, 0xb5, 0x95, 0x0d, 0xd4, 0x12, 0x96,
+  0x4d, 0xc5, 0x87, 0x79, 0x04, 0xc9, 0xc6, 0x78, 0x63, 0xee, 0x1f, 0x32,
+  0xf6, 0x4d, 0x75, 0x91, 0x08, 0xf1, 0x5c, 0x1f, 0x9a, 0xe9, 0x21, 0x4f,
+  0x0d, 0x1d, 0xad, 0x7a, 0x9c, 0x4f, 0x9d, 0x44, 0xa3, 0xd2, 0x60, 0xce,
+  0xb8, 0x5e, 0xae, 0x3f, 0x71, 0x50, 0x09, 0x8e, 0xef, 0xb8, 0xb8, 0xc9,
+  0x3d, 0xaa, 0x88, 0xa5, 0x3a, 0x0e, 0xde, 0x81, 0xc8, 0xf9, 0xfe, 0x58,
+  0x4d, 0xbd, 0x62, 0x5c, 0xa0, 0x82, 0x51, 0x76, 0xa3, 0x86, 0xc9, 0xe8,
+  0x11, 0xb5, 0xfa, 0xb7, 0x8f, 0xe1, 0x98, 0xdb, 0x52, 0xac, 0xd6, 0x99,
+  0x91, 0x31, 0xd3, 0xf9, 0x75, 0x0d, 0xb0, 0x5d, 0x1c, 0x79, 0x68, 0x88,
+  0xf5, 0x46, 0x50, 0x8e, 0x31, 0x1f, 0xaf, 0xe8, 0xcc, 0x48, 0x29, 0xc5,
+  0x20, 0x05, 0x76, 0xf1, 0xf2, 0x47, 0xbd, 0xba, 0x81, 0x05, 0xf9, 0x61,
+  0xbf, 0xc2, 0x87, 0xa2, 0x90, 0xef, 0xe7, 0xdc, 0xa9, 0x0f, 0x74, 0x42,
+  0x0d, 0x51, 0x28, 0xd2, 0x7e, 0xce, 0x7d, 0xed, 0xa7, 0xa3, 0x2a, 0xf5,
+  0x83, 0x76, 0x15, 0x25, 0x85, 0xbd, 0xb8, 0xe8, 0x57, 0x70, 0x2c, 0xcc,
+  0xf3, 0x7e, 0x1d, 0x67, 0x7b, 0x4c, 0x1b, 0x94, 0x2c, 0xbd, 0x44, 0xd4,
+  0x43, 0xbf, 0x47, 0xfd, 0xd3, 0x61, 0xea, 0x85, 0xae, 0x17, 0xfd, 0xb4,
+  0x77, 0x20, 0x3a, 0x94, 0xcb, 0xb5, 0xa8, 0x61, 0xd2, 0x15, 0x68, 0x8c,
+  0x76, 0x07, 0x37, 0x4a, 0xbc, 0x82, 0x0e, 0x50, 0x9f, 0x00, 0x49, 0x28,
+  0x97, 0xdf, 0xd4, 0xca, 0xaa, 0xee, 0x31, 0x11, 0xda, 0x00, 0xbf, 0x1d,
+  0xe7, 0x5c, 0x4c, 0x42, 0xe3, 0x1b, 0x76, 0x38, 0xf1, 0x66, 0x0a, 0x89,
+  0x92, 0x6f, 0xd8, 0x2d, 0x26, 0xed, 0x7d, 0x1e, 0x6e, 0xf6, 0x0b, 0x4e,
+  0xdb, 0x46, 0x73, 0x28, 0xfc, 0xdd, 0x35, 0x0c, 0xd0, 0x37, 0xde, 0x07,
+  0x3c, 0x1b, 0x37, 0x38, 0x10, 0xb4, 0x0f, 0x3c, 0x64, 0x73, 0x20, 0xe0,
+  0x8b, 0x17, 0x2f, 0xfc, 0x4e, 0x06, 0xf1, 0xba, 0x06, 0xc9, 0x59, 0x99,
+  0xec, 0x5a, 0xd3, 0xdb, 0xf4, 0x95, 0x7b, 0x99, 0xea, 0x79, 0xcf, 0xa3,
+  0xc7, 0x12, 0xef, 0x77, 0xed, 0xf7, 0xef, 0x3d, 0x1d, 0x39, 0x36, 0xdd,
+  0xc0, 0x1e, 0xc0, 0x2d, 0x3f, 0x43, 0xbe, 0x4d, 0x0e, 0x4f, 0x18, 0xdf,
+  0xad, 0x23, 0x4b, 0xe3, 0x91, 0x56, 0x81, 0x4a, 0x55, 0x4d, 0x16, 0xc9,
+  0x31, 0x1f, 0xf6, 0x8d, 0x9a, 0x52, 0x26, 0x2f, 0xeb, 0x63, 0x46, 0x3f,
+  0x96, 0x74, 0xeb, 0xa6, 0x87, 0x47, 0x7d, 0x90, 0x4e, 0x7f, 0x62, 0x4c,
+  0x80, 0x7b, 0xf3, 0xd1, 0xe9, 0x54, 0xaf, 0x35, 0xa9, 0x02, 0x3f, 0xf7,
+  0x0b, 0x1b, 0xaf, 0x98, 0xdd, 0x5b, 0x74, 0x6e, 0x66, 0xf4, 0xd4, 0xac,
+  0x4e, 0xab, 0xaf, 0x5e, 0x09, 0x32, 0xce, 0xec, 0x47, 0x79, 0x32, 0x61,
+  0xab, 0xc3, 0x2f, 0x17, 0x92, 0x10, 0x6f, 0x61, 0x32, 0x73, 0xbd, 0xa0,
+  0x4b, 0x14, 0xc1, 0x2e, 0x2a, 0x71, 0x8f, 0xc1, 0xf6, 0xd0, 0x1f, 0xd9,
+  0x95, 0x8b, 0xfc, 0x50, 0x19, 0x1b, 0x3b, 0xa2, 0xbe, 0xde, 0x3f, 0x7b,
+  0xe3, 0xae, 0x0c, 0xcb, 0xd6, 0x8a, 0xd6, 0xd9, 0x90, 0x83, 0x70, 0x09,
+  0xd6, 0x37, 0x99, 0x5e, 0xe6, 0x3d, 0xb6, 0x0a, 0xeb, 0xe4, 0xe9, 0x3c,
+  0x3c, 0xf7, 0xe9, 0x5a, 0x93, 0x59, 0xda, 0xa8, 0x6e, 0xbc, 0x56, 0x76,
+  0x53, 0x20, 0x8b, 0x14, 0xbb, 0x9b, 0x1c, 0x98, 0x60, 0x95, 0xfb, 0x17,
+  0xcc, 0x02, 0x08, 0xbd, 0xbb, 0x15, 0x7c, 0xe7, 0xee, 0x0e, 0x90, 0xdf,
+  0xb9, 0x61, 0xf1, 0x76, 0x85, 0x9e, 0x07, 0x7c, 0x45, 0xd9, 0x8d, 0x64,
+  0x44, 0x7b, 0xab, 0xef, 0x6e, 0x3a, 0xda, 0x6b, 0x63, 0xc1, 0x9c, 0x36,
+  0xe7, 0x45, 0x4d, 0xb4, 0xd8, 0x62, 0x52, 0x63, 0x5c, 0xe1, 0xcd, 0x7b,
+  0xc0, 0x2b, 0x05, 0x2c, 0x56, 0x03, 0x93, 0x85, 0x92, 0x9c, 0x7e, 0xf2,
+  0x80, 0x89, 0xb2, 0x4a, 0x7d, 0xd6, 0x20, 0x0b, 0x96, 0x8b, 0xb9, 0x3e,
+  0x85, 0xb6, 0x15, 0x1a, 0xc2, 0x33, 0x31, 0x13, 0xf2, 0x21, 0x0e, 0x76,
+  0x35, 0xae, 0x94, 0xe2, 0xed, 0x2d, 0x15, 0x44, 0x35, 0xb1, 0x61, 0x81,
+  0xc3, 0x04, 0xa3, 0xa9, 0x5e, 0x92, 0xb4, 0xa5, 0x5f, 0x92, 0x4a, 0xd9,
+  0xd3, 0x53, 0x6d, 0xaa, 0xa4, 0xa7, 0xfb, 0xf2, 0x0d, 0xf1, 0x9d, 0x7f,
+  0x43, 0xfc, 0x5e, 0x15, 0xbe, 0xf4, 0xf4, 0xb8, 0x5f, 0x78, 0xcd, 0x74,
+  0xfb, 0x8a, 0x16, 0xc3, 0x5b, 0xb6, 0x6b, 0x0c, 0xf6, 0x03, 0x3c, 0x92,
+  0xe3, 0xc4, 0xa0, 0x9f, 0xcf, 0xf0, 0xcb, 0xc4, 0x2f, 0x43, 0x34, 0xd9,
+  0xf2, 0xf1, 0x6e, 0xf1, 0x7e, 0xa1, 0x71, 0x8f, 0xba, 0xb8, 0x27, 0xdd,
+  0x6f, 0x41, 0x25, 0xf6, 0xab, 0xbe, 0xe7, 0x42, 0x5e, 0x78, 0x07, 0x3b,
+  0xbf, 0xf1, 0x17, 0xce, 0xb9, 0x67, 0xd4, 0x1b, 0xce, 0x6a, 0x21, 0xdb,
+  0xcc, 0x36, 0xbf, 0xd3, 0x45, 0x90, 0xcc, 0x2b, 0xef, 0xe9, 0xe6, 0x6f,
+  0xa3, 0xe9, 0x4b, 0x32, 0x49, 0x66, 0x78, 0x46, 0x69, 0x12, 0x78, 0x2d,
+  0xca, 0x31, 0x44, 0x65, 0x73, 0x86, 0x17, 0xad, 0x90, 0xdf, 0x8a, 0x9b,
+  0x27, 0x76, 0x3b, 0x20, 0xf9, 0x59, 0x35, 0x71, 0x39, 0xc5, 0x3f, 0xcd,
+  0xd7, 0x18, 0x2e, 0x3e, 0x93, 0xdc, 0x88, 0x4d, 0xfe, 0xcd, 0x81, 0xa6,
+  0x45, 0x85, 0xa1, 0xdb, 0x6f, 0x8b, 0xb6, 0xe9, 0x84, 0xfe, 0xd7, 0xc9,
+  0x27, 0xc8, 0xec, 0x15, 0x01, 0x0e, 0xe9, 0x86, 0xcb, 0x56, 0xa0, 0xdc,
+  0x93, 0x2b, 0xbe, 0x0b, 0xfb, 0x67, 0x34, 0x02, 0x01, 0x63, 0xf7, 0x62,
+  0x66, 0xf1, 0x16, 0x47, 0xf6, 0xcc, 0x50, 0x70, 0x89, 0xff, 0xca, 0x8e,
+  0xc6, 0x86, 0x19, 0x74, 0x01, 0xaa, 0xa4, 0x7c, 0x32, 0x28, 0x15, 0x09,
+  0x82, 0xe0, 0x0e, 0xc7, 0xe5, 0xef, 0x1e, 0x5e, 0x2d, 0x1f, 0xfe, 0xc0,
+  0xc1, 0x9e, 0x26, 0x7e, 0x3d, 0x8c, 0x67, 0xe1, 0xf5, 0xfb, 0xaf, 0x0e,
+  0xdb, 0x1c, 0x64, 0x96, 0x4b, 0x24, 0x89, 0xf7, 0x0f, 0x28, 0x63, 0xba,
+  0x64, 0x8c, 0x84, 0xfe, 0xbd, 0x34, 0x9f, 0x55, 0xe5, 0x61, 0xbb, 0xd3,
+  0x8f, 0xee, 0x8e, 0xdc, 0x13, 0xb9, 0x78, 0x9a, 0x51, 0x49, 0xba, 0x0b,
+  0xfc, 0x9e, 0x52, 0x71, 0x34, 0xf9, 0xb6, 0x80, 0x29, 0x08, 0xfb, 0x8d,
+  0x73, 0x18, 0x5a, 0xce, 0xd7, 0x4e, 0xd9, 0x29, 0x33, 0xcc, 0x94, 0xb9,
+  0xf2, 0xd2, 0x39, 0x53, 0x16, 0x11, 0x37, 0x6a, 0x3e, 0x4f, 0x73, 0xa6,
+  0xca, 0x86, 0x33, 0x48, 0xca, 0xd5, 0x3b, 0x9b, 0xaf, 0xd2, 0xe6, 0x5d,
+  0xe7, 0xa8, 0x9b, 0x15, 0xe7, 0x59, 0x7a, 0x22, 0x17, 0x8d, 0x31, 0xc9,
+  0xa4, 0xd9, 0x61, 0xb2, 0x3d, 0xe4, 0x1c, 0x5e, 0x0e, 0x79, 0x0c, 0xcf,
+  0x0d, 0x67, 0x60, 0x6c, 0x84, 0x61, 0x34, 0x05, 0x0e, 0xca, 0x56, 0x49,
+  0x9d, 0xd9, 0x28, 0x96, 0x7b, 0x50, 0x76, 0x76, 0xb7, 0x26, 0x07, 0x81,
+  0xd1, 0xcb, 0x19, 0x52, 0x34, 0x11, 0x76, 0x82, 0xfa, 0x22, 0xc8, 0x39,
+  0xa0, 0x11, 0x2a, 0xc9, 0x1e, 0xed, 0xd6, 0x64, 0x06, 0xd7, 0x4c, 0x9d,
+  0x2e, 0x7c, 0x44, 0x9a, 0x05, 0xb1, 0x1c, 0x20, 0x88, 0xa2, 0x0b, 0x5a,
+  0x0d, 0x4a, 0xd0, 0x2c, 0x2c, 0xfb, 0x50, 0xec, 0x65, 0x79, 0xa9, 0x51,
+  0x3e, 0xba, 0x61, 0xb8, 0xa2, 0xe6, 0x30, 0xd9, 0x88, 0x7e, 0x7f, 0x68,
+  0x36, 0x89, 0x3b, 0x42, 0x5f, 0x1b, 0x64, 0x2d, 0x5b, 0x19, 0xb6, 0x35,
+  0xb1, 0x5f, 0x7c, 0x12, 0x08, 0xac, 0x78, 0x65, 0xd8, 0x11, 0xa7, 0xf6,
+  0x48, 0xd4, 0x87, 0x3f, 0xbc, 0xe1, 0x8a, 0x5e, 0x61, 0xc0, 0x32, 0x4c,
+  0x5b, 0x6a, 0x63, 0x94, 0xa5, 0xa5, 0xb5, 0x17, 0xdf, 0x4d, 0xa9, 0x91,
+  0xda, 0x6b, 0xc7, 0xee, 0x7a, 0x0d, 0x1a, 0xad, 0xcc, 0x78, 0x39, 0xb3,
+  0xae, 0xd6, 0xc4, 0x9a, 0xef, 0x24, 0x31, 0x0e, 0x86, 0x6e, 0xac, 0xd1,
+  0x8c, 0x70, 0x46, 0x11, 0x07, 0x0c, 0x26, 0xc2, 0x7c, 0xfd, 0x89, 0xd8,
+  0x32, 0xe1, 0x61, 0x53, 0xdc, 0x6e, 0x18, 0x13, 0xeb, 0x8a, 0x50, 0x16,
+  0xf3, 0xc9, 0x9a, 0x2d, 0x5e, 0xd7, 0xb9, 0x29, 0xf3, 0xbb, 0x02, 0x63,
+  0x6b, 0x9e, 0x9f, 0x63, 0x48, 0x97, 0xae, 0x5d, 0x5b, 0x76, 0x17, 0xfa,
+  0x14, 0x5a, 0xb6, 0x4b, 0x07, 0x51, 0xf6, 0x80, 0xa8, 0xf1, 0x7b, 0x08,
+  0xcf, 0x74, 0xac, 0xa2, 0xe9, 0x78, 0x45, 0xd3, 0xde, 0x8a, 0xb8, 0xed,
+  0x79, 0xd6, 0x14, 0x30, 0x97, 0x31, 0xc5, 0x24, 0xa5, 0xf0, 0x86, 0xd9,
+  0x77, 0xd8, 0xc1, 0x94, 0x3e, 0xe3, 0xd0, 0x02, 0x4d, 0xbe, 0x6a, 0x41,
+  0x24, 0x63, 0x9c, 0x9b, 0x6a, 0xdf, 0xbd, 0xbc, 0x89, 0x95, 0x26, 0xa6,
+  0x0b, 0xd4, 0x3b, 0x79, 0xdd, 0x70, 0x02, 0x32, 0xe0, 0x02, 0x84, 0x0a,
+  0xec, 0x49, 0x54, 0xf3, 0x6d, 0xd5, 0xb6, 0x19, 0xc6, 0x00, 0x40, 0xd1,
+  0x44, 0x02, 0x04, 0xd3, 0x7a, 0xc3, 0xce, 0xe4, 0x1d, 0xdf, 0x6e, 0x6b,
+  0x2e, 0x3a, 0xbb, 0x81, 0x38, 0xf6, 0x78, 0x8d, 0x57, 0x0c, 0x29, 0xf2,
+  0x23, 0xa5, 0xe8, 0xa4, 0x62, 0x3c, 0xbe, 0xf0, 0x72, 0xc2, 0x4f, 0x9f,
+  0xe0, 0xc0, 0xe7, 0x75, 0x59, 0x6c, 0x8b, 0x76, 0xe2, 0xc7, 0x02, 0xc0,
+  0x78, 0x2d, 0xb8, 0x72, 0x70, 0xc0, 0x65, 0xb7, 0x55, 0x90, 0x47, 0x6f,
+  0xa1, 0xeb, 0x0b, 0x79, 0x9e, 0x30, 0xaa, 0xfc, 0x71, 0x7e, 0x06, 0x8d,
+  0x3f, 0xfb, 0x31, 0xd5, 0x6d, 0x55, 0x87, 0xd8, 0x16, 0xb5, 0x7b, 0xf6,
+  0x26, 0xdc, 0x88, 0x58, 0xc8, 0xb3, 0x1f, 0x43, 0xb3, 0xdd, 0x2e, 0xa4,
+  0xd9, 0xea, 0xe2, 0xda, 0xdd, 0xd8, 0xf6, 0xf5, 0xbc, 0xdd, 0x85, 0x05,
+  0x56, 0x42, 0x64, 0x5a, 0x4f, 0xad, 0x09, 0xbe, 0x21, 0x9f, 0x49, 0x53,
+  0x71, 0xd8, 0x3c, 0xa2, 0xfc, 0x51, 0x44, 0x46, 0xf2, 0x46, 0x71, 0xf1,
+  0x57, 0x1b, 0x24, 0xbe, 0x0c, 0x2f, 0xe3, 0xe4, 0x76, 0x74, 0x67, 0x47,
+  0x0f, 0x13, 0xeb, 0xd7, 0xd5, 0xbe, 0xc4, 0xe0, 0x3a, 0x96, 0xda, 0x9a,
+  0xf7, 0xa5, 0x5e, 0x20, 0xa3, 0xa3, 0xc7, 0xd8, 0x78, 0x83, 0x1c, 0xef,
+  0x29, 0xe1, 0x3d, 0x57, 0xe5, 0x14, 0xc7, 0x49, 0xcf, 0x60, 0x8f, 0x8f,
+  0x36, 0xcb, 0x0a, 0x92, 0x66, 0xb5, 0xbb, 0x40, 0x55, 0x24, 0x0d, 0x0a,
+  0xd3, 0x01, 0xb0, 0x98, 0x79, 0x8a, 0x78, 0xe7, 0xce, 0xdc, 0x73, 0xc4,
+  0x68, 0xda, 0x7e, 0x79, 0xf5, 0x4a, 0xea, 0xc3, 0xf5, 0x3b, 0x87, 0xf6,
+  0x36, 0xe6, 0x99, 0xf9, 0x81, 0xe1, 0xf1, 0x7d, 0x97, 0x25, 0xb6, 0xe0,
+  0x49, 0xc6, 0xc0, 0x5d, 0xa7, 0x01, 0xf0, 0x02, 0xa3, 0x79, 0x69, 0x57,
+  0x8b, 0xce, 0xec, 0xe2, 0xdf, 0x42, 0xe9, 0x97, 0xf6, 0xea, 0x68, 0xb0,
+  0xe7, 0x83, 0x19, 0x0c, 0x0d, 0x03, 0xf6, 0xa4, 0xbd, 0x80, 0xe3, 0x4f,
+  0x5a, 0x60, 0xb0, 0x7f, 0x25, 0x80, 0x4f, 0x30, 0x01, 0x9b, 0x37, 0x6b,
+  0xf2, 0x2b, 0x11, 0xa0, 0x77, 0x1c, 0xe9, 0xcd, 0xb7, 0xe4, 0xfb, 0x9b,
+  0x43, 0x64, 0x1e, 0xa4, 0x92, 0x32, 0xe9, 0x6c, 0x29, 0xc5, 0x9a, 0x90,
+  0xf5, 0x23, 0x7b, 0x9b, 0x95, 0xba, 0x0f, 0x57, 0x18, 0x6d, 0x35, 0xe6,
+  0x78, 0x7c, 0x39, 0xd8, 0x81, 0xcc, 0x06, 0x80, 0xf7, 0x02, 0xd6, 0x53,
+  0x0a, 0x36, 0x00, 0x2b, 0xd0, 0x73, 0xd9, 0x55, 0x6c, 0x8a, 0x00, 0xd3,
+  0x0f, 0x07, 0x31, 0x79, 0x01, 0x48, 0xa2, 0xbe, 0x09, 0x7a, 0x03, 0xf9,
+  0x0d, 0x48, 0xb4, 0x41, 0x8e, 0x62, 0xa6, 0x64, 0x88, 0x4d, 0x31, 0x02,
+  0x20, 0x5d, 0xda, 0x91, 0x6a, 0x41, 0xa7, 0x1a, 0xee, 0xd6, 0x54, 0x97,
+  0x2e, 0x3a, 0xfc, 0x4d, 0xd3, 0x5e, 0x57, 0x14, 0xf7, 0x1c, 0xfb, 0xfa,
+  0xe0, 0xe1, 0xe1, 0x88, 0x7f, 0x00, 0xc1, 0x1c, 0xe7, 0x1e, 0x40, 0xa0,
+  0x03, 0x4e, 0x0b, 0xd1, 0xf7, 0xa4, 0x19, 0x8c, 0x89, 0x75, 0xe6, 0x13,
+  0x43, 0x97, 0x7d, 0x51, 0xcf, 0xe4, 0xd8, 0xf0, 0xb4, 0x8e, 0x96, 0x19,
+  0xc6, 0xe3, 0xd1, 0x20, 0xe9, 0x59, 0x7d, 0x8b, 0x6b, 0x2c, 0x95, 0xec,
+  0x99, 0x7a, 0x92, 0x8d, 0x75, 0x40, 0x94, 0x52, 0x69, 0x1b, 0xbf, 0x8c,
+  0xe4, 0xf0, 0xe1, 0x1a, 0xc9, 0x12, 0xcd, 0x9b, 0x75, 0x5d, 0x0a, 0xc8,
+  0xbc, 0xcb, 0x33, 0xe0, 0x9f, 0x49, 0x5a, 0xb2, 0x52, 0x1b, 0x55, 0xb0,
+  0x72, 0xd2, 0x58, 0x1b, 0xae, 0xf9, 0x4c, 0x93, 0xce, 0x1e, 0x27, 0x1d,
+  0x25, 0x1a, 0x22, 0x25, 0xb5, 0xd5, 0xf0, 0x69, 0xf3, 0xe9, 0xbe, 0x3c,
+  0x34, 0xc9, 0x69, 0x5b, 0x6e, 0xd9, 0x54, 0x03, 0x74, 0x89, 0x9d, 0x26,
+  0x9c, 0xb6, 0xdc, 0x1c, 0x3a, 0xc9, 0xfc, 0x98, 0x8e, 0x6d, 0x12, 0xcc,
+  0x18, 0x49, 0xcf, 0x72, 0x1b, 0xce, 0xd9, 0x29, 0xed, 0x95, 0xbe, 0x5b,
+  0xed, 0xd6, 0x17, 0xed, 0xd1, 0xb5, 0x93, 0xca, 0xf4, 0xbe, 0x68, 0xf2,
+  0xef, 0x44, 0xc0, 0xf1, 0xd5, 0x76, 0x26, 0x55, 0xe6, 0xf6, 0xdf, 0x6e,
+  0xa6, 0xa0, 0xc2, 0x87, 0x01, 0x4d, 0x4c, 0xd6, 0xc2, 0x46, 0xf6, 0xe6,
+  0x66, 0x7e, 0x03, 0xdb, 0xe0, 0xc5, 0xd9, 0xdd, 0x27, 0xd9, 0x22, 0xe6,
+  0xed, 0xf8, 0x1e, 0xfa, 0xe8, 0x0a, 0x11, 0x06, 0x50, 0xa2, 0xd8, 0xf1,
+  0x63, 0x2b, 0xc0, 0xc0, 0x22, 0x8b, 0xb6, 0xd8, 0xac, 0xb5, 0xda, 0x86,
+  0x41, 0xa9, 0xc3, 0x30, 0xf1, 0xd1, 0x1e, 0x7e, 0x84, 0xca, 0x7c, 0xe3,
+  0x6d, 0xd6, 0xfa, 0x0b, 0xe9, 0xab, 0x57, 0xd7, 0xc5, 0xae, 0xda, 0x52,
+  0x3c, 0xa5, 0x2a, 0xbf, 0xb9, 0x29, 0x56, 0x68, 0xb9, 0x6e, 0xc2, 0xee,
+  0xb2, 0x20, 0xb2, 0x87, 0xda, 0x54, 0xa8, 0x8d, 0xaa, 0x1c, 0xea, 0xec,
+  0x18, 0xf9, 0xb3, 0xdf, 0x41, 0xa0, 0xf9, 0xfd, 0xb8, 0x7c, 0xa2, 0x0b,
+  0xfe, 0x1e, 0x56, 0x0b, 0x58, 0x1f, 0x61, 0x5d, 0xda, 0x55, 0xb4, 0x28,
+  0xe1, 0x56, 0x19, 0x73, 0x57, 0xe6, 0xee, 0x15, 0x0f, 0xaa, 0x6a, 0x02,
+  0xc7, 0x2e, 0xbc, 0xb6, 0x8a, 0x90, 0x37, 0x12, 0x68, 0x1e, 0x87, 0x47,
+  0x2c, 0xde, 0xe4, 0x62, 0x61, 0xb1, 0x75, 0x6e, 0xc1, 0xd6, 0x96, 0xad,
+  0xea, 0x2c, 0xa5, 0x84, 0xe0, 0xdb, 0x81, 0x93, 0x1d, 0xfe, 0x7c, 0x91,
+  0x70, 0x09, 0xb2, 0x5d, 0x0b, 0x20, 0x61, 0x78, 0x11, 0xef, 0xb0, 0xe1,
+  0x2e, 0x61, 0x6d, 0xdf, 0xa2, 0x8c, 0x51, 0x73, 0xb6, 0x7b, 0x5e, 0x74,
+  0x61, 0x2e, 0x9e, 0xf7, 0x4b, 0xfb, 0x18, 0x20, 0x7d, 0xea, 0x41, 0x50,
+  0x29, 0x17, 0x22, 0x35, 0xef, 0xc0, 0x7e, 0x17, 0xcf, 0xe7, 0x57, 0x9d,
+  0x50, 0x5b, 0x5e, 0x60, 0x9f, 0xda, 0x1e, 0xde, 0x3a, 0xe1, 0x86, 0x07,
+  0x96, 0xe7, 0x7a, 0x64, 0x59, 0xbb, 0x70, 0xd8, 0x91, 0xf1, 0xd0, 0x37,
+  0xae, 0x87, 0x31, 0xf0, 0xee, 0x7c, 0x25, 0x20, 0x69, 0xfd, 0x0f, 0x42,
+  0xf4, 0xf9, 0x01, 0x61, 0x28, 0x92, 0x10, 0x36, 0xac, 0x96, 0xe0, 0x79,
+  0xa4, 0xef, 0x8c, 0x87, 0xb3, 0xe1, 0x52, 0xb2, 0x5c, 0xdc, 0x45, 0xe4,
+  0x91, 0x85, 0x84, 0xe2, 0x1c, 0x99, 0x72, 0x81, 0x3f, 0x24, 0x92, 0x07,
+  0x42, 0x77, 0xce, 0x0a, 0x4e, 0x4c, 0xec, 0x27, 0xa0, 0x86, 0x5e, 0x4b,
+  0x05, 0x54, 0xcf, 0x7d, 0xca, 0x88, 0x9c, 0xeb, 0x82, 0xf1, 0xcc, 0x9c,
+  0xee, 0x88, 0xdf, 0x1e, 0xc9, 0xbb, 0xf2, 0x5e, 0x69, 0xbf, 0xc4, 0xc7,
+  0xce, 0x4f, 0xe6, 0xe4, 0xc4, 0x1b, 0x22, 0x6e, 0x76, 0xa9, 0x25, 0xc2,
+  0x4e, 0x62, 0x50, 0x91, 0x55, 0xbb, 0x52, 0xa3, 0xd6, 0x7f, 0x87, 0x46,
+  0xf4, 0xb7, 0xe1, 0xb1, 0x4d, 0x70, 0x81, 0x9f, 0x1c, 0x7d, 0x71, 0x6b,
+  0x44, 0x1e, 0x94, 0xe4, 0xe5, 0x40, 0xa3, 0xe8, 0x19, 0xc8, 0x5d, 0x0e,
+  0xd3, 0xce, 0xa2, 0x22, 0x9e, 0x11, 0xcc, 0x5f, 0xfd, 0x7e, 0xd4, 0x0c,
+  0x35, 0x0f, 0x5a, 0xd3, 0xa3, 0x85, 0x31, 0xa8, 0x0f, 0xd9, 0x77, 0xa6,
+  0xc9, 0x90, 0x17, 0xcf, 0x53, 0xc2, 0xa3, 0x07, 0xa2, 0xe3, 0xf8, 0x38,
+  0x7d, 0x18, 0x51, 0x20, 0x01, 0x80, 0xb5, 0xc7, 0x87, 0x41, 0xe5, 0x11,
+  0xc0, 0x7c, 0xa8, 0x1e, 0x92, 0x01, 0xca, 0x73, 0x80, 0x88, 0x45, 0x0e,
+  0x7d, 0x4d, 0x9e, 0xb2, 0x72, 0x6b, 0x8a, 0xdd, 0x08, 0xad, 0x08, 0x21,
+  0xd1, 0x7f, 0x8b, 0x9d, 0x06, 0xff, 0xed, 0xe9, 0xe6, 0x02, 0x95, 0x89,
+  0x00, 0xb2, 0xaf, 0x9b, 0x01, 0x72, 0x40, 0x29, 0x0e, 0xbe, 0x76, 0x69,
+  0xe6, 0x9d, 0xfa, 0x08, 0xd9, 0x12, 0xdb, 0x8e, 0xc6, 0xfc, 0x93, 0x61,
+  0xee, 0x60, 0x50, 0x1f, 0xb2, 0x8f, 0x6c, 0x86, 0x1c, 0xa0, 0x3c, 0x06,
+  0x48, 0xf8, 0xa3, 0x54, 0xed, 0x51, 0xf4, 0x5b, 0x38, 0xe6, 0x94, 0x8f,
+  0x86, 0xb7, 0x19, 0x16, 0x7a, 0x80, 0xb6, 0x04, 0x4c, 0x97, 0xbc, 0x5b,
+  0x4a, 0x49, 0x5e, 0xef, 0xc7, 0xc8, 0xb3, 0x70, 0x4c, 0xde, 0x0f, 0x6e,
+  0xdb, 0x57, 0xc3, 0x14, 0xda, 0x02, 0x11, 0x7c, 0x5f, 0x57, 0x5b, 0xf8,
+  0x81, 0x16, 0x25, 0x60, 0x12, 0x2d, 0xca, 0xbf, 0x19, 0x6f, 0x0d, 0xc2,
+  0xb8, 0x96, 0x8c, 0x38, 0xaf, 0x13, 0x74, 0x0c, 0xdc, 0xdb, 0x0e, 0x04,
+  0x1e, 0x6a, 0x43, 0xf8, 0xbd, 0x4b, 0x3f, 0x9e, 0xec, 0x8c, 0x36, 0x80,
+  0x81, 0xa4, 0x05, 0xe5, 0xd8, 0x58, 0x30, 0x74, 0x04, 0xdc, 0xd7, 0x00,
+  0x06, 0x1e, 0x68, 0x41, 0x0c, 0x90, 0x6a, 0xc2, 0xf8, 0x10, 0x94, 0xde,
+  0x10, 0x94, 0xa3, 0x43, 0x50, 0xba, 0x21, 0x28, 0x47, 0x87, 0xa0, 0x1c,
+  0x19, 0x82, 0x72, 0x6c, 0x08, 0xd0, 0xb0, 0x3f, 0xb6, 0x1a, 0xd1, 0xd1,
+  0x3c, 0x49, 0x3f, 0x2f, 0xad, 0x11, 0xbe, 0x04, 0x25, 0x1c, 0xfe, 0x8c,
+  0x48, 0x4e, 0x04, 0x64, 0xd1, 0xe9, 0x60, 0xfb, 0x9a, 0x83, 0xb0, 0x7f,
+  0x3f, 0x74, 0xc5, 0x61, 0xa7, 0xa1, 0x53, 0xfb, 0x3c, 0xc5, 0x10, 0x62,
+  0xe2, 0x4e, 0x80, 0xb1, 0x36, 0x78, 0xa5, 0x5b, 0x44, 0x79, 0xdd, 0xe7,
+  0x3f, 0xc6, 0x85, 0x83, 0x32, 0xfd, 0x37, 0x1e, 0x00, 0xf6, 0xef, 0xfa,
+  0x3b, 0x3e, 0xfc, 0xdc, 0x6d, 0x49, 0x55, 0x8f, 0x34, 0xa4, 0xaa, 0xe3,
+  0x76, 0x54, 0xf5, 0x91, 0xcd, 0xa0, 0xa2, 0x7e, 0x89, 0xde, 0x46, 0x00,
+  0xe4, 0x8f, 0xfa, 0xdb, 0x10, 0x7c, 0xe5, 0x26, 0x04, 0xdf, 0x49, 0xb7,
+  0x16, 0xc5, 0xde, 0x3d, 0x2f, 0xba, 0x30, 0x2f, 0xfa, 0xfd, 0x1c, 0xa3,
+  0xef, 0x5d, 0x2f, 0xb5, 0x75, 0x5e, 0x17, 0xef, 0xb2, 0xb6, 0x78, 0xa7,
+  0x46, 0xd9, 0xf8, 0xc5, 0xa2, 0x0f, 0x7c, 0x60, 0x17, 0x15, 0x80, 0x5d,
+  0xf4, 0x3b, 0x27, 0x4e, 0x71, 0x8b, 0x7f, 0x4c, 0xbd, 0x0c, 0x38, 0x50,
+  0xa3, 0x00, 0xa4, 0xeb, 0xf2, 0x22, 0xf7, 0xdb, 0x3a, 0x3a, 0x6e, 0x4c,
+  0x94, 0x99, 0x81, 0x01, 0xae, 0xaf, 0xeb, 0xfc, 0x9d, 0xee, 0x12, 0xd4,
+  0xbd, 0xc9, 0x9e, 0xbd, 0xcf, 0xab, 0xf5, 0xba, 0x71, 0xd1, 0x9b, 0x9e,
+  0xbb, 0x0d, 0x85, 0x82, 0xf2, 0x7d, 0x8d, 0x10, 0x8c, 0x33, 0xdb, 0x74,
+  0x9c, 0xe8, 0xd7, 0x4b, 0xae, 0x8d, 0xe2, 0x51, 0x86, 0xde, 0x51, 0x16,
+  0xa4, 0xeb, 0x66, 0xb6, 0xb6, 0x3e, 0x80, 0x26, 0xf4, 0x0d, 0x5b, 0xf7,
+  0x79, 0x01, 0x06, 0xa9, 0x12, 0xbd, 0x56, 0x42, 0x71, 0xd7, 0x07, 0x19,
+  0x10, 0xb8, 0xa7, 0xdc, 0xf1, 0x27, 0x7d, 0x83, 0xf9, 0x32, 0x1c, 0x81,
+  0x5e, 0xb8, 0x17, 0xe1, 0x40, 0xd8, 0x8d, 0x4b, 0x50, 0xb7, 0x4b, 0x98,
+  0xae, 0xd5, 0x1e, 0xc5, 0x68, 0x3d, 0x50, 0xd1, 0xd8, 0x9f, 0x24, 0x2a,
+  0xb4, 0x11, 0x62, 0x63, 0xbe, 0x90, 0x51, 0x70, 0x79, 0x78, 0x61, 0xfb,
+  0x72, 0xf5, 0x2e, 0xab, 0x1b, 0x53, 0x5e, 0xc1, 0xac, 0x96, 0xac, 0xe4,
+  0xf0, 0xe2, 0x4a, 0x38, 0xd3, 0xd9, 0x9b, 0xd0, 0x8c, 0xe4, 0xd9, 0x87,
+  0xca, 0x0a, 0xfd, 0x43, 0x37, 0x45, 0x99, 0x1b, 0xc1, 0xb0, 0xd6, 0x00,
+  0xf2, 0x44, 0x8f, 0xe0, 0xf0, 0xe3, 0x87, 0xf2, 0x33, 0x43, 0x8f, 0x1b,
+  0xd1, 0xb9, 0x06, 0xf4, 0x34, 0x28, 0x38, 0x5f, 0xdc, 0x05, 0x9a, 0x6b,
+  0x05, 0x05, 0xd2, 0xba, 0xa0, 0x1a, 0x6d, 0x8f, 0x13, 0x81, 0xb4, 0x9f,
+  0xd7, 0xaa, 0xfd, 0x4c, 0x83, 0xb2, 0x79, 0x63, 0x4a, 0x69, 0x5b, 0x25,
+  0x74, 0x10, 0x06, 0x69, 0xbc, 0xbc, 0x27, 0xe4, 0xae, 0xa5, 0x7a, 0x00,
+  0x2e, 0xe8, 0xfa, 0xfa, 0xd4, 0xf9, 0xb1, 0x50, 0x32, 0xf7, 0x93, 0x39,
+  0xd9, 0xf5, 0x82, 0x08, 0x68, 0x48, 0xcb, 0x9c, 0x6b, 0xa2, 0x49, 0x63,
+  0x2c, 0xc4, 0x73, 0xff, 0x9b, 0x6f, 0x6b, 0xe0, 0x86, 0x9e, 0xce, 0xbd,
+  0xc4, 0x56, 0xf3, 0xd6, 0x28, 0x85, 0x27, 0x74, 0xc0, 0xa3, 0xe8, 0x2c,
+  0x36, 0xce, 0x6c, 0x89, 0xd1, 0xbe, 0x8f, 0x3f, 0x45, 0x8a, 0x0d, 0x7f,
+  0x2e, 0xd9, 0xaf, 0x59, 0xc3, 0x32, 0x7d, 0xe1, 0x1d, 0x38, 0x62, 0x9c,
+  0x61, 0xcf, 0xca, 0x37, 0x59, 0xf8, 0x06, 0x41, 0x85, 0x99, 0xf7, 0x72,
+  0x1c, 0x51, 0xac, 0xed, 0x4a, 0x64, 0xf3, 0x4d, 0x76, 0xb2, 0xed, 0xdd,
+  0x57, 0xaf, 0x8c, 0x78, 0x3c, 0xb0, 0x8f, 0x09, 0xbb, 0x1e, 0x78, 0xf3,
+  0x03, 0xbf, 0x62, 0x66, 0x98, 0xa2, 0x65, 0xef, 0x49, 0x2d, 0xd5, 0x54,
+  0x35, 0xc5, 0xc8, 0x27, 0x67, 0xca, 0xcc, 0x58, 0x53, 0x16, 0x7b, 0x38,
+  0x93, 0xd3, 0x0c, 0x21, 0x59, 0xae, 0x41, 0x42, 0x9e, 0x87, 0x23, 0x39,
+  0x45, 0xd3, 0xbc, 0x69, 0xa9, 0x57, 0xf1, 0xdc, 0xc0, 0xde, 0xde, 0x52,
+  0x3b, 0xbf, 0x35, 0xf1, 0x5c, 0xe7, 0x7c, 0xe8, 0x70, 0x43, 0x6e, 0x7f,
+  0x6d, 0x81, 0x3e, 0x3d, 0x58, 0xaa, 0xcb, 0x0b, 0x94, 0x03, 0x40, 0x32,
+  0x04, 0x50, 0xcd, 0x0d, 0x5b, 0x84, 0x41, 0x60, 0x5f, 0x98, 0x7b, 0xf3,
+  0x22, 0x66, 0x16, 0x9f, 0x57, 0xac, 0xf9, 0x78, 0x7e, 0x11, 0x00, 0x7e,
+  0x1f, 0x9c, 0xe3, 0x70, 0xdf, 0x71, 0x6e, 0x8a, 0xf9, 0x1a, 0x2d, 0x15,
+  0xa7, 0x9d, 0xd4, 0xc8, 0x93, 0xf5, 0xc4, 0x4c, 0x1a, 0x16, 0xd0, 0xe8,
+  0x68, 0x03, 0x9c, 0x42, 0x87, 0xc4, 0x78, 0x05, 0xc6, 0x9c, 0x51, 0x21,
+  0xf8, 0x49, 0x46, 0x0d, 0x73, 0xf6, 0x63, 0xa9, 0xd8, 0xbc, 0x32, 0xeb,
+  0xaf, 0x77, 0x86, 0xc0, 0x29, 0xef, 0x0e, 0xe2, 0xcf, 0x77, 0xd5, 0xd6,
+  0xd8, 0x8c, 0x00, 0x9c, 0x24, 0xc4, 0x9d, 0x90, 0xc7, 0x7e, 0x7d, 0xf3,
+  0x6b, 0x93, 0xab, 0x13, 0xde, 0x1f, 0xe7, 0x5c, 0xd1, 0xd9, 0x9c, 0xae,
+  0xe9, 0x14, 0x37, 0xf7, 0x99, 0x4f, 0xc4, 0xb5, 0x39, 0xcb, 0x17, 0x9a,
+  0x95, 0xd5, 0x9a, 0x78, 0x1c, 0x03, 0x3a, 0xb6, 0xa7, 0xcc, 0xcf, 0x5a,
+  0x33, 0x20, 0x50, 0xf6, 0x58, 0x04, 0xa8, 0xb9, 0x95, 0x88, 0x0f, 0x1a,
+  0x88, 0x54, 0x03, 0xf0, 0x19, 0x30, 0x44, 0xd2, 0xa3, 0x97, 0x07, 0x23,
+  0xe1, 0xc2, 0x84, 0x0e, 0x94, 0xf1, 0x25, 0x21, 0x7a, 0x19, 0xcd, 0x55,
+  0x4d, 0x29, 0x54, 0xdc, 0xc4, 0x0a, 0x9b, 0x67, 0x24, 0xe2, 0xbb, 0x40,
+  0x9e, 0x7a, 0x87, 0xa1, 0xd4, 0x3b, 0xf0, 0x23, 0xe9, 0xbf, 0xa9, 0x76,
+  0x99, 0xf8, 0x11, 0x25, 0x56, 0x6c, 0xa8, 0xab, 0xa3, 0x5f, 0x61, 0x0a,
+  0x71, 0xe4, 0xa5, 0x87, 0x11, 0xbd, 0x3d, 0xbf, 0x73, 0x72, 0xcd, 0x72,
+  0x4b, 0xc7, 0xfc, 0x8d, 0x3b, 0x5a, 0x46, 0xc8, 0x05, 0xb0, 0xb3, 0x5d,
+  0x48, 0x8c, 0xba, 0xde, 0xaa, 0x79, 0x91, 0x3d, 0x92, 0x13, 0x25, 0xe6,
+  0xf9, 0x37, 0xb2, 0xba, 0xf0, 0x2b, 0x4e, 0x05, 0x69, 0x7d, 0xfe, 0xd8,
+  0x07, 0x43, 0x7b, 0x96, 0x41, 0x4e, 0x39, 0x6e, 0xee, 0xc2, 0xda, 0x6e,
+  0xed, 0xa7, 0xd0, 0x00, 0x19, 0x8f, 0x0b, 0x81, 0x68, 0x5f, 0xf8, 0x7d,
+  0xa6, 0xa3, 0x95, 0x53, 0x0c, 0xde, 0xa8, 0xff, 0x6d, 0x89, 0xb4, 0xec,
+  0xf5, 0x4c, 0xc6, 0xe8, 0x52, 0x9a, 0xaa, 0x3a, 0xa8, 0xb9, 0xaf, 0xde,
+  0x04, 0xa7, 0x68, 0x89, 0x74, 0x1b, 0x4e, 0x8e, 0x63, 0x9f, 0x2e, 0x6c,
+  0x62, 0xe4, 0xb9, 0xa2, 0x81, 0xc6, 0x71, 0xb3, 0x2c, 0x43, 0x78, 0xdd,
+  0xed, 0xb9, 0xf0, 0x43, 0x8b, 0xea, 0xae, 0xb9, 0x73, 0xad, 0xd7, 0xeb,
+  0xed, 0xd3, 0x22, 0xfe, 0xfe, 0xb2, 0x7f, 0x03, 0x12, 0x7c, 0xed, 0x58,
+  0x2b, 0xd7, 0x95, 0xb5, 0xf0, 0x79, 0xcf, 0x09, 0x98, 0x97, 0x23, 0x67,
+  0xd0, 0xd7, 0x5e, 0x56, 0x6b, 0x91, 0xc4, 0xfc, 0xc5, 0x8f, 0x7b, 0x4d,
+  0xd4, 0x89, 0x6d, 0x7f, 0x8e, 0x45, 0x92, 0xb1, 0xb3, 0x39, 0x4d, 0xc9,
+  0x38, 0xb2, 0xba, 0x0f, 0x19, 0xaf, 0x4b, 0xe8, 0xc6, 0x05, 0x83, 0x70,
+  0xda, 0xc2, 0x72, 0x57, 0xb4, 0x39, 0x27, 0x8a, 0xe9, 0x4a, 0x2a, 0x3c,
+  0x20, 0xe8, 0x5c, 0xcc, 0x59, 0x7a, 0x81, 0xc1, 0x11, 0x42, 0x8e, 0x28,
+  0x26, 0x01, 0x6f, 0x25, 0x50, 0x15, 0xa9, 0xfc, 0x12, 0x11, 0x32, 0x4c,
+  0xda, 0x76, 0x04, 0x3a, 0x26, 0x4c, 0xf0, 0x70, 0xf6, 0x04, 0xed, 0x0b,
+  0x77, 0x34, 0x2f, 0x6e, 0x90, 0x78, 0x29, 0x11, 0x33, 0xb1, 0x99, 0x09,
+  0x28, 0x00, 0xe8, 0x91, 0xbe, 0xdb, 0x4e, 0x16, 0xde, 0x11, 0xbe, 0xbd,
+  0xa8, 0x20, 0x08, 0xd8, 0xce, 0x77, 0x61, 0xec, 0x69, 0x3b, 0xaf, 0x13,
+  0x7c, 0x2c, 0xa2, 0xef, 0x4c, 0x02, 0x3b, 0xa8, 0xa2, 0x0e, 0xbd, 0x2d,
+  0xdc, 0x87, 0x3d, 0x3c, 0xba, 0x17, 0xf4, 0xf6, 0xe5, 0x13, 0xe7, 0x00,
+  0xee, 0x55, 0xd1, 0xb4, 0xf9, 0xde, 0x56, 0xe1, 0xa3, 0xd0, 0xe2, 0xf6,
+  0x6c, 0x3f, 0x55, 0x7a, 0x97, 0xdf, 0xb5, 0x8e, 0x40, 0x85, 0x8d, 0x09,
+  0x6c, 0x8a, 0xbb, 0x01, 0x1c, 0xed, 0xa6, 0x3e, 0x78, 0x7d, 0x28, 0xb0,
+  0x31, 0x0e, 0x16, 0x9c, 0x0d, 0xa8, 0xc7, 0xbb, 0x4e, 0x13, 0xe9, 0x4a,
+  0x3a, 0x19, 0x7c, 0xc8, 0xb9, 0xcd, 0x87, 0xea, 0xa9, 0x93, 0x16, 0x04,
+  0x57, 0x29, 0x09, 0xaa, 0xa0, 0x18, 0x63, 0x6e, 0xbb, 0x25, 0x59, 0xcc,
+  0xfb, 0x63, 0x1e, 0x14, 0x32, 0x89, 0xca, 0xd6, 0x95, 0x03, 0xcf, 0x71,
+  0x52, 0x6c, 0xd2, 0xf3, 0x50, 0xf9, 0x39, 0xe4, 0xc1, 0xe3, 0x38, 0x8e,
+  0xc8, 0x75, 0x40, 0xc5, 0x2e, 0xc1, 0x36, 0x7f, 0x1b, 0x93, 0x63, 0xc6,
+  0xa4, 0x23, 0x65, 0x34, 0x05, 0xd0, 0x6e, 0xff, 0xdf, 0x3a, 0x7b, 0xc5,
+  0x60, 0x82, 0x3e, 0x5a, 0x98, 0xf0, 0x76, 0x87, 0xe6, 0x6a, 0xe8, 0xf6,
+  0x4d, 0x77, 0x21, 0xf3, 0xe1, 0x31, 0xae, 0x3b, 0x47, 0xc2, 0xa7, 0x80,
+  0xf8, 0x9e, 0x11, 0x30, 0x58, 0xfa, 0xbc, 0x0b, 0x24, 0xc3, 0xb8, 0x19,
+  0x12, 0xb0, 0x02, 0xca, 0x14, 0x3a, 0xf4, 0x42, 0x7b, 0x2a, 0x88, 0xa0,
+  0x57, 0xf7, 0x4f, 0x99, 0x35, 0x3b, 0x83, 0x5b, 0xa2, 0x03, 0x62, 0xdf,
+  0x4d, 0xd1, 0xb5, 0xcd, 0x09, 0x19, 0x25, 0x62, 0xe4, 0xe4, 0xe1, 0x99,
+  0x66, 0xc9, 0x51, 0x75, 0x0a, 0xbb, 0x15, 0x15, 0x93, 0xd0, 0x4d, 0xbe,
+  0xbc, 0x2e, 0xdf, 0xcc, 0x1f, 0x3e, 0x5d, 0x3c, 0x7c, 0x6a, 0x5e, 0x3f,
+  0xc3, 0x1f, 0x7c, 0x4b, 0x2a, 0x48, 0x46, 0x71, 0x64, 0xd6, 0x6b, 0xbb,
+  0x15, 0x14, 0x4d, 0x2b, 0x68, 0xa1, 0xdb, 0x7a, 0x59, 0xdf, 0xff, 0x54,
+  0xbe, 0xa0, 0x4e, 0xcc, 0xfa, 0x32, 0x0f, 0x3b, 0x23, 0x75, 0x18, 0x90,
+  0x5d, 0xe7, 0x65, 0x12, 0x2a, 0xee, 0x50, 0x5a, 0x5f, 0xf1, 0x66, 0x4f,
+  0x3a, 0x9b, 0x85, 0x9c, 0x5f, 0x9b, 0x89, 0xcc, 0x45, 0x97, 0xb9, 0x92,
+  0x79, 0xf1, 0xb2, 0xd8, 0x15, 0xb0, 0x8f, 0x2d, 0x35, 0x03, 0xae, 0xf9,
+  0xe8, 0xf7, 0xe7, 0x0b, 0xe4, 0xcd, 0x8e, 0x03, 0x88, 0xad, 0x28, 0xaa,
+  0xb7, 0x43, 0xd7, 0xf6, 0x9e, 0xaf, 0x0e, 0x59, 0xc1, 0xfa, 0xd1, 0xc7,
+  0x2b, 0x4c, 0x81, 0x4d, 0xf7, 0xcc, 0x8a, 0x66, 0xb3, 0x84, 0x52, 0xfb,
+  0x43, 0x1b, 0xec, 0x9a, 0x9e, 0x92, 0x1b, 0xcf, 0x72, 0x55, 0xd4, 0xab,
+  0x32, 0x17, 0xd6, 0x41, 0x91, 0x15, 0x72, 0x54, 0x32, 0xef, 0x0a, 0x4f,
+  0x50, 0x4a, 0x33, 0x54, 0x73, 0xc2, 0x0f, 0x6f, 0x97, 0x82, 0xbb, 0x4b,
+  0xd8, 0x5b, 0x22, 0xf6, 0x95, 0x98, 0x8a, 0x98, 0xdb, 0xee, 0x78, 0xa7,
+  0x93, 0xb5, 0x1b, 0x52, 0x76, 0xc9, 0x52, 0xa1, 0x3f, 0xd2, 0x7b, 0x9e,
+  0xa1, 0x56, 0x70, 0xf3, 0x41, 0x3e, 0xdd, 0x98, 0xa7, 0x59, 0xd9, 0x2e,
+  0xe5, 0xee, 0xd4, 0x8b, 0xf5, 0x53, 0xc0, 0x22, 0xdd, 0x11, 0xd8, 0x2e,
+  0x01, 0xf4, 0x4a, 0x80, 0x40, 0xc0, 0xee, 0x3d, 0x4d, 0xf0, 0x89, 0x6c,
+  0x86, 0x40, 0x9c, 0xb7, 0x98, 0x4f, 0x7a, 0x57, 0xed, 0xf2, 0x70, 0x3b,
+  0x37, 0xb5, 0xd8, 0xfd, 0xab, 0x32, 0xae, 0x44, 0xd6, 0xac, 0x8a, 0xa2,
+  0xb7, 0x48, 0xeb, 0x7f, 0xe9, 0x92, 0x9b, 0xc4, 0x68, 0xad, 0x85, 0x8f,
+  0xc7, 0xe7, 0x9a, 0xaf, 0x58, 0x6d, 0x34, 0x14, 0x35, 0xf4, 0x98, 0xc9,
+  0xbf, 0xee, 0xde, 0xee, 0xaa, 0xf7, 0x3b, 0xbd, 0x72, 0x46, 0x9e, 0xf0,
+  0x93, 0xb0, 0x46, 0xa2, 0xe3, 0xc0, 0x70, 0x3a, 0x22, 0xad, 0x46, 0x31,
+  0x7a, 0x22, 0xa1, 0x8c, 0xe4, 0x32, 0xe6, 0x15, 0x3a, 0x10, 0x97, 0x2d,
+  0xdb, 0x15, 0x51, 0x2a, 0x37, 0x6d, 0xd6, 0x62, 0x48, 0x8b, 0xd5, 0xdb,
+  0xec, 0x96, 0x93, 0x8f, 0xa5, 0x72, 0x57, 0xe9, 0x85, 0xcf, 0xee, 0x9e,
+  0x3e, 0x14, 0x05, 0xe2, 0x79, 0x5d, 0x1e, 0xf8, 0xaa, 0xa4, 0xe7, 0x8e,
+  0x83, 0xee, 0x37, 0xe1, 0xad, 0x06, 0x64, 0xc1, 0xd0, 0xb0, 0x8a, 0x13,
+  0xbb, 0x79, 0x62, 0xf7, 0xbc, 0x74, 0x05, 0x6b, 0x89, 0xd7, 0x04, 0x72,
+  0x96, 0x26, 0x49, 0x4f, 0xfc, 0xda, 0xe4, 0xce, 0x27, 0x3f, 0xf7, 0x18,
+  0xdc, 0xd8, 0x0b, 0x52, 0x05, 0x4f, 0x04, 0xa0, 0x80, 0x4d, 0x36, 0xd4,
+  0x6b, 0x5b, 0x2b, 0x09, 0xb6, 0x88, 0x38, 0xc8, 0xc7, 0x78, 0xe6, 0xd5,
+  0x8d, 0x6b, 0x77, 0x61, 0xb8, 0x4d, 0x8b, 0xc5, 0x22, 0xa8, 0x40, 0x11,
+  0x91, 0x01, 0xe7, 0x8f, 0x11, 0x0e, 0x4a, 0x9a, 0x64, 0xb6, 0x7d, 0xe0,
+  0xa7, 0x73, 0xbd, 0xa4, 0x4d, 0x26, 0x36, 0xdb, 0xc9, 0x61, 0x11, 0x9e,
+  0x91, 0xdb, 0x9e, 0x6c, 0x6b, 0xd1, 0x59, 0x4b, 0x67, 0x94, 0xe3, 0xf1,
+  0xeb, 0x91, 0x93, 0x59, 0xcf, 0xad, 0x33, 0x8a, 0xea, 0x04, 0x02, 0x64,
+  0xfa, 0x63, 0xdf, 0x93, 0x0b, 0xe6, 0x9d, 0xfa, 0x98, 0x52, 0x24, 0x98,
+  0xce, 0xd7, 0x95, 0x7e, 0xfd, 0xa5, 0xbb, 0x08, 0xf2, 0x89, 0x01, 0x44,
+  0xcf, 0x17, 0xf4, 0xb0, 0x62, 0xa3, 0x2f, 0xec, 0xaa, 0xb5, 0x0b, 0xd8,
+  0x68, 0xe1, 0xac, 0x4d, 0xf3, 0xe9, 0x6d, 0xbe, 0xe3, 0x4f, 0x4f, 0xc4,
+  0xda, 0x25, 0x26, 0xb0, 0x85, 0xb1, 0x77, 0xc0, 0x0b, 0xf3, 0x27, 0xbc,
+  0x96, 0xa6, 0x99, 0x1d, 0x4f, 0xa1, 0x4c, 0x7b, 0xa5, 0xa2, 0xfa, 0xec,
+  0x8e, 0xbe, 0x8b, 0xed, 0x0b, 0xea, 0x06, 0xaa, 0xe8, 0xb9, 0xf5, 0x45,
+  0xa0, 0x5d, 0xdc, 0xb1, 0xf5, 0xbf, 0x4c, 0x05, 0x24, 0x99, 0x6a, 0xdf,
+  0x84, 0x3d, 0xe5, 0x3a, 0x52, 0x67, 0x58, 0x05, 0x3b, 0x95, 0x6a, 0x5f,
+  0x95, 0xf7, 0x2e, 0x17, 0x5d, 0x7a, 0x36, 0xed, 0xab, 0xd5, 0x66, 0x93,
+  0x6d, 0xb7, 0x74, 0xff, 0xb3, 0x3b, 0x9d, 0xa2, 0xb9, 0xf4, 0xd6, 0x8f,
+  0x4f, 0x13, 0x19, 0xaa, 0x07, 0xef, 0xc3, 0x89, 0x05, 0xdb, 0x1d, 0x37,
+  0xf3, 0x9a, 0x80, 0xc6, 0x6c, 0x8c, 0xd2, 0x32, 0xdf, 0xca, 0x6a, 0x67,
+  0xef, 0xb1, 0x3b, 0x6e, 0xdb, 0xf5, 0x3b, 0x6c, 0x46, 0xae, 0x62, 0xcf,
+  0x5c, 0x20, 0x9e, 0x08, 0xc7, 0xdb, 0xe3, 0x71, 0xc4, 0x56, 0xf0, 0xf8,
+  0x9e, 0x9d, 0x1b, 0x0b, 0xaf, 0xeb, 0x3a, 0x7d, 0xd9, 0xc3, 0xda, 0x6e,
+  0x58, 0x52, 0xcc, 0x0d, 0x70, 0x56, 0x97, 0xf1, 0xd3, 0x39, 0xa3, 0xb0,
+  0x95, 0x0f, 0x68, 0x74, 0xb0, 0x60, 0xa7, 0x11, 0x52, 0x92, 0xe6, 0x5a,
+  0x48, 0xcd, 0x3b, 0x8f, 0x1f, 0xab, 0x9b, 0x5d, 0x6a, 0x9c, 0xfa, 0x06,
+  0x89, 0xbc, 0x2e, 0x41, 0x28, 0xbd, 0x30, 0x96, 0xcc, 0x60, 0x13, 0x13,
+  0xa0, 0xc6, 0xe0, 0x60, 0x68, 0xd2, 0x7a, 0xc8, 0x02, 0x27, 0x6f, 0xde,
+  0x1e, 0xb8, 0xf2, 0x3c, 0x01, 0x7b, 0xd9, 0xe8, 0x48, 0x1c, 0x31, 0x13,
+  0x10, 0x99, 0xf4, 0xcf, 0x85, 0x07, 0x27, 0x66, 0xc8, 0x51, 0xfe, 0xe0,
+  0x9b, 0xa8, 0x89, 0x96, 0x86, 0x59, 0xc3, 0x53, 0xb1, 0x89, 0xbc, 0xb2,
+  0x2f, 0xfd, 0x9a, 0xbd, 0xfc, 0x3d, 0x0b, 0x01, 0xf4, 0xb6, 0x20, 0x74,
+  0xe9, 0x15, 0xaf, 0xd4, 0x84, 0xd5, 0x21, 0x98, 0x5c, 0xa2, 0xb5, 0xf7,
+  0xeb, 0x8b, 0x85, 0x2e, 0x0c, 0x6c, 0xc9, 0xeb, 0xd2, 0xe9, 0x0c, 0x9f,
+  0xb6, 0xa5, 0x93, 0xb3, 0xe3, 0xa8, 0x7b, 0xe6, 0xc8, 0x8b, 0xa2, 0x38,
+  0x1d, 0xcf, 0x05, 0x12, 0x57, 0xcc, 0x0d, 0x6b, 0xea, 0xb8, 0x29, 0x9e,
+  0x8a, 0xfb, 0xce, 0x3c, 0x5e, 0xea, 0x56, 0xf5, 0x98, 0xe6, 0xff, 0xd0,
+  0x6f, 0x7e, 0xd4, 0xea, 0xae, 0xdc, 0xe0, 0xe8, 0x17, 0xdd, 0xc9, 0x5e,
+  0xe9, 0x60, 0xc0, 0x1c, 0x5b, 0xee, 0xb3, 0xa2, 0x7e, 0xc2, 0xb6, 0xf7,
+  0xf9, 0xb4, 0xcc, 0x6e, 0x0f, 0x79, 0x5d, 0xe7, 0x66, 0xf2, 0xc5, 0xc4,
+  0x3c, 0xb7, 0x15, 0xf0, 0x39, 0x0f, 0xe3, 0x9f, 0x1d, 0x01, 0x33, 0x2d,
+  0x73, 0x58, 0x5d, 0xd6, 0x75, 0x7e, 0xb5, 0x37, 0x93, 0x2f, 0xfb, 0x31,
+  0x1d, 0x03, 0xe5, 0x70, 0x7d, 0x63, 0x26, 0xff, 0x6b, 0x1c, 0xd7, 0x10,
+  0xd4, 0x14, 0xf4, 0xf4, 0xeb, 0xfb, 0x66, 0x93, 0xbf, 0xbb, 0x82, 0x3e,
+  0xfa, 0xaa, 0x17, 0xd9, 0x71, 0x60, 0x1e, 0xb6, 0x03, 0x68, 0x91, 0x47,
+  0x60, 0x1b, 0x02, 0x9b, 0x6e, 0x30, 0x8b, 0x36, 0x86, 0x1b, 0xfe, 0xe7,
+  0x5e, 0x4c, 0xe3, 0x20, 0xd3, 0x66, 0xbf, 0xc1, 0xf0, 0x00, 0x59, 0x79,
+  0x75, 0x9d, 0x37, 0x4d, 0x5e, 0x5e, 0xfd, 0xc9, 0x4c, 0xfe, 0x67, 0x2f,
+  0xc2, 0x47, 0x41, 0x77, 0x71, 0xdf, 0x9b, 0xc9, 0xff, 0x39, 0x1e, 0xf7,
+  0x10, 0x34, 0x6c, 0x1b, 0x9a, 0x6a, 0x75, 0xd5, 0xe1, 0x08, 0x80, 0x61,
+  0xd8, 0x17, 0x1e, 0xe6, 0x47, 0xc0, 0xc6, 0x78, 0x95, 0x3b, 0x8e, 0xc1,
+  0x3b, 0x04, 0x3b, 0xfd, 0x53, 0xb6, 0xaa, 0xae, 0x0b, 0xaf, 0x6e, 0x3c,
+  0x2a, 0x82, 0x49, 0xf5, 0xd2, 0xc3, 0x77, 0x04, 0x0c, 0x6a, 0x61, 0x57,
+  0xd1, 0x8c, 0xc2, 0xfa, 0xda, 0x90, 0xb2, 0xa3, 0xa0, 0xbc, 0xf1, 0xd9,
+  0x64, 0xf5, 0xb6, 0xda, 0x15, 0x2b, 0xe9, 0x71, 0xd7, 0x02, 0xf3, 0x32,
+  0x39, 0x42, 0x47, 0xc1, 0x4f, 0x41, 0xdf, 0xad, 0x33, 0x5b, 0xc8, 0x4c,
+  0x3e, 0xeb, 0xa1, 0xf6, 0x48, 0xb8, 0x80, 0xde, 0xdd, 0xdb, 0xbc, 0xbc,
+  0x10, 0xc6, 0xc6, 0x5d, 0x19, 0x82, 0xf7, 0xb0, 0xd3, 0x38, 0x70, 0x07,
+  0xf3, 0x8b, 0x18, 0xf8, 0xc5, 0x00, 0xe6, 0x14, 0xb0, 0x1a, 0xcb, 0x68,
+  0x97, 0xa9, 0x19, 0xce, 0x6b, 0xe3, 0x44, 0xa8, 0xcb, 0x74, 0x1e, 0x6b,
+  0x30, 0xc7, 0x96, 0x8c, 0x75, 0x1e, 0x56, 0x74, 0x3c, 0xb8, 0x05, 0x67,
+  0x65, 0xa6, 0xcc, 0xcc, 0x5f, 0x6d, 0x60, 0xaf, 0x27, 0x56, 0x3f, 0xdd,
+  0xb7, 0x36, 0x87, 0xfd, 0x9e, 0xfc, 0x10, 0x30, 0x6c, 0xc7, 0xd2, 0xac,
+  0x40, 0xd9, 0x79, 0xb6, 0xcf, 0x1a, 0xbc, 0x29, 0x5c, 0x60, 0x9c, 0x09,
+  0xf4, 0xa2, 0xac, 0xea, 0xb7, 0x84, 0x43, 0x94, 0xb8, 0x2d, 0xda, 0xcd,
+  0xa6, 0x7b, 0x3c, 0xa2, 0xbf, 0x3a, 0x34, 0x79, 0x73, 0xb5, 0xaf, 0x8b,
+  0x6d, 0x7e, 0x05, 0xfa, 0xc9, 0x95, 0xf3, 0x7a, 0xe0, 0x98, 0x18, 0x89,
+  0x12, 0x0c, 0xcc, 0xd7, 0x23, 0x5f, 0xa6, 0x00, 0x08, 0x25, 0x2e, 0x56,
+  0xeb, 0x2b, 0xeb, 0xa2, 0xd1, 0x1c, 0x8b, 0x9d, 0xfe, 0x41, 0x77, 0x1b,
+  0x09, 0x0b, 0x44, 0x8b, 0xd6, 0xa9, 0x6e, 0x4d, 0x4e, 0x3f, 0x4c, 0xef,
+  0x3e, 0xe0, 0xbf, 0xf7, 0xf4, 0xef, 0x9f, 0x3f, 0x2c, 0x3c, 0x2b, 0x08,
+  0x75, 0xf3, 0xe9, 0x6c, 0x4f, 0xb5, 0xe0, 0x25, 0x96, 0x70, 0x68, 0xf4,
+  0xfd, 0x22, 0x2a, 0x30, 0x1d, 0x2f, 0xd0, 0xd9, 0x6a, 0x68, 0x89, 0x64,
+  0xc8, 0x61, 0xf4, 0x86, 0x1b, 0xed, 0x5c, 0xb4, 0x73, 0xbc, 0xf4, 0xee,
+  0x40, 0x5b, 0x13, 0xb6, 0xec, 0x0e, 0xc5, 0xce, 0x4c, 0x17, 0x4c, 0x9d,
+  0x35, 0x9d, 0xb2, 0x2e, 0x0b, 0x07, 0x4b, 0x75, 0xaf, 0x61, 0xe3, 0x97,
+  0x18, 0x1a, 0x35, 0x13, 0x4a, 0x5e, 0x61, 0xb1, 0xc4, 0x51, 0x6f, 0xee,
+  0xba, 0x06, 0xb8, 0xc9, 0xa9, 0x17, 0xf5, 0xa8, 0x8d, 0x8b, 0xb2, 0x72,
+  0x31, 0x9f, 0x40, 0xc9, 0xc9, 0x62, 0xe2, 0xe9, 0xa3, 0x56, 0x61, 0xec,
+  0xa6, 0xa8, 0xf4, 0x02, 0x2d, 0xa9, 0xb9, 0x0d, 0x46, 0x15, 0xcd, 0xf2,
+  0x4f, 0xad, 0xb6, 0xc2, 0x0e, 0xa0, 0x13, 0xf5, 0xd2, 0x5d, 0x2c, 0x7a,
+  0x7d, 0x8b, 0xbc, 0xfb, 0x87, 0x8c, 0x73, 0xef, 0x90, 0x47, 0x11, 0x72,
+  0x45, 0xe3, 0xc1, 0xde, 0xea, 0x0c, 0xc5, 0x18, 0x53, 0xa2, 0x52, 0xf7,
+  0x9a, 0x5a, 0x53, 0xa2, 0x33, 0xe2, 0xc7, 0x9e, 0x6b, 0x4d, 0xa2, 0x87,
+  0xdd, 0x88, 0xc9, 0x80, 0x79, 0x01, 0x0b, 0xe6, 0xef, 0xbc, 0x00, 0x31,
+  0x81, 0x0d, 0x18, 0xa7, 0x77, 0x92, 0xd7, 0xf5, 0xe8, 0x63, 0xef, 0xba,
+  0x57, 0x86, 0xf8, 0x8d, 0xe5, 0x93, 0xdd, 0xc2, 0x3e, 0xbe, 0xb3, 0x9d,
+  0x31, 0x87, 0x6d, 0x5a, 0x8d, 0x9e, 0xb5, 0xbf, 0x82, 0xb9, 0x9e, 0xef,
+  0xaa, 0xc3, 0xed, 0xc6, 0xc8, 0xc0, 0x36, 0x18, 0x66, 0x35, 0x39, 0xb1,
+  0xda, 0xca, 0x59, 0xbe, 0x38, 0x74, 0x70, 0x0d, 0xeb, 0x35, 0xec, 0xae,
+  0x3d, 0x65, 0x18, 0x74, 0x46, 0x76, 0x65, 0x42, 0x43, 0x8f, 0xa5, 0xc0,
+  0xf3, 0x2c, 0x50, 0x06, 0x91, 0xe1, 0x0f, 0xb8, 0x4c, 0xf4, 0x58, 0x39,
+  0xc4, 0xa7, 0x22, 0x1d, 0xb6, 0x53, 0x1b, 0xd0, 0x62, 0x9c, 0xa7, 0x64,
+  0xbb, 0xd4, 0xe1, 0xad, 0x11, 0x86, 0x49, 0xb3, 0x89, 0x75, 0x29, 0xdb,
+  0xf7, 0xef, 0x96, 0xfb, 0xa2, 0xb7, 0x1d, 0x43, 0xd7, 0x71, 0x54, 0xa5,
+  0x68, 0x9a, 0x4f, 0x02, 0x14, 0x89, 0x74, 0xa7, 0xde, 0x86, 0xc7, 0xe1,
+  0x58, 0xf4, 0xd0, 0x1f, 0x58, 0x52, 0xbe, 0x2c, 0xab, 0xb6, 0xc5, 0x5d,
+  0xaf, 0x2c, 0x19, 0x81, 0x19, 0x45, 0x82, 0x73, 0x8a, 0x3b, 0x16, 0x57,
+  0x6e, 0x9f, 0xba, 0x12, 0x10, 0x3f, 0x1d, 0x67, 0xb4, 0x24, 0xc8, 0xd0,
+  0x62, 0x49, 0x75, 0x79, 0x26, 0x4b, 0xbb, 0xa7, 0x87, 0xbd, 0x17, 0x7e,
+  0x23, 0xa0, 0xe8, 0x34, 0x21, 0xdc, 0x3d, 0x3f, 0x64, 0xe6, 0x21, 0xa3,
+  0x7d, 0x33, 0xfc, 0x99, 0x60, 0xf8, 0x29, 0x2a, 0x68, 0xa8, 0x7e, 0xf8,
+  0x25, 0x27, 0x65, 0x63, 0x48, 0x42, 0x0c, 0x41, 0x61, 0xff, 0x94, 0x90,
+  0x8e, 0x99, 0x8a, 0x6d, 0x76, 0x9b, 0x2f, 0x57, 0xd5, 0x01, 0x43, 0xe7,
+  0x3c, 0x35, 0xcf, 0xd5, 0x27, 0xe2, 0x53, 0xe8, 0xce, 0xa2, 0xa5, 0xd3,
+  0x12, 0x42, 0xc0, 0x21, 0xd0, 0xce, 0x6f, 0x77, 0x87, 0x3d, 0xf4, 0xb7,
+  0xb9, 0x29, 0x28, 0xf4, 0x85, 0xed, 0x3c, 0x7c, 0xb9, 0x94, 0x8f, 0xf8,
+  0x8d, 0x7b, 0x4c, 0x1d, 0x89, 0x77, 0xab, 0x1b, 0x8a, 0x54, 0x48, 0x50,
+  0xbb, 0xc3, 0xf6, 0xa9, 0x7c, 0xf0, 0xe9, 0xde, 0x66, 0x77, 0xd5, 0xa1,
+  0xbd, 0x7a, 0x58, 0xc3, 0xff, 0xb4, 0x9a, 0x09, 0xad, 0x65, 0xfb, 0x62,
+  0xbd, 0x88, 0x8a, 0x8f, 0x50, 0x89, 0x41, 0xbd, 0xd2, 0x24, 0xe2, 0x97,
+  0xef, 0x81, 0x3e, 0x44, 0x33, 0x4c, 0x5c, 0x58, 0xad, 0xab, 0xf2, 0x07,
+  0x36, 0xac, 0xc2, 0xbc, 0x39, 0xdc, 0xdc, 0x58, 0x8f, 0x67, 0x21, 0x22,
+  0x1c, 0x0e, 0xf9, 0x44, 0x28, 0xda, 0x7c, 0xbb, 0x27, 0x3c, 0xc4, 0x4f,
+  0x58, 0x36, 0x3e, 0xad, 0x83, 0xf7, 0x2c, 0x94, 0xa6, 0x5c, 0x2b, 0x2d,
+  0x0e, 0xef, 0x6e, 0x23, 0xd2, 0xe1, 0xcd, 0x24, 0x7a, 0xb5, 0xdf, 0xdd,
+  0x8a, 0xe7, 0x92, 0x6b, 0x51, 0x4c, 0x88, 0x75, 0x32, 0xec, 0xeb, 0x13,
+  0xbf, 0x3b, 0xa2, 0xc2, 0xce, 0xd3, 0x06, 0xe3, 0xec, 0x4d, 0x1a, 0xd8,
+  0xb2, 0x03, 0xf8, 0x26, 0x23, 0x71, 0x7d, 0xad, 0xa1, 0xb3, 0x29, 0x90,
+  0xd3, 0x64, 0x9d, 0xc1, 0xe6, 0x12, 0xbe, 0xc2, 0xc7, 0xa6, 0xaa, 0x76,
+  0xf8, 0x17, 0xdb, 0x32, 0x5f, 0xe0, 0xc9, 0x43, 0xdd, 0x4a, 0x70, 0x34,
+  0x99, 0xea, 0x74, 0x3a, 0x8c, 0x51, 0x0b, 0xe8, 0x9a, 0x3a, 0x40, 0xdc,
+  0x97, 0xe4, 0xa1, 0x9a, 0xed, 0x6c, 0x2d, 0xb8, 0x80, 0x80, 0xbc, 0x6f,
+  0x26, 0x5e, 0x08, 0x35, 0xed, 0x1f, 0x58, 0x1b, 0xb2, 0x2d, 0x1d, 0xa1,
+  0x06, 0xb3, 0xfd, 0xa6, 0xde, 0xb6, 0xce, 0x55, 0x40, 0x43, 0x33, 0x48,
+  0x99, 0xaa, 0x5c, 0x5f, 0xe9, 0x24, 0x98, 0x60, 0xda, 0x96, 0x16, 0xb7,
+  0xb1, 0x38, 0x9e, 0xd0, 0x8b, 0x66, 0x5f, 0xac, 0x9a, 0xe2, 0xcf, 0xb9,
+  0x79, 0x58, 0xc3, 0xff, 0x80, 0x4c, 0xf8, 0xfe, 0xe7, 0xbc, 0xae, 0xb2,
+  0xbb, 0xa2, 0x79, 0xa5, 0xc6, 0x0b, 0x0d, 0x17, 0x0a, 0x08, 0xc2, 0x81,
+  0x5a, 0x38, 0xc2, 0x76, 0xb7, 0x2b, 0x50, 0x92, 0xab, 0x45, 0xb7, 0x0a,
+  0x7a, 0x6f, 0xa8, 0x71, 0xe6, 0x3a, 0x5b, 0xbd, 0xbd, 0xa5, 0xf8, 0x65,
+  0xe6, 0xf7, 0xe8, 0x81, 0xd0, 0x62, 0x78, 0xcb, 0x7c, 0x07, 0xcd, 0x5f,
+  0xe5, 0x18, 0xb4, 0x70, 0x87, 0x17, 0x86, 0x30, 0x4e, 0x4d, 0x79, 0x76,
+  0xf1, 0x1c, 0x3e, 0xe1, 0x9b, 0x06, 0xb6, 0x06, 0xb9, 0xb9, 0x38, 0x7f,
+  0x6e, 0x84, 0xd0, 0xb3, 0x6f, 0x43, 0x68, 0xf0, 0xd2, 0x52, 0x9b, 0x20,
+  0xf7, 0x88, 0x5a, 0xe2, 0x7e, 0x44, 0x96, 0x1d, 0x28, 0xe5, 0xc9, 0x55,
+  0x8f, 0x15, 0xed, 0x98, 0xd1, 0x58, 0xdd, 0x14, 0x75, 0xe3, 0xe8, 0x43,
+  0x64, 0xce, 0xa4, 0x34, 0x15, 0xb7, 0x93, 0xe0, 0x6b, 0x74, 0x1d, 0xa2,
+  0xd8, 0xb5, 0x57, 0x14, 0x87, 0x0d, 0x7d, 0xeb, 0x8d, 0x9b, 0xb2, 0x18,
+  0xe2, 0x46, 0xbc, 0xc6, 0x09, 0x97, 0xba, 0x4d, 0xda, 0x9b, 0x20, 0x65,
+  0x65, 0x89, 0x9b, 0x8a, 0xf6, 0x62, 0x71, 0x5d, 0x1a, 0x26, 0x2b, 0xab,
+  0x6f, 0x0f, 0xa4, 0x26, 0xc0, 0x8e, 0x07, 0xbb, 0x11, 0x98, 0x55, 0xca,
+  0x9f, 0x4f, 0x62, 0xc4, 0x36, 0xae, 0xde, 0x06, 0x4d, 0x68, 0xb6, 0x1a,
+  0xf8, 0x35, 0x54, 0x8f, 0xb4, 0xf0, 0x98, 0x8a, 0xc4, 0xb4, 0x28, 0x55,
+  0x04, 0xc7, 0x84, 0xd0, 0x58, 0xaf, 0x39, 0xec, 0x30, 0x52, 0xb9, 0xb6,
+  0xab, 0x13, 0xb2, 0x77, 0x84, 0xc5, 0xfe, 0xaa, 0x97, 0x7c, 0x13, 0xe1,
+  0x92, 0x8e, 0x0c, 0xa1, 0xc4, 0x25, 0x4c, 0x6b, 0xc0, 0x75, 0x89, 0x71,
+  0x19, 0x5b, 0x73, 0xb9, 0x02, 0x85, 0x31, 0x5f, 0x01, 0x51, 0x5e, 0x9f,
+  0xd3, 0x4a, 0x04, 0x7f, 0x33, 0xd8, 0x6c, 0x2f, 0x6f, 0xea, 0x8c, 0x5c,
+  0x9e, 0xf3, 0xa7, 0xe8, 0xb1, 0xed, 0x00, 0x60, 0xc0, 0xb2, 0x1d, 0x48,
+  0x96, 0x16, 0x76, 0x1d, 0x0a, 0x92, 0x2a, 0xb5, 0x60, 0x11, 0x51, 0xe7,
+  0x74, 0xa0, 0xf1, 0x89, 0x69, 0x2f, 0x49, 0xec, 0xd8, 0xc8, 0x8d, 0x4d,
+  0x8b, 0x1b, 0x48, 0x91, 0x3e, 0x35, 0x0c, 0xb7, 0x4e, 0x67, 0x90, 0x36,
+  0x1c, 0xe2, 0x11, 0x35, 0xc9, 0xd3, 0x70, 0xad, 0x6b, 0x1c, 0x77, 0x34,
+  0x30, 0xf5, 0xd8, 0x11, 0x67, 0x4e, 0x72, 0xae, 0xf1, 0x18, 0x84, 0x2b,
+  0x8d, 0x9c, 0x98, 0xf1, 0xd5, 0x32, 0x6b, 0x5b, 0x4e, 0x2d, 0x20, 0x74,
+  0x4d, 0xe4, 0xc1, 0x46, 0x1c, 0x9c, 0x90, 0x17, 0x8b, 0xaf, 0x33, 0x90,
+  0x27, 0x6e, 0xaa, 0x5b, 0x52, 0x3d, 0xc1, 0x2a, 0xc8, 0xb4, 0x44, 0xed,
+  0xd7, 0xf3, 0x1a, 0x3a, 0x8d, 0x7c, 0xd1, 0x9f, 0x58, 0x0f, 0xd7, 0x25,
+  0xba, 0xa7, 0xa8, 0x0b, 0x43, 0xec, 0x0c, 0xf0, 0x0a, 0xbd, 0x01, 0xb8,
+  0x75, 0xac, 0xfc, 0x4d, 0xa8, 0xd5, 0x13, 0x1b, 0x32, 0x00, 0x49, 0xf3,
+  0xc8, 0xc8, 0x0e, 0x18, 0x40, 0x0c, 0x94, 0xee, 0xd3, 0xd6, 0xe9, 0xa6,
+  0x3e, 0x52, 0xe8, 0xe7, 0x1d, 0x06, 0x4d, 0xb4, 0x51, 0x78, 0xd7, 0x39,
+  0x86, 0xe4, 0xbd, 0xcf, 0x9b, 0xdf, 0x4f, 0x1e, 0x32, 0xed, 0x0c, 0xea,
+  0x25, 0x55, 0x01, 0xd3, 0xc5, 0x25, 0x66, 0xd6, 0x50, 0x79, 0xdd, 0xc1,
+  0x04, 0x8d, 0x9a, 0x91, 0x16, 0xeb, 0x3a, 0xa8, 0xaf, 0x7b, 0x74, 0x0f,
+  0x10, 0xf7, 0xd1, 0x93, 0xc8, 0x33, 0x26, 0xd1, 0x4b, 0x52, 0xd4, 0x76,
+  0x95, 0x89, 0x86, 0x72, 0xb0, 0xbf, 0x02, 0xe4, 0x37, 0xc8, 0x16, 0x0f,
+  0x19, 0x06, 0x2b, 0x1e, 0xe9, 0xb7, 0xe4, 0xa4, 0x88, 0x3b, 0x73, 0x14,
+  0x77, 0x4f, 0xa7, 0x8e, 0x22, 0xe7, 0xe3, 0xf1, 0x4e, 0x3f, 0xc7, 0xee,
+  0x81, 0x82, 0x04, 0x84, 0xc8, 0x2a, 0x57, 0x0f, 0x0c, 0xb5, 0x08, 0xd0,
+  0x2b, 0xde, 0x3e, 0xf2, 0x57, 0x3d, 0x1d, 0x63, 0x4b, 0x41, 0xf8, 0x6e,
+  0x29, 0x42, 0x79, 0x9b, 0xbf, 0xcb, 0x74, 0x1f, 0x22, 0x10, 0x02, 0x82,
+  0x1b, 0x3e, 0xd5, 0xcb, 0xc3, 0xb2, 0x9e, 0x77, 0x7d, 0xf0, 0x81, 0x5a,
+  0xb6, 0x43, 0xc1, 0xc6, 0xbf, 0x65, 0x4e, 0xfb, 0x8e, 0x06, 0x2c, 0x24,
+  0xad, 0xf4, 0x15, 0x32, 0x16, 0x7a, 0xa1, 0xcc, 0x92, 0xd5, 0x2b, 0x12,
+  0xe3, 0xbb, 0x59, 0x5a, 0xc2, 0x97, 0x85, 0xb6, 0x36, 0x3d, 0xd1, 0xc8,
+  0xa8, 0x8d, 0x7a, 0xa7, 0x8a, 0x7a, 0x48, 0x6b, 0x66, 0x56, 0x7e, 0x7f,
+  0x87, 0xce, 0x18, 0x87, 0xe6, 0x1a, 0xf7, 0xdf, 0xfe, 0x20, 0x7c, 0x59,
+  0x63, 0x90, 0x5c, 0x9c, 0xd8, 0x3f, 0xc3, 0xc6, 0x99, 0x8f, 0x50, 0x3b,
+  0x93, 0x76, 0x2e, 0x84, 0xec, 0x1b, 0x7d, 0x61, 0xe6, 0x1f, 0x03, 0x51,
+  0xfe, 0x57, 0x96, 0x5b, 0x4e, 0x39, 0x8a, 0xd5, 0x25, 0xef, 0x20, 0xa8,
+  0xb9, 0x6f, 0x40, 0x2f, 0x5d, 0x3a, 0x58, 0x50, 0x01, 0x59, 0x13, 0x66,
+  0x91, 0xa8, 0x02, 0xe6, 0x74, 0x2a, 0xc2, 0xd4, 0xe9, 0x5c, 0x2f, 0x3c,
+  0x34, 0x4e, 0x3d, 0x8e, 0xf4, 0x65, 0x0f, 0x86, 0x47, 0x16, 0x34, 0x4e,
+  0x18, 0x20, 0xba, 0x23, 0xd5, 0x16, 0xed, 0x01, 0x98, 0x8a, 0xba, 0x29,
+  0xa3, 0x9d, 0xbe, 0xee, 0x6c, 0x79, 0xbc, 0x34, 0x4c, 0x6b, 0x4c, 0xa3,
+  0x0b, 0xdc, 0xed, 0x16, 0xb6, 0x0e, 0x8c, 0x0d, 0x16, 0x49, 0xa6, 0x00,
+  0xdb, 0xbc, 0x80, 0xd5, 0xb3, 0x57, 0x06, 0x67, 0x89, 0xfd, 0x1a, 0x21,
+  0x51, 0x3f, 0x16, 0x1d, 0xce, 0xfa, 0x56, 0xaf, 0x13, 0x58, 0xa9, 0x90,
+  0xe9, 0xa9, 0xe4, 0x1e, 0x3f, 0x2d, 0xa2, 0xbb, 0x17, 0x8b, 0x44, 0xb7,
+  0x89, 0xe7, 0xc3, 0x28, 0x55, 0xf6, 0x30, 0x11, 0xfe, 0x73, 0x80, 0x32,
+  0x6f, 0x7a, 0x3b, 0x51, 0x26, 0x0e, 0xdf, 0xd3, 0x51, 0xe3, 0x85, 0xb5,
+  0x1b, 0x4d, 0x91, 0x92, 0x17, 0x6b, 0xbc, 0x4a, 0x24, 0x98, 0xa8, 0xd3,
+  0x31, 0x82, 0x93, 0xb5, 0x09, 0xf1, 0x7b, 0x7b, 0x6d, 0x82, 0x87, 0x2e,
+  0x98, 0x11, 0x84, 0xe5, 0x4a, 0x48, 0xd6, 0xf6, 0xf5, 0x02, 0x6b, 0xfb,
+  0x51, 0x3b, 0x34, 0x67, 0x76, 0x87, 0xa3, 0x6d, 0x8b, 0x76, 0x3a, 0xa7,
+  0x53, 0xf8, 0xd7, 0x87, 0xc0, 0x5e, 0x8e, 0xd5, 0x54, 0x34, 0x8d, 0x06,
+  0x8f, 0xfe, 0x95, 0xa7, 0x9e, 0xea, 0x6d, 0x17, 0x9e, 0xd9, 0x81, 0x18,
+  0x2b, 0x82, 0x1b, 0x23, 0xda, 0xae, 0x9d, 0x39, 0x66, 0xf6, 0x78, 0x4a,
+  0xc5, 0x0c, 0xc9, 0x0c, 0xcb, 0xff, 0xba, 0x98, 0x44, 0xb2, 0x87, 0x5f,
+  0xe3, 0xc4, 0xb5, 0xba, 0x87, 0x85, 0x24, 0x40, 0xe0, 0x57, 0x6b, 0x05,
+  0xc7, 0x80, 0xf7, 0xd0, 0xe8, 0xa2, 0xdd, 0x5c, 0x11, 0x78, 0x1d, 0xca,
+  0x5d, 0x27, 0x8e, 0x55, 0x0c, 0x46, 0x05, 0xd3, 0xe2, 0xba, 0xb7, 0x18,
+  0x3b, 0xab, 0x16, 0xbb, 0x75, 0xf5, 0xbe, 0x59, 0xfe, 0xfa, 0xb7, 0x4f,
+  0xdd, 0xc4, 0x7b, 0x8a, 0xab, 0x1c, 0xb4, 0xef, 0x66, 0x09, 0x9f, 0x5f,
+  0xbe, 0x78, 0x2a, 0x31, 0xf0, 0x83, 0xc5, 0x01, 0xe5, 0x05, 0xb6, 0x9e,
+  0x4e, 0x81, 0x51, 0x68, 0x74, 0x16, 0x09, 0x50, 0x82, 0xf7, 0xad, 0xeb,
+  0xa2, 0xf0, 0x5a, 0x2d, 0x0a, 0x56, 0x2c, 0x84, 0x41, 0x71, 0x69, 0x21,
+  0xb1, 0x57, 0x6b, 0xed, 0xf4, 0x22, 0x37, 0x6e, 0xba, 0x7f, 0x5d, 0x71,
+  0x6e, 0x39, 0x19, 0x35, 0x1b, 0x4e, 0x16, 0x5f, 0x9b, 0xd3, 0xad, 0x86,
+  0x33, 0x0f, 0x3e, 0xaf, 0xf5, 0xf3, 0x14, 0xeb, 0xbf, 0x52, 0x91, 0xa4,
+  0x79, 0xdb, 0xac, 0xd8, 0xe2, 0x79, 0x53, 0xd9, 0xe4, 0x75, 0x56, 0xb0,
+  0x10, 0xed, 0x3c, 0xc8, 0x48, 0x27, 0xfe, 0xf4, 0x47, 0x57, 0x5d, 0xdf,
+  0x54, 0xca, 0xd3, 0x77, 0xe3, 0x33, 0x4c, 0xd8, 0x55, 0xb0, 0xbf, 0x5c,
+  0xe2, 0x86, 0x85, 0x7b, 0x2a, 0xed, 0xea, 0x88, 0xc7, 0x70, 0x68, 0xff,
+  0x5f, 0xd7, 0xd9, 0x7b, 0xf8, 0x83, 0x88, 0x31, 0x7f, 0x1b, 0x2e, 0x70,
+  0x5c, 0x2b, 0x79, 0xaf, 0xf9, 0x7e, 0x71, 0x53, 0x40, 0x7b, 0xf5, 0xbe,
+  0x58, 0xb7, 0x1b, 0x98, 0x62, 0xa9, 0xcd, 0xd3, 0x82, 0x6e, 0xfa, 0x75,
+  0x8a, 0x6c, 0xc8, 0xf9, 0x1c, 0xcb, 0xf4, 0xed, 0xa9, 0x98, 0xaa, 0xb6,
+  0xb7, 0xe2, 0x75, 0x01, 0xab, 0x0e, 0x92, 0xd7, 0x98, 0xb3, 0xb8, 0xb0,
+  0xda, 0x0c, 0x3e, 0xcb, 0xca, 0xb2, 0xa1, 0x9b, 0xb4, 0xc8, 0xd3, 0x86,
+  0x85, 0xd7, 0x69, 0x63, 0xa6, 0x2c, 0x6f, 0x41, 0x21, 0x01, 0x4d, 0x6a,
+  0x45, 0x01, 0xe1, 0x31, 0xbe, 0xbb, 0xba, 0x96, 0xb5, 0x18, 0xf7, 0x9d,
+  0x4e, 0x8f, 0x6a, 0x20, 0xae, 0x5e, 0x8b, 0xe5, 0x80, 0x52, 0x75, 0x55,
+  0x14, 0xd6, 0xb7, 0xc1, 0x9b, 0xaf, 0xb0, 0x37, 0xca, 0x9a, 0xb7, 0x6c,
+  0x7c, 0x00, 0x85, 0xc8, 0xc5, 0x67, 0x27, 0x2f, 0x76, 0xb9, 0x75, 0xca,
+  0x18, 0x00, 0x48, 0x4b, 0x9e, 0xab, 0x39, 0x03, 0x8a, 0xbf, 0x07, 0x35,
+  0x0e, 0xfb, 0x7a, 0xbe, 0x30, 0xef, 0x6b, 0xd8, 0x83, 0x73, 0x51, 0x7f,
+  0xf3, 0x20, 0x66, 0x29, 0x5a, 0x63, 0x6d, 0xf6, 0x00, 0xd1, 0xbe, 0x18,
+  0x91, 0xb7, 0x05, 0x29, 0xda, 0x20, 0xd8, 0xfb, 0x92, 0xeb, 0x5e, 0xca,
+  0xe2, 0xb2, 0xa2, 0xce, 0x40, 0x47, 0xa4, 0x60, 0x93, 0x61, 0x5b, 0x64,
+  0xbd, 0x7d, 0xa5, 0x73, 0xd4, 0x03, 0xdb, 0x76, 0xcb, 0xa9, 0x74, 0x9b,
+  0xc7, 0x84, 0x87, 0x1d, 0x4e, 0x5f, 0x58, 0xb7, 0xaa, 0x16, 0x94, 0x11,
+  0x35, 0x65, 0xf2, 0x9d, 0x7f, 0x7b, 0xa6, 0xd4, 0x8b, 0x87, 0x66, 0x8c,
+  0x97, 0x4a, 0xe2, 0x07, 0x75, 0xce, 0x9b, 0x5c, 0x0c, 0x02, 0x4f, 0xe1,
+  0xdb, 0x49, 0xf5, 0x52, 0x0a, 0xbd, 0xf0, 0x08, 0x73, 0x75, 0xc5, 0xc3,
+  0xd6, 0x58, 0xb5, 0xa4, 0xbf, 0x26, 0xa3, 0x94, 0x2b, 0xe1, 0x36, 0xe2,
+  0xba, 0x45, 0x9e, 0x56, 0x3c, 0x97, 0x34, 0x15, 0x58, 0xb0, 0x34, 0x2c,
+  0x28, 0x96, 0x9b, 0x3c, 0x5b, 0x47, 0x9b, 0xed, 0x9e, 0x79, 0x03, 0x7b,
+  0x86, 0x2a, 0x5b, 0x9b, 0x09, 0xbe, 0xb7, 0xfb, 0xe6, 0x2d, 0x6c, 0xc9,
+  0x8a, 0x3d, 0xc8, 0x2d, 0x9a, 0xc1, 0xcb, 0x6b, 0xcc, 0xfa, 0x21, 0xba,
+  0xac, 0x15, 0x67, 0x0b, 0x56, 0x87, 0x22, 0xf1, 0x66, 0x35, 0xdd, 0x46,
+  0x96, 0x1d, 0xd5, 0x84, 0x33, 0x4f, 0xaf, 0xf5, 0xd5, 0x5a, 0x34, 0xcb,
+  0x8d, 0x68, 0xbe, 0x08, 0x12, 0xc8, 0xe0, 0x56, 0xcb, 0xb9, 0x2b, 0x84,
+  0x56, 0xe9, 0x25, 0xab, 0xa1, 0xa7, 0xf4, 0xe2, 0x6f, 0x5f, 0xe9, 0x95,
+  0x0b, 0x9b, 0xbd, 0x4a, 0xaf, 0x4a, 0xc8, 0xef, 0x55, 0xf7, 0x3d, 0xb1,
+  0x57, 0x13, 0x6c, 0x77, 0xb9, 0x6b, 0xc8, 0x38, 0x43, 0x7e, 0xc1, 0x5f,
+  0xae, 0x78, 0x99, 0x6c, 0xd0, 0x2a, 0x74, 0x46, 0xd3, 0x8e, 0x66, 0x1b,
+  0x0f, 0x34, 0x72, 0x0b, 0x10, 0x5c, 0x99, 0x5b, 0xc0, 0x73, 0x68, 0x50,
+  0xf1, 0x94, 0x89, 0xe5, 0xe1, 0xe2, 0x19, 0x53, 0x6c, 0xdd, 0x15, 0xd1,
+  0x23, 0x15, 0xee, 0x13, 0x2f, 0xb6, 0x1d, 0x16, 0xe7, 0x36, 0x87, 0x61,
+  0xfd, 0xa8, 0x17, 0x1c, 0x83, 0x3d, 0xf1, 0x74, 0x15, 0xa7, 0x23, 0xd9,
+  0xa9, 0xc2, 0x3a, 0xdf, 0x98, 0x52, 0x26, 0xb7, 0xa6, 0x7d, 0xbd, 0x87,
+  0xbd, 0xa8, 0x82, 0xaa, 0xa9, 0x41, 0x4a, 0xe6, 0x7c, 0xca, 0x3a, 0x1b,
+  0x33, 0xb3, 0xc0, 0xc9, 0xa9, 0x81, 0x96, 0x0a, 0xdd, 0x8f, 0x1d, 0xae,
+  0x58, 0x44, 0x5b, 0xbb, 0xdc, 0x54, 0x66, 0xd3, 0xfa, 0x0a, 0xba, 0x77,
+  0xa0, 0x80, 0x1b, 0xa6, 0x33, 0x37, 0x15, 0x2c, 0xfc, 0x3c, 0x5e, 0xc6,
+  0xec, 0x17, 0x6e, 0x81, 0x34, 0xc0, 0x39, 0xb4, 0xf3, 0xc5, 0x82, 0xd7,
+  0xf0, 0xd5, 0xdf, 0x9e, 0xbe, 0x79, 0xc8, 0xce, 0x6f, 0xf1, 0x12, 0x2f,
+  0xbc, 0x7f, 0xa3, 0xf7, 0x0d, 0x4c, 0x54, 0x5f, 0x1f, 0xef, 0xa0, 0x4a,
+  0x40, 0xfc, 0xd3, 0x60, 0x06, 0xde, 0x98, 0x7f, 0x40, 0x6e, 0xfc, 0x92,
+  0xc6, 0xc2, 0xb1, 0xba, 0x6f, 0xc9, 0x21, 0x63, 0xbf, 0x1a, 0x93, 0x96,
+  0xfc, 0xae, 0x61, 0xeb, 0x4c, 0xf3, 0xd4, 0xb1, 0x09, 0x88, 0x20, 0xf4,
+  0x6f, 0xd1, 0x7b, 0x05, 0x1e, 0x8f, 0x3c, 0x82, 0xdd, 0xbe, 0xc3, 0x1e,
+  0xef, 0x44, 0xe2, 0x2a, 0xf6, 0xef, 0xf3, 0x7c, 0xd9, 0xd3, 0xbb, 0x01,
+  0x73, 0xe4, 0xe3, 0xe1, 0x40, 0x7c, 0xbe, 0x93, 0x3e, 0xf7, 0xb1, 0xf0,
+  0xe1, 0x61, 0x4b, 0xe2, 0x04, 0xc6, 0x42, 0x8a, 0x9c, 0xea, 0x9d, 0x3d,
+  0xdf, 0xe3, 0xe4, 0x91, 0xab, 0xd4, 0x9d, 0x09, 0xed, 0xa9, 0xe3, 0x5e,
+  0x47, 0x87, 0xdb, 0x0d, 0x7f, 0x3b, 0xa1, 0x87, 0x2b, 0xc0, 0x88, 0x7c,
+  0xa4, 0x02, 0x0f, 0xee, 0x20, 0xc5, 0x16, 0x71, 0x7a, 0xab, 0xff, 0xd6,
+  0x1a, 0x8d, 0x4c, 0x82, 0x0a, 0x9d, 0xaf, 0xbe, 0x78, 0x89, 0xf6, 0x78,
+  0xcf, 0xc8, 0x3c, 0xc3, 0xad, 0xbe, 0xc2, 0x93, 0xa1, 0x75, 0x51, 0x9b,
+  0x78, 0x18, 0xdc, 0xc4, 0xfa, 0x2f, 0xa8, 0x2c, 0x18, 0xc6, 0x4e, 0x4d,
+  0x5a, 0xd1, 0x8d, 0x24, 0x20, 0x02, 0x29, 0xc4, 0x53, 0xc4, 0xcc, 0x7d,
+  0xc9, 0x91, 0x10, 0x53, 0xfc, 0xc1, 0x17, 0x55, 0x27, 0xaa, 0x3b, 0x76,
+  0xc4, 0x95, 0x9d, 0x52, 0x7d, 0x22, 0xeb, 0x2c, 0x31, 0x60, 0xc1, 0x1e,
+  0xf1, 0xc4, 0x2e, 0x3b, 0xc7, 0xee, 0x12, 0xfb, 0x6b, 0xd5, 0x8d, 0x9f,
+  0x27, 0xff, 0xd2, 0x23, 0xd2, 0x87, 0x00, 0xbb, 0xd4, 0x2f, 0x9d, 0xe8,
+  0xe2, 0xbe, 0xa2, 0x91, 0xcc, 0xf5, 0xe7, 0x96, 0x88, 0xb0, 0x1e, 0xb1,
+  0xeb, 0xbb, 0x11, 0xe8, 0xcc, 0xb0, 0xc3, 0xc7, 0x3d, 0x33, 0x24, 0xef,
+  0x64, 0x2c, 0x41, 0xc6, 0x7e, 0x91, 0x63, 0x22, 0x24, 0x51, 0x6a, 0xad,
+  0x3e, 0x0b, 0x6b, 0x71, 0x90, 0x35, 0x89, 0x94, 0xf2, 0x55, 0xb6, 0x73,
+  0xe5, 0xd0, 0x00, 0x8f, 0x57, 0x5e, 0x6b, 0x68, 0x8c, 0x96, 0x02, 0xed,
+  0x13, 0x13, 0xe5, 0xe6, 0xec, 0xe6, 0x91, 0xc1, 0xa7, 0x32, 0x2f, 0xcf,
+  0x95, 0x53, 0x23, 0x8d, 0x77, 0xde, 0xa3, 0x23, 0x7f, 0x74, 0xea, 0xb8,
+  0x6e, 0xe1, 0x2d, 0x96, 0xd8, 0x24, 0x2d, 0x1c, 0x2e, 0xde, 0x34, 0x2b,
+  0xac, 0xdc, 0xd6, 0x43, 0x76, 0xfb, 0xc2, 0x29, 0x99, 0x5e, 0x31, 0x0d,
+  0x40, 0x41, 0x2b, 0x83, 0x0b, 0x9f, 0xe2, 0x84, 0xbd, 0x4f, 0x43, 0xb0,
+  0x0e, 0xf0, 0xba, 0x24, 0x1b, 0x07, 0x3c, 0x8d, 0xf0, 0x8f, 0x22, 0x50,
+  0x69, 0x6a, 0xaa, 0xad, 0x1e, 0x46, 0x60, 0x3e, 0x1f, 0x5a, 0xb5, 0x6e,
+  0xaa, 0x3a, 0x44, 0x41, 0xa7, 0x9f, 0xb0, 0x07, 0xc9, 0xb1, 0x57, 0x11,
+  0xa2, 0xe4, 0x71, 0x20, 0x82, 0x70, 0x24, 0xa2, 0x11, 0x38, 0xf7, 0x57,
+  0x22, 0x51, 0x7c, 0x19, 0x38, 0x52, 0x86, 0xa4, 0xb5, 0xb6, 0xf9, 0x6e,
+  0x4e, 0xeb, 0x9c, 0x95, 0x1d, 0x86, 0x00, 0x86, 0x8d, 0x0b, 0xcd, 0x16,
+  0x84, 0x38, 0x36, 0x5d, 0xe8, 0x59, 0x89, 0x2b, 0xc8, 0xe7, 0x1f, 0x3d,
+  0xd6, 0x88, 0x2b, 0x4f, 0x87, 0x8f, 0x4d, 0x12, 0xac, 0xdf, 0xb3, 0xf6,
+  0x7d, 0x0a, 0x6a, 0x7c, 0xfd, 0x62, 0x9d, 0xc0, 0xe4, 0x0c, 0x22, 0xdf,
+  0x3b, 0xae, 0x17, 0xeb, 0xef, 0x13, 0xdb, 0xcb, 0xa3, 0xb1, 0xbd, 0x4c,
+  0x61, 0x0b, 0x7a, 0xec, 0x5b, 0xe2, 0x72, 0x87, 0xe4, 0xd8, 0x34, 0x6f,
+  0x4b, 0xe7, 0x6f, 0x3a, 0xc7, 0x2c, 0xc4, 0xdf, 0x83, 0x75, 0x78, 0xc8,
+  0x32, 0x1c, 0x99, 0xe7, 0xc7, 0xcd, 0xbd, 0x03, 0xa6, 0x5e, 0x5f, 0x02,
+  0x7c, 0x6b, 0x6b, 0x6f, 0xac, 0xdf, 0x39, 0x83, 0xef, 0x77, 0x30, 0xf6,
+  0x3e, 0x9a, 0xae, 0xc8, 0x86, 0xeb, 0xdd, 0x2b, 0x8a, 0x8d, 0xb8, 0x3f,
+  0x46, 0xea, 0x78, 0x0b, 0x7a, 0xac, 0x85, 0x76, 0xcc, 0x3a, 0x3b, 0xb8,
+  0xd8, 0x3e, 0xca, 0x18, 0xfb, 0x48, 0x43, 0xec, 0xa3, 0x8c, 0xb0, 0xd2,
+  0x25, 0x7c, 0x16, 0xc8, 0x01, 0xad, 0x82, 0x78, 0x5d, 0x67, 0xdd, 0x13,
+  0x52, 0x5b, 0xdc, 0x4c, 0x60, 0xc7, 0x61, 0x0f, 0x6a, 0x3d, 0xbb, 0xab,
+  0x9b, 0x32, 0x2f, 0xff, 0x36, 0x65, 0xfe, 0x7f, 0x98, 0x32, 0xba, 0xa0,
+  0x3d, 0x6a, 0xe6, 0xbc, 0xfc, 0xdb, 0xcc, 0xf9, 0x1e, 0x67, 0x4e, 0x30,
+  0x75, 0x74, 0x21, 0xed, 0x4c, 0x1d, 0x3b, 0x00, 0x0c, 0xe3, 0xc7, 0x44,
+  0xd1, 0x9b, 0xd1, 0xb4, 0xb0, 0xba, 0xad, 0x5d, 0x07, 0x6f, 0x72, 0x4a,
+  0x1e, 0x85, 0xf7, 0x65, 0x02, 0x2f, 0x79, 0xa3, 0x88, 0x9b, 0xf1, 0xd5,
+  0x6d, 0x9d, 0xed, 0x37, 0xc5, 0xaa, 0x41, 0x9b, 0x9b, 0xab, 0x57, 0x67,
+  0xeb, 0xe1, 0x9a, 0x11, 0x96, 0x4d, 0xeb, 0xac, 0xf5, 0x91, 0xa1, 0x8c,
+  0x66, 0xad, 0xb5, 0x95, 0x95, 0xa8, 0xf4, 0x96, 0x14, 0x8b, 0x83, 0x67,
+  0xa9, 0x37, 0x09, 0x4a, 0xba, 0x10, 0x8d, 0xb7, 0xc8, 0xc8, 0x69, 0xb9,
+  0x5c, 0xf0, 0xa4, 0x3f, 0x51, 0x5b, 0x5a, 0x99, 0x6c, 0x7c, 0xa2, 0xe9,
+  0xdf, 0xc6, 0xe4, 0xe9, 0x99, 0x0a, 0x68, 0xab, 0x71, 0x45, 0xfa, 0x86,
+  0x5c, 0x4a, 0xf2, 0x4f, 0x48, 0xac, 0xa6, 0x18, 0x77, 0x82, 0x0b, 0x03,
+  0x13, 0x04, 0x69, 0x13, 0xe8, 0x95, 0x8b, 0x73, 0xa6, 0x67, 0xf3, 0x8f,
+  0x30, 0x38, 0x90, 0x18, 0x39, 0xc6, 0xde, 0x60, 0x02, 0x11, 0x09, 0x1d,
+  0x1e, 0x37, 0x28, 0x69, 0x01, 0x91, 0x82, 0x1d, 0x23, 0x2b, 0xbc, 0xac,
+  0xf3, 0x26, 0x11, 0x23, 0xb0, 0xb3, 0xb5, 0xf5, 0xf6, 0xb4, 0x78, 0x3b,
+  0xd1, 0x1b, 0x7f, 0x9e, 0x87, 0x56, 0xa4, 0x74, 0x4f, 0x49, 0x8e, 0xdf,
+  0xcf, 0x3e, 0xf2, 0xbc, 0xf3, 0x5b, 0x6e, 0x61, 0x13, 0x25, 0x47, 0xf7,
+  0xae, 0x89, 0x32, 0xbd, 0x9b, 0x56, 0x75, 0xbc, 0x24, 0x5b, 0xc4, 0xc8,
+  0x91, 0x16, 0xa3, 0xfe, 0x56, 0x47, 0x5a, 0xee, 0xfc, 0xf6, 0x5b, 0x9c,
+  0x6c, 0x31, 0x71, 0x6d, 0x6f, 0xfd, 0x83, 0x27, 0x5b, 0x81, 0x9b, 0x57,
+  0x47, 0x92, 0x74, 0x4e, 0x60, 0x1e, 0x23, 0x6e, 0x13, 0xb6, 0xab, 0x93,
+  0xc7, 0xd9, 0xad, 0x4e, 0xbc, 0xf3, 0x47, 0x96, 0xd9, 0xd6, 0xf9, 0xf7,
+  0x4c, 0x0d, 0xf4, 0x6e, 0xbe, 0xe8, 0xd8, 0xfa, 0x0b, 0x2c, 0xdb, 0x69,
+  0x31, 0x65, 0x94, 0x6e, 0x68, 0x9b, 0xea, 0x50, 0x53, 0x66, 0x77, 0xb2,
+  0x26, 0xb9, 0xf7, 0xc8, 0x26, 0xee, 0xed, 0xa8, 0x49, 0x6b, 0xdc, 0x0a,
+  0x95, 0x22, 0x84, 0x0c, 0xc6, 0x7f, 0x7d, 0x4a, 0xec, 0x59, 0xb2, 0x09,
+  0x95, 0x12, 0x14, 0x0f, 0xec, 0x5f, 0xc2, 0xf6, 0x59, 0xfc, 0xfd, 0x6d,
+  0x87, 0xd6, 0x78, 0x6c, 0x14, 0x8d, 0x2f, 0x0f, 0x6e, 0xc2, 0x22, 0xd9,
+  0x19, 0x5e, 0xc7, 0x8e, 0x35, 0x19, 0xef, 0xe2, 0xfd, 0x24, 0xce, 0xba,
+  0x2b, 0xab, 0xa0, 0x7d, 0xc7, 0x25, 0x04, 0xa6, 0x5b, 0x77, 0xe9, 0xdc,
+  0xf9, 0x69, 0xaa, 0x85, 0xdb, 0x93, 0x27, 0x4a, 0x91, 0x9f, 0x49, 0xb4,
+  0x66, 0x60, 0x71, 0xa0, 0x84, 0xa2, 0xfc, 0x04, 0xab, 0x20, 0x05, 0x0a,
+  0x59, 0x15, 0x20, 0x13, 0xd1, 0xb8, 0xf2, 0x37, 0xe5, 0xfc, 0xbf, 0x8f,
+  0x72, 0x6e, 0x97, 0xd9, 0x70, 0x88, 0xe3, 0xd8, 0x3a, 0x56, 0x61, 0x3f,
+  0x39, 0x56, 0x61, 0x8f, 0x01, 0x1f, 0xa7, 0xb0, 0x27, 0xe6, 0xe5, 0xa8,
+  0x61, 0xf9, 0x71, 0x7a, 0x7b, 0x1f, 0xf8, 0x5f, 0x5f, 0x6f, 0xc7, 0xb4,
+  0xf5, 0x20, 0x54, 0xbf, 0xe3, 0xdc, 0xe2, 0x91, 0xe0, 0x79, 0xd4, 0x98,
+  0xe0, 0xd7, 0xdf, 0x26, 0xdf, 0xff, 0xb3, 0xc6, 0xa4, 0x60, 0xec, 0x83,
+  0x8d, 0xb1, 0x51, 0xdd, 0xea, 0xaf, 0x3a, 0x89, 0xd2, 0xd5, 0x0e, 0x7b,
+  0x1c, 0xf6, 0x52, 0x39, 0xe4, 0xf4, 0xd7, 0x5b, 0x28, 0x3d, 0xff, 0xfe,
+  0xeb, 0x4c, 0x4e, 0x78, 0x84, 0x7d, 0x45, 0x16, 0x75, 0xe6, 0x6f, 0x99,
+  0x75, 0x8f, 0xad, 0x48, 0x2a, 0xf1, 0x75, 0x37, 0xb5, 0xc6, 0xdb, 0x7b,
+  0x96, 0x92, 0x16, 0xe0, 0x27, 0x59, 0xdd, 0x56, 0x3b, 0xf3, 0x6f, 0x45,
+  0x09, 0xed, 0x3f, 0x6d, 0x30, 0x52, 0xe6, 0xfe, 0xd0, 0x5a, 0xc7, 0x2b,
+  0x76, 0x8d, 0x0a, 0x45, 0x04, 0x54, 0x88, 0x20, 0x73, 0x60, 0x74, 0xef,
+  0xb2, 0x44, 0x7b, 0x67, 0x30, 0x12, 0xb3, 0x86, 0x88, 0x8e, 0x26, 0xdf,
+  0xde, 0x04, 0xb1, 0xfa, 0x6e, 0x4c, 0x4e, 0x08, 0x8b, 0x5d, 0xbe, 0x64,
+  0x0f, 0x21, 0xe3, 0x7a, 0x56, 0x6f, 0x14, 0x4f, 0x79, 0x46, 0x88, 0x8f,
+  0xad, 0x4c, 0x51, 0xd4, 0x1a, 0xf0, 0x78, 0xb9, 0x51, 0xff, 0x4b, 0x5b,
+  0x41, 0x0c, 0xc7, 0xe3, 0x69, 0xc1, 0xc8, 0x69, 0x30, 0x09, 0x23, 0x7d,
+  0x18, 0x5c, 0x80, 0x9e, 0x36, 0x18, 0xf2, 0x36, 0x63, 0x04, 0x8e, 0x32,
+  0x6e, 0x92, 0xbd, 0xc7, 0x83, 0x31, 0xad, 0xc5, 0x27, 0xd1, 0x5d, 0x1a,
+  0xba, 0xde, 0x2f, 0x22, 0xb1, 0x81, 0xfd, 0x72, 0xf1, 0x0f, 0xcf, 0x55,
+  0x6f, 0x8a, 0x90, 0xd4, 0x09, 0x24, 0x75, 0x17, 0x49, 0x1d, 0x22, 0xf1,
+  0xe3, 0xde, 0xb6, 0x1a, 0x1a, 0x14, 0x65, 0x89, 0x76, 0x07, 0x5d, 0x5b,
+  0x7e, 0x6e, 0xfc, 0xbb, 0x0c, 0x73, 0x18, 0x36, 0xba, 0x81, 0x9a, 0xbb,
+  0xaf, 0x12, 0x47, 0x40, 0x73, 0x1b, 0x79, 0xff, 0xe9, 0xfd, 0x39, 0x1b,
+  0x25, 0xeb, 0x16, 0xb6, 0x40, 0xf7, 0x5e, 0x78, 0xba, 0x00, 0x18, 0xc1,
+  0xae, 0xab, 0xf5, 0x7d, 0xea, 0x23, 0x30, 0xae, 0x0d, 0x84, 0x95, 0xfa,
+  0xec, 0x55, 0x89, 0x61, 0x4b, 0x07, 0x41, 0x2c, 0x59, 0xcb, 0x3b, 0x3f,
+  0xfc, 0xdb, 0x59, 0xe3, 0xdf, 0xd1, 0x1d, 0x28, 0xed, 0x77, 0x11, 0xe0,
+  0x18, 0x2f, 0x81, 0xff, 0x01, 0xa0, 0xa8, 0x30, 0xf6, 0x1a, 0x3b, 0xf5,
+  0xda, 0xa5, 0x73, 0x50, 0x7c, 0xc0, 0x6c, 0x12, 0x6b, 0x3a, 0xd6, 0xab,
+  0xc9, 0xe7, 0xd0, 0x64, 0x86, 0xeb, 0x39, 0x7f, 0x98, 0x4d, 0xec, 0x59,
+  0xbc, 0xe5, 0xab, 0xd3, 0x33, 0x37, 0x40, 0x8b, 0x51, 0xca, 0xeb, 0x04,
+  0x44, 0x8f, 0x83, 0x9d, 0x8e, 0x17, 0x06, 0xe9, 0xa8, 0x72, 0xd8, 0x1d,
+  0x41, 0xef, 0xab, 0x97, 0x85, 0xa4, 0xb5, 0x3d, 0xd3, 0xc1, 0x82, 0xd1,
+  0xd7, 0x72, 0xbd, 0xf8, 0x71, 0x43, 0x90, 0xdb, 0xa8, 0x13, 0x16, 0xbb,
+  0x9d, 0x57, 0x18, 0x0a, 0x13, 0x03, 0xff, 0x69, 0x90, 0x5c, 0x61, 0x45,
+  0xc7, 0x6a, 0xa7, 0x61, 0x10, 0x5d, 0x45, 0xe5, 0xee, 0x64, 0x62, 0x7c,
+  0x08, 0x7b, 0x75, 0x9f, 0x12, 0x1b, 0x3c, 0xf1, 0xba, 0x9a, 0xf7, 0x5d,
+  0x93, 0x5f, 0x6c, 0x11, 0x5d, 0x5e, 0x9b, 0x17, 0xfe, 0x5d, 0xb8, 0xb6,
+  0x32, 0x7f, 0x54, 0x81, 0x74, 0x4a, 0x06, 0xb7, 0x4e, 0x0c, 0xe3, 0x73,
+  0xb9, 0xf0, 0xce, 0xa6, 0x87, 0x6e, 0x2d, 0xde, 0x9c, 0x10, 0xe3, 0x9e,
+  0x0d, 0x0c, 0x40, 0x83, 0xa3, 0x21, 0xcc, 0xf0, 0xf1, 0xd4, 0x06, 0xf7,
+  0x65, 0x94, 0x6d, 0x80, 0x82, 0x29, 0x1d, 0xc7, 0xa3, 0xa1, 0xbb, 0x22,
+  0x8c, 0x71, 0x87, 0x72, 0x42, 0xb9, 0xbe, 0xee, 0x94, 0x74, 0x73, 0x41,
+  0x67, 0x3a, 0xa0, 0xc6, 0x43, 0x1c, 0x7f, 0x43, 0x69, 0xe4, 0xc5, 0xe4,
+  0x8f, 0x3f, 0xd7, 0xee, 0xb3, 0x8b, 0xb2, 0x6f, 0x89, 0xa2, 0x24, 0x7d,
+  0x7d, 0x34, 0x71, 0x06, 0xbf, 0x1e, 0x92, 0xfe, 0xeb, 0x68, 0xda, 0x57,
+  0x4d, 0x3b, 0xd4, 0x53, 0xfc, 0xf9, 0xfb, 0xa0, 0x8b, 0x2b, 0x6e, 0x9d,
+  0x14, 0xb0, 0x5c, 0xa9, 0x1c, 0xd9, 0x84, 0x2c, 0x79, 0x2e, 0x69, 0x7d,
+  0x5e, 0xf9, 0xff, 0xf1, 0x02, 0xfc, 0xe9, 0xa1, 0xad, 0x96, 0xb8, 0xab,
+  0xc6, 0xcb, 0xbd, 0x36, 0x68, 0xe4, 0x2b, 0x8d, 0x80, 0xe3, 0xc7, 0x7e,
+  0x29, 0xaf, 0x6f, 0x60, 0xc5, 0x3b, 0x45, 0x07, 0x7c, 0x2c, 0x00, 0xab,
+  0x3b, 0xbd, 0x99, 0x74, 0x82, 0xc4, 0x94, 0xab, 0x6d, 0x00, 0x46, 0x78,
+  0x11, 0x2e, 0x45, 0xc0, 0x6f, 0xdb, 0xac, 0x05, 0x16, 0xc5, 0x1d, 0x7b,
+  0xa2, 0x7e, 0x6b, 0x18, 0x47, 0x73, 0xc1, 0xaa, 0xda, 0xee, 0xe9, 0x62,
+  0xb2, 0xb3, 0x8a, 0x6f, 0xb3, 0x15, 0x68, 0x6b, 0x2b, 0x4a, 0xb3, 0xb9,
+  0x6c, 0x2c, 0xaa, 0xe5, 0xfb, 0x1a, 0x45, 0x7d, 0xcd, 0x59, 0x98, 0xde,
+  0xdf, 0x59, 0xd7, 0xe6, 0x3f, 0x8a, 0xfe, 0x70, 0x46, 0xef, 0xba, 0x3b,
+  0x0b, 0xe3, 0x19, 0x14, 0x82, 0x2a, 0x29, 0xeb, 0x0c, 0x59, 0x65, 0x29,
+  0x65, 0xce, 0x0a, 0x96, 0x67, 0xbc, 0xcc, 0xb0, 0xcf, 0x57, 0x98, 0x2c,
+  0x3d, 0x04, 0xa6, 0x01, 0x4a, 0x98, 0x6d, 0xcf, 0xa8, 0xca, 0x84, 0x09,
+  0xc2, 0x66, 0xe2, 0xf0, 0xf6, 0x9e, 0xf6, 0xec, 0xa2, 0xce, 0xdd, 0x39,
+  0x41, 0x7f, 0x43, 0xa7, 0x1b, 0x78, 0x51, 0xdd, 0xd6, 0xd9, 0x16, 0x75,
+  0x23, 0xfb, 0x63, 0x31, 0x52, 0xaa, 0x81, 0x45, 0x00, 0x13, 0x94, 0x96,
+  0x7c, 0xf5, 0xda, 0xfb, 0x39, 0x56, 0xf2, 0x3a, 0xab, 0x1b, 0x2d, 0xa6,
+  0xcf, 0x63, 0x65, 0xf6, 0x45, 0xbe, 0xda, 0x80, 0xa6, 0x47, 0xaa, 0xb7,
+  0x3c, 0x8f, 0xd6, 0x53, 0xdd, 0xd9, 0x6a, 0xf8, 0x31, 0x8c, 0xd1, 0xc7,
+  0xd9, 0xb0, 0x5c, 0xf3, 0x51, 0xfc, 0xf9, 0xcd, 0xa2, 0xdf, 0x4a, 0x20,
+  0xfd, 0xd0, 0x9a, 0xf9, 0x8b, 0xe0, 0xec, 0xc4, 0xa0, 0x22, 0xbc, 0x1e,
+  0x13, 0xaf, 0x73, 0x0e, 0x84, 0x53, 0xbc, 0x73, 0xb7, 0x4d, 0x42, 0x12,
+  0xb6, 0x39, 0xf9, 0x20, 0x19, 0x78, 0x58, 0x17, 0xf2, 0x08, 0xcc, 0xcb,
+  0x04, 0xb5, 0x6b, 0xfa, 0x8b, 0x99, 0xd0, 0xaf, 0x2c, 0xa0, 0xfd, 0xd5,
+  0x5c, 0x69, 0xce, 0xaa, 0x55, 0xee, 0xbe, 0xec, 0x70, 0x77, 0x51, 0x16,
+  0xed, 0x3d, 0xa3, 0x40, 0x6b, 0x04, 0xc6, 0xd3, 0xd9, 0xe5, 0x59, 0x7d,
+  0x55, 0xe7, 0xb7, 0x12, 0x84, 0x86, 0x3f, 0x1e, 0xae, 0x9b, 0x0c, 0xbf,
+  0x8f, 0x37, 0x84, 0x82, 0x2d, 0x6b, 0x13, 0x82, 0x69, 0xdb, 0x7c, 0x73,
+  0x00, 0xae, 0x6e, 0xae, 0xa0, 0x6e, 0x72, 0xe7, 0x88, 0x26, 0xbb, 0x7c,
+  0x9e, 0x74, 0x4b, 0xb6, 0xd5, 0x15, 0x46, 0xe5, 0xba, 0x6a, 0xaa, 0xf2,
+  0x5d, 0x1e, 0x14, 0x0a, 0xbe, 0x74, 0x24, 0xc0, 0x11, 0xff, 0x79, 0x7b,
+  0x85, 0xdf, 0xe4, 0xac, 0xaa, 0x1b, 0x32, 0x02, 0x36, 0x15, 0x3b, 0x7e,
+  0x15, 0xe8, 0xda, 0x55, 0x90, 0xc8, 0xf3, 0x2e, 0x57, 0x84, 0xf1, 0x6f,
+  0x0d, 0xec, 0x04, 0xd7, 0x7c, 0x61, 0x82, 0x6e, 0x0f, 0x61, 0x47, 0x79,
+  0xdb, 0x8a, 0x6f, 0x41, 0x93, 0x5e, 0xdb, 0x66, 0xad, 0x07, 0x44, 0x28,
+  0xc5, 0xb0, 0x51, 0xf3, 0xc4, 0xc8, 0x5d, 0xe8, 0x6c, 0x72, 0x74, 0x78,
+  0x7b, 0x7f, 0x37, 0xe0, 0xed, 0x01, 0xa4, 0x7a, 0x6a, 0xf8, 0xd5, 0x61,
+  0x07, 0x7d, 0x30, 0xc7, 0x7f, 0x13, 0x11, 0x46, 0x5e, 0xe3, 0x7b, 0x8a,
+  0xdd, 0x42, 0x0f, 0x13, 0x8b, 0x5f, 0x68, 0xa6, 0x62, 0xe1, 0x01, 0x1f,
+  0x63, 0xb5, 0x9a, 0x5c, 0xe7, 0x5e, 0x88, 0x53, 0xc5, 0xa3, 0xe6, 0xd3,
+  0xcd, 0x27, 0xba, 0x77, 0xc1, 0x2b, 0x54, 0x5f, 0xd0, 0x78, 0x76, 0xcc,
+  0x8d, 0xe3, 0x79, 0x1e, 0xf4, 0xfc, 0x43, 0x63, 0x83, 0xe1, 0x4e, 0xe9,
+  0xb0, 0xe8, 0x10, 0x6c, 0x2d, 0x5b, 0xf6, 0xb2, 0xd5, 0x01, 0xaf, 0x5a,
+  0x51, 0xd0, 0x33, 0xf5, 0x70, 0x16, 0xed, 0x76, 0xf2, 0xbb, 0xb8, 0xbd,
+  0x4f, 0x62, 0x23, 0x00, 0x57, 0xc3, 0x46, 0x8e, 0xc3, 0x62, 0x61, 0x9f,
+  0xe8, 0x41, 0x5e, 0x02, 0x1f, 0xff, 0x41, 0x53, 0x39, 0xe1, 0xb2, 0xdb,
+  0x69, 0xb6, 0x80, 0x31, 0x08, 0xd9, 0x8f, 0xb9, 0x17, 0x52, 0x41, 0x25,
+  0x26, 0xaf, 0xb5, 0x67, 0x39, 0x96, 0xad, 0xfe, 0x78, 0x8d, 0x46, 0xff,
+  0x12, 0x66, 0x1d, 0xbc, 0x9e, 0x3f, 0xfc, 0x27, 0x66, 0x0d, 0x7e, 0xc8,
+  0x30, 0x7d, 0xf3, 0xc3, 0xd7, 0x67, 0xe6, 0xe1, 0x2f, 0x8b, 0xd7, 0xcf,
+  0x2c, 0xc0, 0xc4, 0x05, 0x03, 0xb6, 0x0f, 0xba, 0x84, 0xc8, 0xaa, 0xbe,
+  0x5e, 0xd3, 0x74, 0x78, 0x87, 0x81, 0x3a, 0xd0, 0xda, 0x80, 0x86, 0x6d,
+  0xf1, 0xda, 0x7b, 0x8f, 0xaa, 0xa9, 0x91, 0x2d, 0x8e, 0xbb, 0x12, 0x94,
+  0xad, 0xd7, 0x4b, 0x05, 0x97, 0xe1, 0x7d, 0x97, 0x95, 0x21, 0x47, 0xa1,
+  0xe7, 0xbc, 0xc2, 0x10, 0xf5, 0xee, 0xc7, 0xac, 0xc3, 0x59, 0x58, 0x7a,
+  0xb1, 0x70, 0xf4, 0xe0, 0x06, 0x69, 0x75, 0xa8, 0x31, 0x2f, 0x1f, 0x2c,
+  0x70, 0x3c, 0x95, 0xd7, 0x96, 0xc2, 0xe6, 0x08, 0xf2, 0x00, 0xc3, 0xd2,
+  0xc1, 0xcf, 0xbb, 0xb4, 0x51, 0xd9, 0x2b, 0x0b, 0x72, 0x05, 0x85, 0x90,
+  0x32, 0xbd, 0x5e, 0xa3, 0x76, 0xfe, 0x74, 0x6b, 0x29, 0xd8, 0x98, 0x86,
+  0x58, 0xef, 0xa0, 0x7e, 0xd6, 0x87, 0xbb, 0x3b, 0x1f, 0x09, 0x47, 0xa2,
+  0xf7, 0x78, 0xf4, 0xe9, 0xab, 0x74, 0x1e, 0x3e, 0xf5, 0xf5, 0x9b, 0x37,
+  0x21, 0xa1, 0x2a, 0x3b, 0x1d, 0xaf, 0x94, 0x0b, 0x54, 0x77, 0x61, 0xe5,
+  0x2a, 0x98, 0xa0, 0x89, 0x79, 0x17, 0x73, 0x22, 0xf5, 0x16, 0xdb, 0x1b,
+  0xa8, 0xf2, 0xe6, 0x0d, 0x85, 0x7c, 0xfe, 0x7a, 0xfa, 0xf0, 0x17, 0x68,
+  0x6a, 0xf0, 0x61, 0xe2, 0xf5, 0x5c, 0x2c, 0x1b, 0xa4, 0x72, 0x8b, 0x3d,
+  0xa1, 0xdb, 0x28, 0x08, 0x5b, 0x78, 0x29, 0xbc, 0x52, 0x78, 0x9d, 0x6e,
+  0x9d, 0xf3, 0x51, 0x34, 0x0c, 0x29, 0xb2, 0x88, 0x54, 0x9b, 0x90, 0xd6,
+  0x3e, 0x3f, 0x7c, 0x49, 0x74, 0x78, 0xdf, 0x73, 0x2d, 0x27, 0x6c, 0x31,
+  0x98, 0xd3, 0xa2, 0xb7, 0x13, 0x84, 0x55, 0x80, 0xca, 0x9f, 0x29, 0x8d,
+  0x1c, 0x02, 0x0e, 0x4d, 0xa3, 0xf5, 0x81, 0x43, 0x76, 0x04, 0x08, 0x6c,
+  0xb7, 0x49, 0x6c, 0x06, 0xeb, 0x8f, 0xd0, 0xdb, 0x67, 0x9c, 0x0f, 0x63,
+  0x2a, 0x70, 0x53, 0xbb, 0x52, 0xe1, 0xe9, 0x1f, 0x28, 0xb3, 0x36, 0x03,
+  0x9e, 0xcf, 0xb1, 0x01, 0x63, 0x85, 0xe5, 0xe5, 0xb6, 0xe7, 0x94, 0xa8,
+  0x73, 0x7b, 0x78, 0xf4, 0x04, 0x5e, 0xe7, 0x19, 0xdf, 0x91, 0xfa, 0x4d,
+  0x75, 0x0d, 0xcb, 0x8c, 0xf9, 0x69, 0xb5, 0x2e, 0xf2, 0xfa, 0x52, 0xbf,
+  0xff, 0x6f, 0x3b, 0x95, 0x74, 0x32, 0xf2, 0x5d, 0x48, 0xf8, 0x65, 0xd6,
+  0x15, 0xa6, 0x2d, 0xc3, 0x3a, 0xa0, 0xfe, 0x62, 0x67, 0xab, 0x01, 0x95,
+  0x04, 0xbe, 0xe1, 0x44, 0xbd, 0xa7, 0xd7, 0xdb, 0x7b, 0xb1, 0xa7, 0x2b,
+  0x52, 0x74, 0x2a, 0xa6, 0xaf, 0xae, 0xec, 0x53, 0x3b, 0xd1, 0x34, 0xa6,
+  0x1d, 0x23, 0x7b, 0x6a, 0xa7, 0xe5, 0x26, 0x6b, 0x36, 0x6e, 0x21, 0x78,
+  0x0b, 0xa5, 0x69, 0xf2, 0x38, 0x87, 0x67, 0xd5, 0xb7, 0x8b, 0x5b, 0x20,
+  0x20, 0xe7, 0x29, 0x12, 0xc7, 0xc2, 0xc0, 0x1c, 0x23, 0xf1, 0x85, 0x16,
+  0x5c, 0x6a, 0x01, 0x1d, 0xde, 0x0f, 0x34, 0x1f, 0xfd, 0x7e, 0xaa, 0xc7,
+  0xa7, 0xfe, 0xf8, 0xe1, 0x62, 0xec, 0x77, 0x2f, 0x82, 0x2f, 0x2c, 0xf6,
+  0x5e, 0xda, 0xc5, 0x14, 0x87, 0xd9, 0x3a, 0xff, 0x8c, 0x6b, 0x68, 0x63,
+  0xf6, 0xe4, 0x91, 0xb2, 0x11, 0x36, 0xe6, 0x84, 0x19, 0xfc, 0xa5, 0xd8,
+  0x79, 0x77, 0x48, 0x25, 0xb7, 0x29, 0xd2, 0x7c, 0x8d, 0x9b, 0x05, 0xcc,
+  0x9b, 0x41, 0xc0, 0xb4, 0x8e, 0xcb, 0x44, 0x3e, 0x99, 0xef, 0xaa, 0xe5,
+  0xfb, 0xac, 0x96, 0xcb, 0x9c, 0xf0, 0xa2, 0x87, 0xe7, 0xe8, 0xdb, 0x49,
+  0x87, 0x53, 0x58, 0x25, 0x60, 0x46, 0xf1, 0x91, 0x3b, 0xfe, 0x08, 0x65,
+  0x5b, 0x6a, 0x12, 0x8c, 0xe4, 0x53, 0x79, 0xac, 0xd2, 0x34, 0xa6, 0x53,
+  0xc9, 0xff, 0xcd, 0x67, 0xd5, 0x76, 0x0b, 0xc4, 0xae, 0x32, 0x49, 0xe8,
+  0xda, 0xbe, 0xcf, 0x73, 0x77, 0x7d, 0xca, 0x70, 0xee, 0x78, 0xfd, 0x71,
+  0x8d, 0x97, 0x5e, 0xdd, 0x92, 0x40, 0xbe, 0xe5, 0x45, 0x9d, 0xaf, 0xda,
+  0xaa, 0x2e, 0xf2, 0x86, 0xe3, 0xb8, 0x86, 0x48, 0x73, 0xb9, 0xac, 0x8b,
+  0x8e, 0xeb, 0x30, 0x34, 0xa0, 0x2a, 0x06, 0x2b, 0x90, 0xbd, 0xa6, 0xe5,
+  0xaf, 0x3d, 0x2c, 0x4e, 0xed, 0x5a, 0x8a, 0xa9, 0x5b, 0x87, 0xd6, 0xc5,
+  0xd9, 0x6b, 0x94, 0x19, 0x24, 0xe2, 0xe9, 0x21, 0x21, 0xe1, 0x6b, 0x1d,
+  0x05, 0x66, 0xe8, 0x25, 0xed, 0xe3, 0x35, 0xeb, 0x48, 0x74, 0xa2, 0x6d,
+  0xd3, 0xc8, 0x88, 0x4c, 0x68, 0xf3, 0xd2, 0x5b, 0x47, 0x7e, 0xe9, 0xad,
+  0x23, 0xb1, 0xda, 0x39, 0xa7, 0xf3, 0x6c, 0xaa, 0x2d, 0x39, 0xec, 0x96,
+  0xe4, 0x38, 0xf9, 0xdf, 0xf2, 0x9b, 0x43, 0x5e, 0xdf, 0x1f, 0xdb, 0xe2,
+  0x06, 0x9b, 0x3c, 0xd8, 0xfc, 0xae, 0x3e, 0xdc, 0xab, 0xfe, 0x32, 0xb5,
+  0xdf, 0xa2, 0x73, 0x1e, 0xd5, 0x31, 0x72, 0xd2, 0x8f, 0x86, 0xee, 0x7a,
+  0x67, 0x7b, 0x28, 0xb5, 0x48, 0xfa, 0x2a, 0x8e, 0xfb, 0xd1, 0x74, 0x96,
+  0xfe, 0x0e, 0x9b, 0x3c, 0x7a, 0x25, 0x72, 0xb8, 0x27, 0x76, 0x1b, 0x11,
+  0xb3, 0xde, 0xa9, 0x7a, 0x88, 0xc0, 0x86, 0xa6, 0x06, 0x4e, 0x1f, 0x07,
+  0x14, 0x57, 0x92, 0x7e, 0xc0, 0xa7, 0x72, 0xcd, 0xad, 0xd8, 0xdd, 0xc0,
+  0xf2, 0x60, 0xc3, 0x03, 0x0e, 0x40, 0x6e, 0xda, 0x6d, 0xc9, 0x90, 0xa4,
+  0x4c, 0xbf, 0x1a, 0x86, 0x6e, 0xab, 0xfd, 0x30, 0x5a, 0x7b, 0xca, 0xa5,
+  0x97, 0x3e, 0x46, 0x09, 0x58, 0xe7, 0xdb, 0x23, 0x49, 0x6d, 0x60, 0x45,
+  0xc8, 0x47, 0x40, 0x6d, 0x40, 0x09, 0x71, 0x33, 0x39, 0x0a, 0x76, 0x53,
+  0x35, 0xed, 0xd3, 0x01, 0x21, 0xc0, 0x73, 0xe0, 0x69, 0xa9, 0xb9, 0x08,
+  0x9e, 0xca, 0x64, 0xe8, 0xa8, 0x7f, 0xfe, 0x2c, 0xe4, 0x19, 0xfe, 0xd1,
+  0xc7, 0xcd, 0xf5, 0x0a, 0x98, 0x33, 0xdf, 0x35, 0x07, 0xe0, 0xfe, 0x3a,
+  0x87, 0x7d, 0xc8, 0x75, 0x79, 0xcf, 0xc4, 0xd0, 0x52, 0xa4, 0x93, 0x88,
+  0xb0, 0x93, 0x55, 0x00, 0x6d, 0x7e, 0x24, 0x30, 0x97, 0x98, 0x9a, 0x49,
+  0x65, 0xc5, 0x47, 0x4b, 0xc6, 0x34, 0x00, 0x77, 0x54, 0x03, 0xb4, 0x63,
+  0xfe, 0x5a, 0x6d, 0x50, 0x7f, 0x9f, 0x23, 0x9a, 0xe1, 0x40, 0x7b, 0x27,
+  0x6e, 0xe3, 0xb6, 0x00, 0x7f, 0xc5, 0x25, 0x2d, 0xad, 0xeb, 0x82, 0x66,
+  0x50, 0xbd, 0x6f, 0xdc, 0x02, 0x06, 0x2b, 0x0e, 0x46, 0x22, 0xb4, 0xe1,
+  0x27, 0x64, 0x7f, 0x64, 0x17, 0xb1, 0x7b, 0xde, 0x15, 0x65, 0x1c, 0x7f,
+  0x16, 0x57, 0x2b, 0xda, 0x22, 0x55, 0xf5, 0x5b, 0x50, 0x34, 0xf2, 0x28,
+  0xa8, 0xc3, 0x6a, 0x8d, 0x49, 0x63, 0x74, 0xaa, 0x6f, 0x60, 0x2a, 0x95,
+  0x79, 0x4d, 0x52, 0x55, 0xe5, 0x1a, 0xfb, 0xff, 0x19, 0xd5, 0x9b, 0xe4,
+  0x1e, 0x65, 0x51, 0xdb, 0x3d, 0xf7, 0x3e, 0x6b, 0x37, 0x38, 0xc6, 0x7b,
+  0xa4, 0x60, 0x41, 0xff, 0xe0, 0x18, 0xb8, 0xe3, 0x69, 0x3d, 0xb3, 0xb2,
+  0x5f, 0x4e, 0x38, 0x8c, 0xb1, 0x16, 0x34, 0x97, 0x8e, 0x74, 0x8b, 0x6d,
+  0xe9, 0xde, 0x69, 0x39, 0x2c, 0xa9, 0x58, 0x2f, 0x71, 0x32, 0x79, 0xd0,
+  0xf4, 0xd3, 0x55, 0x60, 0xc1, 0xd6, 0xf9, 0xbb, 0x02, 0xf3, 0x7f, 0x39,
+  0xb4, 0xfc, 0x62, 0x5d, 0x68, 0x90, 0x26, 0x4b, 0x27, 0x1e, 0x0b, 0xb3,
+  0x69, 0x7c, 0xb5, 0xa6, 0x3e, 0xb9, 0x44, 0x28, 0xb3, 0x3d, 0x00, 0xe6,
+  0xeb, 0xdc, 0x9e, 0x89, 0x61, 0x20, 0x4f, 0xc5, 0x76, 0x3e, 0xb1, 0x3e,
+  0xc2, 0x1f, 0x7d, 0x6c, 0x70, 0xa4, 0xf2, 0xdb, 0xba, 0xc2, 0x10, 0x51,
+  0xab, 0xf2, 0x72, 0xb5, 0x21, 0x77, 0x3c, 0xa1, 0xc9, 0xb2, 0x51, 0x7e,
+  0xd7, 0x5e, 0xae, 0xd6, 0xfe, 0xfb, 0xed, 0x41, 0x2d, 0x63, 0xf8, 0x4d,
+  0xc3, 0xec, 0xd9, 0xf6, 0x2f, 0x7c, 0x58, 0xe4, 0xd5, 0x1d, 0x23, 0x5a,
+  0x41, 0x1d, 0x50, 0x6c, 0x29, 0xe3, 0x9f, 0xe8, 0xb0, 0x8f, 0x3e, 0xbe,
+  0xc5, 0x39, 0xd0, 0x14, 0x97, 0x1d, 0x62, 0x10, 0x05, 0xb1, 0x04, 0x0c,
+  0x3a, 0xd1, 0x8a, 0xd7, 0xbd, 0x93, 0x28, 0xca, 0xc3, 0xaa, 0x40, 0x17,
+  0x0f, 0x80, 0xc2, 0x02, 0xb8, 0xe8, 0xa6, 0xc0, 0x78, 0xba, 0x35, 0xd7,
+  0x78, 0x66, 0x51, 0xdc, 0x75, 0xea, 0x93, 0xcf, 0x94, 0x4d, 0x4e, 0x5b,
+  0xe8, 0x8d, 0x09, 0xbd, 0x68, 0x9e, 0x12, 0x02, 0xec, 0x84, 0x1d, 0xc5,
+  0x0b, 0x77, 0x1c, 0x12, 0x2a, 0xe8, 0x9f, 0x3e, 0x7c, 0x3a, 0xf1, 0xea,
+  0xba, 0xcd, 0xdb, 0xd5, 0x7b, 0x34, 0x1c, 0x3e, 0x9b, 0xd8, 0xc1, 0x58,
+  0x61, 0x75, 0xd8, 0x43, 0xf0, 0xc5, 0x23, 0x23, 0x4f, 0xf4, 0x87, 0xb2,
+  0xb6, 0x41, 0xa5, 0xef, 0xd7, 0x37, 0x37, 0x05, 0x5a, 0xe7, 0xcb, 0x7b,
+  0x83, 0x7d, 0x27, 0xe1, 0x5d, 0x1b, 0x2a, 0xe4, 0xca, 0x9c, 0xc1, 0x14,
+  0xab, 0xce, 0xcd, 0x4f, 0x78, 0xdf, 0x62, 0x44, 0xa0, 0x84, 0x98, 0x9a,
+  0x4d, 0x01, 0xbb, 0x19, 0xd9, 0x1f, 0xad, 0xf3, 0xeb, 0x22, 0xdb, 0x91,
+  0xae, 0x79, 0xb8, 0x3e, 0xec, 0xda, 0x03, 0xda, 0x90, 0xf0, 0x8a, 0x64,
+  0x43, 0x21, 0x83, 0x7e, 0x96, 0x5f, 0x9b, 0x17, 0xcf, 0x2f, 0xfe, 0x1e,
+  0x13, 0xa9, 0xe7, 0x0d, 0xec, 0xa2, 0xce, 0xbd, 0xe1, 0xbb, 0x8b, 0xfb,
+  0xf2, 0xf6, 0xa8, 0xae, 0x24, 0x78, 0x32, 0x9d, 0x05, 0x2a, 0xd1, 0x91,
+  0x25, 0xb9, 0xaa, 0x25, 0x1e, 0xf5, 0x2b, 0x57, 0x33, 0xff, 0x22, 0xb7,
+  0x7a, 0x5c, 0x88, 0xb4, 0x38, 0x5e, 0x62, 0x5e, 0xa1, 0xb1, 0xc6, 0x01,
+  0x80, 0xde, 0x5e, 0x38, 0xf9, 0xea, 0x1f, 0xd2, 0x4e, 0x7e, 0x01, 0x9a,
+  0xc3, 0x25, 0xc9, 0xb4, 0x76, 0xb3, 0x2d, 0xcf, 0x57, 0xfb, 0xfd, 0xa5,
+  0xf9, 0x0c, 0x99, 0x90, 0xae, 0x8a, 0x8a, 0xbc, 0xc2, 0x67, 0x6a, 0xfa,
+  0x81, 0x26, 0x5e, 0x26, 0x32, 0x0f, 0xc4, 0x1f, 0x19, 0xb1, 0x4d, 0x81,
+  0x5d, 0x65, 0xac, 0x74, 0x17, 0x73, 0x6d, 0x8b, 0xb1, 0x70, 0x90, 0xa6,
+  0x73, 0x92, 0xe0, 0xd8, 0x03, 0xb4, 0x1f, 0xe7, 0xd9, 0xab, 0xdd, 0xd8,
+  0x5d, 0xaa, 0x1b, 0x4f, 0x99, 0x63, 0x41, 0x30, 0x5f, 0x2d, 0xac, 0xdc,
+  0x73, 0xab, 0xc4, 0xbf, 0xf1, 0x16, 0x0b, 0xe8, 0xcd, 0x76, 0xa1, 0x24,
+  0xf6, 0x68, 0x96, 0xf9, 0x81, 0x3b, 0x5b, 0xb9, 0x0f, 0xcb, 0x53, 0x0c,
+  0x4d, 0xcf, 0xd2, 0x1c, 0x6c, 0x65, 0xd4, 0xa0, 0xcb, 0x87, 0xd9, 0xc3,
+  0x0f, 0xec, 0xca, 0x23, 0x35, 0xcb, 0x2e, 0xfa, 0xb9, 0x59, 0x25, 0x0e,
+  0xe4, 0xc2, 0xa5, 0x83, 0x96, 0x49, 0x72, 0x30, 0x32, 0xe1, 0x9a, 0xe7,
+  0x67, 0xf2, 0x44, 0xd1, 0x8b, 0x61, 0x6c, 0x81, 0x15, 0xd4, 0x46, 0x7b,
+  0x74, 0xcc, 0x94, 0x9d, 0x8d, 0x96, 0xa2, 0x31, 0x42, 0x05, 0x6b, 0x8b,
+  0x58, 0xd9, 0xbb, 0x7d, 0x5e, 0x1a, 0xc5, 0x8b, 0x1b, 0x56, 0x4c, 0x9f,
+  0xf0, 0x5c, 0x12, 0x9f, 0x48, 0x50, 0x03, 0x02, 0x43, 0xd6, 0xf0, 0x4b,
+  0x91, 0x61, 0x0a, 0x5f, 0x2e, 0xa1, 0xc0, 0x45, 0x6c, 0xb5, 0x9e, 0x7a,
+  0x4d, 0x9b, 0xe3, 0x40, 0xb0, 0x21, 0x8b, 0xc2, 0x54, 0xf9, 0xae, 0x29,
+  0xb0, 0xa7, 0x25, 0xe3, 0x2c, 0x80, 0x38, 0x67, 0x43, 0x11, 0xeb, 0x0e,
+  0xc5, 0x25, 0xc7, 0xda, 0xd0, 0xa3, 0xf8, 0x66, 0x53, 0x1d, 0x4a, 0x76,
+  0x80, 0x40, 0x41, 0x0f, 0xf3, 0x14, 0x50, 0xb8, 0xd0, 0xb4, 0x9c, 0xfd,
+  0x10, 0xea, 0x9c, 0x4f, 0xc9, 0x0a, 0x8d, 0xb8, 0x23, 0xdf, 0x63, 0xbc,
+  0x37, 0x4e, 0x7e, 0x68, 0xec, 0xf7, 0x43, 0xbb, 0x68, 0x07, 0x16, 0xe0,
+  0x48, 0x5d, 0xbb, 0x91, 0x35, 0xa8, 0x63, 0xde, 0xb6, 0xb9, 0xb5, 0xc2,
+  0xb1, 0xf1, 0x2f, 0x0d, 0x78, 0x75, 0x2d, 0x02, 0x82, 0xbd, 0x80, 0x5f,
+  0x61, 0x69, 0x0e, 0xfd, 0xe5, 0xdb, 0xfe, 0xea, 0xea, 0xfd, 0x52, 0xd2,
+  0x81, 0xd8, 0x4b, 0x34, 0xf0, 0x4e, 0x32, 0x19, 0x08, 0x3c, 0x5b, 0xd9,
+  0xcb, 0x0e, 0x20, 0xbc, 0x3b, 0x6c, 0x77, 0x5d, 0xd8, 0xad, 0xf3, 0xce,
+  0x03, 0x2e, 0xb7, 0x6d, 0x3b, 0xd5, 0x3b, 0x43, 0x3e, 0xdd, 0x54, 0x60,
+  0x67, 0x5d, 0x1c, 0xbc, 0x4f, 0x8c, 0xaa, 0xad, 0x31, 0xb5, 0xab, 0x1c,
+  0x9c, 0x76, 0x7c, 0x24, 0x2d, 0x29, 0x6d, 0x9d, 0xed, 0x1a, 0x58, 0x13,
+  0x24, 0x7c, 0x19, 0xec, 0xef, 0xea, 0x0a, 0xf8, 0x3f, 0xbf, 0x31, 0x5b,
+  0xb3, 0x8b, 0x4b, 0xe5, 0xdf, 0x18, 0xd7, 0xee, 0xd3, 0x29, 0x6a, 0xe9,
+  0xd6, 0x9b, 0xd2, 0xeb, 0x90, 0x6f, 0x31, 0x35, 0x8a, 0x45, 0x87, 0x44,
+  0xa8, 0xcc, 0xf5, 0x5d, 0x54, 0x99, 0xd7, 0xa9, 0x47, 0x57, 0xb6, 0x1d,
+  0xa8, 0xcc, 0x12, 0x9f, 0x68, 0x8d, 0x5a, 0x00, 0xbd, 0x57, 0xbe, 0x3c,
+  0xc0, 0xa9, 0x67, 0x2f, 0x75, 0x59, 0x18, 0xd1, 0x71, 0x8e, 0xea, 0x1a,
+  0x7f, 0x46, 0xe3, 0x28, 0x3a, 0x24, 0x66, 0xd7, 0xa1, 0xd4, 0xb6, 0x3c,
+  0xd1, 0x15, 0x4a, 0xa9, 0xf7, 0x2a, 0xa4, 0x74, 0xeb, 0x28, 0xb5, 0x30,
+  0x01, 0xa5, 0x23, 0xfd, 0x1a, 0x53, 0xea, 0x90, 0x98, 0x6d, 0x77, 0x00,
+  0xb3, 0xa0, 0xd3, 0x1c, 0x6c, 0x8a, 0x72, 0xaa, 0x6d, 0x32, 0x09, 0xc8,
+  0x3a, 0x46, 0x0e, 0xe8, 0x1c, 0xf1, 0xa2, 0x5e, 0xa8, 0x20, 0xa8, 0x17,
+  0xde, 0xd8, 0x0d, 0xf4, 0x44, 0x6d, 0x4f, 0x94, 0x4e, 0x3a, 0xc2, 0xa1,
+  0x4b, 0x82, 0xf5, 0x1b, 0x90, 0xe4, 0xa0, 0x81, 0xc4, 0x1a, 0x9d, 0x5b,
+  0x1e, 0x1e, 0xf7, 0x51, 0x66, 0xed, 0x20, 0x3f, 0xfa, 0xcd, 0xf7, 0x53,
+  0xc9, 0xf2, 0x49, 0x98, 0xb3, 0x81, 0x07, 0xc9, 0xda, 0xbd, 0x3a, 0x3c,
+  0xc6, 0x8c, 0xa4, 0x88, 0xe0, 0x47, 0x71, 0x21, 0x15, 0x00, 0x2c, 0x0f,
+  0x0b, 0xbe, 0x1c, 0xe5, 0xbf, 0x60, 0x60, 0x62, 0xc2, 0xe8, 0xbd, 0xcf,
+  0x54, 0xc3, 0x35, 0x03, 0x64, 0xb2, 0xe6, 0xe0, 0x56, 0x89, 0x5a, 0xfe,
+  0xa3, 0x8e, 0xe0, 0x32, 0x81, 0x1c, 0xe4, 0xd2, 0x72, 0xa9, 0x84, 0x57,
+  0x46, 0xf5, 0xf5, 0x39, 0xf5, 0x17, 0x47, 0x58, 0x2b, 0xf2, 0x77, 0x74,
+  0xfa, 0xca, 0x2a, 0xc1, 0x17, 0x78, 0xee, 0x8d, 0xab, 0x9d, 0xd8, 0xa2,
+  0xdd, 0x29, 0x37, 0x46, 0x1c, 0xa6, 0x95, 0x72, 0x45, 0x76, 0xea, 0x73,
+  0x78, 0xa0, 0x05, 0x7d, 0xe4, 0x3c, 0xe8, 0x5b, 0x9c, 0x06, 0x91, 0x17,
+  0xa1, 0xbf, 0xc0, 0x7d, 0xab, 0x03, 0x0e, 0x69, 0x75, 0x68, 0xe4, 0x56,
+  0xa5, 0xa6, 0xc6, 0x73, 0xfe, 0x25, 0x25, 0x0c, 0x07, 0x0a, 0x77, 0x5e,
+  0x80, 0xce, 0xce, 0x41, 0x80, 0x7c, 0x95, 0xcf, 0xad, 0x9e, 0x7f, 0x76,
+  0x37, 0xde, 0xe8, 0x32, 0xd0, 0x98, 0xeb, 0xa2, 0x05, 0xaa, 0x1b, 0x16,
+  0xbe, 0x14, 0x81, 0x1d, 0x53, 0x41, 0x64, 0x1c, 0x7d, 0x1d, 0x9d, 0x9e,
+  0xcf, 0xa5, 0xf8, 0x57, 0xd5, 0x1a, 0x54, 0xda, 0xdf, 0x70, 0x10, 0x48,
+  0xd6, 0x42, 0x2d, 0x3e, 0x8c, 0x08, 0xa9, 0xfa, 0xfe, 0x26, 0x2b, 0x6f,
+  0xa0, 0x09, 0xf7, 0x74, 0x5d, 0x60, 0x5b, 0xfc, 0x19, 0xd4, 0xd6, 0x2f,
+  0x7e, 0xf1, 0xdb, 0x2f, 0x81, 0xb5, 0xd6, 0x79, 0x98, 0x1b, 0xc2, 0xc5,
+  0xbc, 0xae, 0xb6, 0x57, 0xc5, 0xf6, 0x96, 0x6b, 0x97, 0x33, 0x3c, 0x91,
+  0x3f, 0xd4, 0x44, 0x7f, 0x8f, 0x1e, 0x44, 0x2c, 0x6b, 0x37, 0x68, 0x82,
+  0x24, 0x52, 0x8d, 0x4b, 0xbe, 0x3d, 0x1a, 0x07, 0x3c, 0xc0, 0xd2, 0x0d,
+  0xcf, 0xed, 0xdd, 0x2d, 0xf0, 0xc0, 0x38, 0x9e, 0xf7, 0x9a, 0xee, 0xac,
+  0x25, 0xe3, 0xc2, 0x77, 0x8a, 0xbc, 0x71, 0x24, 0xc5, 0x9a, 0x0f, 0xba,
+  0xc4, 0x9d, 0x70, 0x94, 0x5d, 0x16, 0x84, 0xa4, 0x57, 0xdd, 0xc5, 0xa7,
+  0x5c, 0x0e, 0xfe, 0x85, 0xaf, 0x12, 0xf9, 0x47, 0x35, 0xaf, 0x26, 0xe6,
+  0xee, 0x45, 0x47, 0x61, 0x92, 0x34, 0x52, 0x5d, 0x50, 0x77, 0x8c, 0xe3,
+  0xf7, 0x70, 0x64, 0x26, 0xa2, 0x0e, 0x25, 0xe3, 0x2e, 0xf7, 0xb0, 0x6d,
+  0x07, 0x75, 0xcc, 0x13, 0x27, 0x3d, 0xe9, 0x8a, 0x62, 0x93, 0x67, 0xf5,
+  0x6a, 0x83, 0x7e, 0xb7, 0xd6, 0x6c, 0x5a, 0xb4, 0x6a, 0xaf, 0x95, 0xdb,
+  0x69, 0xd1, 0x37, 0xcb, 0x93, 0x3f, 0x43, 0xae, 0xfb, 0xbc, 0x2c, 0xb2,
+  0x06, 0xf6, 0x1b, 0xc0, 0x20, 0xcc, 0x99, 0xb0, 0x45, 0xae, 0xb3, 0x95,
+  0xb8, 0xaf, 0xd0, 0x06, 0xb9, 0xba, 0x31, 0xd5, 0xa1, 0xb6, 0x0c, 0x77,
+  0xda, 0x50, 0xb8, 0xa2, 0x2d, 0x1e, 0x93, 0x7a, 0x19, 0x03, 0x40, 0x7d,
+  0xc5, 0x8e, 0xc4, 0x28, 0x4a, 0x5b, 0xe7, 0x76, 0x3b, 0x77, 0xb3, 0x25,
+  0xde, 0x2b, 0x92, 0x9b, 0xc2, 0x5c, 0x21, 0x97, 0xdc, 0xdb, 0x4b, 0x97,
+  0xcc, 0xca, 0x78, 0x53, 0x29, 0xd0, 0xd7, 0x83, 0x9a, 0xa4, 0x69, 0xc9,
+  0x0a, 0x39, 0x77, 0x3a, 0x7a, 0x88, 0x50, 0xff, 0x52, 0x42, 0xa6, 0x25,
+  0x28, 0xe5, 0x68, 0x0b, 0x7a, 0x27, 0xee, 0x13, 0x39, 0x1a, 0x1e, 0xd9,
+  0xd2, 0xef, 0xa2, 0x27, 0x89, 0xef, 0xbd, 0x96, 0x83, 0x9f, 0x7c, 0x26,
+  0xff, 0xce, 0x5c, 0x66, 0xbb, 0x7b, 0xfc, 0x6d, 0x5a, 0x59, 0x0a, 0x4f,
+  0x94, 0x83, 0xec, 0x6d, 0x56, 0xfb, 0x16, 0x96, 0x37, 0x3c, 0xe5, 0x74,
+  0x7e, 0x21, 0xef, 0xd0, 0x2f, 0x84, 0xe8, 0xbd, 0xbc, 0x64, 0xff, 0x90,
+  0x85, 0x07, 0xee, 0x9b, 0x21, 0x7e, 0xc7, 0xf2, 0x0e, 0x1d, 0x2d, 0xfe,
+  0xe0, 0x9f, 0x77, 0x27, 0x1a, 0x82, 0x1c, 0xc7, 0x49, 0xb8, 0x2c, 0x7b,
+  0x89, 0x98, 0xdd, 0x72, 0x34, 0xf1, 0xca, 0x46, 0x14, 0x87, 0x5a, 0xd1,
+  0x3f, 0x8a, 0x9a, 0xe2, 0x08, 0xa1, 0xf8, 0xd6, 0xee, 0xa2, 0xf0, 0x10,
+  0x28, 0xc9, 0x4b, 0xef, 0x34, 0x52, 0xed, 0x74, 0x84, 0x43, 0xb7, 0x1a,
+  0x78, 0xd2, 0x7b, 0xba, 0xa5, 0x1d, 0x0f, 0x90, 0x08, 0xdb, 0x55, 0x50,
+  0x03, 0x56, 0xd0, 0x11, 0x19, 0x1e, 0x3b, 0xd2, 0x01, 0x99, 0x06, 0x24,
+  0x94, 0x53, 0x2f, 0x31, 0x23, 0x7a, 0xe5, 0xed, 0x68, 0xd2, 0x41, 0x70,
+  0x41, 0x8f, 0xb0, 0xd5, 0xc5, 0x83, 0x91, 0xfb, 0x33, 0xf4, 0xb4, 0x82,
+  0x06, 0x02, 0x1b, 0x66, 0xeb, 0x35, 0x07, 0x90, 0xe2, 0x9e, 0x2e, 0x38,
+  0xba, 0x9b, 0x22, 0x61, 0x6e, 0xde, 0xa1, 0xe8, 0x63, 0x66, 0x56, 0x63,
+  0x26, 0x65, 0xd9, 0x6a, 0x5a, 0x50, 0xbb, 0xc8, 0xe4, 0xc6, 0x36, 0xcc,
+  0xa6, 0x68, 0x0f, 0x19, 0x9f, 0x87, 0x6a, 0x4f, 0x74, 0xc6, 0x8f, 0xbb,
+  0xca, 0x9c, 0x4a, 0xd6, 0x75, 0xbb, 0xb9, 0x92, 0xfe, 0x16, 0xbe, 0x44,
+  0x2d, 0x88, 0xba, 0x65, 0x6b, 0xc3, 0xb5, 0x5b, 0x3b, 0x60, 0x07, 0xa5,
+  0x94, 0x49, 0x32, 0x86, 0x16, 0xf2, 0x19, 0x63, 0xee, 0x18, 0x63, 0x71,
+  0x04, 0x63, 0x28, 0xfa, 0x85, 0x77, 0x88, 0xaf, 0x29, 0x02, 0xcd, 0x44,
+  0xad, 0x13, 0x9d, 0x6c, 0x06, 0x76, 0x52, 0x36, 0x30, 0x67, 0xb3, 0xf6,
+  0x80, 0x2b, 0x9c, 0x37, 0xaf, 0x68, 0x29, 0x24, 0x8b, 0x3d, 0x33, 0x08,
+  0x4f, 0x17, 0x6f, 0x5f, 0x7e, 0x23, 0x27, 0xc9, 0x72, 0x4f, 0x78, 0x9e,
+  0x96, 0x0d, 0xde, 0x42, 0x8a, 0xe3, 0xf5, 0xf9, 0x17, 0xbf, 0xfd, 0xfc,
+  0xd2, 0x7c, 0x59, 0xc1, 0xe4, 0xbf, 0x2e, 0x31, 0xca, 0xb1, 0xd8, 0xa4,
+  0x15, 0xfe, 0x9f, 0x54, 0x5a, 0x0e, 0xce, 0x7f, 0x77, 0xd3, 0xcd, 0x9e,
+  0xe0, 0xfe, 0x8a, 0xd8, 0x0d, 0x7a, 0xf0, 0x7d, 0x0e, 0x0b, 0xe4, 0x3b,
+  0xf6, 0xd7, 0xcb, 0x9d, 0xe6, 0xc2, 0xe1, 0x8b, 0x39, 0xba, 0x98, 0xa9,
+  0x73, 0x8a, 0x6f, 0xac, 0x6c, 0x61, 0xf1, 0x62, 0x19, 0xc2, 0x26, 0x13,
+  0xe4, 0x59, 0x53, 0xaf, 0x9e, 0x6d, 0xf1, 0xed, 0x79, 0x49, 0xb9, 0x3f,
+  0x5d, 0x52, 0x3e, 0xcf, 0x71, 0x98, 0xac, 0x72, 0xf6, 0xbc, 0x46, 0x5c,
+  0x37, 0x6e, 0x40, 0x70, 0x12, 0x2a, 0x2c, 0xcd, 0xc6, 0x27, 0x69, 0xea,
+  0x3e, 0x5b, 0xbd, 0xc5, 0x4b, 0x4e, 0x0d, 0xbb, 0x1e, 0xf9, 0xee, 0x24,
+  0x16, 0x27, 0x39, 0x60, 0xd2, 0x71, 0x7e, 0x63, 0xde, 0x6f, 0x8a, 0xd5,
+  0x86, 0x50, 0x59, 0x3a, 0x13, 0x15, 0xe6, 0x77, 0xd0, 0x5b, 0xcd, 0xb9,
+  0xed, 0x8f, 0x7f, 0x03, 0xcc, 0x25, 0x54, 0x81, 0x27, 0x6c, 0xa0, 0xd5,
+  0x45, 0xa7, 0xd7, 0xbe, 0xd8, 0xc7, 0x67, 0xa5, 0x09, 0x11, 0x3b, 0x88,
+  0x1b, 0x58, 0x22, 0x08, 0x19, 0x0c, 0x37, 0xf4, 0xe0, 0x7b, 0x50, 0x5b,
+  0xa4, 0x57, 0x51, 0x1d, 0xd9, 0x71, 0xbe, 0x2a, 0x29, 0x7a, 0xee, 0xe7,
+  0x2f, 0xe5, 0x48, 0xea, 0xba, 0x22, 0xed, 0x40, 0xdb, 0xc8, 0xd7, 0xe4,
+  0xef, 0xdd, 0x3c, 0x35, 0xcf, 0xcd, 0xe4, 0x9f, 0x61, 0xac, 0xb6, 0x20,
+  0x63, 0xd9, 0xa7, 0xd2, 0xc6, 0xbf, 0x43, 0x1d, 0x8b, 0x61, 0xcf, 0x9c,
+  0xcf, 0xd6, 0x3f, 0xf9, 0x9e, 0xde, 0x9d, 0x80, 0xca, 0x88, 0xe0, 0xaa,
+  0xaa, 0x8b, 0x5b, 0x0c, 0x2a, 0x71, 0xa5, 0x35, 0x2e, 0x12, 0x90, 0xb4,
+  0x4c, 0xda, 0xd5, 0x35, 0xa9, 0x03, 0xf2, 0x4a, 0x3a, 0x77, 0x77, 0xdf,
+  0x9f, 0x58, 0x51, 0x17, 0x75, 0xa2, 0x32, 0x1a, 0x15, 0xe0, 0xfc, 0x6c,
+  0xe7, 0x4f, 0x9c, 0x6a, 0xf4, 0xba, 0xb7, 0xf1, 0x94, 0x9a, 0xc3, 0x8b,
+  0x88, 0xd0, 0x7b, 0x14, 0xdb, 0xf7, 0x51, 0x8f, 0xc8, 0xde, 0xdf, 0x11,
+  0x4a, 0x17, 0x92, 0xf9, 0xc8, 0x73, 0x32, 0xc2, 0xdb, 0x7f, 0x41, 0xaf,
+  0x5b, 0x71, 0x7c, 0xfa, 0xac, 0x4a, 0xb1, 0x66, 0x9a, 0x4b, 0x35, 0x73,
+  0x61, 0x3b, 0xce, 0x6e, 0x1e, 0x24, 0x85, 0x9d, 0x31, 0x89, 0x20, 0xdd,
+  0xf3, 0xf4, 0x28, 0x76, 0x02, 0xe5, 0xbb, 0x8e, 0x43, 0x5d, 0x1b, 0x27,
+  0x98, 0x9d, 0x5c, 0x5a, 0xc5, 0xa5, 0xf9, 0x0a, 0xcf, 0xe3, 0xed, 0x40,
+  0xa9, 0x30, 0xe0, 0xa3, 0x37, 0x60, 0xdc, 0xb8, 0x00, 0x23, 0x23, 0xff,
+  0x0e, 0x3a, 0x2a, 0x73, 0x93, 0x31, 0xe3, 0xdb, 0xac, 0xec, 0xdf, 0x05,
+  0x78, 0x70, 0x32, 0xf2, 0xdc, 0x38, 0x8f, 0xc6, 0x10, 0xf6, 0x07, 0xbd,
+  0x5d, 0x61, 0xbc, 0xdb, 0x69, 0x23, 0x6c, 0x21, 0x6d, 0x1c, 0x70, 0x33,
+  0xd3, 0xf5, 0x3f, 0x56, 0x26, 0x0f, 0x7b, 0x52, 0xa7, 0x7e, 0x4d, 0x07,
+  0x8b, 0xaa, 0x4d, 0xe2, 0x3d, 0x47, 0x76, 0x0e, 0x22, 0xd7, 0xa0, 0x5d,
+  0xfe, 0xde, 0xdc, 0x96, 0xd5, 0x35, 0xfb, 0x66, 0x88, 0xb3, 0x80, 0x74,
+  0xf4, 0x96, 0x42, 0x84, 0xe0, 0x42, 0x8d, 0xcb, 0xb7, 0xe7, 0x90, 0x72,
+  0x2a, 0x9e, 0xcc, 0xa1, 0x4b, 0x9c, 0xb9, 0xc9, 0x69, 0xb9, 0xa0, 0xbd,
+  0xc6, 0x10, 0xb9, 0x4f, 0xd2, 0x56, 0xf2, 0x90, 0x7e, 0x21, 0x37, 0x3e,
+  0x1d, 0x5d, 0x3c, 0xf9, 0xbf, 0x37, 0x6a, 0x48, 0xca, 0x1e, 0x3c, 0x01,
+  0x00
 };
-unsigned int wxMathML_lisp_gz_len = 19375;
+unsigned int wxMathML_lisp_gz_len = 20353;
@@ -65,6 +65,10 @@
     "Recognize TeX-style subscripts")
   (defvar $wxplot_usesvg nil "Create scalable plots?")
   (defvar $wxplot_pngcairo nil "Use gnuplot's pngcairo terminal for new plots?")
+  (defvar *wx-frontend-renders-frames* nil
+    "Leave running gnuplot for the frames of animations to the frontend? Set by frontends that can do so.")
+  (defvar *wx-compact-matrices* nil
+    "Send matrices that only contain plain numbers as one <tbn> tag? Set by frontends that understand it.")
   (defmvar $wxplot_old_gnuplot nil)
 
 
@@ -805,6 +809,10 @@
 	  ((and (null (cddr x))
 		(null (cdadr x)))
 	   (append l `("<fn><fnm>matrix</fnm><p><t>[</t><t>]</t></p></fn>") r))
+	  ((and *wx-compact-matrices*
+		(not (find 'inference (car x)))
+		(not (find 'special (car x)))
+		(wxxml-compact-matrix x l r)))
 	  (t
 	   (append l (cond
 		      ((find 'inference (car x))
@@ -828,6 +836,31 @@
 			   (cdr x))
 		   `("</tb>") r))))
 
+  ;; The text wxxml-atom would send for a number, without the tags, or nil if
+  ;; the number isn't displayed as a plain sequence of digits.
+  (defun wxxml-compact-number (x)
+    (when (or (integerp x) (floatp x))
+      (let ((digits (exploden (if (minusp x) (- x) x))))
+	(unless (member 'e digits :test #'string-equal)
+	  (format nil "~:[~;-~]~{~c~}" (minusp x) digits)))))
+
+  ;; Numeric matrices are sent as one tag: Columns are separated by
+  ;; spaces and rows by semicolons. That is only a fraction of the data
+  ;; the <mtr><mtd><mn> tags need and the frontend doesn't have to build
+  ;; an XML node for every number. Returns nil if the matrix contains
+  ;; anything else.
+  (defun wxxml-compact-matrix (x l r)
+    (let ((rows nil))
+      (dolist (row (cdr x))
+	(let ((numbers (mapcar #'wxxml-compact-number (cdr row))))
+	  (when (or (null numbers) (member nil numbers))
+	    (return-from wxxml-compact-matrix nil))
+	  (push (format nil "~{~a~^ ~}" numbers) rows)))
+      (append l
+	      (list (format nil "<tbn~:[~; roundedParens=\"true\"~]>~{~a~^;~}</tbn>"
+			    (string= $lmxchar #\() (nreverse rows)))
+	      r)))
+
   ;; macsyma sum or prod is over integer range, not  low <= index <= high
   ;; wxxml is lots more flexible .. but
 
@@ -1468,25 +1501,27 @@
 
   (defvar *default-framerate* 2)
   (defvar $wxanimate_framerate *default-framerate*)
-  (defun slide-tag (images)
-    (if (eql *default-framerate* $wxanimate_framerate)
+  ;; render = t: The frontend still has to run gnuplot on the frames' .gnuplot files
+  (defun slide-tag (images &optional render)
+    (let ((render-attr (if render " render=\"true\"" "")))
+      (if (eql *default-framerate* $wxanimate_framerate)
+	  ($ldisp
+	   (list '(wxxmltag simp)
+		 (wxxml-fix-string (format nil "~{~a;~}" images))
+		 "slide"
+		 (if (eql $wxanimate_autoplay 't)
+		     (format nil "running=\"true\" del=\"yes\"~a" render-attr)
+		   (format nil "running=\"false\" del=\"yes\"~a" render-attr)))
+	   (format nil "~%"))
 	($ldisp
 	 (list '(wxxmltag simp)
-	       (wxxml-fix-string (format nil "~{~a;~}" images))
+	       (wxxml-fix-string
+		(format nil "~{~a;~}" images))
 	       "slide"
 	       (if (eql $wxanimate_autoplay 't)
-		   "running=\"true\" del=\"yes\""
-		 "running=\"false\" del=\"yes\""))
-	 (format nil "~%"))
-      ($ldisp
-       (list '(wxxmltag simp)
-	     (wxxml-fix-string
-	      (format nil "~{~a;~}" images))
-	     "slide"
-	     (if (eql $wxanimate_autoplay 't)
-		 (format nil "fr=\"~a\" running=\"true\" del=\"yes\"" $wxanimate_framerate)
-	       (format nil "fr=\"~a\" running=\"false\" del=\"yes\"" $wxanimate_framerate)))
-       (format nil "~%"))))
+		   (format nil "fr=\"~a\" running=\"true\" del=\"yes\"~a" $wxanimate_framerate render-attr)
+		 (format nil "fr=\"~a\" running=\"false\" del=\"yes\"~a" $wxanimate_framerate render-attr)))
+	 (format nil "~%")))))
 
   (defun wxanimate (scene)
     (let* ((scene (cdr scene))
@@ -1550,6 +1585,21 @@
      (t
       `(((mequal simp) $dimensions ,$wxplot_size)))))
 
+  ;; Calls fun with maxima's $system replaced by a function that only records
+  ;; the commands it is asked to run. Returns the list of recorded commands.
+  ;; This way draw() writes the gnuplot file for a frame without running
+  ;; gnuplot on it.
+  (defun wx-record-system-calls (fun)
+    (let ((commands nil)
+	  (system (symbol-function '$system)))
+      (unwind-protect
+	  (progn
+	    (setf (symbol-function '$system)
+		  #'(lambda (&rest args) (push args commands) 0))
+	    (funcall fun))
+	(setf (symbol-function '$system) system))
+      (nreverse commands)))
+
   (defun wxanimate-draw (scenes scene-head)
     (unless ($get '$draw '$version) ($load "draw"))
     (multiple-value-bind (scene file-name) (get-file-name-opt (cdr scenes))
@@ -1579,7 +1629,8 @@
 					  imgs))
 				 (format t "<math><img del=\"yes\">~a.gif</img></math>" file-name))
 			     ;; If file_name is not set, show the animation in wxMaxima
-			     (progn
+			     (let ((render *wx-frontend-renders-frames*)
+				   (deferred nil))
 			       (dolist (aval (reverse (cdr a-range)))
 				 ($wxstatusbar (format nil "Preparing Frame #~d" frameno))
 				 (setf frameno (+ 1 frameno))
@@ -1601,18 +1652,32 @@
 					 (cons
 					  (format nil "~a/~a" $maxima_tempdir datafilename)
 					  images))
-				   ($apply '$draw
-					   (append
-					    `((mlist simp)
-					      ((mequal simp) $terminal ,(if $wxplot_usesvg '$svg
-									  (if $wxplot_pngcairo '$pngcairo '$png)))
-					      ((mequal simp) $gnuplot_file_name ,gnuplotfilename)
-					      ((mequal simp) $data_file_name ,datafilename)
-					      ((mequal simp) $file_name ,filename))
-					    (get-pic-size-opt)
-					    (list args)))))
+				   (flet ((draw-frame ()
+					    ($apply '$draw
+						    (append
+						     `((mlist simp)
+						       ((mequal simp) $terminal ,(if $wxplot_usesvg '$svg
+										   (if $wxplot_pngcairo '$pngcairo '$png)))
+						       ((mequal simp) $gnuplot_file_name ,gnuplotfilename)
+						       ((mequal simp) $data_file_name ,datafilename)
+						       ((mequal simp) $file_name ,filename))
+						     (get-pic-size-opt)
+						     (list args)))))
+				     (if *wx-frontend-renders-frames*
+					 ;; Leave running gnuplot to the frontend that can
+					 ;; run several gnuplot processes in parallel.
+					 (let ((commands (wx-record-system-calls #'draw-frame)))
+					   (if commands
+					       (setq deferred (append deferred commands))
+					     (setq render nil)))
+				       (draw-frame)))))
+			       ;; If draw() has run gnuplot for some frames but not for
+			       ;; others we cannot leave rendering to the frontend.
+			       (unless render
+				 (dolist (command deferred)
+				   (apply '$system command)))
 			       (when images
-				 (slide-tag images))))
+				 (slide-tag images render))))
 			   "")))
 
   (defmspec $wxanimate_draw (scene)
@@ -188,12 +188,21 @@ wxString AbsCell::ToOMML()
 }
 
 wxString AbsCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void AbsCell::AppendXML(wxString &out)
 {
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
   
-  return wxT("<a") +flags + wxT(">") + m_innerCell->ListToXML() + wxT("</a>");
+  out += wxT("<a") +flags + wxT(">");
+  m_innerCell->AppendListXML(out);
+  out += wxT("</a>");
 }
 
 bool AbsCell::BreakUp()
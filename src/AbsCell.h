@@ -58,6 +58,7 @@ public:
   AbsCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   AbsCell(const AbsCell &cell);
   Cell *Copy() override {return new AbsCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~AbsCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
@@ -85,6 +86,8 @@ public:
 
   wxString ToXML() override;
 
+  void AppendXML(wxString &out) override;
+
   wxString ToOMML() override;
 
 protected:
@@ -31,6 +31,7 @@ public:
   AtCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   AtCell(const AtCell &cell);
   Cell *Copy() override {return new AtCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~AtCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
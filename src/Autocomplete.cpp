@@ -37,10 +37,15 @@
 #include "ErrorRedirector.h"
 #include <wx/wfstream.h>
 #include <wx/txtstrm.h>
+#include <wx/stdpaths.h>
+#include <algorithm>
 
-AutoComplete::AutoComplete(Configuration *configuration)
+AutoComplete::AutoComplete(Configuration *configuration) :
+  m_builtInLoadFiles(new wxArrayString),
+  m_builtInDemoFiles(new wxArrayString)
 {
   m_configuration = configuration;
+  m_fileIndexLoaded = false;
 }
 
 void AutoComplete::ClearWorksheetWords()
@@ -56,7 +61,7 @@ void AutoComplete::ClearDemofileList()
   #ifdef HAVE_OPENMP_TASKS
   #pragma omp critical (AutocompleteFiles)
   #endif
-  m_wordList[demofile] = m_builtInDemoFiles;
+  m_wordList[demofile] = *std::atomic_load(&m_builtInDemoFiles);
 }
 
 void AutoComplete::AddSymbols(wxString xml)
@@ -163,6 +168,18 @@ void AutoComplete::LoadSymbols()
   LoadSymbols_BackgroundTask();
 }
 
+//! Sort a list and remove the duplicates from it
+static void SortUnique(wxArrayString &list)
+{
+  list.Sort();
+  wxArrayString unique;
+  unique.Alloc(list.GetCount());
+  for(wxArrayString::const_iterator it = list.begin(); it != list.end(); ++it)
+    if(unique.IsEmpty() || (unique.Last() != *it))
+      unique.Add(*it);
+  list.swap(unique);
+}
+
 void AutoComplete::BuiltinSymbols_BackgroundTask()
 {
   #ifdef HAVE_OPENMP_TASKS
@@ -180,10 +197,6 @@ void AutoComplete::BuiltinSymbols_BackgroundTask()
         it != m_configuration->m_escCodes.end();
         ++it)
        m_wordList[esccommand].Add(it->first);
-    m_wordList[command].Sort();
-    m_wordList[tmplte].Sort();
-    m_wordList[unit].Sort();
-    m_wordList[esccommand].Sort();
 
     wxString line;
 
@@ -245,83 +258,137 @@ void AutoComplete::BuiltinSymbols_BackgroundTask()
         text.Flush();
       }
     }
+
+    // The completion relies on the lists being sorted, and the private list
+    // might contain symbols we already know about.
+    SortUnique(m_wordList[command]);
+    SortUnique(m_wordList[tmplte]);
+    SortUnique(m_wordList[unit]);
+    SortUnique(m_wordList[esccommand]);
   }
 }
 
+//! Does a recursive scan of maxima's directories leave out this directory?
+static bool SkipMaximaDirectory(const wxString &path)
+{
+  return (path.EndsWith(".git")) ||
+    (path.EndsWith("/share/share")) ||
+    (path.EndsWith("/src/src")) ||
+    (path.EndsWith("/doc/doc")) ||
+    (path.EndsWith("/interfaces/interfaces"));
+}
+
+wxString AutoComplete::FileIndexFile()
+{
+  return Dirstructure::CacheDir() + wxT("/fileindex.txt");
+}
+
 void AutoComplete::LoadSymbols_BackgroundTask()
 {
+  // Completion never waits for this: It only reads the file lists this task
+  // publishes.
   #ifdef HAVE_OPENMP_TASKS
-  #pragma omp critical (AutocompleteFiles)
+  #pragma omp critical (AutocompleteFileIndex)
   #endif
   {
     // Error dialogues need to be created by the foreground thread.
     SuppressErrorDialogs suppressor;
-    
-    // Prepare a list of all built-in loadable files of maxima.
+
+    wxString shareDir;
+    wxString demoDir;
+    wxString sharedir = m_configuration->MaximaShareDir();
+    sharedir.Replace("\n","");
+    sharedir.Replace("\r","");
+    if(sharedir.IsEmpty())
+      wxLogMessage(_("Seems like the package with the maxima share files isn't installed."));
+    else
     {
-      GetMacFiles_includingSubdirs maximaLispIterator (m_builtInLoadFiles);
-      wxString sharedir = m_configuration->MaximaShareDir();
-      sharedir.Replace("\n","");
-      sharedir.Replace("\r","");
-      if(sharedir.IsEmpty())
-        wxLogMessage(_("Seems like the package with the maxima share files isn't installed."));
-      else
-      {
-        wxFileName shareDir(sharedir + "/");
-        shareDir.MakeAbsolute();
-        wxLogMessage(
-          wxString::Format(
-            _("Autocompletion: Scanning %s recursively for loadable lisp files."),
-            shareDir.GetFullPath().utf8_str()));
-        wxDir maximadir(shareDir.GetFullPath());
-        if(maximadir.IsOpened())
-          maximadir.Traverse(maximaLispIterator); //todo
-      }
-      GetMacFiles userLispIterator (m_builtInLoadFiles);
-      wxFileName userDir(Dirstructure::Get()->UserConfDir() + "/");
-      userDir.MakeAbsolute();
-      wxDir maximauserfilesdir(userDir.GetFullPath());
-      wxLogMessage(
-        wxString::Format(
-          _("Autocompletion: Scanning %s for loadable lisp files."),
-          userDir.GetFullPath().utf8_str()));
-      if(maximauserfilesdir.IsOpened())
-        maximauserfilesdir.Traverse(userLispIterator);
-      wxLogMessage(
-        wxString::Format(
-          _("Found %li loadable files."),
-          (unsigned long)m_builtInLoadFiles.GetCount()
-          )
-        );
+      wxFileName shareDirName(sharedir + "/");
+      shareDirName.MakeAbsolute();
+      shareDir = shareDirName.GetFullPath();
+      // The demos lie in the directory above the share directory
+      shareDirName.RemoveLastDir();
+      demoDir = shareDirName.GetFullPath();
+    }
+    wxFileName userDirName(Dirstructure::Get()->UserConfDir() + "/");
+    userDirName.MakeAbsolute();
+    wxString userDir = userDirName.GetFullPath();
+
+    // Offer the files we knew about in the last session at once...
+    if(!m_fileIndexLoaded)
+    {
+      m_fileIndexLoaded = true;
+      if(m_fileIndex.Load(FileIndexFile()))
+        PublishFileLists(shareDir, demoDir, userDir);
     }
-  
 
-    // Prepare a list of all built-in demos of maxima.
+    // ...and then read all directories that have changed since.
+    bool changed = false;
+    if(!demoDir.IsEmpty())
     {
-      wxFileName demoDir(m_configuration->MaximaShareDir() + "/");
-      demoDir.MakeAbsolute();
-      demoDir.RemoveLastDir();
-      GetDemoFiles_includingSubdirs maximaLispIterator (m_builtInDemoFiles);
       wxLogMessage(
         wxString::Format(
-          _("Autocompletion: Scanning %s for loadable demo files."),
-          demoDir.GetFullPath().utf8_str()));
-
-      wxDir maximadir(demoDir.GetFullPath());
-      if(maximadir.IsOpened())
-        maximadir.Traverse(maximaLispIterator);
+          _("Autocompletion: Scanning %s recursively for loadable lisp and demo files."),
+          demoDir.utf8_str()));
+      changed = m_fileIndex.Scan(demoDir, true, SkipMaximaDirectory);
     }
     wxLogMessage(
       wxString::Format(
-        _("Found %li demo files."),
-        (unsigned long)m_builtInDemoFiles.GetCount()
-        )
-      );
-    m_builtInLoadFiles.Sort();
-    m_builtInDemoFiles.Sort();
+        _("Autocompletion: Scanning %s for loadable lisp files."),
+        userDir.utf8_str()));
+    changed = m_fileIndex.Scan(userDir, false) || changed;
+    changed = m_fileIndex.Prune() || changed;
+    if(changed)
+      m_fileIndex.Save(FileIndexFile());
+    PublishFileLists(shareDir, demoDir, userDir);
   }
 }
 
+void AutoComplete::PublishFileLists(wxString shareDir, wxString demoDir, wxString userDir)
+{
+  std::shared_ptr<wxArrayString> loadFiles(new wxArrayString);
+  std::shared_ptr<wxArrayString> demoFiles(new wxArrayString);
+
+  wxArrayString files;
+  wxArrayString subdirs;
+  if(!shareDir.IsEmpty())
+    m_fileIndex.ListFiles(shareDir, true, files);
+  m_fileIndex.ListFiles(userDir, false, files, &subdirs);
+  for(wxArrayString::const_iterator it = files.begin(); it != files.end(); ++it)
+  {
+    if((it->EndsWith(".mac")) || (it->EndsWith(".lisp")) || (it->EndsWith(".wxm")))
+      loadFiles->Add("\"" + wxFileName(*it).GetName() + "\"");
+  }
+  for(wxArrayString::const_iterator it = subdirs.begin(); it != subdirs.end(); ++it)
+    loadFiles->Add("\"" + *it + "/\"");
+
+  files.Clear();
+  if(!demoDir.IsEmpty())
+    m_fileIndex.ListFiles(demoDir, true, files);
+  for(wxArrayString::const_iterator it = files.begin(); it != files.end(); ++it)
+  {
+    if(it->EndsWith(".dem"))
+      demoFiles->Add("\"" + wxFileName(*it).GetName() + "\"");
+  }
+
+  SortUnique(*loadFiles);
+  SortUnique(*demoFiles);
+  wxLogMessage(
+    wxString::Format(
+      _("Found %li loadable files."),
+      (unsigned long)loadFiles->GetCount()
+      )
+    );
+  wxLogMessage(
+    wxString::Format(
+      _("Found %li demo files."),
+      (unsigned long)demoFiles->GetCount()
+      )
+    );
+  std::atomic_store(&m_builtInLoadFiles, loadFiles);
+  std::atomic_store(&m_builtInDemoFiles, demoFiles);
+}
+
 void AutoComplete::UpdateDemoFiles(wxString partial, wxString maximaDir)
 {
   #ifdef HAVE_OPENMP_TASKS
@@ -436,7 +503,7 @@ void AutoComplete::UpdateLoadFiles(wxString partial, wxString maximaDir)
       partial += "/";
 
     // Remove all files from the maxima directory from the load file list
-    m_wordList[loadfile] = m_builtInLoadFiles;
+    m_wordList[loadfile] = *std::atomic_load(&m_builtInLoadFiles);
 
     // Add all files from the maxima directory to the load file list
     if(partial != wxT("//"))
@@ -468,28 +535,41 @@ wxArrayString AutoComplete::CompleteSymbol(wxString partial, autoCompletionType
   
     wxASSERT_MSG((type >= command) && (type <= unit), _("Bug: Autocompletion requested for unknown type of item."));
   
+    // In a sorted list all words starting with partial are found next to each other.
+    wxArrayString &words = m_wordList[type];
+    bool sorted = KeptSorted(type);
+    size_t first = 0;
+    if (sorted)
+      first = std::lower_bound(words.begin(), words.end(), partial) - words.begin();
+
     if (type != tmplte)
     {
-      for (size_t i = 0; i < m_wordList[type].GetCount(); i++)
+      for (size_t i = first; i < words.GetCount(); i++)
       {
-        if (m_wordList[type][i].StartsWith(partial) &&
-            completions.Index(m_wordList[type][i]) == wxNOT_FOUND)
-          completions.Add(m_wordList[type][i]);
+        if (!words[i].StartsWith(partial))
+        {
+          if (sorted)
+            break;
+          continue;
+        }
+        // Duplicates in a sorted list are neighbours
+        if (sorted ? (completions.IsEmpty() || (completions.Last() != words[i])) :
+            (completions.Index(words[i]) == wxNOT_FOUND))
+          completions.Add(words[i]);
       }
     }
     else
     {
-      for (size_t i = 0; i < m_wordList[type].GetCount(); i++)
+      for (size_t i = first; i < words.GetCount(); i++)
       {
-        wxString templ = m_wordList[type][i];
-        if (templ.StartsWith(partial))
-        {
-          if (completions.Index(templ) == wxNOT_FOUND)
-            completions.Add(templ);
-          if (templ.SubString(0, templ.Find(wxT("(")) - 1) == partial &&
-              perfectCompletions.Index(templ) == wxNOT_FOUND)
-            perfectCompletions.Add(templ);
-        }
+        wxString templ = words[i];
+        if (!templ.StartsWith(partial))
+          break;
+        if (completions.IsEmpty() || (completions.Last() != templ))
+          completions.Add(templ);
+        if (templ.SubString(0, templ.Find(wxT("(")) - 1) == partial &&
+            (perfectCompletions.IsEmpty() || (perfectCompletions.Last() != templ)))
+          perfectCompletions.Add(templ);
       }
     }
 
@@ -544,26 +624,36 @@ void AutoComplete::AddSymbol_nowait(wxString fun, autoCompletionType type)
     type = unit;
   }
 
+  wxArrayString &words = m_wordList[type];
+
   /// Add symbols
-  if ((type != tmplte) && m_wordList[type].Index(fun, true, true) == wxNOT_FOUND)
-    m_wordList[type].Add(fun);
+  if (type != tmplte)
+  {
+    if(KeptSorted(type))
+    {
+      wxArrayString::iterator pos = std::lower_bound(words.begin(), words.end(), fun);
+      if((pos == words.end()) || (*pos != fun))
+        words.Insert(fun, pos - words.begin());
+    }
+    else if(words.Index(fun, true, true) == wxNOT_FOUND)
+      words.Add(fun);
+  }
 
   /// Add templates - for given function and given argument count we
-  /// only add one template. We count the arguments by counting '<'
+  /// only add one template. We count the arguments by counting '<'.
+  /// All templates for a function are found next to each other.
   if (type == tmplte)
   {
     fun = FixTemplate(fun);
     wxString funName = fun.SubString(0, fun.Find(wxT("(")));
     long count = fun.Freq('<');
-    size_t i = 0;
-    for (i = 0; i < m_wordList[type].GetCount(); i++)
+    for (wxArrayString::const_iterator it = std::lower_bound(words.begin(), words.end(), funName);
+         (it != words.end()) && it->StartsWith(funName); ++it)
     {
-      wxString t = m_wordList[type][i];
-      if (t.StartsWith(funName) && (t.Freq('<') == count))
-        break;
+      if (it->Freq('<') == count)
+        return;
     }
-    if (i == m_wordList[type].GetCount())
-      m_wordList[type].Add(fun);
+    words.Insert(fun, std::lower_bound(words.begin(), words.end(), fun) - words.begin());
   }
 }
 
@@ -36,6 +36,8 @@
 #include <wx/regex.h>
 #include <wx/filename.h>
 #include "Configuration.h"
+#include "DirectoryIndex.h"
+#include <memory>
 
 /* The autocompletion logic
 
@@ -106,6 +108,15 @@ public:
   static wxString FixTemplate(wxString templ);
 
 private:
+  /*! Is the word list for this type of symbols kept sorted?
+
+    The lists of maxima's symbols are. Symbols can be found in them by a
+    binary search, and all symbols that start with the same letters are found
+    next to each other. The lists of files are replaced as a whole by the
+    directory scanners instead.
+  */
+  static bool KeptSorted(autoCompletionType type)
+    {return (type == command) || (type == tmplte) || (type == esccommand) || (type == unit);}
   //! An AddSymbol that doesn't wait for background tasks to finish
   void AddSymbol_nowait(wxString fun, autoCompletionType type = command);
   //! The configuration storage
@@ -117,10 +128,25 @@ private:
 
   //! Replace the list of files in the directory the worksheet file is in to the load files list
   void UpdateLoadFiles_BackgroundTask(wxString partial, wxString maximaDir);
-  //! The list of loadable files maxima provides
-  wxArrayString m_builtInLoadFiles;
+  /*! Build the lists of loadable and demo files from the index and publish them
+
+    Uses only the directory index, not the file system.
+  */
+  void PublishFileLists(wxString shareDir, wxString demoDir, wxString userDir);
+  //! The file the index of maxima's directories is cached in
+  static wxString FileIndexFile();
+  /*! The list of loadable files maxima provides
+
+    The lists are replaced as a whole by std::atomic_store(), never modified,
+    so they can be read with std::atomic_load() without taking a lock.
+  */
+  std::shared_ptr<wxArrayString> m_builtInLoadFiles;
   //! The list of demo files maxima provides
-  wxArrayString m_builtInDemoFiles;
+  std::shared_ptr<wxArrayString> m_builtInDemoFiles;
+  //! Which files maxima's directories contain. Only used by LoadSymbols_BackgroundTask().
+  DirectoryIndex m_fileIndex;
+  //! Has the index been read from FileIndexFile() already?
+  bool m_fileIndexLoaded;
 
   //! Scans the maxima directory for a list of loadable files
   class GetGeneralFiles : public wxDirTraverser
@@ -0,0 +1,567 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+
+/*! \file
+
+  This file defines the class AutosaveJournal that allows autosaves to only write what has changed.
+ */
+
+#include "AutosaveJournal.h"
+#include "ErrorRedirector.h"
+#include "Version.h"
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include <wx/tokenzr.h>
+#include <wx/wfstream.h>
+#include <wx/zipstrm.h>
+#include <memory>
+#include <set>
+
+//! The first line of each journal file
+#define JOURNAL_MAGIC "wxMaxima autosave journal 1"
+
+//! Journals smaller than this are never merged into their .wxmx file before it is closed
+#define JOURNAL_MIN_COMPACTION_SIZE (4 * 1024 * 1024)
+
+AutosaveJournal::AutosaveJournal() :
+  m_nextCellId(0),
+  m_imageCounter(0),
+  m_compacting(false)
+{
+}
+
+AutosaveJournal::~AutosaveJournal()
+{
+  WaitForCompaction();
+}
+
+void AutosaveJournal::WaitForCompaction()
+{
+  #ifdef HAVE_OPENMP_TASKS
+  if(m_compacting)
+  {
+    #pragma omp taskwait
+  }
+  #endif
+}
+
+bool AutosaveJournal::Recover(const wxString &wxmxFile)
+{
+  if(!wxFileExists(JournalName(wxmxFile)))
+    return true;
+
+  wxLogMessage(wxString::Format(_("Merging the autosave journal into %s"), wxmxFile.utf8_str()));
+  if(!Compact(wxmxFile))
+    return false;
+  Remove(wxmxFile);
+  return true;
+}
+
+void AutosaveJournal::Remove(const wxString &wxmxFile)
+{
+  wxString journalName = JournalName(wxmxFile);
+  if(wxFileExists(journalName))
+  {
+    SuppressErrorDialogs logNull;
+    wxLogMessage(wxString::Format(_("Trying to remove the autosave journal %s"), journalName.utf8_str()));
+    wxRemoveFile(journalName);
+  }
+}
+
+void AutosaveJournal::Start(const wxString &wxmxFile,
+                            const std::vector<Cell::CellPointers::WXMXFile> &files,
+                            int imageCounter)
+{
+  Reset();
+  Remove(wxmxFile);
+  m_wxmxFile = wxmxFile;
+  m_imageCounter = imageCounter;
+  for(std::vector<Cell::CellPointers::WXMXFile>::const_iterator it = files.begin();
+      it != files.end(); ++it)
+  {
+    m_knownFiles[it->m_name] = it->m_data;
+    m_knownImages[it->m_data.GetData()] = it->m_name;
+    m_documentFiles.push_back(it->m_name);
+  }
+}
+
+void AutosaveJournal::Reset()
+{
+  WaitForCompaction();
+  m_wxmxFile = wxEmptyString;
+  m_knownFiles.clear();
+  m_knownImages.clear();
+  m_knownCells.clear();
+  m_nextCellId = 0;
+  m_imageCounter = 0;
+  m_documentCells.clear();
+  m_documentFiles.clear();
+}
+
+bool AutosaveJournal::CanAppend(const wxString &wxmxFile) const
+{
+  return (!m_compacting) && (!m_wxmxFile.IsEmpty()) &&
+    (m_wxmxFile == wxmxFile) && wxFileExists(m_wxmxFile);
+}
+
+bool AutosaveJournal::WriteMagic(wxFile &file)
+{
+  const char magic[] = JOURNAL_MAGIC "\n";
+  return file.Write(magic, sizeof(magic) - 1) == sizeof(magic) - 1;
+}
+
+bool AutosaveJournal::WriteRecord(wxFile &file, char type, const wxString &argument,
+                                  const void *data, size_t length)
+{
+  wxString header = wxString::Format(wxT("%c %lu"), type, (unsigned long)length);
+  if(!argument.IsEmpty())
+    header += wxT(" ") + argument;
+  header += wxT("\n");
+  wxScopedCharBuffer headerUtf8 = header.utf8_str();
+  return (file.Write(headerUtf8.data(), headerUtf8.length()) == headerUtf8.length()) &&
+    (file.Write(data, length) == length) &&
+    (file.Write("\n", 1) == 1);
+}
+
+bool AutosaveJournal::Append(const wxString &header, const std::vector<wxString> &cells,
+                             const std::vector<Cell::CellPointers::WXMXFile> &files,
+                             int imageCounter)
+{
+  if(!CanAppend(m_wxmxFile))
+    return false;
+
+  // write_append creates the file if it doesn't exist yet.
+  wxFile journal;
+  if(!journal.Open(JournalName(m_wxmxFile), wxFile::write_append))
+    return false;
+  bool ok = true;
+  if(journal.Length() == 0)
+    ok = WriteMagic(journal);
+
+  // Store the files that the .wxmx file and the journal don't contain yet.
+  // An image that is used twice is listed twice, but needs to be stored only once.
+  std::map<wxString, const Cell::CellPointers::WXMXFile *> documentFiles;
+  for(std::vector<Cell::CellPointers::WXMXFile>::const_iterator it = files.begin();
+      it != files.end(); ++it)
+    documentFiles[it->m_name] = &(*it);
+
+  // The files are recognized by the address of the buffer they share with their
+  // cell. For gnuplot's files that is the compressed buffer: It is the only one
+  // that stays the same between two autosaves.
+  std::map<wxString, wxMemoryBuffer> newFiles;
+  wxString fileList;
+  for(std::map<wxString, const Cell::CellPointers::WXMXFile *>::const_iterator it = documentFiles.begin();
+      it != documentFiles.end(); ++it)
+  {
+    fileList += it->first + wxT("\n");
+    const wxMemoryBuffer &identity = it->second->m_data;
+    std::map<wxString, wxMemoryBuffer>::const_iterator known = m_knownFiles.find(it->first);
+    if((known != m_knownFiles.end()) && (known->second.GetData() == identity.GetData()))
+      continue;
+    if(ok)
+    {
+      wxMemoryBuffer data = it->second->Data();
+      ok = WriteRecord(journal, 'F', it->first, data.GetData(), data.GetDataLen());
+    }
+    newFiles[it->first] = identity;
+  }
+
+  // Store the cells that have changed
+  std::unordered_map<std::string, long> newCells;
+  std::vector<long> documentCells;
+  wxString cellList;
+  for(std::vector<wxString>::const_iterator it = cells.begin(); it != cells.end(); ++it)
+  {
+    wxScopedCharBuffer utf8 = it->utf8_str();
+    std::string xml(utf8.data(), utf8.length());
+    long id;
+    std::unordered_map<std::string, long>::const_iterator known = m_knownCells.find(xml);
+    if(known != m_knownCells.end())
+      id = known->second;
+    else
+    {
+      known = newCells.find(xml);
+      if(known != newCells.end())
+        id = known->second;
+      else
+      {
+        id = m_nextCellId + (long)newCells.size();
+        if(ok)
+          ok = WriteRecord(journal, 'C', wxString::Format(wxT("%li"), id), xml.data(), xml.length());
+        newCells[xml] = id;
+      }
+    }
+    documentCells.push_back(id);
+    cellList += wxString::Format(wxT("%li "), id);
+  }
+
+  // The document record makes the records we have written part of the document
+  wxScopedCharBuffer headerUtf8 = header.utf8_str();
+  wxScopedCharBuffer documentUtf8 = (cellList + wxT("\n") + fileList).utf8_str();
+  if(ok)
+    ok = WriteRecord(journal, 'H', wxEmptyString, headerUtf8.data(), headerUtf8.length()) &&
+      WriteRecord(journal, 'D', wxEmptyString, documentUtf8.data(), documentUtf8.length());
+  if(!journal.Close())
+    ok = false;
+  if(!ok)
+    return false;
+
+  // Everything is stored => remember that we don't need to store it again.
+  for(std::map<wxString, wxMemoryBuffer>::const_iterator it = newFiles.begin();
+      it != newFiles.end(); ++it)
+  {
+    std::map<wxString, wxMemoryBuffer>::iterator known = m_knownFiles.find(it->first);
+    if(known != m_knownFiles.end())
+      m_knownImages.erase(known->second.GetData());
+    m_knownFiles[it->first] = it->second;
+    m_knownImages[it->second.GetData()] = it->first;
+  }
+  m_knownCells.insert(newCells.begin(), newCells.end());
+  m_nextCellId += (long)newCells.size();
+  m_imageCounter = imageCounter;
+  m_documentCells.swap(documentCells);
+  m_documentFiles.clear();
+  for(std::map<wxString, const Cell::CellPointers::WXMXFile *>::const_iterator it = documentFiles.begin();
+      it != documentFiles.end(); ++it)
+    m_documentFiles.push_back(it->first);
+  return true;
+}
+
+void AutosaveJournal::CompactIfNeeded()
+{
+  if(m_compacting || m_wxmxFile.IsEmpty())
+    return;
+
+  wxString journalName = JournalName(m_wxmxFile);
+  if(!wxFileExists(journalName))
+    return;
+  wxULongLong journalSize = wxFileName::GetSize(journalName);
+  wxULongLong wxmxSize = wxFileName::GetSize(m_wxmxFile);
+  if((journalSize == wxInvalidSize) || (wxmxSize == wxInvalidSize))
+    return;
+  if((journalSize.GetValue() < JOURNAL_MIN_COMPACTION_SIZE) ||
+     (journalSize.GetValue() < wxmxSize.GetValue() / 2))
+    return;
+
+  // After compacting the .wxmx file only contains the files the current
+  // document refers to and the journal only its cells.
+  std::set<wxString> documentFiles(m_documentFiles.begin(), m_documentFiles.end());
+  for(std::map<wxString, wxMemoryBuffer>::iterator it = m_knownFiles.begin();
+      it != m_knownFiles.end();)
+  {
+    if(documentFiles.find(it->first) == documentFiles.end())
+    {
+      m_knownImages.erase(it->second.GetData());
+      it = m_knownFiles.erase(it);
+    }
+    else
+      ++it;
+  }
+  std::set<long> documentCells(m_documentCells.begin(), m_documentCells.end());
+  for(std::unordered_map<std::string, long>::iterator it = m_knownCells.begin();
+      it != m_knownCells.end();)
+  {
+    if(documentCells.find(it->second) == documentCells.end())
+      it = m_knownCells.erase(it);
+    else
+      ++it;
+  }
+
+  m_compacting = true;
+  wxLogMessage(wxString::Format(_("Starting background thread that merges the autosave journal into %s"),
+                                m_wxmxFile.utf8_str()));
+  wxString wxmxFile = m_wxmxFile;
+  #ifdef HAVE_OPENMP_TASKS
+  #pragma omp task
+  #endif
+  Compact_Backgroundtask(wxmxFile);
+}
+
+void AutosaveJournal::Compact_Backgroundtask(wxString wxmxFile)
+{
+  Compact(wxmxFile);
+  m_compacting = false;
+}
+
+//! Reads a line from a journal file. Returns false on EOF or if the line is too long.
+static bool ReadLine(wxFFile &file, std::string &line)
+{
+  line.clear();
+  char c;
+  while(file.Read(&c, 1) == 1)
+  {
+    if(c == '\n')
+      return true;
+    line += c;
+    if(line.length() > 4096)
+      return false;
+  }
+  return false;
+}
+
+bool AutosaveJournal::Read(const wxString &journalName, Contents &contents)
+{
+  wxFFile journal(journalName, wxT("rb"));
+  if(!journal.IsOpened())
+    return false;
+  wxFileOffset journalLength = journal.Length();
+
+  std::string line;
+  if((!ReadLine(journal, line)) || (line != JOURNAL_MAGIC))
+    return false;
+
+  // The records that become valid as soon as a D record follows them
+  std::map<wxString, Contents::FileRecord> files;
+  std::string header;
+
+  bool ok = true;
+  while(ok && ReadLine(journal, line))
+  {
+    wxString recordHeader = wxString::FromUTF8(line.c_str(), line.length());
+    if((recordHeader.Length() < 3) || (recordHeader[1] != wxT(' ')))
+      break;
+    wxChar type = recordHeader[0];
+    wxString argument = recordHeader.Mid(2).AfterFirst(wxT(' '));
+    unsigned long length;
+    if(!recordHeader.Mid(2).BeforeFirst(wxT(' ')).ToULong(&length))
+      break;
+
+    // A record the last autosave couldn't finish
+    wxFileOffset offset = journal.Tell();
+    if(offset + (wxFileOffset)length + 1 > journalLength)
+      break;
+
+    std::string data;
+    if(type == wxT('F'))
+    {
+      // Files can be big => We only remember where to find them.
+      Contents::FileRecord record;
+      record.m_offset = offset;
+      record.m_length = length;
+      files[argument] = record;
+      ok = journal.Seek(length, wxFromCurrent);
+    }
+    else
+    {
+      data.resize(length);
+      if(length > 0)
+        ok = (journal.Read(&data[0], length) == length);
+    }
+    char terminator;
+    if((!ok) || (journal.Read(&terminator, 1) != 1) || (terminator != '\n'))
+      break;
+
+    switch(type)
+    {
+    case wxT('F'):
+      break;
+    case wxT('C'):
+    {
+      long id;
+      if(argument.ToLong(&id))
+        contents.m_cells[id] = data;
+      else
+        ok = false;
+      break;
+    }
+    case wxT('H'):
+      header = data;
+      break;
+    case wxT('D'):
+    {
+      // The first line lists the cells, the following ones the files.
+      std::vector<long> documentCells;
+      std::vector<wxString> documentFiles;
+      wxStringTokenizer lines(wxString::FromUTF8(data.c_str(), data.length()),
+                              wxT("\n"), wxTOKEN_RET_EMPTY);
+      wxStringTokenizer ids(lines.GetNextToken(), wxT(" "));
+      while(ok && ids.HasMoreTokens())
+      {
+        long id;
+        ok = ids.GetNextToken().ToLong(&id) &&
+          (contents.m_cells.find(id) != contents.m_cells.end());
+        documentCells.push_back(id);
+      }
+      while(lines.HasMoreTokens())
+      {
+        wxString file = lines.GetNextToken();
+        if(!file.IsEmpty())
+          documentFiles.push_back(file);
+      }
+      if(ok)
+      {
+        for(std::map<wxString, Contents::FileRecord>::const_iterator it = files.begin();
+            it != files.end(); ++it)
+          contents.m_files[it->first] = it->second;
+        files.clear();
+        contents.m_header = header;
+        contents.m_document = data;
+        contents.m_documentCells.swap(documentCells);
+        contents.m_documentFiles.swap(documentFiles);
+        contents.m_valid = true;
+      }
+      break;
+    }
+    default:
+      ok = false;
+    }
+  }
+  return true;
+}
+
+bool AutosaveJournal::Compact(const wxString &wxmxFile)
+{
+  wxString journalName = JournalName(wxmxFile);
+  Contents contents;
+  if(!Read(journalName, contents))
+    return false;
+
+  // Without a complete document the journal contains nothing the .wxmx file lacks.
+  if(!contents.m_valid)
+    return true;
+
+  wxString compactedFile = wxmxFile + wxT("~journal");
+  wxString compactedJournal = journalName + wxT("~");
+  if((!WriteCompactedWXMX(wxmxFile, compactedFile, journalName, contents)) ||
+     (!WriteCompactedJournal(compactedJournal, contents)))
+  {
+    SuppressErrorDialogs logNull;
+    if(wxFileExists(compactedFile))
+      wxRemoveFile(compactedFile);
+    if(wxFileExists(compactedJournal))
+      wxRemoveFile(compactedJournal);
+    return false;
+  }
+
+  // If we crash between the two renames the old journal still is valid as the
+  // new .wxmx file contains all files the old journal's document refers to.
+  if(!wxRenameFile(compactedFile, wxmxFile, true))
+    return false;
+  return wxRenameFile(compactedJournal, journalName, true);
+}
+
+bool AutosaveJournal::WriteCompactedWXMX(const wxString &wxmxFile, const wxString &compactedFile,
+                                         const wxString &journalName, const Contents &contents)
+{
+  wxFFileInputStream in(wxmxFile);
+  if(!in.IsOk())
+    return false;
+  wxZipInputStream oldWxmx(in);
+  wxFFile journal(journalName, wxT("rb"));
+  if(!journal.IsOpened())
+    return false;
+
+  wxFFileOutputStream out(compactedFile);
+  if(!out.IsOk())
+    return false;
+  {
+    wxZipOutputStream zip(out);
+    if(!zip.IsOk())
+      return false;
+    zip.SetLevel(0);
+
+    // Copy the files of the old .wxmx file the document still needs without
+    // recompressing them and replace its content.xml.
+    std::set<wxString> documentFiles(contents.m_documentFiles.begin(), contents.m_documentFiles.end());
+    std::unique_ptr<wxZipEntry> entry;
+    for(entry.reset(oldWxmx.GetNextEntry()); entry; entry.reset(oldWxmx.GetNextEntry()))
+    {
+      wxString name = entry->GetInternalName();
+      if(name == wxT("content.xml"))
+      {
+        zip.SetLevel(0);
+        zip.PutNextEntry(wxT("content.xml"));
+        zip.Write(contents.m_header.data(), contents.m_header.length());
+        for(std::vector<long>::const_iterator it = contents.m_documentCells.begin();
+            it != contents.m_documentCells.end(); ++it)
+        {
+          const std::string &cell = contents.m_cells.find(*it)->second;
+          zip.Write(cell.data(), cell.length());
+        }
+        const char footer[] = "\n</wxMaximaDocument>";
+        zip.Write(footer, sizeof(footer) - 1);
+        zip.CloseEntry();
+      }
+      else if((name == wxT("mimetype")) || (name == wxT("format.txt")) ||
+              ((documentFiles.find(name) != documentFiles.end()) &&
+               (contents.m_files.find(name) == contents.m_files.end())))
+      {
+        if(!zip.CopyEntry(entry.release(), oldWxmx))
+          return false;
+      }
+    }
+
+    // Add the files that are only contained in the journal
+    for(std::vector<wxString>::const_iterator it = contents.m_documentFiles.begin();
+        it != contents.m_documentFiles.end(); ++it)
+    {
+      std::map<wxString, Contents::FileRecord>::const_iterator record = contents.m_files.find(*it);
+      if(record == contents.m_files.end())
+        continue;
+      wxMemoryBuffer data;
+      if((!journal.Seek(record->second.m_offset)) ||
+         (journal.Read(data.GetWriteBuf(record->second.m_length), record->second.m_length) !=
+          record->second.m_length))
+        return false;
+      data.UngetWriteBuf(record->second.m_length);
+
+      // The same rule ExportToWXMX() uses: Only gnuplot's data is worth compressing.
+      if(it->EndsWith(wxT(".data")))
+        zip.SetLevel(9);
+      else
+        zip.SetLevel(0);
+      zip.PutNextEntry(*it);
+      zip.Write(data.GetData(), data.GetDataLen());
+      zip.CloseEntry();
+    }
+    if(!zip.Close())
+      return false;
+  }
+  return out.Close();
+}
+
+bool AutosaveJournal::WriteCompactedJournal(const wxString &journalName, const Contents &contents)
+{
+  wxFile journal;
+  if(!journal.Open(journalName, wxFile::write))
+    return false;
+  bool ok = WriteMagic(journal);
+
+  // The new journal keeps the ids of the cells: wxMaxima still uses them.
+  std::set<long> written;
+  for(std::vector<long>::const_iterator it = contents.m_documentCells.begin();
+      it != contents.m_documentCells.end(); ++it)
+  {
+    if(!written.insert(*it).second)
+      continue;
+    const std::string &cell = contents.m_cells.find(*it)->second;
+    if(ok)
+      ok = WriteRecord(journal, 'C', wxString::Format(wxT("%li"), *it), cell.data(), cell.length());
+  }
+  if(ok)
+    ok = WriteRecord(journal, 'H', wxEmptyString, contents.m_header.data(), contents.m_header.length()) &&
+      WriteRecord(journal, 'D', wxEmptyString, contents.m_document.data(), contents.m_document.length());
+  if(!journal.Close())
+    ok = false;
+  return ok;
+}
@@ -0,0 +1,195 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+
+/*! \file
+
+  This file declares the class AutosaveJournal that allows autosaves to only write what has changed.
+ */
+
+#ifndef AUTOSAVEJOURNAL_H
+#define AUTOSAVEJOURNAL_H
+
+#include <wx/wx.h>
+#include <wx/file.h>
+#include <atomic>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Cell.h"
+
+/*! An append-only journal of the changes since the last full autosave
+
+  Rewriting a big .wxmx file on every autosave means writing every image and
+  the whole content.xml again. Instead, after one full autosave the following
+  autosaves only append the cells and files that have changed to a journal
+  named <wxmx file>.journal:
+
+   - "F <length> <name>" records contain a file (image or gnuplot data) that
+     isn't stored in the .wxmx file yet.
+   - "C <length> <id>" records contain the XML of a GroupCell.
+   - "H <length>" records contain the start of content.xml up to and including
+     the <wxMaximaDocument> tag.
+   - "D <length>" records contain the ids of the cells the document consists
+     of in one line, followed by the names of the files it refers to, one per line.
+
+  Each header line is followed by <length> bytes of data and a newline. The last
+  complete D record together with the H record before it describes the current
+  document: A crash while writing a record therefore loses only that record.
+
+  When the journal has grown big enough it is merged into the .wxmx file in the
+  background. If wxMaxima crashes the journal is merged before the .wxmx file is
+  opened again by Recover().
+ */
+class AutosaveJournal
+{
+public:
+  AutosaveJournal();
+  //! Waits for the compaction to finish, if one is running
+  ~AutosaveJournal();
+
+  //! The name of the journal that belongs to a .wxmx file
+  static wxString JournalName(const wxString &wxmxFile){return wxmxFile + wxT(".journal");}
+
+  /*! Merge an eventual journal into its .wxmx file
+
+    Called before a .wxmx file is opened that still might have a journal as
+    wxMaxima has crashed before it could clean up.
+
+    \return false if there is a journal that cannot be merged.
+   */
+  static bool Recover(const wxString &wxmxFile);
+
+  //! Delete the journal of a .wxmx file, if there is one
+  static void Remove(const wxString &wxmxFile);
+
+  /*! Start a journal for a .wxmx file that has just been saved completely
+
+    \param wxmxFile The file that has been saved
+    \param files The images and other files it contains
+    \param imageCounter The number of the last image in the file
+   */
+  void Start(const wxString &wxmxFile, const std::vector<Cell::CellPointers::WXMXFile> &files,
+             int imageCounter);
+
+  //! Forget about the journal, for example as its .wxmx file is to be replaced
+  void Reset();
+
+  //! Can the next autosave of wxmxFile just append to this journal?
+  bool CanAppend(const wxString &wxmxFile) const;
+
+  //! Is the journal currently being merged into its .wxmx file?
+  bool IsCompacting() const {return m_compacting;}
+
+  //! The images that already are stored in the .wxmx file or in the journal
+  const Cell::CellPointers::WXMXKnownImages &KnownImages() const {return m_knownImages;}
+
+  //! The number of the last image that has been named
+  int ImageCounter() const {return m_imageCounter;}
+
+  /*! Append the changes to the journal
+
+    \param header The start of content.xml up to and including the <wxMaximaDocument> tag
+    \param cells The XML of each GroupCell of the document
+    \param files The files the cells refer to
+    \param imageCounter The number of the last image that has been named
+   */
+  bool Append(const wxString &header, const std::vector<wxString> &cells,
+              const std::vector<Cell::CellPointers::WXMXFile> &files, int imageCounter);
+
+  //! Merge the journal into its .wxmx file in the background if it has grown big
+  void CompactIfNeeded();
+
+private:
+  //! The contents of a journal file
+  struct Contents
+  {
+    Contents() : m_valid(false){}
+    //! Where the data of a file record is located in the journal
+    struct FileRecord
+    {
+      wxFileOffset m_offset;
+      size_t m_length;
+    };
+    //! The files in the journal, by their name. Later records replace earlier ones.
+    std::map<wxString, FileRecord> m_files;
+    //! The XML of the cells, by their id
+    std::map<long, std::string> m_cells;
+    //! The start of content.xml
+    std::string m_header;
+    //! The data of the last complete D record
+    std::string m_document;
+    //! The cells the document consists of
+    std::vector<long> m_documentCells;
+    //! The files the document refers to
+    std::vector<wxString> m_documentFiles;
+    //! Does the journal contain a complete document?
+    bool m_valid;
+  };
+
+  //! Read a journal file. Stops at the first incomplete record.
+  static bool Read(const wxString &journalName, Contents &contents);
+  //! Merge the journal into its .wxmx file and replace the journal by a shorter one
+  static bool Compact(const wxString &wxmxFile);
+  //! Write a new .wxmx file that contains what the journal describes
+  static bool WriteCompactedWXMX(const wxString &wxmxFile, const wxString &compactedFile,
+                                 const wxString &journalName, const Contents &contents);
+  //! Write a journal that contains only the records the current document needs
+  static bool WriteCompactedJournal(const wxString &journalName, const Contents &contents);
+  //! Append one record to a journal file
+  static bool WriteRecord(wxFile &file, char type, const wxString &argument,
+                          const void *data, size_t length);
+  //! Start a journal file
+  static bool WriteMagic(wxFile &file);
+
+  //! Merges the journal into the .wxmx file. Is run in a background thread.
+  void Compact_Backgroundtask(wxString wxmxFile);
+  //! Wait until a background compaction has finished
+  void WaitForCompaction();
+
+  //! The .wxmx file this journal belongs to. Empty = no journal.
+  wxString m_wxmxFile;
+  /*! The files that already are stored in the .wxmx file or the journal
+
+    Holds the buffers the cells share their files with, not the data that has been
+    written: For gnuplot's files these are the compressed buffers from the gnuplot
+    cache. Holding them keeps their addresses from being reused by other files.
+   */
+  std::map<wxString, wxMemoryBuffer> m_knownFiles;
+  //! The same files, by the address of their data
+  Cell::CellPointers::WXMXKnownImages m_knownImages;
+  //! The ids of the cell XML that is already stored in the journal
+  std::unordered_map<std::string, long> m_knownCells;
+  //! The id the next new cell gets
+  long m_nextCellId;
+  //! The number of the last image that has been named
+  int m_imageCounter;
+  //! The cells the last complete document in the journal consists of
+  std::vector<long> m_documentCells;
+  //! The files the last complete document in the journal refers to
+  std::vector<wxString> m_documentFiles;
+  //! Is the journal currently being merged into the .wxmx file?
+  std::atomic<bool> m_compacting;
+};
+
+#endif // AUTOSAVEJOURNAL_H
@@ -38,30 +38,32 @@ BitmapOut::BitmapOut(Configuration **configuration, int scale):
   m_scale = scale;
 
   m_configuration = configuration;
-  m_oldconfig = *m_configuration;
   m_bmp.CreateScaled(m_width = 10, m_height= 10, 24, scale);
   m_dc->SelectObject(m_bmp);
   m_dc->SetUserScale(m_scale, m_scale);
   m_dc->SetPen(wxNullPen);
   
-  *m_configuration = new Configuration(m_dc.get());
-  (*m_configuration)->ShowCodeCells(m_oldconfig->ShowCodeCells());
-  (*m_configuration)->SetZoomFactor_temporarily(1.0);
-  (*m_configuration)->SetClientWidth(BM_FULL_WIDTH);
-  (*m_configuration)->SetClientHeight(BM_FULL_WIDTH);
-  (*m_configuration)->RecalculationForce(true);
+  m_bitmapConfig = std::unique_ptr<Configuration>(new Configuration(m_dc.get()));
+  m_bitmapConfig->ShowCodeCells((*m_configuration)->ShowCodeCells());
+  m_bitmapConfig->SetZoomFactor_temporarily(1.0);
+  m_bitmapConfig->SetClientWidth(BM_FULL_WIDTH);
+  m_bitmapConfig->SetClientHeight(BM_FULL_WIDTH);
+  m_bitmapConfig->RecalculationForce(true);
 }
 
 BitmapOut::~BitmapOut()
 {
-  wxDELETE(*m_configuration);
-  *m_configuration = m_oldconfig;
+  {
+    ConfigurationSwap swap(*this);
+    m_tree.reset();
+  }
   (*m_configuration)->FontChanged(true);
   (*m_configuration)->RecalculationForce(true);
 }
 
 bool BitmapOut::SetData(Cell *tree, long int maxSize)
 {
+  ConfigurationSwap swap(*this);
   m_tree = std::unique_ptr<Cell>(tree);
   m_tree->ResetSize();
   return Layout(maxSize);
@@ -289,7 +291,7 @@ void BitmapOut::Draw()
   m_ppi.y *= m_scale;
 }
 
-wxSize BitmapOut::ToFile(wxString file)
+wxImage BitmapOut::ToImage() const
 {
   // Assign an resolution to the bitmap.
   wxImage img = m_bmp.ConvertToImage();
@@ -297,6 +299,12 @@ wxSize BitmapOut::ToFile(wxString file)
   if (resolution <= 0)
     resolution = 75;
   img.SetOption(wxIMAGE_OPTION_RESOLUTION, resolution * m_scale);
+  return img;
+}
+
+wxSize BitmapOut::ToFile(wxString file)
+{
+  wxImage img = ToImage();
 
   bool success = false;
   if (file.Right(4) == wxT(".bmp"))
@@ -65,6 +65,16 @@ public:
    */
   wxSize ToFile(wxString file);
 
+  /*! Returns the bitmap as an image with the right resolution information
+
+    Converting the image to a file format takes more time than rendering it,
+    but - unlike the rendering - can be done in a background task.
+   */
+  wxImage ToImage() const;
+
+  //! The size of the bitmap that was rendered by SetData() [in pixels]
+  wxSize GetSize() const {return wxSize(GetRealWidth(), GetRealHeight());}
+
   //! Returns the bitmap representation of the list of cells that was passed to SetData()
   wxBitmap GetBitmap() const
   { return m_bmp; }
@@ -104,8 +114,28 @@ protected:
   double GetRealWidth() const;
 
 private:
+  /*! Makes the cells use the bitmap's Configuration as long as it exists
+
+    The cells reach their Configuration through the worksheet's Configuration
+    pointer => we may only redirect it while we lay out and draw the cells:
+    Repaints or events between two SetData() calls need the worksheet's one.
+   */
+  class ConfigurationSwap
+  {
+  public:
+    explicit ConfigurationSwap(BitmapOut &out) :
+      m_configuration(out.m_configuration), m_oldconfig(*out.m_configuration)
+      { *m_configuration = out.m_bitmapConfig.get(); }
+    ~ConfigurationSwap(){ *m_configuration = m_oldconfig; }
+  private:
+    Configuration **m_configuration;
+    Configuration *m_oldconfig;
+  };
+
   std::unique_ptr<wxMemoryDC> m_dc;
-  Configuration **m_configuration, *m_oldconfig;
+  Configuration **m_configuration;
+  //! The Configuration the bitmap is rendered with
+  std::unique_ptr<Configuration> m_bitmapConfig;
   //! How many times the natural resolution do we want this bitmap to be?
   int m_scale;
   wxBitmap m_bmp;
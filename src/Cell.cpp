@@ -27,8 +27,10 @@
 */
 
 #include "Cell.h"
+#include <wx/mstream.h>
 #include <wx/regex.h>
 #include <wx/sstream.h>
+#include <wx/zstream.h>
 
 wxString Cell::GetToolTip(const wxPoint &point)
 {
@@ -47,7 +49,7 @@ wxString Cell::GetToolTip(const wxPoint &point)
       tmp = tmp -> m_next;
     }
   }
-  return m_toolTip;
+  return GetLocalToolTip();
 }
 
 Cell::Cell(Cell *group, Configuration **config, CellPointers *cellPointers)
@@ -164,8 +166,11 @@ void Cell::SetType(CellType type)
 
 void Cell::CopyCommonData(const Cell & cell)
 {
-  m_altCopyText = cell.m_altCopyText;
+  if(cell.m_altCopyText)
+    m_altCopyText = std::unique_ptr<wxString>(new wxString(*cell.m_altCopyText));
   m_toolTip = cell.m_toolTip;
+  if(cell.m_dataToolTip)
+    m_dataToolTip = std::unique_ptr<wxString>(new wxString(*cell.m_dataToolTip));
   m_forceBreakLine = cell.m_forceBreakLine;
   m_type = cell.m_type;
   m_textStyle = cell.m_textStyle;
@@ -412,7 +417,7 @@ void Cell::Draw(wxPoint point)
     SetCurrentPoint(point);
 
   // Mark all cells that contain tooltips
-  if(!m_toolTip.IsEmpty() && (GetStyle() != TS_LABEL) && (GetStyle() != TS_USERLABEL) &&
+  if(!GetLocalToolTip().IsEmpty() && (GetStyle() != TS_LABEL) && (GetStyle() != TS_USERLABEL) &&
      (*m_configuration)->ClipToDrawRegion() && !(*m_configuration)->GetPrinting())
   {
     wxRect rect = Cell::CropToUpdateRegion(GetRect());
@@ -435,11 +440,38 @@ void Cell::Draw(wxPoint point)
 #endif
 }
 
+void Cell::SetToolTip(const wxString &tooltip)
+{
+  if(tooltip.IsEmpty())
+    ClearToolTip();
+  else
+    m_dataToolTip = std::unique_ptr<wxString>(new wxString(tooltip));
+}
+
 void Cell::AddToolTip(const wxString &tip)
 {
-  if((!m_toolTip.IsEmpty()) && (!m_toolTip.EndsWith("\n")))
-    m_toolTip += "\n";
-  m_toolTip += tip;
+  wxString toolTip = GetLocalToolTip();
+  if((!toolTip.IsEmpty()) && (!toolTip.EndsWith("\n")))
+    toolTip += "\n";
+  toolTip += tip;
+  SetToolTip(toolTip);
+}
+
+void Cell::SetAltCopyText(wxString text)
+{
+  if(text.IsEmpty())
+    m_altCopyText.reset();
+  else
+    m_altCopyText = std::unique_ptr<wxString>(new wxString(text));
+}
+
+const wxString &Cell::GetAltCopyText() const
+{
+  static const wxString empty;
+  if(m_altCopyText)
+    return *m_altCopyText;
+  else
+    return empty;
 }
 void Cell::DrawList(wxPoint point)
 {
@@ -724,17 +756,23 @@ wxString Cell::ToTeX()
 wxString Cell::ListToTeX()
 {
   wxString retval;
+  AppendListTeX(retval);
+  return retval;
+}
+
+void Cell::AppendListTeX(wxString &out)
+{
+  size_t start = out.Length();
   Cell *tmp = this;
 
   while (tmp != NULL)
   {
-    if ((tmp->m_textStyle == TS_LABEL && retval != wxEmptyString) ||
-        (tmp->m_breakLine && retval != wxEmptyString))
-      retval += wxT("\\]\\[");
-    retval += tmp->ToTeX();
+    if ((tmp->m_textStyle == TS_LABEL && out.Length() > start) ||
+        (tmp->m_breakLine && out.Length() > start))
+      out += wxT("\\]\\[");
+    tmp->AppendTeX(out);
     tmp = tmp->m_next;
   }
-  return retval;
 }
 
 wxString Cell::ToXML()
@@ -749,9 +787,14 @@ wxString Cell::ToMathML()
 
 wxString Cell::ListToMathML(bool startofline)
 {
-  bool highlight = false;
-
   wxString retval;
+  AppendListMathML(retval, startofline);
+  return retval;
+}
+
+void Cell::AppendListMathML(wxString &out, bool startofline)
+{
+  bool highlight = false;
 
   // If the region to export contains linebreaks or labels we put it into a table.
   bool needsTable = false;
@@ -772,45 +815,51 @@ wxString Cell::ListToMathML(bool startofline)
   // group them into a single object.
   bool multiCell = (temp->m_next != NULL);
 
+  // If we put the region we export into a table or group multiple cells
+  // as a single object we need to start this table or group now
+  if (needsTable)
+    out += wxT("<mtable>\n<mlabeledtr columnalign=\"left\"><mtd>");
+  else if (multiCell)
+    out += wxT("<mrow>");
+
   // Export all cells
   while (temp != NULL)
   {
     // Do we need to end a highlighting region?
     if ((!temp->m_highlight) && (highlight))
-      retval += wxT("</mrow>");
+      out += wxT("</mrow>");
 
     // Handle linebreaks
     if ((temp != this) && (temp->HardLineBreak()))
-      retval += wxT("</mtd></mlabeledtr>\n<mlabeledtr columnalign=\"left\"><mtd>");
+      out += wxT("</mtd></mlabeledtr>\n<mlabeledtr columnalign=\"left\"><mtd>");
 
     // If a linebreak isn't followed by a label we need to introduce an empty one.
     if ((((temp->HardLineBreak()) || (startofline && (this == temp))) &&
          ((temp->GetStyle() != TS_LABEL) && (temp->GetStyle() != TS_USERLABEL))) && (needsTable))
-      retval += wxT("<mtext></mtext></mtd><mtd>");
+      out += wxT("<mtext></mtext></mtd><mtd>");
 
     // Do we need to start a highlighting region?
     if ((temp->m_highlight) && (!highlight))
-      retval += wxT("<mrow mathcolor=\"red\">");
+      out += wxT("<mrow mathcolor=\"red\">");
     highlight = temp->m_highlight;
 
 
-    retval += temp->ToMathML();
+    temp->AppendMathML(out);
     temp = temp->m_next;
   }
 
   // If the region we converted to MathML ended within a highlighted region
   // we need to close this region now.
   if (highlight)
-    retval += wxT("</mrow>");
+    out += wxT("</mrow>");
 
   // If we grouped multiple cells as a single object we need to cose this group now
   if ((multiCell) && (!needsTable))
-    retval = wxT("<mrow>") + retval + wxT("</mrow>\n");
+    out += wxT("</mrow>\n");
 
   // If we put the region we exported into a table we need to end this table now
   if (needsTable)
-    retval = wxT("<mtable>\n<mlabeledtr columnalign=\"left\"><mtd>") + retval + wxT("</mtd></mlabeledtr>\n</mtable>");
-  return retval;
+    out += wxT("</mtd></mlabeledtr>\n</mtable>");
 }
 
 wxString Cell::OMML2RTF(wxXmlNode *node)
@@ -928,10 +977,20 @@ wxString Cell::RTFescape(wxString input, bool MarkDown)
 }
 
 wxString Cell::ListToOMML(bool WXUNUSED(startofline))
+{
+  wxString retval;
+  AppendListOMML(retval);
+  return retval;
+}
+
+void Cell::AppendListOMML(wxString &out)
 {
   bool multiCell = (m_next != NULL);
 
-  wxString retval;
+  size_t start = out.Length();
+  if (multiCell)
+    out += wxT("<m:r>");
+  size_t contentsStart = out.Length();
 
   // If the region to export contains linebreaks or labels we put it into a table.
   // Export all cells
@@ -939,14 +998,13 @@ wxString Cell::ListToOMML(bool WXUNUSED(startofline))
   Cell *tmp = this;
   while (tmp != NULL)
   {
-    wxString token = tmp->ToOMML();
+    size_t tokenStart = out.Length();
+    tmp->AppendOMML(out);
 
     // End exporting the equation if we reached the end of the equation.
-    if (token == wxEmptyString)
+    if (out.Length() == tokenStart)
       break;
 
-    retval += token;
-
     // Hard linebreaks aren't supported by OMML and therefore need a new equation object
     if (tmp->HardLineBreak())
       break;
@@ -954,46 +1012,65 @@ wxString Cell::ListToOMML(bool WXUNUSED(startofline))
     tmp = tmp->m_next;
   }
 
-  if ((multiCell) && (retval != wxEmptyString))
-    return wxT("<m:r>") + retval + wxT("</m:r>");
-  else
-    return retval;
+  if (multiCell)
+  {
+    // An empty equation doesn't get a <m:r> tag
+    if (out.Length() == contentsStart)
+      out.Truncate(start);
+    else
+      out += wxT("</m:r>");
+  }
 }
 
 wxString Cell::ListToRTF(bool startofline)
 {
   wxString retval;
+  AppendListRTF(retval, startofline);
+  return retval;
+}
+
+void Cell::AppendListRTF(wxString &out, bool startofline)
+{
   Cell *tmp = this;
 
   while (tmp != NULL)
   {
-    wxString rtf = tmp->ToRTF();
+    wxString rtf;
+    tmp->AppendRTF(rtf);
     if (rtf != wxEmptyString)
     {
       if ((GetStyle() == TS_LABEL) || ((GetStyle() == TS_USERLABEL)))
       {
-        retval += wxT("\\par}\n{\\pard\\s22\\li1105\\lin1105\\fi-1105\\f0\\fs24 ") + rtf + wxT("\\tab");
+        out += wxT("\\par}\n{\\pard\\s22\\li1105\\lin1105\\fi-1105\\f0\\fs24 ");
+        out += rtf;
+        out += wxT("\\tab");
         startofline = false;
       }
       else
       {
         if (startofline)
-          retval += wxT("\\par}\n{\\pard\\s21\\li1105\\lin1105\\f0\\fs24 ") + rtf + wxT("\\n");
+        {
+          out += wxT("\\par}\n{\\pard\\s21\\li1105\\lin1105\\f0\\fs24 ");
+          out += rtf;
+          out += wxT("\\n");
+        }
         startofline = true;
       }
       tmp = tmp->m_next;
     }
     else
     {
-      if (tmp->ListToOMML() != wxEmptyString)
+      // OMML2RTF() needs to parse the whole equation => it cannot be appended piece-wise
+      wxString omml = tmp->ListToOMML();
+      if (omml != wxEmptyString)
       {
         // Math!
 
         // set the style for this line.
         if (startofline)
-          retval += wxT("\\pard\\s21\\li1105\\lin1105\\f0\\fs24 ");
+          out += wxT("\\pard\\s21\\li1105\\lin1105\\f0\\fs24 ");
 
-        retval += OMML2RTF(tmp->ListToOMML());
+        out += OMML2RTF(omml);
 
         startofline = true;
 
@@ -1020,7 +1097,6 @@ wxString Cell::ListToRTF(bool startofline)
       }
     }
   }
-  return retval;
 }
 
 void Cell::SelectPointText(const wxPoint &WXUNUSED(point)){}
@@ -1030,36 +1106,40 @@ void Cell::SelectRectText(const wxPoint &WXUNUSED(one), const wxPoint &WXUNUSED(
 void Cell::PasteFromClipboard(const bool &WXUNUSED(primary)){}
 
 wxString Cell::ListToXML()
+{
+  wxString retval;
+  AppendListXML(retval);
+  return retval;
+}
+
+void Cell::AppendListXML(wxString &out)
 {
   bool highlight = false;
 
-  wxString retval;
   Cell *tmp = this;
 
   while (tmp != NULL)
   {
     if ((tmp->GetHighlight()) && (!highlight))
     {
-      retval += wxT("<hl>\n");
+      out += wxT("<hl>\n");
       highlight = true;
     }
 
     if ((!tmp->GetHighlight()) && (highlight))
     {
-      retval += wxT("</hl>\n");
+      out += wxT("</hl>\n");
       highlight = false;
     }
 
-    retval += tmp->ToXML();
+    tmp->AppendXML(out);
     tmp = tmp->m_next;
   }
 
   if (highlight)
   {
-    retval += wxT("</hl>\n");
+    out += wxT("</hl>\n");
   }
-
-  return retval;
 }
 
 /***
@@ -1508,6 +1588,7 @@ Cell::CellPointers::CellPointers(wxScrolledCanvas *mathCtrl)
   m_scrollToCell = false;
   m_cellToScrollTo = NULL;
   m_wxmxImgCounter = 0;
+  m_wxmxKnownImages = NULL;
   m_mathCtrl = mathCtrl;
   m_cellMouseSelectionStartedIn = NULL;
   m_cellKeyboardSelectionStartedIn = NULL;
@@ -1531,6 +1612,38 @@ wxString Cell::CellPointers::WXMXGetNewFileName()
   return file;
 }
 
+wxMemoryBuffer Cell::CellPointers::WXMXFile::Data() const
+{
+  if(!m_compressed)
+    return m_data;
+
+  wxMemoryBuffer retval;
+  wxMemoryInputStream mstream(m_data.GetData(), m_data.GetDataLen());
+  wxZlibInputStream zstream(mstream);
+  char buf[65536];
+  while(zstream.IsOk() && !zstream.Eof())
+  {
+    zstream.Read(buf, sizeof(buf));
+    retval.AppendData(buf, zstream.LastRead());
+  }
+  return retval;
+}
+
+wxString Cell::CellPointers::WXMXAddImage(const wxMemoryBuffer &data, const wxString &extension)
+{
+  wxString name;
+  if(m_wxmxKnownImages != NULL)
+  {
+    WXMXKnownImages::const_iterator known = m_wxmxKnownImages->find(data.GetData());
+    if(known != m_wxmxKnownImages->end())
+      name = known->second;
+  }
+  if(name.IsEmpty())
+    name = WXMXGetNewFileName() + extension;
+  WXMXAddFile(name, data);
+  return name;
+}
+
 bool Cell::CellPointers::ErrorList::Contains(Cell *cell)
 {
   for(std::list<Cell *>::const_iterator it = m_errorList.begin(); it != m_errorList.end();++it)
@@ -29,6 +29,8 @@
 #define MATHCELL_H
 
 #include <list>
+#include <vector>
+#include <unordered_map>
 #include <wx/wx.h>
 #include <wx/xml/xml.h>
 #if wxUSE_ACCESSIBILITY
@@ -38,6 +40,7 @@
 #endif // wxUSE_ACCESSIBILITY
 #include "Configuration.h"
 #include "TextStyle.h"
+#include "InternedString.h"
 #include <memory>
 
 /*! The supported types of math cells
@@ -140,14 +143,71 @@ class Cell
         m_workingGroup = group;
       }
     
-    void WXMXResetCounter()
-      { m_wxmxImgCounter = 0; }
+    /*! Prepare for a new .wxmx file: Reset the image counter and forget the files scheduled for saving
+
+      \param imageCounter The number of the last image that already has been
+                          named, for example by an earlier incremental autosave.
+     */
+    void WXMXResetCounter(int imageCounter = 0)
+      { m_wxmxImgCounter = imageCounter; m_wxmxFiles.clear(); }
     
     wxString WXMXGetNewFileName();
     
     int WXMXImageCount() const
       { return m_wxmxImgCounter; }
 
+    //! A file that is to be added to the .wxmx file that is currently being written
+    struct WXMXFile
+    {
+      WXMXFile(const wxString &name, const wxMemoryBuffer &data, bool compressed) :
+        m_name(name), m_data(data), m_compressed(compressed){}
+      /*! The file's contents, uncompressed if necessary
+
+        For uncompressed files this is another reference to m_data. As
+        wxMemoryBuffer's reference counter isn't thread-safe background threads
+        must use m_data directly for these files.
+       */
+      wxMemoryBuffer Data() const;
+      wxString m_name;
+      /*! Shares the (reference-counted) data with the cell that owns it
+
+        As long as the file doesn't change its address therefore identifies it.
+       */
+      wxMemoryBuffer m_data;
+      //! Is m_data zlib-compressed and needs to be uncompressed before it is written?
+      bool m_compressed;
+    };
+
+    /*! Schedule a file for being stored in the .wxmx file that is being written
+
+      The data isn't copied: wxMemoryBuffer shares it with the image it belongs to.
+      \param compressed true = data is zlib-compressed and is uncompressed only
+                        when the file is actually written.
+     */
+    void WXMXAddFile(const wxString &name, const wxMemoryBuffer &data, bool compressed = false)
+      { if(data.GetDataLen() > 0) m_wxmxFiles.push_back(WXMXFile(name, data, compressed)); }
+
+    //! The files ToXML() has scheduled for being stored in the .wxmx file
+    const std::vector<WXMXFile> &WXMXFiles() const
+      { return m_wxmxFiles; }
+
+    //! The names of images that are already stored, by the address of their data
+    typedef std::unordered_map<const void *, wxString> WXMXKnownImages;
+
+    /*! Tell which images are already stored in the file that is being written
+
+      Set by incremental autosaves, NULL means: None.
+     */
+    void WXMXSetKnownImages(const WXMXKnownImages *images)
+      { m_wxmxKnownImages = images; }
+
+    /*! Schedule an image for being stored in the .wxmx file and return its name in there
+
+      An image that already has been stored (see WXMXSetKnownImages()) keeps its
+      old name.
+     */
+    wxString WXMXAddImage(const wxMemoryBuffer &data, const wxString &extension);
+
     //! A list of editor cells containing error messages.
     class ErrorList
     {
@@ -263,6 +323,10 @@ class Cell
     wxScrolledCanvas *m_mathCtrl;
     //! The image counter for saving .wxmx files
     int m_wxmxImgCounter;
+    //! The files that are to be stored in the .wxmx file that is being written
+    std::vector<WXMXFile> m_wxmxFiles;
+    //! The images that already have been stored or NULL
+    const WXMXKnownImages *m_wxmxKnownImages;
   };
 
 
@@ -301,7 +365,17 @@ class Cell
   virtual wxAccStatus GetRole (int childId, wxAccRole *role);
 #endif
   
-  wxString m_toolTip;
+  //! Few different fixed tooltips exist => all cells with the same tooltip share it
+  InternedString m_toolTip;
+  /*! A tooltip that depends on the data this cell contains
+
+    Overrides m_toolTip, if set. Is not interned as it is seldom shared.
+   */
+  std::unique_ptr<wxString> m_dataToolTip;
+
+  //! The tooltip this cell itself carries, without looking at its inner cells
+  const wxString &GetLocalToolTip() const
+    {return m_dataToolTip ? *m_dataToolTip : m_toolTip;}
 
   /*! Returns the ToolTip this cell provides.
 
@@ -749,6 +823,40 @@ class Cell
   //! Convert this cell to an representation fit for saving in a .wxmx file
   virtual wxString ToMathML();
 
+  /*! \name Appending the cell's representation to a buffer
+
+    The ToXXX() and ListToXXX() functions return a new string that their
+    caller appends to its own one. For deeply nested output this means that
+    every level copies everything its sub-cells have generated. The functions
+    in this group instead append their output to the buffer they are passed
+    so the whole tree is written to a single string.
+
+    Unless a cell overrides AppendXXX() it appends the result of ToXXX().
+   */
+  //!@{
+  //! Append this list's LaTeX representation to out
+  void AppendListTeX(wxString &out);
+  //! Append this list's representation fit for saving in a .wxmx file to out
+  void AppendListXML(wxString &out);
+  //! Append this list's MathML representation to out
+  void AppendListMathML(wxString &out, bool startofline = false);
+  //! Append this list's OMML representation to out
+  void AppendListOMML(wxString &out);
+  //! Append this list's RTF representation to out
+  void AppendListRTF(wxString &out, bool startofline = false);
+
+  //! Append this cell's LaTeX representation to out
+  virtual void AppendTeX(wxString &out){out += ToTeX();}
+  //! Append this cell's representation fit for saving in a .wxmx file to out
+  virtual void AppendXML(wxString &out){out += ToXML();}
+  //! Append this cell's MathML representation to out
+  virtual void AppendMathML(wxString &out){out += ToMathML();}
+  //! Append this cell's OMML representation to out
+  virtual void AppendOMML(wxString &out){out += ToOMML();}
+  //! Append this cell's RTF representation to out
+  virtual void AppendRTF(wxString &out){out += ToRTF();}
+  //!@}
+
   //! Escape a string for RTF
   static wxString RTFescape(wxString, bool MarkDown = false);
 
@@ -962,8 +1070,17 @@ class Cell
   //! Copy common data (used when copying a cell)
   void CopyCommonData(const Cell & cell);
   
-  void SetAltCopyText(wxString text)
-  { m_altCopyText = text; }
+  void SetAltCopyText(wxString text);
+
+  //! The text that should end up on the clipboard if this cell is copied as text
+  const wxString &GetAltCopyText() const;
+
+  /*! The number of bytes this cell occupies in memory
+
+    Doesn't include the memory of the cells that follow this one or of its
+    sub-cells, nor of strings it shares with other cells.
+   */
+  virtual size_t GetMemoryUsage() const = 0;
 
   /*! Attach a copy of the list of cells that follows this one to a cell
     
@@ -982,9 +1099,11 @@ class Cell
   bool m_SuppressMultiplicationDot;
 
   //! Remove this cell's tooltip
-  void ClearToolTip(){m_toolTip = wxEmptyString;}
+  void ClearToolTip(){m_toolTip = InternedString(); m_dataToolTip.reset();}
   //! Set the tooltip of this math cell. wxEmptyString means: no tooltip.
-  void SetToolTip(const wxString &tooltip){m_toolTip = tooltip;}
+  void SetToolTip(const wxString &tooltip);
+  //! Set the tooltip of this cell to one of the few fixed tooltips
+  void SetToolTip(const InternedString &tooltip){m_toolTip = tooltip; m_dataToolTip.reset();}
   //! Add another tooltip to this cell
   void AddToolTip(const wxString &tip);
   void SetCurrentPoint(wxPoint point){m_currentPoint = point;
@@ -1038,9 +1157,11 @@ protected:
   bool m_highlight;
   /* Text that should end up on the clipboard if this cell is copied as text.
 
+     Only few cells have one => it is only allocated if needed.
+
      \attention  m_altCopyText is not check in all cell types!
   */
-  wxString m_altCopyText;
+  std::unique_ptr<wxString> m_altCopyText;
   Configuration **m_configuration;
 
   virtual std::list<std::shared_ptr<Cell>> GetInnerCells();
@@ -303,6 +303,8 @@ void ConfigDialogue::SetProperties()
   m_openHCaret->SetToolTip(_("If this checkbox is set a new code cell is opened as soon as maxima requests data. If it isn't set a new code cell is opened in this case as soon as the user starts typing in code."));
   m_restartOnReEvaluation->SetToolTip(
           _("Maxima provides no \"forget all\" command that flushes all settings a maxima session could make. wxMaxima therefore normally defaults to starting a fresh maxima process every time the worksheet is to be re-evaluated. As this needs a little bit of time this switch allows to disable this behavior."));
+  m_compileWxMathML->SetToolTip(
+          _("On each start wxMaxima sends maxima the lisp code maxima needs for talking to wxMaxima. If this checkbox is set, maxima compiles this code once and the next time maxima is started it loads the compiled version of it, which is faster. The compiled code is stored in wxMaxima's data directory."));
   m_maximaUserLocation->SetToolTip(_("Enter the path to the Maxima executable."));
   m_additionalParameters->SetToolTip(_("Additional parameters for Maxima"
                                                " (e.g. -l clisp)."));
@@ -314,6 +316,9 @@ void ConfigDialogue::SetProperties()
           _("If this checkbox is checked wxMaxima automatically saves the file closing and every few minutes giving wxMaxima a more cellphone-app-like feel as the file is virtually always saved. If this checkbox is unchecked from time to time a backup is made in the temp folder instead."));
   m_defaultFramerate->SetToolTip(_("Define the default speed (in frames per second) animations are played back with."));
   m_maxGnuplotMegabytes->SetToolTip(_("wxMaxima normally stores the gnuplot sources for every plot made using draw() in order to be able to open plots interactively in gnuplot later. This setting defines the limit [in Megabytes per plot] for this feature."));
+  m_animationJobs->SetToolTip(_("The frames of animations made using wxanimate_draw() or with_slider_draw() are rendered by this many gnuplot processes in parallel and are displayed as soon as they are ready. 1 = maxima renders the frames one after another."));
+  m_xmlInspectorMaxKilobytes->SetToolTip(_("The raw XML monitor only keeps the most recent part of the communication with maxima. This setting defines how much of it [in kilobytes] it keeps."));
+  m_exportCacheMegabytes->SetToolTip(_("Exports store the images they render equations to in a cache so the next export of an unchanged cell doesn't need to render it again. This setting limits the size of this cache [in Megabytes]. 0 disables the cache."));
   m_defaultPlotWidth->SetToolTip(
           _("The default width for embedded plots. Can be read out or overridden by the maxima variable wxplot_size"));
   m_defaultPlotHeight->SetToolTip(
@@ -480,8 +485,12 @@ void ConfigDialogue::SetProperties()
   m_keepPercentWithSpecials->SetValue(keepPercent);
   m_abortOnError->SetValue(configuration->GetAbortOnError());
   m_restartOnReEvaluation->SetValue(configuration->RestartOnReEvaluation());
+  m_compileWxMathML->SetValue(configuration->CompileWxMathML());
   m_defaultFramerate->SetValue(defaultFramerate);
   m_maxGnuplotMegabytes->SetValue(configuration->MaxGnuplotMegabytes());
+  m_animationJobs->SetValue(configuration->AnimationJobs());
+  m_xmlInspectorMaxKilobytes->SetValue(configuration->XmlInspectorMaxKilobytes());
+  m_exportCacheMegabytes->SetValue(configuration->ExportCacheMegabytes());
   m_defaultPlotWidth->SetValue(defaultPlotWidth);
   m_defaultPlotHeight->SetValue(defaultPlotHeight);
   m_displayedDigits->SetValue(configuration->GetDisplayedDigits());
@@ -872,6 +881,24 @@ wxPanel *ConfigDialogue::CreateOptionsPanel()
   grid_sizer->Add(mm, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
   grid_sizer->Add(m_maxGnuplotMegabytes, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
 
+  wxStaticText *aj = new wxStaticText(panel, -1, _("Parallel gnuplot processes for animations:"));
+  m_animationJobs = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 1,
+                                   256);
+  grid_sizer->Add(aj, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  grid_sizer->Add(m_animationJobs, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+
+  wxStaticText *xm = new wxStaticText(panel, -1, _("Raw XML monitor memory limit [kB]:"));
+  m_xmlInspectorMaxKilobytes = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 16,
+                                              1000000);
+  grid_sizer->Add(xm, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  grid_sizer->Add(m_xmlInspectorMaxKilobytes, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+
+  wxStaticText *ec = new wxStaticText(panel, -1, _("Export cache size limit [MB]:"));
+  m_exportCacheMegabytes = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 0,
+                                          100000);
+  grid_sizer->Add(ec, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  grid_sizer->Add(m_exportCacheMegabytes, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+
   vsizer->Add(grid_sizer, 1, wxEXPAND, 5);
   
   m_savePanes = new wxCheckBox(panel, -1, _("Save panes layout"));
@@ -987,6 +1014,9 @@ wxPanel *ConfigDialogue::CreateMaximaPanel()
 
   m_restartOnReEvaluation = new wxCheckBox(panel, -1, _("Start a new maxima for each re-evaluation"));
   vsizer->Add(m_restartOnReEvaluation, 0, wxALL, 5);
+
+  m_compileWxMathML = new wxCheckBox(panel, -1, _("Cache a compiled version of the lisp code wxMaxima sends maxima"));
+  vsizer->Add(m_compileWxMathML, 0, wxALL, 5);
   panel->SetSizerAndFit(vsizer);
 
   return panel;
@@ -1152,6 +1182,7 @@ void ConfigDialogue::WriteSettings()
   Configuration *configuration = m_configuration;
   configuration->SetAbortOnError(m_abortOnError->GetValue());
   configuration->RestartOnReEvaluation(m_restartOnReEvaluation->GetValue());
+  configuration->CompileWxMathML(m_compileWxMathML->GetValue());
   configuration->MaximaUserLocation(m_maximaUserLocation->GetValue());
   configuration->AutodetectMaxima(m_autodetectMaxima->GetValue());
   config->Write(wxT("parameters"), m_additionalParameters->GetValue());
@@ -1189,6 +1220,9 @@ void ConfigDialogue::WriteSettings()
   configuration->AntiAliasLines(m_antialiasLines->GetValue());
   config->Write(wxT("DefaultFramerate"), m_defaultFramerate->GetValue());
   configuration->MaxGnuplotMegabytes(m_maxGnuplotMegabytes->GetValue());
+  configuration->AnimationJobs(m_animationJobs->GetValue());
+  configuration->XmlInspectorMaxKilobytes(m_xmlInspectorMaxKilobytes->GetValue());
+  configuration->ExportCacheMegabytes(m_exportCacheMegabytes->GetValue());
   config->Write(wxT("defaultPlotWidth"), m_defaultPlotWidth->GetValue());
   config->Write(wxT("defaultPlotHeight"), m_defaultPlotHeight->GetValue());
   configuration->SetDisplayedDigits(m_displayedDigits->GetValue());
@@ -268,6 +268,7 @@ protected:
   wxCheckBox *m_abortOnError;
   wxCheckBox *m_offerKnownAnswers;
   wxCheckBox *m_restartOnReEvaluation;
+  wxCheckBox *m_compileWxMathML;
   wxCheckBox *m_wrapLatexMath;
   wxCheckBox *m_savePanes;
   wxCheckBox *m_usesvg;
@@ -331,6 +332,9 @@ protected:
   wxSpinCtrl *m_defaultPort;
   ExamplePanel *m_examplePanel;
   wxSpinCtrl *m_maxGnuplotMegabytes;
+  wxSpinCtrl *m_animationJobs;
+  wxSpinCtrl *m_xmlInspectorMaxKilobytes;
+  wxSpinCtrl *m_exportCacheMegabytes;
 
   //! Is called when the path to the maxima binary was changed.
   void MaximaLocationChanged(wxCommandEvent &unused);
@@ -33,6 +33,7 @@
 #include <wx/config.h>
 #include <wx/wfstream.h>
 #include <wx/fileconf.h>
+#include <wx/thread.h>
 #include "Cell.h"
 
 Configuration::Configuration(wxDC *dc) :
@@ -43,6 +44,7 @@ Configuration::Configuration(wxDC *dc) :
   m_symbolPaneAdditionalChars("Øü§")
 {
   SetBackgroundBrush(*wxWHITE_BRUSH);
+  m_textExtentsCurrent = 0;
   m_hidemultiplicationsign = true;
   m_autoSaveAsTempFile = false;
   m_inLispMode = false;
@@ -70,12 +72,19 @@ Configuration::Configuration(wxDC *dc) :
   m_showBrackets = true;
   m_printBrackets = false;
   m_hideBrackets = true;
+  m_showEvaluationStats = false;
   m_lineWidth_em = 88;
   m_adjustWorksheetSizeNeeded = false;
   m_showLabelChoice = labels_prefer_user;
   m_abortOnError = true;
   m_defaultPort = 49152;
   m_maxGnuplotMegabytes = 12;
+  m_animationJobs = wxThread::GetCPUCount();
+  if(m_animationJobs < 1)
+    m_animationJobs = 1;
+  m_gnuplotBinary = wxT("gnuplot");
+  m_xmlInspectorMaxKilobytes = 4096;
+  m_exportCacheMegabytes = 256;
   m_clientWidth = 1024;
   m_clientHeight = 768;
   m_indentMaths=true;
@@ -365,6 +374,9 @@ void Configuration::ReadConfig()
     m_autoSaveAsTempFile = (autoSaveMinutes == 0);
   }
   config->Read("maxGnuplotMegabytes", &m_maxGnuplotMegabytes);
+  config->Read("animationJobs", &m_animationJobs);
+  config->Read("xmlInspectorMaxKilobytes", &m_xmlInspectorMaxKilobytes);
+  config->Read("exportCacheMegabytes", &m_exportCacheMegabytes);
   config->Read("offerKnownAnswers", &m_offerKnownAnswers);
   config->Read(wxT("documentclass"), &m_documentclass);
   config->Read(wxT("documentclassoptions"), &m_documentclassOptions);
@@ -419,6 +431,8 @@ void Configuration::ReadConfig()
 
   config->Read(wxT("hideBrackets"), &m_hideBrackets);
 
+  config->Read(wxT("showEvaluationStats"), &m_showEvaluationStats);
+
   m_displayedDigits = 100;
   config->Read(wxT("displayedDigits"), &m_displayedDigits);
   if (m_displayedDigits <= 20)
@@ -426,6 +440,8 @@ void Configuration::ReadConfig()
 
   m_restartOnReEvaluation = true;
   config->Read(wxT("restartOnReEvaluation"), &m_restartOnReEvaluation);
+  m_compileWxMathML = true;
+  config->Read(wxT("compileWxMathML"), &m_compileWxMathML);
 
   m_matchParens = true;
   config->Read(wxT("matchParens"), &m_matchParens);
@@ -602,6 +618,8 @@ void Configuration::SetZoomFactor(double newzoom)
   if (newzoom < GetMinZoomFactor())
     newzoom = GetMinZoomFactor();
 
+  if(m_zoomFactor != newzoom)
+    ClearTextExtentCache();
   m_zoomFactor = newzoom;
   wxConfig::Get()->Write(wxT("ZoomFactor"), m_zoomFactor);
   RecalculationForce(true);
@@ -706,6 +724,88 @@ bool Configuration::CharsExistInFont(wxFont font, wxString char1,wxString char2,
   }
 }
 
+wxSize Configuration::GetTextExtent(const wxString &text)
+{
+  wxFont font = m_dc->GetFont();
+  if((m_textExtentFontKey.IsEmpty()) || (!(font == m_textExtentFont)))
+  {
+    TextExtentContext context;
+    context.m_font = font;
+    double scaleX, scaleY;
+    m_dc->GetUserScale(&scaleX, &scaleY);
+    context.m_dcKind = wxString::Format(wxT("%s %i %f %f"),
+                                        m_dc->GetClassInfo()->GetClassName(),
+                                        m_dc->GetPPI().x, scaleX, scaleY);
+    // Only a few contexts are in use => a linear search is fast enough
+    size_t id = 0;
+    while((id < m_textExtentContexts.size()) &&
+          ((!(m_textExtentContexts[id].m_font == font)) ||
+           (m_textExtentContexts[id].m_dcKind != context.m_dcKind)))
+      id++;
+    if(id == m_textExtentContexts.size())
+      m_textExtentContexts.push_back(context);
+    m_textExtentFont = font;
+    m_textExtentFontKey = wxString::Format(wxT("%li\t"), (long) id);
+  }
+  wxString key = m_textExtentFontKey + text;
+
+  TextExtentHash::const_iterator it = m_textExtents[m_textExtentsCurrent].find(key);
+  if(it != m_textExtents[m_textExtentsCurrent].end())
+    return it->second;
+
+  // A size that hasn't been used for a while is still in use => keep it.
+  it = m_textExtents[1 - m_textExtentsCurrent].find(key);
+  if(it != m_textExtents[1 - m_textExtentsCurrent].end())
+  {
+    wxSize sz = it->second;
+    AddTextExtent(key, sz);
+    return sz;
+  }
+
+  // Ask wxWidgets to return this text piece's size (slow, but the only way if
+  // there is no cached size).
+  wxSize sz = m_dc->GetTextExtent(text);
+  AddTextExtent(key, sz);
+  return sz;
+}
+
+void Configuration::AddTextExtent(const wxString &key, wxSize size)
+{
+  // Don't let the cache grow without bounds if the worksheet contains
+  // lots of different texts
+  if(m_textExtents[m_textExtentsCurrent].size() >= 100000)
+  {
+    m_textExtentsCurrent = 1 - m_textExtentsCurrent;
+    m_textExtents[m_textExtentsCurrent].clear();
+  }
+  m_textExtents[m_textExtentsCurrent][key] = size;
+}
+
+void Configuration::ClearTextExtentCache()
+{
+  m_textExtents[0].clear();
+  m_textExtents[1].clear();
+  m_textExtentContexts.clear();
+  m_textExtentFontKey = wxEmptyString;
+}
+
+wxString Configuration::RenderSettings() const
+{
+  wxString settings = wxString::Format(wxT("%s;%s;%i;%i;%i;%i;%i;%i;%i;"),
+                                       m_fontName, m_mathFontName,
+                                       m_defaultFontSize, m_mathFontSize,
+                                       m_TeXFonts, m_useUnicodeMaths,
+                                       m_changeAsterisk, m_hidemultiplicationsign,
+                                       (int) m_showLabelChoice);
+  for (int i = 0; i < NUMBEROFSTYLES; i++)
+    settings += wxString::Format(wxT("%s,%i,%s,%i,%i,%i;"),
+                                 m_styles[i].FontName(), m_styles[i].FontSize(),
+                                 m_styles[i].Color().GetAsString(wxC2S_HTML_SYNTAX),
+                                 m_styles[i].Bold(), m_styles[i].Italic(),
+                                 m_styles[i].Underlined());
+  return settings;
+}
+
 wxString Configuration::GetFontName(int type) const
 {
   wxString retval = FontName();
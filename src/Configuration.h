@@ -26,7 +26,9 @@
 #include <wx/config.h>
 #include <wx/display.h>
 #include <wx/fontenum.h>
+#include <vector>
 #include "LoggingMessageDialog.h"
+#include "InternedString.h"
 #include "TextStyle.h"
 
 #define MC_LINE_SKIP Scale_Px(2)
@@ -120,6 +122,14 @@ public:
   wxString GetWorkingDirectory() const
   { return m_workingdir; }
 
+  //! Tell us where the gnuplot binary maxima uses can be found
+  void SetGnuplotBinary(wxString binary)
+  { m_gnuplotBinary = binary; }
+
+  //! The gnuplot binary maxima uses
+  wxString GetGnuplotBinary() const
+  { return m_gnuplotBinary; }
+
   void ReadConfig();
 
   /*! The constructor
@@ -131,6 +141,9 @@ public:
   //! Set the drawing context that is currently active
   void SetContext(wxDC &dc)
   {
+    // A different DC may measure text differently => GetTextExtent() has to
+    // determine which of its cached sizes belong to this one.
+    m_textExtentFontKey = wxEmptyString;
     m_dc = &dc;
     m_antialiassingDC = NULL;
   }
@@ -201,6 +214,7 @@ public:
   void SetZoomFactor_temporarily(double newzoom){
     if(m_zoomFactor != newzoom)
     {
+      ClearTextExtentCache();
       RecalculationForce(true);
       FontChanged(true);
     }
@@ -609,6 +623,15 @@ public:
     wxConfig::Get()->Write(wxT("restartOnReEvaluation"), m_restartOnReEvaluation = arg);
   }
 
+  //! Make maxima load a cached compiled version of wxMathML.lisp instead of the source?
+  bool CompileWxMathML() const
+  { return m_compileWxMathML; }
+
+  void CompileWxMathML(bool arg)
+  {
+    wxConfig::Get()->Write(wxT("compileWxMathML"), m_compileWxMathML = arg);
+  }
+
   //! Reads the size of the current worksheet's visible window. See SetCanvasSize
   wxSize GetCanvasSize() const
   { return m_canvasSize; }
@@ -624,6 +647,15 @@ public:
   bool ShowBrackets(bool show)
   { return m_showBrackets = show; }
 
+  //! Show how long maxima and wxMaxima needed for each cell?
+  bool ShowEvaluationStats() const
+  { return m_showEvaluationStats; }
+
+  void ShowEvaluationStats(bool show)
+  {
+    wxConfig::Get()->Write(wxT("showEvaluationStats"), m_showEvaluationStats = show);
+  }
+
   //! Print the cell brackets [displayed left to each group cell showing its extend]?
   bool PrintBrackets() const
   { return m_printBrackets; }
@@ -758,8 +790,8 @@ public:
 
   //! Sets the default toolTip for new cells
   void SetDefaultCellToolTip(wxString defaultToolTip){m_defaultToolTip = defaultToolTip;}
-  //! Gets the default toolTip for new cells
-  wxString GetDefaultCellToolTip() const {return m_defaultToolTip;}
+  //! Gets the default toolTip for new cells. Is interned only once, not by every new cell.
+  const InternedString &GetDefaultCellToolTip() const {return m_defaultToolTip;}
   //! Which way do we want to draw parenthesis?
   void SetGrouphesisDrawMode(drawMode mode){m_parenthesisDrawMode = mode;}
 
@@ -801,6 +833,45 @@ public:
   void MaxGnuplotMegabytes(int megaBytes)
     {wxConfig::Get()->Write("maxGnuplotMegabytes",m_maxGnuplotMegabytes = megaBytes);}
 
+  /*! How many gnuplot processes may render the frames of an animation in parallel?
+
+    1 means: maxima renders the frames one after another itself.
+  */
+  int AnimationJobs() const {return m_animationJobs;}
+  void AnimationJobs(int jobs)
+    {wxConfig::Get()->Write("animationJobs",m_animationJobs = jobs);}
+
+  //! The maximum size of the cache exports store rendered equations in [MB]. 0 = no cache.
+  int ExportCacheMegabytes() const {return m_exportCacheMegabytes;}
+  void ExportCacheMegabytes(int megaBytes)
+    {wxConfig::Get()->Write("exportCacheMegabytes",m_exportCacheMegabytes = megaBytes);}
+
+  /*! A description of all settings that influence how maths is rendered
+
+    Used by ExportCache in order to decide if an image rendered in a previous
+    export can be reused.
+   */
+  wxString RenderSettings() const;
+
+  /*! The size of a text in the drawing context's current font
+
+    Most cells contain text many other cells contain, too => the sizes are
+    cached for all cells, keyed by the kind of drawing context, the font and
+    the text. Switching between the screen and a bitmap or the printer
+    therefore doesn't invalidate the cache.
+   */
+  wxSize GetTextExtent(const wxString &text);
+  //! Forget all text sizes GetTextExtent() has cached, for example as the zoom factor has changed
+  void ClearTextExtentCache();
+  //! The number of text sizes GetTextExtent() has cached
+  size_t GetTextExtentCacheSize() const
+    {return m_textExtents[0].size() + m_textExtents[1].size();}
+
+  //! The maximum number of kilobytes of the communication with maxima the XML inspector keeps
+  int XmlInspectorMaxKilobytes() const {return m_xmlInspectorMaxKilobytes;}
+  void XmlInspectorMaxKilobytes(int kiloBytes)
+    {wxConfig::Get()->Write("xmlInspectorMaxKilobytes",m_xmlInspectorMaxKilobytes = kiloBytes);}
+
   bool OfferKnownAnswers() const {return m_offerKnownAnswers;}
   void OfferKnownAnswers(bool offerKnownAnswers)
     {wxConfig::Get()->Write("offerKnownAnswers",m_offerKnownAnswers = offerKnownAnswers);}
@@ -887,6 +958,8 @@ private:
   bool m_showBrackets;
   //! Print the cell brackets [displayed left to each group cell showing its extend]?
   bool m_printBrackets;
+  //! Show how long maxima and wxMaxima needed for each cell?
+  bool m_showEvaluationStats;
   /*! Replace a "*" by a centered dot?
     
     Normally we ask the parser for this piece of information. But during recalculation
@@ -922,10 +995,11 @@ private:
   bool m_forceUpdate;
   bool m_clipToDrawRegion;
   bool m_outdated;
-  wxString m_defaultToolTip;
+  InternedString m_defaultToolTip;
   bool m_TeXFonts;
   bool m_keepPercent;
   bool m_restartOnReEvaluation;
+  bool m_compileWxMathML;
   wxString m_fontCMRI, m_fontCMSY, m_fontCMEX, m_fontCMMI, m_fontCMTI;
   int m_clientWidth;
   int m_clientHeight;
@@ -956,6 +1030,36 @@ private:
   bool m_offerKnownAnswers;
   int m_defaultPort;
   int m_maxGnuplotMegabytes;
+  int m_animationJobs;
+  wxString m_gnuplotBinary;
+  int m_xmlInspectorMaxKilobytes;
+  int m_exportCacheMegabytes;
+  WX_DECLARE_STRING_HASH_MAP(wxSize, TextExtentHash);
+  /*! The text sizes GetTextExtent() knows about
+
+    m_textExtents[m_textExtentsCurrent] receives the sizes that are used now.
+    If it is full the other one, that holds the sizes that weren't used since
+    the last time this happened, is dropped and the two swap roles. This way
+    the sizes that are in use survive, which a complete clear wouldn't allow.
+   */
+  TextExtentHash m_textExtents[2];
+  //! Which of m_textExtents receives new sizes
+  int m_textExtentsCurrent;
+  //! A font in a kind of drawing context
+  struct TextExtentContext
+  {
+    wxFont m_font;
+    //! The class, resolution and scale of the drawing context
+    wxString m_dcKind;
+  };
+  //! The contexts GetTextExtent() has seen. Their index is the context id in m_textExtents' keys
+  std::vector<TextExtentContext> m_textExtentContexts;
+  //! The font m_textExtentFontKey describes
+  wxFont m_textExtentFont;
+  //! The part of the keys of m_textExtents that describes the context: its id plus a tab
+  wxString m_textExtentFontKey;
+  //! Remember the size of a text
+  void AddTextExtent(const wxString &key, wxSize size);
   wxString m_documentclass;
   wxString m_documentclassOptions;
   htmlExportFormat m_htmlEquationFormat;
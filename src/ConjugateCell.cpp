@@ -180,12 +180,21 @@ wxString ConjugateCell::ToOMML()
 }
 
 wxString ConjugateCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void ConjugateCell::AppendXML(wxString &out)
 {
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
 
-  return wxT("<cj") + flags + wxT(">") + m_innerCell->ListToXML() + wxT("</cj>");
+  out += wxT("<cj") + flags + wxT(">");
+  m_innerCell->AppendListXML(out);
+  out += wxT("</cj>");
 }
 
 bool ConjugateCell::BreakUp()
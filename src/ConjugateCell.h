@@ -51,6 +51,7 @@ public:
   ConjugateCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   ConjugateCell(const ConjugateCell &cell);
   Cell *Copy() override {return new ConjugateCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~ConjugateCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
@@ -85,6 +86,8 @@ protected:
   wxString ToOMML() override;
 
   wxString ToXML() override;
+
+  void AppendXML(wxString &out) override;
 };
 
 #endif // CONJUGATECELL_H
@@ -31,6 +31,7 @@ public:
   DiffCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   DiffCell(const DiffCell &cell);
   Cell *Copy() override {return new DiffCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   //! This class can be derived from wxAccessible which has no copy constructor
   DiffCell &operator=(const DiffCell&) = delete;
   ~DiffCell();
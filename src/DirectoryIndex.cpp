@@ -0,0 +1,224 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file defines the class DirectoryIndex.
+ */
+
+#include "DirectoryIndex.h"
+#include <wx/dir.h>
+#include <wx/file.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/textfile.h>
+#include <vector>
+
+//! The first line of the index file. Change the version if the format changes.
+static const wxString indexHeader = wxT("wxMaxima directory index 1");
+
+wxString DirectoryIndex::Normalize(wxString path)
+{
+  wxFileName dir = wxFileName::DirName(path);
+  dir.MakeAbsolute();
+  return dir.GetPath();
+}
+
+//! The path of an entry of a directory
+static wxString ChildPath(const wxString &dir, const wxString &name)
+{
+  if(dir.EndsWith(wxFILE_SEP_PATH))
+    return dir + name;
+  return dir + wxFILE_SEP_PATH + name;
+}
+
+bool DirectoryIndex::Load(wxString file)
+{
+  if(!wxFileExists(file))
+    return false;
+  wxTextFile index(file);
+  if((!index.Open()) || (index.GetLineCount() < 1) || (index.GetFirstLine() != indexHeader))
+    return false;
+
+  Directories directories;
+  Directory *dir = NULL;
+  for(size_t i = 1; i < index.GetLineCount(); i++)
+  {
+    wxString line = index[i];
+    if(line.StartsWith(wxT("D\t")))
+    {
+      wxString modified = line.Mid(2).BeforeFirst(wxT('\t'));
+      wxLongLong_t modifiedTime;
+      if(!modified.ToLongLong(&modifiedTime))
+        return false;
+      dir = &directories[line.Mid(2).AfterFirst(wxT('\t'))];
+      dir->m_modified = modifiedTime;
+    }
+    else if((dir != NULL) && line.StartsWith(wxT("F\t")))
+      dir->m_files.Add(line.Mid(2));
+    else if((dir != NULL) && line.StartsWith(wxT("S\t")))
+      dir->m_subdirs.Add(line.Mid(2));
+  }
+  m_directories.swap(directories);
+  return true;
+}
+
+void DirectoryIndex::Save(wxString file) const
+{
+  wxString path = wxFileName(file).GetPath();
+  if(!wxDirExists(path))
+    wxFileName::Mkdir(path, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+
+  wxString contents = indexHeader + wxT("\n");
+  for(Directories::const_iterator it = m_directories.begin(); it != m_directories.end(); ++it)
+  {
+    contents += wxString::Format(wxT("D\t%") wxLongLongFmtSpec wxT("d\t"),
+                                 (wxLongLong_t) it->second.m_modified) +
+      it->first + wxT("\n");
+    for(wxArrayString::const_iterator name = it->second.m_files.begin();
+        name != it->second.m_files.end(); ++name)
+      contents += wxT("F\t") + *name + wxT("\n");
+    for(wxArrayString::const_iterator name = it->second.m_subdirs.begin();
+        name != it->second.m_subdirs.end(); ++name)
+      contents += wxT("S\t") + *name + wxT("\n");
+  }
+
+  // Write the index under a temporary name first so no other wxMaxima
+  // process ever reads a half-written index.
+  wxString tempFile = wxFileName::CreateTempFileName(path + wxT("/dirindex_"));
+  if(tempFile.IsEmpty())
+    return;
+  bool written;
+  {
+    wxFile out(tempFile, wxFile::write);
+    wxScopedCharBuffer data = contents.utf8_str();
+    written = out.IsOpened() && (out.Write(data.data(), data.length()) == data.length());
+  }
+  if((!written) || (!wxRenameFile(tempFile, file, true)))
+    wxRemoveFile(tempFile);
+}
+
+bool DirectoryIndex::Scan(wxString root, bool recursive, Filter skip)
+{
+  bool changed = false;
+  // A directory that is modified in the second we list it might change
+  // without its modification time changing. It is listed again next time.
+  time_t recently = wxDateTime::Now().GetTicks() - 2;
+
+  std::vector<wxString> pending;
+  pending.push_back(Normalize(root));
+  while(!pending.empty())
+  {
+    wxString path = pending.back();
+    pending.pop_back();
+    if(!wxDirExists(path))
+      continue;
+
+    time_t modified = wxFileModificationTime(path);
+    Directories::iterator it = m_directories.find(path);
+    if((it == m_directories.end()) || (modified == -1) || (it->second.m_modified != modified))
+    {
+      Directory dir;
+      dir.m_modified = (modified < recently) ? modified : -1;
+      wxDir listing(path);
+      if(listing.IsOpened())
+      {
+        wxString name;
+        for(bool found = listing.GetFirst(&name, wxEmptyString, wxDIR_FILES | wxDIR_HIDDEN);
+            found; found = listing.GetNext(&name))
+          dir.m_files.Add(name);
+        for(bool found = listing.GetFirst(&name, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN);
+            found; found = listing.GetNext(&name))
+          dir.m_subdirs.Add(name);
+      }
+      m_directories[path] = dir;
+      it = m_directories.find(path);
+      changed = true;
+    }
+    if(it->second.m_seen)
+      continue;
+    it->second.m_seen = true;
+
+    if(recursive)
+    {
+      for(wxArrayString::const_iterator name = it->second.m_subdirs.begin();
+          name != it->second.m_subdirs.end(); ++name)
+      {
+        wxString subdir = ChildPath(path, *name);
+        if(!(skip && skip(subdir)))
+          pending.push_back(subdir);
+      }
+    }
+  }
+  return changed;
+}
+
+bool DirectoryIndex::Prune()
+{
+  bool changed = false;
+  Directories::iterator it = m_directories.begin();
+  while(it != m_directories.end())
+  {
+    if(it->second.m_seen)
+    {
+      it->second.m_seen = false;
+      ++it;
+    }
+    else
+    {
+      // Erasing only invalidates the iterator that points to the erased element
+      Directories::iterator unseen = it++;
+      m_directories.erase(unseen);
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+void DirectoryIndex::ListFiles(wxString root, bool recursive, wxArrayString &files,
+                               wxArrayString *subdirs) const
+{
+  root = Normalize(root);
+  Directories::const_iterator rootDir = m_directories.find(root);
+  if(rootDir == m_directories.end())
+    return;
+  if(subdirs != NULL)
+    WX_APPEND_ARRAY(*subdirs, rootDir->second.m_subdirs);
+
+  std::vector<wxString> pending;
+  pending.push_back(root);
+  while(!pending.empty())
+  {
+    wxString path = pending.back();
+    pending.pop_back();
+    Directories::const_iterator it = m_directories.find(path);
+    if(it == m_directories.end())
+      continue;
+    WX_APPEND_ARRAY(files, it->second.m_files);
+    if(recursive)
+    {
+      for(wxArrayString::const_iterator name = it->second.m_subdirs.begin();
+          name != it->second.m_subdirs.end(); ++name)
+        pending.push_back(ChildPath(path, *name));
+    }
+  }
+}
@@ -0,0 +1,113 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file declares the class DirectoryIndex that remembers which files a
+  directory tree contains.
+ */
+
+#ifndef DIRECTORYINDEX_H
+#define DIRECTORYINDEX_H
+
+#include <wx/wx.h>
+#include <wx/string.h>
+#include <wx/arrstr.h>
+#include <wx/hashmap.h>
+#include <functional>
+
+/*! An index of the files in a directory tree that can be stored on disk
+
+  A directory's modification time changes whenever a file is added to it or
+  removed from it. Bringing the index up to date therefore only needs to read
+  the modification time of each directory and list the contents of only the
+  directories that have changed. On slow file systems that is much faster
+  than listing all directories again.
+ */
+class DirectoryIndex
+{
+public:
+  //! Decides if a recursive scan leaves out a directory
+  typedef std::function<bool (const wxString &path)> Filter;
+
+  DirectoryIndex(){}
+
+  /*! Read an index written by Save()
+
+    \return false, if the file doesn't exist or was written by an
+    incompatible version of wxMaxima.
+   */
+  bool Load(wxString file);
+  //! Write the index to a file
+  void Save(wxString file) const;
+
+  /*! Bring the part of the index below root up to date
+
+    \param root The directory to scan
+    \param recursive false means: Only index the files and subdirectories
+           root contains, but not the contents of the subdirectories.
+    \param skip The subdirectories a recursive scan leaves out
+    \return true, if the index has changed.
+   */
+  bool Scan(wxString root, bool recursive, Filter skip = Filter());
+
+  /*! Forget about all directories no Scan() has visited since the last Prune()
+
+    \return true, if the index has changed.
+   */
+  bool Prune();
+
+  /*! The names of the files the index knows about below root
+
+    Doesn't access the file system.
+    \param root The directory to list the files of
+    \param recursive Include the files in the subdirectories of root?
+    \param files The names of the files, without their path, are appended here.
+    \param subdirs If not NULL, the names of the subdirectories of root are appended here.
+   */
+  void ListFiles(wxString root, bool recursive, wxArrayString &files,
+                 wxArrayString *subdirs = NULL) const;
+
+private:
+  //! What the index knows about a directory
+  struct Directory
+  {
+    Directory() : m_modified(-1), m_seen(false){}
+    //! The modification time the directory had when it was listed. -1 = unknown.
+    time_t m_modified;
+    //! The names of the files the directory contains
+    wxArrayString m_files;
+    //! The names of the subdirectories the directory contains
+    wxArrayString m_subdirs;
+    //! Has a Scan() visited this directory since the last Prune()?
+    bool m_seen;
+  };
+  WX_DECLARE_STRING_HASH_MAP(Directory, Directories);
+
+  //! The path the index uses for a directory
+  static wxString Normalize(wxString path);
+
+  //! All directories the index knows about, by their path
+  Directories m_directories;
+};
+
+#endif // DIRECTORYINDEX_H
@@ -254,4 +254,19 @@ wxString Dirstructure::UserAutocompleteFile()
   return newFileName;
 }
 
+wxString Dirstructure::CacheDir()
+{
+#if defined __WXMSW__ || defined __WXOSX__
+  wxString dir = wxStandardPaths::Get().GetUserDataDir() + wxT("/cache");
+#else
+  wxString dir;
+  if((!wxGetEnv(wxT("XDG_CACHE_HOME"), &dir)) || dir.IsEmpty())
+    dir = wxGetHomeDir() + wxT("/.cache");
+  dir += wxT("/wxMaxima");
+#endif
+  if(!wxDirExists(dir))
+    wxFileName::Mkdir(dir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  return dir;
+}
+
 Dirstructure *Dirstructure::m_dirStructure;
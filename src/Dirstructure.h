@@ -92,6 +92,13 @@ public:
   //! The path we pass to the operating system if we want it to locate maxima instead
   static wxString MaximaDefaultLocation();
 
+  /*! The directory wxMaxima caches data in that can be re-generated if lost
+
+    Is created if it doesn't exist yet. On Linux that is $XDG_CACHE_HOME/wxMaxima,
+    as GetUserLocalDataDir() there is the name of the config file.
+   */
+  static wxString CacheDir();
+
   static Dirstructure *Get()
     {
       return m_dirStructure;
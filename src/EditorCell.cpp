@@ -47,6 +47,8 @@ EditorCell::EditorCell(Cell *parent, Configuration **config,
   m_text.Replace(wxT("\u2028"), "\n");
   m_text.Replace(wxT("\u2029"), "\n");
 
+  m_searchCharSignature = 0;
+  m_searchSignatureValid = false;
   m_errorIndex = -1;
   m_autoAnswer = false;
   m_numberOfLines = 1;
@@ -88,6 +90,7 @@ wxString EditorCell::EscapeHTMLChars(wxString input)
 
 void EditorCell::AddDrawParameter(wxString param)
 {
+  InvalidateSearchSignature();
   SaveValue();
   if(m_positionOfCaret < 0)
     return;
@@ -625,6 +628,7 @@ void EditorCell::ConvertNumToUNicodeChar()
     newChar +
     m_text.Right(m_text.Length() - m_positionOfCaret - numLen);
   m_positionOfCaret+= newChar.Length();
+  InvalidateSearchSignature();
 }
 
 void EditorCell::RecalculateWidths(int fontsize)
@@ -1291,6 +1295,7 @@ bool EditorCell::HandleCtrlCommand(wxKeyEvent &ev)
         end++;
       m_text = m_text.SubString(0, m_positionOfCaret - 1) + m_text.SubString(end, m_text.length());
       m_isDirty = true;
+      InvalidateSearchSignature();
       break;
     }
 
@@ -1536,6 +1541,7 @@ int EditorCell::GetIndentDepth(wxString text, int positionOfCaret)
 
 void EditorCell::ProcessNewline(bool keepCursorAtStartOfLine)
 {
+  InvalidateSearchSignature();
         if (m_selectionStart != -1) // we have a selection, delete it, then proceed
       {
         SaveValue();
@@ -2637,6 +2643,7 @@ void EditorCell::ActivateCursor()
 
 bool EditorCell::AddEnding()
 {
+  InvalidateSearchSignature();
   // Lisp cells don't require a maxima line ending
   if((*m_configuration)->InLispMode())
     return false;
@@ -3194,6 +3201,7 @@ bool EditorCell::CopyToClipboard()
 
 bool EditorCell::CutToClipboard()
 {
+  InvalidateSearchSignature();
   if (m_selectionStart == -1)
     return false;
 
@@ -3221,6 +3229,7 @@ bool EditorCell::CutToClipboard()
 
 void EditorCell::InsertText(wxString text)
 {
+  InvalidateSearchSignature();
   SaveValue();
   m_saveValue = true;
   m_containsChanges = true;
@@ -3329,6 +3338,7 @@ bool EditorCell::CanUndo()
 
 void EditorCell::Undo()
 {
+  InvalidateSearchSignature();
   if (m_historyPosition == -1)
   {
     m_historyPosition = m_textHistory.GetCount() - 1;
@@ -3365,6 +3375,7 @@ bool EditorCell::CanRedo()
 
 void EditorCell::Redo()
 {
+  InvalidateSearchSignature();
   if (m_historyPosition == -1)
     return;
 
@@ -3844,6 +3855,9 @@ void EditorCell::StyleTextTexts()
 
 void EditorCell::StyleText()
 {
+  // StyleText() is called whenever the text has changed.
+  InvalidateSearchSignature();
+
   // We will need to determine the width of text and therefore need to set
   // the font type and size.
   SetFont();
@@ -3868,6 +3882,7 @@ void EditorCell::StyleText()
 
 void EditorCell::SetValue(const wxString &text)
 {
+  InvalidateSearchSignature();
   if (m_type == MC_TYPE_INPUT)
   {
     if ((*m_configuration)->GetMatchParens())
@@ -3953,6 +3968,7 @@ bool EditorCell::CheckChanges()
 
 int EditorCell::ReplaceAll(wxString oldString, wxString newString, bool ignoreCase)
 {
+  InvalidateSearchSignature();
   if (oldString == wxEmptyString)
     return 0;
 
@@ -4045,8 +4061,91 @@ bool EditorCell::FindNext(wxString str, bool down, bool ignoreCase)
   return false;
 }
 
+int EditorCell::SearchCharBit(wxUniChar ch)
+{
+  return ((wxUint32) ch.GetValue() * 2654435761u) >> 26;
+}
+
+size_t EditorCell::SearchTripleBit(wxUniChar ch1, wxUniChar ch2, wxUniChar ch3)
+{
+  wxUint32 hash = ((wxUint32) ch1.GetValue() * 961u +
+                   (wxUint32) ch2.GetValue() * 31u +
+                   (wxUint32) ch3.GetValue()) * 2654435761u;
+  return (hash >> 16) % m_searchSignatureBits;
+}
+
+wxString EditorCell::SearchNeedle(wxString str)
+{
+  str.Replace(wxT('\r'), wxT(' '));
+  return str.MakeLower();
+}
+
+bool EditorCell::MightContain(const wxString &needle)
+{
+  // The text of the cell that is being edited changes on every keypress.
+  if (IsActive())
+    return true;
+
+  if (!m_searchSignatureValid)
+  {
+    wxString text(m_text);
+    text.Replace(wxT('\r'), wxT(' '));
+    text.MakeLower();
+    m_searchSignature.reset();
+    m_searchCharSignature = 0;
+    wxUniChar ch1 = 0, ch2 = 0;
+    size_t pos = 0;
+    for (wxString::const_iterator it = text.begin(); it != text.end(); ++it, ++pos)
+    {
+      m_searchCharSignature |= (wxUint64) 1 << SearchCharBit(*it);
+      if (pos >= 2)
+        m_searchSignature.set(SearchTripleBit(ch1, ch2, *it));
+      ch1 = ch2;
+      ch2 = *it;
+    }
+    m_searchSignatureValid = true;
+  }
+
+  wxUniChar ch1 = 0, ch2 = 0;
+  size_t pos = 0;
+  for (wxString::const_iterator it = needle.begin(); it != needle.end(); ++it, ++pos)
+  {
+    if (!(m_searchCharSignature & ((wxUint64) 1 << SearchCharBit(*it))))
+      return false;
+    if ((pos >= 2) && (!m_searchSignature.test(SearchTripleBit(ch1, ch2, *it))))
+      return false;
+    ch1 = ch2;
+    ch2 = *it;
+  }
+  return true;
+}
+
+int EditorCell::CountMatches(wxString str, bool ignoreCase)
+{
+  if (str.IsEmpty())
+    return 0;
+
+  wxString text(m_text);
+  text.Replace(wxT('\r'), wxT(' '));
+  if (ignoreCase)
+  {
+    str.MakeLower();
+    text.MakeLower();
+  }
+
+  int count = 0;
+  size_t pos = text.find(str);
+  while (pos != wxString::npos)
+  {
+    count++;
+    pos = text.find(str, pos + str.Length());
+  }
+  return count;
+}
+
 bool EditorCell::ReplaceSelection(wxString oldStr, wxString newString, bool keepSelected, bool ignoreCase, bool replaceMaximaString)
 {
+  InvalidateSearchSignature();
   wxString text(m_text);
   text.Replace(wxT("\r"), wxT(" "));
 
@@ -28,6 +28,7 @@
 
 #include <vector>
 #include <list>
+#include <bitset>
 #include "MaximaTokenizer.h"
 
 /*! \file
@@ -100,6 +101,8 @@ public:
              CellPointers *cellPointers, wxString text = wxEmptyString);
   EditorCell(const EditorCell &cell);
   Cell *Copy() override {return new EditorCell(*this);}
+  size_t GetMemoryUsage() const override
+    {return sizeof(*this) + (m_text.Length() + 1) * sizeof(wxChar);}
   ~EditorCell();
 
   //! Insert the symbol that corresponds to the ESC command txt
@@ -479,6 +482,24 @@ public:
    */
   bool FindNext(wxString str, bool down, bool ignoreCase);
 
+  /*! Could this cell contain a search string?
+
+    \param needle The search string, as prepared by SearchNeedle(). Searches
+    through many cells prepare it only once.
+
+    false means: The cell definitely doesn't contain the string, so searching
+    it can be skipped. Is answered from a signature of the characters and
+    character triples the cell contains, which is only rebuilt after the text
+    has changed.
+   */
+  bool MightContain(const wxString &needle);
+
+  //! Converts a search string to the form MightContain() expects
+  static wxString SearchNeedle(wxString str);
+
+  //! The number of times this cell contains str
+  int CountMatches(wxString str, bool ignoreCase);
+
   void SetSelection(int start, int end);
 
   void GetSelection(int *start, int *end) const
@@ -751,6 +772,20 @@ private:
   bool m_firstLineOnly;
   //! The individual commands, parenthesis, strings and whitespaces a code cell consists of
   MaximaTokenizer::TokenList m_tokens;
+  //! The number of bits in the search signature's triple part
+  static const size_t m_searchSignatureBits = 512;
+  //! Which character triples (lowercase) does this cell contain? Hashed to m_searchSignatureBits bits
+  std::bitset<m_searchSignatureBits> m_searchSignature;
+  //! Which characters (lowercase) does this cell contain? Hashed to 64 bits
+  wxUint64 m_searchCharSignature;
+  //! Do m_searchSignature and m_searchCharSignature describe the current text?
+  bool m_searchSignatureValid;
+  //! To be called whenever m_text changes
+  void InvalidateSearchSignature(){m_searchSignatureValid = false;}
+  //! The bit a character is represented by in m_searchCharSignature
+  static int SearchCharBit(wxUniChar ch);
+  //! The bit a triple of characters is represented by in m_searchSignature
+  static size_t SearchTripleBit(wxUniChar ch1, wxUniChar ch2, wxUniChar ch3);
 };
 
 #endif // EDITORCELL_H
@@ -0,0 +1,130 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+
+  This file defines the class EvaluationStats that collects timing information for a GroupCell.
+ */
+
+#include "EvaluationStats.h"
+
+void EvaluationStats::Clear()
+{
+  m_maximaStart = 0;
+  m_maximaTime = 0;
+  m_bytesFromMaxima = 0;
+  m_parseTime = 0;
+  m_layoutTime = 0;
+  m_drawTime = 0;
+  m_maximaRunning = false;
+  m_collecting = false;
+  m_valid = false;
+}
+
+void EvaluationStats::MaximaStarted()
+{
+  m_maximaStart = wxGetLocalTimeMillis();
+  m_maximaRunning = true;
+  m_collecting = true;
+  m_valid = true;
+}
+
+void EvaluationStats::MaximaFinished()
+{
+  if(!m_maximaRunning)
+    return;
+  m_maximaTime += wxGetLocalTimeMillis() - m_maximaStart;
+  m_maximaRunning = false;
+}
+
+void EvaluationStats::AddDataFromMaxima(const wxString &data)
+{
+  long long bytes = 0;
+  for (wxString::const_iterator it = data.begin(); it != data.end(); ++it)
+  {
+    wxUint32 ch = (*it).GetValue();
+    if (ch < 0x80)
+      bytes += 1;
+    else if (ch < 0x800)
+      bytes += 2;
+    // Where wxString stores UTF-16 each half of a surrogate pair is half of a
+    // 4-byte UTF-8 sequence.
+    else if ((ch >= 0xD800) && (ch < 0xE000))
+      bytes += 2;
+    else if (ch < 0x10000)
+      bytes += 3;
+    else
+      bytes += 4;
+  }
+  m_bytesFromMaxima += bytes;
+}
+
+void EvaluationStats::AddDrawTime(wxLongLong microseconds)
+{
+  m_drawTime += microseconds;
+  // The result of the evaluation is on the screen now
+  if(!m_maximaRunning)
+    m_collecting = false;
+}
+
+wxString EvaluationStats::ToString() const
+{
+  return wxString::Format(_("maxima: %s ms, %lli bytes, parse: %s ms, layout: %s ms, draw: %s ms"),
+                          m_maximaTime.ToString(),
+                          m_bytesFromMaxima,
+                          (m_parseTime / 1000).ToString(),
+                          (m_layoutTime / 1000).ToString(),
+                          (m_drawTime / 1000).ToString());
+}
+
+wxString EvaluationStats::CSVHeader()
+{
+  return wxT("label,maxima_ms,bytes_from_maxima,parse_us,layout_us,draw_us");
+}
+
+wxString EvaluationStats::ToCSV(wxString label) const
+{
+  // Escape the label according to RFC 4180
+  label.Replace(wxT("\""), wxT("\"\""));
+  return wxString::Format(wxT("\"%s\",%s,%lli,%s,%s,%s"),
+                          label,
+                          m_maximaTime.ToString(),
+                          m_bytesFromMaxima,
+                          m_parseTime.ToString(),
+                          m_layoutTime.ToString(),
+                          m_drawTime.ToString());
+}
+
+wxString EvaluationStats::ToJSON(wxString label) const
+{
+  label.Replace(wxT("\\"), wxT("\\\\"));
+  label.Replace(wxT("\""), wxT("\\\""));
+  label.Replace(wxT("\n"), wxT("\\n"));
+  label.Replace(wxT("\t"), wxT("\\t"));
+  return wxString::Format(wxT("{\"label\": \"%s\", \"maxima_ms\": %s, \"bytes_from_maxima\": %lli, "
+                              "\"parse_us\": %s, \"layout_us\": %s, \"draw_us\": %s}"),
+                          label,
+                          m_maximaTime.ToString(),
+                          m_bytesFromMaxima,
+                          m_parseTime.ToString(),
+                          m_layoutTime.ToString(),
+                          m_drawTime.ToString());
+}
@@ -0,0 +1,125 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+
+  This file declares the class EvaluationStats that collects timing information for a GroupCell.
+ */
+
+#ifndef EVALUATIONSTATS_H
+#define EVALUATIONSTATS_H
+
+#include <wx/wx.h>
+#include <wx/stopwatch.h>
+
+/*! Timing information collected while a GroupCell is evaluated and displayed
+
+  Allows to tell if a slow worksheet is slow because maxima needs long to
+  calculate the results or because the frontend needs long to parse, lay out
+  and draw them.
+ */
+class EvaluationStats
+{
+public:
+  EvaluationStats(){Clear();}
+
+  //! Forget all timings, for example because the cell is about to be re-evaluated
+  void Clear();
+
+  //! Called when a command from this cell is sent to maxima
+  void MaximaStarted();
+  //! Called when maxima has sent the prompt that ends the current command
+  void MaximaFinished();
+  /*! Are layout and draw times currently accounted for?
+
+    True from the start of the evaluation until the first time the cell is
+    drawn after maxima has finished: Redraws that are caused by scrolling or
+    editing have nothing to do with the evaluation.
+   */
+  bool Collecting() const {return m_collecting;}
+  /*! Account for data maxima has sent us for this cell
+
+    Counts the bytes the data has in UTF-8 without converting it.
+   */
+  void AddDataFromMaxima(const wxString &data);
+  //! Account for the time MathParser needed to convert maxima's output to cells
+  void AddParseTime(wxLongLong microseconds){m_parseTime += microseconds;}
+  //! Account for the time Recalculate() needed
+  void AddLayoutTime(wxLongLong microseconds){m_layoutTime += microseconds;}
+  //! Account for the time Draw() needed
+  void AddDrawTime(wxLongLong microseconds);
+
+  //! The wall time maxima needed to process the commands in this cell [ms]
+  wxLongLong GetMaximaTime() const {return m_maximaTime;}
+  //! The number of bytes maxima has sent for this cell
+  long long GetBytesFromMaxima() const {return m_bytesFromMaxima;}
+  //! The time MathParser needed for the output of this cell [µs]
+  wxLongLong GetParseTime() const {return m_parseTime;}
+  //! The time Recalculate() needed for this cell [µs]
+  wxLongLong GetLayoutTime() const {return m_layoutTime;}
+  //! The time Draw() needed for this cell [µs]
+  wxLongLong GetDrawTime() const {return m_drawTime;}
+
+  //! Has this cell been evaluated since the timings were cleared?
+  bool Valid() const {return m_valid;}
+
+  //! A short human-readable summary that can be displayed next to the cell
+  wxString ToString() const;
+  //! The column names ToCSV() generates data for
+  static wxString CSVHeader();
+  //! This cell's timings as one line of comma-separated values
+  wxString ToCSV(wxString label) const;
+  //! This cell's timings as a JSON object
+  wxString ToJSON(wxString label) const;
+
+  /*! Measures the time a scope needs and adds it to a counter on leaving the scope
+
+    Does nothing if the scope isn't part of an evaluation, see Collecting().
+
+    Example: <code>EvaluationStats::Timer timer(stats, &EvaluationStats::AddDrawTime);</code>
+   */
+  class Timer
+  {
+  public:
+    typedef void (EvaluationStats::*Accumulator)(wxLongLong);
+    Timer(EvaluationStats &stats, Accumulator accumulator) :
+      m_stats(stats), m_accumulator(accumulator), m_active(stats.Collecting()) {}
+    ~Timer(){if(m_active) (m_stats.*m_accumulator)(m_stopWatch.TimeInMicro());}
+  private:
+    EvaluationStats &m_stats;
+    Accumulator m_accumulator;
+    bool m_active;
+    wxStopWatch m_stopWatch;
+  };
+
+private:
+  wxLongLong m_maximaStart;
+  wxLongLong m_maximaTime;
+  long long m_bytesFromMaxima;
+  wxLongLong m_parseTime;
+  wxLongLong m_layoutTime;
+  wxLongLong m_drawTime;
+  bool m_maximaRunning;
+  bool m_collecting;
+  bool m_valid;
+};
+
+#endif // EVALUATIONSTATS_H
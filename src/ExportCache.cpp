@@ -0,0 +1,173 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file defines the class ExportCache.
+ */
+
+#include "ExportCache.h"
+#include <wx/dir.h>
+#include <wx/filename.h>
+#include "Dirstructure.h"
+#include <wx/arrstr.h>
+#include <algorithm>
+#include <vector>
+
+ExportCache::ExportCache(wxString settings, long maxMegabytes) :
+  m_settings(settings),
+  m_maxMegabytes(maxMegabytes)
+{
+  m_enabled = false;
+  if(m_maxMegabytes <= 0)
+    return;
+  if(!wxDirExists(CacheDir()))
+    wxFileName::Mkdir(CacheDir(), wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  m_enabled = wxDirExists(CacheDir());
+}
+
+wxString ExportCache::CacheDir()
+{
+  return Dirstructure::CacheDir() + wxT("/exportcache");
+}
+
+//! Feeds data to a 64-bit FNV-1a hash
+static void AddToHash(wxUint64 &hash, const char *data, size_t length)
+{
+  for(size_t i = 0; i < length; i++)
+  {
+    hash ^= (unsigned char) data[i];
+    hash *= wxULL(1099511628211);
+  }
+}
+
+wxString ExportCache::EntryName(const wxString &xml) const
+{
+  // The length of the data is part of the name, too, which makes collisions
+  // even more unlikely.
+  wxScopedCharBuffer settings = m_settings.utf8_str();
+  wxScopedCharBuffer data = xml.utf8_str();
+  wxUint64 hash = wxULL(14695981039346656037);
+  AddToHash(hash, settings.data(), settings.length() + 1);
+  AddToHash(hash, data.data(), data.length());
+  return wxString::Format(wxT("%016") wxLongLongFmtSpec wxT("x_%lu"),
+                          (wxULongLong_t) hash, (unsigned long) data.length());
+}
+
+bool ExportCache::Retrieve(const wxString &xml, wxString ext, wxString target, wxSize &size) const
+{
+  if(!m_enabled)
+    return false;
+
+  wxDir dir(CacheDir());
+  if(!dir.IsOpened())
+    return false;
+  wxString entry;
+  if(!dir.GetFirst(&entry, EntryName(xml) + wxT("_*.") + ext, wxDIR_FILES))
+    return false;
+
+  // The size is stored as the last part of the name: <hash>_<length>_<width>x<height>.<ext>
+  wxString sizeString = wxFileName(entry).GetName().AfterLast(wxT('_'));
+  long width, height;
+  if((!sizeString.BeforeFirst(wxT('x')).ToLong(&width)) ||
+     (!sizeString.AfterFirst(wxT('x')).ToLong(&height)))
+    return false;
+
+  wxString cacheFile = CacheDir() + wxT("/") + entry;
+  if(!wxCopyFile(cacheFile, target))
+    return false;
+  // Trim() drops the entries that haven't been used for the longest time
+  wxFileName(cacheFile).Touch();
+  size = wxSize(width, height);
+  return true;
+}
+
+void ExportCache::Store(const wxString &xml, wxString ext, wxString file, wxSize size) const
+{
+  if((!m_enabled) || (size.x < 0) || (size.y < 0))
+    return;
+
+  wxString entry = CacheDir() + wxT("/") + EntryName(xml) +
+    wxString::Format(wxT("_%ix%i."), size.x, size.y) + ext;
+  // Copy the file under a temporary name first so another export never sees
+  // a half-written entry.
+  wxString tempFile = wxFileName::CreateTempFileName(CacheDir() + wxT("/tmp_"));
+  if(tempFile.IsEmpty())
+    return;
+  if((!wxCopyFile(file, tempFile)) || (!wxRenameFile(tempFile, entry)))
+    wxRemoveFile(tempFile);
+}
+
+void ExportCache::Trim() const
+{
+  if(!m_enabled)
+    return;
+
+  wxArrayString files;
+  wxDir::GetAllFiles(CacheDir(), &files, wxEmptyString, wxDIR_FILES);
+
+  struct Entry
+  {
+    wxString m_file;
+    time_t m_time;
+    wxULongLong m_size;
+  };
+  std::vector<Entry> entries;
+  wxULongLong totalSize = 0;
+  for(size_t i = 0; i < files.GetCount(); i++)
+  {
+    wxFileName name(files[i]);
+    Entry entry;
+    entry.m_file = files[i];
+    entry.m_time = name.GetModificationTime().GetTicks();
+    entry.m_size = name.GetSize();
+    if(entry.m_size == wxInvalidSize)
+      continue;
+    totalSize += entry.m_size;
+    entries.push_back(entry);
+  }
+
+  wxULongLong maxSize = wxULongLong(m_maxMegabytes) * 1000 * 1000;
+  if(totalSize <= maxSize)
+    return;
+
+  // Delete the entries that haven't been used for the longest time first
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry &a, const Entry &b){return a.m_time < b.m_time;});
+  for(std::vector<Entry>::const_iterator it = entries.begin();
+      (it != entries.end()) && (totalSize > maxSize); ++it)
+  {
+    if(wxRemoveFile(it->m_file))
+      totalSize -= it->m_size;
+  }
+}
+
+void ExportCache::Purge()
+{
+  if(!wxDirExists(CacheDir()))
+    return;
+  wxArrayString files;
+  wxDir::GetAllFiles(CacheDir(), &files, wxEmptyString, wxDIR_FILES);
+  for(size_t i = 0; i < files.GetCount(); i++)
+    wxRemoveFile(files[i]);
+  wxLogMessage(wxString::Format(_("Deleted %li files from the export cache."), (long) files.GetCount()));
+}
@@ -0,0 +1,89 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file declares the class ExportCache that allows exports to reuse
+  the images they have rendered for unchanged cells in a previous export.
+ */
+
+#ifndef EXPORTCACHE_H
+#define EXPORTCACHE_H
+
+#include <wx/wx.h>
+#include <wx/string.h>
+
+/*! An on-disk cache of the images exports render equations to
+
+  Each entry is identified by a hash of the XML representation of the cells
+  that were rendered and of the settings that influence the rendering. The
+  size of the image is stored in the entry's file name, so a cache hit means
+  the image neither has to be rendered nor read back.
+ */
+class ExportCache
+{
+public:
+  /*! The constructor
+
+    \param settings A description of all settings that influence how the
+           images look like.
+    \param maxMegabytes The size limit of the cache. 0 disables the cache.
+   */
+  ExportCache(wxString settings, long maxMegabytes);
+
+  //! Is the cache enabled?
+  bool IsEnabled() const {return m_enabled;}
+
+  /*! Copy the image that was rendered from the same cells in an earlier export to target
+
+    Can be called from any thread.
+    \param xml The XML representation of the cells, as returned by Cell::ListToXML()
+    \param ext The file extension of the image type, without the dot
+    \param target The file to copy the cached image to
+    \param size Receives the size of the image the entry was stored with
+    \return true, if an entry was found and has been copied.
+   */
+  bool Retrieve(const wxString &xml, wxString ext, wxString target, wxSize &size) const;
+
+  /*! Store an image that has been rendered from the cells described by xml
+
+    Can be called from any thread.
+   */
+  void Store(const wxString &xml, wxString ext, wxString file, wxSize size) const;
+
+  //! Delete the least recently used entries until the cache obeys its size limit
+  void Trim() const;
+
+  //! The directory the cache lives in
+  static wxString CacheDir();
+  //! Delete all cache entries
+  static void Purge();
+
+private:
+  //! The name all files belonging to an entry start with
+  wxString EntryName(const wxString &xml) const;
+  wxString m_settings;
+  long m_maxMegabytes;
+  bool m_enabled;
+};
+
+#endif // EXPORTCACHE_H
@@ -189,8 +189,8 @@ void ExptCell::RecalculateHeight(int fontsize)
 
 wxString ExptCell::ToString()
 {
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText;
+  if (!GetAltCopyText().IsEmpty())
+    return GetAltCopyText();
   if (m_isBrokenIntoLines)
     return wxEmptyString;
   wxString s = m_baseCell->ListToString() + wxT("^");
@@ -205,8 +205,8 @@ wxString ExptCell::ToString()
 
 wxString ExptCell::ToMatlab()
 {
-  if (m_altCopyText != wxEmptyString)
-	return m_altCopyText;
+  if (!GetAltCopyText().IsEmpty())
+	return GetAltCopyText();
   if (m_isBrokenIntoLines)
 	return wxEmptyString;
   wxString s = m_baseCell->ListToMatlab() + wxT("^");
@@ -255,15 +255,25 @@ wxString ExptCell::ToOMML()
 }
 
 wxString ExptCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void ExptCell::AppendXML(wxString &out)
 {
 //  if (m_isBrokenIntoLines)
-//    return wxEmptyString;
+//    return;
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
 
-  return wxT("<e") + flags + wxT("><r>") + m_baseCell->ListToXML() + _T("</r><r>") +
-         m_exptCell->ListToXML() + _T("</r></e>");
+  out += wxT("<e") + flags + wxT("><r>");
+  m_baseCell->AppendListXML(out);
+  out += _T("</r><r>");
+  m_exptCell->AppendListXML(out);
+  out += _T("</r></e>");
 }
 
 bool ExptCell::BreakUp()
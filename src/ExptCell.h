@@ -51,6 +51,7 @@ public:
   ExptCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   ExptCell(const ExptCell &cell);
   Cell *Copy() override {return new ExptCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~ExptCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
@@ -81,6 +82,8 @@ public:
 
   wxString ToXML() override;
 
+  void AppendXML(wxString &out) override;
+
   wxString ToOMML() override;
 
   wxString ToMathML() override;
@@ -356,6 +356,13 @@ wxString FracCell::ToOMML()
 }
 
 wxString FracCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void FracCell::AppendXML(wxString &out)
 {
   wxString s = (m_fracStyle == FC_NORMAL || m_fracStyle == FC_DIFF) ?
                _T("f") : _T("f line = \"no\"");
@@ -365,9 +372,11 @@ wxString FracCell::ToXML()
   if (m_forceBreakLine)
     diffStyle += wxT(" breakline=\"true\"");
 
-  return _T("<") + s + diffStyle + _T("><r>") +
-         m_num->ListToXML() + _T("</r><r>") +
-         m_denom->ListToXML() + _T("</r></f>");
+  out += _T("<") + s + diffStyle + _T("><r>");
+  m_num->AppendListXML(out);
+  out += _T("</r><r>");
+  m_denom->AppendListXML(out);
+  out += _T("</r></f>");
 }
 
 void FracCell::SetExponentFlag()
@@ -46,6 +46,7 @@ public:
   FracCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   FracCell(const FracCell &cell);
   Cell *Copy() override {return new FracCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~FracCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
@@ -97,6 +98,8 @@ public:
 
   wxString ToXML() override;
 
+  void AppendXML(wxString &out) override;
+
   //! Fractions in exponents are shown in their linear form.
   void SetExponentFlag() override;
 
@@ -0,0 +1,141 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file defines the class FrameRenderer that runs gnuplot for the frames of an animation.
+ */
+
+#include "FrameRenderer.h"
+#include "ErrorRedirector.h"
+
+FrameRenderer::FrameRenderer(const wxString &gnuplot, int jobs) :
+  m_gnuplot(gnuplot),
+  m_jobs(jobs),
+  m_running(0),
+  m_nextFrame(0),
+  m_framesReady(0)
+{
+  if(m_jobs < 1)
+    m_jobs = 1;
+}
+
+void FrameRenderer::AddFrame(const wxString &gnuplotSource, const wxString &imageFile,
+                             const std::shared_ptr<Image> &image)
+{
+  Frame frame;
+  frame.m_gnuplotSource = gnuplotSource;
+  frame.m_imageFile = imageFile;
+  frame.m_images.push_back(image);
+  frame.m_done = false;
+  m_frames.push_back(frame);
+}
+
+void FrameRenderer::AddTarget(size_t frame, const std::shared_ptr<Image> &image)
+{
+  if((frame < m_frames.size()) && (!m_frames[frame].m_done))
+    m_frames[frame].m_images.push_back(image);
+}
+
+void FrameRenderer::Run()
+{
+  while((m_running < m_jobs) && (m_nextFrame < m_frames.size()))
+  {
+    if(!StartNext())
+      LoadFrame(m_nextFrame - 1);
+  }
+}
+
+bool FrameRenderer::StartNext()
+{
+  size_t frame = m_nextFrame++;
+  bool wanted = false;
+  for(size_t i = 0; i < m_frames[frame].m_images.size(); i++)
+    if(!m_frames[frame].m_images[i].expired())
+      wanted = true;
+  // All SlideShows this frame was for have been deleted
+  if(!wanted)
+    return false;
+
+  wxString cmdline = m_gnuplot + wxT(" \"") + m_frames[frame].m_gnuplotSource + wxT("\"");
+  wxLogMessage(wxString::Format(_("Running gnuplot as: %s"), cmdline.utf8_str()));
+  GnuplotProcess *process = new GnuplotProcess(shared_from_this(), frame);
+  if (wxExecute(cmdline, wxEXEC_ASYNC|wxEXEC_HIDE_CONSOLE, process) <= 0)
+  {
+    wxLogMessage(_("Cannot start gnuplot"));
+    delete process;
+    return false;
+  }
+  m_running++;
+  return true;
+}
+
+void FrameRenderer::LoadFrame(size_t frame)
+{
+  std::vector<std::shared_ptr<Image>> images;
+  for(size_t i = 0; i < m_frames[frame].m_images.size(); i++)
+  {
+    std::shared_ptr<Image> image = m_frames[frame].m_images[i].lock();
+    if(image)
+      images.push_back(image);
+  }
+  // If gnuplot has failed to write the file Image displays an error message
+  // instead.
+  if(images.size() == 1)
+    images[0]->LoadImage(m_frames[frame].m_imageFile, std::shared_ptr<wxFileSystem>(), true);
+  else
+  {
+    #ifdef HAVE_OPENMP_TASKS
+    #pragma omp task
+    #endif
+    LoadFrame_Backgroundtask(m_frames[frame].m_imageFile, images);
+  }
+  m_frames[frame].m_images.clear();
+  m_frames[frame].m_done = true;
+  while((m_framesReady < m_frames.size()) && (m_frames[m_framesReady].m_done))
+    m_framesReady++;
+}
+
+void FrameRenderer::LoadFrame_Backgroundtask(wxString imageFile,
+                                             std::vector<std::shared_ptr<Image>> images)
+{
+  // Several Images would race for deleting the file => none of them deletes it
+  for(size_t i = 0; i < images.size(); i++)
+    images[i]->LoadImage(imageFile, std::shared_ptr<wxFileSystem>(), false);
+  // LoadImage() reads the file in a task of its own.
+  #ifdef HAVE_OPENMP_TASKS
+  #pragma omp taskwait
+  #endif
+  if(wxFileExists(imageFile))
+  {
+    SuppressErrorDialogs logNull;
+    wxRemoveFile(imageFile);
+  }
+}
+
+void FrameRenderer::GnuplotProcess::OnTerminate(int WXUNUSED(pid), int WXUNUSED(status))
+{
+  m_renderer->m_running--;
+  m_renderer->LoadFrame(m_frame);
+  m_renderer->Run();
+  delete this;
+}
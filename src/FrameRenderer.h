@@ -0,0 +1,128 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file declares the class FrameRenderer that runs gnuplot for the frames of an animation.
+ */
+
+#ifndef FRAMERENDERER_H
+#define FRAMERENDERER_H
+
+#include <wx/wx.h>
+#include <wx/process.h>
+#include <memory>
+#include <vector>
+#include "Image.h"
+
+/*! Renders the frames of an animation using several gnuplot processes in parallel
+
+  If asked to wxanimate_draw() and with_slider_draw() only write the gnuplot
+  files for each frame and leave running gnuplot to us. This class then keeps up 
+  to a configurable number of gnuplot processes running and loads each frame
+  into its Image as soon as gnuplot has written it, which allows the SlideShow 
+  to display the first frames while the rest of them still is being rendered.
+
+  Each gnuplot process owns a shared_ptr to the renderer that started it: The 
+  renderer stays alive until all frames are done even if the SlideShow has been 
+  deleted in the meantime. The renderer only keeps weak pointers to the Images,
+  though: Frames no SlideShow wants any more aren't rendered at all.
+ */
+class FrameRenderer : public std::enable_shared_from_this<FrameRenderer>
+{
+public:
+  /*! The constructor
+    
+    \param gnuplot The gnuplot binary
+    \param jobs The maximum number of gnuplot processes to run at once
+   */
+  FrameRenderer(const wxString &gnuplot, int jobs);
+
+  /*! Add a frame to the end of the animation
+    
+    \param gnuplotSource The gnuplot file that renders this frame
+    \param imageFile The image file gnuplot will write
+    \param image The Image the frame is to be loaded into
+   */
+  void AddFrame(const wxString &gnuplotSource, const wxString &imageFile,
+                const std::shared_ptr<Image> &image);
+
+  /*! Load a frame into an additional Image, too
+
+    Used for copies of a SlideShow that is still being rendered. Does nothing if
+    the frame is already done.
+   */
+  void AddTarget(size_t frame, const std::shared_ptr<Image> &image);
+
+  //! Starts as many gnuplot processes as we may run at once
+  void Run();
+
+  //! The number of frames from the start of the animation that have been loaded
+  size_t FramesReady() const {return m_framesReady;}
+
+  //! Are all frames loaded?
+  bool Finished() const {return m_framesReady >= m_frames.size();}
+
+private:
+  //! A gnuplot process that informs the renderer when it has rendered its frame
+  class GnuplotProcess : public wxProcess
+  {
+  public:
+    GnuplotProcess(const std::shared_ptr<FrameRenderer> &renderer, size_t frame) :
+      m_renderer(renderer), m_frame(frame) {}
+    void OnTerminate(int pid, int status) override;
+  private:
+    std::shared_ptr<FrameRenderer> m_renderer;
+    size_t m_frame;
+  };
+
+  struct Frame
+  {
+    wxString m_gnuplotSource;
+    wxString m_imageFile;
+    //! The Images of all SlideShows that display this frame
+    std::vector<std::weak_ptr<Image>> m_images;
+    bool m_done;
+  };
+
+  //! Loads a frame gnuplot has written into the Images that still exist
+  void LoadFrame(size_t frame);
+  //! Loads a frame into several Images and deletes its file once all are done
+  static void LoadFrame_Backgroundtask(wxString imageFile,
+                                       std::vector<std::shared_ptr<Image>> images);
+  /*! Starts gnuplot for the next frame.
+
+    Returns false if that failed or if no Image wants the frame any more.
+   */
+  bool StartNext();
+
+  std::vector<Frame> m_frames;
+  wxString m_gnuplot;
+  int m_jobs;
+  //! The number of gnuplot processes currently running
+  int m_running;
+  //! The next frame to start a gnuplot process for
+  size_t m_nextFrame;
+  size_t m_framesReady;
+};
+
+#endif // FRAMERENDERER_H
@@ -143,8 +143,8 @@ wxString FunCell::ToString()
 {
   if (m_isBrokenIntoLines)
     return wxEmptyString;
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText + Cell::ListToString();
+  if (!GetAltCopyText().IsEmpty())
+    return GetAltCopyText() + Cell::ListToString();
   wxString s = m_nameCell->ListToString() + m_argCell->ListToString();
   return s;
 }
@@ -153,8 +153,8 @@ wxString FunCell::ToMatlab()
 {
   if (m_isBrokenIntoLines)
 	return wxEmptyString;
-  if (m_altCopyText != wxEmptyString)
-	return m_altCopyText + Cell::ListToMatlab();
+  if (!GetAltCopyText().IsEmpty())
+	return GetAltCopyText() + Cell::ListToMatlab();
   wxString s = m_nameCell->ListToMatlab() + m_argCell->ListToMatlab();
   return s;
 }
@@ -185,14 +185,24 @@ wxString FunCell::ToTeX()
 }
 
 wxString FunCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void FunCell::AppendXML(wxString &out)
 {
 //  if (m_isBrokenIntoLines)
-//    return wxEmptyString;
+//    return;
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
-  return wxT("<fn") + flags + wxT("><r>") + m_nameCell->ListToXML() + wxT("</r>") +
-         m_argCell->ListToXML() + wxT("</fn>");
+  out += wxT("<fn") + flags + wxT("><r>");
+  m_nameCell->AppendListXML(out);
+  out += wxT("</r>");
+  m_argCell->AppendListXML(out);
+  out += wxT("</fn>");
 }
 
 wxString FunCell::ToMathML()
@@ -55,6 +55,7 @@ public:
   FunCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   FunCell(const FunCell &cell);
   Cell *Copy() override {return new FunCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~FunCell();
   FunCell &operator=(const FunCell&) = delete;
 
@@ -80,6 +81,8 @@ public:
 
   wxString ToXML() override;
 
+  void AppendXML(wxString &out) override;
+
   wxString ToOMML() override;
 
   bool BreakUp() override;
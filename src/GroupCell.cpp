@@ -529,6 +529,7 @@ void GroupCell::RemoveOutput()
   m_numberedAnswersCount = 0;
   if (m_output == NULL)
     return;
+  ClearTile();
   // If there is nothing to do we can skip the rest of this action.
 
   if((m_cellPointers->m_answerCell) &&(m_cellPointers->m_answerCell->GetGroup() == this))
@@ -667,6 +668,8 @@ void GroupCell::UpdateConfusableCharWarnings()
 
 void GroupCell::Recalculate()
 {
+  EvaluationStats::Timer timer(m_evaluationStats, &EvaluationStats::AddLayoutTime);
+  ClearTile();
   m_fontSize = (*m_configuration)->GetDefaultFontSize();
   m_mathFontSize = (*m_configuration)->GetMathFontSize();
   GroupCell::RecalculateWidths((*m_configuration)->GetDefaultFontSize());
@@ -927,6 +930,11 @@ void GroupCell::RecalculateHeightOutput()
     tmp = tmp->m_nextToDraw;
   }
 
+  // Reserve a line below the output for the timings of the evaluation
+  int statsHeight = EvaluationStatsHeight();
+  m_height            += statsHeight;
+  m_outputRect.height += statsHeight;
+
   ResetData();
   
   // Move all cells that follow the current one down by the amount this cell has grown.
@@ -1006,6 +1014,7 @@ int GroupCell::GetInputIndent()
 
 void GroupCell::Draw(wxPoint point)
 {
+  EvaluationStats::Timer timer(m_evaluationStats, &EvaluationStats::AddDrawTime);
   if ((m_width < 1 || m_height < 1) ||
       ((GetEditable() != NULL) &&
      (
@@ -1079,6 +1088,8 @@ void GroupCell::Draw(wxPoint point)
 
           tmp = tmp->m_nextToDraw;
         }
+        if (configuration->ShowEvaluationStats())
+          DrawEvaluationStats();
       }
       if ((configuration->ShowCodeCells()) ||
           (m_groupType != GC_TYPE_CODE))
@@ -1109,6 +1120,46 @@ void GroupCell::Draw(wxPoint point)
   }
 }
 
+wxFont GroupCell::EvaluationStatsFont()
+{
+  Configuration *configuration = (*m_configuration);
+  return configuration->GetFont(TS_LABEL, configuration->GetDefaultFontSize() * 3 / 4);
+}
+
+int GroupCell::EvaluationStatsHeight()
+{
+  Configuration *configuration = (*m_configuration);
+  if ((m_groupType != GC_TYPE_CODE) || (!m_evaluationStats.Valid()) ||
+      (!configuration->ShowEvaluationStats()))
+    return 0;
+
+  wxDC *dc = configuration->GetDC();
+  dc->SetFont(EvaluationStatsFont());
+  return dc->GetCharHeight() + MC_TEXT_PADDING;
+}
+
+void GroupCell::DrawEvaluationStats()
+{
+  if ((m_groupType != GC_TYPE_CODE) || (!m_evaluationStats.Valid()))
+    return;
+
+  Configuration *configuration = (*m_configuration);
+  wxDC *dc = configuration->GetDC();
+  wxString stats = m_evaluationStats.ToString();
+
+  dc->SetFont(EvaluationStatsFont());
+  dc->SetTextForeground(configuration->GetColor(TS_LABEL));
+  wxCoord width, height;
+  dc->GetTextExtent(stats, &width, &height);
+
+  // Right-align the timings in the line RecalculateHeightOutput() has
+  // reserved for them below the output.
+  int x = configuration->GetCanvasSize().GetWidth() - width - MC_TEXT_PADDING;
+  if (x < m_outputRect.GetLeft())
+    x = m_outputRect.GetLeft();
+  dc->DrawText(stats, x, m_outputRect.GetTop() + m_outputRect.GetHeight() - height);
+}
+
 wxRect GroupCell::GetRect(bool WXUNUSED(all))
 {
   return wxRect(m_currentPoint.x, m_currentPoint.y - m_center,
@@ -1459,7 +1510,7 @@ wxString GroupCell::ToRTF()
   Cell *out = GetLabel();
   if (out != NULL)
   {
-    retval += out->ListToRTF(true);
+    out->AppendListRTF(retval, true);
   }
   return retval;
 }
@@ -1698,14 +1749,20 @@ wxString GroupCell::ToTeXImage(Cell *tmp, wxString imgDir, wxString filename, in
 
 wxString GroupCell::ToXML()
 {
-  wxString str;
-  str = wxT("\n<cell"); // start opening tag
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void GroupCell::AppendXML(wxString &out)
+{
+  out += wxT("\n<cell"); // start opening tag
   // write "type" according to m_groupType
   switch (m_groupType)
   {
     case GC_TYPE_CODE:
     {
-      str += wxT(" type=\"code\"");
+      out += wxT(" type=\"code\"");
       int i = 0;
       for(StringHash::const_iterator it = m_knownAnswers.begin();
           it != m_knownAnswers.end();
@@ -1719,56 +1776,56 @@ wxString GroupCell::ToXML()
         question.Replace(wxT("\n"),wxT("&#10;"));
         wxString answer = Cell::XMLescape(it->second);
         answer.Replace(wxT("\n"),wxT("&#10;"));
-        str += wxString::Format(wxT(" question%i=\""),i) + question + wxT("\"");
-        str += wxString::Format(wxT(" answer%i=\""),i) + answer + wxT("\"");
+        out += wxString::Format(wxT(" question%i=\""),i) + question + wxT("\"");
+        out += wxString::Format(wxT(" answer%i=\""),i) + answer + wxT("\"");
       }
       
       if(m_autoAnswer)
-        str += wxT(" auto_answer=\"yes\"");
+        out += wxT(" auto_answer=\"yes\"");
       break;
     }
     case GC_TYPE_IMAGE:
-      str += wxT(" type=\"image\"");
+      out += wxT(" type=\"image\"");
       break;
     case GC_TYPE_TEXT:
-      str += wxT(" type=\"text\"");
+      out += wxT(" type=\"text\"");
       break;
     case GC_TYPE_TITLE:
-      str += wxT(" type=\"title\" sectioning_level=\"1\"");
+      out += wxT(" type=\"title\" sectioning_level=\"1\"");
       break;
     case GC_TYPE_SECTION:
-      str += wxT(" type=\"section\" sectioning_level=\"2\"");
+      out += wxT(" type=\"section\" sectioning_level=\"2\"");
       break;
     case GC_TYPE_SUBSECTION:
-      str += wxT(" type=\"subsection\" sectioning_level=\"3\"");
+      out += wxT(" type=\"subsection\" sectioning_level=\"3\"");
       break;
     case GC_TYPE_SUBSUBSECTION:
       // We save subsubsections as subsections with a higher sectioning level:
       // This makes them backwards-compatible in the way that they are displayed
       // as subsections on old wxMaxima installations.
-      str += wxT(" type=\"subsection\" sectioning_level=\"4\"");
+      out += wxT(" type=\"subsection\" sectioning_level=\"4\"");
       break;
     case GC_TYPE_HEADING5:
-      str += wxT(" type=\"subsection\" sectioning_level=\"5\"");
+      out += wxT(" type=\"subsection\" sectioning_level=\"5\"");
       break;
     case GC_TYPE_HEADING6:
-      str += wxT(" type=\"subsection\" sectioning_level=\"6\"");
+      out += wxT(" type=\"subsection\" sectioning_level=\"6\"");
       break;
     case GC_TYPE_PAGEBREAK:
     {
-      str += wxT(" type=\"pagebreak\"/>");
-      return str;
+      out += wxT(" type=\"pagebreak\"/>");
+      return;
     }
       break;
     default:
-      str += wxT(" type=\"unknown\"");
+      out += wxT(" type=\"unknown\"");
       break;
   }
 
   // write hidden status
   if (m_isHidden)
-    str += wxT(" hide=\"true\"");
-  str += wxT(">\n");
+    out += wxT(" hide=\"true\"");
+  out += wxT(">\n");
 
   Cell *input = GetInput();
   Cell *output = GetLabel();
@@ -1778,27 +1835,27 @@ wxString GroupCell::ToXML()
     case GC_TYPE_CODE:
       if (input != NULL)
       {
-        str += wxT("<input>\n");
-        str += input->ListToXML();
-        str += wxT("</input>");
+        out += wxT("<input>\n");
+        input->AppendListXML(out);
+        out += wxT("</input>");
       }
       if (output != NULL)
       {
-        str += wxT("\n<output>\n");
-        str += wxT("<mth>");
-        str += output->ListToXML();
-        str += wxT("\n</mth></output>");
+        out += wxT("\n<output>\n");
+        out += wxT("<mth>");
+        output->AppendListXML(out);
+        out += wxT("\n</mth></output>");
       }
       break;
     case GC_TYPE_IMAGE:
       if (input != NULL)
-        str += input->ListToXML();
+        input->AppendListXML(out);
       if (output != NULL)
-        str += output->ListToXML();
+        output->AppendListXML(out);
       break;
     case GC_TYPE_TEXT:
       if (input)
-        str += input->ListToXML();
+        input->AppendListXML(out);
       break;
     case GC_TYPE_TITLE:
     case GC_TYPE_SECTION:
@@ -1807,12 +1864,12 @@ wxString GroupCell::ToXML()
     case GC_TYPE_HEADING5:
     case GC_TYPE_HEADING6:
       if (input)
-        str += input->ListToXML();
+        input->AppendListXML(out);
       if (m_hiddenTree)
       {
-        str += wxT("<fold>");
-        str += m_hiddenTree->ListToXML();
-        str += wxT("</fold>");
+        out += wxT("<fold>");
+        m_hiddenTree->AppendListXML(out);
+        out += wxT("</fold>");
       }
       break;
     default:
@@ -1820,15 +1877,13 @@ wxString GroupCell::ToXML()
       Cell *tmp = output;
       while (tmp != NULL)
       {
-        str += tmp->ListToXML();
+        tmp->AppendListXML(out);
         tmp = tmp->m_next;
       }
       break;
     }
   }
-  str += wxT("\n</cell>\n");
-
-  return str;
+  out += wxT("\n</cell>\n");
 }
 
 void GroupCell::SelectRectGroup(const wxRect &rect, const wxPoint &one, const wxPoint &two,
@@ -1965,7 +2020,7 @@ wxString GroupCell::GetToolTip(const wxPoint &point)
     m_cellPointers->m_cellUnderPointer = this;
   }
   
-  wxString retval = m_toolTip;
+  wxString retval = GetLocalToolTip();
 
   if (m_isHidden)
     return retval;
@@ -2198,6 +2253,7 @@ void GroupCell::Hide(bool hide)
     return;
 
   m_isHidden = hide;
+  ClearTile();
   if ((m_groupType == GC_TYPE_TEXT) || (m_groupType == GC_TYPE_CODE))
     GetEditable()->SetFirstLineOnly(m_isHidden);
 
@@ -32,6 +32,7 @@
 
 #include "Cell.h"
 #include "EditorCell.h"
+#include "EvaluationStats.h"
 
 #define EMPTY_INPUT_LABEL wxT(" -->  ")
 
@@ -69,6 +70,7 @@ public:
   GroupCell(Configuration **config, GroupType groupType, CellPointers *cellPointers, wxString initString = wxEmptyString);
   GroupCell(const GroupCell &cell);
   Cell *Copy() override {return new GroupCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~GroupCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
@@ -204,6 +206,9 @@ public:
 
   wxString ToXML() override;
 
+  //! Append the representation ToXML() returns to out
+  void AppendXML(wxString &out) override;
+
   void Hide(bool hide);
 
   void SwitchHide();
@@ -422,6 +427,45 @@ public:
   //! Called on MathCtrl resize
   void OnSize();
 
+  //! The timings collected during the last evaluation of this cell
+  EvaluationStats &GetEvaluationStats()
+  { return m_evaluationStats; }
+
+  //! Draw the timings of the last evaluation below the output
+  void DrawEvaluationStats();
+
+  /*! An offscreen image of this cell's contents
+
+    Worksheet::OnPaint() blits this image instead of drawing the cell again if
+    the cell has neither moved nor changed since the image was drawn. The
+    bracket isn't part of the image as it changes on every mouse movement.
+   */
+  class Tile
+  {
+  public:
+    //! The image
+    wxBitmap m_bitmap;
+    //! The part of the worksheet the image shows
+    wxRect m_rect;
+    //! The zoom factor the image was drawn with
+    double m_zoomFactor;
+    //! The content scale factor of the screen the image was drawn for
+    double m_scale;
+    //! The Worksheet's tile generation at the time the image was drawn
+    long m_generation;
+    //! The search string that was highlighted in the image
+    wxString m_selectionString;
+    //! Did the image contain the evaluation timings?
+    bool m_showEvaluationStats;
+  };
+
+  //! The offscreen image of this cell, or NULL if there is none
+  Tile *GetTile() const {return m_tile.get();}
+  //! Set the offscreen image of this cell. The cell takes ownership of the tile.
+  void SetTile(Tile *tile){m_tile = std::unique_ptr<Tile>(tile);}
+  //! Forget the offscreen image of this cell, for example as its contents have changed.
+  void ClearTile(){m_tile.reset();}
+
   //! Reset the data when the input size changes
   void InputHeightChanged();
 
@@ -533,6 +577,14 @@ private:
   //! The number of cells the current group contains (-1, if no GroupCell)
   int m_cellsInGroup;
   int m_numberedAnswersCount;
+  //! The timings collected during the last evaluation of this cell
+  EvaluationStats m_evaluationStats;
+  //! The font the timings of the evaluation are drawn with
+  wxFont EvaluationStatsFont();
+  //! The height of the line below the output the timings are drawn in; 0 = none
+  int EvaluationStatsHeight();
+  //! The offscreen image of this cell
+  std::unique_ptr<Tile> m_tile;
   void UpdateCellsInGroup(){
     if(m_output != NULL)
       m_cellsInGroup = 2 + m_output->CellsInListRecursive();
@@ -0,0 +1,218 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file defines the class HelpAnchors.
+ */
+
+#include "HelpAnchors.h"
+#include <wx/file.h>
+#include <wx/filename.h>
+#include "Dirstructure.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//! Reads a file into memory in one go
+static bool ReadWholeFile(wxString name, std::vector<char> &data)
+{
+  if(!wxFileExists(name))
+    return false;
+  wxFile file(name);
+  if(!file.IsOpened())
+    return false;
+  wxFileOffset length = file.Length();
+  if(length <= 0)
+    return false;
+  data.resize(length);
+  return file.Read(data.data(), length) == length;
+}
+
+wxString HelpAnchors::CacheFile()
+{
+  return Dirstructure::CacheDir() + wxT("/helpanchors.txt");
+}
+
+wxString HelpAnchors::Header(wxString manual)
+{
+  wxFileName manualFile(manual);
+  wxULongLong size = manualFile.GetSize();
+  if((!manualFile.FileExists()) || (size == wxInvalidSize))
+    return wxEmptyString;
+  return wxString::Format(wxT("wxMaxima help anchors 1\t%s\t%s\t%li"),
+                          manual, size.ToString(),
+                          (long) manualFile.GetModificationTime().GetTicks());
+}
+
+bool HelpAnchors::Load(wxString manual, AnchorMap &anchors)
+{
+  wxString header = Header(manual);
+  if(header.IsEmpty())
+    return false;
+  std::vector<char> data;
+  if(!ReadWholeFile(CacheFile(), data))
+    return false;
+
+  const char *pos = data.data();
+  const char *end = pos + data.size();
+  const char *lineEnd = std::find(pos, end, '\n');
+  if(wxString::FromUTF8(pos, lineEnd - pos) != header)
+    return false;
+
+  AnchorMap cached;
+  for(pos = lineEnd + 1; pos < end; pos = lineEnd + 1)
+  {
+    lineEnd = std::find(pos, end, '\n');
+    const char *tab = std::find(pos, lineEnd, '\t');
+    if(tab == lineEnd)
+      continue;
+    cached[wxString::FromUTF8(pos, tab - pos)] = wxString::FromUTF8(tab + 1, lineEnd - tab - 1);
+  }
+  anchors.swap(cached);
+  return true;
+}
+
+void HelpAnchors::Save(wxString manual, const AnchorMap &anchors)
+{
+  wxString header = Header(manual);
+  if(header.IsEmpty())
+    return;
+  // CacheDir() has created the directory already.
+  wxString dir = wxFileName(CacheFile()).GetPath();
+
+  std::string contents(header.utf8_str());
+  contents += '\n';
+  for(AnchorMap::const_iterator it = anchors.begin(); it != anchors.end(); ++it)
+  {
+    contents += it->first.utf8_str();
+    contents += '\t';
+    contents += it->second.utf8_str();
+    contents += '\n';
+  }
+
+  wxString tempFile = wxFileName::CreateTempFileName(dir + wxT("/helpanchors_"));
+  if(tempFile.IsEmpty())
+    return;
+  bool written;
+  {
+    wxFile file(tempFile, wxFile::write);
+    written = file.IsOpened() && (file.Write(contents.data(), contents.length()) == contents.length());
+  }
+  if((!written) || (!wxRenameFile(tempFile, CacheFile(), true)))
+    wxRemoveFile(tempFile);
+}
+
+//! Can this character be part of an anchor name?
+static inline bool IsIdChar(char ch)
+{
+  return ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) ||
+    ((ch >= '0') && (ch <= '9')) || (ch == '_') || (ch == '-');
+}
+
+/*! The last non-empty id introduced by prefix in the text between start and end
+
+  The id has to be followed by a closing quote. Whatever follows the quote is
+  appended to the id, which lets KeywordFromId() reject tags that contain
+  more than the id.
+ */
+static std::string LastId(const char *start, const char *end, const char *prefix)
+{
+  std::string id;
+  const char *prefixEnd = prefix + strlen(prefix);
+  const char *pos = start;
+  while((pos = std::search(pos, end, prefix, prefixEnd)) != end)
+  {
+    pos += prefixEnd - prefix;
+    const char *idEnd = pos;
+    while((idEnd < end) && IsIdChar(*idEnd))
+      idEnd++;
+    if((idEnd < end) && (*idEnd == '"') && (idEnd > pos))
+    {
+      id.assign(pos, idEnd);
+      id.append(idEnd + 1, end);
+    }
+  }
+  return id;
+}
+
+/*! The keyword an anchor belongs to
+
+  texinfo encodes special characters in anchor names: "_005f" is an underscore,
+  for example. Returns an empty string for anchors that don't belong to a
+  single keyword.
+ */
+static std::string KeywordFromId(const std::string &id)
+{
+  std::string keyword;
+  keyword.reserve(id.length());
+  for(size_t i = 0; i < id.length(); i++)
+  {
+    if((id[i] == '-') || (id[i] == ' ') || (id[i] == '\t'))
+      return std::string();
+    keyword += id[i];
+    if((id[i] != '_') || (i + 2 >= id.length()) || (id[i + 1] != '0'))
+      continue;
+    size_t j = i + 2;
+    while((j < id.length()) && (id[j] >= '0') && (id[j] <= '9'))
+      j++;
+    if((j > i + 2) && (j < id.length()) && (id[j] >= 'a') && (id[j] <= 'z'))
+      i = j;
+  }
+  return keyword;
+}
+
+long HelpAnchors::Scan(wxString manual, AnchorMap &anchors)
+{
+  std::vector<char> data;
+  if(!ReadWholeFile(manual, data))
+    return 0;
+
+  long foundAnchors = 0;
+  const char *pos = data.data();
+  const char *end = pos + data.size();
+  while(pos < end)
+  {
+    // Tags end in a ">", which means that a tag never spans several tokens.
+    const char *tokenEnd = pos;
+    while((tokenEnd < end) && (*tokenEnd != '>') && (*tokenEnd != '\n') && (*tokenEnd != '\r'))
+      tokenEnd++;
+
+    // Newer manuals mark keywords with a <span id=""...>, older ones with <a name="...">
+    std::string id = LastId(pos, tokenEnd, "<span id=\"");
+    if(id.empty())
+      id = LastId(pos, tokenEnd, "<a name=\"");
+    if(!id.empty())
+    {
+      std::string keyword = KeywordFromId(id);
+      if(!keyword.empty())
+      {
+        anchors[wxString::FromUTF8(keyword.data(), keyword.length())] =
+          wxString::FromUTF8(id.data(), id.length());
+        foundAnchors++;
+      }
+    }
+    pos = tokenEnd + 1;
+  }
+  return foundAnchors;
+}
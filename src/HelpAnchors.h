@@ -0,0 +1,76 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file declares the class HelpAnchors that finds the anchors the
+  HTML version of maxima's manual provides for its keywords.
+ */
+
+#ifndef HELPANCHORS_H
+#define HELPANCHORS_H
+
+#include <wx/wx.h>
+#include <wx/string.h>
+#include <wx/hashmap.h>
+
+/*! Maps the keywords of maxima's manual to the anchors that describe them
+
+  Scanning the manual for anchors takes a second or more, so the result is
+  stored in a cache file next to wxMaxima's other local data. The cache is
+  only used if the manual's path, size and modification time haven't changed
+  since it was written.
+ */
+class HelpAnchors
+{
+public:
+  WX_DECLARE_STRING_HASH_MAP(wxString, AnchorMap);
+
+  /*! Read the anchors for the manual from the cache file
+
+    \return true, if the cache was valid for this manual and has been read.
+   */
+  static bool Load(wxString manual, AnchorMap &anchors);
+
+  /*! Store the anchors that were found in manual in the cache file
+
+    The file is written under a temporary name first so another wxMaxima
+    process never reads a half-written cache.
+   */
+  static void Save(wxString manual, const AnchorMap &anchors);
+
+  /*! Extract the anchors from the HTML manual
+
+    Can be called from any thread.
+    \return The number of anchors that were found.
+   */
+  static long Scan(wxString manual, AnchorMap &anchors);
+
+  //! The file the anchors are cached in
+  static wxString CacheFile();
+
+private:
+  //! The first line of the cache file. Change the version if the format changes.
+  static wxString Header(wxString manual);
+};
+
+#endif // HELPANCHORS_H
@@ -33,13 +33,17 @@
 #include <wx/txtstrm.h>
 #include <wx/regex.h>
 #include <wx/stdpaths.h>
+#include <wx/tokenzr.h>
+#include <vector>
 #include "SvgBitmap.h"
 #include "ErrorRedirector.h"
 
+// Defined below, next to the other compression helpers.
+static wxMemoryBuffer Decompress(const wxMemoryBuffer &compressed);
+
 Image::Image(Configuration **config)
 {
   #ifdef HAVE_OMP_HEADER
-  omp_init_lock(&m_gnuplotLock);
   omp_init_lock(&m_imageLoadLock);
   #endif
   m_configuration = config;
@@ -58,7 +62,6 @@ Image::Image(Configuration **config)
 Image::Image(Configuration **config, wxMemoryBuffer image, wxString type)
 {
   #ifdef HAVE_OMP_HEADER
-  omp_init_lock(&m_gnuplotLock);
   omp_init_lock(&m_imageLoadLock);
   #endif
   m_configuration = config;
@@ -91,7 +94,6 @@ Image::Image(Configuration **config, wxMemoryBuffer image, wxString type)
 Image::Image(Configuration **config, const wxBitmap &bitmap)
 {
   #ifdef HAVE_OMP_HEADER
-  omp_init_lock(&m_gnuplotLock);
   omp_init_lock(&m_imageLoadLock);
   #endif
   m_svgImage = NULL;
@@ -113,7 +115,6 @@ Image::Image(Configuration **config, wxString image, const std::shared_ptr<wxFil
   m_fs_keepalive_imagedata(filesystem)
 {
   #ifdef HAVE_OMP_HEADER
-  omp_init_lock(&m_gnuplotLock);
   omp_init_lock(&m_imageLoadLock);
   #endif
   m_svgImage = NULL;
@@ -130,6 +131,34 @@ Image::Image(Configuration **config, wxString image, const std::shared_ptr<wxFil
   LoadImage(image, filesystem, remove);
 }
 
+Image::Image(const Image &image)
+{
+  #ifdef HAVE_OMP_HEADER
+  omp_init_lock(&m_imageLoadLock);
+  WaitForLoad waitforload(&image.m_imageLoadLock);
+  #endif
+  m_svgImage = NULL;
+  m_svgRast = NULL;
+  m_configuration = image.m_configuration;
+  m_compressedImage = image.m_compressedImage;
+  m_scaledBitmap = image.m_scaledBitmap;
+  m_extension = image.m_extension;
+  m_imageName = image.m_imageName;
+  m_isOk = image.m_isOk;
+  m_width = image.m_width;
+  m_height = image.m_height;
+  m_maxWidth = image.m_maxWidth;
+  m_maxHeight = image.m_maxHeight;
+  m_originalWidth = image.m_originalWidth;
+  m_originalHeight = image.m_originalHeight;
+  m_gnuplotSource = image.m_gnuplotSource;
+  m_gnuplotData = image.m_gnuplotData;
+  m_gnuplotCache = image.m_gnuplotCache;
+  // The parsed svg image belongs to the original => we need our own one.
+  if(image.m_svgImage)
+    ParseSVG(Decompress(m_compressedImage));
+}
+
 Image::~Image()
 {
   m_isOk = false;
@@ -160,20 +189,152 @@ Image::~Image()
   wxDELETE(m_svgImage);
 }
 
-wxMemoryBuffer Image::ReadCompressedImage(wxInputStream *data)
+//! The flags for a zlib stream that writes the best compression format we can handle
+static int ZlibFlags()
+{
+  if(wxZlibOutputStream::CanHandleGZip())
+    return wxZLIB_GZIP;
+  else
+    return wxZLIB_ZLIB;
+}
+
+//! The size of the blocks image and gnuplot files are read and written in
+#define IMAGE_IO_BLOCKSIZE 65536
+
+//! Copies a stream to another one in blocks
+static void CopyBlocks(wxInputStream &input, wxOutputStream &output)
+{
+  std::vector<char> block(IMAGE_IO_BLOCKSIZE);
+  while(input.IsOk() && output.IsOk() && !input.Eof())
+  {
+    input.Read(block.data(), block.size());
+    size_t bytes = input.LastRead();
+    if(bytes == 0)
+      break;
+    output.Write(block.data(), bytes);
+  }
+}
+
+/*! Appends the contents of a stream to a buffer
+
+  The data is read directly into the buffer's memory instead of into a temporary
+  block that is then copied. If the stream knows its length the buffer is
+  allocated in one go, else it grows exponentially so big images don't cause
+  one reallocation per block.
+*/
+static void ReadToBuffer(wxInputStream &input, wxMemoryBuffer &buffer)
+{
+  size_t expectedEnd = 0;
+  wxFileOffset length = input.GetLength();
+  if(length > 0)
+  {
+    expectedEnd = buffer.GetDataLen() + length;
+    buffer.SetBufSize(expectedEnd);
+  }
+
+  while(input.IsOk() && !input.Eof())
+  {
+    size_t blocksize = buffer.GetBufSize() - buffer.GetDataLen();
+    if(blocksize == 0)
+      blocksize = wxMax((size_t)IMAGE_IO_BLOCKSIZE, buffer.GetDataLen());
+    input.Read(buffer.GetAppendBuf(blocksize), blocksize);
+    size_t bytes = input.LastRead();
+    buffer.UngetAppendBuf(bytes);
+    if((bytes == 0) || ((expectedEnd > 0) && (buffer.GetDataLen() >= expectedEnd)))
+      break;
+  }
+}
+
+//! An output stream that appends the data written to it to a wxMemoryBuffer
+class MemoryBufferOutputStream : public wxOutputStream
+{
+public:
+  explicit MemoryBufferOutputStream(wxMemoryBuffer &buffer) : m_buffer(buffer){}
+protected:
+  size_t OnSysWrite(const void *data, size_t size) override
+    {
+      // Grow exponentially instead of by the size of each block written.
+      if(m_buffer.GetDataLen() + size > m_buffer.GetBufSize())
+        m_buffer.SetBufSize(wxMax(m_buffer.GetDataLen() + size, 2 * m_buffer.GetBufSize()));
+      m_buffer.AppendData(data, size);
+      return size;
+    }
+  wxFileOffset OnSysTell() const override {return m_buffer.GetDataLen();}
+private:
+  wxMemoryBuffer &m_buffer;
+};
+
+//! Returns a compressed copy of a stream's contents
+static wxMemoryBuffer CompressStream(wxInputStream &input, int level)
 {
   wxMemoryBuffer retval;
-  
-  char *buf = new char[8192];
+  MemoryBufferOutputStream output(retval);
+  wxZlibOutputStream zstream(output, level, ZlibFlags());
+  if(!zstream.IsOk())
+    return retval;
+  CopyBlocks(input, zstream);
+  zstream.Close();
+  return retval;
+}
 
-  while (data->CanRead())
+//! Returns a compressed copy of a block of memory
+static wxMemoryBuffer CompressData(const void *data, size_t length, int level)
+{
+  wxMemoryBuffer retval;
+  MemoryBufferOutputStream output(retval);
+  wxZlibOutputStream zstream(output, level, ZlibFlags());
+  if(!zstream.IsOk())
+    return retval;
+  zstream.Write(data, length);
+  zstream.Close();
+  return retval;
+}
+
+/*! Returns a compressed copy of a gnuplot source file
+
+  The name of the data file is replaced by a placeholder so the data file can
+  later be moved to the temp directory of another computer.
+*/
+static wxMemoryBuffer CompressGnuplotSource(wxInputStream &input)
+{
+  wxMemoryBuffer raw;
+  ReadToBuffer(input, raw);
+  wxString source = wxString::FromUTF8((const char *)raw.GetData(), raw.GetDataLen());
+
+  // A RegEx that matches the name of the data file (needed if we ever want to
+  // move a data file into the temp directory of a new computer that locates its
+  // temp data somewhere strange).
+  wxRegEx replaceDataFileName("'[^']*maxout_[^']*_[0-9]*\\.data'");
+  wxString processed;
+  processed.reserve(source.Length() + 1);
+  wxStringTokenizer lines(source, wxT("\n"), wxTOKEN_RET_EMPTY_ALL);
+  while(lines.HasMoreTokens())
   {
-    data->Read(buf, 8192);
-    size_t siz;
-    retval.AppendData(buf, siz = data->LastRead());
+    wxString line = lines.GetNextToken();
+    if(line.Contains(wxT("maxout_")) && replaceDataFileName.Matches(line))
+      replaceDataFileName.Replace(&line,wxT("'<DATAFILENAME>'"));
+    processed += line + wxT("\n");
   }
 
-  delete[] buf;
+  wxScopedCharBuffer utf8 = processed.utf8_str();
+  return CompressData(utf8.data(), utf8.length(), wxZ_BEST_COMPRESSION);
+}
+
+//! Returns the uncompressed contents of a gzip- or zlib-compressed buffer
+static wxMemoryBuffer Decompress(const wxMemoryBuffer &compressed)
+{
+  wxMemoryBuffer retval;
+  wxMemoryInputStream mstream(compressed.GetData(), compressed.GetDataLen());
+  wxZlibInputStream zstream(mstream);
+  if(zstream.IsOk())
+    ReadToBuffer(zstream, retval);
+  return retval;
+}
+
+wxMemoryBuffer Image::ReadCompressedImage(wxInputStream *data)
+{
+  wxMemoryBuffer retval;
+  ReadToBuffer(*data, retval);
   return retval;
 }
 
@@ -242,28 +403,57 @@ bool Image::IsOk()
   return m_isOk;
 }
 
-
 void Image::GnuplotSource(wxString gnuplotFilename, wxString dataFilename, const std::shared_ptr<wxFileSystem> &filesystem)
 {
-  m_fs_keepalive_gnuplotdata = filesystem;
-  std::shared_ptr<wxFileSystem> keepFilesystemAlive(filesystem);
+  // The file names are set here, not in the background, so asking if this image
+  // has a gnuplot source never needs to wait for the background task.
+  m_gnuplotSource = gnuplotFilename;
+  m_gnuplotData = dataFilename;
+  std::shared_ptr<GnuplotCache> compressing(new GnuplotCache);
+  compressing->m_status = gnuplot_compressing;
+
+  // Everything the background task needs lives in the slot, not in this image:
+  // The image might be copied or deleted before the task has finished.
+  std::shared_ptr<GnuplotCacheSlot> slot(new GnuplotCacheSlot);
+  slot->m_cache = compressing;
+  slot->m_gnuplotFilename = gnuplotFilename;
+  slot->m_dataFilename = dataFilename;
+  slot->m_filesystem = filesystem;
+  slot->m_maxDataBytes = (long long)(*m_configuration)->MaxGnuplotMegabytes() * 1000 * 1000;
+  m_gnuplotCache = slot;
+
   #ifdef HAVE_OPENMP_TASKS
   wxLogMessage(_("Starting background task that loads the gnuplot data for a plot."));
   #pragma omp task
   #endif
-  LoadGnuplotSource_Backgroundtask(gnuplotFilename, dataFilename, filesystem);
+  LoadGnuplotSource_Backgroundtask(slot);
 }
 
-void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString dataFilename, const std::shared_ptr<wxFileSystem> &filesystem)
+void Image::LoadGnuplotSource_Backgroundtask(std::shared_ptr<GnuplotCacheSlot> slot)
 {
   #ifdef HAVE_OMP_HEADER
-  omp_set_lock(&m_gnuplotLock);
+  omp_set_lock(&slot->m_lock);
   #endif
+  // Somebody who needed the files before we were started might have read them already.
+  if(std::atomic_load(&slot->m_cache)->m_status != gnuplot_compressing)
+  {
+    #ifdef HAVE_OMP_HEADER
+    omp_unset_lock(&slot->m_lock);
+    #endif
+    return;
+  }
+
   // Error dialogues need to be created by the foreground thread.
   SuppressErrorDialogs suppressor;
+  wxString gnuplotFilename = slot->m_gnuplotFilename;
+  wxString dataFilename = slot->m_dataFilename;
+  std::shared_ptr<wxFileSystem> filesystem = slot->m_filesystem;
 
-  m_gnuplotSource = gnuplotFilename;
-  m_gnuplotData = dataFilename;
+  // The results are collected in a new object that replaces the current one as
+  // a whole when it is complete: Nobody has to wait for a lock while the files
+  // are read and compressed.
+  std::shared_ptr<GnuplotCache> cache(new GnuplotCache);
+  cache->m_status = gnuplot_ready;
 
   if(filesystem == NULL)
   {
@@ -272,399 +462,180 @@ void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString
       // Don't cache the data for unreasonably long files.
       wxStructStat strucStat;
       wxStat(dataFilename, &strucStat);
-      if (strucStat.st_size > (*m_configuration)->MaxGnuplotMegabytes()*1000*1000)
+      if (strucStat.st_size > slot->m_maxDataBytes)
       {
         wxLogMessage(_("Too much gnuplot data => Not storing it in the worksheet"));
-        m_gnuplotData_Compressed.Clear();
-        #ifdef HAVE_OMP_HEADER
-        omp_unset_lock(&m_gnuplotLock);
-        #endif
-        return;
+        cache->m_status = gnuplot_none;
       }
-      
-      // The gnuplot source of the image is cached in a compressed form:
-      //
-      // as it is text-only and contains many redundancies it will get way
-      // smaller this way.
+      else
       {
-        wxFileInputStream input(m_gnuplotSource);
-        if(input.IsOk())
-        {
-          wxTextInputStream textIn(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-      
-          wxMemoryOutputStream mstream;
-          int zlib_flags;
-          if(wxZlibOutputStream::CanHandleGZip())
-            zlib_flags = wxZLIB_GZIP;
-          else
-            zlib_flags = wxZLIB_ZLIB;
-          wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-          wxTextOutputStream textOut(zstream);
-          wxString line;
-      
-          // A RegEx that matches the name of the data file (needed if we ever want to
-          // move a data file into the temp directory of a new computer that locates its
-          // temp data somewhere strange).
-          wxRegEx replaceDataFileName("'[^']*maxout_[^']*_[0-9]*\\.data'");
-          while(!input.Eof())
-          {
-            line = textIn.ReadLine();
-            if(replaceDataFileName.Matches(line))
-            {
-              wxString dataFileName;
-              dataFileName = replaceDataFileName.GetMatch(line);
-              replaceDataFileName.Replace(&line,wxT("'<DATAFILENAME>'"));
-            }
-            textOut << line + wxT("\n");
-          }
-          textOut.Flush();
-          zstream.Close();
-      
-          m_gnuplotSource_Compressed.Clear();
-          m_gnuplotSource_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                                mstream.GetOutputStreamBuffer()->GetBufferSize());
-        }
-    
-        {
-          wxFileInputStream input2(m_gnuplotData);
-          if(input2.IsOk())
-          {
-            wxTextInputStream textIn(input2, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-      
-            wxMemoryOutputStream mstream;
-            int zlib_flags;
-            if(wxZlibOutputStream::CanHandleGZip())
-              zlib_flags = wxZLIB_GZIP;
-            else
-              zlib_flags = wxZLIB_ZLIB;
-            wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-            wxTextOutputStream textOut(zstream);
-            wxString line;
-      
-            while(!input2.Eof())
-            {
-              line = textIn.ReadLine();
-              textOut << line + wxT("\n");
-            }
-            textOut.Flush();
-            zstream.Close();
-      
-            m_gnuplotData_Compressed.Clear();
-            m_gnuplotData_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                                mstream.GetOutputStreamBuffer()->GetBufferSize());
-          }
-        }
+        // The gnuplot source of the image is cached in a compressed form:
+        //
+        // as it is text-only and contains many redundancies it will get way
+        // smaller this way.
+        wxFileInputStream source(gnuplotFilename);
+        if(source.IsOk())
+          cache->m_source = CompressGnuplotSource(source);
+
+        // The data can be big and is only needed for saving the worksheet and for
+        // popping out the plot => Don't spend as much time as we can afford on
+        // compressing the source.
+        wxFileInputStream data(dataFilename);
+        if(data.IsOk())
+          cache->m_data = CompressStream(data, wxZ_DEFAULT_COMPRESSION);
       }
     }
+    else
+      cache->m_status = gnuplot_none;
   }
   else
   {
-    {
-      wxFSFile *fsfile;
-      #ifdef HAVE_OPENMP_TASKS
-      #pragma omp critical (OpenFSFile)
-      #endif
-      fsfile = filesystem->OpenFile(m_gnuplotSource);
-      if (fsfile)
-      { // open successful
-        std::unique_ptr<wxInputStream> input(fsfile->GetStream());
-        if(input->IsOk())
-        {
-          wxTextInputStream textIn(*input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-          
-          wxMemoryOutputStream mstream;
-          int zlib_flags;
-          if(wxZlibOutputStream::CanHandleGZip())
-            zlib_flags = wxZLIB_GZIP;
-          else
-            zlib_flags = wxZLIB_ZLIB;
-          if(!input->Eof())
-          {
-            wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-            if(zstream.IsOk())
-            {
-              wxTextOutputStream textOut(zstream);
-              wxString line;
-          
-              // A RegEx that matches the name of the data file (needed if we ever want to
-              // move a data file into the temp directory of a new computer that locates its
-              // temp data somewhere strange).
-              wxRegEx replaceDataFileName("'[^']*maxout_[^']*_[0-9*]\\.data'");
-              while(!input->Eof())
-              {
-                line = textIn.ReadLine();
-                if(replaceDataFileName.Matches(line))
-                {
-                  wxString dataFileName;
-                  dataFileName = replaceDataFileName.GetMatch(line);
-                  if(dataFileName != wxEmptyString)
-                    wxLogMessage(_("Gnuplot Data File Name: ") + dataFileName);
-                  replaceDataFileName.Replace(&line,wxT("'<DATAFILENAME>'"));
-                }
-                textOut << line + wxT("\n");
-              }
-              textOut.Flush();
-              zstream.Close();
-              m_gnuplotSource_Compressed.Clear();
-              m_gnuplotSource_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                                    mstream.GetOutputStreamBuffer()->GetBufferSize());
-            }
-          }
-        }
-      }
+    wxFSFile *fsfile;
+    #ifdef HAVE_OPENMP_TASKS
+    #pragma omp critical (OpenFSFile)
+    #endif
+    fsfile = filesystem->OpenFile(gnuplotFilename);
+    if (fsfile)
+    { // open successful
+      std::unique_ptr<wxFSFile> file(fsfile);
+      wxInputStream *input = file->GetStream();
+      if(input && input->IsOk())
+        cache->m_source = CompressGnuplotSource(*input);
     }
-    {
-      wxFSFile *fsfile;
-      #ifdef HAVE_OPENMP_TASKS
-      #pragma omp critical (OpenFSFile)
-      #endif
-      fsfile = filesystem->OpenFile(m_gnuplotData);
-      if (fsfile)
-      { // open successful
-        wxInputStream *input = fsfile->GetStream();
-        if(input->IsOk())
-        {
-          wxTextInputStream textIn(*input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-            
-          wxMemoryOutputStream mstream;
-          int zlib_flags;
-          if(wxZlibOutputStream::CanHandleGZip())
-            zlib_flags = wxZLIB_GZIP;
-          else
-            zlib_flags = wxZLIB_ZLIB;
-          if(!input->Eof())
-          {
-            wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,zlib_flags);
-            if(zstream.IsOk())
-            {
-              wxTextOutputStream textOut(zstream);
-              wxString line;
-              
-              while(!input->Eof())
-              {
-              line = textIn.ReadLine();
-              textOut << line + wxT("\n");
-              }
-              textOut.Flush();
-              zstream.Close();
-              
-              m_gnuplotData_Compressed.Clear();
-              m_gnuplotData_Compressed.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                                  mstream.GetOutputStreamBuffer()->GetBufferSize());
-            }
-          }
-        }
-      }
+
+    #ifdef HAVE_OPENMP_TASKS
+    #pragma omp critical (OpenFSFile)
+    #endif
+    fsfile = filesystem->OpenFile(dataFilename);
+    if (fsfile)
+    { // open successful
+      std::unique_ptr<wxFSFile> file(fsfile);
+      wxInputStream *input = file->GetStream();
+      if(input && input->IsOk())
+        cache->m_data = CompressStream(*input, wxZ_DEFAULT_COMPRESSION);
     }
   }
-  m_fs_keepalive_gnuplotdata.reset();
+  std::atomic_store(&slot->m_cache, std::shared_ptr<const GnuplotCache>(cache));
+  // The files are no more needed.
+  slot->m_filesystem.reset();
   #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
+  omp_unset_lock(&slot->m_lock);
   #endif
 }
 
-wxMemoryBuffer Image::GetGnuplotSource()
+Image::GnuplotStatus Image::GetGnuplotStatus() const
 {
-  wxMemoryBuffer retval;
-  #ifdef HAVE_OMP_HEADER
-  omp_set_lock(&m_gnuplotLock);
-  #else
-  #ifdef HAVE_OPENMP_TASKS
-  #pragma omp taskwait
-  #endif
-  #endif
-  {  
-    if(
-      (m_gnuplotSource_Compressed.GetDataLen() < 2) || 
-      (m_gnuplotData_Compressed.GetDataLen() < 2))
-    {
-      #ifdef HAVE_OMP_HEADER
-      omp_unset_lock(&m_gnuplotLock);
-      #endif
-      return retval;
-    }
-    wxMemoryOutputStream output;
-    wxTextOutputStream textOut(output);
-    if(output.IsOk())
-    {
-      wxMemoryInputStream mstream(
-        m_gnuplotSource_Compressed.GetData(),
-        m_gnuplotSource_Compressed.GetDataLen()
-        );
-      wxZlibInputStream zstream(mstream);
-      wxTextInputStream textIn(zstream);
-      wxString line;
-  
-      while(!zstream.Eof())
-      {
-        line = textIn.ReadLine();
-        textOut << line + wxT("\n");
-      }
-      textOut.Flush();
+  if(!m_gnuplotCache)
+    return gnuplot_none;
+  return std::atomic_load(&m_gnuplotCache->m_cache)->m_status;
+}
 
-      retval.AppendData(output.GetOutputStreamBuffer()->GetBufferStart(),
-                        output.GetOutputStreamBuffer()->GetBufferSize());
-    }
+std::shared_ptr<const Image::GnuplotCache> Image::GnuplotCacheWhenReady()
+{
+  if(!m_gnuplotCache)
+    return std::shared_ptr<const GnuplotCache>();
+  std::shared_ptr<const GnuplotCache> cache = std::atomic_load(&m_gnuplotCache->m_cache);
+  if(cache->m_status == gnuplot_compressing)
+  {
+    // Reads the files if the background task hasn't started yet and waits for
+    // it if it has.
+    LoadGnuplotSource_Backgroundtask(m_gnuplotCache);
+    cache = std::atomic_load(&m_gnuplotCache->m_cache);
   }
-  #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
-  #endif
+  return cache;
+}
 
-  return retval;
+wxMemoryBuffer Image::GetCompressedGnuplotSource()
+{
+  std::shared_ptr<const GnuplotCache> cache = GnuplotCacheWhenReady();
+  if((!cache) ||
+     (cache->m_source.GetDataLen() < 2) || 
+     (cache->m_data.GetDataLen() < 2))
+    return wxMemoryBuffer();
+
+  return cache->m_source;
 }
 
-wxMemoryBuffer Image::GetGnuplotData()
+wxMemoryBuffer Image::GetCompressedGnuplotData()
 {
-  wxMemoryBuffer retval;
-  #ifdef HAVE_OMP_HEADER
-  omp_set_lock(&m_gnuplotLock);
-  #else
-  #ifdef HAVE_OPENMP_TASKS
-  #pragma omp taskwait
-  #endif
-  #endif
+  std::shared_ptr<const GnuplotCache> cache = GnuplotCacheWhenReady();
+  if((!cache) ||
+     (cache->m_source.GetDataLen() < 2) || 
+     (cache->m_data.GetDataLen() < 2))
+    return wxMemoryBuffer();
+
+  return cache->m_data;
+}
+
+wxString Image::GnuplotData()
+{
+  if((!m_gnuplotData.IsEmpty()) && (!wxFileExists(m_gnuplotData)))
   {
-    if(
-      (m_gnuplotSource_Compressed.GetDataLen() < 2) || 
-      (m_gnuplotData_Compressed.GetDataLen() < 2))
+    std::shared_ptr<const GnuplotCache> cache = GnuplotCacheWhenReady();
+
+    // Move the gnuplot data and data file into our temp directory
+    wxFileName gnuplotSourceFile(m_gnuplotSource);
+    m_gnuplotSource = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotSourceFile.GetFullName();
+    wxFileName gnuplotDataFile(m_gnuplotData);
+    m_gnuplotData = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotDataFile.GetFullName();
+
+    if((!cache) || (cache->m_data.GetDataLen() <= 1))
     {
-      #ifdef HAVE_OMP_HEADER
-      omp_unset_lock(&m_gnuplotLock);
-      #endif
-      return retval;
+      wxLogMessage(_("No gnuplot data!"));
+      return wxEmptyString;
     }
-    
-    wxMemoryOutputStream output;
-    wxTextOutputStream textOut(output);
+
+    wxFileOutputStream output(m_gnuplotData);
     if(output.IsOk())
     {
-      wxMemoryInputStream mstream(
-        m_gnuplotData_Compressed.GetData(),
-        m_gnuplotData_Compressed.GetDataLen()
-        );
+      wxMemoryInputStream mstream(cache->m_data.GetData(), cache->m_data.GetDataLen());
       wxZlibInputStream zstream(mstream);
-      wxTextInputStream textIn(zstream);
-      wxString line;
-  
-      while(!zstream.Eof())
-      {
-        line = textIn.ReadLine();
-        textOut << line + wxT("\n");
-      }
-      textOut.Flush();
-
-      retval.AppendData(output.GetOutputStreamBuffer()->GetBufferStart(),
-                        output.GetOutputStreamBuffer()->GetBufferSize());
+      if(zstream.IsOk())
+        CopyBlocks(zstream, output);
     }
   }
-  #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
-  #endif
-  return retval;
+  return m_gnuplotData;
 }
 
-wxString Image::GnuplotData()
+wxString Image::GnuplotSource()
 {
-  if((!m_gnuplotData.IsEmpty()) && (!wxFileExists(m_gnuplotData)))
+  if((!m_gnuplotSource.IsEmpty()) && (!wxFileExists(m_gnuplotSource)))
   {
-    #ifdef HAVE_OMP_HEADER
-    omp_set_lock(&m_gnuplotLock);
-    #else
-    #ifdef HAVE_OPENMP_TASKS
-    #pragma omp taskwait
-    #endif
-    #endif
+    std::shared_ptr<const GnuplotCache> cache = GnuplotCacheWhenReady();
+
+    // Move the gnuplot source and data file into our temp directory
+    wxFileName gnuplotSourceFile(m_gnuplotSource);
+    m_gnuplotSource = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotSourceFile.GetFullName();
+    wxFileName gnuplotDataFile(m_gnuplotData);
+    m_gnuplotData = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotDataFile.GetFullName();
+
+    if((!cache) || (cache->m_source.GetDataLen() <= 1))
     {
-    // Move the gnuplot data and data file into our temp directory
-      wxFileName gnuplotSourceFile(m_gnuplotSource);
-      m_gnuplotSource = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotSourceFile.GetFullName();
-      wxFileName gnuplotDataFile(m_gnuplotData);
-      m_gnuplotData = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotDataFile.GetFullName();
-
-      wxFileOutputStream output(m_gnuplotData);
-      wxTextOutputStream textOut(output);
-      if(output.IsOk())
+      wxLogMessage(_("No gnuplot source!"));
+      return wxEmptyString;
+    }
+
+    wxFileOutputStream output(m_gnuplotSource);
+    wxTextOutputStream textOut(output);
+    if(output.IsOk())
+    {
+      wxMemoryInputStream mstream(cache->m_source.GetData(), cache->m_source.GetDataLen());
+      wxZlibInputStream zstream(mstream);
+      if(zstream.IsOk())
       {
-        if(m_gnuplotData_Compressed.GetDataLen() <= 1)
-        {
-          wxLogMessage(_("No gnuplot data!"));
-          return wxEmptyString;
-        }
-        wxMemoryInputStream mstream(
-          m_gnuplotData_Compressed.GetData(),
-          m_gnuplotData_Compressed.GetDataLen()
-          );
-        wxZlibInputStream zstream(mstream);
         wxTextInputStream textIn(zstream);
         wxString line;
-  
+          
         while(!zstream.Eof())
         {
           line = textIn.ReadLine();
+          line.Replace(wxT("'<DATAFILENAME>'"),wxT("'")+m_gnuplotData+wxT("'"));
           textOut << line + wxT("\n");
         }
         textOut.Flush();
       }
     }
   }
-  #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
-  #endif
-  return m_gnuplotData;
-}
-
-wxString Image::GnuplotSource()
-{
-  if((!m_gnuplotSource.IsEmpty()) && (!wxFileExists(m_gnuplotSource)))
-  {
-    #ifdef HAVE_OMP_HEADER
-    omp_set_lock(&m_gnuplotLock);
-    #else
-    #ifdef HAVE_OPENMP_TASKS
-    #pragma omp taskwait
-    #endif
-    #endif
-    {
-      // Move the gnuplot source and data file into our temp directory
-      wxFileName gnuplotSourceFile(m_gnuplotSource);
-      m_gnuplotSource = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotSourceFile.GetFullName();
-      wxFileName gnuplotDataFile(m_gnuplotData);
-      m_gnuplotData = wxStandardPaths::Get().GetTempDir() + "/" + gnuplotDataFile.GetFullName();
-  
-      wxFileOutputStream output(m_gnuplotSource);
-      wxTextOutputStream textOut(output);
-      if(output.IsOk())
-      {
-
-        if(m_gnuplotSource_Compressed.GetDataLen() <= 1)
-        {
-          wxLogMessage(_("No gnuplot source!"));
-          return wxEmptyString;
-        }
-        wxMemoryInputStream mstream(
-          m_gnuplotSource_Compressed.GetData(),
-          m_gnuplotSource_Compressed.GetDataLen()
-          );
-        wxZlibInputStream zstream(mstream);
-        if(zstream.IsOk())
-        {
-          wxTextInputStream textIn(zstream);
-          wxString line;
-          
-          while(!zstream.Eof())
-          {
-            line = textIn.ReadLine();
-            line.Replace(wxT("'<DATAFILENAME>'"),wxT("'")+m_gnuplotData+wxT("'"));
-            textOut << line + wxT("\n");
-          }
-          textOut.Flush();
-        }
-      }
-    }
-  }
-  #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
-  #endif
   // Restore the data file, as well.
   GnuplotData();
   return m_gnuplotSource;
@@ -693,24 +664,13 @@ wxSize Image::ToImageFile(wxString filename)
   if((filename.Lower().EndsWith(".svg")) && (m_extension == "svgz"))
   {
     // Unzip the .svgz image
-    wxString svgContents_string;
-    wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
-    wxZlibInputStream zstream(istream);
-    if(!zstream.IsOk())
+    wxMemoryBuffer svgContents = Decompress(m_compressedImage);
+    if(svgContents.GetDataLen() == 0)
       return wxSize(-1, -1);
-    wxTextInputStream textIn(zstream);
-    wxString line;
-    while(!zstream.Eof())
-    {
-      line = textIn.ReadLine();
-      svgContents_string += line + wxT("\n");
-    }
     wxFile file(filename, wxFile::write);
     if (!file.IsOpened())
       return wxSize(-1, -1);
-    wxFileOutputStream output(file);
-    wxTextOutputStream text(output);
-    text << svgContents_string;
+    file.Write(svgContents.GetData(), svgContents.GetDataLen());
     if (file.Close())
       return wxSize(m_originalWidth, m_originalHeight);
     else
@@ -771,17 +731,11 @@ wxBitmap Image::GetBitmap(double scale)
     std::unique_ptr<unsigned char> imgdata(new unsigned char[m_width*m_height*4]);
     if(!imgdata)
     {
-      #ifdef HAVE_OMP_HEADER
-      omp_unset_lock(&m_gnuplotLock);
-      #endif
       return wxBitmap();
     }
     nsvgRasterize(m_svgRast, m_svgImage, 0,0,
                   ((double)m_width)/((double)m_originalWidth),
                   imgdata.get(), m_width, m_height, m_width*4);
-    #ifdef HAVE_OMP_HEADER
-    omp_unset_lock(&m_gnuplotLock);
-    #endif
     return m_scaledBitmap = SvgBitmap::RGBA2wxBitmap(imgdata.get(), m_width, m_height);
   }
   else
@@ -795,28 +749,21 @@ wxBitmap Image::GetBitmap(double scale)
     }
     m_isOk = true;
 
+    // Make sure we stay within sane defaults
+    if (m_width < 1)m_width = 1;
+    if (m_height < 1)m_height = 1;
+
+    // Scale the decoded image and convert it to a bitmap only once: Creating
+    // an unscaled bitmap and converting it back would mean two more copies of
+    // the pixel data.
     if (img.Ok())
-      m_scaledBitmap = wxBitmap(img);
+    {
+      img.Rescale(m_width, m_height, wxIMAGE_QUALITY_BICUBIC);
+      m_scaledBitmap = wxBitmap(img, 24);
+    }
     else
       InvalidBitmap();
   }
-
-  // Make sure we stay within sane defaults
-  if (m_width < 1)m_width = 1;
-  if (m_height < 1)m_height = 1;
-
-  // Create a scaled bitmap and return it.
-  if(m_scaledBitmap.IsOk())
-  {
-    wxImage img = m_scaledBitmap.ConvertToImage();
-    img.Rescale(m_width, m_height, wxIMAGE_QUALITY_BICUBIC);
-    m_scaledBitmap = wxBitmap(img, 24);
-  }
-  else
-    m_scaledBitmap = wxBitmap(1,1);
-  #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
-  #endif
   return m_scaledBitmap;
 }
 
@@ -856,10 +803,10 @@ void Image::LoadImage(const wxBitmap &bitmap)
   // Convert the bitmap to a png image we can use as m_compressedImage
   wxImage image = bitmap.ConvertToImage();
   m_isOk = image.IsOk();
-  wxMemoryOutputStream stream;
+  wxMemoryBuffer compressedImage;
+  MemoryBufferOutputStream stream(compressedImage);
   image.SaveFile(stream, wxBITMAP_TYPE_PNG);
-  m_compressedImage.AppendData(stream.GetOutputStreamBuffer()->GetBufferStart(),
-                               stream.GetOutputStreamBuffer()->GetBufferSize());
+  m_compressedImage = compressedImage;
 
   // Set the info about the image.
   m_extension = wxT("png");
@@ -900,7 +847,8 @@ void Image::LoadImage_Backgroundtask(wxString image, const std::shared_ptr<wxFil
   #endif
 
   m_imageName = image;
-  m_compressedImage.Clear();
+  // Don't Clear() the buffer: Its data might still be shared with the .wxmx writer.
+  m_compressedImage = wxMemoryBuffer();
   m_scaledBitmap.Create(1, 1);
 
   if (filesystem)
@@ -955,67 +903,23 @@ void Image::LoadImage_Backgroundtask(wxString image, const std::shared_ptr<wxFil
     if((m_extension == "svg") || (m_extension == "svgz"))
     {
       m_isOk = false;
-      wxString svgContents_string;
+      wxMemoryBuffer svgContents;
 
       // Read the svg file's data into the system's memory
       if(m_extension == "svg")
       {
-        // We can read the file from memory without much ado...
-        svgContents_string = wxString::FromUTF8(
-          (char *)m_compressedImage.GetData(),
-          m_compressedImage.GetDataLen());
-        
-        // ...but we want to compress the in-memory image for saving memory
-        wxMemoryOutputStream mstream;
-        wxZlibOutputStream zstream(mstream,wxZ_BEST_COMPRESSION,wxZLIB_GZIP);
-        wxTextOutputStream textOut(zstream);
-        textOut << svgContents_string;
-        textOut.Flush();
-        zstream.Close();
-        m_compressedImage.Clear();
-        m_compressedImage.AppendData(mstream.GetOutputStreamBuffer()->GetBufferStart(),
-                                     mstream.GetOutputStreamBuffer()->GetBufferSize());
+        // We want to keep the in-memory image compressed for saving memory.
+        // The uncompressed data is needed only until it has been parsed.
+        svgContents = m_compressedImage;
+        m_compressedImage = CompressData(svgContents.GetData(), svgContents.GetDataLen(),
+                                         wxZ_BEST_COMPRESSION);
         m_extension += "z";
         m_imageName += "z";
       }
       else
-      {
-        // Unzip the .svgz image
-        wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
-        wxZlibInputStream zstream(istream);
-        wxTextInputStream textIn(zstream);
-        wxString line;
-        while(!zstream.Eof())
-        {
-          line = textIn.ReadLine();
-          svgContents_string += line + wxT("\n");
-        }
-      }
-      // Convert the data we have read to a modifyable char * containing the svg file's contents.
-      char *svgContents;
-      svgContents = (char *)strdup(svgContents_string.utf8_str());
-
-      // Parse the svg file's contents
-      int ppi;
-      if((*m_configuration)->GetDC()->GetPPI().x > 50)
-        ppi = (*m_configuration)->GetDC()->GetPPI().x;
-      else
-        ppi = 96;
-      
-      if(svgContents)
-      {
-        m_svgImage = nsvgParse(svgContents, "px", ppi);
-        delete(svgContents);
-      }
+        svgContents = Decompress(m_compressedImage);
 
-      if(m_svgImage)
-      {
-	m_svgRast = nsvgCreateRasterizer();
-        if(m_svgRast)
-          m_isOk = true;
-        m_originalWidth = m_svgImage->width;
-        m_originalHeight = m_svgImage->height;
-      }
+      ParseSVG(svgContents);
     }
     else
     {   
@@ -1042,6 +946,31 @@ void Image::LoadImage_Backgroundtask(wxString image, const std::shared_ptr<wxFil
   #endif
 }
 
+void Image::ParseSVG(wxMemoryBuffer svgContents)
+{
+  // nsvgParse() modifies the zero-terminated string it parses. Our buffer
+  // isn't shared with anybody else at this point => we can parse it in place.
+  svgContents.AppendByte('\0');
+
+  // Parse the svg file's contents
+  int ppi;
+  if((*m_configuration)->GetDC()->GetPPI().x > 50)
+    ppi = (*m_configuration)->GetDC()->GetPPI().x;
+  else
+    ppi = 96;
+
+  m_svgImage = nsvgParse((char *)svgContents.GetData(), "px", ppi);
+
+  if(m_svgImage)
+  {
+    m_svgRast = nsvgCreateRasterizer();
+    if(m_svgRast)
+      m_isOk = true;
+    m_originalWidth = m_svgImage->width;
+    m_originalHeight = m_svgImage->height;
+  }
+}
+
 void Image::Recalculate(double scale)
 {
   #ifdef HAVE_OMP_HEADER
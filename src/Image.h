@@ -36,6 +36,7 @@
 #include <wx/filesys.h>
 #include <wx/fs_arc.h>
 #include <wx/buffer.h>
+#include <memory>
 #include "nanoSVG/nanosvg.h"
 #include "nanoSVG/nanosvgrast.h"
 
@@ -91,6 +92,13 @@ public:
    */
   Image(Configuration **config, wxString image, const std::shared_ptr<wxFileSystem> &filesystem, bool remove = true);
 
+  /*! A copy constructor
+
+    Waits until the image it copies is loaded. The gnuplot files are shared with
+    the original, even if they are still being read.
+   */
+  Image(const Image &image);
+
   ~Image();
 
   //! Creates a bitmap showing an error message
@@ -133,10 +141,28 @@ public:
    */
   wxString GnuplotData();
 
-  //! Returns the gnuplot source of this image
-  wxMemoryBuffer GetGnuplotSource();
-  //! Returns the gnuplot data of this image
-  wxMemoryBuffer GetGnuplotData();
+  /*! Returns the zlib-compressed gnuplot source of this image
+
+    Shares its data with the gnuplot cache: Unless the gnuplot files change the
+    address of the data stays the same.
+   */
+  wxMemoryBuffer GetCompressedGnuplotSource();
+  //! Returns the zlib-compressed gnuplot data of this image. See GetCompressedGnuplotSource().
+  wxMemoryBuffer GetCompressedGnuplotData();
+
+  //! The states the cached gnuplot source and data of an image can be in
+  enum GnuplotStatus
+  {
+    gnuplot_none,        //!< No gnuplot source and data are cached for this image
+    gnuplot_compressing, //!< The gnuplot files are being read and compressed in the background
+    gnuplot_ready        //!< The compressed gnuplot source and data are available
+  };
+
+  //! How far is caching the gnuplot source and data? Never blocks.
+  GnuplotStatus GetGnuplotStatus() const;
+
+  //! Has this image been made from a gnuplot file we know about? Never blocks.
+  bool HasGnuplotSource() const {return !m_gnuplotSource.IsEmpty();}
   
   /*! Temporarily forget the scaled image in order to save memory
 
@@ -162,6 +188,9 @@ public:
   //! "Loads" an image from a bitmap
   void LoadImage(const wxBitmap &bitmap);
 
+  //! Loads an image from a file
+  void LoadImage(wxString image, const std::shared_ptr<wxFileSystem> &filesystem, bool remove = true);
+
   //! Saves the image in its original form, or as .png if it originates in a bitmap
   wxSize ToImageFile(wxString filename);
 
@@ -182,7 +211,11 @@ public:
   //! The height of the scaled image
   long m_height;
 
-  //! Returns the original image in its compressed form
+  /*! Returns the original image in its compressed form
+
+    wxMemoryBuffer is reference-counted: The buffer we return shares its data
+    with this image instead of copying it. Its contents must not be modified.
+   */
   wxMemoryBuffer GetCompressedImage();
 
   //! Returns the original width
@@ -210,16 +243,67 @@ public:
   };
   #endif
   
-  //! The image in its original compressed form
+  /*! The image in its original compressed form
+
+    Is shared with the .wxmx writer and the clipboard and therefore is never
+    modified once loaded: If the image changes a new buffer is assigned.
+   */
   wxMemoryBuffer m_compressedImage;
 
   //! Can this image be exported in SVG format?
   bool CanExportSVG() const {return m_svgRast != NULL;}
 protected:
-  //! A zipped version of the gnuplot commands that produced this image.
-  wxMemoryBuffer m_gnuplotSource_Compressed;
-  //! A zipped version of the gnuplot data needed in order to create this image.
-  wxMemoryBuffer m_gnuplotData_Compressed;
+  /*! The compressed gnuplot files of an image
+
+    Is never modified once it is published in a GnuplotCacheSlot: The code that
+    reads the files replaces it as a whole.
+   */
+  struct GnuplotCache
+  {
+    GnuplotStatus m_status;
+    //! A zipped version of the gnuplot commands that produced this image.
+    wxMemoryBuffer m_source;
+    //! A zipped version of the gnuplot data needed in order to create this image.
+    wxMemoryBuffer m_data;
+  };
+  /*! Where the compressed gnuplot files of an image are published
+
+    Is shared between an image and its copies so a copy that is made while the
+    files are still being read gets them, too.
+   */
+  struct GnuplotCacheSlot
+  {
+    GnuplotCacheSlot() : m_maxDataBytes(0)
+      {
+        #ifdef HAVE_OMP_HEADER
+        omp_init_lock(&m_lock);
+        #endif
+      }
+    ~GnuplotCacheSlot()
+      {
+        #ifdef HAVE_OMP_HEADER
+        omp_destroy_lock(&m_lock);
+        #endif
+      }
+    //! The files. Only accessed by std::atomic_load() and std::atomic_store()
+    std::shared_ptr<const GnuplotCache> m_cache;
+    //! The gnuplot source file that still has to be read
+    wxString m_gnuplotFilename;
+    //! The gnuplot data file that still has to be read
+    wxString m_dataFilename;
+    //! The filesystem the files are read from, if they aren't ordinary files
+    std::shared_ptr<wxFileSystem> m_filesystem;
+    //! Data files that are bigger than this aren't stored in the worksheet
+    long long m_maxDataBytes;
+    #ifdef HAVE_OMP_HEADER
+    //! Held by whoever reads the files
+    omp_lock_t m_lock;
+    #endif
+  };
+  //! The gnuplot files of this image
+  std::shared_ptr<GnuplotCacheSlot> m_gnuplotCache;
+  //! The gnuplot cache, after waiting for the files to be read
+  std::shared_ptr<const GnuplotCache> GnuplotCacheWhenReady();
   //! The width of the unscaled image
   size_t m_originalWidth;
   //! The height of the unscaled image
@@ -235,13 +319,19 @@ protected:
   //! The gnuplot data file for this image, if any.
   wxString m_gnuplotData;
   void LoadImage_Backgroundtask(wxString image, const std::shared_ptr<wxFileSystem> &filesystem, bool remove);
-  void LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString dataFilename, const std::shared_ptr<wxFileSystem> &filesystem);
+  /*! Reads and compresses the gnuplot files of a slot, if nobody has done so yet
+
+    Is the background task GnuplotSource() starts. Whoever needs the files before
+    this task has run calls it, too: Then it either reads the files itself or
+    waits for the task that is reading them.
+   */
+  static void LoadGnuplotSource_Backgroundtask(std::shared_ptr<GnuplotCacheSlot> slot);
 
 private:
-  //! Loads an image from a file
-  void LoadImage(wxString image, const std::shared_ptr<wxFileSystem> &filesystem, bool remove = true);
   //! Reads the compressed image into a memory buffer
   static wxMemoryBuffer ReadCompressedImage(wxInputStream *data);  
+  //! Parses an uncompressed svg file into m_svgImage and creates m_svgRast
+  void ParseSVG(wxMemoryBuffer svgContents);
   Configuration **m_configuration;
   //! The upper width limit for displaying this image
   double m_maxWidth;
@@ -253,11 +343,10 @@ private:
   NSVGimage* m_svgImage;
   struct NSVGrasterizer* m_svgRast;
 
-  std::shared_ptr<wxFileSystem> m_fs_keepalive_gnuplotdata;
   std::shared_ptr<wxFileSystem> m_fs_keepalive_imagedata;
   #ifdef HAVE_OMP_HEADER
-  omp_lock_t m_gnuplotLock;
-  omp_lock_t m_imageLoadLock;
+  //! Held while the image is loaded. Mutable as copying an image has to wait for it.
+  mutable omp_lock_t m_imageLoadLock;
   #endif
   
 };
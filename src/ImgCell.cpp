@@ -36,7 +36,6 @@
 #include <wx/file.h>
 #include <wx/filename.h>
 #include <wx/filesys.h>
-#include <wx/fs_mem.h>
 #include <wx/clipbrd.h>
 #include <wx/mstream.h>
 
@@ -133,7 +132,7 @@ wxString ImgCell::GetToolTip(const wxPoint &point)
                "One example of the latter would be: Gnuplot refuses to plot entirely "
                "empty images"));
     else
-      return m_toolTip;
+      return GetLocalToolTip();
   }
   else
     return wxEmptyString;
@@ -288,17 +287,11 @@ wxString ImgCell::ToRTF()
 
 wxString ImgCell::ToXML()
 {
-  wxString basename = m_cellPointers->WXMXGetNewFileName();
-
-  // add the file to memory
+  // Schedule the image for being saved
+  wxString imageName;
   if (m_image)
-  {
-    if (m_image->GetCompressedImage())
-      wxMemoryFSHandler::AddFile(basename + m_image->GetExtension(),
-                                 m_image->GetCompressedImage().GetData(),
-                                 m_image->GetCompressedImage().GetDataLen()
-      );
-  }
+    imageName = m_cellPointers->WXMXAddImage(m_image->GetCompressedImage(),
+                                             m_image->GetExtension());
 
   wxString flags;
   if (m_forceBreakLine)
@@ -333,31 +326,17 @@ wxString ImgCell::ToXML()
     if(gnuplotSource != wxEmptyString)
     {
       flags += " gnuplotsource=\"" + gnuplotSource + "\"";
-      wxMemoryBuffer data = m_image->GetGnuplotSource();
-      if(data.GetDataLen() > 0)
-      {
-        wxMemoryFSHandler::AddFile(gnuplotSource,
-                                   data.GetData(),
-                                   data.GetDataLen()
-          );
-      }
+      m_cellPointers->WXMXAddFile(gnuplotSource, m_image->GetCompressedGnuplotSource(), true);
     }
     if(gnuplotData != wxEmptyString)
     {
       flags += " gnuplotdata=\"" + gnuplotData + "\"";
-      wxMemoryBuffer data = m_image->GetGnuplotData();
-      if(data.GetDataLen() > 0)
-      {
-        wxMemoryFSHandler::AddFile(gnuplotData,
-                                   data.GetData(),
-                                   data.GetDataLen()
-          );
-      }
+      m_cellPointers->WXMXAddFile(gnuplotData, m_image->GetCompressedGnuplotData(), true);
     }
   }
   
   return (wxT("<img") + flags + wxT(">") +
-          basename + m_image->GetExtension() + wxT("</img>"));
+          imageName + wxT("</img>"));
 }
 
 bool ImgCell::CopyToClipboard()
@@ -40,6 +40,7 @@ public:
   ImgCell(Cell *parent, Configuration **config, CellPointers *cellPointers, const wxBitmap &bitmap);
   ImgCell(const ImgCell &cell);
   Cell *Copy() override {return new ImgCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~ImgCell();
 
   //! This class can be derived from wxAccessible which has no copy constructor
@@ -138,7 +139,7 @@ public:
 
   bool CanPopOut() override
     {
-      return (!m_image->GnuplotSource().IsEmpty());
+      return m_image->HasGnuplotSource();
     }
 protected:
   std::shared_ptr<Image> m_image;
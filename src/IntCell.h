@@ -42,6 +42,7 @@ public:
   IntCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   IntCell(const IntCell &cell);
   Cell *Copy() override {return new IntCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   //! This class can be derived from wxAccessible which has no copy constructor
   IntCell &operator=(const IntCell&) = delete;
   ~IntCell();
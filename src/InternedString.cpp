@@ -0,0 +1,69 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file defines the class InternedString.
+ */
+
+#include "InternedString.h"
+#include <unordered_set>
+#include <wx/hashmap.h>
+
+//! The pool all interned strings live in. Its elements never move in memory.
+static std::unordered_set<wxString, wxStringHash, wxStringEqual> &Pool()
+{
+  static std::unordered_set<wxString, wxStringHash, wxStringEqual> pool;
+  return pool;
+}
+
+const wxString &InternedString::Empty()
+{
+  static const wxString empty;
+  return empty;
+}
+
+const wxString *InternedString::Intern(const wxString &str)
+{
+  if(str.IsEmpty())
+    return &Empty();
+
+  const wxString *retval;
+  #pragma omp critical (InternedStringPool)
+  retval = &(*Pool().insert(str).first);
+  return retval;
+}
+
+void InternedString::PoolStatistics(size_t &strings, size_t &bytes)
+{
+  strings = 0;
+  bytes = 0;
+  #pragma omp critical (InternedStringPool)
+  {
+    for(std::unordered_set<wxString, wxStringHash, wxStringEqual>::const_iterator it = Pool().begin();
+        it != Pool().end(); ++it)
+    {
+      strings++;
+      bytes += sizeof(wxString) + (it->Length() + 1) * sizeof(wxChar);
+    }
+  }
+}
@@ -0,0 +1,75 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+/*! \file
+
+  This file declares the class InternedString that allows many cells to share
+  the same string.
+ */
+
+#ifndef INTERNEDSTRING_H
+#define INTERNEDSTRING_H
+
+#include <wx/wx.h>
+#include <wx/string.h>
+
+/*! An immutable string that is stored only once, no matter how many cells use it
+
+  Many cells carry the same few strings: the default tooltip, the names of the
+  TeX fonts, the unicode representation of greek letters... Storing each of
+  them once in a pool means a cell only needs to carry a pointer.
+
+  The pool is never emptied => this class is meant for strings that come from
+  a limited set and not for the contents of the cells.
+ */
+class InternedString
+{
+public:
+  InternedString() : m_string(&Empty()) {}
+  InternedString(const wxString &str) : m_string(Intern(str)) {}
+  InternedString &operator=(const wxString &str)
+  {
+    m_string = Intern(str);
+    return *this;
+  }
+
+  //! The string this object stands for
+  const wxString &str() const {return *m_string;}
+  operator const wxString &() const {return *m_string;}
+  bool IsEmpty() const {return m_string->IsEmpty();}
+
+  //! Do both objects stand for the same string?
+  bool operator==(const InternedString &other) const {return m_string == other.m_string;}
+  bool operator!=(const InternedString &other) const {return m_string != other.m_string;}
+
+  //! The number of distinct strings in the pool and the memory they need
+  static void PoolStatistics(size_t &strings, size_t &bytes);
+
+private:
+  //! Returns the pool's copy of str, adding it to the pool if necessary
+  static const wxString *Intern(const wxString &str);
+  //! The empty string doesn't need to be looked up in the pool
+  static const wxString &Empty();
+  const wxString *m_string;
+};
+
+#endif // INTERNEDSTRING_H
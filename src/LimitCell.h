@@ -38,6 +38,7 @@ public:
   LimitCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   LimitCell(const LimitCell &cell);
   Cell *Copy() override {return new LimitCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
 
   ~LimitCell();
 
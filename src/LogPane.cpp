@@ -21,48 +21,284 @@
 
 #include "LogPane.h"
 #include "ErrorRedirector.h"
+#include <wx/datetime.h>
+#include <iostream>
+
+LogSink::LogSink(size_t size) :
+  m_slots(new Slot[size]),
+  m_size(size),
+  m_enqueuePos(0),
+  m_dequeuePos(0),
+  m_dropped(0)
+{
+  wxASSERT((size & (size - 1)) == 0);
+  for(size_t i = 0; i < size; i++)
+    m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+}
+
+void LogSink::Post(wxLogLevel level, const wxString &message, time_t time)
+{
+  // A bounded multi-producer queue: A slot whose sequence number equals the
+  // position we want to write to is free. Claiming the position is the only
+  // step that needs to be synchronized with other producers.
+  size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  Slot *slot;
+  while(true)
+  {
+    slot = &m_slots[pos & (m_size - 1)];
+    size_t sequence = slot->m_sequence.load(std::memory_order_acquire);
+    long diff = (long) sequence - (long) pos;
+    if(diff == 0)
+    {
+      if(m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if(diff < 0)
+    {
+      // The queue is full
+      m_dropped++;
+      return;
+    }
+    else
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+  }
+  slot->m_record.m_level = level;
+  slot->m_record.m_time = time;
+  slot->m_record.m_message = message;
+  slot->m_sequence.store(pos + 1, std::memory_order_release);
+}
+
+bool LogSink::Pop(LogRecord &record)
+{
+  Slot *slot = &m_slots[m_dequeuePos & (m_size - 1)];
+  size_t sequence = slot->m_sequence.load(std::memory_order_acquire);
+  if((long) sequence - (long) (m_dequeuePos + 1) < 0)
+    return false;
+  record = slot->m_record;
+  slot->m_record.m_message.Clear();
+  slot->m_sequence.store(m_dequeuePos + m_size, std::memory_order_release);
+  m_dequeuePos++;
+  return true;
+}
+
+void LogSink::DoLogRecord(wxLogLevel level,
+                          const wxString& msg,
+                          const wxLogRecordInfo& info)
+{
+  Post(level, msg, info.timestamp);
+}
+
+#ifdef wxUSE_STD_IOSTREAM
+int LogPane::LogStreamBuf::overflow(int c)
+{
+  if(c == EOF)
+    return c;
+  if(c == '\n')
+  {
+    m_sink->Post(wxLOG_Message, wxString::FromUTF8(m_line.c_str()), time(NULL));
+    m_line.clear();
+  }
+  else
+    m_line += (char) c;
+  return c;
+}
+#endif
+
+LogPane::RecordList::RecordList(LogPane *parent, int id) :
+  wxListCtrl(parent, id, wxDefaultPosition, wxDefaultSize,
+             wxLC_REPORT | wxLC_VIRTUAL | wxLC_SINGLE_SEL)
+{
+  m_logPane = parent;
+  AppendColumn(_("Time"));
+  AppendColumn(_("Message"));
+  m_errorAttr.SetTextColour(wxColour(192,0,0));
+  m_warningAttr.SetTextColour(wxColour(160,96,0));
+}
+
+wxString LogPane::RecordList::OnGetItemText(long item, long column) const
+{
+  if((item < 0) || (item >= (long) m_logPane->m_visible.size()))
+    return wxEmptyString;
+  const LogRecord &record =
+    m_logPane->m_records[m_logPane->m_visible[item] - m_logPane->m_firstRecord];
+  if(column == 0)
+    return wxDateTime(record.m_time).FormatTime();
+  return record.m_message;
+}
+
+wxListItemAttr *LogPane::RecordList::OnGetItemAttr(long item) const
+{
+  if((item < 0) || (item >= (long) m_logPane->m_visible.size()))
+    return NULL;
+  const LogRecord &record =
+    m_logPane->m_records[m_logPane->m_visible[item] - m_logPane->m_firstRecord];
+  if(record.m_level <= wxLOG_Error)
+    return &m_errorAttr;
+  if(record.m_level == wxLOG_Warning)
+    return &m_warningAttr;
+  return NULL;
+}
+
 LogPane::LogPane(wxWindow *parent, wxWindowID id, bool becomeLogTarget) : wxPanel(parent, id)
 {
   m_isLogTarget = false;
-  m_logPanelTarget = NULL;
+  m_firstRecord = 0;
+  m_maxLevel = wxLOG_Max;
+  m_logSink = std::unique_ptr<LogSink>(new LogSink());
+  #ifdef wxUSE_STD_IOSTREAM
+  m_oldCoutBuf = NULL;
+  #endif
   wxBoxSizer *vbox  = new wxBoxSizer(wxVERTICAL);
+  wxBoxSizer *filterBox  = new wxBoxSizer(wxHORIZONTAL);
 
-  m_textCtrl = new wxTextCtrl(this, -1, wxEmptyString, wxDefaultPosition,
-					wxDefaultSize,
-					wxTE_MULTILINE | wxTE_READONLY | wxHSCROLL);
+  wxArrayString levels;
+  levels.Add(_("All messages"));
+  levels.Add(_("Warnings and errors"));
+  levels.Add(_("Errors"));
+  m_levelChoice = new wxChoice(this, level_id, wxDefaultPosition, wxDefaultSize, levels);
+  m_levelChoice->SetSelection(0);
+  m_filterCtrl = new wxTextCtrl(this, filter_id);
+  m_filterCtrl->SetHint(_("Filter"));
+  filterBox->Add(m_levelChoice, wxSizerFlags());
+  filterBox->Add(m_filterCtrl, wxSizerFlags().Expand().Proportion(10));
 
-  vbox->Add(m_textCtrl, wxSizerFlags().Expand().Proportion(10));
+  m_list = new RecordList(this, list_id);
+
+  vbox->Add(filterBox, wxSizerFlags().Expand());
+  vbox->Add(m_list, wxSizerFlags().Expand().Proportion(10));
     
   SetSizerAndFit(vbox);
   if(becomeLogTarget)
     BecomeLogTarget();    
 
-  // m_logPanelTarget->SetRepetitionCounting();
-  // m_logPanelTarget->DisableTimestamp();
+  Connect(level_id, wxEVT_CHOICE, wxCommandEventHandler(LogPane::OnFilterChanged));
+  Connect(filter_id, wxEVT_TEXT, wxCommandEventHandler(LogPane::OnFilterChanged));
+  Connect(wxEVT_SIZE, wxSizeEventHandler(LogPane::OnSize));
+  m_timer.SetOwner(this);
+  Connect(wxEVT_TIMER, wxTimerEventHandler(LogPane::OnTimer));
+  m_timer.Start(250);
+
   SetMinSize(wxSize(wxSystemSettings::GetMetric ( wxSYS_SCREEN_X )/10,
                     wxSystemSettings::GetMetric ( wxSYS_SCREEN_Y )/10));
 }
 
+void LogPane::OnSize(wxSizeEvent &event)
+{
+  int timeWidth = m_list->GetColumnWidth(0);
+  m_list->SetColumnWidth(1, wxMax(event.GetSize().x - timeWidth, 10));
+  event.Skip();
+}
+
+bool LogPane::Matches(const LogRecord &record) const
+{
+  if(record.m_level > m_maxLevel)
+    return false;
+  if((!m_filter.IsEmpty()) && (!record.m_message.Lower().Contains(m_filter)))
+    return false;
+  return true;
+}
+
+void LogPane::ApplyFilter()
+{
+  m_visible.clear();
+  for(size_t i = 0; i < m_records.size(); i++)
+    if(Matches(m_records[i]))
+      m_visible.push_back(i + m_firstRecord);
+}
+
+void LogPane::OnFilterChanged(wxCommandEvent &WXUNUSED(event))
+{
+  switch(m_levelChoice->GetSelection())
+  {
+  case 1:
+    m_maxLevel = wxLOG_Warning;
+    break;
+  case 2:
+    m_maxLevel = wxLOG_Error;
+    break;
+  default:
+    m_maxLevel = wxLOG_Max;
+  }
+  m_filter = m_filterCtrl->GetValue().Lower();
+  ApplyFilter();
+  UpdateList(true);
+}
+
+void LogPane::UpdateList(bool scrollToEnd)
+{
+  m_list->SetItemCount(m_visible.size());
+  if(scrollToEnd && (!m_visible.empty()))
+    m_list->EnsureVisible(m_visible.size() - 1);
+  m_list->Refresh();
+}
+
+void LogPane::OnTimer(wxTimerEvent &WXUNUSED(event))
+{
+  long oldCount = m_visible.size();
+  // Only scroll to the new messages if the user hasn't scrolled away from the end
+  bool atEnd = (m_list->GetTopItem() + m_list->GetCountPerPage() >= oldCount);
+
+  bool changed = false;
+  LogRecord record;
+  while(m_logSink->Pop(record))
+  {
+    m_records.push_back(record);
+    if(Matches(record))
+      m_visible.push_back(m_firstRecord + m_records.size() - 1);
+    changed = true;
+  }
+  long dropped = m_logSink->TakeDropped();
+  if(dropped > 0)
+  {
+    record.m_level = wxLOG_Warning;
+    record.m_time = time(NULL);
+    record.m_message = wxString::Format(_("%li log messages were dropped."), dropped);
+    m_records.push_back(record);
+    if(Matches(record))
+      m_visible.push_back(m_firstRecord + m_records.size() - 1);
+    changed = true;
+  }
+  if(!changed)
+    return;
+
+  // Forget the oldest messages if we have too many.
+  while(m_records.size() > m_maxRecords)
+  {
+    m_records.pop_front();
+    m_firstRecord++;
+  }
+  while((!m_visible.empty()) && (m_visible.front() < m_firstRecord))
+    m_visible.pop_front();
+
+  UpdateList(atEnd);
+}
+
 void LogPane::DropLogTarget()
 {
-  // m_logPanelTarget is automatically destroyed in this step.
   if(m_isLogTarget)
   {
     m_errorRedirector = NULL;
     wxLog::SetActiveTarget(NULL);
+    #ifdef wxUSE_STD_IOSTREAM
+    if(m_oldCoutBuf)
+      std::cout.rdbuf(m_oldCoutBuf);
+    m_oldCoutBuf = NULL;
+    #endif
   }
-  m_logPanelTarget = NULL;
   m_isLogTarget = false;
 }
 
 void LogPane::BecomeLogTarget()
 {
   m_isLogTarget = true;
-  wxLog::SetActiveTarget(m_logPanelTarget = new wxLogTextCtrl(m_textCtrl));
+  wxLog::SetActiveTarget(m_logSink.get());
   m_errorRedirector = std::unique_ptr<ErrorRedirector>(new ErrorRedirector(new wxLogGui()));
   #ifdef wxUSE_STD_IOSTREAM
-  if(!ErrorRedirector::LoggingToStdErr())
-    m_textRedirector = std::unique_ptr<wxStreamToTextRedirector>(new wxStreamToTextRedirector(m_textCtrl));
+  if((!ErrorRedirector::LoggingToStdErr()) && (!m_oldCoutBuf))
+  {
+    m_streamBuf = std::unique_ptr<LogStreamBuf>(new LogStreamBuf(m_logSink.get()));
+    m_oldCoutBuf = std::cout.rdbuf(m_streamBuf.get());
+  }
   #endif
 }
 
@@ -70,7 +306,6 @@ LogPane::~LogPane()
 {
   DropLogTarget();
   #ifdef wxUSE_STD_IOSTREAM
-  m_textRedirector.reset();
+  m_streamBuf.reset();
   #endif
 }
-
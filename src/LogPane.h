@@ -24,12 +24,70 @@
 
 #include <wx/wx.h>
 #include <wx/panel.h>
-#include <wx/textctrl.h>
+#include <wx/listctrl.h>
+#include <wx/timer.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <streambuf>
 #include "ErrorRedirector.h"
 #include "memory"
 
+//! One log message
+struct LogRecord
+{
+  wxLogLevel m_level;
+  time_t m_time;
+  wxString m_message;
+};
+
+/*! A log target that only queues the messages it receives
+
+  Posting a message is lock-free and never touches the GUI, so logging is
+  cheap even on hot paths like the redraw and can be done from any thread.
+  The queue has a fixed size: If the GUI thread doesn't manage to keep up
+  the oldest messages are kept and new ones are dropped and counted.
+ */
+class LogSink : public wxLog
+{
+public:
+  explicit LogSink(size_t size = 16384);
+  //! Queue a message. Can be called from any thread.
+  void Post(wxLogLevel level, const wxString &message, time_t time);
+  /*! Retrieve the oldest queued message
+
+    May only be called from one thread at a time, normally the GUI thread.
+    \return false if there was no message in the queue
+   */
+  bool Pop(LogRecord &record);
+  //! The number of messages dropped because the queue was full since the last call
+  long TakeDropped(){return m_dropped.exchange(0);}
+
+protected:
+  virtual void DoLogRecord(wxLogLevel level,
+                           const wxString& msg,
+                           const wxLogRecordInfo& info);
+
+private:
+  struct Slot
+  {
+    //! Tells if this slot is free or contains a message, see Post() and Pop()
+    std::atomic<size_t> m_sequence;
+    LogRecord m_record;
+  };
+  std::unique_ptr<Slot[]> m_slots;
+  //! The number of slots. Always a power of 2.
+  size_t m_size;
+  std::atomic<size_t> m_enqueuePos;
+  size_t m_dequeuePos;
+  std::atomic<long> m_dropped;
+};
+
 /*! A "debug messages" sidepane
 
+  The messages are kept in a ring buffer of limited length and are displayed
+  in a virtual list control, which means that only the visible lines are ever
+  rendered.
 */
 class LogPane : public wxPanel
 {
@@ -41,14 +99,77 @@ public:
   ~LogPane();
 
 private:
-  //! The textctrl all log messages appear on
-  wxTextCtrl *m_textCtrl;
+  //! The list control that displays the messages that pass the filters
+  class RecordList : public wxListCtrl
+  {
+  public:
+    RecordList(LogPane *parent, int id);
+  protected:
+    wxString OnGetItemText(long item, long column) const;
+    wxListItemAttr *OnGetItemAttr(long item) const;
+  private:
+    LogPane *m_logPane;
+    mutable wxListItemAttr m_errorAttr;
+    mutable wxListItemAttr m_warningAttr;
+  };
+
+  #ifdef wxUSE_STD_IOSTREAM
+  //! Sends everything that is written to a stream to the log, one line at a time
+  class LogStreamBuf : public std::streambuf
+  {
+  public:
+    explicit LogStreamBuf(LogSink *sink) : m_sink(sink) {}
+  protected:
+    virtual int overflow(int c);
+  private:
+    LogSink *m_sink;
+    std::string m_line;
+  };
+  #endif
+
+  enum LogPaneIds
+  {
+    list_id = 4,
+    level_id,
+    filter_id
+  };
+
+  //! Move the messages from the log sink to m_records
+  void OnTimer(wxTimerEvent &event);
+  void OnFilterChanged(wxCommandEvent &event);
+  void OnSize(wxSizeEvent &event);
+  //! Does a record pass the filters the user has set?
+  bool Matches(const LogRecord &record) const;
+  //! Re-build the list of records that pass the filters
+  void ApplyFilter();
+  //! Update the list control after m_visible has changed
+  void UpdateList(bool scrollToEnd);
+
+  //! The maximum number of messages we keep
+  static const size_t m_maxRecords = 100000;
+  //! All messages we keep, oldest first
+  std::deque<LogRecord> m_records;
+  //! The number of messages that were dropped from the beginning of m_records
+  size_t m_firstRecord;
+  //! The numbers of the messages that pass the filters
+  std::deque<size_t> m_visible;
+  //! The most verbose log level the user wants to see
+  wxLogLevel m_maxLevel;
+  //! Only show messages that contain this string
+  wxString m_filter;
+
+  RecordList *m_list;
+  wxChoice *m_levelChoice;
+  wxTextCtrl *m_filterCtrl;
+  wxTimer m_timer;
+  //! The log target that collects the messages
+  std::unique_ptr<LogSink> m_logSink;
   //! Redirects all error messages to gui dialogues
   std::unique_ptr<ErrorRedirector> m_errorRedirector;
-  wxLog *m_logPanelTarget;
   bool m_isLogTarget;
   #ifdef wxUSE_STD_IOSTREAM
-  std::unique_ptr<wxStreamToTextRedirector> m_textRedirector;
+  std::unique_ptr<LogStreamBuf> m_streamBuf;
+  std::streambuf *m_oldCoutBuf;
   #endif
 };
 
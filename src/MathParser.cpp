@@ -270,9 +270,9 @@ Cell *MathParser::HandleNullPointer(Cell *cell)
   if (cell == NULL)
   {
     cell = new TextCell(NULL, m_configuration, m_cellPointers, _("Bug: Missing contents"));
-    cell->SetToolTip(_("The xml data from maxima or from the .wxmx file was missing data here.\n"
-                       "If you find a way how to reproduce this problem please file a bug "
-                       "report against wxMaxima."));
+    cell->SetToolTip(InternedString(_("The xml data from maxima or from the .wxmx file was missing data here.\n"
+                                      "If you find a way how to reproduce this problem please file a bug "
+                                      "report against wxMaxima.")));
     cell->SetStyle(TS_ERROR);
   }
   return (cell);
@@ -508,7 +508,7 @@ Cell *MathParser::ParseFunTag(wxXmlNode *node)
   fun->SetArg(HandleNullPointer(ParseTag(child, false)));
   ParseCommonAttrs(node, fun);
   if((fun != NULL) && (fun->ToString().Contains(")(")))
-    fun->SetToolTip(_("If this isn't a function returning a lambda() expression a multiplication sign (*) between closing and opening parenthesis is missing here."));
+    fun->SetToolTip(InternedString(_("If this isn't a function returning a lambda() expression a multiplication sign (*) between closing and opening parenthesis is missing here.")));
   return fun;
 }
 
@@ -768,6 +768,68 @@ Cell *MathParser::ParseTableTag(wxXmlNode *node)
   return matrix;
 }
 
+Cell *MathParser::ParseCompactTableTag(wxXmlNode *node)
+{
+  MatrCell *matrix = new MatrCell(NULL, m_configuration, m_cellPointers);
+  matrix->SetHighlight(m_highlight);
+  if (node->GetAttribute(wxT("roundedParens"), wxT("false")) == wxT("true"))
+    matrix->RoundedParens(true);
+
+  // The contents are numbers; columns are separated by spaces and rows by
+  // semicolons. Each number gets the cells a <mtd><mn> would have produced.
+  wxString contents = node->GetNodeContent();
+  matrix->NewRow();
+  wxString number;
+  for (wxString::const_iterator ch = contents.begin(); ; ++ch)
+  {
+    bool atEnd = (ch == contents.end());
+    if (atEnd || (*ch == wxT(' ')) || (*ch == wxT(';')))
+    {
+      if (!number.IsEmpty())
+      {
+        matrix->NewColumn();
+        matrix->AddNewCell(ParseCompactNumber(number));
+        number.Clear();
+      }
+      if (atEnd)
+        break;
+      if (*ch == wxT(';'))
+        matrix->NewRow();
+    }
+    else
+      number += *ch;
+  }
+  matrix->SetType(m_ParserStyle);
+  matrix->SetStyle(TS_VARIABLE);
+  matrix->SetDimension();
+  ParseCommonAttrs(node, matrix);
+  return matrix;
+}
+
+Cell *MathParser::ParseCompactNumber(const wxString &number)
+{
+  wxString digits = number;
+  TextCell *sign = NULL;
+  if (digits.StartsWith(wxT("-"), &digits))
+  {
+    // Maxima displays negative numbers as a minus operator followed by the number
+    sign = new TextCell(NULL, m_configuration, m_cellPointers);
+    sign->SetType(m_ParserStyle);
+    sign->SetStyle(TS_VARIABLE);
+    sign->SetHighlight(m_highlight);
+    sign->SetValue(wxT("\u2212"));
+  }
+  TextCell *cell = new TextCell(NULL, m_configuration, m_cellPointers);
+  cell->SetType(m_ParserStyle);
+  cell->SetStyle(TS_NUMBER);
+  cell->SetHighlight(m_highlight);
+  cell->SetValue(digits);
+  if (sign == NULL)
+    return cell;
+  sign->AppendCell(cell);
+  return sign;
+}
+
 Cell *MathParser::ParseTag(wxXmlNode *node, bool all)
 {
   //  wxYield();
@@ -897,6 +959,10 @@ Cell *MathParser::ParseTag(wxXmlNode *node, bool all)
       {
         tmp = ParseTableTag(node);
       }
+      else if (tagName == wxT("tbn"))
+      {
+        tmp = ParseCompactTableTag(node);
+      }
       else if ((tagName == wxT("mth")) || (tagName == wxT("line")))
       {
         tmp = ParseTag(node->GetChildren());
@@ -1006,6 +1072,8 @@ Cell *MathParser::ParseTag(wxXmlNode *node, bool all)
         wxString gnuplotSources;
         wxString gnuplotData;
         bool del = node->GetAttribute(wxT("del"), wxT("false")) == wxT("true");
+        // Has maxima left running gnuplot for the frames to us?
+        bool render = node->GetAttribute(wxT("render"), wxT("false")) == wxT("true");
         node->GetAttribute(wxT("gnuplotSources"), &gnuplotSources);
         node->GetAttribute(wxT("gnuplotData"), &gnuplotData);
         SlideShow *slideShow = new SlideShow(NULL, m_configuration, m_cellPointers, m_fileSystem);
@@ -1039,7 +1107,10 @@ Cell *MathParser::ParseTag(wxXmlNode *node, bool all)
         }
         if (slideShow)
         {
-          slideShow->LoadImages(images, del);
+          if(render)
+            slideShow->RenderImages(images);
+          else
+            slideShow->LoadImages(images, del);
           wxStringTokenizer dataFiles(gnuplotData, wxT(";"));
           wxStringTokenizer gnuplotFiles(gnuplotSources, wxT(";"));
           for(int i=0; i<numImgs; i++)
@@ -1178,9 +1249,9 @@ Cell *MathParser::ParseLine(wxString s, CellType style)
     cell = new TextCell(NULL, m_configuration, m_cellPointers,
                         _("(Expression longer than allowed by the configuration setting)"),
       TS_WARNING);
-    cell->SetToolTip(_("The maximum size of the expressions wxMaxima is allowed to display "
-                       "can be changed in the configuration dialogue."
-                       ));
+    cell->SetToolTip(InternedString(_("The maximum size of the expressions wxMaxima is allowed to display "
+                                      "can be changed in the configuration dialogue."
+                                      )));
     cell->ForceBreakLine(true);
   }
   return cell;
@@ -114,6 +114,12 @@ private:
 
   Cell *ParseTableTag(wxXmlNode *node);
 
+  //! Parses a numeric matrix wxMathML.lisp has sent as a single \<tbn\> tag
+  Cell *ParseCompactTableTag(wxXmlNode *node);
+
+  //! Creates the cells for one number of a \<tbn\> tag
+  Cell *ParseCompactNumber(const wxString &number);
+
   Cell *ParseAtTag(wxXmlNode *node);
 
   Cell *ParseDiffTag(wxXmlNode *node);
@@ -309,94 +309,122 @@ wxString MatrCell::ToMatlab()
 
 wxString MatrCell::ToTeX()
 {
-  //ToDo: We ignore colNames and rowNames here. Are they currently in use?
   wxString s;
+  AppendTeX(s);
+  return s;
+}
 
+void MatrCell::AppendTeX(wxString &out)
+{
+  //ToDo: We ignore colNames and rowNames here. Are they currently in use?
   if (!m_specialMatrix)
   {
     if(m_roundedParens)
-      s = wxT("\\begin{pmatrix}");
+      out += wxT("\\begin{pmatrix}");
     else
-      s = wxT("\\begin{bmatrix}");
+      out += wxT("\\begin{bmatrix}");
   }
   else
   {
-    s = wxT("\\begin{array}{");
+    out += wxT("\\begin{array}{");
     for (unsigned int j = 0; j < m_matWidth; j++)
-      s += wxT("c");
-    s += wxT("}");
+      out += wxT("c");
+    out += wxT("}");
   }
   for (unsigned int i = 0; i < m_matHeight; i++)
   {
     for (unsigned int j = 0; j < m_matWidth; j++)
     {
-      s += m_cells[i * m_matWidth + j]->ListToTeX();
+      m_cells[i * m_matWidth + j]->AppendListTeX(out);
       if (j < m_matWidth - 1)
-        s += wxT(" & ");
+        out += wxT(" & ");
     }
     if (i < m_matHeight - 1)
-      s += wxT("\\\\\n");
+      out += wxT("\\\\\n");
   }
   if (!m_specialMatrix)
   {
     if(m_roundedParens)
-      s += wxT("\\end{pmatrix}");
+      out += wxT("\\end{pmatrix}");
     else
-      s += wxT("\\end{bmatrix}");
+      out += wxT("\\end{bmatrix}");
   }
   else
-    s += wxT("\\end{array}");
-  return s;
+    out += wxT("\\end{array}");
 }
 
 wxString MatrCell::ToMathML()
 {
   wxString retval;
+  AppendMathML(retval);
+  return retval;
+}
+
+void MatrCell::AppendMathML(wxString &out)
+{
   if (!m_specialMatrix)
-    retval = wxT("<mrow><mo>(</mo><mrow>");
-  retval += wxT("<mtable>");
+    out += wxT("<mrow><mo>(</mo><mrow>");
+  out += wxT("<mtable>");
 
   for (unsigned int i = 0; i < m_matHeight; i++)
   {
-    retval += wxT("<mtr>");
+    out += wxT("<mtr>");
     for (unsigned int j = 0; j < m_matWidth; j++)
-      retval += wxT("<mtd>") + m_cells[i * m_matWidth + j]->ListToMathML() + wxT("</mtd>");
-    retval += wxT("</mtr>");
+    {
+      out += wxT("<mtd>");
+      m_cells[i * m_matWidth + j]->AppendListMathML(out);
+      out += wxT("</mtd>");
+    }
+    out += wxT("</mtr>");
   }
-  retval += wxT("</mtable>\n");
+  out += wxT("</mtable>\n");
   if (!m_specialMatrix)
-    retval += wxT("</mrow><mo>)</mo></mrow>\n");
-  return retval;
+    out += wxT("</mrow><mo>)</mo></mrow>\n");
 }
 
 wxString MatrCell::ToOMML()
 {
   wxString retval;
+  AppendOMML(retval);
+  return retval;
+}
 
-  retval = wxT("<m:d>");
+void MatrCell::AppendOMML(wxString &out)
+{
+  out += wxT("<m:d>");
   if (!m_specialMatrix)
   {
     if(m_roundedParens)
-      retval += wxT("<m:dPr><m:begChr>(</m:begChr><m:endChr>)</m:endChr> <m:grow>\"1\"</m:grow></m:dPr>");
+      out += wxT("<m:dPr><m:begChr>(</m:begChr><m:endChr>)</m:endChr> <m:grow>\"1\"</m:grow></m:dPr>");
     else
-      retval += wxT("<m:dPr><m:begChr>[</m:begChr><m:endChr>]</m:endChr> <m:grow>\"1\"</m:grow></m:dPr>");
+      out += wxT("<m:dPr><m:begChr>[</m:begChr><m:endChr>]</m:endChr> <m:grow>\"1\"</m:grow></m:dPr>");
   }
   
-  retval += wxT("<m:e><m:m>");
+  out += wxT("<m:e><m:m>");
 
   for (unsigned int i = 0; i < m_matHeight; i++)
   {
-    retval += wxT("<m:mr>");
+    out += wxT("<m:mr>");
     for (unsigned int j = 0; j < m_matWidth; j++)
-      retval += wxT("<m:e>") + m_cells[i * m_matWidth + j]->ListToOMML() + wxT("</m:e>");
-    retval += wxT("</m:mr>");
+    {
+      out += wxT("<m:e>");
+      m_cells[i * m_matWidth + j]->AppendListOMML(out);
+      out += wxT("</m:e>");
+    }
+    out += wxT("</m:mr>");
   }
 
-  retval += wxT("</m:m></m:e></m:d>");
-  return retval;
+  out += wxT("</m:m></m:e></m:d>");
 }
 
 wxString MatrCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void MatrCell::AppendXML(wxString &out)
 {
   wxString flags;
   if (m_forceBreakLine)
@@ -404,26 +432,27 @@ wxString MatrCell::ToXML()
   if (m_roundedParens)
     flags += wxT(" roundedParens=\"true\"");
 
-  wxString s = wxEmptyString;
   if (m_specialMatrix)
-    s = wxString::Format(
+    out += wxString::Format(
       wxT("<tb") + flags + wxT(" special=\"true\" inference=\"%s\" rownames=\"%s\" colnames=\"%s\">"),
             m_inferenceMatrix ? "true" : "false",
             m_rowNames ? "true" : "false",
             m_colNames ? "true" : "false");
   else
-    s = wxT("<tb") +flags +wxT(">");
+    out += wxT("<tb") +flags +wxT(">");
 
   for (unsigned int i = 0; i < m_matHeight; i++)
   {
-    s += wxT("<mtr>");
+    out += wxT("<mtr>");
     for (unsigned int j = 0; j < m_matWidth; j++)
-      s += wxT("<mtd>") + m_cells[i * m_matWidth + j]->ListToXML() + wxT("</mtd>");
-    s += wxT("</mtr>");
+    {
+      out += wxT("<mtd>");
+      m_cells[i * m_matWidth + j]->AppendListXML(out);
+      out += wxT("</mtd>");
+    }
+    out += wxT("</mtr>");
   }
-  s += wxT("</tb>");
-
-  return s;
+  out += wxT("</tb>");
 }
 
 void MatrCell::SetDimension()
@@ -35,6 +35,7 @@ public:
   MatrCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   MatrCell(const MatrCell &cell);
   Cell *Copy() override {return new MatrCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   //! This class can be derived from wxAccessible which has no copy constructor
   MatrCell &operator=(const MatrCell&) = delete;
   ~MatrCell();
@@ -76,6 +77,14 @@ public:
 
   wxString ToXML() override;
 
+  void AppendTeX(wxString &out) override;
+
+  void AppendMathML(wxString &out) override;
+
+  void AppendOMML(wxString &out) override;
+
+  void AppendXML(wxString &out) override;
+
   void SetSpecialFlag(bool special)
   { m_specialMatrix = special; }
 
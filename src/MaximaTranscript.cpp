@@ -0,0 +1,204 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+
+  This file defines the classes MaximaTranscript and MaximaTranscriptReplayer.
+ */
+
+#include "MaximaTranscript.h"
+#include <string.h>
+
+MaximaTranscript::MaximaTranscript(wxString file) :
+  m_file(file, wxFile::write)
+{
+  if(m_file.IsOpened())
+    m_file.Write(Magic(), strlen(Magic()));
+  else
+    wxLogMessage(_("Cannot create the transcript file %s"), file);
+}
+
+void MaximaTranscript::FromMaxima(const wxString &data)
+{
+  wxScopedCharBuffer const data_raw = data.utf8_str();
+  Write(FromMaximaMarker, data_raw.data(), data_raw.length());
+}
+
+void MaximaTranscript::ToMaxima(const char *data, size_t length)
+{
+  Write(ToMaximaMarker, data, length);
+}
+
+void MaximaTranscript::Write(char direction, const char *data, size_t length)
+{
+  if((!m_file.IsOpened()) || (length == 0))
+    return;
+
+  char header[9];
+  header[0] = direction;
+  wxUint32 time = wxUINT32_SWAP_ON_BE((wxUint32) m_clock.Time());
+  wxUint32 len = wxUINT32_SWAP_ON_BE((wxUint32) length);
+  memcpy(header + 1, &time, 4);
+  memcpy(header + 5, &len, 4);
+  if((m_file.Write(header, sizeof(header)) != sizeof(header)) ||
+     (m_file.Write(data, length) != length))
+  {
+    wxLogMessage(_("Cannot write to the transcript file => Stopping recording it."));
+    m_file.Close();
+  }
+}
+
+MaximaTranscriptReplayer::MaximaTranscriptReplayer(wxString file, bool fullSpeed) :
+  m_file(file),
+  m_socket(NULL),
+  m_pendingSent(0),
+  m_pendingTime(0),
+  m_fullSpeed(fullSpeed),
+  m_ok(false)
+{
+  if(!m_file.IsOpened())
+    return;
+
+  size_t magicLength = strlen(MaximaTranscript::Magic());
+  wxCharBuffer magic(magicLength);
+  if((m_file.Read(magic.data(), magicLength) != (ssize_t) magicLength) ||
+     (memcmp(magic.data(), MaximaTranscript::Magic(), magicLength) != 0))
+  {
+    wxLogMessage(_("%s isn't a transcript of a maxima session."), file);
+    return;
+  }
+  m_ok = true;
+
+  m_timer.SetOwner(this);
+  wxEvtHandler::Connect(wxEVT_TIMER,
+                        wxTimerEventHandler(MaximaTranscriptReplayer::OnTimer), NULL, this);
+  wxEvtHandler::Connect(wxEVT_SOCKET,
+                        wxSocketEventHandler(MaximaTranscriptReplayer::OnSocketEvent), NULL, this);
+}
+
+MaximaTranscriptReplayer::~MaximaTranscriptReplayer()
+{
+  m_timer.Stop();
+  if(m_socket)
+  {
+    // Don't let the socket send events to an object that no more exists
+    m_socket->Notify(false);
+    m_socket->Destroy();
+  }
+}
+
+bool MaximaTranscriptReplayer::Connect(int port)
+{
+  if(!m_ok)
+    return false;
+
+  wxIPV4address addr;
+  addr.LocalHost();
+  addr.Service(port);
+
+  m_socket = new wxSocketClient(wxSOCKET_NOWAIT);
+  m_socket->SetEventHandler(*this);
+  m_socket->SetNotify(wxSOCKET_INPUT_FLAG|wxSOCKET_LOST_FLAG);
+  m_socket->Notify(true);
+  // The frontend accepts the connection only in its event loop => we must not
+  // wait for the connection to be established here.
+  m_socket->Connect(addr, false);
+
+  m_clock.Start();
+  m_timer.Start(10);
+  return true;
+}
+
+bool MaximaTranscriptReplayer::ReadNextRecord()
+{
+  char header[9];
+  while(m_file.Read(header, sizeof(header)) == sizeof(header))
+  {
+    wxUint32 time;
+    wxUint32 length;
+    memcpy(&time, header + 1, 4);
+    memcpy(&length, header + 5, 4);
+    time = wxUINT32_SWAP_ON_BE(time);
+    length = wxUINT32_SWAP_ON_BE(length);
+
+    // What the frontend has sent to maxima is only recorded for reference.
+    if(header[0] != MaximaTranscript::FromMaximaMarker)
+    {
+      if(m_file.Seek(length, wxFromCurrent) == wxInvalidOffset)
+        break;
+      continue;
+    }
+
+    m_pending.SetDataLen(0);
+    if(m_file.Read(m_pending.GetWriteBuf(length), length) != (ssize_t) length)
+      break;
+    m_pending.UngetWriteBuf(length);
+    m_pendingSent = 0;
+    m_pendingTime = time;
+    return true;
+  }
+  return false;
+}
+
+void MaximaTranscriptReplayer::OnTimer(wxTimerEvent &WXUNUSED(event))
+{
+  if((!m_socket) || (!m_socket->IsConnected()))
+    return;
+
+  while(true)
+  {
+    if(m_pendingSent >= m_pending.GetDataLen())
+    {
+      if(!ReadNextRecord())
+      {
+        wxLogMessage(_("The replay of the maxima transcript is complete."));
+        m_timer.Stop();
+        return;
+      }
+    }
+
+    if((!m_fullSpeed) && (m_pendingTime > (wxUint32) m_clock.Time()))
+      return;
+
+    m_socket->Write((char *)m_pending.GetData() + m_pendingSent,
+                    m_pending.GetDataLen() - m_pendingSent);
+    m_pendingSent += m_socket->LastWriteCount();
+
+    // The frontend hasn't read everything we sent so far => try again later.
+    if(m_pendingSent < m_pending.GetDataLen())
+      return;
+  }
+}
+
+void MaximaTranscriptReplayer::OnSocketEvent(wxSocketEvent &event)
+{
+  switch (event.GetSocketEvent())
+  {
+  case wxSOCKET_INPUT:
+    m_socket->Discard();
+    break;
+  case wxSOCKET_LOST:
+    m_timer.Stop();
+    break;
+  default:
+    break;
+  }
+}
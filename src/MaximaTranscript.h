@@ -0,0 +1,109 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+
+  This file declares the classes that record the communication with maxima
+  and that play it back again as a fake maxima process.
+ */
+
+#ifndef MAXIMATRANSCRIPT_H
+#define MAXIMATRANSCRIPT_H
+
+#include <wx/wx.h>
+#include <wx/file.h>
+#include <wx/socket.h>
+#include <wx/stopwatch.h>
+#include <wx/timer.h>
+#include <wx/buffer.h>
+
+/*! Records everything that is sent over the socket maxima is connected to
+
+  The transcript is a binary file that starts with MaximaTranscript::Magic().
+  It is followed by one record per chunk of data that was sent or received:
+   - One byte telling the direction: '<' = from maxima, '>' = to maxima
+   - The time since the recording started in milliseconds as a little-endian
+     32-bit number
+   - The length of the data in bytes as a little-endian 32-bit number
+   - The data itself, UTF-8-encoded
+ */
+class MaximaTranscript
+{
+public:
+  explicit MaximaTranscript(wxString file);
+  //! Could the transcript file be created?
+  bool IsOk() const {return m_file.IsOpened();}
+  //! Record data maxima has sent us
+  void FromMaxima(const wxString &data);
+  //! Record data we have sent to maxima
+  void ToMaxima(const char *data, size_t length);
+  //! The bytes a transcript starts with
+  static const char *Magic(){return "wxMaximaTranscript1\n";}
+  //! The marker for data maxima has sent
+  static const char FromMaximaMarker = '<';
+  //! The marker for data that was sent to maxima
+  static const char ToMaximaMarker = '>';
+
+private:
+  void Write(char direction, const char *data, size_t length);
+  wxFile m_file;
+  wxStopWatch m_clock;
+};
+
+/*! A fake maxima that plays back the maxima side of a transcript
+
+  Connects to the socket server wxMaxima has opened for maxima just as a real
+  maxima would and sends everything maxima has sent while the transcript was
+  recorded, either with the original timing or as fast as the frontend accepts
+  it. Everything the frontend sends is discarded: The replay doesn't wait for
+  the commands the recorded answers belong to.
+ */
+class MaximaTranscriptReplayer : public wxEvtHandler
+{
+public:
+  MaximaTranscriptReplayer(wxString file, bool fullSpeed);
+  ~MaximaTranscriptReplayer();
+  //! Could the transcript be opened and does it look like one?
+  bool IsOk() const {return m_ok;}
+  //! Connect to the port the frontend listens on and start the replay
+  bool Connect(int port);
+
+private:
+  //! Read the next chunk of data maxima has sent into m_pending
+  bool ReadNextRecord();
+  //! Sends all data that is due, as far as the socket accepts it
+  void OnTimer(wxTimerEvent &event);
+  void OnSocketEvent(wxSocketEvent &event);
+  wxFile m_file;
+  wxSocketClient *m_socket;
+  wxTimer m_timer;
+  wxStopWatch m_clock;
+  //! The chunk of data we currently try to send
+  wxMemoryBuffer m_pending;
+  //! How many bytes of m_pending have already been sent
+  size_t m_pendingSent;
+  //! When m_pending was sent in the original session [ms]
+  wxUint32 m_pendingTime;
+  bool m_fullSpeed;
+  bool m_ok;
+};
+
+#endif // MAXIMATRANSCRIPT_H
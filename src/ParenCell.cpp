@@ -463,62 +463,108 @@ wxString ParenCell::ToMatlab()
 wxString ParenCell::ToTeX()
 {
   wxString s;
-  if (!m_isBrokenIntoLines)
+  AppendTeX(s);
+  return s;
+}
+
+void ParenCell::AppendTeX(wxString &out)
+{
+  if (m_isBrokenIntoLines)
+    return;
+
+  if (!m_print)
   {
-    wxString innerCell = m_innerCell->ListToTeX();
+    m_innerCell->AppendListTeX(out);
+    return;
+  }
 
-    // Let's see if the cell contains anything potentially higher than a normal
-    // character.
-    bool needsLeftRight = false;
-    for (size_t i = 0; i < innerCell.Length(); i++)
-      if (!wxIsalnum(innerCell[i]))
-      {
-        needsLeftRight = true;
-        break;
-      }
+  // Which parenthesis we need depends on the contents => we need to generate them first.
+  wxString innerCell;
+  m_innerCell->AppendListTeX(innerCell);
 
-    if (m_print)
+  // Let's see if the cell contains anything potentially higher than a normal
+  // character.
+  bool needsLeftRight = false;
+  for (size_t i = 0; i < innerCell.Length(); i++)
+    if (!wxIsalnum(innerCell[i]))
     {
-      if (needsLeftRight)
-        s = wxT("\\left( ") + m_innerCell->ListToTeX() + wxT("\\right) ");
-      else
-        s = wxT("(") + m_innerCell->ListToTeX() + wxT(")");
+      needsLeftRight = true;
+      break;
     }
-    else
-      s = m_innerCell->ListToTeX();
+
+  if (needsLeftRight)
+  {
+    out += wxT("\\left( ");
+    out += innerCell;
+    out += wxT("\\right) ");
+  }
+  else
+  {
+    out += wxT("(");
+    out += innerCell;
+    out += wxT(")");
   }
-  return s;
 }
 
 wxString ParenCell::ToOMML()
 {
-  return wxT("<m:d><m:dPr m:begChr=\"") + XMLescape(m_open->ToString()) + wxT("\" m:endChr=\"") +
-         XMLescape(m_close->ToString()) + wxT("\" m:grow=\"1\"></m:dPr><m:e>") +
-         m_innerCell->ListToOMML() + wxT("</m:e></m:d>");
+  wxString s;
+  AppendOMML(s);
+  return s;
+}
+
+void ParenCell::AppendOMML(wxString &out)
+{
+  out += wxT("<m:d><m:dPr m:begChr=\"") + XMLescape(m_open->ToString()) + wxT("\" m:endChr=\"") +
+    XMLescape(m_close->ToString()) + wxT("\" m:grow=\"1\"></m:dPr><m:e>");
+  m_innerCell->AppendListOMML(out);
+  out += wxT("</m:e></m:d>");
 }
 
 wxString ParenCell::ToMathML()
 {
-  if (!m_print) return m_innerCell->ListToMathML();
+  wxString s;
+  AppendMathML(s);
+  return s;
+}
+
+void ParenCell::AppendMathML(wxString &out)
+{
+  if (!m_print)
+  {
+    m_innerCell->AppendListMathML(out);
+    return;
+  }
 
   wxString open = m_open->ToString();
   wxString close = m_close->ToString();
-  return (
-          wxT("<mrow><mo>") + XMLescape(open) + wxT("</mo>") +
-          m_innerCell->ListToMathML() +
-          wxT("<mo>") + XMLescape(close) + wxT("</mo></mrow>\n")
-  );
+  out += wxT("<mrow><mo>") + XMLescape(open) + wxT("</mo>");
+  m_innerCell->AppendListMathML(out);
+  out += wxT("<mo>") + XMLescape(close) + wxT("</mo></mrow>\n");
 }
 
 wxString ParenCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void ParenCell::AppendXML(wxString &out)
 {
 //  if( m_isBrokenIntoLines )
-//    return wxEmptyString;
-  wxString s = m_innerCell->ListToXML();
+//    return;
+  if (!m_print)
+  {
+    m_innerCell->AppendListXML(out);
+    return;
+  }
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
-  return ((m_print) ? _T("<r><p") + flags + wxT(">") + s + _T("</p></r>") : s);
+  out += _T("<r><p") + flags + wxT(">");
+  m_innerCell->AppendListXML(out);
+  out += _T("</p></r>");
 }
 
 bool ParenCell::BreakUp()
@@ -53,6 +53,7 @@ public:
   ParenCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   ParenCell(const ParenCell &cell);
   Cell *Copy() override {return new ParenCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
 
   ~ParenCell();
 
@@ -89,6 +90,14 @@ public:
 
   wxString ToXML() override;
 
+  void AppendTeX(wxString &out) override;
+
+  void AppendMathML(wxString &out) override;
+
+  void AppendOMML(wxString &out) override;
+
+  void AppendXML(wxString &out) override;
+
 protected:
    /*! How to create a big parenthesis sign?
    */
@@ -37,7 +37,6 @@
 #include <wx/file.h>
 #include <wx/filename.h>
 #include <wx/filesys.h>
-#include <wx/fs_mem.h>
 #include <wx/utils.h>
 #include <wx/clipbrd.h>
 #include <wx/config.h>
@@ -139,7 +138,8 @@ void SlideShow::StopTimer()
 
 void SlideShow::AnimationRunning(bool run)
 {
-  if(run)
+  // The timer also tells the worksheet to look for newly rendered frames.
+  if(run || FramesPending())
     ReloadTimer();
   else
     StopTimer();
@@ -234,14 +234,71 @@ void SlideShow::LoadImages(wxArrayString images, bool deleteRead)
   m_displayed = 0;
 }
 
+void SlideShow::RenderImages(wxArrayString images)
+{
+  wxString gnuplotFilename;
+  wxString dataFilename;
+
+  m_renderer = std::shared_ptr<FrameRenderer>(
+    new FrameRenderer((*m_configuration)->GetGnuplotBinary(),
+                      (*m_configuration)->AnimationJobs()));
+  for (size_t i = 0; i < images.GetCount(); i++)
+  {
+    if(images[i].EndsWith(".gnuplot"))
+      gnuplotFilename = images[i];
+    else
+    {
+      if(images[i].EndsWith(".data"))
+        dataFilename = images[i];
+      else
+      {
+        // An empty image the frame is loaded into as soon as gnuplot has written it.
+        std::shared_ptr<Image> image(new Image(m_configuration));
+        m_images.push_back(image);
+        if(gnuplotFilename != wxEmptyString)
+          image->GnuplotSource(gnuplotFilename, dataFilename);
+        m_renderer->AddFrame(gnuplotFilename, images[i], image);
+      }
+    }
+  }
+  m_fileSystem = NULL;
+  m_displayed = 0;
+  m_renderer->Run();
+  UpdateRenderedFrames();
+  ReloadTimer();
+}
+
+bool SlideShow::UpdateRenderedFrames()
+{
+  if(!m_renderer)
+    return false;
+
+  int oldSize = m_size;
+  m_size = m_renderer->FramesReady();
+  if(m_renderer->Finished())
+  {
+    m_renderer.reset();
+    if(!m_animationRunning)
+      StopTimer();
+  }
+  return m_size != oldSize;
+}
+
 SlideShow::SlideShow(const SlideShow &cell):
   SlideShow(cell.m_group, cell.m_configuration, cell.m_cellPointers)
 {
   CopyCommonData(cell);
+  // The renderer loads the frames that still are being rendered into our
+  // images, too.
+  m_renderer = cell.m_renderer;
   AnimationRunning(false);
 
   for (size_t i = 0; i < cell.m_images.size(); i++)
+  {
     m_images.push_back(std::shared_ptr<Image>(new Image(*cell.m_images[i])));
+    if(m_renderer)
+      m_renderer->AddTarget(i, m_images.back());
+  }
 
   m_framerate = cell.m_framerate;
   m_displayed = true;
@@ -253,6 +310,10 @@ SlideShow::SlideShow(const SlideShow &cell):
 SlideShow::~SlideShow()
 {
   SlideShow::MarkAsDeleted();
+  // The renderer only keeps weak pointers to our images => dropping them
+  // cancels the gnuplot runs for frames that haven't been started yet.
+  m_images.clear();
+  m_renderer.reset();
 }
 
 void SlideShow::MarkAsDeleted()
@@ -322,7 +383,7 @@ void SlideShow::Draw(wxPoint point)
   if(m_animationRunning)
     ReloadTimer();
   
-  if (DrawThisCell(point) && (m_images[m_displayed] != NULL))
+  if (DrawThisCell(point) && (m_displayed < m_size) && (m_images[m_displayed] != NULL))
   {
     // Start the timer once the animation appears on the screen.
     // But start it only once: Else the animation could be refreshed
@@ -396,10 +457,13 @@ wxString SlideShow::ToXML()
   wxString gnuplotSourceFiles;
   wxString gnuplotDataFiles;
 
+  // Frames gnuplot still is rendering aren't saved: Waiting for them here would
+  // block the GUI. The worksheet is marked as modified again as soon as they
+  // arrive, so the next save contains them.
   for (int i = 0; i < m_size; i++)
   {
-    wxString basename = m_cellPointers->WXMXGetNewFileName();
-    // add the file to memory
+    wxString imageName;
+    // Schedule the files of this frame for being saved
     if (m_images[i])
     {
       // Anonymize the name of our temp directory for saving
@@ -420,36 +484,19 @@ wxString SlideShow::ToXML()
       if(gnuplotSource != wxEmptyString)
       {
         gnuplotSourceFiles += gnuplotSource + ";";
-        wxMemoryBuffer data = m_images[i]->GetGnuplotSource();
-        if(data.GetDataLen() > 0)
-        {
-          wxMemoryFSHandler::AddFile(gnuplotSource,
-                                     data.GetData(),
-                                     data.GetDataLen()
-            );
-        }
+        m_cellPointers->WXMXAddFile(gnuplotSource, m_images[i]->GetCompressedGnuplotSource(), true);
       }
       if(gnuplotData != wxEmptyString)
       {
         gnuplotDataFiles += gnuplotData + ";";
-        wxMemoryBuffer data = m_images[i]->GetGnuplotData();
-        if(data.GetDataLen() > 0)
-        {
-          wxMemoryFSHandler::AddFile(gnuplotData,
-                                     data.GetData(),
-                                     data.GetDataLen()
-            );
-        }
+        m_cellPointers->WXMXAddFile(gnuplotData, m_images[i]->GetCompressedGnuplotData(), true);
       }
       
-      if (m_images[i]->GetCompressedImage())
-        wxMemoryFSHandler::AddFile(basename + m_images[i]->GetExtension(),
-                                   m_images[i]->GetCompressedImage().GetData(),
-                                   m_images[i]->GetCompressedImage().GetDataLen()
-        );
+      imageName = m_cellPointers->WXMXAddImage(m_images[i]->GetCompressedImage(),
+                                               m_images[i]->GetExtension());
     }
 
-    images += basename + m_images[i]->GetExtension() + wxT(";");
+    images += imageName + wxT(";");
   }
 
   wxString flags;
@@ -534,7 +581,7 @@ wxString SlideShow::GetToolTip(const wxPoint &point)
                "One example of the latter would be: Gnuplot refuses to plot entirely "
                "empty images"));
     else
-      return m_toolTip;
+      return GetLocalToolTip();
   }
   else
     return wxEmptyString;
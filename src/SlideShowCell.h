@@ -31,6 +31,7 @@
 
 #include "Cell.h"
 #include "Image.h"
+#include "FrameRenderer.h"
 #include <wx/image.h>
 #include <wx/timer.h>
 
@@ -67,6 +68,7 @@ public:
   SlideShow(Cell *parent, Configuration **config, CellPointers *cellPointers, wxString image, bool remove);
 
   Cell *Copy() override {return new SlideShow(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
   ~SlideShow();
   SlideShow &operator=(const SlideShow&) = delete;
   void LoadImages(wxMemoryBuffer imageData);
@@ -106,6 +108,23 @@ public:
 
   void LoadImages(wxArrayString images, bool deleteRead);
 
+  /*! Load frames gnuplot still has to render
+
+    \param images The same list of files LoadImages() expects. gnuplot is run 
+    on each frame's .gnuplot file, using several processes in parallel. 
+    The frames are added to the animation as soon as they are ready.
+   */
+  void RenderImages(wxArrayString images);
+
+  /*! Add the frames that have been rendered since the last call to the animation
+
+    \return true, if the number of frames has changed.
+   */
+  bool UpdateRenderedFrames();
+
+  //! Are there frames that still are being rendered?
+  bool FramesPending() const {return m_renderer != NULL;}
+
   int GetDisplayedIndex() const
   { return m_displayed; }
 
@@ -158,7 +177,7 @@ public:
   void AnimationRunning(bool run);
   bool CanPopOut() override
     {
-      return (!m_images[m_displayed]->GnuplotSource().IsEmpty());
+      return m_images[m_displayed]->HasGnuplotSource();
     }
 
   void GnuplotSource(int image, wxString gnuplotFilename, wxString dataFilename, const std::shared_ptr<wxFileSystem> &filesystem)
@@ -194,6 +213,8 @@ protected:
   int m_displayed;
   std::shared_ptr<wxFileSystem> m_fileSystem;
   vector<std::shared_ptr<Image>> m_images;
+  //! Runs gnuplot for the frames RenderImages() has been given
+  std::shared_ptr<FrameRenderer> m_renderer;
 
   void RecalculateHeight(int fontsize) override;
 
@@ -336,14 +336,23 @@ wxString SqrtCell::ToOMML()
 }
 
 wxString SqrtCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void SqrtCell::AppendXML(wxString &out)
 {
 //  if (m_isBrokenIntoLines)
-//    return wxEmptyString;
+//    return;
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
 
-  return wxT("<q") + flags + wxT(">") + m_innerCell->ListToXML() + wxT("</q>");
+  out += wxT("<q") + flags + wxT(">");
+  m_innerCell->AppendListXML(out);
+  out += wxT("</q>");
 }
 
 bool SqrtCell::BreakUp()
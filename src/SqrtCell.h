@@ -51,6 +51,7 @@ public:
   SqrtCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   SqrtCell(const SqrtCell &cell);
   Cell *Copy() override {return new SqrtCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
 
   ~SqrtCell();
 
@@ -81,6 +82,8 @@ public:
 
   wxString ToXML() override;
 
+  void AppendXML(wxString &out) override;
+
 protected:
   std::shared_ptr<Cell> m_innerCell;
   std::shared_ptr<TextCell> m_open;
@@ -121,8 +121,8 @@ void SubCell::Draw(wxPoint point)
 
 wxString SubCell::ToString()
 {
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText;
+  if (!GetAltCopyText().IsEmpty())
+    return GetAltCopyText();
 
   wxString s;
   if (m_baseCell->IsCompound())
@@ -135,9 +135,9 @@ wxString SubCell::ToString()
 
 wxString SubCell::ToMatlab()
 {
-  if (m_altCopyText != wxEmptyString)
+  if (!GetAltCopyText().IsEmpty())
   {
-	return m_altCopyText;
+	return GetAltCopyText();
   }
 
   wxString s;
@@ -180,14 +180,24 @@ wxString SubCell::ToOMML()
 }
 
 wxString SubCell::ToXML()
+{
+  wxString s;
+  AppendXML(s);
+  return s;
+}
+
+void SubCell::AppendXML(wxString &out)
 {
   wxString flags;
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
 
-  if (m_altCopyText != wxEmptyString)
-    flags += wxT(" altCopy=\"") + XMLescape(m_altCopyText) + wxT("\"");
+  if (!GetAltCopyText().IsEmpty())
+    flags += wxT(" altCopy=\"") + XMLescape(GetAltCopyText()) + wxT("\"");
   
-  return wxT("<i") + flags + wxT("><r>") + m_baseCell->ListToXML() + wxT("</r><r>") +
-           m_indexCell->ListToXML() + wxT("</r></i>");
+  out += wxT("<i") + flags + wxT("><r>");
+  m_baseCell->AppendListXML(out);
+  out += wxT("</r><r>");
+  m_indexCell->AppendListXML(out);
+  out += wxT("</r></i>");
 }
@@ -31,6 +31,7 @@ public:
   SubCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   SubCell(const SubCell &cell);
   Cell *Copy() override {return new SubCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
 
   ~SubCell();
 
@@ -60,6 +61,8 @@ public:
 
   wxString ToXML() override;
 
+  void AppendXML(wxString &out) override;
+
 protected:
   std::shared_ptr<Cell> m_baseCell;
   std::shared_ptr<Cell> m_indexCell;
@@ -267,8 +267,8 @@ void SubSupCell::Draw(wxPoint point)
 
 wxString SubSupCell::ToString()
 {
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText;
+  if (!GetAltCopyText().IsEmpty())
+    return GetAltCopyText();
 
   wxString s;
   if (m_baseCell->IsCompound())
@@ -469,8 +469,8 @@ wxString SubSupCell::ToXML()
   if (m_forceBreakLine)
     flags += wxT(" breakline=\"true\"");
 
-  if (m_altCopyText != wxEmptyString)
-    flags += wxT(" altCopy=\"") + XMLescape(m_altCopyText) + wxT("\"");
+  if (!GetAltCopyText().IsEmpty())
+    flags += wxT(" altCopy=\"") + XMLescape(GetAltCopyText()) + wxT("\"");
 
   wxString retval;
   if(m_innerCellList.empty())
@@ -32,6 +32,7 @@ public:
   SubSupCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   SubSupCell(const SubSupCell &cell);
   Cell *Copy() override {return new SubSupCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
 
   ~SubSupCell();
 
@@ -262,8 +262,8 @@ void SumCell::Draw(wxPoint point)
 
 wxString SumCell::ToString()
 {
-  if (m_altCopyText != wxEmptyString)
-    return m_altCopyText;
+  if (!GetAltCopyText().IsEmpty())
+    return GetAltCopyText();
 
   wxString s;
   if (m_sumStyle == SM_SUM)
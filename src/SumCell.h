@@ -46,6 +46,7 @@ public:
   SumCell(Cell *parent, Configuration **config, CellPointers *cellPointers);
   SumCell(const SumCell &cell);
   Cell *Copy() override {return new SumCell(*this);}
+  size_t GetMemoryUsage() const override {return sizeof(*this);}
 
   ~SumCell();
 
@@ -29,17 +29,12 @@
 #include "TableOfContents.h"
 
 #include <wx/sizer.h>
-#include <wx/regex.h>
+#include <unordered_set>
 
 TableOfContents::TableOfContents(wxWindow *parent, int id, Configuration **config) : wxPanel(parent, id)
 {
   m_configuration = config;
-  m_displayedItems = new wxListCtrl(
-          this, structure_ctrl_id,
-          wxDefaultPosition, wxDefaultSize,
-          wxLC_SINGLE_SEL | wxLC_ALIGN_LEFT | wxLC_REPORT | wxLC_NO_HEADER
-  );
-  m_displayedItems->AppendColumn(wxEmptyString);
+  m_displayedItems = new HeadingList(this, structure_ctrl_id);
   m_regex = new wxTextCtrl(this, structure_regex_id);
 
   // A box whose 1st row is growable 
@@ -50,6 +45,8 @@ TableOfContents::TableOfContents(wxWindow *parent, int id, Configuration **confi
   box->Add(m_displayedItems, wxSizerFlags().Expand());
   box->Add(m_regex, wxSizerFlags().Expand());
   m_lastSelection = -1;
+  m_cellRightClickedOn = NULL;
+  m_rescanNeeded = false;
 
   SetSizer(box);
   box->Fit(this);
@@ -59,6 +56,31 @@ TableOfContents::TableOfContents(wxWindow *parent, int id, Configuration **confi
   Connect(wxEVT_LIST_ITEM_RIGHT_CLICK, wxListEventHandler(TableOfContents::OnMouseRightDown));
 }
 
+TableOfContents::HeadingList::HeadingList(TableOfContents *parent, int id) :
+  wxListCtrl(parent, id, wxDefaultPosition, wxDefaultSize,
+             wxLC_SINGLE_SEL | wxLC_ALIGN_LEFT | wxLC_REPORT | wxLC_NO_HEADER | wxLC_VIRTUAL)
+{
+  m_toc = parent;
+  AppendColumn(wxEmptyString);
+  m_foldedAttr.SetTextColour(wxSystemSettings::GetColour(wxSYS_COLOUR_GRAYTEXT));
+}
+
+wxString TableOfContents::HeadingList::OnGetItemText(long item, long WXUNUSED(column)) const
+{
+  if((item < 0) || (item >= (long) m_toc->m_displayed.size()))
+    return wxEmptyString;
+  return m_toc->TocEntry(m_toc->m_displayed[item]);
+}
+
+wxListItemAttr *TableOfContents::HeadingList::OnGetItemAttr(long item) const
+{
+  if((item < 0) || (item >= (long) m_toc->m_displayed.size()))
+    return NULL;
+  if (m_toc->m_displayed[item]->GetHiddenTree())
+    return &m_foldedAttr;
+  return NULL;
+}
+
 void TableOfContents::OnSize(wxSizeEvent &event)
 {
   m_displayedItems->SetColumnWidth(0, event.GetSize().x);
@@ -69,209 +91,244 @@ TableOfContents::~TableOfContents()
 {
 }
 
-void TableOfContents::UpdateTableOfContents(GroupCell *tree, GroupCell *pos)
+bool TableOfContents::IsHeading(GroupCell *cell)
+{
+  int groupType = cell->GetGroupType();
+  return (
+    (groupType == GC_TYPE_TITLE) ||
+    (groupType == GC_TYPE_SECTION) ||
+    (groupType == GC_TYPE_SUBSECTION) ||
+    (groupType == GC_TYPE_SUBSUBSECTION) ||
+    (groupType == GC_TYPE_HEADING5) ||
+    (groupType == GC_TYPE_HEADING6)
+    );
+}
+
+void TableOfContents::UpdateTableOfContents(GroupCell *tree, GroupCell *pos, bool rescan)
 {
-  long selection = m_lastSelection;
-  if (IsShown())
+  if (!IsShown())
+  {
+    // Without a rescan at the time we are shown we might miss changes.
+    m_rescanNeeded = true;
+    return;
+  }
+
+  if (rescan || m_rescanNeeded)
   {
-    GroupCell *cell = dynamic_cast<GroupCell *>(tree);
+    m_rescanNeeded = false;
     m_structure.clear();
 
     // Get the current list of tokens that should be in the Table Of Contents.
+    GroupCell *cell = tree;
     while (cell != NULL)
     {
-      int groupType = cell->GetGroupType();
-      if (
-              (groupType == GC_TYPE_TITLE) ||
-              (groupType == GC_TYPE_SECTION) ||
-              (groupType == GC_TYPE_SUBSECTION) ||
-              (groupType == GC_TYPE_SUBSUBSECTION) ||
-              (groupType == GC_TYPE_HEADING5) ||
-              (groupType == GC_TYPE_HEADING6)
-              )
+      if (IsHeading(cell))
         m_structure.push_back(cell);
-
-      // Select the cell with the cursor
-      if (cell == pos)
-      {
-        if (!m_structure.empty())
-          selection = m_structure.size() - 1;
-      }
-
       cell = cell->GetNext();
     }
-
-    long item = m_displayedItems->GetNextItem(-1,
-                                              wxLIST_NEXT_ALL,
-                                              wxLIST_STATE_SELECTED);
-
-    if ((selection >= 0) && (item != selection))
-    {
-      if ((long) m_displayedItems->GetItemCount() < selection)
-        selection = m_displayedItems->GetItemCount() - 1;
-      if ((selection >= 0) && (selection < m_displayedItems->GetItemCount()))
-      {
-        m_displayedItems->SetItemState(selection,
-                                       wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED,
-                                       wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
-        m_displayedItems->EnsureVisible(selection);
-      }
-      m_lastSelection = selection;
-    }
     UpdateDisplay();
   }
+  else
+  {
+    // The headings' titles and numbers are only read when they are drawn =>
+    // We only need to re-apply the filter.
+    if (m_regex->GetValue().IsEmpty())
+      m_displayedItems->Refresh();
+    else
+      UpdateDisplay();
+  }
+  SelectCell(pos);
 }
 
-void TableOfContents::UpdateDisplay()
+void TableOfContents::CellsInserted(GroupCell *first, GroupCell *last)
 {
-  wxString regex = m_regex->GetValue();
-  wxArrayString items;
-  wxRegEx matcher;
-
-  if (regex != wxEmptyString)
-    matcher.Compile(regex);
+  if ((first == NULL) || m_rescanNeeded)
+    return;
 
-  // Create a wxArrayString containing all section/chapter/... titles we want
-  // to display
-  for (unsigned int i = 0; i < m_structure.size(); i++)
+  // Collect the new headings
+  std::vector<GroupCell *> headings;
+  GroupCell *cell = first;
+  while (cell != NULL)
   {
-    // Indentation further reduces the screen real-estate. So it is to be used
-    // sparingly. But we should perhaps add at least a little bit of it to make
-    // the list more readable.
-    wxString curr;
+    if (IsHeading(cell))
+      headings.push_back(cell);
+    if (cell == last)
+      break;
+    cell = cell->GetNext();
+  }
+  if (headings.empty())
+    return;
 
-    if ((*m_configuration)->TocShowsSectionNumbers())
+  // The new headings go after the last heading above the inserted cells
+  std::vector<GroupCell *>::iterator insertionPoint = m_structure.begin();
+  cell = dynamic_cast<GroupCell *>(first->m_previous);
+  while ((cell != NULL) && (!IsHeading(cell)))
+    cell = dynamic_cast<GroupCell *>(cell->m_previous);
+  if (cell != NULL)
+  {
+    std::vector<GroupCell *>::iterator it = m_structure.begin();
+    while ((it != m_structure.end()) && (*it != cell))
+      ++it;
+    if (it == m_structure.end())
     {
-      if(m_structure[i]->GetPrompt() != NULL)
-        curr = m_structure[i]->GetPrompt() -> ToString() + wxT(" ");
-      curr.Trim(false);
+      // The heading above us isn't known to us => Don't know where to insert.
+      m_rescanNeeded = true;
+      return;
     }
-    else
-      switch (dynamic_cast<GroupCell *>(m_structure[i])->GetGroupType())
-      {
-      case GC_TYPE_TITLE:
-        break;
-      case GC_TYPE_SECTION:
-        curr = wxT("  ");
-        break;
-      case GC_TYPE_SUBSECTION:
-        curr = wxT("    ");
-        break;
-      case GC_TYPE_SUBSUBSECTION:
-        curr = wxT("      ");
-        break;
-      case GC_TYPE_HEADING5:
-        curr = wxT("        ");
-        break;
-      case GC_TYPE_HEADING6:
-        curr = wxT("          ");
-        break;
-      default:
-        break;
-      }
-    
-    curr += m_structure[i]->GetEditable()->ToString(true);
+    insertionPoint = it + 1;
+  }
+  m_structure.insert(insertionPoint, headings.begin(), headings.end());
+  UpdateDisplay();
+}
 
-    // Respecting linebreaks doesn't make much sense here.
-    curr.Replace(wxT("\n"), wxT(" "));
+void TableOfContents::CellsDeleted(GroupCell *first, GroupCell *last)
+{
+  if (first == NULL)
+    return;
 
-    if (regex.Length() > 0 && matcher.IsValid())
+  // Collect the cells that are deleted including the ones that are hidden
+  // in folded sections, as they are deleted, too.
+  std::unordered_set<GroupCell *> deleted;
+  std::vector<GroupCell *> toVisit;
+  toVisit.push_back(first);
+  while (!toVisit.empty())
+  {
+    GroupCell *cell = toVisit.back();
+    toVisit.pop_back();
+    bool isRange = (cell == first);
+    while (cell != NULL)
     {
-      if (matcher.Matches(curr))
-        items.Add(curr);
+      deleted.insert(cell);
+      if (cell->GetHiddenTree() != NULL)
+        toVisit.push_back(cell->GetHiddenTree());
+      if (isRange && (cell == last))
+        break;
+      cell = cell->GetNext();
     }
-    else
-      items.Add(curr);
   }
 
-  // Work around a wxWidgets bug: items==m_items_old if items is empty and m_items_old isn't.
-  if ((items != m_items_old) || (items.GetCount() == 0))
-  {
-    // Update the name of all existing items and add new items, if necessary.
-    // We don't just empty the item list and create a new one since on Windows this
-    // causes excessive flickering.
-    for (unsigned int i = 0; i < items.GetCount(); i++)
+  if (deleted.find(m_cellRightClickedOn) != deleted.end())
+    m_cellRightClickedOn = NULL;
+
+  std::vector<GroupCell *>::iterator out = m_structure.begin();
+  for (std::vector<GroupCell *>::iterator it = m_structure.begin(); it != m_structure.end(); ++it)
+    if (deleted.find(*it) == deleted.end())
+      *out++ = *it;
+  if (out == m_structure.end())
+    return;
+  m_structure.erase(out, m_structure.end());
+  UpdateDisplay();
+}
+
+void TableOfContents::SelectCell(GroupCell *pos)
+{
+  // Find the heading of the section the cursor is in
+  GroupCell *heading = pos;
+  while ((heading != NULL) && (!IsHeading(heading)))
+    heading = dynamic_cast<GroupCell *>(heading->m_previous);
+  if (heading == NULL)
+    return;
+
+  long selection = -1;
+  for (long i = 0; i < (long) m_displayed.size(); i++)
+    if (m_displayed[i] == heading)
     {
-      if (i < (unsigned) m_displayedItems->GetItemCount())
-        m_displayedItems->SetItemText(i, items[i]);
-      else
-        m_displayedItems->InsertItem(i, items[i]);
-      
-      if (m_structure[i]->GetHiddenTree())
-        m_displayedItems->SetItemTextColour(i, wxSystemSettings::GetColour(wxSYS_COLOUR_GRAYTEXT));
-      else
-        m_displayedItems->SetItemTextColour(i, wxSystemSettings::GetColour(wxSYS_COLOUR_WINDOWTEXT));
+      selection = i;
+      break;
     }
-    // Delete superfluous items
-    for (unsigned int i = m_displayedItems->GetItemCount(); i > items.GetCount() ; i--)
-      m_displayedItems->DeleteItem(i - 1);
-    m_items_old = items;
+
+  long item = m_displayedItems->GetNextItem(-1,
+                                            wxLIST_NEXT_ALL,
+                                            wxLIST_STATE_SELECTED);
+
+  if ((selection >= 0) && (item != selection))
+  {
+    m_displayedItems->SetItemState(selection,
+                                   wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED,
+                                   wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+    m_displayedItems->EnsureVisible(selection);
+    m_lastSelection = selection;
   }
 }
 
-GroupCell *TableOfContents::GetCell(int index)
+wxString TableOfContents::TocEntry(GroupCell *cell) const
 {
-  wxRegEx matcher;
-  int currentIndex = -1;
-  wxString regex = m_regex->GetValue();
+  // Indentation further reduces the screen real-estate. So it is to be used
+  // sparingly. But we should perhaps add at least a little bit of it to make
+  // the list more readable.
+  wxString curr;
 
-  if (regex != wxEmptyString)
-    matcher.Compile(regex);
-
-  for (unsigned int i = 0; i < m_structure.size(); i++)
+  if ((*m_configuration)->TocShowsSectionNumbers())
   {
-    wxString curr;
-    
-    if ((*m_configuration)->TocShowsSectionNumbers())
+    if(cell->GetPrompt() != NULL)
+      curr = cell->GetPrompt() -> ToString() + wxT(" ");
+    curr.Trim(false);
+  }
+  else
+    switch (cell->GetGroupType())
     {
-      if(m_structure[i]->GetPrompt() != NULL)
-        curr = m_structure[i]->GetPrompt()->ToString() + wxT(" ");
-      curr.Trim(false);
+    case GC_TYPE_TITLE:
+      break;
+    case GC_TYPE_SECTION:
+      curr = wxT("  ");
+      break;
+    case GC_TYPE_SUBSECTION:
+      curr = wxT("    ");
+      break;
+    case GC_TYPE_SUBSUBSECTION:
+      curr = wxT("      ");
+      break;
+    case GC_TYPE_HEADING5:
+      curr = wxT("        ");
+      break;
+    case GC_TYPE_HEADING6:
+      curr = wxT("          ");
+      break;
+    default:
+      break;
     }
-    else
-      switch (dynamic_cast<GroupCell *>(m_structure[i])->GetGroupType())
-      {
-      case GC_TYPE_TITLE:
-        break;
-      case GC_TYPE_SECTION:
-        curr = wxT("  ");
-        break;
-      case GC_TYPE_SUBSECTION:
-        curr = wxT("    ");
-        break;
-      case GC_TYPE_SUBSUBSECTION:
-        curr = wxT("      ");
-        break;
-      case GC_TYPE_HEADING5:
-        curr = wxT("        ");
-        break;
-      case GC_TYPE_HEADING6:
-        curr = wxT("          ");
-        break;
-      default:
-      {}
-    }
-    
-    curr += m_structure[i]->GetEditable()->ToString(true);
 
-    // Respecting linebreaks doesn't make much sense here.
-    curr.Replace(wxT("\n"), wxT(" "));
+  if (cell->GetEditable() != NULL)
+    curr += cell->GetEditable()->ToString(true);
 
-    if (regex.Length() > 0)
-    {
-      if ((matcher.IsValid()) && ((matcher.Matches(curr))))
-        currentIndex++;
-    }
+  // Respecting linebreaks doesn't make much sense here.
+  curr.Replace(wxT("\n"), wxT(" "));
+  return curr;
+}
 
-    else
-      currentIndex++;
+void TableOfContents::UpdateDisplay()
+{
+  wxString regex = m_regex->GetValue();
 
-    if (currentIndex == index)
-    {
-      return m_structure[i];
-    }
+  if (regex != m_compiledRegex)
+  {
+    m_compiledRegex = regex;
+    if (regex != wxEmptyString)
+      m_matcher.Compile(regex);
   }
-  return NULL;
+
+  if ((regex.Length() > 0) && m_matcher.IsValid())
+  {
+    // Only the filter needs the titles of all headings.
+    m_displayed.clear();
+    for (std::vector<GroupCell *>::const_iterator it = m_structure.begin(); it != m_structure.end(); ++it)
+      if (m_matcher.Matches(TocEntry(*it)))
+        m_displayed.push_back(*it);
+  }
+  else
+    m_displayed = m_structure;
+
+  // The list control only asks for the titles of the lines it actually shows.
+  if (m_displayedItems->GetItemCount() != (long) m_displayed.size())
+    m_displayedItems->SetItemCount(m_displayed.size());
+  m_displayedItems->Refresh();
+}
+
+GroupCell *TableOfContents::GetCell(int index)
+{
+  if ((index < 0) || (index >= (long) m_displayed.size()))
+    return NULL;
+  return m_displayed[index];
 }
 
 void TableOfContents::OnRegExEvent(wxCommandEvent& WXUNUSED(ev))
@@ -284,7 +341,7 @@ void TableOfContents::OnMouseRightDown(wxListEvent &event)
   if (event.GetIndex() < 0)
     return;
   std::unique_ptr<wxMenu> popupMenu(new wxMenu());
-  m_cellRightClickedOn = m_structure[event.GetIndex()];
+  m_cellRightClickedOn = GetCell(event.GetIndex());
 
   if (m_cellRightClickedOn != NULL)
   {
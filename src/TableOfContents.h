@@ -28,6 +28,7 @@
 #include "Configuration.h"
 #include <wx/wx.h>
 #include <wx/listctrl.h>
+#include <wx/regex.h>
 #include <vector>
 #include "GroupCell.h"
 #include "EditorCell.h"
@@ -72,12 +73,27 @@ public:
 
   /*! Update the structure information from the tree
 
-    Since this function traverses the tree and we don't want it 
-    to impact the performance too much
-      - we call it only on creation of a cell and on leaving it again
-      - and we only traverse the tree if the pane is actually shown.
+    \param tree The worksheet's first GroupCell
+    \param pos The cell the cursor is in
+    \param rescan false means: The headings themselves haven't changed, only
+    their text or the cursor position might have. In this case the tree isn't
+    traversed.
+
+    We only traverse the tree if the pane is actually shown. Insertions and
+    deletions of cells are tracked by CellsInserted() and CellsDeleted(), so
+    only changes that neither of them sees (folding, loading a file...)
+    require a rescan.
+   */
+  void UpdateTableOfContents(GroupCell *tree, GroupCell *pos, bool rescan = true);
+
+  //! To be called after the cells from first to last have been inserted into the worksheet
+  void CellsInserted(GroupCell *first, GroupCell *last);
+
+  /*! To be called before the cells from first to last are removed from the worksheet
+
+    If last is NULL all cells starting with first are removed.
    */
-  void UpdateTableOfContents(GroupCell *tree, GroupCell *pos);
+  void CellsDeleted(GroupCell *first, GroupCell *last);
 
   //! Get the nth Cell in the table of contents.
   GroupCell *GetCell(int index);
@@ -90,20 +106,53 @@ protected:
   void OnSize(wxSizeEvent &event);
 
 private:
+  /*! The list control that displays the headings
+
+    It is a virtual list control, which means it only asks us for the titles of
+    the headings it currently needs to draw.
+   */
+  class HeadingList : public wxListCtrl
+  {
+  public:
+    HeadingList(TableOfContents *parent, int id);
+  protected:
+    wxString OnGetItemText(long item, long column) const;
+    wxListItemAttr *OnGetItemAttr(long item) const;
+  private:
+    TableOfContents *m_toc;
+    //! The colour of headings whose contents is folded
+    mutable wxListItemAttr m_foldedAttr;
+  };
+
   GroupCell *m_cellRightClickedOn;
   //! The last selected item
   long m_lastSelection;
 
+  //! Is this GroupCell a heading that belongs into the table of contents?
+  static bool IsHeading(GroupCell *cell);
+  //! The text the table of contents displays for a heading
+  wxString TocEntry(GroupCell *cell) const;
   //! Update the displayed contents.
   void UpdateDisplay();
+  //! Select the heading of the section pos is in
+  void SelectCell(GroupCell *pos);
 
-  wxListCtrl *m_displayedItems;
+  HeadingList *m_displayedItems;
   wxTextCtrl *m_regex;
-  //! The items we displayed the last time update() was called
-  wxArrayString m_items_old;
+  //! The regular expression m_matcher has been compiled from
+  wxString m_compiledRegex;
+  wxRegEx m_matcher;
   Configuration **m_configuration;
 
+  //! All headings of the worksheet, in the order they appear in
   std::vector<GroupCell *> m_structure;
+  //! The headings that match the regex, in the order they are displayed in
+  std::vector<GroupCell *> m_displayed;
+  /*! true = m_structure might not contain all headings
+
+    The case if cells were inserted while it wasn't clear where to.
+   */
+  bool m_rescanNeeded;
 };
 
 #endif // TABLEOFCONTENTS_H
@@ -88,7 +88,6 @@ std::list<std::shared_ptr<Cell>> TextCell::GetInnerCells()
 
 void TextCell::SetStyle(TextStyle style)
 {
-  m_widths.clear();
   Cell::SetStyle(style);
   if ((m_text == wxT("gamma")) && (m_textStyle == TS_FUNCTION))
     m_displayedText = wxT("\u0393");
@@ -102,7 +101,6 @@ void TextCell::SetStyle(TextStyle style)
 
 void TextCell::SetType(CellType type)
 {
-  m_widths.clear();
   ResetSize();
   ResetData();
   Cell::SetType(type);
@@ -110,7 +108,6 @@ void TextCell::SetType(CellType type)
 
 void TextCell::SetValue(const wxString &text)
 {
-  m_widths.clear();
   SetToolTip(m_initialToolTip);
   m_displayedDigits_old = (*m_configuration)->GetDisplayedDigits();
   m_text = text;
@@ -123,11 +120,11 @@ void TextCell::SetValue(const wxString &text)
   m_text.Replace(wxT("->"), wxT("\u2192"));
   m_text.Replace(wxT("\u2212>"), wxT("\u2192"));
 
-  m_displayedText = m_text;
+  m_displayedText = InternedString();
   if (m_textStyle == TS_FUNCTION)
   {
     if (m_text == wxT("ilt"))
-      SetToolTip(_("The inverse laplace transform."));
+      SetToolTip(InternedString(_("The inverse laplace transform.")));
     
     if (m_text == wxT("gamma"))
       m_displayedText = wxT("\u0393");
@@ -138,40 +135,40 @@ void TextCell::SetValue(const wxString &text)
   if (m_textStyle == TS_VARIABLE)
   {
     if (m_text == wxT("pnz"))
-      SetToolTip( _("Either positive, negative or zero.\n"
-                    "Normally the result of sign() if the sign cannot be determined."
-                    ));
+      SetToolTip(InternedString(_("Either positive, negative or zero.\n"
+                                  "Normally the result of sign() if the sign cannot be determined."
+                                  )));
 
     if (m_text == wxT("pz"))
-      SetToolTip(_("Either positive or zero.\n"
-                    "A possible result of sign()."
-                   ));
+      SetToolTip(InternedString(_("Either positive or zero.\n"
+                                   "A possible result of sign()."
+                                  )));
   
     if (m_text == wxT("nz"))
-      SetToolTip(_("Either negative or zero.\n"
-                   "A possible result of sign()."
-                   ));
+      SetToolTip(InternedString(_("Either negative or zero.\n"
+                                  "A possible result of sign()."
+                                  )));
 
     if (m_text == wxT("und"))
-      SetToolTip( _("The result was undefined."));
+      SetToolTip(InternedString(_("The result was undefined.")));
 
     if (m_text == wxT("ind"))
-      SetToolTip( _("The result was indefinite."));
+      SetToolTip(InternedString(_("The result was indefinite.")));
 
     if (m_text == wxT("zeroa"))
-      SetToolTip( _("Infinitesimal above zero."));
+      SetToolTip(InternedString(_("Infinitesimal above zero.")));
 
     if (m_text == wxT("zerob"))
-      SetToolTip( _("Infinitesimal below zero."));
+      SetToolTip(InternedString(_("Infinitesimal below zero.")));
 
     if (m_text == wxT("inf"))
-      SetToolTip( wxT("+∞."));
+      SetToolTip(InternedString(wxT("+∞.")));
 
     if (m_text == wxT("infinity"))
-      SetToolTip( _("Complex infinity."));
+      SetToolTip(InternedString(_("Complex infinity.")));
         
     if (m_text == wxT("inf"))
-      SetToolTip( wxT("-∞."));
+      SetToolTip(InternedString(wxT("-∞.")));
 
     if(m_text.StartsWith("%r"))
     {
@@ -189,8 +186,8 @@ void TextCell::SetValue(const wxString &text)
         }
 
       if(isrnum)
-        SetToolTip( _("A variable that can be assigned a number to.\n"
-                      "Often used by solve() and algsys(), if there is an infinite number of results."));
+        SetToolTip(InternedString(_("A variable that can be assigned a number to.\n"
+                                    "Often used by solve() and algsys(), if there is an infinite number of results.")));
     }
 
   
@@ -210,42 +207,39 @@ void TextCell::SetValue(const wxString &text)
         }
       
       if(isinum)
-        SetToolTip( _("An integration constant."));
+        SetToolTip(InternedString(_("An integration constant.")));
     }
   }
   
+  m_longNumber.reset();
   if (m_textStyle == TS_NUMBER)
   {
-    m_numStart = wxEmptyString;
-    m_numEnd = wxEmptyString;
-    m_ellipsis = wxEmptyString;
     unsigned int displayedDigits = (*m_configuration)->GetDisplayedDigits();
-    if (m_displayedText.Length() > displayedDigits)
+    const wxString &displayedText = GetDisplayedText();
+    if (displayedText.Length() > displayedDigits)
     {
       int left = displayedDigits / 3;
       if (left > 30) left = 30;      
-      m_numStart = m_displayedText.Left(left);
-      m_ellipsis = wxString::Format(_("[%i digits]"), (int) m_displayedText.Length() - 2 * left);
-      m_numEnd = m_displayedText.Right(left);
+      m_longNumber = std::unique_ptr<LongNumber>(new LongNumber);
+      m_longNumber->m_numStart = displayedText.Left(left);
+      m_longNumber->m_ellipsis = wxString::Format(_("[%i digits]"), (int) displayedText.Length() - 2 * left);
+      m_longNumber->m_numEnd = displayedText.Right(left);
     }
     else
     {
-      m_numStart = wxEmptyString;
-      m_numEnd = wxEmptyString;
-      m_ellipsis = wxEmptyString;
       if(
-        (m_roundingErrorRegEx1.Matches(m_displayedText)) ||
-        (m_roundingErrorRegEx2.Matches(m_displayedText)) ||
-        (m_roundingErrorRegEx3.Matches(m_displayedText)) ||
-        (m_roundingErrorRegEx4.Matches(m_displayedText))
+        (m_roundingErrorRegEx1.Matches(GetDisplayedText())) ||
+        (m_roundingErrorRegEx2.Matches(GetDisplayedText())) ||
+        (m_roundingErrorRegEx3.Matches(GetDisplayedText())) ||
+        (m_roundingErrorRegEx4.Matches(GetDisplayedText()))
         )
-        SetToolTip( _("As calculating 0.1^12 demonstrates maxima by default doesn't tend to "
-                      "hide what looks like being the small error using floating-point "
-                      "numbers introduces.\n"
-                      "If this seems to be the case here the error can be avoided by using "
-                      "exact numbers like 1/10, 1*10^-1 or rat(.1).\n"
-                      "It also can be hidden by setting fpprintprec to an appropriate value. "
-                      "But be aware in this case that even small errors can add up."));
+        SetToolTip(InternedString(_("As calculating 0.1^12 demonstrates maxima by default doesn't tend to "
+                                    "hide what looks like being the small error using floating-point "
+                                    "numbers introduces.\n"
+                                    "If this seems to be the case here the error can be avoided by using "
+                                    "exact numbers like 1/10, 1*10^-1 or rat(.1).\n"
+                                    "It also can be hidden by setting fpprintprec to an appropriate value. "
+                                    "But be aware in this case that even small errors can add up.")));
     }
   }
   else
@@ -254,88 +248,88 @@ void TextCell::SetValue(const wxString &text)
        (text.Contains(wxT("DOCUMENTATION OF ROUTINE MCSRCH"))) ||
        (text.Contains(wxT("ERROR RETURN OF LINE SEARCH:"))) ||
        text.Contains(wxT("POSSIBLE CAUSES: FUNCTION OR GRADIENT ARE INCORRECT")))
-      SetToolTip( _("This message can appear when trying to numerically find an optimum. "
-                    "In this case it might indicate that a starting point lies in a local "
-                    "optimum that fits the data best if one parameter is increased to "
-                    "infinity or decreased to -infinity. It also can indicate that an "
-                    "attempt was made to fit data to an equation that actually matches "
-                    "the data best if one parameter is set to +/- infinity."));
+      SetToolTip(InternedString(_("This message can appear when trying to numerically find an optimum. "
+                                  "In this case it might indicate that a starting point lies in a local "
+                                  "optimum that fits the data best if one parameter is increased to "
+                                  "infinity or decreased to -infinity. It also can indicate that an "
+                                  "attempt was made to fit data to an equation that actually matches "
+                                  "the data best if one parameter is set to +/- infinity.")));
     if(text.StartsWith(wxT("incorrect syntax")) && (text.Contains(wxT("is not an infix operator"))))
-      SetToolTip( _("A command or number wasn't preceded by a \":\", a \"$\", a \";\" or a \",\".\n"
-                    "Most probable cause: A missing comma between two list items."));
+      SetToolTip(InternedString(_("A command or number wasn't preceded by a \":\", a \"$\", a \";\" or a \",\".\n"
+                                  "Most probable cause: A missing comma between two list items.")));
     if(text.StartsWith(wxT("incorrect syntax")) && (text.Contains(wxT("Found LOGICAL expression where ALGEBRAIC expression expected"))))
-      SetToolTip( _("Most probable cause: A dot instead a comma between two list items containing assignments."));
+      SetToolTip(InternedString(_("Most probable cause: A dot instead a comma between two list items containing assignments.")));
     if(text.StartsWith(wxT("incorrect syntax")) && (text.Contains(wxT("is not a prefix operator"))))
-      SetToolTip( _("Most probable cause: Two commas or similar separators in a row."));
+      SetToolTip(InternedString(_("Most probable cause: Two commas or similar separators in a row.")));
     if(text.Contains(wxT("Illegal use of delimiter")))
-      SetToolTip( _("Most probable cause: an operator was directly followed by a closing parenthesis."));
+      SetToolTip(InternedString(_("Most probable cause: an operator was directly followed by a closing parenthesis.")));
     
     if(text.StartsWith(wxT("part: fell off the end.")))
-      SetToolTip( _("part() or the [] operator was used in order to extract the nth element "
-                    "of something that was less than n elements long."));
+      SetToolTip(InternedString(_("part() or the [] operator was used in order to extract the nth element "
+                                  "of something that was less than n elements long.")));
     if(text.StartsWith(wxT("rest: fell off the end.")))
-      SetToolTip( _("rest() tried to drop more entries from a list than the list was long."));
+      SetToolTip(InternedString(_("rest() tried to drop more entries from a list than the list was long.")));
     if(text.StartsWith(wxT("assignment: cannot assign to")))
-      SetToolTip( _("The value of few special variables is assigned by Maxima and cannot be changed by the user. Also a few constructs aren't variable names and therefore cannot be written to."));
+      SetToolTip(InternedString(_("The value of few special variables is assigned by Maxima and cannot be changed by the user. Also a few constructs aren't variable names and therefore cannot be written to.")));
     if(text.StartsWith(wxT("rat: replaced ")))
-      SetToolTip( _("Normally computers use floating-point numbers that can be handled "
-                    "incredibly fast while being accurate to dozens of digits. "
-                    "They will, though, introduce a small error into some common numbers. "
-                    "For example 0.1 is represented as 3602879701896397/36028797018963968.\n"
-                    "As mathematics is based on the fact that numbers that are exactly "
-                    "equal cancel each other out small errors can quickly add up to big errors "
-                    "(see Wilkinson's Polynomials or Rump's Polynomials). Some maxima "
-                    "commands therefore use rat() in order to automatically convert floats to "
-                    "exact numbers (like 1/10 or sqrt(2)/2) where floating-point errors might "
-                    "add up.\n\n"
-                    "This error message doesn't occur if exact numbers (1/10 instead of 0.1) "
-                    "are used.\n"
-                    "The info that numbers have automatically been converted can be suppressed "
-                    "by setting ratprint to false."));
+      SetToolTip(InternedString(_("Normally computers use floating-point numbers that can be handled "
+                                  "incredibly fast while being accurate to dozens of digits. "
+                                  "They will, though, introduce a small error into some common numbers. "
+                                  "For example 0.1 is represented as 3602879701896397/36028797018963968.\n"
+                                  "As mathematics is based on the fact that numbers that are exactly "
+                                  "equal cancel each other out small errors can quickly add up to big errors "
+                                  "(see Wilkinson's Polynomials or Rump's Polynomials). Some maxima "
+                                  "commands therefore use rat() in order to automatically convert floats to "
+                                  "exact numbers (like 1/10 or sqrt(2)/2) where floating-point errors might "
+                                  "add up.\n\n"
+                                  "This error message doesn't occur if exact numbers (1/10 instead of 0.1) "
+                                  "are used.\n"
+                                  "The info that numbers have automatically been converted can be suppressed "
+                                  "by setting ratprint to false.")));
     if(text.StartsWith("desolve: can't handle this case."))
-      SetToolTip( _("The list of time-dependent variables to solve to doesn't match the time-dependent variables the list of dgls contains."));      
+      SetToolTip(InternedString(_("The list of time-dependent variables to solve to doesn't match the time-dependent variables the list of dgls contains.")));      
     if(text.StartsWith(wxT("expt: undefined: 0 to a negative exponent.")))
-      SetToolTip( _("Division by 0."));
+      SetToolTip(InternedString(_("Division by 0.")));
     if(text.StartsWith(wxT("incorrect syntax: parser: incomplete number; missing exponent?")))
-      SetToolTip( _("Might also indicate a missing multiplication sign (\"*\")."));
+      SetToolTip(InternedString(_("Might also indicate a missing multiplication sign (\"*\").")));
     if(text.Contains(wxT("arithmetic error DIVISION-BY-ZERO signalled")))
-      SetToolTip( _("Besides a division by 0 the reason for this error message can be a "
-                    "calculation that returns +/-infinity."));
+      SetToolTip(InternedString(_("Besides a division by 0 the reason for this error message can be a "
+                                  "calculation that returns +/-infinity.")));
     if(text.Contains(wxT("isn't in the domain of")))
-      SetToolTip( _("Most probable cause: A function was called with a parameter that causes "
-                    "it to return infinity and/or -infinity."));
+      SetToolTip(InternedString(_("Most probable cause: A function was called with a parameter that causes "
+                                  "it to return infinity and/or -infinity.")));
     if(text.StartsWith(wxT("Only symbols can be bound")))
-      SetToolTip( _("This error message is most probably caused by a try to assign "
-                    "a value to a number instead of a variable name.\n"
-                    "One probable cause is using a variable that already has a numeric "
-                    "value as a loop counter."));
+      SetToolTip(InternedString(_("This error message is most probably caused by a try to assign "
+                                  "a value to a number instead of a variable name.\n"
+                                  "One probable cause is using a variable that already has a numeric "
+                                  "value as a loop counter.")));
     if(text.StartsWith(wxT("append: operators of arguments must all be the same.")))
-      SetToolTip( _("Most probably it was attempted to append something to a list "
-                    "that isn't a list.\n"
-                    "Enclosing the new element for the list in brackets ([]) "
-                    "converts it to a list and makes it appendable."));
+      SetToolTip(InternedString(_("Most probably it was attempted to append something to a list "
+                                  "that isn't a list.\n"
+                                  "Enclosing the new element for the list in brackets ([]) "
+                                  "converts it to a list and makes it appendable.")));
     if(text.Contains(wxT(": invalid index")))
-      SetToolTip( _("The [] or the part() command tried to access a list or matrix "
-                    "element that doesn't exist."));
+      SetToolTip(InternedString(_("The [] or the part() command tried to access a list or matrix "
+                                  "element that doesn't exist.")));
     if(text.StartsWith(wxT("apply: subscript must be an integer; found:")))
-      SetToolTip( _("the [] operator tried to extract an element of a list, a matrix, "
-                    "an equation or an array. But instead of an integer number "
-                    "something was used whose numerical value is unknown or not an "
-                    "integer.\n"
-                    "Floating-point numbers are bound to contain small rounding errors "
-                    "and therefore in most cases don't work as an array index that"
-                    "needs to be an exact integer number."));
+      SetToolTip(InternedString(_("the [] operator tried to extract an element of a list, a matrix, "
+                                  "an equation or an array. But instead of an integer number "
+                                  "something was used whose numerical value is unknown or not an "
+                                  "integer.\n"
+                                  "Floating-point numbers are bound to contain small rounding errors "
+                                  "and therefore in most cases don't work as an array index that"
+                                  "needs to be an exact integer number.")));
     if(text.StartsWith(wxT(": improper argument: ")))
     {
       if((m_previous) && (m_previous->ToString() == wxT("at")))
-        SetToolTip( _("The second argument of at() isn't an equation or a list of "
-                      "equations. Most probably it was lacking an \"=\"."));
+        SetToolTip(InternedString(_("The second argument of at() isn't an equation or a list of "
+                                    "equations. Most probably it was lacking an \"=\".")));
       else if((m_previous) && (m_previous->ToString() == wxT("subst")))
-        SetToolTip( _("The first argument of subst() isn't an equation or a list of "
-                      "equations. Most probably it was lacking an \"=\"."));
+        SetToolTip(InternedString(_("The first argument of subst() isn't an equation or a list of "
+                                    "equations. Most probably it was lacking an \"=\".")));
       else
-        SetToolTip( _("The argument of a function was of the wrong type. Most probably "
-                      "an equation was expected but was lacking an \"=\"."));
+        SetToolTip(InternedString(_("The argument of a function was of the wrong type. Most probably "
+                                    "an equation was expected but was lacking an \"=\".")));
     }
   }
   SetAltText();
@@ -344,7 +338,6 @@ void TextCell::SetValue(const wxString &text)
 
 // cppcheck-suppress uninitMemberVar symbolName=TextCell::m_altText
 // cppcheck-suppress uninitMemberVar symbolName=TextCell::m_altJsText
-// cppcheck-suppress uninitMemberVar symbolName=TextCell::m_fontname
 // cppcheck-suppress uninitMemberVar symbolName=TextCell::m_texFontname
 // cppcheck-suppress uninitMemberVar symbolName=TextCell::m_alt
 // cppcheck-suppress uninitMemberVar symbolName=TextCell::m_altJs
@@ -352,10 +345,10 @@ void TextCell::SetValue(const wxString &text)
 TextCell::TextCell(const TextCell &cell):
   Cell(cell.m_group, cell.m_configuration, cell.m_cellPointers),
   m_text(cell.m_text),
-  m_userDefinedLabel(cell.m_userDefinedLabel),
   m_displayedText(cell.m_displayedText)
 {
   CopyCommonData(cell);
+  SetUserDefinedLabel(cell.GetUserDefinedLabel());
   m_forceBreakLine = cell.m_forceBreakLine;
   m_bigSkip = cell.m_bigSkip;
   m_lastZoomFactor = -1;
@@ -371,20 +364,52 @@ TextCell::TextCell(const TextCell &cell):
 
 wxSize TextCell::GetTextSize(wxString const &text)
 {
-  wxDC *dc = (*m_configuration)->GetDC();
-  double fontSize = dc->GetFont().GetPointSize();
+  return (*m_configuration)->GetTextExtent(text);
+}
 
-  SizeHash::const_iterator it = m_widths.find(fontSize);
+void TextCell::SetUserDefinedLabel(wxString userDefinedLabel)
+{
+  if(userDefinedLabel.IsEmpty())
+    m_userDefinedLabel.reset();
+  else
+    m_userDefinedLabel = std::unique_ptr<wxString>(new wxString(userDefinedLabel));
+}
 
-  // If we already know this text piece's size we return the cached value
-  if(it != m_widths.end())
-    return it->second;
+const wxString &TextCell::GetUserDefinedLabel() const
+{
+  static const wxString empty;
+  if(m_userDefinedLabel)
+    return *m_userDefinedLabel;
+  else
+    return empty;
+}
 
-  // Ask wxWidgets to return this text piece's size (slow, but the only way if
-  // there is no cached size).
-  wxSize sz = dc->GetTextExtent(text);
-  m_widths[fontSize] = sz;
-  return sz;
+wxString TextCell::GetToolTip(const wxPoint &point)
+{
+  if(ContainsPoint(point))
+  {
+    // Computed on demand: Interning these would fill the tooltip pool with
+    // strings that are only ever used by a single cell.
+    if(m_textStyle == TS_USERLABEL)
+      return m_text;
+    if((m_textStyle == TS_LABEL) && (!GetUserDefinedLabel().IsEmpty()))
+      return GetUserDefinedLabel();
+  }
+  return Cell::GetToolTip(point);
+}
+
+size_t TextCell::GetMemoryUsage() const
+{
+  size_t bytes = sizeof(*this) + (m_text.Length() + 1) * sizeof(wxChar);
+  if(m_userDefinedLabel)
+    bytes += sizeof(wxString) + (m_userDefinedLabel->Length() + 1) * sizeof(wxChar);
+  if(m_altCopyText)
+    bytes += sizeof(wxString) + (m_altCopyText->Length() + 1) * sizeof(wxChar);
+  if(m_longNumber)
+    bytes += sizeof(LongNumber) +
+      (m_longNumber->m_numStart.Length() + m_longNumber->m_ellipsis.Length() +
+       m_longNumber->m_numEnd.Length() + 3) * sizeof(wxChar);
+  return bytes;
 }
 
 bool TextCell::NeedsRecalculation(int fontSize)
@@ -397,7 +422,7 @@ bool TextCell::NeedsRecalculation(int fontSize)
     (
       (m_textStyle == TS_LABEL) &&
       ((*m_configuration)->UseUserLabels()) &&
-    (m_userDefinedLabel != wxEmptyString)
+    (!GetUserDefinedLabel().IsEmpty())
       ) ||
     (
       (m_textStyle == TS_NUMBER) &&
@@ -427,7 +452,7 @@ void TextCell::RecalculateWidths(int fontsize)
     if(
       (m_textStyle == TS_LABEL) &&
       (configuration->UseUserLabels()) &&
-      (m_userDefinedLabel != wxEmptyString)
+      (!GetUserDefinedLabel().IsEmpty())
       )
       m_textStyle = TS_USERLABEL;
         
@@ -437,56 +462,20 @@ void TextCell::RecalculateWidths(int fontsize)
       (m_textStyle == TS_NUMBER) &&
       (m_displayedDigits_old != (*m_configuration)->GetDisplayedDigits())
         )
-    {
       SetValue(m_text);
-      m_numstartWidths.clear();
-      m_ellipsisWidths.clear();
-      m_numEndWidths.clear();
-    }
     
     m_lastCalculationFontSize = fontsize;
 
-    if(m_numStart != wxEmptyString)
+    if(m_longNumber)
     {      
-      double fontSize = dc->GetFont().GetPointSize();
-      {
-        SizeHash::const_iterator it = m_numstartWidths.find(fontSize);    
-        if(it != m_numstartWidths.end())
-          m_numStartWidth = it->second;
-        else
-        {
-          wxSize sz = dc->GetTextExtent(m_numStart);
-          m_numstartWidths[fontSize] = sz;
-          m_numStartWidth = sz;
-        }
-      }
-      {
-        SizeHash::const_iterator it = m_numEndWidths.find(fontSize);    
-        if(it != m_numEndWidths.end())
-          m_numEndWidth = it->second;
-        else
-        {
-          wxSize sz = dc->GetTextExtent(m_numEnd);
-          m_numEndWidths[fontSize] = sz;
-          m_numEndWidth = sz;
-        }
-      }
-      {
-        SizeHash::const_iterator it = m_ellipsisWidths.find(fontSize);    
-        if(it != m_ellipsisWidths.end())
-          m_ellipsisWidth = it->second;
-        else
-        {
-          wxSize sz = dc->GetTextExtent(m_ellipsis);
-          m_ellipsisWidths[fontSize] = sz;
-          m_ellipsisWidth = sz;
-        }
-      }
-      m_width = m_numStartWidth.GetWidth() + m_numEndWidth.GetWidth() +
-        m_ellipsisWidth.GetWidth();
+      m_longNumber->m_numStartWidth = GetTextSize(m_longNumber->m_numStart);
+      m_longNumber->m_numEndWidth = GetTextSize(m_longNumber->m_numEnd);
+      m_longNumber->m_ellipsisWidth = GetTextSize(m_longNumber->m_ellipsis);
+      m_width = m_longNumber->m_numStartWidth.GetWidth() + m_longNumber->m_numEndWidth.GetWidth() +
+        m_longNumber->m_ellipsisWidth.GetWidth();
       m_height = wxMax(
-        wxMax(m_numStartWidth.GetHeight(), m_numEndWidth.GetHeight()),
-        m_ellipsisWidth.GetHeight());
+        wxMax(m_longNumber->m_numStartWidth.GetHeight(), m_longNumber->m_numEndWidth.GetHeight()),
+        m_longNumber->m_ellipsisWidth.GetHeight());
     }
     else
     {    
@@ -500,7 +489,7 @@ void TextCell::RecalculateWidths(int fontsize)
 
         if(m_textStyle == TS_USERLABEL)
         {
-          text = wxT("(") + m_userDefinedLabel + wxT(")");
+          text = wxT("(") + GetUserDefinedLabel() + wxT(")");
           m_unescapeRegEx.ReplaceAll(&text,wxT("\\1"));
         }
 
@@ -520,7 +509,7 @@ void TextCell::RecalculateWidths(int fontsize)
         // We will decrease it before use
         m_fontSizeLabel = m_fontSize + 1;
         wxSize labelSize = GetTextSize(text);
-        wxASSERT_MSG((labelSize.GetWidth() > 0) || (m_displayedText == wxEmptyString),
+        wxASSERT_MSG((labelSize.GetWidth() > 0) || (GetDisplayedText().IsEmpty()),
                      _("Seems like something is broken with the maths font. Installing http://www.math.union.edu/~dpvc/jsmath/download/jsMath-fonts.html and checking \"Use JSmath fonts\" in the configuration dialogue should fix it."));
         font = dc->GetFont();
 #if wxCHECK_VERSION(3, 1, 2)
@@ -551,7 +540,7 @@ void TextCell::RecalculateWidths(int fontsize)
         wxSize sz = GetTextSize(m_altJsText);
         m_width = sz.GetWidth();
         m_height = sz.GetHeight();
-        if (m_texFontname == wxT("jsMath-cmsy10"))
+        if (m_texFontname.str() == wxT("jsMath-cmsy10"))
           m_height = m_height / 2;
       }
 
@@ -565,7 +554,7 @@ void TextCell::RecalculateWidths(int fontsize)
       /// This is the default.
       else
       {
-        wxSize sz = GetTextSize(m_displayedText);
+        wxSize sz = GetTextSize(GetDisplayedText());
         m_width = sz.GetWidth();
         m_height = sz.GetHeight();
       }
@@ -612,8 +601,7 @@ void TextCell::Draw(wxPoint point)
           // Draw the label
           if(m_textStyle == TS_USERLABEL)
           {
-            wxString text = m_userDefinedLabel;
-            SetToolTip(m_text);
+            wxString text = GetUserDefinedLabel();
             m_unescapeRegEx.ReplaceAll(&text,wxT("\\1"));
             dc->DrawText(wxT("(") + text + wxT(")"),
                          point.x + MC_TEXT_PADDING,
@@ -621,21 +609,20 @@ void TextCell::Draw(wxPoint point)
           }
           else
           {
-            SetToolTip(m_userDefinedLabel);
-            dc->DrawText(m_displayedText,
+            dc->DrawText(GetDisplayedText(),
                          point.x + MC_TEXT_PADDING,
                          point.y - m_realCenter + MC_TEXT_PADDING);
           }
         }
       }
-      else if (!m_numStart.IsEmpty())
+      else if (m_longNumber)
       {
-        dc->DrawText(m_numStart,
+        dc->DrawText(m_longNumber->m_numStart,
                      point.x + MC_TEXT_PADDING,
                      point.y - m_realCenter + MC_TEXT_PADDING);
-        dc->DrawText(m_numEnd,
-                     point.x + MC_TEXT_PADDING + m_numStartWidth.GetWidth() +
-                     m_ellipsisWidth.GetWidth(),
+        dc->DrawText(m_longNumber->m_numEnd,
+                     point.x + MC_TEXT_PADDING + m_longNumber->m_numStartWidth.GetWidth() +
+                     m_longNumber->m_ellipsisWidth.GetWidth(),
                      point.y - m_realCenter + MC_TEXT_PADDING);
         wxColor textColor = dc->GetTextForeground();
         wxColor backgroundColor = dc->GetTextBackground();
@@ -646,8 +633,8 @@ void TextCell::Draw(wxPoint point)
             (textColor.Blue() + backgroundColor.Blue()) / 2
             )
           );
-        dc->DrawText(m_ellipsis,
-                     point.x + MC_TEXT_PADDING + m_numStartWidth.GetWidth(),
+        dc->DrawText(m_longNumber->m_ellipsis,
+                     point.x + MC_TEXT_PADDING + m_longNumber->m_numStartWidth.GetWidth(),
                      point.y - m_realCenter + MC_TEXT_PADDING);
       }
         /// Check if we are using jsMath and have jsMath character
@@ -663,12 +650,12 @@ void TextCell::Draw(wxPoint point)
                     point.y - m_realCenter + MC_TEXT_PADDING);
 
         /// Change asterisk
-      else if (configuration->GetChangeAsterisk() && m_displayedText == wxT("*"))
+      else if (configuration->GetChangeAsterisk() && GetDisplayedText() == wxT("*"))
         dc->DrawText(wxT("\u00B7"),
                     point.x + MC_TEXT_PADDING,
                     point.y - m_realCenter + MC_TEXT_PADDING);
 
-      else if (m_displayedText == wxT("#"))
+      else if (GetDisplayedText() == wxT("#"))
         dc->DrawText(wxT("\u2260"),
                     point.x + MC_TEXT_PADDING,
                     point.y - m_realCenter + MC_TEXT_PADDING);
@@ -679,7 +666,7 @@ void TextCell::Draw(wxPoint point)
         {
           case MC_TYPE_TEXT:
             // TODO: Add markdown formatting for bold, italic and underlined here.
-            dc->DrawText(m_displayedText,
+            dc->DrawText(GetDisplayedText(),
                         point.x + MC_TEXT_PADDING,
                         point.y - m_realCenter + MC_TEXT_PADDING);
             break;
@@ -687,7 +674,7 @@ void TextCell::Draw(wxPoint point)
             // This cell has already been drawn as an EditorCell => we don't repeat this action here.
             break;
           default:
-            dc->DrawText(m_displayedText,
+            dc->DrawText(GetDisplayedText(),
                         point.x + MC_TEXT_PADDING,
                         point.y - m_realCenter + MC_TEXT_PADDING);
         }
@@ -797,13 +784,13 @@ bool TextCell::IsOperator() const
 wxString TextCell::ToString()
 {
   wxString text;
-  if (m_altCopyText != wxEmptyString)
-    text = m_altCopyText;
+  if (!GetAltCopyText().IsEmpty())
+    text = GetAltCopyText();
   else
   {
     text = m_text;
-    if(((*m_configuration)->UseUserLabels())&&(m_userDefinedLabel != wxEmptyString))
-      text = wxT("(") + m_userDefinedLabel + wxT(")");
+    if(((*m_configuration)->UseUserLabels())&&(!GetUserDefinedLabel().IsEmpty()))
+      text = wxT("(") + GetUserDefinedLabel() + wxT(")");
     text.Replace(wxT("\u2212"), wxT("-")); // unicode minus sign
     text.Replace(wxT("\u2794"), wxT("-->"));
     text.Replace(wxT("\u2192"), wxT("->"));
@@ -873,13 +860,13 @@ wxString TextCell::ToString()
 wxString TextCell::ToMatlab()
 {
 	wxString text;
-	if (m_altCopyText != wxEmptyString)
-	  text = m_altCopyText;
+	if (!GetAltCopyText().IsEmpty())
+	  text = GetAltCopyText();
 	else
 	{
 	  text = m_text;
-	  if(((*m_configuration)->UseUserLabels())&&(m_userDefinedLabel != wxEmptyString))
-		text = wxT("(") + m_userDefinedLabel + wxT(")");
+	  if(((*m_configuration)->UseUserLabels())&&(!GetUserDefinedLabel().IsEmpty()))
+		text = wxT("(") + GetUserDefinedLabel() + wxT(")");
 	  text.Replace(wxT("\u2212"), wxT("-")); // unicode minus sign
 	  text.Replace(wxT("\u2794"), wxT("-->"));
 	  text.Replace(wxT("\u2192"), wxT("->"));
@@ -952,10 +939,10 @@ wxString TextCell::ToMatlab()
 
 wxString TextCell::ToTeX()
 {
-  wxString text = m_displayedText;
+  wxString text = GetDisplayedText();
 
-  if(((*m_configuration)->UseUserLabels())&&(m_userDefinedLabel != wxEmptyString))
-    text = wxT("(") + m_userDefinedLabel + wxT(")");
+  if(((*m_configuration)->UseUserLabels())&&(!GetUserDefinedLabel().IsEmpty()))
+    text = wxT("(") + GetUserDefinedLabel() + wxT(")");
 
   if (!(*m_configuration)->CheckKeepPercent())
   {
@@ -1311,7 +1298,7 @@ wxString TextCell::ToTeX()
     }
     else if (GetStyle() == TS_VARIABLE)
     {
-      if ((m_displayedText.Length() > 1) && (text[1] != wxT('_')))
+      if ((GetDisplayedText().Length() > 1) && (text[1] != wxT('_')))
         text = wxT("\\mathit{") + text + wxT("}");
       if (text == wxT("\\% pi"))
         text = wxT("\\ensuremath{\\pi} ");
@@ -1364,12 +1351,12 @@ wxString TextCell::ToTeX()
 
 wxString TextCell::ToMathML()
 {
-  if(m_displayedText == wxEmptyString)
+  if(GetDisplayedText().IsEmpty())
     return wxEmptyString;
-  wxString text = XMLescape(m_displayedText);
+  wxString text = XMLescape(GetDisplayedText());
 
-  if(((*m_configuration)->UseUserLabels())&&(m_userDefinedLabel != wxEmptyString))
-    text = XMLescape(wxT("(") + m_userDefinedLabel + wxT(")"));
+  if(((*m_configuration)->UseUserLabels())&&(!GetUserDefinedLabel().IsEmpty()))
+    text = XMLescape(wxT("(") + GetUserDefinedLabel() + wxT(")"));
 
   // If we didn't display a multiplication dot we want to do the same in MathML.
   if (m_isHidden || (((*m_configuration)->HidemultiplicationSign()) && m_isHidableMultSign))
@@ -1455,7 +1442,7 @@ wxString TextCell::ToOMML()
   if ((GetStyle() == TS_LABEL) || (GetStyle() == TS_USERLABEL))
     return wxEmptyString;
 
-  wxString text = XMLescape(m_displayedText);
+  wxString text = XMLescape(GetDisplayedText());
 
   // If we didn't display a multiplication dot we want to do the same in MathML.
   if (m_isHidden || (((*m_configuration)->HidemultiplicationSign()) && m_isHidableMultSign))
@@ -1519,13 +1506,13 @@ wxString TextCell::ToOMML()
 wxString TextCell::ToRTF()
 {
   wxString retval;
-  wxString text = m_displayedText;
+  wxString text = GetDisplayedText();
 
-  if (m_displayedText == wxEmptyString)
+  if (GetDisplayedText().IsEmpty())
     return(wxT(" "));
   
-  if(((*m_configuration)->UseUserLabels())&&(m_userDefinedLabel != wxEmptyString))
-    text = wxT("(") + m_userDefinedLabel + wxT(")");
+  if(((*m_configuration)->UseUserLabels())&&(!GetUserDefinedLabel().IsEmpty()))
+    text = wxT("(") + GetUserDefinedLabel() + wxT(")");
   
   text.Replace(wxT("-->"), wxT("\u2192"));
   // Needed for the output of let(a/b,a+1);
@@ -1586,16 +1573,16 @@ wxString TextCell::ToXML()
   if (GetStyle() == TS_WARNING)
     flags += wxT(" type=\"warning\"");
   
-  wxString xmlstring = XMLescape(m_displayedText);
+  wxString xmlstring = XMLescape(GetDisplayedText());
   // convert it, so that the XML configuration doesn't fail
-  if(m_userDefinedLabel != wxEmptyString)
-    flags += wxT(" userdefinedlabel=\"") + XMLescape(m_userDefinedLabel) + wxT("\"");
+  if(!GetUserDefinedLabel().IsEmpty())
+    flags += wxT(" userdefinedlabel=\"") + XMLescape(GetUserDefinedLabel()) + wxT("\"");
 
-  if(m_altCopyText != wxEmptyString)
-    flags += wxT(" altCopy=\"") + XMLescape(m_altCopyText) + wxT("\"");
+  if(!GetAltCopyText().IsEmpty())
+    flags += wxT(" altCopy=\"") + XMLescape(GetAltCopyText()) + wxT("\"");
 
-  if(m_toolTip != wxEmptyString)
-    flags += wxT(" tooltip=\"") + XMLescape(m_toolTip) + wxT("\"");
+  if(!GetLocalToolTip().IsEmpty())
+    flags += wxT(" tooltip=\"") + XMLescape(GetLocalToolTip()) + wxT("\"");
 
   return wxT("<") + tag + flags + wxT(">") + xmlstring + wxT("</") + tag + wxT(">");
 }
@@ -1634,7 +1621,7 @@ void TextCell::SetAltText()
   else
   {
     m_altJsText = GetSymbolTeX();
-    if (m_altJsText != wxEmptyString)
+    if (!m_altJsText.IsEmpty())
     {
       if (m_text == wxT("+") || m_text == wxT("="))
         m_texFontname = CMR10;
@@ -53,7 +53,7 @@ public:
   void SetValue(const wxString &text) override;
 
   //! Set the automatic label maxima has assigned the current equation
-  void SetUserDefinedLabel(wxString userDefinedLabel){m_userDefinedLabel = userDefinedLabel;}
+  void SetUserDefinedLabel(wxString userDefinedLabel);
 
   void RecalculateWidths(int fontsize) override;
 
@@ -101,6 +101,11 @@ public:
 
   virtual void SetType(CellType type) override;
 
+  size_t GetMemoryUsage() const override;
+
+  //! Labels show the other one of (automatic label, user label) as their tooltip
+  wxString GetToolTip(const wxPoint &point) override;
+
 protected:
   wxSize GetTextSize(wxString const &text);
   void SetAltText();
@@ -109,7 +114,6 @@ protected:
     {
       ResetSize();
       ResetData();
-      m_widths.clear();
     }
 
   //! Resets the font size to label size
@@ -124,12 +128,20 @@ protected:
 
   //! The text we keep inside this cell
   wxString m_text;
-  //! The text we keep inside this cell
-  wxString m_userDefinedLabel;
-  //! The text we display: m_text might be a number that is longer than we want to display
-  wxString m_displayedText;
-  wxString m_altText, m_altJsText;
-  wxString m_fontname, m_texFontname;
+  //! The label the user has assigned this cell, if this cell is a label. Rarely used.
+  std::unique_ptr<wxString> m_userDefinedLabel;
+  //! The label the user has assigned this cell or wxEmptyString
+  const wxString &GetUserDefinedLabel() const;
+  /*! The text we display, if it differs from m_text
+
+    If this is empty m_text is displayed: Only few cells need a different text.
+   */
+  InternedString m_displayedText;
+  //! The text we display
+  const wxString &GetDisplayedText() const
+    { return m_displayedText.IsEmpty() ? m_text : m_displayedText.str(); }
+  InternedString m_altText, m_altJsText;
+  InternedString m_texFontname;
 
   int m_realCenter;
   /*! The font size we had the last time we were recalculating this cell
@@ -142,46 +154,27 @@ protected:
   //! The actual font size for labels (that have a fixed width)
   double m_fontSizeLabel;
 private:
-  class SizeHash_internals
-  {
-  public:
-    SizeHash_internals() { }
-    unsigned long operator()( const double& k ) const
-      {
-        return k * 1000000;
-      }
-    SizeHash_internals& operator=(const SizeHash_internals&) { return *this; }
-  };
-  // comparison operator
-  class DoubleEqual
+  /*! A number that is too long to be displayed completely
+
+    Only few numbers are that long => this data is only allocated if needed.
+   */
+  struct LongNumber
   {
-  public:
-    DoubleEqual() { }
-    bool operator()( const double& a, const double& b ) const
-      {
-        return fabs(a-b) < .001;
-      }
-    DoubleEqual& operator=(const DoubleEqual&) { return *this; }
+    //! The first few digits
+    wxString m_numStart;
+    wxSize m_numStartWidth;
+    //! The "not all digits displayed" message.
+    wxString m_ellipsis;
+    wxSize m_ellipsisWidth;
+    //! The last few digits
+    wxString m_numEnd;
+    wxSize m_numEndWidth;
   };
-  WX_DECLARE_HASH_MAP(
-    double, wxSize, SizeHash_internals, DoubleEqual, SizeHash);
-  //! Remembers all widths of the full text we already have configured
-  SizeHash m_widths;
-  //! The size of the first few digits
-  SizeHash m_numstartWidths;
-  wxSize m_numStartWidth;
-  wxString m_numStart;
-  //! The size of the "not all digits displayed" message.
-  SizeHash m_ellipsisWidths;
-  wxString m_ellipsis;
-  wxSize m_ellipsisWidth;
-  //! The size of the last few digits
-  SizeHash m_numEndWidths;
-  wxString m_numEnd;
-  wxSize m_numEndWidth;
+  //! The parts of the number we display, if this cell contains a long number.
+  std::unique_ptr<LongNumber> m_longNumber;
 
   //! Produces a text sample that determines the label width
-  wxString m_initialToolTip;
+  InternedString m_initialToolTip;
   //! The number of digits we did display the last time we displayed a number.
   int m_displayedDigits_old;
 };
@@ -29,7 +29,6 @@
 
 
 #include <wx/sizer.h>
-#include <wx/tokenzr.h>
 #include <wx/regex.h>
 #include <wx/mstream.h>
 #include <wx/wfstream.h>
@@ -37,7 +36,9 @@
 #include <wx/txtstrm.h>
 #include <wx/wupdlock.h>
 #include "../data/UnicodeData.h"
+#include <algorithm>
 #include <memory>
+#include <string>
 
 #include "ErrorRedirector.h"
 #include "UnicodeSidebar.h"
@@ -55,8 +56,12 @@ UnicodeSidebar::UnicodeSidebar(wxWindow *parent, wxWindow *worksheet) :
   m_regex->SetToolTip(_("Please enter a regex here that searches for the required unicode character"));
   m_regex->Connect(wxEVT_TEXT, wxCommandEventHandler(UnicodeSidebar::OnRegExEvent), NULL, this);
   m_grid = new wxGrid(this, wxID_ANY);
-  m_grid->CreateGrid(0,3);
+  m_table = new CharTable();
+  m_grid->SetTable(m_table, true);
   m_grid->BeginBatch();
+  m_grid->HideRowLabels();
+  m_grid->HideColLabels();
+  m_grid->EnableEditing(false);
   box->Add(m_regex, wxSizerFlags().Expand().Proportion(10));
   box->Add(m_grid, wxSizerFlags().Expand().Proportion(100));
   Connect(wxEVT_PAINT, wxPaintEventHandler(UnicodeSidebar::OnPaint), NULL, this);
@@ -75,10 +80,8 @@ UnicodeSidebar::~UnicodeSidebar()
 
 void UnicodeSidebar::OnDClick(wxGridEvent &event)
 {
-  wxString number;
-  number = m_grid->GetCellValue(event.GetRow() ,0);
-  long numVal;
-  if(number.ToLong(&numVal, 16))
+  long numVal = m_table->GetCode(event.GetRow());
+  if(numVal >= 0)
   {
     wxCommandEvent *ev = new wxCommandEvent(SIDEBARKEYEVENT, numVal);
     m_worksheet->GetEventHandler()->QueueEvent(ev);
@@ -88,9 +91,8 @@ void UnicodeSidebar::OnDClick(wxGridEvent &event)
 
 void UnicodeSidebar::OnRightClick(wxGridEvent &event)
 {
-  wxString number;
-  number = m_grid->GetCellValue(event.GetRow() ,0);
-  if(number.ToLong(&m_charRightClickedOn, 16))
+  m_charRightClickedOn = m_table->GetCode(event.GetRow());
+  if(m_charRightClickedOn >= 0)
   {
     std::unique_ptr<wxMenu> popupMenu(new wxMenu());
     popupMenu->Append(popid_addToSymbols, _("Add to symbols Sidebar"));
@@ -122,19 +124,8 @@ void UnicodeSidebar::OnChangeAttempt(wxGridEvent &event)
 
 void UnicodeSidebar::UpdateDisplay()
 {
-  wxWindowUpdateLocker noUpdates(m_grid);
-  wxGridUpdateLocker speedUp(m_grid);
-  int rows = m_grid->GetNumberRows() - 1;
-  wxRegEx regex;
-  regex.Compile(m_regex->GetValue().Lower());
-  for(int i = 0; i<rows; i++)
-  {
-    wxString name = m_grid->GetCellValue(i,2).Lower();
-    if((!regex.IsValid()) || regex.Matches(name))
-      m_grid->ShowRow(i);
-    else
-      m_grid->HideRow(i);
-  }
+  if(m_initialized)
+    m_table->SetFilter(m_regex->GetValue());
 }
 
 void UnicodeSidebar::OnSize(wxSizeEvent &event)
@@ -153,39 +144,152 @@ void UnicodeSidebar::OnPaint(wxPaintEvent &event)
   if(m_initialized)
     return;
 
+  m_initialized = true;
+  m_table->Load();
+  UpdateDisplay();
+}
+
+void UnicodeSidebar::OnRegExEvent(wxCommandEvent &WXUNUSED(ev))
+{
+  UpdateDisplay();
+}
+
+void UnicodeSidebar::CharTable::Load()
+{
   wxMemoryInputStream istream(UnicodeData_txt_gz, UnicodeData_txt_gz_len);
   wxZlibInputStream zstream(istream);
-  wxTextInputStream textIn(zstream);
-  wxString regex_string = m_regex->GetValue();
-  wxRegEx regex(m_regex->GetValue());
-  m_grid->HideRowLabels();
-  m_grid->HideColLabels();
-  while(!zstream.Eof())
+  wxMemoryOutputStream ostream;
+  zstream.Read(ostream);
+  const char *pos = static_cast<const char *>(ostream.GetOutputStreamBuffer()->GetBufferStart());
+  const char *end = pos + ostream.GetSize();
+
+  // Each line looks like "03B1;GREEK SMALL LETTER ALPHA"
+  m_codes.clear();
+  m_nameStarts.clear();
+  m_names.clear();
+  m_names.reserve(ostream.GetSize());
+  while(pos < end)
   {
-    wxString line = textIn.ReadLine();
-    wxStringTokenizer items(line, wxT(";"), wxTOKEN_RET_EMPTY_ALL);
-    wxString number = items.GetNextToken();
-    wxString name   = items.GetNextToken();
-    if(!name.IsEmpty() && (name != "<control>")&& (!name.StartsWith("<Plane")) &&
-       (regex_string.IsEmpty())
-      )
+    const char *lineEnd = std::find(pos, end, '\n');
+    const char *separator = std::find(pos, lineEnd, ';');
+    const char *name = separator + 1;
+    const char *nameEnd = std::find(std::min(name, lineEnd), lineEnd, ';');
+    if((nameEnd > name) && (*(nameEnd - 1) == '\r'))
+      nameEnd--;
+
+    wxUint32 code = 0;
+    bool valid = (separator > pos) && (separator < lineEnd) && (nameEnd > name);
+    if(valid)
     {
-      long numVal;
-      if(number.ToLong(&numVal, 16))
-      {
-        m_grid->AppendRows();
-        int row = m_grid->GetNumberRows() - 1;
-        m_grid->SetCellValue(row,0,number);
-        m_grid->SetCellValue(row,1,wxString(wxChar(numVal)));
-        m_grid->SetCellValue(row,2,name);
-        m_grid->EnableEditing(false);
-      }
+      std::string nameString(name, nameEnd);
+      valid = (nameString != "<control>") && (nameString.compare(0, 6, "<Plane") != 0);
     }
-  }  
-  m_initialized = true;
+    for(const char *digit = pos; valid && (digit < separator); digit++)
+    {
+      code <<= 4;
+      if((*digit >= '0') && (*digit <= '9'))
+        code += *digit - '0';
+      else if((*digit >= 'A') && (*digit <= 'F'))
+        code += *digit - 'A' + 10;
+      else if((*digit >= 'a') && (*digit <= 'f'))
+        code += *digit - 'a' + 10;
+      else
+        valid = false;
+    }
+    if(valid)
+    {
+      m_codes.push_back(code);
+      m_nameStarts.push_back(m_names.size());
+      m_names.insert(m_names.end(), name, nameEnd);
+      m_names.push_back('\0');
+    }
+    pos = lineEnd + 1;
+  }
+  std::vector<wxUint32> matches(m_codes.size());
+  for(size_t i = 0; i < matches.size(); i++)
+    matches[i] = i;
+  SetMatches(matches);
 }
 
-void UnicodeSidebar::OnRegExEvent(wxCommandEvent &WXUNUSED(ev))
+wxString UnicodeSidebar::CharTable::GetValue(int row, int col)
 {
-  UpdateDisplay();
+  if((row < 0) || (row >= (int) m_matches.size()))
+    return wxEmptyString;
+  wxUint32 index = m_matches[row];
+  switch(col)
+  {
+  case 0:
+    return wxString::Format(wxT("%04X"), m_codes[index]);
+  case 1:
+    return wxString(wxUniChar(m_codes[index]));
+  default:
+    return wxString::FromUTF8(&m_names[m_nameStarts[index]]);
+  }
+}
+
+long UnicodeSidebar::CharTable::GetCode(int row) const
+{
+  if((row < 0) || (row >= (int) m_matches.size()))
+    return -1;
+  return m_codes[m_matches[row]];
+}
+
+void UnicodeSidebar::CharTable::SetFilter(wxString filter)
+{
+  std::vector<wxUint32> matches;
+  matches.reserve(m_codes.size());
+  if(filter.IsEmpty())
+  {
+    for(size_t i = 0; i < m_codes.size(); i++)
+      matches.push_back(i);
+  }
+  else if(filter.find_first_of(wxT(".^$*+?()[]{}|\\")) == wxString::npos)
+  {
+    // The names are upper-case and separated by '\0's, so one search through
+    // all names finds all matches.
+    std::string needle(filter.Upper().utf8_str());
+    const char *names = m_names.data();
+    const char *end = names + m_names.size();
+    const char *pos = names;
+    while((pos = std::search(pos, end, needle.begin(), needle.end())) != end)
+    {
+      std::vector<wxUint32>::const_iterator start =
+        std::upper_bound(m_nameStarts.begin(), m_nameStarts.end(), (wxUint32) (pos - names)) - 1;
+      matches.push_back(start - m_nameStarts.begin());
+      // Continue with the next name
+      pos = std::find(pos, end, '\0');
+    }
+  }
+  else
+  {
+    wxRegEx regex;
+    regex.Compile(filter.Lower());
+    for(size_t i = 0; i < m_codes.size(); i++)
+    {
+      if((!regex.IsValid()) ||
+         regex.Matches(wxString::FromUTF8(&m_names[m_nameStarts[i]]).Lower()))
+        matches.push_back(i);
+    }
+  }
+  SetMatches(matches);
+}
+
+void UnicodeSidebar::CharTable::SetMatches(std::vector<wxUint32> &matches)
+{
+  int oldRows = m_matches.size();
+  m_matches.swap(matches);
+  wxGrid *grid = GetView();
+  if(grid == NULL)
+    return;
+  wxGridUpdateLocker speedUp(grid);
+  if(oldRows > 0)
+  {
+    wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_DELETED, 0, oldRows);
+    grid->ProcessTableMessage(msg);
+  }
+  if(!m_matches.empty())
+  {
+    wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_APPENDED, m_matches.size());
+    grid->ProcessTableMessage(msg);
+  }
 }
@@ -27,6 +27,7 @@
  */
 #include <wx/wx.h>
 #include <wx/grid.h>
+#include <vector>
 
 #ifndef UNICODESIDEBAR_H
 #define UNICODESIDEBAR_H
@@ -56,6 +57,46 @@ public:
   //! Update the display after the regex has changed
   void UpdateDisplay();
 
+  /*! The characters the sidebar offers, as seen by the grid that displays them
+
+    All names are kept in one buffer instead of thousands of wxStrings, and
+    the grid only asks for the rows that are visible, so opening the sidebar
+    doesn't make it create tens of thousands of grid cells.
+   */
+  class CharTable : public wxGridTableBase
+  {
+  public:
+    CharTable(){}
+    int GetNumberRows() override {return m_matches.size();}
+    int GetNumberCols() override {return 3;}
+    wxString GetValue(int row, int col) override;
+    void SetValue(int WXUNUSED(row), int WXUNUSED(col), const wxString &WXUNUSED(value)) override {}
+    bool IsEmptyCell(int WXUNUSED(row), int WXUNUSED(col)) override {return false;}
+    //! The code point of the character displayed in the row
+    long GetCode(int row) const;
+    /*! Show only the characters whose names match filter
+
+      filter is interpreted as a regular expression, if it contains any
+      characters that have a special meaning in regular expressions. Else the
+      names are simply searched for it, which is much faster.
+     */
+    void SetFilter(wxString filter);
+    //! Read the list of characters that is compiled into the program
+    void Load();
+
+  private:
+    //! Display the characters with the indices in matches and tell the grid about it
+    void SetMatches(std::vector<wxUint32> &matches);
+    //! The code point of each character
+    std::vector<wxUint32> m_codes;
+    //! Where each character's name starts in m_names
+    std::vector<wxUint32> m_nameStarts;
+    //! The upper-case names of all characters, each followed by a '\0'
+    std::vector<char> m_names;
+    //! The indices of the characters that match the current filter
+    std::vector<wxUint32> m_matches;
+  };
+
 protected:
   //! Is called if a menu item is selected
   void OnMenu(wxCommandEvent &event);
@@ -75,6 +116,8 @@ private:
   long m_charRightClickedOn;
   wxWindow *m_worksheet;
   wxGrid *m_grid;
+  //! The grid's data. Owned by the grid.
+  CharTable *m_table;
   wxTextCtrl *m_regex;
 };
 
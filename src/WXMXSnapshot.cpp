@@ -0,0 +1,243 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+
+
+/*! \file
+
+  This file defines the class WXMXSnapshot that writes a .wxmx file from a snapshot of the worksheet.
+ */
+
+#include "WXMXSnapshot.h"
+#include "ErrorRedirector.h"
+#include "Version.h"
+#include <wx/filesys.h>
+#include <wx/mstream.h>
+#include <wx/regex.h>
+#include <wx/txtstrm.h>
+#include <wx/uri.h>
+#include <wx/wfstream.h>
+#include <wx/xml/xml.h>
+#include <wx/zipstrm.h>
+
+bool WXMXSnapshot::ContentIsValidXML() const
+{
+  wxXmlDocument doc;
+  {
+    wxMemoryOutputStream ostream;
+    wxTextOutputStream txtstrm(ostream);
+    txtstrm.WriteString(m_content);
+    wxMemoryInputStream istream(ostream);
+    doc.Load(istream);
+  }
+  return doc.IsOk();
+}
+
+WXMXSnapshot::Result WXMXSnapshot::Write(const wxString &file) const
+{
+  // If we fail to load the document we abort the safe process as it will
+  // only destroy data.
+  if(!ContentIsValidXML())
+    return invalidXML;
+
+  // delete temp file if it already exists
+  wxString backupfile = file + wxT("~");
+  if (wxFileExists(backupfile))
+  {
+    if (!wxRemoveFile(backupfile))
+      return failed;
+  }
+  {
+    wxFFileOutputStream out(backupfile);
+    if (!out.IsOk())
+      return failed;
+    {
+      wxZipOutputStream zip(out);
+      if (!zip.IsOk())
+        return failed;
+      {
+        wxTextOutputStream output(zip);
+
+        /* The first zip entry is a file named "mimetype": This makes sure that the mimetype
+           is always stored at the same position in the file. This is common practice. One
+           example from an ePub file:
+
+           00000000  50 4b 03 04 14 00 00 08  00 00 cd bd 0a 43 6f 61  |PK...........Coa|
+           00000010  ab 2c 14 00 00 00 14 00  00 00 08 00 00 00 6d 69  |.,............mi|
+           00000020  6d 65 74 79 70 65 61 70  70 6c 69 63 61 74 69 6f  |metypeapplicatio|
+           00000030  6e 2f 65 70 75 62 2b 7a  69 70 50 4b 03 04 14 00  |n/epub+zipPK....|
+
+        */
+
+        // Make sure that the mime type is stored as plain text.
+        //
+        // We will keep that setting for the rest of the file for the following reasons:
+        //  - Compression of the .zip file won't improve compression of the embedded .png images
+        //  - The text part of the file is too small to justify compression
+        //  - not compressing the text part of the file allows version control systems to
+        //    determine which lines have changed and to track differences between file versions
+        //    efficiently (in a compressed text virtually every byte might change when one
+        //    byte at the start of the uncompressed original is)
+        //  - and if anything crashes in a bad way chances are high that the uncompressed
+        //    contents of the .wxmx file can be rescued using a text editor.
+        //  Who would - under these circumstances - care about a kilobyte?
+        zip.SetLevel(0);
+        zip.PutNextEntry(wxT("mimetype"));
+        output << wxT("text/x-wxmathml");
+        zip.CloseEntry();
+        zip.PutNextEntry(wxT("format.txt"));
+        output << wxT(
+          "\n\nThis file contains a wxMaxima session in the .wxmx format.\n"
+          ".wxmx files are .xml-based files contained in a .zip container like .odt\n"
+          "or .docx files. After changing their name to end in .zip the .xml and\n"
+          "eventual bitmap files inside them can be extracted using any .zip file\n"
+          "viewer.\n"
+          "The reason why part of a .wxmx file still might still seem to make sense in a\n"
+          "ordinary text viewer is that the text portion of .wxmx by default\n"
+          "isn't compressed: The text is typically small and compressing it would\n"
+          "mean that changing a single character would (with a high probability) change\n"
+          "big parts of the  whole contents of the compressed .zip archive.\n"
+          "Even if version control tools like git and svn that remember all changes\n"
+          "that were ever made to a file can handle binary files compression would\n"
+          "make the changed part of the file bigger and therefore seriously reduce\n"
+          "the efficiency of version control\n\n"
+          "wxMaxima can be downloaded from https://github.com/wxMaxima-developers/wxmaxima.\n"
+          "It also is part of the windows installer for maxima\n"
+          "(https://wxmaxima-developers.github.io/wxmaxima/).\n\n"
+          "If a .wxmx file is broken but the content.xml portion of the file can still be\n"
+          "viewed using an text editor just save the xml's text as \"content.xml\"\n"
+          "and try to open it using a recent version of wxMaxima.\n"
+          "If it is valid XML (the XML header is intact, all opened tags are closed again,\n"
+          "the text is saved with the text encoding \"UTF8 without BOM\" and the few\n"
+          "special characters XML requires this for are properly escaped)\n"
+          "chances are high that wxMaxima will be able to recover all code and text\n"
+          "from the XML file.\n\n"
+          );
+        zip.CloseEntry();
+
+        // next zip entry is "content.xml"
+        zip.PutNextEntry(wxT("content.xml"));
+
+        // wxWidgets could pretty-print the XML document now. But as no-one will
+        // look at it, anyway, there might be no good reason to do so.
+        output << m_content;
+
+        // Write the images and gnuplot files the cells have scheduled for saving
+        // directly from the buffers we share with the cells. Only gnuplot's files
+        // need to be uncompressed first.
+        for(std::vector<Cell::CellPointers::WXMXFile>::const_iterator it = m_files.begin();
+            it != m_files.end(); ++it)
+        {
+          zip.CloseEntry();
+
+          // The data for gnuplot is likely to change in its entirety if it
+          // ever changes => We can store it in a compressed form.
+          if(it->m_name.EndsWith(wxT(".data")))
+            zip.SetLevel(9);
+          else
+            zip.SetLevel(0);
+
+          zip.PutNextEntry(it->m_name);
+          // We run in a background thread => Don't create new references to
+          // the buffers the cells share.
+          if(it->m_compressed)
+          {
+            wxMemoryBuffer data = it->Data();
+            zip.Write(data.GetData(), data.GetDataLen());
+          }
+          else
+            zip.Write(it->m_data.GetData(), it->m_data.GetDataLen());
+        }
+      }
+      if(!zip.Close())
+        return failed;
+    }
+    if (!out.Close())
+      return failed;
+  }
+  // If all data is saved now we can overwrite the actual save file.
+  // We will try to do so a few times if we suspect a MSW virus scanner or similar
+  // temporarily hindering us from doing so.
+  
+  // The following line is paranoia as closing (and thus writing) the file has
+  // succeeded.
+  if(!wxFileExists(backupfile))
+    return failed;
+  
+  // Now we try to open the file in order to see if saving hasn't failed
+  // without returning an error - which can apparently happen on MSW.
+  wxString wxmxURI = wxURI(wxT("file://") + backupfile).BuildURI();
+  wxmxURI.Replace("#", "%23");
+#ifdef  __WXMSW__
+  // Fixes a missing "///" after the "file:". This works because we always get absolute
+  // file names.
+  wxRegEx uriCorector1("^file:([a-zA-Z]):");
+  wxRegEx uriCorector2("^file:([a-zA-Z][a-zA-Z]):");
+  uriCorector1.ReplaceFirst(&wxmxURI,wxT("file:///\\1:"));
+  uriCorector2.ReplaceFirst(&wxmxURI,wxT("file:///\\1:"));
+#endif
+  // The URI of the wxm code contained within the .wxmx file
+  wxString filename = wxmxURI + wxT("#zip:content.xml");
+
+  // Open the file we have saved yet just in order to see if we
+  // actually managed to save it correctly.
+  {
+    wxFileSystem fs;
+    wxFSFile *fsfile;
+#ifdef HAVE_OPENMP_TASKS
+#pragma omp critical (OpenFSFile)
+#endif
+    fsfile = fs.OpenFile(filename);
+    
+    // Did we succeed in opening the file?
+    if (!fsfile)
+    {
+      wxLogMessage(_(wxT("Saving succeeded, but the file could not be read again \u21D2 Not replacing the old saved file.")));
+      return failed;
+    }
+    wxDELETE(fsfile);
+  }
+
+  if(!RenameBackupFile(backupfile, file))
+    return failed;
+
+  wxLogMessage(_("wxmx file saved"));
+  return saved;
+}
+
+bool WXMXSnapshot::RenameBackupFile(const wxString &backupfile, const wxString &file)
+{
+  SuppressErrorDialogs suppressor;
+  if(wxRenameFile(backupfile, file, true))
+    return true;
+
+  // We might have failed to move the file because an over-eager virus scanner wants to
+  // scan it and a design decision of a filesystem driver might hinder us from moving
+  // it during this action => Wait for a second and retry.
+  for(int retries = 0; retries < 3; retries++)
+  {
+    wxSleep(1);
+    if(wxRenameFile(backupfile, file, true))
+      return true;
+  }
+  return false;
+}
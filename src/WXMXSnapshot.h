@@ -0,0 +1,101 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+
+
+
+/*! \file
+
+  This file declares the class WXMXSnapshot that writes a .wxmx file from a snapshot of the worksheet.
+ */
+
+#ifndef WXMXSNAPSHOT_H
+#define WXMXSNAPSHOT_H
+
+#include <wx/wx.h>
+#include <vector>
+#include "Cell.h"
+
+/*! Everything a .wxmx file consists of, taken from the worksheet at one point in time
+
+  Taking the snapshot is fast: content.xml is generated from the cells, but the
+  images and gnuplot data aren't copied as the snapshot shares the reference-counted
+  buffers with the cells. Images never modify their buffers, but replace them
+  by new ones => The snapshot stays valid even if the worksheet changes.
+
+  Validating, compressing, writing and checking the file is the part that
+  takes long for big documents. As Write() doesn't need the worksheet it can
+  therefore be run in a background thread. wxMemoryBuffer's reference counter
+  isn't thread-safe, though: The snapshot must therefore be created and
+  destroyed in the main thread.
+ */
+class WXMXSnapshot
+{
+public:
+  //! The outcome of Write()
+  enum Result
+  {
+    saved,      //!< The file has been written and read back successfully
+    invalidXML, //!< content.xml wouldn't load again => Nothing has been written
+    failed      //!< Writing or renaming the file has failed
+  };
+
+  /*! Take over the result of GroupCell::AppendListXML()
+
+    \param content The whole content.xml
+    \param files The images and other files the cells have scheduled for saving
+    \param imageCounter The number of the last image that has been named
+    \param generation The worksheet's modification counter when the snapshot was taken
+   */
+  WXMXSnapshot(const wxString &content, const std::vector<Cell::CellPointers::WXMXFile> &files,
+               int imageCounter, unsigned long generation) :
+    m_content(content), m_files(files), m_imageCounter(imageCounter),
+    m_generation(generation){}
+
+  /*! Write the snapshot to a .wxmx file
+
+    The file is first written to <file>~ and then read back: Only if that
+    works the old file is replaced.
+   */
+  Result Write(const wxString &file) const;
+
+  //! The contents of content.xml
+  const wxString &GetContent() const {return m_content;}
+  //! The images and other files the .wxmx file contains
+  const std::vector<Cell::CellPointers::WXMXFile> &GetFiles() const {return m_files;}
+  //! The number of the last image that has been named
+  int GetImageCounter() const {return m_imageCounter;}
+  //! The worksheet's modification counter when the snapshot was taken
+  unsigned long GetGeneration() const {return m_generation;}
+
+private:
+  //! Test if content.xml can be read by the XML parser before the user finds out the hard way
+  bool ContentIsValidXML() const;
+  //! Replace the file by its backup, retrying for a while if that fails
+  static bool RenameBackupFile(const wxString &backupfile, const wxString &file);
+
+  wxString m_content;
+  std::vector<Cell::CellPointers::WXMXFile> m_files;
+  int m_imageCounter;
+  unsigned long m_generation;
+};
+
+#endif // WXMXSNAPSHOT_H
@@ -44,6 +44,7 @@
 #include "wxMaximaFrame.h"
 #include "Worksheet.h"
 #include "BitmapOut.h"
+#include "ExportCache.h"
 #include "SlideShowCell.h"
 #include "ImgCell.h"
 #include "MarkDown.h"
@@ -58,6 +59,7 @@
 #include <wx/xml/xml.h>
 #include <wx/mstream.h>
 #include <wx/dcgraph.h>
+#include <wx/display.h>
 #include <wx/fileconf.h>
 #include <wx/uri.h>
 #include <wx/zipstrm.h>
@@ -66,6 +68,8 @@
 #include <wx/filesys.h>
 #include <wx/fs_mem.h>
 #include <stdlib.h>
+#include <map>
+#include <typeinfo>
 #include "memory"
 
 //! This class represents the worksheet shown in the middle of the wxMaxima window.
@@ -118,6 +122,7 @@ Worksheet::Worksheet(wxWindow *parent, int id, wxPoint pos, wxSize size) :
   m_recalculateStart = NULL;
   m_mouseMotionWas = false;
   m_rectToRefresh = wxRect(-1,-1,-1,-1);
+  m_staleTiles = wxRect(-1,-1,-1,-1);
   m_notificationMessage = NULL;
   m_configuration = &m_configurationTopInstance;
   m_configuration->SetBackgroundBrush(
@@ -141,10 +146,13 @@ Worksheet::Worksheet(wxWindow *parent, int id, wxPoint pos, wxSize size) :
   m_windowActive = true;
   m_lastTop = 0;
   m_lastBottom = 0;
+  m_tileGeneration = 0;
   m_followEvaluation = true;
   TreeUndo_ActiveCell = NULL;
   m_questionPrompt = false;
   m_scheduleUpdateToc = false;
+  m_scheduleTocRescan = false;
+  m_tableOfContents = NULL;
   m_scrolledAwayFromEvaluation = false;
   m_mainToolBar = NULL;
   m_clickType = CLICK_TYPE_NONE;
@@ -159,6 +167,15 @@ Worksheet::Worksheet(wxWindow *parent, int id, wxPoint pos, wxSize size) :
   m_blinkDisplayCaret = true;
   m_timer.SetOwner(this, TIMER_ID);
   m_caretTimer.SetOwner(this, CARET_TIMER_ID);
+  m_redrawTimer.SetOwner(this, REDRAW_TIMER_ID);
+  m_paintsInInterval = 0;
+  m_pixelsInInterval = 0;
+  m_paintsPerSecond = 0;
+  m_pixelsPerSecond = 0;
+  m_paintsTotal = 0;
+  m_pixelsTotal = 0;
+  UpdateFrameInterval();
+  m_generation = 0;
   SetSaved(false);
   AdjustSize();
   m_autocompleteTemplates = false;
@@ -233,7 +250,7 @@ wxSize Worksheet::DoGetBestClientSize() const
   return size;
 }
 
-bool Worksheet::RedrawIfRequested()
+bool Worksheet::RedrawIfRequested(bool force)
 {
   bool redrawIssued = false;
 
@@ -328,36 +345,101 @@ bool Worksheet::RedrawIfRequested()
     m_mouseMotionWas = false;
     redrawIssued = true;
   }
+
+  if ((!m_redrawRequested) && (m_rectToRefresh.GetLeft() < 0))
+    return redrawIssued;
+
+  // While maxima is sending output there is no need to redraw the worksheet
+  // more often than the display can show: Delay the redraw to the next frame.
+  if ((!force) && (m_cellPointers.m_workingGroup != NULL) &&
+      (m_sinceLastRedraw.Time() < m_frameInterval))
+  {
+    if (!m_redrawTimer.IsRunning())
+      m_redrawTimer.StartOnce(m_frameInterval - m_sinceLastRedraw.Time());
+    return redrawIssued;
+  }
+  
   if (m_redrawRequested)
   {
-    Refresh();
+    // Only the cells starting with m_redrawStart have changed.
+    if ((m_redrawStart != NULL) && (GetTree() != NULL) && (m_redrawStart != GetTree()) &&
+        (m_redrawStart->GetRect().GetTop() >= 0) && (GetTree()->Contains(m_redrawStart)))
+    {
+      int virtualWidth;
+      int virtualHeight;
+      GetVirtualSize(&virtualWidth, &virtualHeight);
+      // The horizontal cursor above the cell might be affected, too.
+      int top = m_redrawStart->GetRect().GetTop() - m_configuration->GetGroupSkip();
+      wxRect rect(0, top, virtualWidth, virtualHeight - top);
+      if(m_rectToRefresh.GetLeft() >= 0)
+        rect = rect.Union(m_rectToRefresh);
+      CalcScrolledPosition(rect.x, rect.y, &rect.x, &rect.y);
+      RefreshRect(rect);
+    }
+    else
+      Refresh();
     m_redrawRequested = false;
     m_redrawStart = NULL;
     redrawIssued = true;
-    m_rectToRefresh = wxRect(-1, -1, -1, -1);
   }
   else
   {
-    if(m_rectToRefresh.GetLeft()>=0)
-    {
-      CalcScrolledPosition(m_rectToRefresh.x, m_rectToRefresh.y, &m_rectToRefresh.x, &m_rectToRefresh.y);
-      RefreshRect(m_rectToRefresh);
-      redrawIssued = true;
-    }
+    CalcScrolledPosition(m_rectToRefresh.x, m_rectToRefresh.y, &m_rectToRefresh.x, &m_rectToRefresh.y);
+    RefreshRect(m_rectToRefresh);
+    redrawIssued = true;
   }
   m_rectToRefresh = wxRect(-1, -1, -1, -1);
+  m_sinceLastRedraw.Start();
+  m_redrawTimer.Stop();
 
   return redrawIssued;
 }
 
+void Worksheet::UpdateFrameInterval()
+{
+  int refreshRate = 0;
+#if wxUSE_DISPLAY
+  int display = wxDisplay::GetFromWindow(this);
+  if (display != wxNOT_FOUND)
+    refreshRate = wxDisplay(display).GetCurrentMode().GetRefresh();
+#endif
+  // Some displays don't tell their refresh rate
+  if (refreshRate < 20)
+    refreshRate = 60;
+  m_frameInterval = 1000 / refreshRate;
+}
+
+void Worksheet::AccountForPaint(wxRect rect)
+{
+  long long pixels = (long long) rect.GetWidth() * rect.GetHeight();
+  m_paintsInInterval++;
+  m_pixelsInInterval += pixels;
+  m_paintsTotal++;
+  m_pixelsTotal += pixels;
+
+  long interval = m_paintStatsStopWatch.Time();
+  if (interval < 1000)
+    return;
+
+  m_paintsPerSecond = 1000.0 * m_paintsInInterval / interval;
+  m_pixelsPerSecond = 1000.0 * m_pixelsInInterval / interval;
+  m_paintsInInterval = 0;
+  m_pixelsInInterval = 0;
+  m_paintStatsStopWatch.Start();
+}
+
 void Worksheet::RequestRedraw(GroupCell *start)
 {
   m_redrawRequested = true;
 
   if (start == 0)
+  {
     m_redrawStart = GetTree();
+    m_tileGeneration++;
+  }
   else
   {
+    start->ClearTile();
     if (m_redrawStart != NULL)
     {
       // No need to waste time avoiding to waste time in a refresh when we don't
@@ -397,6 +479,7 @@ Worksheet::~Worksheet()
     ReleaseMouse();
   
   m_mainToolBar = NULL;
+  m_tableOfContents = NULL;
 
   ClearDocument();
   m_configuration = NULL;
@@ -480,6 +563,8 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   // Don't draw into a window of the size 0.
   if ((sz.x < 1) || (sz.y < 1))
     return;
+
+  AccountForPaint(rect);
   
 #ifdef WORKING_AUTO_BUFFER
   m_configuration->SetContext(dc);
@@ -656,6 +741,18 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
     (m_configuration)->SetVisibleRegion(wxRect(upperLeftScreenCorner,
                                                upperLeftScreenCorner + wxPoint(width,height)));
     (m_configuration)->SetWorksheetPosition(GetPosition());
+    // Offscreen images of cells that have been scrolled out of view would
+    // only occupy memory.
+    wxPoint viewportStart;
+    CalcUnscrolledPosition(0, 0, &viewportStart.x, &viewportStart.y);
+    if ((cellRect.GetTop() >= viewportStart.y + height) ||
+        (cellRect.GetBottom() <= viewportStart.y))
+      tmp->ClearTile();
+    // The offscreen images of cells RequestRedraw() was told have changed
+    // are outdated.
+    if ((m_staleTiles.GetLeft() >= 0) && (cellRect.Intersects(m_staleTiles)))
+      tmp->ClearTile();
+
     // Clear the image cache of all cells above or below the viewport.
     if ((cellRect.GetTop() >= bottom) || (cellRect.GetBottom() <= top))
     {
@@ -675,7 +772,8 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
       tmp->InEvaluationQueue(m_evaluationQueue.IsInQueue(tmp));
       tmp->LastInEvaluationQueue(m_evaluationQueue.GetCell() == tmp);
     }
-    tmp->Draw(point);
+    if (!(CanDrawFromTile(tmp) && DrawFromTile(tmp, point)))
+      tmp->Draw(point);
     tmp = tmp->GetNext();
     if (tmp != NULL)
     {
@@ -684,6 +782,7 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
     }
   }
   
+  m_staleTiles = wxRect(-1, -1, -1, -1);
   if(recalculateNecessaryWas)
     wxLogMessage(_("Cell wasn't recalculated on draw!"));
   
@@ -700,6 +799,176 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   m_lastBottom = bottom;
 }
 
+bool Worksheet::CanDrawFromTile(GroupCell *group)
+{
+  wxRect cellRect = group->GetRect();
+  if ((cellRect.GetLeft() < 0) || (cellRect.GetTop() < 0) ||
+      (cellRect.GetWidth() < 1) || (cellRect.GetHeight() < 1))
+    return false;
+
+  // Cells that aren't visible aren't drawn, anyway.
+  if (!cellRect.Intersects(m_configuration->GetUpdateRegion()))
+    return false;
+
+  // Cells bigger than the screen would need too much memory.
+  int width;
+  int height;
+  GetClientSize(&width, &height);
+  if ((cellRect.GetWidth() > 2 * width) || (cellRect.GetHeight() > 2 * height))
+    return false;
+
+  // Cells that change all the time.
+  if (group == m_cellPointers.m_workingGroup)
+    return false;
+  if ((GetActiveCell() != NULL) && (GetActiveCell()->GetGroup() == group))
+    return false;
+
+  // Selected output is marked by a box that is drawn behind the cells.
+  if (CellsSelected() && (m_cellPointers.m_selectionStart->GetType() != MC_TYPE_GROUP))
+  {
+    if ((m_cellPointers.m_selectionStart->GetGroup() == group) ||
+        (m_cellPointers.m_selectionEnd->GetGroup() == group))
+      return false;
+  }
+  return true;
+}
+
+bool Worksheet::DrawFromTile(GroupCell *group, wxPoint point)
+{
+  wxDC *dc = m_configuration->GetDC();
+  wxDC *antiAliassingDC = m_configuration->GetAntialiassingDC();
+  double scale = wxWindow::GetContentScaleFactor();
+  wxRect cellRect = group->GetRect();
+  // The bracket isn't part of the tile, but the evaluation timings that are
+  // right-aligned to the window border are.
+  wxRect tileRect(m_configuration->GetIndent(), cellRect.GetTop(),
+                  wxMax(cellRect.GetRight() + 1, m_configuration->GetCanvasSize().GetWidth()) -
+                  m_configuration->GetIndent(),
+                  cellRect.GetHeight());
+  if ((tileRect.GetWidth() < 1) || (tileRect.GetHeight() < 1))
+    return false;
+
+  GroupCell::Tile *tile = group->GetTile();
+  if ((tile == NULL) ||
+      (tile->m_rect != tileRect) ||
+      (tile->m_zoomFactor != m_configuration->GetZoomFactor()) ||
+      (tile->m_scale != scale) ||
+      (tile->m_generation != m_tileGeneration) ||
+      (tile->m_selectionString != m_cellPointers.m_selectionString) ||
+      (tile->m_showEvaluationStats != m_configuration->ShowEvaluationStats()))
+  {
+    group->ClearTile();
+    tile = new GroupCell::Tile;
+    #ifdef __WXMAC__
+    tile->m_bitmap = wxBitmap(tileRect.GetSize() * scale, wxBITMAP_SCREEN_DEPTH, scale);
+    #else
+    tile->m_bitmap = wxBitmap(tileRect.GetSize() * scale, wxBITMAP_SCREEN_DEPTH);
+    #endif
+    if (!tile->m_bitmap.IsOk())
+    {
+      wxDELETE(tile);
+      return false;
+    }
+    tile->m_rect = tileRect;
+    tile->m_zoomFactor = m_configuration->GetZoomFactor();
+    tile->m_scale = scale;
+    tile->m_generation = m_tileGeneration;
+    tile->m_selectionString = m_cellPointers.m_selectionString;
+    tile->m_showEvaluationStats = m_configuration->ShowEvaluationStats();
+
+    wxRect updateRegion = m_configuration->GetUpdateRegion();
+    {
+      // Draw the cell into the tile using the worksheet's coordinates.
+      wxMemoryDC tileDC;
+      tileDC.SetUserScale(scale, scale);
+      tileDC.SelectObject(tile->m_bitmap);
+      if (!tileDC.IsOk())
+      {
+        wxDELETE(tile);
+        return false;
+      }
+      tileDC.SetDeviceOrigin(-tileRect.GetLeft() * scale, -tileRect.GetTop() * scale);
+      wxGCDC tileAntiAliassingDC(tileDC);
+      m_configuration->SetContext(tileDC);
+      if (tileAntiAliassingDC.IsOk())
+      {
+        tileAntiAliassingDC.SetUserScale(scale, scale);
+        tileAntiAliassingDC.SetDeviceOrigin(-tileRect.GetLeft() * scale, -tileRect.GetTop() * scale);
+        m_configuration->SetAntialiassingDC(tileAntiAliassingDC);
+      }
+      m_configuration->SetUpdateRegion(tileRect);
+      tileDC.SetMapMode(wxMM_TEXT);
+      tileDC.SetBackgroundMode(wxTRANSPARENT);
+      tileDC.SetBackground(m_configuration->GetBackgroundBrush());
+      tileDC.Clear();
+      tileDC.SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_DEFAULT), 1, wxPENSTYLE_SOLID)));
+      tileDC.SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_DEFAULT))));
+      tileDC.SetLogicalFunction(wxCOPY);
+      group->Draw(point);
+      m_configuration->UnsetAntialiassingDC();
+      tileDC.SelectObject(wxNullBitmap);
+    }
+    m_configuration->SetUpdateRegion(updateRegion);
+    m_configuration->SetContext(*dc);
+    m_configuration->SetAntialiassingDC(*antiAliassingDC);
+    group->SetTile(tile);
+  }
+  if (m_configuration->ShowBrackets())
+    group->DrawBracket();
+
+  // Copy the part of the tile that is to be redrawn to the screen
+  wxRect visiblePart = tileRect.Intersect(m_configuration->GetUpdateRegion());
+  if (visiblePart.IsEmpty())
+    return true;
+  wxMemoryDC tileDC;
+  tileDC.SetUserScale(scale, scale);
+  tileDC.SelectObjectAsSource(tile->m_bitmap);
+  if (!tileDC.IsOk())
+    return false;
+  tileDC.SetDeviceOrigin(-tileRect.GetLeft() * scale, -tileRect.GetTop() * scale);
+  dc->Blit(visiblePart.GetLeft(), visiblePart.GetTop(),
+           visiblePart.GetWidth(), visiblePart.GetHeight(),
+           &tileDC, visiblePart.GetLeft(), visiblePart.GetTop());
+  return true;
+}
+
+void Worksheet::DrawOffscreen(wxDC &dc)
+{
+  // We want to draw all cells, not only the ones in the visible region.
+  bool clipToDrawRegion = m_configuration->ClipToDrawRegion();
+  m_configuration->ClipToDrawRegion(false);
+  m_configuration->SetContext(dc);
+
+  dc.SetMapMode(wxMM_TEXT);
+  dc.SetBackgroundMode(wxTRANSPARENT);
+  dc.SetBackground(m_configuration->GetBackgroundBrush());
+  dc.Clear();
+  dc.SetPen(*(wxThePenList->FindOrCreatePen(m_configuration->GetColor(TS_DEFAULT), 1, wxPENSTYLE_SOLID)));
+  dc.SetBrush(*(wxTheBrushList->FindOrCreateBrush(m_configuration->GetColor(TS_DEFAULT))));
+
+  if (GetTree() != NULL)
+  {
+    wxPoint point;
+    point.x = m_configuration->GetIndent();
+    point.y = m_configuration->GetBaseIndent() + GetTree()->GetCenterList();
+    GroupCell *tmp = GetTree();
+    while (tmp != NULL)
+    {
+      tmp->SetCurrentPoint(point);
+      tmp->Draw(point);
+      tmp = tmp->GetNext();
+      if (tmp != NULL)
+      {
+        tmp->UpdateYPosition();
+        point = tmp->GetCurrentPoint();
+      }
+    }
+  }
+
+  m_configuration->SetContext(*m_dc);
+  m_configuration->ClipToDrawRegion(clipToDrawRegion);
+}
+
 GroupCell *Worksheet::InsertGroupCells(GroupCell *cells, GroupCell *where)
 {
   return InsertGroupCells(cells, where, &treeUndoActions);
@@ -765,6 +1034,9 @@ GroupCell *Worksheet::InsertGroupCells(
   if (undoBuffer)
     TreeUndo_MarkCellsAsAdded(cells, lastOfCellsToInsert, undoBuffer);
 
+  if (m_tableOfContents != NULL)
+    m_tableOfContents->CellsInserted(cells, lastOfCellsToInsert);
+  UpdateTableOfContents(false);
   RequestRedraw(where);
   return lastOfCellsToInsert;
 }
@@ -1034,6 +1306,9 @@ void Worksheet::OnSize(wxSizeEvent& WXUNUSED(event))
   // Inform all cells how wide our display is now
   m_configuration->SetCanvasSize(GetClientSize());
 
+  // The window might have been moved to a different screen
+  UpdateFrameInterval();
+
   // Determine if we have a sane thing we can scroll to.
   Cell *CellToScrollTo = NULL;
   if (CaretVisibleIs())
@@ -2043,7 +2318,7 @@ void Worksheet::OnMouseLeftDown(wxMouseEvent &event)
 
   RequestRedraw();
   // Re-calculate the table of contents
-  UpdateTableOfContents();
+  UpdateTableOfContents(false);
 }
 
 
@@ -2417,8 +2692,9 @@ bool Worksheet::Copy(bool astext)
         // it likes the MathML - which is standartized.
         if (tmp != NULL)
         {
-          wxString rtf;
-          rtf = RTFStart() + tmp->ListToRTF() + wxT("\\par\n") + RTFEnd();
+          wxString rtf = RTFStart();
+          tmp->AppendListRTF(rtf);
+          rtf += wxT("\\par\n") + RTFEnd();
           data->Add(new RtfDataObject(rtf));
           data->Add(new RtfDataObject2(rtf), true);
         }
@@ -2470,9 +2746,9 @@ wxString Worksheet::ConvertSelectionToMathML()
      CopySelection(m_cellPointers.m_selectionStart, m_cellPointers.m_selectionEnd, true));
 
    s = wxString(wxT("<math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n")) +
-     wxT("<semantics>") +
-     tmp->ListToMathML(true) +
-     wxT("<annotation encoding=\"application/x-maxima\">") +
+     wxT("<semantics>");
+   tmp->AppendListMathML(s, true);
+   s += wxT("<annotation encoding=\"application/x-maxima\">") +
      Cell::XMLescape(tmp->ListToString()) +
      wxT("</annotation>") +
      wxT("</semantics>") +
@@ -2597,7 +2873,7 @@ bool Worksheet::CopyTeX()
       s = wxT("\\[");
     while (tmp != NULL)
     {
-      s += tmp->ToTeX();
+      tmp->AppendTeX(s);
       if (tmp == m_cellPointers.m_selectionEnd)
         break;
       tmp = tmp->m_next;
@@ -2970,6 +3246,9 @@ void Worksheet::DeleteRegion(GroupCell *start, GroupCell *end, std::list<TreeUnd
 
   GroupCell *cellBeforeStart = dynamic_cast<GroupCell *>(start->m_previous);;
 
+  if (m_tableOfContents != NULL)
+    m_tableOfContents->CellsDeleted(start, end);
+
   // If the selection ends with the last file of the file m_last has to be
   // set to the last cell that isn't deleted.
   if (end == m_last)
@@ -3013,7 +3292,7 @@ void Worksheet::DeleteRegion(GroupCell *start, GroupCell *end, std::list<TreeUnd
 
   if (renumber)
     NumberSections();
-  UpdateTableOfContents();
+  UpdateTableOfContents(false);
   Recalculate();
   RequestRedraw();
   SetSaved(false);
@@ -3438,7 +3717,7 @@ void Worksheet::OnCharInActive(wxKeyEvent &event)
 
     // Re-calculate the table of contents as we possibly leave a cell that is
     // to be found here.
-    UpdateTableOfContents();
+    UpdateTableOfContents(false);
 
     // If we scrolled away from the cell that is currently being evaluated
     // we need to enable the button that brings us back
@@ -3493,7 +3772,7 @@ void Worksheet::OnCharInActive(wxKeyEvent &event)
     }
     // Re-calculate the table of contents as we possibly leave a cell that is
     // to be found here.
-    UpdateTableOfContents();
+    UpdateTableOfContents(false);
     ScrolledAwayFromEvaluation();
 
     return;
@@ -3630,7 +3909,7 @@ void Worksheet::OnCharInActive(wxKeyEvent &event)
   if (GetActiveCell())
   {
     if (IsLesserGCType(GC_TYPE_TEXT, dynamic_cast<GroupCell *>(GetActiveCell()->GetGroup())->GetGroupType()))
-      UpdateTableOfContents();
+      UpdateTableOfContents(false);
   }
 }
 
@@ -4438,6 +4717,9 @@ void Worksheet::OnTimer(wxTimerEvent &event)
       m_timer.Start(50, true);
     }
     break;
+  case REDRAW_TIMER_ID:
+    RedrawIfRequested();
+    break;
   case CARET_TIMER_ID:
     {
       int virtualsize_x;
@@ -4471,7 +4753,7 @@ void Worksheet::OnTimer(wxTimerEvent &event)
         }
         rect.SetLeft(0);
         rect.SetRight(virtualsize_x + m_configuration->Scale_Px(10));
-        RequestRedraw(rect);
+        RequestRedraw(rect, false);
       }
 
       // We only blink the cursor if we have the focus => If we loose the focus
@@ -4495,6 +4777,28 @@ void Worksheet::OnTimer(wxTimerEvent &event)
       }
       if(slideshow != NULL)
       {
+        // Add the frames gnuplot has rendered in the background since the last tick
+        int oldLength = slideshow->Length();
+        if(slideshow->UpdateRenderedFrames())
+        {
+          // A file saved before contains only the frames rendered until then
+          OutputChanged();
+          if(oldLength == 0)
+          {
+            // The first frame has arrived => The cell now knows its size.
+            slideshow->ResetSize();
+            Recalculate(slideshow, true);
+            RequestRedraw();
+          }
+          else
+            RequestRedraw(slideshow->GetRect());
+        }
+        if(slideshow->FramesPending())
+          slideshow->ReloadTimer();
+
+        if((!slideshow->AnimationRunning()) || (slideshow->Length() == 0))
+          break;
+
         int pos = slideshow->GetDisplayedIndex() + 1;
 
         if (pos >= slideshow->Length())
@@ -4521,8 +4825,17 @@ void Worksheet::OnTimer(wxTimerEvent &event)
   }
 }
 
-void Worksheet::RequestRedraw(wxRect rect)
+void Worksheet::RequestRedraw(wxRect rect, bool contentsChanged)
 {
+  // OnPaint() walks through all GroupCells, anyway => it drops their
+  // offscreen images instead of us searching for the cells in this rectangle.
+  if(contentsChanged)
+  {
+    if(m_staleTiles.GetLeft() < 0)
+      m_staleTiles = rect;
+    else
+      m_staleTiles = m_staleTiles.Union(rect);
+  }
   if(m_rectToRefresh.IsEmpty())
     m_rectToRefresh = rect;
   else
@@ -4538,6 +4851,8 @@ void Worksheet::DestroyTree()
   SetHCaret(NULL);
   TreeUndo_ClearUndoActionList();
   TreeUndo_ClearRedoActionList();
+  if (m_tableOfContents != NULL)
+    m_tableOfContents->CellsDeleted(m_tree, NULL);
   wxDELETE(m_tree);
   m_tree = NULL;
   m_last = NULL;
@@ -4839,7 +5154,7 @@ void Worksheet::CalculateReorderedCellIndices(Cell *tree, int &cellIndex, std::v
 /***
  * Export content to a HTML file.
  */
-bool Worksheet::ExportToHTML(wxString file)
+bool Worksheet::ExportToHTML(wxString file, std::function<void(long, long)> progress)
 {
   // Show a busy cursor as long as we export.
   wxBusyCursor crs;
@@ -4858,6 +5173,22 @@ bool Worksheet::ExportToHTML(wxString file)
   int count = 0;
   GroupCell *tmp = GetTree();
   MarkDownHTML MarkDown(m_configuration);
+  // Renders the equations if we export them as bitmaps
+  std::unique_ptr<BitmapOut> bitmapOut;
+  int bitmapScale = 3;
+  wxConfig::Get()->Read(wxT("bitmapScale"), &bitmapScale);
+  long groupCellsDone = 0;
+  long groupCells = 0;
+  for(GroupCell *cell = GetTree(); cell != NULL; cell = cell->GetNext())
+    groupCells++;
+  // The settings the export depends on
+  Configuration::htmlExportFormat htmlEquationFormat = m_configuration->HTMLequationFormat();
+  bool showCodeCells = m_configuration->ShowCodeCells();
+  // Allows to reuse the images rendered for unchanged equations in earlier exports
+  ExportCache exportCache(m_configuration->RenderSettings() +
+                          wxString::Format(wxT("html;%i;%i;%i"), (int) htmlEquationFormat,
+                                           bitmapScale, showCodeCells),
+                          m_configuration->ExportCacheMegabytes());
 
   wxFileName::SplitPath(file, &path, &filename, &ext);
   imgDir_rel = filename + wxT("_htmlimg");
@@ -5416,11 +5747,11 @@ bool Worksheet::ExportToHTML(wxString file)
       // Handle the label
       Cell *out = tmp->GetLabel();
 
-      if (out || (m_configuration->ShowCodeCells()))
+      if (out || showCodeCells)
         output << wxT("\n\n<!-- Code cell -->\n\n\n");
 
       // Handle the input
-      if (m_configuration->ShowCodeCells())
+      if (showCodeCells)
       {
         Cell *prompt = tmp->GetPrompt();
         output << wxT("<table><tr><td>\n");
@@ -5487,7 +5818,7 @@ bool Worksheet::ExportToHTML(wxString file)
           }
           else if (chunk->GetType() != MC_TYPE_IMAGE)
           {
-            switch(m_configuration->HTMLequationFormat())
+            switch(htmlEquationFormat)
             {
             case Configuration::mathJaX_TeX:
             {
@@ -5515,8 +5846,18 @@ bool Worksheet::ExportToHTML(wxString file)
             {
               wxString alttext;
               alttext = EditorCell::EscapeHTMLChars(chunk->ListToString());
-              Svgout svgout(&m_configuration, imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.svg"), count));
-              wxSize size = svgout.SetData(&(*chunk));
+              wxString imageFile = imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.svg"), count);
+              wxString xml = chunk->ListToXML();
+              wxSize size;
+              if(!exportCache.Retrieve(xml, wxT("svg"), imageFile, size))
+              {
+                {
+                  // The svg file is written when svgout is destroyed.
+                  Svgout svgout(&m_configuration, imageFile);
+                  size = svgout.SetData(CopySelection(&(*chunk), NULL, true));
+                }
+                exportCache.Store(xml, wxT("svg"), imageFile, size);
+              }
               wxString line = wxT("  <img src=\"") +
                 filename_encoded + wxT("_htmlimg/") + filename_encoded +
                 wxString::Format(wxT("_%d.svg\" width=\"%i\" style=\"max-width:90%%;\" loading=\"lazy\" alt=\"" ),
@@ -5530,13 +5871,33 @@ bool Worksheet::ExportToHTML(wxString file)
 
             case Configuration::bitmap:
             {
-              wxSize size;
-              int bitmapScale = 3;
               ext = wxT(".png");
-              wxConfig::Get()->Read(wxT("bitmapScale"), &bitmapScale);
-              size = CopyToFile(imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.png"), count),
-                                &(*chunk),
-                                NULL, true, bitmapScale);
+              wxString imageFile = imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.png"), count);
+              wxString xml = chunk->ListToXML();
+              wxSize size(-1, -1);
+              if(!exportCache.Retrieve(xml, wxT("png"), imageFile, size))
+              {
+                // Creating a BitmapOut object means creating a new Configuration
+                // that reads all settings and fonts => we render all equations using
+                // the same one.
+                if(!bitmapOut)
+                  bitmapOut = std::unique_ptr<BitmapOut>(new BitmapOut(&m_configuration, bitmapScale));
+                if(bitmapOut->SetData(CopySelection(&(*chunk), NULL, true)))
+                {
+                  size = bitmapOut->GetSize();
+                  // Compressing the image is what takes most of the time => do that in
+                  // the background. The task is the only owner of the image it saves.
+                  wxImage *image = new wxImage(bitmapOut->ToImage());
+                  #ifdef HAVE_OPENMP_TASKS
+                  #pragma omp task firstprivate(image, imageFile, xml, size) shared(exportCache)
+                  #endif
+                  {
+                    if(image->SaveFile(imageFile, wxBITMAP_TYPE_PNG))
+                      exportCache.Store(xml, wxT("png"), imageFile, size);
+                    delete image;
+                  }
+                }
+              }
               int borderwidth = 0;
               wxString alttext = EditorCell::EscapeHTMLChars(chunk->ListToString());
               borderwidth = chunk->m_imageBorderWidth;
@@ -5689,7 +6050,15 @@ bool Worksheet::ExportToHTML(wxString file)
     }
 
     tmp = tmp->GetNext();
+    if(progress)
+      progress(++groupCellsDone, groupCells);
   }
+  // Release the renderer and wait until all images are written.
+  bitmapOut.reset();
+  #ifdef HAVE_OPENMP_TASKS
+  #pragma omp taskwait
+  #endif
+  exportCache.Trim();
 
 //////////////////////////////////////////////
 // Footer
@@ -6363,6 +6732,120 @@ void Worksheet::ExportToMAC(wxTextFile &output, GroupCell *tree, bool wxm, const
   }
 }
 
+bool Worksheet::ExportEvaluationStats(wxString file)
+{
+  bool json = file.Lower().EndsWith(wxT(".json"));
+
+  wxTextFile output(file);
+  if (output.Exists())
+  {
+    if (!output.Open())
+      return false;
+    output.Clear();
+  }
+  else if (!output.Create())
+    return false;
+
+  if (json)
+    output.AddLine(wxT("["));
+  else
+    output.AddLine(EvaluationStats::CSVHeader());
+
+  bool first = true;
+  GroupCell *tmp = GetTree();
+  while (tmp != NULL)
+  {
+    if ((tmp->GetGroupType() == GC_TYPE_CODE) && tmp->GetEvaluationStats().Valid())
+    {
+      // The first line of the input identifies the cell well enough
+      wxString label;
+      if (tmp->GetEditable() != NULL)
+        label = tmp->GetEditable()->ToString().BeforeFirst(wxT('\n'));
+
+      if (json)
+      {
+        if (!first)
+          output[output.GetLineCount() - 1] += wxT(",");
+        output.AddLine(wxT("  ") + tmp->GetEvaluationStats().ToJSON(label));
+      }
+      else
+        output.AddLine(tmp->GetEvaluationStats().ToCSV(label));
+      first = false;
+    }
+    tmp = tmp->GetNext();
+  }
+
+  if (json)
+    output.AddLine(wxT("]"));
+
+  bool done = output.Write(wxTextFileType_None);
+  if (!output.Close()) return false;
+  return done;
+}
+
+//! The number and memory usage of all cells of one type
+struct CellMemoryUsage
+{
+  CellMemoryUsage() : m_cells(0), m_bytes(0) {}
+  long long m_cells;
+  long long m_bytes;
+};
+
+//! Add the memory usage of a list of cells and of all cells inside them to usage
+static void AccountMemoryUsage(Cell *cell, std::map<wxString, CellMemoryUsage> &usage)
+{
+  while (cell != NULL)
+  {
+    // GCC prepends the length of the class name, MSVC prepends "class "
+    wxString type = wxString(typeid(*cell).name());
+    while ((!type.IsEmpty()) && (wxIsdigit(type[0])))
+      type = type.Mid(1);
+    type.Replace(wxT("class "), wxEmptyString);
+
+    usage[type].m_cells++;
+    usage[type].m_bytes += cell->GetMemoryUsage();
+
+    std::list<std::shared_ptr<Cell>> innerCells = cell->GetInnerCells();
+    for (std::list<std::shared_ptr<Cell>>::const_iterator it = innerCells.begin();
+         it != innerCells.end(); ++it)
+      AccountMemoryUsage(it->get(), usage);
+
+    GroupCell *group = dynamic_cast<GroupCell *>(cell);
+    if ((group != NULL) && (group->GetHiddenTree() != NULL))
+      AccountMemoryUsage(group->GetHiddenTree(), usage);
+
+    cell = cell->m_next;
+  }
+}
+
+wxString Worksheet::MemoryUsageReport()
+{
+  std::map<wxString, CellMemoryUsage> usage;
+  AccountMemoryUsage(GetTree(), usage);
+
+  wxString report;
+  CellMemoryUsage total;
+  for (std::map<wxString, CellMemoryUsage>::const_iterator it = usage.begin();
+       it != usage.end(); ++it)
+  {
+    report += wxString::Format(_("%s: %lli cells, %lli kB (%lli bytes per cell)\n"),
+                               it->first, it->second.m_cells, it->second.m_bytes / 1000,
+                               it->second.m_bytes / it->second.m_cells);
+    total.m_cells += it->second.m_cells;
+    total.m_bytes += it->second.m_bytes;
+  }
+  report += wxString::Format(_("All cells: %lli cells, %lli kB\n"),
+                             total.m_cells, total.m_bytes / 1000);
+
+  size_t strings, bytes;
+  InternedString::PoolStatistics(strings, bytes);
+  report += wxString::Format(_("Strings shared between cells: %li strings, %li kB\n"),
+                             (long) strings, (long) bytes / 1000);
+  report += wxString::Format(_("Cached text sizes: %li\n"),
+                             (long) m_configuration->GetTextExtentCacheSize());
+  return report;
+}
+
 bool Worksheet::ExportToMAC(wxString file)
 {
   bool wasSaved = m_saved;
@@ -6441,10 +6924,119 @@ bool Worksheet::ExportToMAC(wxString file)
   if (wxm)
     SetSaved(true);
   else
-    SetSaved(wasSaved);
+    m_saved = wasSaved; // Restoring the status doesn't modify the document
   return true;
 }
 
+wxString Worksheet::WXMXContentHeader()
+{
+  wxString xmlText;
+
+  xmlText << wxT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+  xmlText << wxT("\n<!--   Created using wxMaxima ") << wxT(GITVERSION) << wxT("   -->");
+  xmlText << wxT("\n<!--https://wxMaxima-developers.github.io/wxmaxima/-->\n");
+
+  // write document
+  xmlText << wxT("\n<wxMaximaDocument version=\"");
+  xmlText << DOCUMENT_VERSION_MAJOR << wxT(".");
+  xmlText << DOCUMENT_VERSION_MINOR << wxT("\" zoom=\"");
+  xmlText << int(100.0 * m_configuration->GetZoomFactor()) << wxT("\"");
+
+  // **************************************************************************
+  // Find out the number of the cell the cursor is at and save this information
+  // if we find it
+
+  // Determine which cell the cursor is at.
+  long ActiveCellNumber = 1;
+  GroupCell *cursorCell = NULL;
+  if (m_hCaretActive)
+  {
+    cursorCell = GetHCaret();
+
+    // If the cursor is before the 1st cell in the worksheet the cell number
+    // is 0.
+    if (!cursorCell)
+      ActiveCellNumber = 0;
+  }
+  else
+  {
+    if (GetActiveCell())
+      cursorCell = dynamic_cast<GroupCell *>(GetActiveCell()->GetGroup());
+  }
+
+  if (cursorCell == NULL)
+    ActiveCellNumber = 0;
+  // We want to save the information that the cursor is in the nth cell.
+  // Count the cells until then.
+  GroupCell *tmp = GetTree();
+  if (tmp == NULL)
+    ActiveCellNumber = -1;
+  if (ActiveCellNumber > 0)
+  {
+    while ((tmp) && (tmp != cursorCell))
+    {
+      tmp = tmp->GetNext();
+      ActiveCellNumber++;
+    }
+  }
+  // Paranoia: What happens if we didn't find the cursor?
+  if (tmp == NULL) ActiveCellNumber = -1;
+
+  // If we know where the cursor was we save this piece of information.
+  // If not we omit it.
+  if (ActiveCellNumber >= 0)
+    xmlText << wxString::Format(wxT(" activecell=\"%li\""), ActiveCellNumber);
+
+
+  // Save the variables list for the "variables" sidepane.
+  wxArrayString variables = m_variablesPane->GetVarnames();
+  if(variables.GetCount() > 1)
+  {
+    long varcount = variables.GetCount() - 1;
+    xmlText += wxString::Format(" variables_num=\"%li\"", varcount);
+    for(unsigned long i = 0; i<variables.GetCount(); i++)
+      xmlText += wxString::Format(" variables_%li=\"%s\"", i, Cell::XMLescape(variables[i]).utf8_str());
+  }
+
+  xmlText << ">\n";
+  return xmlText;
+}
+
+std::unique_ptr<WXMXSnapshot> Worksheet::TakeWXMXSnapshot()
+{
+  wxString xmlText = WXMXContentHeader();
+
+  // Reset image counter
+  m_cellPointers.WXMXResetCounter();
+
+  if (GetTree())
+    GetTree()->AppendListXML(xmlText);
+
+  // Delete all but one control character from the string: there should be
+  // no way for them to enter this string, anyway. But sometimes they still
+  // do...
+  for (wxString::const_iterator it = xmlText.begin(); it != xmlText.end(); ++it)
+  {
+    wxChar c = *it;
+    if ((c < wxT('\t')) ||
+        ((c > wxT('\n')) && (c < wxT(' '))) ||
+        (c == wxChar((char) 0x7F))
+      )
+    {
+      // *it = wxT(' ');
+    }
+  }
+
+  xmlText +=  wxT("\n</wxMaximaDocument>");
+
+  std::unique_ptr<WXMXSnapshot> snapshot(
+    new WXMXSnapshot(xmlText, m_cellPointers.WXMXFiles(), m_cellPointers.WXMXImageCount(),
+                     m_generation));
+  // From now on the snapshot holds the references to the cells' data
+  m_cellPointers.WXMXResetCounter();
+  return snapshot;
+}
+
 /*
   Save the data as wxmx file
 
@@ -6453,361 +7045,134 @@ bool Worksheet::ExportToMAC(wxString file)
   since the last save. Then the original .wxmx file is replaced in a
   (hopefully) atomic operation.
 */
-bool Worksheet::ExportToWXMX(wxString file, bool markAsSaved)
+bool Worksheet::ExportToWXMX(wxString file, bool markAsSaved, AutosaveJournal *journal)
 {
   #ifdef OPENMP
   #if OPENMP_VER >= 201511
   #pragma omp taskwait
   #endif
   #endif
+  // A background save might still be writing to the backup file. Its result
+  // has to be handled by whoever has started it before we save anything else:
+  // The frame does so on receiving the event the background save sends.
+  if (m_backgroundSave)
+  {
+    WaitForBackgroundSave();
+    wxThreadEvent event(wxEVT_THREAD, wxID_ANY);
+    ProcessWindowEvent(event);
+    // Nobody has handled the result
+    if (m_backgroundSave)
+      FinishBackgroundSave();
+  }
   // Show a busy cursor as long as we export a file.
   wxBusyCursor crs;
   // Don't update the worksheet whilst exporting
   wxWindowUpdateLocker noUpdates(this);
   wxLogMessage(_("Starting to save the worksheet as .wxmx"));
-  // delete temp file if it already exists
-  wxString backupfile = file + wxT("~");
-  if (wxFileExists(backupfile))
-  {
-    if (!wxRemoveFile(backupfile))
-      return false;
-  }
+  std::unique_ptr<WXMXSnapshot> snapshot = TakeWXMXSnapshot();
+  return FinishWXMXExport(*snapshot, snapshot->Write(file), file, markAsSaved, journal);
+}
+
+bool Worksheet::FinishWXMXExport(const WXMXSnapshot &snapshot, WXMXSnapshot::Result result,
+                                 const wxString &file, bool markAsSaved, AutosaveJournal *journal)
+{
+  switch (result)
   {
-    wxFFileOutputStream out(backupfile);
-    if (!out.IsOk())
-      return false;
+  case WXMXSnapshot::invalidXML:
+    // We can still put the erroneous data into the clipboard for debugging purposes.
+    if (wxTheClipboard->Open())
     {
-      wxZipOutputStream zip(out);
-      if (!zip.IsOk())
-        return false;
-      {
-        wxTextOutputStream output(zip);
-
-        /* The first zip entry is a file named "mimetype": This makes sure that the mimetype
-           is always stored at the same position in the file. This is common practice. One
-           example from an ePub file:
-
-           00000000  50 4b 03 04 14 00 00 08  00 00 cd bd 0a 43 6f 61  |PK...........Coa|
-           00000010  ab 2c 14 00 00 00 14 00  00 00 08 00 00 00 6d 69  |.,............mi|
-           00000020  6d 65 74 79 70 65 61 70  70 6c 69 63 61 74 69 6f  |metypeapplicatio|
-           00000030  6e 2f 65 70 75 62 2b 7a  69 70 50 4b 03 04 14 00  |n/epub+zipPK....|
-
-        */
-
-        // Make sure that the mime type is stored as plain text.
-        //
-        // We will keep that setting for the rest of the file for the following reasons:
-        //  - Compression of the .zip file won't improve compression of the embedded .png images
-        //  - The text part of the file is too small to justify compression
-        //  - not compressing the text part of the file allows version control systems to
-        //    determine which lines have changed and to track differences between file versions
-        //    efficiently (in a compressed text virtually every byte might change when one
-        //    byte at the start of the uncompressed original is)
-        //  - and if anything crashes in a bad way chances are high that the uncompressed
-        //    contents of the .wxmx file can be rescued using a text editor.
-        //  Who would - under these circumstances - care about a kilobyte?
-        zip.SetLevel(0);
-        zip.PutNextEntry(wxT("mimetype"));
-        output << wxT("text/x-wxmathml");
-        zip.CloseEntry();
-        zip.PutNextEntry(wxT("format.txt"));
-        output << wxT(
-          "\n\nThis file contains a wxMaxima session in the .wxmx format.\n"
-          ".wxmx files are .xml-based files contained in a .zip container like .odt\n"
-          "or .docx files. After changing their name to end in .zip the .xml and\n"
-          "eventual bitmap files inside them can be extracted using any .zip file\n"
-          "viewer.\n"
-          "The reason why part of a .wxmx file still might still seem to make sense in a\n"
-          "ordinary text viewer is that the text portion of .wxmx by default\n"
-          "isn't compressed: The text is typically small and compressing it would\n"
-          "mean that changing a single character would (with a high probability) change\n"
-          "big parts of the  whole contents of the compressed .zip archive.\n"
-          "Even if version control tools like git and svn that remember all changes\n"
-          "that were ever made to a file can handle binary files compression would\n"
-          "make the changed part of the file bigger and therefore seriously reduce\n"
-          "the efficiency of version control\n\n"
-          "wxMaxima can be downloaded from https://github.com/wxMaxima-developers/wxmaxima.\n"
-          "It also is part of the windows installer for maxima\n"
-          "(https://wxmaxima-developers.github.io/wxmaxima/).\n\n"
-          "If a .wxmx file is broken but the content.xml portion of the file can still be\n"
-          "viewed using an text editor just save the xml's text as \"content.xml\"\n"
-          "and try to open it using a recent version of wxMaxima.\n"
-          "If it is valid XML (the XML header is intact, all opened tags are closed again,\n"
-          "the text is saved with the text encoding \"UTF8 without BOM\" and the few\n"
-          "special characters XML requires this for are properly escaped)\n"
-          "chances are high that wxMaxima will be able to recover all code and text\n"
-          "from the XML file.\n\n"
-          );
-        zip.CloseEntry();
-
-        // next zip entry is "content.xml", xml of GetTree()
-
-        zip.PutNextEntry(wxT("content.xml"));
-        wxString xmlText;
-
-        xmlText << wxT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-        xmlText << wxT("\n<!--   Created using wxMaxima ") << wxT(GITVERSION) << wxT("   -->");
-        xmlText << wxT("\n<!--https://wxMaxima-developers.github.io/wxmaxima/-->\n");
-
-        // write document
-        xmlText << wxT("\n<wxMaximaDocument version=\"");
-        xmlText << DOCUMENT_VERSION_MAJOR << wxT(".");
-        xmlText << DOCUMENT_VERSION_MINOR << wxT("\" zoom=\"");
-        xmlText << int(100.0 * m_configuration->GetZoomFactor()) << wxT("\"");
-
-        // **************************************************************************
-        // Find out the number of the cell the cursor is at and save this information
-        // if we find it
-
-        // Determine which cell the cursor is at.
-        long ActiveCellNumber = 1;
-        GroupCell *cursorCell = NULL;
-        if (m_hCaretActive)
-        {
-          cursorCell = GetHCaret();
-
-          // If the cursor is before the 1st cell in the worksheet the cell number
-          // is 0.
-          if (!cursorCell)
-            ActiveCellNumber = 0;
-        }
-        else
-        {
-          if (GetActiveCell())
-            cursorCell = dynamic_cast<GroupCell *>(GetActiveCell()->GetGroup());
-        }
-
-        if (cursorCell == NULL)
-          ActiveCellNumber = 0;
-        // We want to save the information that the cursor is in the nth cell.
-        // Count the cells until then.
-        GroupCell *tmp = GetTree();
-        if (tmp == NULL)
-          ActiveCellNumber = -1;
-        if (ActiveCellNumber > 0)
-        {
-          while ((tmp) && (tmp != cursorCell))
-          {
-            tmp = tmp->GetNext();
-            ActiveCellNumber++;
-          }
-        }
-        // Paranoia: What happens if we didn't find the cursor?
-        if (tmp == NULL) ActiveCellNumber = -1;
-
-        // If we know where the cursor was we save this piece of information.
-        // If not we omit it.
-        if (ActiveCellNumber >= 0)
-          xmlText << wxString::Format(wxT(" activecell=\"%li\""), ActiveCellNumber);
-
-
-        // Save the variables list for the "variables" sidepane.
-        wxArrayString variables = m_variablesPane->GetVarnames();
-        if(variables.GetCount() > 1)
-        {
-          long varcount = variables.GetCount() - 1;
-          xmlText += wxString::Format(" variables_num=\"%li\"", varcount);
-          for(unsigned long i = 0; i<variables.GetCount(); i++)
-            xmlText += wxString::Format(" variables_%li=\"%s\"", i, Cell::XMLescape(variables[i]).utf8_str());
-        }
-  
-        xmlText << ">\n";
+      wxDataObjectComposite *data = new wxDataObjectComposite;
+      data->Add(new wxTextDataObject(snapshot.GetContent()));
+      wxTheClipboard->SetData(data);
+      wxLogMessage(_("Produced invalid XML. The erroneous XML data has therefore not been saved but has been put on the clipboard in order to allow to debug it."));
+    }
+    return false;
+  case WXMXSnapshot::failed:
+    return false;
+  case WXMXSnapshot::saved:
+    break;
+  }
 
-        // Reset image counter
-        m_cellPointers.WXMXResetCounter();
+  // Changes that have been made while the file was written in the background
+  // aren't contained in it.
+  if (markAsSaved && (snapshot.GetGeneration() == m_generation))
+    SetSaved(true);
+  // An autosave journal that continues this file needs to know what it contains
+  if (journal != NULL)
+    journal->Start(file, snapshot.GetFiles(), snapshot.GetImageCounter());
+  return true;
+}
 
-        if (GetTree())
-          xmlText += GetTree()->ListToXML();
+bool Worksheet::ExportToWXMXInBackground(wxString file, bool markAsSaved, AutosaveJournal *journal)
+{
+  // The result of the last background save hasn't been handled yet.
+  if (m_backgroundSave)
+    return false;
 
-        // Delete all but one control character from the string: there should be
-        // no way for them to enter this string, anyway. But sometimes they still
-        // do...
-        for (wxString::const_iterator it = xmlText.begin(); it != xmlText.end(); ++it)
-        {
-          wxChar c = *it;
-          if ((c < wxT('\t')) ||
-              ((c > wxT('\n')) && (c < wxT(' '))) ||
-              (c == wxChar((char) 0x7F))
-            )
-          {
-            // *it = wxT(' ');
-          }
-        }
+  wxLogMessage(_("Starting to save the worksheet as .wxmx in the background"));
+  m_backgroundSave = std::unique_ptr<BackgroundSave>(
+    new BackgroundSave(TakeWXMXSnapshot(), file, markAsSaved, journal));
 
-        xmlText +=  wxT("\n</wxMaximaDocument>");
+  BackgroundSave *save = m_backgroundSave.get();
+  #ifdef HAVE_OPENMP_TASKS
+  #pragma omp task
+  #endif
+  BackgroundSave_Backgroundtask(save);
+  return true;
+}
 
-        {
-          // Prepare reading the files we have stored in memory
-          std::unique_ptr<wxFileSystem> fsystem(new wxFileSystem);
-          fsystem->AddHandler(new wxMemoryFSHandler);
-          fsystem->ChangePathTo(wxT("memory:"), true);
-
-          // In wxWidgets 3.1.1 fsystem->FindFirst crashes if we don't have a file
-          // in the memory filesystem => Let's create a file just to make sure
-          // one exists.
-          wxMemoryBuffer dummyBuf;
-          wxMemoryFSHandler::AddFile("dummyfile",
-                                     dummyBuf.GetData(),
-                                     dummyBuf.GetDataLen());
-
-          // Let wxWidgets test if the document can be read again by the XML parser before
-          // the user finds out the hard way.
-          {
-            wxXmlDocument doc;
-            {
-              wxMemoryOutputStream ostream;
-              wxTextOutputStream txtstrm(ostream);
-              txtstrm.WriteString(xmlText);
-              wxMemoryInputStream istream(ostream);
-              doc.Load(istream);
-            }
+void Worksheet::BackgroundSave_Backgroundtask(BackgroundSave *save)
+{
+  save->m_result = save->m_snapshot->Write(save->m_file);
+  save->m_done = true;
+  // Let the main thread handle the result
+  wxQueueEvent(this, new wxThreadEvent(wxEVT_THREAD, wxID_ANY));
+}
 
-            // If we fail to load the document we abort the safe process as it will
-            // only destroy data.
-            // But we can still put the erroneous data into the clipboard for debugging purposes.
-            if (!doc.IsOk())
-            {
-              if (wxTheClipboard->Open())
-              {
-                wxDataObjectComposite *data = new wxDataObjectComposite;
-                data->Add(new wxTextDataObject(xmlText));
-                wxTheClipboard->SetData(data);
-                wxLogMessage(_("Produced invalid XML. The erroneous XML data has therefore not been saved but has been put on the clipboard in order to allow to debug it."));
-              }
+bool Worksheet::BackgroundSaveDone() const
+{
+  return m_backgroundSave && m_backgroundSave->m_done;
+}
 
-              // Remove all files from our internal filesystem
-              wxString memFsName = fsystem->FindFirst("*", wxFILE);
-              while(memFsName != wxEmptyString)
-              {
-                wxString name = memFsName.Right(memFsName.Length()-7);
-                wxMemoryFSHandler::RemoveFile(name);
-                memFsName = fsystem->FindNext();
-              }
-              return false;
-            }
-          }
+void Worksheet::WaitForBackgroundSave()
+{
+  if (!m_backgroundSave)
+    return;
+  #ifdef HAVE_OPENMP_TASKS
+  #pragma omp taskwait
+  #endif
+}
 
-          // wxWidgets could pretty-print the XML document now. But as no-one will
-          // look at it, anyway, there might be no good reason to do so.
-          if (GetTree() != NULL)output << xmlText;
+bool Worksheet::FinishBackgroundSave()
+{
+  if (!m_backgroundSave)
+    return false;
+  WaitForBackgroundSave();
 
-          // Move all files we have stored in memory during saving to zip file
-          wxString memFsName = fsystem->FindFirst("*", wxFILE);
-          while(memFsName != wxEmptyString)
-          {
-            wxString name = memFsName.Right(memFsName.Length()-7);
-            if(name != wxT("dummyfile"))
-            {
-              zip.CloseEntry();
+  std::unique_ptr<BackgroundSave> save(std::move(m_backgroundSave));
+  return FinishWXMXExport(*save->m_snapshot, save->m_result, save->m_file,
+                          save->m_markAsSaved, save->m_journal);
+}
 
-              wxFSFile *fsfile;
-#ifdef HAVE_OPENMP_TASKS
-#pragma omp critical (OpenFSFile)
-#endif
-              fsfile = fsystem->OpenFile(memFsName);
+bool Worksheet::AppendToAutosaveJournal(AutosaveJournal &journal)
+{
+  wxLogMessage(_("Appending the changes to the autosave journal"));
 
-              if (fsfile)
-              {
-                // The data for gnuplot is likely to change in its entirety if it
-                // ever changes => We can store it in a compressed form.
-                if(name.EndsWith(wxT(".data")))
-                  zip.SetLevel(9);
-                else
-                  zip.SetLevel(0);
-
-                zip.PutNextEntry(name);
-                std::unique_ptr<wxInputStream> imagefile(fsfile->GetStream());
-
-                while (!(imagefile->Eof()))
-                  imagefile->Read(zip);
-              }
-            }
-            wxMemoryFSHandler::RemoveFile(name);
-            memFsName = fsystem->FindNext();
-          }
-        }
-      }
-      if(!zip.Close())
-        return false;
-    }
-    if (!out.Close())
-      return false;
-  }
-  // If all data is saved now we can overwrite the actual save file.
-  // We will try to do so a few times if we suspect a MSW virus scanner or similar
-  // temporarily hindering us from doing so.
-  
-  // The following line is paranoia as closing (and thus writing) the file has
-  // succeeded.
-  if(!wxFileExists(backupfile))
-    return false;
-  
-  // Now we try to open the file in order to see if saving hasn't failed
-  // without returning an error - which can apparently happen on MSW.
-  wxString wxmxURI = wxURI(wxT("file://") + backupfile).BuildURI();
-  wxmxURI.Replace("#", "%23");
-#ifdef  __WXMSW__
-  // Fixes a missing "///" after the "file:". This works because we always get absolute
-  // file names.
-  wxRegEx uriCorector1("^file:([a-zA-Z]):");
-  wxRegEx uriCorector2("^file:([a-zA-Z][a-zA-Z]):");
-  uriCorector1.ReplaceFirst(&wxmxURI,wxT("file:///\\1:"));
-  uriCorector2.ReplaceFirst(&wxmxURI,wxT("file:///\\1:"));
-#endif
-  // The URI of the wxm code contained within the .wxmx file
-  wxString filename = wxmxURI + wxT("#zip:content.xml");
+  // Images the journal already knows keep their names, and new ones mustn't
+  // get the name of an image that is already stored.
+  m_cellPointers.WXMXResetCounter(journal.ImageCounter());
+  m_cellPointers.WXMXSetKnownImages(&journal.KnownImages());
+  std::vector<wxString> cells;
+  for (GroupCell *cell = GetTree(); cell != NULL; cell = cell->GetNext())
+    cells.push_back(cell->ToXML());
+  m_cellPointers.WXMXSetKnownImages(NULL);
 
-  // Open the file we have saved yet just in order to see if we
-  // actually managed to save it correctly.
-  {
-    wxFileSystem fs;
-    wxFSFile *fsfile;
-#ifdef HAVE_OPENMP_TASKS
-#pragma omp critical (OpenFSFile)
-#endif
-    fsfile = fs.OpenFile(filename);
-    
-    // Did we succeed in opening the file?
-    if (!fsfile)
-    {
-      wxLogMessage(_(wxT("Saving succeeded, but the file could not be read again \u21D2 Not replacing the old saved file.")));
-      return false;
-    }
-    wxDELETE(fsfile);
-  }
-  
-  {
-    bool done;
-    SuppressErrorDialogs suppressor;
-    done = wxRenameFile(backupfile, file, true);
-    if(!done)
-    {
-      // We might have failed to move the file because an over-eager virus scanner wants to
-      // scan it and a design decision of a filesystem driver might hinder us from moving
-      // it during this action => Wait for a second and retry.
-      wxSleep(1);
-      done = wxRenameFile(backupfile, file, true);
-    }
-    if(!done)
-    {
-      // We might have failed to move the file because an over-eager virus scanner wants to
-      // scan it and a design decision of a filesystem driver might hinder us from moving
-      // it during this action => Wait for a second and retry.
-      wxSleep(1);
-      done = wxRenameFile(backupfile, file, true);
-    }
-    if(!done)
-    {
-      wxSleep(1);
-      if (!wxRenameFile(backupfile, file, true))
-        return false;
-    }
-    if (markAsSaved)
-      SetSaved(true);
-    
-    wxLogMessage(_("wxmx file saved"));
-  }
-  return true;
+  bool saved = journal.Append(WXMXContentHeader(), cells, m_cellPointers.WXMXFiles(),
+                              m_cellPointers.WXMXImageCount());
+  // Release our references to the cells' data
+  m_cellPointers.WXMXResetCounter();
+  return saved;
 }
 
 bool Worksheet::CanEdit()
@@ -6846,7 +7211,7 @@ void Worksheet::OnDoubleClick(wxMouseEvent &WXUNUSED(event))
 
   RequestRedraw();
 // Re-calculate the table of contents
-  UpdateTableOfContents();
+  UpdateTableOfContents(false);
 }
 
 bool Worksheet::ActivatePrevInput()
@@ -8279,12 +8644,14 @@ bool Worksheet::FindNext(wxString str, bool down, bool ignoreCase, bool warn)
   GroupCell *start = pos;
 
   bool wrappedSearch = false;
+  wxString needle = EditorCell::SearchNeedle(str);
 
   while ((pos != start) || (!wrappedSearch))
   {
     EditorCell *editor = dynamic_cast<EditorCell *>(pos->GetEditable());
 
-    if (editor != NULL)
+    // Only cells that might contain the string are actually searched.
+    if ((editor != NULL) && (editor->MightContain(needle)))
     {
       bool found = editor->FindNext(str, down, ignoreCase);
 
@@ -8295,7 +8662,7 @@ bool Worksheet::FindNext(wxString str, bool down, bool ignoreCase, bool warn)
         SetActiveCell(editor);
         editor->SetSelection(strt, end);
         ScrollToCaret();
-        UpdateTableOfContents();
+        UpdateTableOfContents(false);
         RequestRedraw();
         if ((wrappedSearch) && warn)
         {
@@ -8421,6 +8788,7 @@ int Worksheet::ReplaceAll(wxString oldString, wxString newString, bool ignoreCas
     return 0;
 
   int count = 0;
+  wxString needle = EditorCell::SearchNeedle(oldString);
 
   GroupCell *tmp = GetTree();
 
@@ -8428,7 +8796,7 @@ int Worksheet::ReplaceAll(wxString oldString, wxString newString, bool ignoreCas
   {
     EditorCell *editor = dynamic_cast<EditorCell *>(tmp->GetEditable());
 
-    if (editor != NULL)
+    if ((editor != NULL) && (editor->MightContain(needle)))
     {
       int replaced = editor->ReplaceAll(oldString, newString, ignoreCase);
       if (replaced > 0)
@@ -8452,6 +8820,21 @@ int Worksheet::ReplaceAll(wxString oldString, wxString newString, bool ignoreCas
   return count;
 }
 
+int Worksheet::CountMatches(wxString str, bool ignoreCase)
+{
+  int count = 0;
+  wxString needle = EditorCell::SearchNeedle(str);
+  GroupCell *tmp = GetTree();
+  while (tmp != NULL)
+  {
+    EditorCell *editor = dynamic_cast<EditorCell *>(tmp->GetEditable());
+    if ((editor != NULL) && (editor->MightContain(needle)))
+      count += editor->CountMatches(str, ignoreCase);
+    tmp = tmp->GetNext();
+  }
+  return count;
+}
+
 bool Worksheet::Autocomplete(AutoComplete::autoCompletionType type)
 {
   EditorCell *editor = GetActiveCell();
@@ -35,7 +35,11 @@
 #include <wx/textfile.h>
 #include <wx/fdrepdlg.h>
 #include <wx/dc.h>
+#include <wx/stopwatch.h>
 #include <list>
+#include <functional>
+#include <atomic>
+#include <memory>
 
 #include "VariablesPane.h"
 #include "Notification.h"
@@ -45,9 +49,12 @@
 #include "EvaluationQueue.h"
 #include "FindReplaceDialog.h"
 #include "Autocomplete.h"
+#include "AutosaveJournal.h"
+#include "WXMXSnapshot.h"
 #include "AutocompletePopup.h"
 #include "TableOfContents.h"
 #include "UnicodeSidebar.h"
+#include "HelpAnchors.h"
 #include "ToolBar.h"
 
 /*! The canvas that contains the spreadsheet the whole program is about.
@@ -97,6 +104,11 @@ private:
   Configuration m_configurationTopInstance;
   //! The rectangle we need to refresh. -1 as "left" coordinate means: No rectangle
   wxRect m_rectToRefresh;
+  /*! The part of the worksheet whose GroupCells' offscreen images are outdated
+
+    -1 as "left" coordinate means: None.
+   */
+  wxRect m_staleTiles;
   /*! The size of a scroll step
 
     Defines the size of a
@@ -126,7 +138,7 @@ private:
   //! A second way to publish RTF data on the clipboard
   static wxDataFormat m_rtfFormat2;
 
-  WX_DECLARE_STRING_HASH_MAP(wxString, HelpFileAnchors);
+  typedef HelpAnchors::AnchorMap HelpFileAnchors;
   /*! An object that can be filled with MathML data for the clipboard
    */
   class MathMLDataObject : public wxCustomDataObject
@@ -193,6 +205,11 @@ private:
   long m_lastTop;
   //! The last ending for the area being drawn
   long m_lastBottom;
+  /*! Incremented on each request to redraw the whole worksheet
+
+    Offscreen images of GroupCells drawn for an older generation are outdated.
+   */
+  long m_tileGeneration;
   /*! \defgroup UndoBufferFill Undo methods for cell additions/deletions:
 
     Each EditorCell has its own private undo buffer Additionally wxMaxima
@@ -395,7 +412,8 @@ private:
   enum TimerIDs
   {
     TIMER_ID,
-    CARET_TIMER_ID
+    CARET_TIMER_ID,
+    REDRAW_TIMER_ID
   };
 
   //! Add a line to a file.
@@ -448,6 +466,21 @@ private:
    */
   void OnPaint(wxPaintEvent &event);
 
+  /*! Can the GroupCell be drawn by blitting an offscreen image of it?
+
+    Not the case for cells that change on every keypress or output line or
+    that contain a selection that is drawn behind their contents.
+   */
+  bool CanDrawFromTile(GroupCell *group);
+
+  /*! Draw a GroupCell by blitting its offscreen image to the current DC
+
+    Redraws the offscreen image first if it is missing or outdated.
+    \return false, if no offscreen image could be created. In this case the
+    caller has to draw the cell directly.
+   */
+  bool DrawFromTile(GroupCell *group, wxPoint point);
+
   void OnSize(wxSizeEvent &event);
 
   void OnMouseRightDown(wxMouseEvent &event);
@@ -582,13 +615,68 @@ private:
   wxTimer m_timer;
   //! The cursor blink rate. Also the timeout for redrawing the worksheet
   wxTimer m_caretTimer;
+  //! Issues a redraw that was delayed in order not to exceed the display's frame rate
+  wxTimer m_redrawTimer;
+  //! The time since the last redraw was issued
+  wxStopWatch m_sinceLastRedraw;
+  //! The display's frame interval [ms]. Output isn't redrawn more often than that.
+  long m_frameInterval;
+  //! Determine the frame interval of the display the worksheet is on
+  void UpdateFrameInterval();
+  //! Measures the intervals the paint statistics are collected over
+  wxStopWatch m_paintStatsStopWatch;
+  //! The number of paints in the current statistics interval
+  long m_paintsInInterval;
+  //! The number of pixels repainted in the current statistics interval
+  long long m_pixelsInInterval;
+  //! The number of paints per second in the last statistics interval
+  double m_paintsPerSecond;
+  //! The number of pixels per second repainted in the last statistics interval
+  double m_pixelsPerSecond;
+  //! The number of paints since the worksheet was created
+  long long m_paintsTotal;
+  //! The number of pixels repainted since the worksheet was created
+  long long m_pixelsTotal;
+  //! Update the paint statistics after the rectangle rect has been repainted
+  void AccountForPaint(wxRect rect);
   //! True if no changes have to be saved.
   bool m_saved;
+  /*! Is increased every time the document is modified
+
+    Tells if a snapshot that has been saved in the background still is the
+    current state of the document.
+   */
+  unsigned long m_generation;
   AutoComplete *m_autocomplete;
   wxArrayString m_completions;
   bool m_autocompleteTemplates;
   AutocompletePopup *m_autocompletePopup;
 
+  //! A save that is being written by a background thread
+  struct BackgroundSave
+  {
+    BackgroundSave(std::unique_ptr<WXMXSnapshot> snapshot, const wxString &file,
+                   bool markAsSaved, AutosaveJournal *journal) :
+      m_snapshot(std::move(snapshot)), m_file(file), m_markAsSaved(markAsSaved),
+      m_journal(journal), m_result(WXMXSnapshot::failed), m_done(false){}
+    std::unique_ptr<WXMXSnapshot> m_snapshot;
+    wxString m_file;
+    bool m_markAsSaved;
+    AutosaveJournal *m_journal;
+    //! Only valid once m_done is true
+    WXMXSnapshot::Result m_result;
+    std::atomic<bool> m_done;
+  };
+  //! The background save whose result hasn't been handled yet, if any
+  std::unique_ptr<BackgroundSave> m_backgroundSave;
+  //! Writes the file of a background save. Is run in a background thread.
+  void BackgroundSave_Backgroundtask(BackgroundSave *save);
+  //! Convert the document to XML and collect the files that belong to it
+  std::unique_ptr<WXMXSnapshot> TakeWXMXSnapshot();
+  //! The part of saving a .wxmx file that needs to be done in the main thread
+  bool FinishWXMXExport(const WXMXSnapshot &snapshot, WXMXSnapshot::Result result,
+                        const wxString &file, bool markAsSaved, AutosaveJournal *journal);
+
 public:
   //! Is this worksheet empty?
   bool IsEmpty()
@@ -687,10 +775,15 @@ public:
 
     This function actually only schedules the update of the table-of-contents-tab.
     The actual update is done when wxMaxima is idle.
+
+    \param rescan false means: No headings have been added or removed in a way
+    InsertGroupCells() or DeleteRegion() wouldn't have told the table of contents.
    */
-  void UpdateTableOfContents()
+  void UpdateTableOfContents(bool rescan = true)
   {
     m_scheduleUpdateToc = true;
+    if (rescan)
+      m_scheduleTocRescan = true;
   }
 
   /*! Handle redrawing the worksheet or of parts of it
@@ -718,8 +811,10 @@ public:
   /*! Redraw the worksheet if RequestRedraw() has been called.
 
     Also handles setting tooltips and redrawing the brackets on mouse movements.
+    \param force true means: Redraw now even if maxima is sending output and the
+    last redraw was less than a frame ago.
    */
-  bool RedrawIfRequested();
+  bool RedrawIfRequested(bool force = false);
 
   /*! Request the worksheet to be redrawn
 
@@ -729,7 +824,9 @@ public:
 
     The actual redraw is done in the idle loop which means that as many redraw
     actions are merged as is necessary to allow wxMaxima to process things in
-    real time.
+    real time. Only the part of the worksheet starting with the upmost of the
+    cells is refreshed and while maxima is sending output the worksheet isn't
+    redrawn more often than the display can show.
 
     \return true, if we did redraw a workscreet portion.
    */
@@ -738,20 +835,31 @@ public:
 
     \param rect The rectangle that is to be requested to be redrawn. If this
     function is called multiple times the rectangles are automatically merged.
+    \param contentsChanged false means: Only the cursor has changed, the
+    offscreen images of the GroupCells in this rectangle are still valid.
 
     The actual redraw is done in the idle loop which means that as many redraw
     actions are merged as is necessary to allow wxMaxima to process things in
     real time.
    */
-  void RequestRedraw(wxRect rect);
+  void RequestRedraw(wxRect rect, bool contentsChanged = true);
 
   //! Redraw the window now and mark any pending redraw request as "handled".
   void ForceRedraw()
   {
     RequestRedraw();
-    RedrawIfRequested();
+    RedrawIfRequested(true);
   }
 
+  //! How often the worksheet was repainted per second during the last second with repaints
+  double GetPaintsPerSecond() const {return m_paintsPerSecond;}
+  //! How many pixels were repainted per second during the last second with repaints
+  double GetPixelsRepaintedPerSecond() const {return m_pixelsPerSecond;}
+  //! How often the worksheet has been repainted in total
+  long long GetPaintCount() const {return m_paintsTotal;}
+  //! How many pixels have been repainted in total
+  long long GetPixelsRepainted() const {return m_pixelsTotal;}
+
   //! Is a Redraw requested?
   bool RedrawRequested()
     { return (m_redrawRequested || m_mouseMotionWas || (m_rectToRefresh.GetLeft() != -1)); }
@@ -787,6 +895,11 @@ public:
     used by UpdateTableOfContents() and the idle task.
   */
   bool m_scheduleUpdateToc;
+  /*! True = the update of the table of contents needs to scan the whole worksheet
+
+    Not needed if only the cursor has moved or a heading's text has changed.
+   */
+  bool m_scheduleTocRescan;
 
   //! Is the vertically-drawn cursor active?
   bool HCaretActive()
@@ -1112,8 +1225,13 @@ public:
 
   void CalculateReorderedCellIndices(Cell *tree, int &cellIndex, std::vector<int> &cellMap);
 
-  //! Export the file to an html document
-  bool ExportToHTML(wxString file);
+  /*! Export the file to an html document
+
+    \param file The name of the html file
+    \param progress If not empty: Is called with the number of group cells
+           that have been exported so far and the total number of group cells
+   */
+  bool ExportToHTML(wxString file, std::function<void(long, long)> progress = nullptr);
 
   /*! Export a region of the file to a .wxm or .mac file maxima's load command can read
 
@@ -1125,12 +1243,72 @@ public:
   //! Export the file to a text file maxima's load command can read
   bool ExportToMAC(wxString file);
 
+  /*! Export the time maxima and wxMaxima needed for each code cell
+
+    \param file The file name. If it ends in ".json" a JSON array is written,
+    otherwise comma-separated values.
+   */
+  bool ExportEvaluationStats(wxString file);
+
+  //! A human-readable report of how much memory the cells of each type occupy
+  wxString MemoryUsageReport();
+
+  /*! Draw the whole worksheet into a DC that isn't the screen
+
+    Used by the --benchmark mode that measures how long drawing takes
+    without needing a visible window.
+   */
+  void DrawOffscreen(wxDC &dc);
+
   /*! export to xml compatible file
+
+    A background save that is still pending is waited for and its result is
+    handled first, see ExportToWXMXInBackground().
     \param file The file name
     \param markAsSaved false means that this action doesn't clear the
                              worksheet's "modified" status.
+    \param journal If not NULL: The autosave journal that is to be started
+                   for this file once it is saved
   */
-  bool ExportToWXMX(wxString file, bool markAsSaved = true);
+  bool ExportToWXMX(wxString file, bool markAsSaved = true, AutosaveJournal *journal = NULL);
+
+  /*! Save the document as .wxmx without blocking the user interface
+
+    Only the snapshot of the document is taken at once. Writing it is done in
+    a background thread that sends a wxEVT_THREAD event to the worksheet when it
+    is done. FinishBackgroundSave() then has to be called in order to learn
+    if saving has worked.
+
+    \return false if the result of the last background save hasn't been
+            handled by FinishBackgroundSave(), yet.
+   */
+  bool ExportToWXMXInBackground(wxString file, bool markAsSaved = true,
+                                AutosaveJournal *journal = NULL);
+
+  //! Has a background save been started whose result hasn't been handled yet?
+  bool BackgroundSavePending() const {return m_backgroundSave.get() != NULL;}
+
+  //! Has the background save finished writing the file?
+  bool BackgroundSaveDone() const;
+
+  //! Wait until the background save has finished writing the file
+  void WaitForBackgroundSave();
+
+  /*! Handle the result of a background save, waiting for it if necessary
+
+    \return true if the file has been saved.
+   */
+  bool FinishBackgroundSave();
+
+  /*! Autosave only the cells and images that have changed since the last autosave
+
+    Much faster than ExportToWXMX() for big documents as the unchanged images
+    and cells aren't written again.
+   */
+  bool AppendToAutosaveJournal(AutosaveJournal &journal);
+
+  //! The start of content.xml up to and including the \<wxMaximaDocument\> tag
+  wxString WXMXContentHeader();
 
   //! The start of a RTF document
   wxString RTFStart();
@@ -1326,12 +1504,16 @@ public:
   { return m_saved; }
 
   void SetSaved(bool saved)
-  { m_saved = saved; }
+  {
+    if(!saved)
+      m_generation++;
+    m_saved = saved;
+  }
 
   void OutputChanged()
     {
       if(m_currentFile.EndsWith(".wxmx"))
-        m_saved = false;
+        SetSaved(false);
     }
 
   void RemoveAllOutput();
@@ -1426,6 +1608,12 @@ public:
    */
   int ReplaceAll(wxString oldString, wxString newString, bool ignoreCase);
 
+  /*! The number of times the input and text cells contain a string
+
+    Cells that cannot contain the string are skipped without searching them.
+   */
+  int CountMatches(wxString str, bool ignoreCase);
+
   wxString GetInputAboveCaret();
 
   wxString GetOutputAboveCaret();
@@ -29,29 +29,91 @@
 #include "XmlInspector.h"
 
 #include <wx/sizer.h>
-#include <wx/regex.h>
-
-XmlInspector::XmlInspector(wxWindow *parent, int id) : wxRichTextCtrl(parent, id,
-                                                                      wxEmptyString,
-                                                                      wxDefaultPosition,
-                                                                      wxSize(wxSystemSettings::GetMetric ( wxSYS_SCREEN_X )/10,
-                    wxSystemSettings::GetMetric ( wxSYS_SCREEN_Y )/10),
-                                                                      wxTE_READONLY |
-                                                                      wxTE_RICH |
-                                                                      wxHSCROLL |
-                                                                      wxTE_MULTILINE)
+
+XmlInspector::XmlInspector(wxWindow *parent, int id, Configuration **config) :
+  wxPanel(parent, id, wxDefaultPosition,
+          wxSize(wxSystemSettings::GetMetric ( wxSYS_SCREEN_X )/10,
+                 wxSystemSettings::GetMetric ( wxSYS_SCREEN_Y )/10))
 {
+  m_configuration = config;
+  m_list = new LineList(this, XmlInspector_ctrl_id);
+  m_search = new wxTextCtrl(this, XmlInspector_regex_id, wxEmptyString,
+                            wxDefaultPosition, wxDefaultSize, wxTE_PROCESS_ENTER);
+  m_search->SetHint(_("Search"));
+
+  // A box whose 1st row is growable 
+  wxFlexGridSizer *box = new wxFlexGridSizer(1);
+  box->AddGrowableCol(0);
+  box->AddGrowableRow(0);
+  box->Add(m_list, wxSizerFlags().Expand());
+  box->Add(m_search, wxSizerFlags().Expand());
+  SetSizer(box);
+
+  Connect(XmlInspector_regex_id, wxEVT_TEXT, wxCommandEventHandler(XmlInspector::OnSearchText));
+  Connect(XmlInspector_regex_id, wxEVT_TEXT_ENTER, wxCommandEventHandler(XmlInspector::OnSearchEnter));
+  Connect(wxEVT_SIZE, wxSizeEventHandler(XmlInspector::OnSize));
+
   m_state = clear;
   m_indentLevel = 0;
-  BeginSuppressUndo();
+  m_lastChar = wxChar(0);
+  m_chars = 0;
+  m_lineOpen = false;
   XmlInspector::Clear();
-  wxRichTextCtrl::Clear();
 }
 
 XmlInspector::~XmlInspector()
 {
 }
 
+XmlInspector::LineList::LineList(XmlInspector *parent, int id) :
+  wxListCtrl(parent, id, wxDefaultPosition, wxDefaultSize,
+             wxLC_SINGLE_SEL | wxLC_REPORT | wxLC_NO_HEADER | wxLC_VIRTUAL)
+{
+  m_inspector = parent;
+  AppendColumn(wxEmptyString);
+  m_headerAttr.SetTextColour(wxColour(0,0,0));
+  m_toMaximaAttr.SetTextColour(wxColour(128,0,0));
+  m_tagAttr.SetTextColour(wxColour(0,128,0));
+  m_textAttr.SetTextColour(wxColour(0,0,128));
+}
+
+wxString XmlInspector::LineList::OnGetItemText(long item, long WXUNUSED(column)) const
+{
+  if((item < 0) || (item >= (long) m_inspector->m_lines.size()))
+    return wxEmptyString;
+  return m_inspector->m_lines[item].m_text;
+}
+
+wxListItemAttr *XmlInspector::LineList::OnGetItemAttr(long item) const
+{
+  if((item < 0) || (item >= (long) m_inspector->m_lines.size()))
+    return NULL;
+  const Line &line = m_inspector->m_lines[item];
+  switch(line.m_type)
+  {
+  case line_header:
+    return &m_headerAttr;
+  case line_toMaxima:
+    return &m_toMaximaAttr;
+  default:
+  {
+    // Tell XML tags from the text between them
+    wxString::const_iterator it = line.m_text.begin();
+    while((it != line.m_text.end()) && (*it == wxT(' ')))
+      ++it;
+    if((it != line.m_text.end()) && (*it == wxT('<')))
+      return &m_tagAttr;
+    return &m_textAttr;
+  }
+  }
+}
+
+void XmlInspector::OnSize(wxSizeEvent &event)
+{
+  m_list->SetColumnWidth(0, event.GetSize().x);
+  event.Skip();
+}
+
 void XmlInspector::Clear()
 {
   m_clear = true;
@@ -60,19 +122,95 @@ void XmlInspector::Clear()
   m_updateNeeded = true;
 }
 
+void XmlInspector::AddHeader(wxString text)
+{
+  if(!m_lines.empty())
+    m_lines.push_back(Line(wxEmptyString, line_header));
+  m_lines.push_back(Line(text, line_header));
+  m_lines.push_back(Line(wxEmptyString, line_header));
+  m_chars += text.Length();
+  m_lineOpen = false;
+}
+
+void XmlInspector::AddText(const wxString &text, lineType type)
+{
+  if(text.IsEmpty())
+    return;
+
+  size_t start = 0;
+  while(true)
+  {
+    size_t end = text.find(wxT('\n'), start);
+    wxString piece;
+    if(end == wxString::npos)
+      piece = text.substr(start);
+    else
+      piece = text.substr(start, end - start);
+
+    if(m_lineOpen && (!m_lines.empty()) && (m_lines.back().m_type == type))
+      m_lines.back().m_text += piece;
+    else
+      m_lines.push_back(Line(piece, type));
+    m_chars += piece.Length();
+
+    if(end == wxString::npos)
+    {
+      m_lineOpen = true;
+      break;
+    }
+    m_lineOpen = false;
+    start = end + 1;
+  }
+}
+
+size_t XmlInspector::LimitSize()
+{
+  size_t maxChars = (*m_configuration)->XmlInspectorMaxKilobytes() * 1024;
+  size_t dropped = 0;
+  while((m_chars > maxChars) && (m_lines.size() > 1))
+  {
+    m_chars -= m_lines.front().m_text.Length();
+    m_lines.pop_front();
+    dropped++;
+  }
+  return dropped;
+}
+
+void XmlInspector::SelectLine(long line)
+{
+  long selected = m_list->GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+  if(selected == line)
+    return;
+  if(selected >= 0)
+    m_list->SetItemState(selected, 0, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+  if(line >= 0)
+    m_list->SetItemState(line, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED,
+                         wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+}
+
 void XmlInspector::Update()
 {
   if(!m_updateNeeded)
     return;
   m_updateNeeded = false;
+
+  long oldCount = m_lines.size();
+  // Only scroll to the new data if the user hasn't scrolled away from the end
+  bool atEnd = (m_list->GetTopItem() + m_list->GetCountPerPage() >= oldCount);
+  long selected = m_list->GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
   
   if(m_clear)
   {
-    wxRichTextCtrl::Clear();
+    SelectLine(-1);
+    selected = -1;
+    m_lines.clear();
+    m_chars = 0;
+    m_lineOpen = false;
     m_lastChar = wxChar(0);
     m_indentLevel = 0;
     m_state = clear;
     m_clear = false;
+    atEnd = true;
   }
   
   // Display all data we have sent to Maxima
@@ -80,27 +218,13 @@ void XmlInspector::Update()
   {
     if(m_state != toMaxima)
     {
-      if(GetValue() != wxEmptyString)
-      {
-        Newline();Newline();
-      }
-      SetInsertionPointEnd();
-      BeginTextColour(wxColour(0,0,0));
-      WriteText(_("SENT TO MAXIMA:"));
-      Newline();Newline();
-      EndTextColour();
+      AddHeader(_("SENT TO MAXIMA:"));
       m_state = toMaxima;
     }
     else
-    {
-      SetInsertionPointEnd();
-      WriteText("\n");
-    }
+      m_lineOpen = false;
     
-    SetInsertionPointEnd();
-    BeginTextColour(wxColour(128,0,0));
-    WriteText(m_toMaxima);
-    EndTextColour();
+    AddText(m_toMaxima, line_toMaxima);
     m_toMaxima = wxEmptyString;
   }
 
@@ -109,25 +233,15 @@ void XmlInspector::Update()
   {
     if(m_state != fromMaxima)
     {
-      if(GetValue() != wxEmptyString)
-      {
-        Newline();Newline();
-      }
-      SetInsertionPointEnd();
-      BeginTextColour(wxColour(0,0,0));
-      WriteText(_("MAXIMA RESPONSE:"));
-      Newline();Newline();    
-      EndTextColour();
+      AddHeader(_("MAXIMA RESPONSE:"));
       m_state = fromMaxima;
     }
     m_fromMaxima.Replace(wxT("$FUNCTION:"), wxT("\n$FUNCTION:"));
 
     // Indent the XML
     wxString textWithIndention;
-    long length = 0;
     for (wxString::const_iterator it = m_fromMaxima.begin(); it!=m_fromMaxima.end(); ++it)
     {
-      length++;
       // Assume that all tags add indentation
       if (*it == wxT('>'))
         m_indentLevel++;
@@ -148,18 +262,57 @@ void XmlInspector::Update()
       textWithIndention += *it;
       m_lastChar = *it;
     }
-    SetInsertionPointEnd();
-    BeginTextColour(wxColour(0,128,0));
-    WriteText(textWithIndention);
-    EndTextColour();
+    AddText(textWithIndention, line_fromMaxima);
     m_fromMaxima = wxEmptyString;
+  }
+
+  // The selection has to stay on the same line even if the lines before it
+  // have been dropped.
+  long dropped = LimitSize();
+  if((dropped > 0) && (selected >= 0))
+    SelectLine(selected >= dropped ? selected - dropped : -1);
+  m_list->SetItemCount(m_lines.size());
+  if(atEnd && (!m_lines.empty()))
+    m_list->EnsureVisible(m_lines.size() - 1);
+  m_list->Refresh();
+}
+
+void XmlInspector::Search(bool next)
+{
+  wxString searchString = m_search->GetValue().Lower();
+  if(searchString.IsEmpty() || m_lines.empty())
+    return;
 
-    // Adding many chars to the XML inspector is slow => Warn our users if we do so.
-    if(length > 100000)
-      wxLogMessage(wxString::Format(_("Added much text (%li chars) to the XML inspector.")));
+  long start = m_list->GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+  if(start < 0)
+    start = 0;
+  else if(next)
+    start++;
+
+  // Search from the current line to the end and then wrap around to the start.
+  long count = m_lines.size();
+  for(long i = 0; i < count; i++)
+  {
+    long line = (start + i) % count;
+    if(m_lines[line].m_text.Lower().Contains(searchString))
+    {
+      SelectLine(line);
+      m_list->EnsureVisible(line);
+      return;
+    }
   }
 }
 
+void XmlInspector::OnSearchText(wxCommandEvent &WXUNUSED(event))
+{
+  Search(false);
+}
+
+void XmlInspector::OnSearchEnter(wxCommandEvent &WXUNUSED(event))
+{
+  Search(true);
+}
+
 wxString XmlInspector::IndentString(int level)
 {
   wxString result;
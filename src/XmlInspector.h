@@ -24,9 +24,10 @@
   This file contains the definition of the class XmlInspector that handles the 
   table of contents pane.
  */
+#include "Configuration.h"
 #include <wx/wx.h>
-#include <wx/richtext/richtextctrl.h>
-#include <vector>
+#include <wx/listctrl.h>
+#include <deque>
 #include "GroupCell.h"
 
 #ifndef XMLINSPECTOR_H
@@ -35,11 +36,16 @@
 /*! This class generates a pane displaying the communication between maxima and wxMaxima.
   
   The display of this data is only actually updated on calling XmlInspector::Update().
+
+  Only the last Configuration::XmlInspectorMaxKilobytes() of the communication
+  are kept, and they are shown in a virtual list control that only ever asks
+  for the lines that are actually visible. This way having this pane open
+  doesn't make wxMaxima crawl even if maxima sends megabytes of data.
  */
-class XmlInspector : public wxRichTextCtrl
+class XmlInspector : public wxPanel
 {
 public:
-  XmlInspector(wxWindow *parent, int id);
+  XmlInspector(wxWindow *parent, int id, Configuration **config);
 
   /*! The destructor
    */
@@ -57,6 +63,69 @@ public:
   //! Do we need to update the XmlInspector's display?
   bool UpdateNeeded(){return m_updateNeeded;}
 private:
+  //! The kinds of lines we display
+  enum lineType
+  {
+    line_header,
+    line_toMaxima,
+    line_fromMaxima
+  };
+  //! One line of the communication with maxima
+  struct Line
+  {
+    Line(wxString text, lineType type) : m_text(text), m_type(type) {}
+    wxString m_text;
+    lineType m_type;
+  };
+
+  /*! The list control that displays the lines
+
+    It is a virtual list control, which means it only asks us for the lines it
+    currently needs to draw.
+   */
+  class LineList : public wxListCtrl
+  {
+  public:
+    LineList(XmlInspector *parent, int id);
+  protected:
+    wxString OnGetItemText(long item, long column) const;
+    wxListItemAttr *OnGetItemAttr(long item) const;
+  private:
+    XmlInspector *m_inspector;
+    // The colours the lines are displayed in. They are only assigned to the
+    // lines on drawing them.
+    mutable wxListItemAttr m_headerAttr;
+    mutable wxListItemAttr m_toMaximaAttr;
+    mutable wxListItemAttr m_tagAttr;
+    mutable wxListItemAttr m_textAttr;
+  };
+
+  //! Append a header line
+  void AddHeader(wxString text);
+  //! Append text to the list of lines, continuing the last line if it wasn't ended
+  void AddText(const wxString &text, lineType type);
+  /*! Drop the oldest lines until we don't exceed our memory limit
+
+    \return The number of lines that have been dropped
+   */
+  size_t LimitSize();
+  //! Select a line or (if line < 0) no line
+  void SelectLine(long line);
+  //! Search for the next line containing the search string
+  void Search(bool next);
+  void OnSearchText(wxCommandEvent &event);
+  void OnSearchEnter(wxCommandEvent &event);
+  void OnSize(wxSizeEvent &event);
+
+  Configuration **m_configuration;
+  LineList *m_list;
+  wxTextCtrl *m_search;
+  //! The lines we display, oldest first
+  std::deque<Line> m_lines;
+  //! The number of chars in m_lines
+  size_t m_chars;
+  //! Can the last line in m_lines be continued by the next data?
+  bool m_lineOpen;
   bool m_updateNeeded;
   wxString m_fromMaxima;
   wxString m_toMaxima;
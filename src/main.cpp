@@ -199,6 +199,18 @@ bool MyApp::OnInit()
                    "Pipe messages from Maxima to stdout.",  wxCMD_LINE_VAL_NONE, 0},
                   {wxCMD_LINE_SWITCH, "", "exit-on-error",
                    "Close the program on any Maxima error.",  wxCMD_LINE_VAL_NONE, 0},
+                  {wxCMD_LINE_SWITCH, "", "benchmark",
+                   "Replay the recorded Maxima output in the input files without starting Maxima and output how long each stage of displaying it took.",  wxCMD_LINE_VAL_NONE, 0},
+                  {wxCMD_LINE_OPTION, "", "benchmark-baseline",
+                   "Exit with an error if --benchmark is much slower than the timings in file <str>.",  wxCMD_LINE_VAL_STRING, 0},
+                  {wxCMD_LINE_OPTION, "", "benchmark-write-baseline",
+                   "Write the timings --benchmark has measured to file <str>.",  wxCMD_LINE_VAL_STRING, 0},
+                  {wxCMD_LINE_OPTION, "", "record-transcript",
+                   "Record everything that is sent to and received from Maxima to file <str>.",  wxCMD_LINE_VAL_STRING, 0},
+                  {wxCMD_LINE_OPTION, "", "replay-transcript",
+                   "Don't start Maxima, but play back Maxima's side of the transcript <str>.",  wxCMD_LINE_VAL_STRING, 0},
+                  {wxCMD_LINE_SWITCH, "", "replay-full-speed",
+                   "Play back --replay-transcript as fast as possible instead of with its original timing.",  wxCMD_LINE_VAL_NONE, 0},
                   {wxCMD_LINE_OPTION, "f", "ini", "allows to specify a file to store the configuration in", wxCMD_LINE_VAL_STRING , 0},
                   {wxCMD_LINE_OPTION, "u", "use-version",
                    "Use Maxima version <str>.",  wxCMD_LINE_VAL_STRING, 0},
@@ -248,6 +260,12 @@ bool MyApp::OnInit()
 
   wxString extraMaximaArgs;
   wxString arg;
+  if (cmdLineParser.Found(wxT("record-transcript"), &arg))
+    wxMaxima::RecordTranscript(arg);
+
+  if (cmdLineParser.Found(wxT("replay-transcript"), &arg))
+    wxMaxima::ReplayTranscript(arg, cmdLineParser.Found(wxT("replay-full-speed")));
+
   if (cmdLineParser.Found(wxT("l"), &arg))
     extraMaximaArgs += " -l " +  arg;
   
@@ -325,6 +343,22 @@ bool MyApp::OnInit()
     exit(0);
   }
 
+  if (cmdLineParser.Found(wxT("benchmark")))
+  {
+    wxArrayString files;
+    for (unsigned int i=0; i < cmdLineParser.GetParamCount(); i++)
+      files.Add(cmdLineParser.GetParam(i));
+    wxString baseline, writeBaseline;
+    cmdLineParser.Found(wxT("benchmark-baseline"), &baseline);
+    cmdLineParser.Found(wxT("benchmark-write-baseline"), &writeBaseline);
+
+    wxMaxima::NoMaxima();
+    wxMaxima *frame = new wxMaxima((wxFrame *) NULL, -1, &m_locale, _("wxMaxima benchmark"));
+    int failures = frame->Benchmark(files, baseline, writeBaseline);
+    frame->Destroy();
+    exit(failures);
+  }
+
   if (cmdLineParser.Found(wxT("b")))
   {
     evalOnStartup = true;
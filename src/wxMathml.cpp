@@ -6,10 +6,13 @@
 #include <wx/zstream.h>
 #include <wx/txtstrm.h>
 #include <wx/string.h>
+#include <wx/dir.h>
+#include <wx/file.h>
+#include <wx/filename.h>
 
 wxMathML::wxMathML()
 {
-  if(m_maximaCMD.IsEmpty())
+  if(m_wxMathML.IsEmpty())
     {
       // Unzip wxMathml.lisp: We need to store it in a .zip format
       // in order to avoid a bug in the ArchLinux C compiler that
@@ -78,4 +81,88 @@ wxString wxMathML::GetCmd()
   return m_maximaCMD;
 }
 
+wxString wxMathML::Hash()
+{
+  // A 64-bit FNV-1a hash
+  wxScopedCharBuffer data = m_wxMathML.utf8_str();
+  wxUint64 hash = wxULL(14695981039346656037);
+  for(size_t i = 0; i < data.length(); i++)
+    {
+      hash ^= (unsigned char) data[i];
+      hash *= wxULL(1099511628211);
+    }
+  return wxString::Format(wxT("%016") wxLongLongFmtSpec wxT("x"), (wxULongLong_t) hash);
+}
+
+wxString wxMathML::GetCompiledCmd(wxString cacheDir)
+{
+  cacheDir.Replace(wxT("\\"), wxT("/"));
+  if(!wxDirExists(cacheDir))
+    wxFileName::Mkdir(cacheDir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  wxString base = cacheDir + wxT("/wxMathML_") + Hash();
+  wxString source = base + wxT(".lisp");
+
+  if(wxFileExists(source))
+    // Tell the cleanup below that this version is still in use
+    wxFileName(source).Touch();
+  else
+    {
+      // Other wxMaxima versions that run at the same time might still use
+      // their files => Only remove the files of versions that haven't been
+      // used for a month.
+      wxDateTime staleBefore = wxDateTime::Now() - wxDateSpan::Month();
+      wxArrayString files;
+      if(wxDirExists(cacheDir))
+        wxDir::GetAllFiles(cacheDir, &files, wxT("wxMathML_*"), wxDIR_FILES);
+      for(size_t i = 0; i < files.GetCount(); i++)
+        {
+          wxString hash = wxFileName(files[i]).GetName().Mid(9, 16);
+          wxFileName versionSource(cacheDir + wxT("/wxMathML_") + hash + wxT(".lisp"));
+          if((!versionSource.FileExists()) ||
+             (versionSource.GetModificationTime() < staleBefore))
+            wxRemoveFile(files[i]);
+        }
+
+      // Another wxMaxima must never load a half-written file
+      wxString tempFile = wxFileName::CreateTempFileName(cacheDir + wxT("/tmp_"));
+      if(tempFile.IsEmpty())
+        return wxEmptyString;
+      bool written;
+      {
+        wxFile file(tempFile, wxFile::write);
+        wxScopedCharBuffer data = m_wxMathML.utf8_str();
+        written = file.IsOpened() && (file.Write(data.data(), data.length()) == data.length());
+      }
+      if((!written) || (!wxRenameFile(tempFile, source, true)))
+        {
+          wxRemoveFile(tempFile);
+          return wxEmptyString;
+        }
+    }
+
+  base.Replace(wxT("\""), wxT("\\\""));
+  source.Replace(wxT("\""), wxT("\\\""));
+  // The compiled file is specific to the maxima version and to the lisp
+  // maxima was compiled with. compile-file-pathname knows the file extension
+  // the lisp uses for compiled files. Lisps that don't provide it just load
+  // the source. If loading the compiled file fails for any reason, the source
+  // is loaded instead.
+  return
+    wxT(":lisp-quiet (let* ((*load-verbose* nil) (*load-print* nil) ") +
+    wxT("(src \"") + source + wxT("\") ") +
+    wxT("(key (substitute-if #\\_ (lambda (c) (not (alphanumericp c))) ") +
+    wxT("(format nil \"~a_~a_~a\" (if (boundp '*autoconf-version*) (symbol-value '*autoconf-version*) \"\") ") +
+    wxT("(lisp-implementation-type) (lisp-implementation-version)))) ") +
+    wxT("(fasl (ignore-errors (compile-file-pathname (concatenate 'string \"") + base + wxT("_\" key \".lisp\"))))) ") +
+    wxT("(unless (and fasl (probe-file fasl) (ignore-errors (load fasl) t)) ") +
+    wxT("(if (ignore-errors (load src) t) ") +
+    wxT("(when fasl (ignore-errors (let ((*standard-output* (make-broadcast-stream)) ") +
+    wxT("(*error-output* (make-broadcast-stream)) (*compile-verbose* nil) (*compile-print* nil) ") +
+    wxT("(tmp (compile-file-pathname (concatenate 'string \"") + base + wxT("_\" key \"_tmp.lisp\")))) ") +
+    wxT("(when (compile-file src :output-file tmp) (rename-file tmp fasl))))) ") +
+    wxT("(progn (format t \"<variables><variable><name>wxmathml_load_failed</name>") +
+    wxT("<value>true</value></variable></variables>\") (finish-output)))))\n");
+}
+
+wxString wxMathML::m_wxMathML;
 wxString wxMathML::m_maximaCMD;
@@ -34,9 +34,24 @@ class wxMathML
 {
  public:
   wxMathML();
+  //! The command that sends maxima wxMathML.lisp
   wxString GetCmd();
+  /*! A command that makes maxima load a compiled version of wxMathML.lisp
+
+    wxMathML.lisp is stored in cacheDir, named after a hash of its contents.
+    The command makes maxima load the compiled version of this file, if it
+    finds one for the current maxima and lisp. If it doesn't it loads the
+    source and compiles it for the next time maxima is started. If even loading
+    the source fails it sends a variable named wxmathml_load_failed that makes
+    wxMaxima fall back to sending GetCmd().
+
+    \return The command, or wxEmptyString if the source file cannot be written.
+   */
+  wxString GetCompiledCmd(wxString cacheDir);
  private:
-  wxString m_wxMathML;
+  //! A hash of wxMathML.lisp the names of the cached files are derived from
+  static wxString Hash();
+  static wxString m_wxMathML;
   static wxString m_maximaCMD;
 };
 
@@ -70,6 +70,8 @@
 #include "ListSortWiz.h"
 #include "wxMaximaIcon.h"
 #include "ErrorRedirector.h"
+#include "ExportCache.h"
+#include "HelpAnchors.h"
 
 #include <wx/colordlg.h>
 #include <wx/clipbrd.h>
@@ -83,6 +85,7 @@
 #include <wx/dynlib.h>
 #include <wx/dir.h>
 #include <wx/filename.h>
+#include <wx/file.h>
 #include <wx/artprov.h>
 #include <wx/aboutdlg.h>
 #include <wx/mstream.h>
@@ -93,12 +96,15 @@
 #include <wx/sckstrm.h>
 #include <wx/fs_mem.h>
 #include <wx/persist/toplevel.h>
+#include <wx/stdpaths.h>
 #include <wx/mimetype.h>
 
 #include <wx/url.h>
 #include <wx/sstream.h>
 #include <list>
+#include <map>
 #include <memory>
+#include <iostream>
 
 #if defined __WXOSX__
 #define MACPREFIX "wxMaxima.app/Contents/Resources/"
@@ -150,6 +156,12 @@ void wxMaxima::ConfigChanged()
   else
     m_configCommands += wxT(":lisp-quiet (setq $wxplot_pngcairo nil)\n");
 
+  // With more than one gnuplot process wxMaxima renders the frames of animations itself.
+  if (m_worksheet->m_configuration->AnimationJobs() > 1)
+    m_configCommands += wxT(":lisp-quiet (setq *wx-frontend-renders-frames* t)\n");
+  else
+    m_configCommands += wxT(":lisp-quiet (setq *wx-frontend-renders-frames* nil)\n");
+
   m_configCommands += wxT(":lisp-quiet (setq $wxsubscripts ") +
     m_worksheet->m_configuration->GetAutosubscript_string() +
     wxT(")\n");
@@ -247,12 +259,15 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
   m_firstPrompt = wxT("(%i1) ");
 
   m_server = NULL;
+  if(!m_recordTranscript.IsEmpty())
+    m_transcript = std::unique_ptr<MaximaTranscript>(new MaximaTranscript(m_recordTranscript));
 
   config->Read(wxT("lastPath"), &m_lastPath);
   m_lastPrompt = wxEmptyString;
 
   m_closing = false;
   m_fileSaved = true;
+  m_backgroundSaveIsAutosave = false;
 
   m_chmhelpFile = wxEmptyString;
 
@@ -462,6 +477,10 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
           wxCommandEventHandler(wxMaxima::FileMenu), NULL, this);
   Connect(menu_export_html, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::FileMenu), NULL, this);
+  Connect(menu_export_evaluation_stats, wxEVT_MENU,
+          wxCommandEventHandler(wxMaxima::FileMenu), NULL, this);
+  Connect(menu_purge_export_cache, wxEVT_MENU,
+          wxCommandEventHandler(wxMaxima::FileMenu), NULL, this);
   Connect(wxID_HELP, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::HelpMenu), NULL, this);
   Connect(menu_help_tutorials, wxEVT_MENU,
@@ -470,6 +489,8 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
           wxCommandEventHandler(wxMaxima::HelpMenu), NULL, this);
   Connect(menu_build_info, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::HelpMenu), NULL, this);
+  Connect(menu_memory_usage, wxEVT_MENU,
+          wxCommandEventHandler(wxMaxima::HelpMenu), NULL, this);
   Connect(menu_interrupt_id, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::Interrupt), NULL, this);
   Connect(wxID_OPEN, wxEVT_MENU,
@@ -666,6 +687,8 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
           wxCommandEventHandler(wxMaxima::MaximaMenu), NULL, this);
   Connect(menu_jumptoerror, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::MaximaMenu), NULL, this);
+  Connect(menu_show_evaluation_stats, wxEVT_MENU,
+          wxCommandEventHandler(wxMaxima::MaximaMenu), NULL, this);
   Connect(menu_display, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::MaximaMenu), NULL, this);
   Connect(menu_pade, wxEVT_MENU,
@@ -772,6 +795,8 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
           wxSocketEventHandler(wxMaxima::ServerEvent), NULL, this);
   Connect(wxEVT_CLOSE_WINDOW,
           wxCloseEventHandler(wxMaxima::OnClose), NULL, this);
+  m_worksheet->Connect(wxEVT_THREAD,
+                       wxThreadEventHandler(wxMaxima::OnBackgroundSaveFinished), NULL, this);
   Connect(wxEVT_QUERY_END_SESSION,
           wxCloseEventHandler(wxMaxima::OnClose), NULL, this);
   Connect(wxEVT_END_SESSION,
@@ -1337,7 +1362,14 @@ void wxMaxima::DoConsoleAppend(wxString s, CellType type, bool newLine,
   s.Replace(wxT("\n"), wxT(" "), true);
 
   m_parser.SetUserLabel(userLabel);
-  cell = m_parser.ParseLine(s, type);
+  GroupCell *group = m_worksheet->GetWorkingGroup(true);
+  if (group != NULL)
+  {
+    EvaluationStats::Timer timer(group->GetEvaluationStats(), &EvaluationStats::AddParseTime);
+    cell = m_parser.ParseLine(s, type);
+  }
+  else
+    cell = m_parser.ParseLine(s, type);
 
   wxASSERT_MSG(cell != NULL, _("There was an error in generated XML!\n\n"
                                "Please report this as a bug."));
@@ -1557,6 +1589,8 @@ void wxMaxima::SendMaxima(wxString s, bool addToHistory)
         StatusMaximaBusy(waiting);
 
       wxScopedCharBuffer const data_raw = s.utf8_str();
+      if(m_transcript)
+        m_transcript->ToMaxima(data_raw.data(), data_raw.length());
 #ifdef __WXMSW__
       // On MS Windows we don't get a signal that tells us if a write has
       // finishes. But it seems a write always succeeds
@@ -1623,6 +1657,7 @@ void wxMaxima::TryToReadDataFromMaxima()
 
   // Read all new lines of text we received.
   wxChar chr;
+  size_t oldLength = m_newCharsFromMaxima.Length();
 
   while((m_client->IsConnected()) && (m_client->IsData()) && (m_clientStream != NULL) &&
         (!m_clientStream->Eof()))
@@ -1634,6 +1669,9 @@ void wxMaxima::TryToReadDataFromMaxima()
       m_newCharsFromMaxima += chr;
   }
 
+  if(m_transcript)
+    m_transcript->FromMaxima(m_newCharsFromMaxima.Mid(oldLength));
+
   if(m_pipeToStdout)
     std::cout << m_newCharsFromMaxima;
   m_bytesFromMaxima += m_newCharsFromMaxima.Length();
@@ -1717,7 +1755,7 @@ void wxMaxima::OnMaximaConnect()
     wxLogMessage(_("New connection attempt whilst already connected."));
     return;
   }
-  if(m_process == NULL)
+  if((m_process == NULL) && (!m_fakeMaxima))
   {
     wxLogMessage(_("New connection attempt, but no currently running maxima process."));
     return;
@@ -1800,6 +1838,9 @@ bool wxMaxima::StartServer()
 
 bool wxMaxima::StartMaxima(bool force)
 {
+  if(m_noMaxima)
+    return false;
+
   if(!m_server)
     StartServer();
   // cppcheck-suppress duplicateCondition
@@ -1857,6 +1898,27 @@ bool wxMaxima::StartMaxima(bool force)
     if((m_process != NULL) || (m_pid >= 0) || (m_client))
       KillMaxima();
 
+    if(!m_replayTranscript.IsEmpty())
+    {
+      // Play back a recorded session instead of starting maxima. The fake maxima
+      // connects to our server exactly like a real one would.
+      m_fakeMaxima = std::unique_ptr<MaximaTranscriptReplayer>(
+        new MaximaTranscriptReplayer(m_replayTranscript, m_replayFullSpeed));
+      if(!m_fakeMaxima->Connect(m_port))
+      {
+        m_fakeMaxima.reset();
+        StatusMaximaBusy(process_wont_start);
+        RightStatusText(_("Cannot replay the maxima transcript"));
+        return false;
+      }
+      wxLogMessage(wxString::Format(_("Replaying the maxima transcript %s"), m_replayTranscript));
+      m_first = true;
+      m_pid = -1;
+      m_lastPrompt = wxT("(%i1) ");
+      StatusMaximaBusy(wait_for_start);
+      return true;
+    }
+
     m_maximaStdoutPollTimer.StartOnce(MAXIMAPOLLMSECS);
 
     wxString command = GetCommand();
@@ -2106,6 +2168,7 @@ void wxMaxima::KillMaxima(bool logMessage)
     m_client->Close();
     m_client = NULL;
   }
+  m_fakeMaxima.reset();
 
   // Just to be absolutely sure: Additionally try to kill maxima
   if (m_pid > 0)
@@ -2246,8 +2309,9 @@ void wxMaxima::ReadFirstPrompt(wxString &data)
   int s = data.Find(wxT("pid=")) + 4;
   int t = s + data.SubString(s, data.Length()).Find(wxT("\n")) - 1;
 
-  // Read this pid
-  if (s < t)
+  // Read this pid. A replayed transcript contains the pid of a process that
+  // ran on the machine it was recorded on => we must never signal it.
+  if ((s < t) && (!m_fakeMaxima))
     data.SubString(s, t).ToLong(&m_pid);
 
   if (m_pid > 0)
@@ -2646,6 +2710,7 @@ void wxMaxima::ReadVariables(wxString &data)
             {
               m_gnuplotcommand = value;
               wxLogMessage(wxString::Format(_("Gnuplot can be found at %s"),value.utf8_str()));
+              m_worksheet->m_configuration->SetGnuplotBinary(GnuplotBinary());
             }
             if(name == "*maxima-sharedir*")
             {
@@ -2656,7 +2721,10 @@ void wxMaxima::ReadVariables(wxString &data)
               m_worksheet->LoadSymbols();
               if(m_worksheet->m_helpFileAnchors.empty())
               {
-                m_compileHelpAnchorsTimer.StartOnce(10000);
+                // Reading the cached anchors is fast. Scanning the manual
+                // competes with maxima's startup, though.
+                if(!CompileHelpFileAnchors(false))
+                  m_compileHelpAnchorsTimer.StartOnce(10000);
               }
             }
             if(name == "*lisp-name*")
@@ -2669,6 +2737,12 @@ void wxMaxima::ReadVariables(wxString &data)
               m_lispVersion = value;
               wxLogMessage(wxString::Format(_("Lisp version: %s"),value.utf8_str()));
             }
+            if(name == "wxmathml_load_failed")
+            {
+              wxLogMessage(_("Maxima couldn't load the cached wxMathML.lisp => sending it instead."));
+              wxMathML wxmathml;
+              SendMaxima(wxmathml.GetCmd());
+            }
             if(name == "*wx-load-file-name*")
             {
               m_recentPackages.AddDocument(value);
@@ -2814,6 +2888,9 @@ void wxMaxima::ReadPrompt(wxString &data)
   {
     // Maxima displayed a new main prompt => We don't have a question
     m_worksheet->QuestionAnswered();
+    // The command maxima was working on is finished.
+    if (m_worksheet->GetWorkingGroup() != NULL)
+      m_worksheet->GetWorkingGroup()->GetEvaluationStats().MaximaFinished();
     // And we can remove one command from the evaluation queue.
     m_worksheet->m_evaluationQueue.RemoveFirst();
 
@@ -3350,6 +3427,11 @@ bool wxMaxima::OpenWXMXFile(wxString file, Worksheet *document, bool clearDocume
 
   wxWindowUpdateLocker noUpdates(document);
 
+  // If wxMaxima crashed before it could merge the journal of an autosave file
+  // into the file we need to do so now.
+  if(!AutosaveJournal::Recover(file))
+    wxLogMessage(wxString::Format(_("Cannot merge the autosave journal into %s"), file.utf8_str()));
+
   // If the file is empty we don't want to generate an error, but just
   // open an empty file.
   //
@@ -3708,7 +3790,13 @@ void wxMaxima::SetupVariables()
 
   wxLogMessage(_("Sending maxima the info how to express 2d maths as XML"));
   wxMathML wxmathml;
-  SendMaxima(wxmathml.GetCmd());
+  wxString loadWxMathML;
+  if(m_worksheet->m_configuration->CompileWxMathML())
+    loadWxMathML = wxmathml.GetCompiledCmd(Dirstructure::CacheDir() +
+                                           wxT("/lispcache"));
+  if(loadWxMathML.IsEmpty())
+    loadWxMathML = wxmathml.GetCmd();
+  SendMaxima(loadWxMathML);
   wxString cmd;
 
 #if defined (__WXOSX__)
@@ -3769,7 +3857,7 @@ void wxMaxima::SetupVariables()
              wxT("\") ($put \'$wxmaxima (read-wxmaxima-version \"" +
              wxString(wxmaximaversion_lisp) +
              wxT("\") '$version) (setq $wxwidgetsversion \"")) + wxString(wxVERSION_STRING) +
-             wxT("\")   (if (boundp $maxima_frontend_version) (setq $maxima_frontend_version \"" +
+             wxT("\") (setq *wx-compact-matrices* t)   (if (boundp $maxima_frontend_version) (setq $maxima_frontend_version \"" +
                  wxmaximaversion_lisp + "\")) (ignore-errors (setf (symbol-value '*lisp-quiet-suppressed-prompt*) \"" + m_promptPrefix + "(%i1)" + m_promptSuffix + "\")))\n")
     );
 
@@ -3780,6 +3868,26 @@ void wxMaxima::SetupVariables()
 ///  Getting configuration
 ///--------------------------------------------------------------------------------
 
+wxString wxMaxima::GnuplotBinary()
+{
+  if(wxFileName(m_gnuplotcommand).IsAbsolute())
+    return m_gnuplotcommand;
+
+  wxString gnuplot_binary;
+  wxPathList pathlist;
+  pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath());
+  pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath()+"/../");
+  pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath()+"/../gnuplot");
+  pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath()+"/../gnuplot/bin");
+  pathlist.AddEnvList(wxT("PATH"));
+  gnuplot_binary = pathlist.FindAbsoluteValidPath(m_gnuplotcommand);
+  if(gnuplot_binary == wxEmptyString)
+    gnuplot_binary = pathlist.FindAbsoluteValidPath(m_gnuplotcommand + wxT(".exe"));
+  if(gnuplot_binary == wxEmptyString)
+    gnuplot_binary = m_gnuplotcommand;
+  return gnuplot_binary;
+}
+
 wxString wxMaxima::GetCommand(bool params)
 {
   Configuration *configuration = m_worksheet->m_configuration;
@@ -4093,7 +4201,7 @@ void wxMaxima::ShowHelp(wxString keyword)
     ShowMaximaHelp(keyword);
 }
 
-void wxMaxima::CompileHelpFileAnchors()
+bool wxMaxima::CompileHelpFileAnchors(bool scan)
 {
   wxString MaximaHelpFile = GetMaximaHelpFile();
   #ifdef HAVE_OMP_HEADER
@@ -4106,66 +4214,36 @@ void wxMaxima::CompileHelpFileAnchors()
 
   if(m_worksheet->m_helpFileAnchors.empty() && (!(MaximaHelpFile.IsEmpty())))
   {
-    int foundAnchors = 0;
-    wxLogMessage(_("Compiling the list of anchors the maxima manual provides"));
-    wxRegEx idExtractor(".*<span id=\\\"([a-zAZ0-9_-]*)\\\"");
-    wxRegEx idExtractor_oldManual(".*<a name=\\\"([a-zAZ0-9_-]*)\\\"");
-    wxRegEx correctUnderscores("_0[0-9]+[a-z]");
-    if(wxFileExists(MaximaHelpFile))
+    HelpAnchors::AnchorMap anchors;
+    bool cached = HelpAnchors::Load(MaximaHelpFile, anchors);
+    if(cached)
+      wxLogMessage(wxString::Format(_("Read %li anchors of the maxima manual from the cache"),
+                                    (long) anchors.size()));
+    else if(scan)
     {
-      wxFileInputStream input(MaximaHelpFile);
-      if(input.IsOk())
-      {
-        wxTextInputStream text(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-        while(input.IsOk() && !input.Eof())
-        {
-          wxString line = text.ReadLine();
-          wxStringTokenizer tokens(line, wxT(">"));
-          while(tokens.HasMoreTokens())
-          {
-            wxString token = tokens.GetNextToken();
-            wxString oldToken(token);
-            if(idExtractor.Replace(&token, "\\1")>0)
-            {
-              wxString id = token;
-              correctUnderscores.Replace(&token, "_");
-              token.Replace("-", " ");
-              if((!token.EndsWith("-1")) && (!token.Contains(" ")))
-              {
-                m_worksheet->m_helpFileAnchors[token] = id;
-                foundAnchors++;
-              }
-            }
-            else
-            {
-              if(idExtractor_oldManual.Replace(&token, "\\1")>0)
-              {
-                wxString id = token;
-                correctUnderscores.Replace(&token, "_");
-                token.Replace("-", " ");
-                if((!token.EndsWith("-1")) && (!token.Contains(" ")))
-                {
-                  m_worksheet->m_helpFileAnchors[token] = id;
-                  foundAnchors++;
-                }
-              }
-            }
-          }
-        }
-      }
+      wxLogMessage(_("Compiling the list of anchors the maxima manual provides"));
+      long foundAnchors = HelpAnchors::Scan(MaximaHelpFile, anchors);
+      wxLogMessage(wxString::Format(_("Found %li anchors."), foundAnchors));
+      if(foundAnchors > 0)
+        HelpAnchors::Save(MaximaHelpFile, anchors);
+    }
+    if(cached || scan)
+    {
+      m_worksheet->m_helpFileAnchors.swap(anchors);
+      m_worksheet->m_helpFileAnchors["wxdraw"] = m_worksheet->m_helpFileAnchors["draw"];
+      m_worksheet->m_helpFileAnchors["wxdraw2d"] = m_worksheet->m_helpFileAnchors["draw2d"];
+      m_worksheet->m_helpFileAnchors["wxdraw3d"] = m_worksheet->m_helpFileAnchors["draw3d"];
+      m_worksheet->m_helpFileAnchors["with_slider_draw"] = m_worksheet->m_helpFileAnchors["draw"];
+      m_worksheet->m_helpFileAnchors["with_slider_draw2d"] = m_worksheet->m_helpFileAnchors["draw2d"];
+      m_worksheet->m_helpFileAnchors["with_slider_draw3d"] = m_worksheet->m_helpFileAnchors["draw3d"];
+      m_worksheet->m_helpFileAnchorsUsable = true;
     }
-    m_worksheet->m_helpFileAnchors["wxdraw"] = m_worksheet->m_helpFileAnchors["draw"];
-    m_worksheet->m_helpFileAnchors["wxdraw2d"] = m_worksheet->m_helpFileAnchors["draw2d"];
-    m_worksheet->m_helpFileAnchors["wxdraw3d"] = m_worksheet->m_helpFileAnchors["draw3d"];
-    m_worksheet->m_helpFileAnchors["with_slider_draw"] = m_worksheet->m_helpFileAnchors["draw"];
-    m_worksheet->m_helpFileAnchors["with_slider_draw2d"] = m_worksheet->m_helpFileAnchors["draw2d"];
-    m_worksheet->m_helpFileAnchors["with_slider_draw3d"] = m_worksheet->m_helpFileAnchors["draw3d"];
-    m_worksheet->m_helpFileAnchorsUsable = true;
-    wxLogMessage(wxString::Format(_("Found %i anchors."), foundAnchors));
   }
+  bool known = !m_worksheet->m_helpFileAnchors.empty();
   #ifdef HAVE_OMP_HEADER
   omp_unset_lock(&m_helpFileAnchorsLock);
   #endif
+  return known;
 }
 
 void wxMaxima::ShowMaximaHelp(wxString keyword)
@@ -4233,9 +4311,9 @@ bool wxMaxima::InterpretDataFromMaxima()
   m_currentOutputEnd = m_currentOutput.Right(30) + m_newCharsFromMaxima;
 
   m_currentOutput += m_newCharsFromMaxima;
+  if (m_worksheet->GetWorkingGroup() != NULL)
+    m_worksheet->GetWorkingGroup()->GetEvaluationStats().AddDataFromMaxima(m_newCharsFromMaxima);
   m_newCharsFromMaxima = wxEmptyString;
-  if ((m_xmlInspector) && (IsPaneDisplayed(menu_pane_xmlInspector)))
-    m_xmlInspector->Add_FromMaxima(m_newCharsFromMaxima);
 
   if (!m_dispReadOut &&
       (m_currentOutput != wxT("\n")) &&
@@ -4433,6 +4511,11 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
           m_worksheet->FindIncremental(m_findData.GetFindString(),
                                      m_findData.GetFlags() & wxFR_DOWN,
                                      !(m_findData.GetFlags() & wxFR_MATCHCASE));
+          if (!m_findData.GetFindString().IsEmpty())
+            LeftStatusText(wxString::Format(_("%i matches"),
+                                            m_worksheet->CountMatches(m_findData.GetFindString(),
+                                                                      !(m_findData.GetFlags() & wxFR_MATCHCASE))),
+                           false);
         }
 
         m_worksheet->RequestRedraw();
@@ -4508,7 +4591,9 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
         else
           cursorPos = m_worksheet->FirstVisibleGC();
       }
-      m_worksheet->m_tableOfContents->UpdateTableOfContents(m_worksheet->GetTree(), cursorPos);
+      m_worksheet->m_tableOfContents->UpdateTableOfContents(m_worksheet->GetTree(), cursorPos,
+                                                           m_worksheet->m_scheduleTocRescan);
+      m_worksheet->m_scheduleTocRescan = false;
     }
     m_worksheet->m_scheduleUpdateToc = false;
 
@@ -4669,6 +4754,7 @@ void wxMaxima::UpdateMenus(wxUpdateUIEvent &WXUNUSED(event))
   for (int id = menu_pane_math; id <= menu_pane_stats; id++)
     m_MenuBar->Check(id, IsPaneDisplayed(static_cast<Event>(id)));
   m_MenuBar->Check(menu_show_toolbar, ToolbarIsShown());
+  m_MenuBar->Check(menu_show_evaluation_stats, m_worksheet->m_configuration->ShowEvaluationStats());
 
   bool hidecode = !(m_worksheet->m_configuration->ShowCodeCells());
   m_MenuBar->Check(ToolBar::tb_hideCode, hidecode);
@@ -4869,6 +4955,8 @@ bool wxMaxima::OpenFile(wxString file, wxString command)
     wxLogError(_("Trying to open the non-existing file %s"), file.utf8_str());
     return false;
   }
+  // The result of saving the old document has to be handled before it is replaced
+  FinishBackgroundSave();
 
   m_lastPath = wxPathOnly(file);
   wxString unixFilename(file);
@@ -4979,6 +5067,7 @@ bool wxMaxima::OpenFile(wxString file, wxString command)
   if (m_worksheet->m_tableOfContents != NULL)
   {
     m_worksheet->m_scheduleUpdateToc = false;
+    m_worksheet->m_scheduleTocRescan = false;
     m_worksheet->m_tableOfContents->UpdateTableOfContents(m_worksheet->GetTree(), m_worksheet->GetHCaret());
   }
 
@@ -5004,8 +5093,11 @@ bool wxMaxima::OpenFile(wxString file, wxString command)
   return retval;
 }
 
-bool wxMaxima::SaveFile(bool forceSave)
+bool wxMaxima::SaveFile(bool forceSave, bool inBackground)
 {
+  // Don't let two saves write to the same file at the same time
+  FinishBackgroundSave();
+
   // Show a busy cursor as long as we export a file.
   wxBusyCursor crs;
 
@@ -5085,12 +5177,20 @@ bool wxMaxima::SaveFile(bool forceSave)
         m_autoSaveTimer.StartOnce(180000);
         return false;
       }
-      else
+    }
+    else if (inBackground)
+    {
+      // The rest is done by FinishBackgroundSave() once the file is written
+      if (!m_worksheet->ExportToWXMXInBackground(file))
       {
-        RemoveTempAutosavefile();
-        if(file != m_tempfileName)
-          m_worksheet->m_currentFile = file;
+        StatusSaveFailed();
+        m_autoSaveTimer.StartOnce(180000);
+        return false;
       }
+      m_backgroundSaveIsAutosave = false;
+      m_backgroundSaveFile = file;
+      m_autoSaveTimer.StartOnce(180000);
+      return true;
     }
     else
     {
@@ -5100,19 +5200,9 @@ bool wxMaxima::SaveFile(bool forceSave)
         m_autoSaveTimer.StartOnce(180000);
         return false;
       }
-      else
-      {
-        RemoveTempAutosavefile();
-        if(file != m_tempfileName)
-          m_worksheet->m_currentFile = file;
-      }
     }
 
-    if(!m_exitAfterEval)
-      m_recentDocuments.AddDocument(file);
-    SetCWD(file);
-    StatusSaveFinished();
-    UpdateRecentDocuments();
+    SaveFileFinished(file);
   }
 
   m_autoSaveTimer.StartOnce(180000);
@@ -5120,6 +5210,71 @@ bool wxMaxima::SaveFile(bool forceSave)
   return true;
 }
 
+void wxMaxima::SaveFileFinished(const wxString &file)
+{
+  RemoveTempAutosavefile();
+  if(file != m_tempfileName)
+    m_worksheet->m_currentFile = file;
+
+  if(!m_exitAfterEval)
+    m_recentDocuments.AddDocument(file);
+  SetCWD(file);
+  StatusSaveFinished();
+  UpdateRecentDocuments();
+}
+
+void wxMaxima::OnBackgroundSaveFinished(wxThreadEvent &WXUNUSED(event))
+{
+  // The result might already have been handled by a save that had to wait for it.
+  if(m_worksheet->BackgroundSaveDone())
+    FinishBackgroundSave();
+}
+
+bool wxMaxima::FinishBackgroundSave()
+{
+  if(!m_worksheet->BackgroundSavePending())
+    return true;
+
+  bool saved = m_worksheet->FinishBackgroundSave();
+  if(m_backgroundSaveIsAutosave)
+  {
+    // Only now that the new temp file exists the old one isn't needed any more
+    if(saved)
+    {
+      RemoveObsoleteTempFile(m_backgroundSaveObsoleteTempFile);
+      RegisterAutoSaveFile();
+    }
+    else
+      wxLogMessage(wxString::Format(_("Autosaving as temp file %s has failed"),
+                                    m_backgroundSaveFile.utf8_str()));
+  }
+  else
+  {
+    if(saved)
+      SaveFileFinished(m_backgroundSaveFile);
+    else
+      StatusSaveFailed();
+    ResetTitle(m_worksheet->IsSaved(), true);
+  }
+  m_backgroundSaveFile = wxEmptyString;
+  m_backgroundSaveObsoleteTempFile = wxEmptyString;
+  return saved;
+}
+
+void wxMaxima::RemoveObsoleteTempFile(const wxString &tempFile)
+{
+  if(tempFile.IsEmpty())
+    return;
+
+  if(wxFileExists(tempFile))
+  {
+    SuppressErrorDialogs blocker;
+    wxLogMessage(wxString::Format(_("Trying to remove the old temp file %s"), tempFile.utf8_str()));
+    wxRemoveFile(tempFile);
+  }
+  AutosaveJournal::Remove(tempFile);
+}
+
 void wxMaxima::ReadStdErr()
 {
   SuppressErrorDialogs blocker;
@@ -5399,6 +5554,13 @@ bool wxMaxima::AutoSave()
 {
   if(!SaveNecessary())
     return true;
+
+  // The changes will be saved by the next autosave
+  if(m_worksheet->BackgroundSavePending())
+  {
+    wxLogMessage(_("The last save is still being written => Postponing the autosave"));
+    return m_worksheet->IsSaved();
+  }
   
   bool savedWas = m_worksheet->IsSaved();
   bool saved;
@@ -5411,31 +5573,69 @@ bool wxMaxima::AutoSave()
   if (m_worksheet->m_configuration->AutoSaveAsTempFile() ||
       m_worksheet->m_currentFile.IsEmpty())
   {
-    saved = m_worksheet->ExportToWXMX(m_tempfileName);
-
-    wxLogMessage(wxString::Format(_("Autosaving as temp file %s"), m_tempfileName.utf8_str()));
-    if((m_tempfileName != oldTempFile) && saved)
+    if(m_autosaveJournal.IsCompacting())
     {
-      if(!oldTempFile.IsEmpty())
+      // The temp file is being rewritten in the background => The changes
+      // will be saved by the next autosave.
+      wxLogMessage(_("The autosave journal is being merged into the temp file => Postponing the autosave"));
+      saved = false;
+    }
+    else if(m_autosaveJournal.CanAppend(m_tempfileName))
+    {
+      // The temp file contains most of the document already => Append only
+      // what has changed since the last autosave.
+      wxLogMessage(wxString::Format(_("Autosaving the changes to the journal of the temp file %s"),
+                                    m_tempfileName.utf8_str()));
+      saved = m_worksheet->AppendToAutosaveJournal(m_autosaveJournal);
+      if(saved)
+        m_autosaveJournal.CompactIfNeeded();
+      else
       {
-        if(wxFileExists(oldTempFile))
-        {
-          SuppressErrorDialogs blocker;
-          wxLogMessage(wxString::Format(_("Trying to remove the old temp file %s"), oldTempFile.utf8_str()));
-          wxRemoveFile(oldTempFile);
-        }
+        // The journal might be broken now => Start over with a full autosave next time.
+        m_autosaveJournal.Reset();
       }
     }
-    RegisterAutoSaveFile();
+    else
+    {
+      // An eventual old journal doesn't describe the new temp file
+      m_autosaveJournal.Reset();
+      AutosaveJournal::Remove(m_tempfileName);
+      wxLogMessage(wxString::Format(_("Autosaving as temp file %s"), m_tempfileName.utf8_str()));
+      // Writing all images of a big document takes time => Don't block the
+      // user interface meanwhile. The old temp file is removed by
+      // FinishBackgroundSave() once the new one has been written.
+      if(m_worksheet->ExportToWXMXInBackground(m_tempfileName, false, &m_autosaveJournal))
+      {
+        m_backgroundSaveIsAutosave = true;
+        m_backgroundSaveFile = m_tempfileName;
+        if(m_tempfileName != oldTempFile)
+          m_backgroundSaveObsoleteTempFile = oldTempFile;
+      }
+      // Not written, yet
+      saved = false;
+    }
+
+    // A temp file that is written in the background is registered by
+    // FinishBackgroundSave() once it exists.
+    if(saved)
+    {
+      if(m_tempfileName != oldTempFile)
+        RemoveObsoleteTempFile(oldTempFile);
+      RegisterAutoSaveFile();
+    }
   }
   else
   {
     wxLogMessage(wxString::Format(_("Autosaving the .wxmx file as %s"),
                                   m_worksheet->m_currentFile.utf8_str()));
-    savedWas = saved = SaveFile(false);
+    saved = SaveFile(false, true);
+    // A save in the background marks the document as saved only once the file
+    // has been written, and only if it hasn't been modified meanwhile.
+    savedWas = m_worksheet->IsSaved();
   }
 
-  m_worksheet->SetSaved(savedWas);
+  if(m_worksheet->IsSaved() != savedWas)
+    m_worksheet->SetSaved(savedWas);
   ResetTitle(savedWas, true);
 
   oldTempFile = m_tempfileName;
@@ -5505,13 +5705,13 @@ void wxMaxima::FileMenu(wxCommandEvent &event)
     case wxID_SAVEAS:
       forceSave = true;
       m_fileSaved = false;
-      SaveFile(forceSave);
+      SaveFile(forceSave, true);
       // Seems like resetting the title on "file/save as" is a little bit
       // sluggish, otherwise.
       ResetTitle(m_worksheet->IsSaved(), true);
       break;
     case wxID_SAVE:
-      SaveFile(forceSave);
+      SaveFile(forceSave, true);
       // Seems like resetting the title on "file/save as" is a little bit
       // sluggish, otherwise.
       ResetTitle(m_worksheet->IsSaved(), true);
@@ -5612,7 +5812,20 @@ void wxMaxima::FileMenu(wxCommandEvent &event)
             // Show a busy cursor as long as we export a file.
             wxBusyCursor crs;
             fileExt = wxT("html");
-            if (!m_worksheet->ExportToHTML(file))
+            long lastPercent = -1;
+            std::function<void(long, long)> progress =
+              [this, &lastPercent](long done, long total)
+              {
+                long percent = done * 100 / total;
+                if(percent == lastPercent)
+                  return;
+                lastPercent = percent;
+                // We don't reach the idle loop before the export is finished
+                // => Update the status bar directly.
+                SetStatusText(wxString::Format(_("Exporting to HTML: %li%%"), percent), 0);
+                m_statusBar->Update();
+              };
+            if (!m_worksheet->ExportToHTML(file, progress))
             {
               LoggingMessageBox(_("Exporting to HTML failed!"), _("Error!"),
                            wxOK);
@@ -5629,6 +5842,42 @@ void wxMaxima::FileMenu(wxCommandEvent &event)
     }
       break;
 
+    case menu_export_evaluation_stats:
+    {
+      wxString file = m_worksheet->m_currentFile;
+      if (file.Length() == 0)
+        file = _("untitled");
+      else
+        wxFileName::SplitPath(file, NULL, NULL, &file, NULL);
+
+      wxFileDialog fileDialog(this,
+                              _("Export Evaluation Timings"), m_lastPath,
+                              file + wxT("_timings.csv"),
+                              _("Comma-separated values (*.csv)|*.csv|"
+                                "JSON (*.json)|*.json"),
+                              wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+      if (fileDialog.ShowModal() == wxID_OK)
+      {
+        file = fileDialog.GetPath();
+        if ((!file.Lower().EndsWith(wxT(".csv"))) &&
+            (!file.Lower().EndsWith(wxT(".json"))))
+        {
+          if (fileDialog.GetFilterIndex() == 1)
+            file += wxT(".json");
+          else
+            file += wxT(".csv");
+        }
+        if (!m_worksheet->ExportEvaluationStats(file))
+          LoggingMessageBox(_("Exporting the evaluation timings failed!"), _("Error!"),
+                            wxOK);
+      }
+    }
+      break;
+
+    case menu_purge_export_cache:
+      ExportCache::Purge();
+      break;
+
     case menu_load_id:
     {
       wxString file = wxFileSelector(_("Load Package"), m_lastPath,
@@ -5791,25 +6040,7 @@ void wxMaxima::EditMenu(wxCommandEvent &event)
     }
       
     // Find gnuplot
-    wxString gnuplot_binary;
-    if(wxFileName(m_gnuplotcommand).IsAbsolute())
-      gnuplot_binary = m_gnuplotcommand;
-    else
-    {
-      wxPathList pathlist;
-      pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath());
-      pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath()+"/../");
-      pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath()+"/../gnuplot");
-      pathlist.Add(wxFileName(wxStandardPaths::Get().GetExecutablePath()).GetPath()+"/../gnuplot/bin");
-      pathlist.AddEnvList(wxT("PATH"));
-      gnuplot_binary = pathlist.FindAbsoluteValidPath(m_gnuplotcommand);
-      if(gnuplot_binary == wxEmptyString)
-        gnuplot_binary = pathlist.FindAbsoluteValidPath(m_gnuplotcommand + wxT(".exe"));
-      if(gnuplot_binary == wxEmptyString)
-        gnuplot_binary = pathlist.FindAbsoluteValidPath(m_gnuplotcommand + wxT(".exe"));
-      if(gnuplot_binary == wxEmptyString)
-        gnuplot_binary = m_gnuplotcommand;
-    }
+    wxString gnuplot_binary = GnuplotBinary();
     // Execute gnuplot
     wxString cmdline = gnuplot_binary + wxT(" " + gnuplotSource + wxT(".popout"));
     wxLogMessage(_("Running gnuplot as: " + cmdline));
@@ -6107,6 +6338,13 @@ void wxMaxima::MaximaMenu(wxCommandEvent &event)
         dynamic_cast<GroupCell *>(m_worksheet->m_cellPointers.m_errorList.FirstError())->GetEditable()->CaretToEnd();
       }
       break;
+    case menu_show_evaluation_stats:
+      m_worksheet->m_configuration->ShowEvaluationStats(
+        !m_worksheet->m_configuration->ShowEvaluationStats());
+      // The timings need a line of their own below the output
+      m_worksheet->RecalculateForce();
+      m_worksheet->RequestRedraw();
+      break;
     case ToolBar::menu_restart_id:
       m_closing = true;
       m_worksheet->m_cellPointers.SetWorkingGroup(NULL);
@@ -8144,6 +8382,10 @@ void wxMaxima::HelpMenu(wxCommandEvent &event)
       MenuCommand(wxT("build_info();"));
       break;
 
+    case menu_memory_usage:
+      LoggingMessageBox(m_worksheet->MemoryUsageReport(), _("Memory Usage"), wxOK);
+      break;
+
     case menu_bug_report:
       MenuCommand(wxT("wxbug_report()$"));
       break;
@@ -8471,6 +8713,8 @@ void wxMaxima::OnClose(wxCloseEvent &event)
   #ifdef HAVE_OPENMP_TASKS
   #pragma omp taskwait
   #endif
+  // We need to know if the last save has worked before deciding if we can close
+  FinishBackgroundSave();
   
   if(event.GetEventType() == wxEVT_END_SESSION)
     KillMaxima();
@@ -9332,6 +9576,7 @@ void wxMaxima::TriggerEvaluation()
         m_worksheet->SetSelection(NULL, NULL);
     }
     tmp->RemoveOutput();
+    tmp->GetEvaluationStats().Clear();
     m_worksheet->RequestRedraw();
   }
 
@@ -9356,6 +9601,7 @@ void wxMaxima::TriggerEvaluation()
       m_worksheet->m_cellPointers.SetWorkingGroup(tmp);
       tmp->GetPrompt()->SetValue(m_lastPrompt);
 
+      tmp->GetEvaluationStats().MaximaStarted();
       SendMaxima(m_configCommands + text, true);
       m_maximaBusy = true;
       // Now that we have sent a command we need to query all variable values anew
@@ -9814,7 +10060,10 @@ void wxMaxima::HistoryDClick(wxCommandEvent &event)
 
 void wxMaxima::TableOfContentsSelection(wxListEvent &event)
 {
-  GroupCell *selection = dynamic_cast<GroupCell *>(m_worksheet->m_tableOfContents->GetCell(event.GetIndex())->GetGroup());
+  GroupCell *selection = m_worksheet->m_tableOfContents->GetCell(event.GetIndex());
+  if (selection == NULL)
+    return;
+  selection = dynamic_cast<GroupCell *>(selection->GetGroup());
 
   // We only update the table of contents when there is time => no guarantee that the
   // cell that was clicked at actually still is part of the tree.
@@ -10034,6 +10283,125 @@ void wxMaxima::ChangeCellStyle(wxCommandEvent& WXUNUSED(event))
 }
 
 
+int wxMaxima::Benchmark(const wxArrayString &files, wxString baseline, wxString writeBaseline)
+{
+  // The size of the offscreen bitmap the worksheet is drawn into
+  const int benchmarkWidth = 1024;
+  const int benchmarkHeight = 4096;
+  // The number of chars maxima's output is fed to InterpretDataFromMaxima() at once
+  const size_t chunkSize = 8192;
+
+  std::map<wxString, long> baselineTimes;
+  if (!baseline.IsEmpty())
+  {
+    wxTextFile baselineFile(baseline);
+    if (!baselineFile.Open())
+    {
+      std::cerr << "Cannot open the benchmark baseline " << baseline << "\n";
+      return 1;
+    }
+    for (size_t i = 0; i < baselineFile.GetLineCount(); i++)
+    {
+      wxString line = baselineFile[i];
+      line.Trim(false);
+      if (line.IsEmpty() || line.StartsWith(wxT("#")))
+        continue;
+      long millis;
+      if (line.AfterLast(wxT(' ')).ToLong(&millis))
+        baselineTimes[line.BeforeLast(wxT(' '))] = millis;
+    }
+  }
+
+  wxString baselineOut = wxT("# file total_ms, as written by wxmaxima --benchmark-write-baseline\n");
+  int failures = 0;
+
+  // Lay out and draw everything in an offscreen bitmap so we don't depend on a
+  // visible window.
+  wxBitmap bitmap(benchmarkWidth, benchmarkHeight, 24);
+  wxMemoryDC dc(bitmap);
+  m_worksheet->m_configuration->SetClientWidth(benchmarkWidth);
+  m_worksheet->m_configuration->SetCanvasSize(wxSize(benchmarkWidth, benchmarkHeight));
+
+  for (size_t i = 0; i < files.GetCount(); i++)
+  {
+    wxString name = wxFileName(files[i]).GetFullName();
+    wxString data;
+    wxFile file(files[i]);
+    if ((!file.IsOpened()) || (!file.ReadAll(&data, wxConvUTF8)))
+    {
+      std::cerr << "benchmark: " << name << ": cannot read the file\n";
+      failures++;
+      continue;
+    }
+
+    m_worksheet->ClearDocument();
+    m_worksheet->m_configuration->SetContext(dc);
+    GroupCell *group = new GroupCell(&(m_worksheet->m_configuration), GC_TYPE_CODE,
+                                     &m_worksheet->m_cellPointers, wxEmptyString);
+    m_worksheet->InsertGroupCells(group);
+    m_worksheet->m_cellPointers.SetWorkingGroup(group);
+    m_first = false;
+
+    // Interpreting the data includes parsing it and laying out each new output line.
+    wxStopWatch interpretTime;
+    for (size_t pos = 0; pos < data.Length(); pos += chunkSize)
+    {
+      m_newCharsFromMaxima = data.Mid(pos, chunkSize);
+      InterpretDataFromMaxima();
+    }
+    long interpret = interpretTime.Time();
+    long parse = (group->GetEvaluationStats().GetParseTime() / 1000).ToLong();
+
+    wxStopWatch layoutTime;
+    m_worksheet->RecalculateForce();
+    m_worksheet->RecalculateIfNeeded();
+    long layout = layoutTime.Time();
+
+    wxStopWatch drawTime;
+    m_worksheet->DrawOffscreen(dc);
+    long draw = drawTime.Time();
+
+    long total = interpret + layout + draw;
+    std::cout << "benchmark: " << name
+              << " bytes=" << data.utf8_str().length()
+              << " interpret_ms=" << interpret
+              << " parse_ms=" << parse
+              << " layout_ms=" << layout
+              << " draw_ms=" << draw
+              << " total_ms=" << total << "\n";
+    baselineOut += wxString::Format(wxT("%s %li\n"), name, total);
+
+    std::map<wxString, long>::const_iterator expected = baselineTimes.find(name);
+    if (expected != baselineTimes.end())
+    {
+      // Timings are noisy and depend on the machine, especially on shared CI
+      // machines => Only complain about big regressions.
+      if (total > 3 * expected->second)
+      {
+        std::cout << "benchmark: " << name << " is much slower than the baseline ("
+                  << expected->second << " ms)\n";
+        failures++;
+      }
+    }
+  }
+  m_worksheet->ClearDocument();
+
+  if (!writeBaseline.IsEmpty())
+  {
+    wxFile out(writeBaseline, wxFile::write);
+    if ((!out.IsOpened()) || (!out.Write(baselineOut)))
+    {
+      std::cerr << "Cannot write the benchmark baseline " << writeBaseline << "\n";
+      failures++;
+    }
+  }
+  return failures;
+}
+
+bool wxMaxima::m_noMaxima = false;
+wxString wxMaxima::m_recordTranscript;
+wxString wxMaxima::m_replayTranscript;
+bool wxMaxima::m_replayFullSpeed = false;
 bool wxMaxima::m_pipeToStdout = false;
 bool wxMaxima::m_exitOnError = false;
 wxString wxMaxima::m_extraMaximaArgs;
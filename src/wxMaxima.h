@@ -34,6 +34,7 @@
 #include "wxMaximaFrame.h"
 #include "MathParser.h"
 #include "Dirstructure.h"
+#include "MaximaTranscript.h"
 
 #include <wx/socket.h>
 #include <wx/config.h>
@@ -111,6 +112,35 @@ public:
   static void PipeToStdout(){m_pipeToStdout = true;}
   static void ExitOnError(){m_exitOnError = true;}
   static void ExtraMaximaArgs(wxString args){m_extraMaximaArgs = args;}
+  //! Don't start a maxima process. Used by the --benchmark mode.
+  static void NoMaxima(){m_noMaxima = true;}
+  //! Record a transcript of the communication with maxima to a file
+  static void RecordTranscript(wxString file){m_recordTranscript = file;}
+  /*! Don't start maxima but play back a transcript recorded using RecordTranscript()
+
+    \param file The transcript
+    \param fullSpeed false = replay the transcript with its original timing,
+                      true = send the data as fast as we can process it.
+   */
+  static void ReplayTranscript(wxString file, bool fullSpeed)
+    {m_replayTranscript = file; m_replayFullSpeed = fullSpeed;}
+
+  /*! Replay recorded maxima output through the frontend and measure each stage
+
+    Feeds each file through InterpretDataFromMaxima() without a maxima process
+    being involved, lays out the resulting worksheet and draws it into an
+    offscreen bitmap. The time each stage has needed is written to stdout.
+
+    \param files The files containing the recorded output of maxima, as shown
+           in the XML inspector.
+    \param baseline A file with the timings of a previous run. If a file is
+           more than three times as slow as in the baseline this
+           is counted as a failure.
+    \param writeBaseline If not empty the timings of this run are written to this file.
+    \return The number of files that failed or were much slower than the baseline.
+   */
+  int Benchmark(const wxArrayString &files,
+                wxString baseline = wxEmptyString, wxString writeBaseline = wxEmptyString);
 
   //! An enum of individual IDs for all timers this class handles
   enum TimerIDs
@@ -216,6 +246,14 @@ private:
   static bool m_pipeToStdout;
   static bool m_exitOnError;
   static wxString m_extraMaximaArgs;
+  //! Don't start maxima, see NoMaxima()
+  static bool m_noMaxima;
+  //! The file to record a transcript of the communication with maxima to
+  static wxString m_recordTranscript;
+  //! The transcript to play back instead of starting maxima
+  static wxString m_replayTranscript;
+  //! Play back m_replayTranscript as fast as possible?
+  static bool m_replayFullSpeed;
   //! Search for the wxMaxima help file
   wxString SearchwxMaximaHelp();
   wxLocale *m_locale;
@@ -275,7 +313,13 @@ private:
   wxMemoryBuffer m_uncompletedChars;
 
 protected:
-  void CompileHelpFileAnchors();
+  /*! Make the anchors of maxima's manual known
+
+    \param scan false = only read the cached anchors, don't scan the manual if
+           there is no valid cache.
+    \return true, if the anchors are known now.
+   */
+  bool CompileHelpFileAnchors(bool scan = true);
   //! The gnuplot process info
   wxProcess *m_gnuplotProcess;
   //! Is this window active?
@@ -494,6 +538,7 @@ protected:
 
   void OnClose(wxCloseEvent &event);               //!< close wxMaxima window
   wxString GetCommand(bool params = true);         //!< returns the command to start maxima
+  wxString GnuplotBinary();                        //!< returns the gnuplot binary maxima uses
   //    (uses guessConfiguration)
 
   //! Polls the stderr and stdout of maxima for input.
@@ -653,8 +698,25 @@ protected:
   /*! Saves the current file
 
     \param forceSave true means: Always ask for a file name before saving.
+    \param inBackground true means: Write .wxmx files in a background thread.
+                        The return value then only tells if saving could be started.
+   */
+  bool SaveFile(bool forceSave = false, bool inBackground = false);
+
+  //! Everything that has to be done after a file has been saved successfully
+  void SaveFileFinished(const wxString &file);
+
+  //! Called when a background save has written its file
+  void OnBackgroundSaveFinished(wxThreadEvent &event);
+
+  /*! Wait for an eventual background save and handle its result
+
+    \return false if a background save has failed.
    */
-  bool SaveFile(bool forceSave = false);
+  bool FinishBackgroundSave();
+
+  //! Remove a temp file an earlier autosave has written
+  void RemoveObsoleteTempFile(const wxString &tempFile);
 
   //! Try to save the file before closing it - or return false 
   bool SaveOnClose();
@@ -680,6 +742,10 @@ protected:
   std::unique_ptr<wxTextInputStream> m_clientTextStream;
   wxSocketServer *m_server;
   wxProcess *m_process;
+  //! The transcript of the communication with maxima we record, if any
+  std::unique_ptr<MaximaTranscript> m_transcript;
+  //! The fake maxima that plays back m_replayTranscript
+  std::unique_ptr<MaximaTranscriptReplayer> m_fakeMaxima;
   //! The stdout of the maxima process
   wxInputStream *m_maximaStdout;
   //! The stderr of the maxima process
@@ -734,6 +800,12 @@ protected:
   //! The directory with maxima's documentation
   wxString m_maximaDocDir;
   bool m_fileSaved;
+  //! Is the background save that is running an autosave to a temp file?
+  bool m_backgroundSaveIsAutosave;
+  //! The file the background save that is running writes to
+  wxString m_backgroundSaveFile;
+  //! The temp file that can be removed once the background autosave has succeeded
+  wxString m_backgroundSaveObsoleteTempFile;
   wxString m_chmhelpFile;
   wxString m_maximaVersion;
   wxString m_maximaArch;
@@ -170,7 +170,7 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
   // The table of contents
   m_worksheet->m_tableOfContents = new TableOfContents(this, -1, &m_worksheet->m_configuration);
 
-  m_xmlInspector = new XmlInspector(this, -1);
+  m_xmlInspector = new XmlInspector(this, -1, &m_worksheet->m_configuration);
   m_statusBar = new StatusBar(this, -1);
   SetStatusBar(m_statusBar);
   m_StatusSaving = false;
@@ -657,6 +657,12 @@ void wxMaximaFrame::SetupMenu()
                      _("Load a Maxima file using the batch command"), wxITEM_NORMAL);
   m_FileMenu->Append(menu_export_html, _("&Export..."),
                      _("Export document to a HTML or pdfLaTeX file"), wxITEM_NORMAL);
+  m_FileMenu->Append(menu_export_evaluation_stats, _("Export Evaluation &Timings..."),
+                     _("Export the time maxima and wxMaxima needed for each cell as CSV or JSON"),
+                     wxITEM_NORMAL);
+  m_FileMenu->Append(menu_purge_export_cache, _("Clear Export &Cache"),
+                     _("Delete the images earlier exports have rendered for reuse"),
+                     wxITEM_NORMAL);
   m_FileMenu->AppendSeparator();
   APPEND_MENU_ITEM(m_FileMenu, wxID_PRINT, _("&Print...\tCtrl+P"),
                    _("Print document"), wxT("gtk-print"));
@@ -927,6 +933,8 @@ void wxMaximaFrame::SetupMenu()
   m_MaximaMenu->Append(menu_jumptoerror, _("Jump to first error"),
                        _("Jump to the first cell Maxima has reported an error in."),
                        wxITEM_NORMAL);
+  m_MaximaMenu->AppendCheckItem(menu_show_evaluation_stats, _("Show Evaluation Timings"),
+                                _("Show how long maxima and wxMaxima needed for each cell"));
   m_MenuBar->Append(m_MaximaMenu, _("&Maxima"));
 
   // Equations menu
@@ -1335,6 +1343,8 @@ void wxMaximaFrame::SetupMenu()
   m_HelpMenu->AppendSeparator();
   m_HelpMenu->Append(menu_build_info, _("Build &Info"),
                      _("Info about Maxima build"), wxITEM_NORMAL);
+  m_HelpMenu->Append(menu_memory_usage, _("&Memory Usage"),
+                     _("How much memory the cells of each type occupy"), wxITEM_NORMAL);
   m_HelpMenu->Append(menu_bug_report, _("&Bug Report"),
                      _("Report bug"), wxITEM_NORMAL);
   m_HelpMenu->Append(menu_license, _("&License"),
@@ -1498,6 +1508,7 @@ void wxMaximaFrame::RegisterAutoSaveFile()
 
 void wxMaximaFrame::RemoveTempAutosavefile()
 {
+  m_autosaveJournal.Reset();
   if(m_tempfileName != wxEmptyString)
   {
     // Don't delete the file if we have opened it and haven't saved it under a
@@ -1506,6 +1517,7 @@ void wxMaximaFrame::RemoveTempAutosavefile()
     {
       SuppressErrorDialogs logNull;
       wxRemoveFile(m_tempfileName);
+      AutosaveJournal::Remove(m_tempfileName);
     }
   }
   m_tempfileName = wxEmptyString;
@@ -208,6 +208,7 @@ public:
     menu_imagpart,
     menu_subst,
     menu_jumptoerror,
+    menu_show_evaluation_stats,
     menu_math_as_1D_ASCII,
     menu_math_as_2D_ASCII,
     menu_math_as_graphics,
@@ -263,6 +264,7 @@ public:
     menu_soft_restart,
     menu_plot_format,
     menu_build_info,
+    menu_memory_usage,
     menu_bug_report,
     menu_add_path,
     menu_evaluate_all_visible,
@@ -291,6 +293,8 @@ public:
     menu_copy_as_rtf,
     menu_copy_to_file,
     menu_export_html,
+    menu_export_evaluation_stats,
+    menu_purge_export_cache,
     menu_change_var,
     menu_nouns,
     menu_evaluate,
@@ -577,6 +581,8 @@ protected:
   long m_pid;
   //! The last name GetTempAutosavefileName() has returned.
   wxString m_tempfileName;
+  //! The changes the autosaves since the last full autosave to m_tempfileName have written
+  AutosaveJournal m_autosaveJournal;
   //! Issued if a notification is closed.
   void OnNotificationClose(wxCommandEvent WXUNUSED(&event));
   //! The status bar